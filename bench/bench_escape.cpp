@@ -0,0 +1,103 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*
+*  html_escape benchmark
+*  Compares the previous char-by-char implementation against the scalar
+*  and runtime-dispatched (SIMD) paths on clean and markup-heavy text.
+*/
+
+#include "../include/html_gen.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+    // The implementation html_escape replaced, kept for comparison
+    std::string legacy_escape(std::string_view input) {
+        std::string result;
+        result.reserve(input.size() * 1.1);
+        for (char c : input) {
+            switch (c) {
+                case '&':  result += "&amp;";  break;
+                case '<':  result += "&lt;";   break;
+                case '>':  result += "&gt;";   break;
+                case '"':  result += "&quot;"; break;
+                case '\'': result += "&#39;";  break;
+                default:   result += c;        break;
+            }
+        }
+        return result;
+    }
+
+    std::string make_log_text(size_t _bytes, size_t _special_every) {
+        const std::string line = "2024-03-01 12:00:00 INFO worker[42] processed request id=8812 in 3ms ";
+        std::string s;
+        s.reserve(_bytes);
+        size_t i = 0;
+        while(s.size() < _bytes) {
+            s += line[i % line.size()];
+            if(_special_every && i % _special_every == 0) {
+                s += "<&>\"'"[i % 5];
+            }
+            i++;
+        }
+        return s;
+    }
+
+    template<class F>
+    void run(const char* _name, const std::string& _input, int _iterations, F&& _f) {
+        size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < _iterations; i++) {
+            sink += _f(_input);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double secs = std::chrono::duration<double>(end - start).count();
+        double mb = static_cast<double>(_input.size()) * _iterations / (1024.0 * 1024.0);
+        std::printf("  %-12s %9.1f MB/s  (%zu)\n", _name, mb / secs, sink);
+    }
+
+}
+
+int main() {
+    std::printf("html_escape dispatch: %s\n", html::detail::html_escape_impl());
+
+    struct workload { const char* name; size_t special_every; };
+    const workload workloads[] = {
+        { "clean", 0 },
+        { "1 in 200", 200 },
+        { "1 in 20", 20 },
+        { "1 in 3", 3 },
+    };
+
+    const size_t bytes = 4 * 1024 * 1024;
+    const int iterations = 20;
+
+    for(const auto& w : workloads) {
+        std::string input = make_log_text(bytes, w.special_every);
+        std::printf("%s (%zu bytes)\n", w.name, input.size());
+
+        run("legacy", input, iterations, [](const std::string& s) {
+            return legacy_escape(s).size();
+        });
+        run("scalar", input, iterations, [](const std::string& s) {
+            std::string out;
+            html::detail::html_escape_scalar(s, out);
+            return out.size();
+        });
+        run("dispatch", input, iterations, [](const std::string& s) {
+            return html::html_escape(s).size();
+        });
+        std::string reused;
+        run("append", input, iterations, [&reused](const std::string& s) {
+            reused.clear();
+            html::html_escape(s, reused);
+            return reused.size();
+        });
+    }
+    return 0;
+}
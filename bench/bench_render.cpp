@@ -0,0 +1,75 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*
+*  Tree rendering benchmark
+*  Serializes a deep nested tree and a wide table into a reused
+*  string_writer and reports the best throughput.
+*/
+
+#include "../include/html_gen.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+    // Nested sections _depth levels deep, _fanout children per level
+    void grow(html::element& _e, int _depth, int _fanout) {
+        if(_depth == 0) {
+            _e << html::span("leaf & text").cl("badge");
+            return;
+        }
+        for(int i = 0; i < _fanout; i++) {
+            html::div d;
+            d.cl("level-" + std::to_string(_depth)).data("i", std::to_string(i));
+            d << html::p("Paragraph at depth " + std::to_string(_depth));
+            grow(d, _depth - 1, _fanout);
+            _e << std::move(d);
+        }
+    }
+
+    html::table make_table(int _rows) {
+        html::table t;
+        t.cl("table table-sm");
+        for(int r = 0; r < _rows; r++) {
+            t << html::tr(html::td("row " + std::to_string(r)),
+                          html::td(std::to_string(r * 7)).cl("text-end"),
+                          html::td(html::anchor("/item/" + std::to_string(r), "open")));
+        }
+        return t;
+    }
+
+    // Best of _iterations, so a busy machine does not skew the comparison
+    void run(const char* _name, html::element& _e, int _iterations) {
+        std::string out;
+        double best = 0;
+        for(int i = 0; i < _iterations; i++) {
+            out.clear();
+            auto start = std::chrono::steady_clock::now();
+            {
+                html::string_writer w(out);
+                _e.write_html(w);
+            }
+            double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if(i == 0 || secs < best) {
+                best = secs;
+            }
+        }
+        std::printf("  %-8s %9.1f MB/s  %8.3f ms/render  (%zu bytes)\n", _name,
+                    out.size() / (1024.0 * 1024.0) / best, best * 1000.0, out.size());
+    }
+
+}
+
+int main() {
+    html::div deep;
+    grow(deep, 6, 5);
+    html::table wide = make_table(20000);
+
+    run("deep", deep, 50);
+    run("table", wide, 20);
+    return 0;
+}
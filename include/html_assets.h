@@ -0,0 +1,46 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_ASSETS__INCLUDED
+#define HTML_ASSETS__INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace html {
+
+        //=============================================================================
+        // CONTENT-HASHED ASSETS (dependency_mode::external)
+        //
+        // Resources are written once to <stem>.<hash><ext> in an asset directory;
+        // pages link to them with an integrity attribute. The hash is part of the
+        // name, so an existing file with that name already holds the content and
+        // any number of pages (or processes) share it.
+        //=============================================================================
+
+        struct asset_info {
+            std::string file_name;      // e.g. "apexcharts.3f9a1c2b4d5e.js"
+            std::string integrity;      // e.g. "sha256-<base64>"
+        };
+
+        // Make sure _content exists as a content-hashed file in _dir (created if
+        // needed) and return its name and SRI hash. Each directory/resource pair
+        // is hashed and checked once per process. Throws std::runtime_error if the
+        // file cannot be written.
+        const asset_info& publish_asset(const std::string& _dir, std::string_view _stem,
+                                        std::string_view _ext, std::string_view _content);
+
+        namespace detail {
+            std::array<std::uint8_t, 32> sha256(std::string_view _data);
+            std::string base64(const std::uint8_t* _p, size_t _n);
+        }
+
+}//html
+
+#endif
@@ -48,6 +48,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                div* ptr = new div();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 
@@ -67,6 +72,12 @@ namespace html {
                 element::m_type = nav_t;
                 add(_e);
             }
+            nav(element&& _e) {
+                m_newline_after_tag = true;
+                m_newline_after_element = true;
+                element::m_type = nav_t;
+                add(std::move(_e));
+            }
             // Variadic constructor for multiple children
             template<typename... Args, typename = std::enable_if_t<(sizeof...(Args) > 1)>>
             nav(Args&&... args) {
@@ -82,6 +93,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                nav* ptr = new nav();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -89,16 +105,21 @@ namespace html {
         class h1 : public element {
           public:
             h1() { m_type = h1_t; m_newline_after_element = true; }
-            h1(const std::string& _s) {
+            h1(std::string_view _s) {
                 m_type = h1_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h1(const element& _e) {
                 m_type = h1_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h1(element&& _e) {
+                m_type = h1_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h1() { ; }
             HTML_FLUENT_METHODS(h1)
             virtual element* make_copy()const override {
@@ -106,21 +127,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h1* ptr = new h1();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class h2 : public element {
           public:
             h2() { m_type = h2_t; m_newline_after_element = true; }
-            h2(const std::string& _s) {
+            h2(std::string_view _s) {
                 m_type = h2_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h2(const element& _e) {
                 m_type = h2_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h2(element&& _e) {
+                m_type = h2_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h2() { ; }
             HTML_FLUENT_METHODS(h2)
             virtual element* make_copy()const override {
@@ -128,21 +159,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h2* ptr = new h2();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class h3 : public element {
           public:
             h3() { m_type = h3_t; m_newline_after_element = true; }
-            h3(const std::string& _s) {
+            h3(std::string_view _s) {
                 m_type = h3_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h3(const element& _e) {
                 m_type = h3_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h3(element&& _e) {
+                m_type = h3_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h3() { ; }
             HTML_FLUENT_METHODS(h3)
             virtual element* make_copy()const override {
@@ -150,21 +191,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h3* ptr = new h3();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class h4 : public element {
           public:
             h4() { m_type = h4_t; m_newline_after_element = true; }
-            h4(const std::string& _s) {
+            h4(std::string_view _s) {
                 m_type = h4_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h4(const element& _e) {
                 m_type = h4_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h4(element&& _e) {
+                m_type = h4_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h4() { ; }
             HTML_FLUENT_METHODS(h4)
             virtual element* make_copy()const override {
@@ -172,21 +223,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h4* ptr = new h4();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class h5 : public element {
           public:
             h5() { m_type = h5_t; m_newline_after_element = true; }
-            h5(const std::string& _s) {
+            h5(std::string_view _s) {
                 m_type = h5_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h5(const element& _e) {
                 m_type = h5_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h5(element&& _e) {
+                m_type = h5_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h5() { ; }
             HTML_FLUENT_METHODS(h5)
             virtual element* make_copy()const override {
@@ -194,21 +255,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h5* ptr = new h5();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class h6 : public element {
           public:
             h6() { m_type = h6_t; m_newline_after_element = true; }
-            h6(const std::string& _s) {
+            h6(std::string_view _s) {
                 m_type = h6_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             h6(const element& _e) {
                 m_type = h6_t;
                 m_newline_after_element = true;
                 add(_e);
             }
+            h6(element&& _e) {
+                m_type = h6_t;
+                m_newline_after_element = true;
+                add(std::move(_e));
+            }
             virtual ~h6() { ; }
             HTML_FLUENT_METHODS(h6)
             virtual element* make_copy()const override {
@@ -216,6 +287,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                h6* ptr = new h6();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -223,9 +299,9 @@ namespace html {
         class p : public element {
           public:
             p() { element::m_type = p_t; }
-            p(const std::string& _s) {
+            p(std::string_view _s) {
                 element::m_type = p_t;
-                add(text(_s));
+                add(_s);
             }
             p(element& _e) {
                 element::m_type = p_t;
@@ -248,6 +324,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                p* ptr = new html::p();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -255,9 +336,9 @@ namespace html {
         class em : public element {
           public:
             em() { element::m_type = em_t; }
-            em(const std::string& _s) {
+            em(std::string_view _s) {
                 element::m_type = em_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~em() { ; }
             HTML_FLUENT_METHODS(em)
@@ -266,6 +347,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                em* ptr = new html::em();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -273,9 +359,9 @@ namespace html {
         class strong : public element {
           public:
             strong() { element::m_type = strong_t; }
-            strong(const std::string& _s) {
+            strong(std::string_view _s) {
                 element::m_type = strong_t;
-                add(text(_s));
+                add(_s);
             }
             strong(element& _e) {
                 element::m_type = strong_t;
@@ -293,6 +379,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                strong* ptr = new html::strong();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -300,14 +391,18 @@ namespace html {
         class b : public element {
           public:
             b() { element::m_type = b_t; }
-            b(const std::string& _s) {
+            b(std::string_view _s) {
                 element::m_type = b_t;
-                add(text(_s));
+                add(_s);
             }
             b(element& _e) {
                 element::m_type = b_t;
                 add(_e);
             }
+            b(element&& _e) {
+                element::m_type = b_t;
+                add(std::move(_e));
+            }
             virtual ~b() { ; }
             HTML_FLUENT_METHODS(b)
             virtual element* make_copy()const override {
@@ -315,6 +410,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                html::b* ptr = new html::b();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 
@@ -325,9 +425,9 @@ namespace html {
         class small_ : public element {
           public:
             small_() { element::m_type = small_t; }
-            small_(const std::string& _s) {
+            small_(std::string_view _s) {
                 element::m_type = small_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~small_() { ; }
             HTML_FLUENT_METHODS(small_)
@@ -336,6 +436,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                small_* ptr = new html::small_();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -343,9 +448,9 @@ namespace html {
         class span : public element {
           public:
             span() { element::m_type = span_t; }
-            span(const std::string& _s) {
+            span(std::string_view _s) {
                 element::m_type = span_t;
-                add(text(_s));
+                add(_s);
             }
             HTML_FLUENT_METHODS(span)
             virtual ~span() { ; }
@@ -354,6 +459,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                span* ptr = new html::span();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -381,6 +491,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                ul* ptr = new html::ul();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -404,6 +519,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                ol* ptr = new html::ol();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -411,10 +531,10 @@ namespace html {
         class li : public element {
           public:
             li() { element::m_type = li_t; }
-            li(const std::string& _s) {
+            li(std::string_view _s) {
                 element::m_type = li_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             li(element& _e) {
                 element::m_type = li_t;
@@ -440,6 +560,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                li* ptr = new html::li();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -447,9 +572,9 @@ namespace html {
         class textarea : public element {
           public:
             textarea() { element::m_type = textarea_t; }
-            textarea(const std::string& _s) {
+            textarea(std::string_view _s) {
                 element::m_type = textarea_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~textarea() { ; }
             HTML_FLUENT_METHODS(textarea)
@@ -458,6 +583,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                textarea* ptr = new html::textarea();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -466,11 +596,12 @@ namespace html {
           public:
             br() {
                 element::m_type = br_t;
+                element::m_writer = writer_custom;
                 element::m_has_closing_tag = false;
                 element::m_is_container = false;
             }
             virtual ~br() { ; }
-            virtual void write_html(std::ostream& _s)override {
+            virtual void write_html(writer& _s)override {
                 _s << "<br>";
             }
             virtual element* make_copy()const override {
@@ -478,6 +609,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                br* ptr = new br();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -486,11 +622,12 @@ namespace html {
           public:
             hr() {
                 element::m_type = hr_t;
+                element::m_writer = writer_custom;
                 element::m_has_closing_tag = false;
                 element::m_is_container = false;
             }
             virtual ~hr() { ; }
-            virtual void write_html(std::ostream& _s)override {
+            virtual void write_html(writer& _s)override {
                 _s << "<hr>";
             }
             virtual element* make_copy()const override {
@@ -498,6 +635,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                hr* ptr = new hr();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
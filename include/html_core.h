@@ -9,17 +9,23 @@
 #define HTML_CORE__INCLUDED
 
 #include "html_forward.h"
+#include "html_writer.h"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace html {
 
         // HTML escape utility - escapes <, >, &, ", '
         [[nodiscard]] std::string html_escape(std::string_view input);
+        // Appends the escaped input to _out (no temporary string)
+        void html_escape(std::string_view input, std::string& _out);
 
-        // Raw HTML wrapper - content will not be escaped
-        struct raw_html {
-            std::string content;
-            explicit raw_html(std::string_view s) : content(s) {}
-        };
+        namespace detail {
+            // Portable reference path, used by tests and benchmarks
+            void html_escape_scalar(std::string_view input, std::string& _out);
+            // Name of the scan routine picked at startup ("avx2", "sse2" or "scalar")
+            const char* html_escape_impl();
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,19 +53,365 @@ namespace html {
         };
         //----------------------------------------------------------------
 
-        std::string nbsp(size_t repeat = 1);
+        class raw_html;
+        class css_usage;
+        class selector;
+        class flat_document;
+        // Non-breaking spaces as raw markup (converts to std::string)
+        raw_html nbsp(size_t repeat = 1);
 
 
         //----------------------------------------------------------------
+        // Arena allocation
+        //
+        // New element nodes, child vectors and attribute strings come from the
+        // thread's current memory resource. arena_scope makes a resource the
+        // current one until the scope ends; scopes form a per-thread stack, and
+        // one that ends out of order only removes its own entry.
+        //
+        // While an arena is alive, everything created on this thread is placed in
+        // its monotonic buffer. Nothing is freed per node; the whole tree goes
+        // away when the arena does, so the arena must outlive every element built
+        // under it.
+
+        class arena_scope {
+          private:
+            std::pmr::memory_resource* m_resource;
+          public:
+            explicit arena_scope(std::pmr::memory_resource* resource);
+            ~arena_scope();
+            arena_scope(const arena_scope&) = delete;
+            arena_scope& operator=(const arena_scope&) = delete;
+        };
 
-        class element {
+        class arena {
           private:
-            static std::vector<std::string> s_static_tag_names;
+            std::pmr::monotonic_buffer_resource m_resource;
+            arena_scope m_scope;
+          public:
+            explicit arena(size_t initial_size = 64 * 1024,
+                           std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+            arena(const arena&) = delete;
+            arena& operator=(const arena&) = delete;
+
+            std::pmr::memory_resource* resource() { return &m_resource; }
+        };
+
+
+        //----------------------------------------------------------------
+        // Borrowed strings
+        //
+        // text_ref and attr_ref pass text and attribute values as views into
+        // caller-owned memory (e.g. a memory-mapped file) instead of copies.
+        // The element, and every copy made of it, keeps pointing there, so the
+        // memory must stay alive and unchanged until the tree is destroyed.
+        // Temporary std::strings are refused at compile time; debug builds
+        // check when rendering that the characters have not changed. Using a
+        // borrowed text run as an element copies it into an html::text node.
+
+        class text_ref {
+          public:
+            std::string_view view;
+          public:
+            explicit text_ref(std::string_view _s) : view(_s) { ; }
+            explicit text_ref(const char* _s) : view(_s) { ; }
+            explicit text_ref(std::string&&) = delete;
+        };
+
+        class attr_ref {
+          public:
+            std::string_view name;
+            std::string_view value;
+          public:
+            attr_ref(std::string_view _name, std::string_view _value) : name(_name), value(_value) { ; }
+            attr_ref(std::string_view _name, const char* _value) : name(_name), value(_value) { ; }
+            attr_ref(std::string_view _name, std::string&&) = delete;
+        };
+
+        namespace detail {
+            // Checksum recorded for borrowed strings, compared by debug builds
+            std::uint16_t borrow_check(std::string_view _s);
+        }
+
+        //----------------------------------------------------------------
+        // Attribute storage
+        //
+        // Only attributes that are actually set take space. Entries are keyed by
+        // interned attr_id: the dedicated attributes are kept sorted at the front,
+        // generic ones follow in insertion order. Setting an attribute again
+        // replaces its value in place.
+
+        class attribute_list {
+          public:
+            struct entry {
+                attr_id id;
+                std::uint16_t check;        // checksum of a borrowed value (debug builds)
+                std::pmr::string text;      // owned value
+                std::string_view ref;       // borrowed value (see attr_ref), null if owned
+                std::string_view value()const { return ref.data() ? ref : std::string_view(text); }
+            };
+          private:
+            std::pmr::vector<entry> m_entries;
+
+            // The entry for _id, inserted empty if missing
+            entry& slot(attr_id);
+          public:
+            explicit attribute_list(std::pmr::memory_resource* _res = detail::resource());
+
+            void copy(const attribute_list&);
+            std::string_view get(attr_id)const;
+            bool has(attr_id)const;
+            std::pmr::string* find(attr_id);
+            std::pmr::string& ensure(attr_id);
+            void set(attr_id, std::string_view);
+            // Points the value at caller memory instead of copying it
+            void borrow(attr_id, std::string_view);
+            void remove(attr_id);
+            void clear() { m_entries.clear(); }
+            bool empty()const { return m_entries.empty(); }
+            size_t size()const { return m_entries.size(); }
+
+            std::pmr::vector<entry>::const_iterator begin()const { return m_entries.begin(); }
+            std::pmr::vector<entry>::const_iterator end()const { return m_entries.end(); }
+
+            // Name <-> id mapping, shared by all threads
+            static attr_id intern(std::string_view name);
+            static std::string_view name(attr_id);
+        };
+
+        //----------------------------------------------------------------
+        // Tree index
+        //
+        // Optional id, tag and class index for one tree (see element::index_tree).
+        // Every node of the tree points to it. Nodes register when they are
+        // added and re-register when their id or class changes; they unregister
+        // when destroyed or detached. Direct changes to m_elements / m_attributes
+        // bypass it.
+
+        namespace detail {
+            class tree_index {
+              public:
+                using node_set = std::unordered_set<element*>;
+              private:
+                struct entry {
+                    element* first;
+                    size_t count;
+                };
+                element* m_root;
+                std::unordered_map<std::string, entry> m_ids;
+                std::set<std::string> m_duplicates;
+                std::vector<node_set> m_tags;                           // by element_t
+                std::unordered_map<std::string, node_set> m_classes;
+                // Child -> position in its parent, filled on demand while the
+                // structure is unchanged (document order of query results)
+                std::unordered_map<const element*, std::uint32_t> m_positions;
+                bool m_positions_valid;
+
+                void insert_id(std::string_view _id, element* _e);
+                void erase_id(std::string_view _id, element* _e);
+              public:
+                explicit tree_index(element* _root) : m_root(_root), m_positions_valid(true) { ; }
+                element* root()const { return m_root; }
+
+                // Register / unregister the id, tag and classes of one node
+                void add(element* _e);
+                void remove(element* _e) { remove(_e, *_e); }
+                // ... with the values it was registered with held by _values
+                void remove(element* _e, const element& _values);
+                // Index _e and its subtree (and fix their parent pointers)
+                void attach(element& _e);
+                // Forget _e and its subtree
+                void detach(element& _e);
+                // True if the answer is unambiguous; _e is the element or nullptr.
+                // Duplicated ids return false: the caller walks the tree instead.
+                bool lookup(const std::string& _id, element*& _e)const;
+                // Remember _e for an id found by walking the tree
+                void settle(const std::string& _id, element* _e);
+                const std::set<std::string>& duplicates()const { return m_duplicates; }
+                size_t size()const { return m_ids.size(); }
+
+                // Nodes with a tag / class (nullptr if none)
+                const node_set* tagged(element_t _type)const;
+                const node_set* classed(std::string_view _class)const;
+
+                // Nodes were added, removed or reordered
+                void changed() { m_positions_valid = false; }
+                std::uint32_t position(const element* _child);
+            };
+        }
+
+        //----------------------------------------------------------------
+        // Child slots
+        //
+        // element::m_elements holds one slot per child. A slot owns a child
+        // element, like std::unique_ptr, or holds a text run itself: the
+        // characters (inline up to 8 bytes, otherwise one block from the
+        // parent's memory resource) and the newline flag, with no element
+        // object behind them. Strings added to an element become runs.
+        // Rendering, copying and destruction use the run directly; using it
+        // as an element (get(), ->, *) first turns it into an html::text /
+        // html::raw_html node in place; element::at / operator[] and
+        // traverse also give that node its parent.
+
+        namespace detail {
+            class child {
+              public:
+                enum kind_t : std::uint8_t { node_kind, text_kind, raw_kind };
+              private:
+                enum : std::uint8_t {
+                    inline_chars = 0x01,    // characters in m_small
+                    newline = 0x02,         // '\n' after the text
+                    borrowed = 0x04,        // m_chars is caller memory (see text_ref)
+                    checked = 0x08          // m_check is set (debug builds)
+                };
+                static constexpr std::size_t s_inline = sizeof(void*);
+                union {
+                    element* m_node;
+                    char* m_chars;          // after a header naming the resource, or borrowed
+                    char m_small[s_inline];
+                };
+                std::uint32_t m_size;
+                kind_t m_kind;
+                std::uint8_t m_flags;
+                std::uint16_t m_check;      // borrow_check of borrowed characters
+
+                void take(child& _c) noexcept {
+                    std::memcpy(m_small, _c.m_small, s_inline);
+                    m_size = _c.m_size;
+                    m_kind = _c.m_kind;
+                    m_flags = _c.m_flags;
+                    m_check = _c.m_check;
+                    _c.m_node = nullptr;
+                    _c.m_kind = node_kind;
+                    _c.m_flags = 0;
+                }
+                element* promote()const;
+              public:
+                child() noexcept : m_node(nullptr), m_size(0), m_kind(node_kind), m_flags(0), m_check(0) { ; }
+                explicit child(element* _e) noexcept : m_node(_e), m_size(0), m_kind(node_kind), m_flags(0), m_check(0) { ; }
+                child(std::unique_ptr<element>&& _e) noexcept : child(_e.release()) { ; }
+                child(child&& _c) noexcept { take(_c); }
+                child& operator=(child&& _c) noexcept {
+                    if(this != &_c) {
+                        reset();
+                        take(_c);
+                    }
+                    return *this;
+                }
+                child(const child&) = delete;
+                child& operator=(const child&) = delete;
+                ~child() { reset(); }
+
+                // A text run holding a copy of _s (at most 4 GiB)
+                static child run(std::string_view _s, kind_t _kind, bool _newline, std::pmr::memory_resource* _res);
+                // A text run pointing at _s, which the caller keeps alive
+                static child borrow(std::string_view _s) {
+                    child c;
+                    c.m_chars = const_cast<char*>(_s.data());
+                    c.m_size = static_cast<std::uint32_t>(_s.size());
+                    c.m_kind = text_kind;
+                    c.m_flags = borrowed;
+#ifndef NDEBUG
+                    c.m_flags |= checked;
+                    c.m_check = borrow_check(_s);
+#endif
+                    return c;
+                }
+                // A copy of this run with its characters in _res; borrowed
+                // runs are copied as the same view
+                child clone_run(std::pmr::memory_resource* _res)const {
+                    if(m_flags & borrowed) {
+                        child c;
+                        c.m_chars = m_chars;
+                        c.m_size = m_size;
+                        c.m_kind = m_kind;
+                        c.m_flags = m_flags;
+                        c.m_check = m_check;
+                        return c;
+                    }
+                    return run(text(), m_kind, is_newline(), _res);
+                }
+
+                bool is_run()const { return m_kind != node_kind; }
+                bool is_raw()const { return m_kind == raw_kind; }
+                bool is_newline()const { return (m_flags & newline) != 0; }
+                bool is_borrowed()const { return (m_flags & borrowed) != 0; }
+                // False if borrowed characters changed after they were added
+                bool intact()const { return !(m_flags & checked) || m_check == borrow_check(text()); }
+                std::string_view text()const {
+                    return std::string_view((m_flags & inline_chars) ? m_small : m_chars, m_size);
+                }
+                // The run as a text node would write it
+                void write(writer& _w)const {
+                    assert(intact() && "text_ref memory changed or freed before rendering");
+                    if(m_kind == raw_kind) {
+                        _w.write(text());
+                    } else {
+                        _w.write_escaped(text());
+                    }
+                    if(m_flags & newline) {
+                        _w.put('\n');
+                    }
+                }
+
+                element* get()const { return m_kind == node_kind ? m_node : promote(); }
+                element* operator->()const { return get(); }
+                element& operator*()const { return *get(); }
+                explicit operator bool()const { return m_kind != node_kind || m_node != nullptr; }
+                void reset();
+            };
+        }
+
+        //----------------------------------------------------------------
+        // Tree traversal
+        //
+        // element::traverse walks a subtree depth-first with an explicit stack,
+        // so nesting depth costs heap space instead of call stack. Text and raw
+        // text nodes go to text(); every other node to enter() and, if that
+        // returned descend, to leave() after its children. Only m_elements is
+        // walked (not the table sections or shared_subtree contents). Text
+        // runs reach text() as the html::text nodes they turn into.
+        // Rendering, find, copy, the id index and destruction use the same
+        // iterative scheme, reading text runs without creating nodes.
+
+        class visitor {
+          public:
+            enum action {
+                descend,        // visit the children, then leave()
+                skip,           // go on after this node, no leave()
+                stop            // end the traversal
+            };
+            virtual ~visitor() { ; }
+            virtual action enter(element& _e) { (void)_e; return descend; }
+            virtual void leave(element& _e) { (void)_e; }
+            virtual action text(element& _e) { (void)_e; return descend; }
+        };
+
+        namespace detail {
+            struct walk_frame {
+                element* e;
+                size_t next;        // next child to visit
+            };
+            // Explicit stack of the walks running on this thread
+            std::vector<walk_frame>& walk_stack();
+        }
+
+        //----------------------------------------------------------------
+
+        class element {
+            friend class detail::tree_index;
+            friend class selector;
+            friend class flat_document;
           protected:
             page* m_page_ptr;
             element* m_parent_ptr;
             element_t m_type;
-            std::string m_tag;
+            detail::tree_index* m_index;  // Set while part of an indexed tree
+            // How a parent renders this node: straight from the tag tables
+            // (no virtual call), as text / raw text, or through write_html.
+            // Classes that override write_html set writer_custom.
+            enum writer_kind : std::uint8_t { writer_tag, writer_text, writer_raw, writer_custom };
+            writer_kind m_writer;
           public:
             void parent(element* ptr) { m_parent_ptr = ptr; }
             element* parent() { return m_parent_ptr; }
@@ -72,22 +424,9 @@ namespace html {
             bool m_newline_after_tag;
             bool m_newline_after_element;
           public:
-            std::string m_class_attr;
-            std::string m_id_attr;
-            std::string m_data_id_attr;
-            std::string m_type_attr;
-            std::string m_role_attr;
-            std::string m_style_attr;
-            std::string m_src_attr;
-            std::string m_alt_attr;
-            std::string m_width_attr;
-            std::string m_height_attr;
-            std::string m_href_attr;
-            std::string m_rel_attr;
-
-            std::string m_other_attr;
-          public:
-            std::vector<std::unique_ptr<element>> m_elements;
+            attribute_list m_attributes;
+          public:
+            std::pmr::vector<detail::child> m_elements;
           private:
             element& operator=(const element&) = delete;
           public:
@@ -97,8 +436,32 @@ namespace html {
             element& operator=(element&&) noexcept;
             virtual ~element();
 
+            // Nodes are allocated from detail::resource() (see html::arena)
+            static void* operator new(std::size_t);
+            static void operator delete(void*, std::size_t);
+
             void copy(const element&);
-            const std::string& tag()const;
+            void move(element&&);
+            // Tag name, empty for types without a tag (text, fragments)
+            std::string_view tag()const;
+            // Element type for a tag name, undefined_t if there is none
+            static element_t tag_type(std::string_view name);
+          private:
+            // Take ownership bookkeeping for a new child (parent pointer, id index)
+            void adopt(element* _child);
+            void unindex_self();
+            void index_self();
+            element* find_walk(const std::string& id);
+            // Child _idx as a node; a text run becomes an adopted text node
+            element* node_at(size_t _idx);
+            // Depth-first over _root with an explicit stack; V has the
+            // visitor's enter / leave / text, and run() if it reads text runs
+            // without turning them into nodes. False if V stopped the walk.
+            template<typename E, typename V>
+            static bool walk(E& _root, V& _v);
+            // Destroys the subtrees below this node without recursing
+            void release_children();
+          public:
           public:
             element& get(const std::string& id);
             element& get_child(const std::string& id);
@@ -106,60 +469,80 @@ namespace html {
             element& at(size_t);
             element* find(const std::string& id);
             element* find_child(const std::string& id);
+            // Keep an id / tag / class index for this subtree, so find / get /
+            // exists / operator[] by id are O(1) and queries start from the index
+            void index_tree(bool enabled = true);
+            bool indexed()const { return m_index != nullptr; }
+            // Ids used by more than one element in this subtree
+            std::vector<std::string> duplicate_ids()const;
+            // This node and its subtree, depth-first (see html::visitor).
+            // Returns false if the visitor stopped the traversal.
+            bool traverse(visitor& v);
+            // Descendants matching a CSS selector, in document order (see
+            // html::selector for what is supported). Indexed trees start from
+            // the tag / class / id index instead of walking the subtree.
+            element* query_selector(std::string_view selector);
+            element* query_selector(const html::selector& selector);
+            std::vector<element*> query_selector_all(std::string_view selector);
+            std::vector<element*> query_selector_all(const html::selector& selector);
           public:
-            void add_attr(const std::string& name, const std::string& value);
-            //
-            const std::string& attr()const;
+            // Sets a named attribute, replacing any previous value
+            void add_attr(std::string_view name, std::string_view value);
+            std::string_view attr(std::string_view name)const;
+            bool has_attr(std::string_view name)const;
+            element& remove_attr(std::string_view name);
+            // All generic (non-accessor) attributes, rendered
+            std::string attr()const;
           public:
-            element& id(const std::string&);
-            const std::string& id()const;
+            element& id(std::string_view);
+            std::string_view id()const;
 
-            element& data_id(const std::string&);
-            const std::string& data_id()const;
+            element& data_id(std::string_view);
+            std::string_view data_id()const;
 
-            element& cl(const std::string&);
-            element& add_cl(const std::string&);
-            const std::string& cl()const;
+            element& cl(std::string_view);
+            element& add_cl(std::string_view);
+            std::string_view cl()const;
 
-            element& type(const std::string&);
-            const std::string& type()const;
+            element& type(std::string_view);
+            std::string_view type()const;
 
-            element& role(const std::string&);
-            const std::string& role()const;
+            element& role(std::string_view);
+            std::string_view role()const;
 
-            element& rel(const std::string&);
-            const std::string& rel()const;
+            element& rel(std::string_view);
+            std::string_view rel()const;
 
-            element& src(const std::string&);
-            const std::string& src()const;
+            element& src(std::string_view);
+            std::string_view src()const;
 
-            element& height(const std::string&);
-            const std::string& height()const;
+            element& height(std::string_view);
+            std::string_view height()const;
 
-            element& width(const std::string&);
-            const std::string& width()const;
+            element& width(std::string_view);
+            std::string_view width()const;
 
-            element& alt(const std::string&);
-            const std::string& alt()const;
+            element& alt(std::string_view);
+            std::string_view alt()const;
 
-            element& style(const std::string&);
-            const std::string& style()const;
+            element& style(std::string_view);
+            std::string_view style()const;
 
-            element& href(const std::string&);
-            const std::string& href()const;
+            element& href(std::string_view);
+            std::string_view href()const;
 
             // Data attributes
-            element& data(const std::string& name, const std::string& value);
+            element& data(std::string_view name, std::string_view value);
 
             // ARIA accessibility attributes
-            element& aria_label(const std::string&);
-            element& aria_labelledby(const std::string&);
-            element& aria_describedby(const std::string&);
+            element& aria_label(std::string_view);
+            element& aria_labelledby(std::string_view);
+            element& aria_describedby(std::string_view);
             element& aria_hidden(bool = true);
             element& aria_expanded(bool);
-            element& aria_controls(const std::string&);
-            element& aria_current(const std::string&);
-            element& aria_live(const std::string&);
+            element& aria_controls(std::string_view);
+            element& aria_current(std::string_view);
+            element& aria_live(std::string_view);
 
             // Global boolean attributes
             element& hidden(bool = true);
@@ -167,38 +550,43 @@ namespace html {
             element& draggable(bool = true);
             element& spellcheck(bool);
             element& tabindex(int);
-            element& title(const std::string&);
-            element& lang(const std::string&);
-            element& dir(const std::string&);
+            element& title(std::string_view);
+            element& lang(std::string_view);
+            element& dir(std::string_view);
 
           public:
             element& add_attr(const html::attr&);
 
           public:
             element& add(const html::attr&);
-            virtual element& add(const std::string&);
+            // Borrowed, not copied (see text_ref / attr_ref)
+            element& add(text_ref);
+            element& add(const attr_ref&);
+            virtual element& add(std::string_view);
             virtual element& add(const element&);
             virtual element& add(element&& e);
             element& add(element_group&);
-            element& operator<<(const std::string&);
+            element& operator<<(std::string_view);
             element& operator<<(const element&);
             element& operator<<(element_group&);
             element& operator<<(html::attr&);
+            element& operator<<(text_ref);
+            element& operator<<(const attr_ref&);
 
             // Add comprehensive rvalue overloads
             element& operator<<(html::attr&& rhs) { return *this << rhs; }
-            element& operator<<(element&& rhs) { return *this << static_cast<const element&>(rhs); }
+            element& operator<<(element&& rhs) { add(std::move(rhs)); return *this; }
             element& operator<<(element_group&& rhs) { return *this << rhs; }
 
 
-            element& operator<<=(const std::string&);
+            element& operator<<=(std::string_view);
             element& operator<<=(const element&);
             element& operator<<=(element_group&);
           public:
             element& operator[](size_t);
             element& operator[](const std::string&);
           public:
-            virtual element& content(const std::string&);
+            virtual element& content(std::string_view);
             virtual element& content(element&);
 
             void clear();
@@ -210,7 +598,7 @@ namespace html {
             template<typename T>
             void add_child_item(T&& item) {
                 if constexpr (std::is_convertible_v<std::decay_t<T>, std::string_view>) {
-                    add(text(std::string(std::forward<T>(item))));
+                    add(std::string_view(item));
                 } else {
                     add(std::forward<T>(item));
                 }
@@ -222,21 +610,86 @@ namespace html {
             }
 
           protected:
-            void write_elements(std::ostream&);
-            void write_attributes(std::ostream&)const;
+            // Appends _s as a text run (written verbatim if _raw, followed by
+            // '\n' if _newline), without an html::text node behind it
+            void add_run(std::string_view _s, bool _raw = false, bool _newline = false);
+            void write_elements(writer&);
+            void write_attributes(writer&)const;
           public:
             std::string html();
             std::string html_string();
             std::string html_content_string();
 
           protected:
-            void write_open_tag(std::ostream&)const;
-            void write_close_tag(std::ostream&)const;
+            void write_open_tag(writer&)const;
+            void write_close_tag(writer&)const;
+            // Tag, attributes, children and close tag (the default write_html)
+            void write_tag(writer&);
+            struct tree_writer;
           public:
-            virtual void write_html(std::ostream&);
+            virtual void write_html(writer&);
             virtual element* make_copy()const;
+            // Moves this element into a new heap node of the same dynamic type,
+            // taking over attributes and children without copying them
+            virtual element* make_move();
         };
 
+        template<typename E, typename V>
+        bool element::walk(E& _root, V& _v) {
+            // One stack per thread. A walk can start another one (a custom
+            // writer rendering its own children); each only uses the frames
+            // above the size it found.
+            struct unwind {
+                std::vector<detail::walk_frame>& stack;
+                size_t base;
+                ~unwind() { stack.resize(base); }
+            } u{detail::walk_stack(), detail::walk_stack().size()};
+            std::vector<detail::walk_frame>& stack = u.stack;
+            // Visits one node; true if the walk ends there
+            auto open = [&](E* _e) {
+                if(_e->m_writer == writer_text || _e->m_writer == writer_raw) {
+                    return _v.text(*_e) == visitor::stop;
+                }
+                visitor::action a = _v.enter(*_e);
+                if(a == visitor::descend) {
+                    if(_e->m_elements.empty()) {
+                        _v.leave(*_e);
+                    } else {
+                        stack.push_back(detail::walk_frame{const_cast<element*>(_e), 0});
+                    }
+                }
+                return a == visitor::stop;
+            };
+            if(open(&_root)) {
+                return false;
+            }
+            while(stack.size() > u.base) {
+                detail::walk_frame& f = stack.back();
+                if(f.next < f.e->m_elements.size()) {
+                    element* parent = f.e;
+                    size_t i = f.next++;
+                    const detail::child& c = parent->m_elements[i];
+                    if constexpr (requires { _v.run(c); }) {
+                        if(c.is_run()) {
+                            if(_v.run(c) == visitor::stop) {
+                                return false;
+                            }
+                            continue;
+                        }
+                    }
+                    if(open(c.is_run() ? parent->node_at(i) : c.get())) {
+                        return false;
+                    }
+                } else {
+                    E* e = f.e;
+                    stack.pop_back();
+                    _v.leave(*e);
+                }
+            }
+            return true;
+        }
+
+        // Streams through a buffered ostream_writer
         std::ostream& operator<<(std::ostream&, html::element&);
 
         //=============================================================================
@@ -245,18 +698,18 @@ namespace html {
         // Example: input().type("email").name("foo").id("bar").required()
         //=============================================================================
         #define HTML_FLUENT_METHODS(DerivedClass) \
-            DerivedClass& id(const std::string& s) { element::id(s); return *this; } \
-            DerivedClass& cl(const std::string& s) { element::cl(s); return *this; } \
-            DerivedClass& add_cl(const std::string& s) { element::add_cl(s); return *this; } \
-            DerivedClass& style(const std::string& s) { element::style(s); return *this; } \
-            DerivedClass& type(const std::string& s) { element::type(s); return *this; } \
-            DerivedClass& data_id(const std::string& s) { element::data_id(s); return *this; } \
-            DerivedClass& role(const std::string& s) { element::role(s); return *this; } \
+            DerivedClass& id(std::string_view s) { element::id(s); return *this; } \
+            DerivedClass& cl(std::string_view s) { element::cl(s); return *this; } \
+            DerivedClass& add_cl(std::string_view s) { element::add_cl(s); return *this; } \
+            DerivedClass& style(std::string_view s) { element::style(s); return *this; } \
+            DerivedClass& type(std::string_view s) { element::type(s); return *this; } \
+            DerivedClass& data_id(std::string_view s) { element::data_id(s); return *this; } \
+            DerivedClass& role(std::string_view s) { element::role(s); return *this; } \
             DerivedClass& hidden(bool b = true) { element::hidden(b); return *this; } \
             DerivedClass& tabindex(int i) { element::tabindex(i); return *this; } \
-            DerivedClass& title(const std::string& s) { element::title(s); return *this; } \
-            DerivedClass& aria_label(const std::string& s) { element::aria_label(s); return *this; } \
-            DerivedClass& data(const std::string& n, const std::string& v) { element::data(n, v); return *this; }
+            DerivedClass& title(std::string_view s) { element::title(s); return *this; } \
+            DerivedClass& aria_label(std::string_view s) { element::aria_label(s); return *this; } \
+            DerivedClass& data(std::string_view n, std::string_view v) { element::data(n, v); return *this; }
 
         /////////////////////////////////////////////////////////////////////////////////////
         // Page head
@@ -274,6 +727,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                head* ptr = new head();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 
@@ -289,6 +747,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                body* ptr = new body();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -309,6 +772,11 @@ namespace html {
             std::set<std::string> m_init_script_keys;  // For deduplication
             std::vector<std::string> m_styles;         // Embedded CSS
             dependency_mode m_dependency_mode;
+            std::string m_asset_dir;                   // dependency_mode::external
+            std::string m_asset_url;
+            bool m_css_tree_shaking;                   // dependency_mode::embedded
+            std::string m_css_keep;                    // Classes kept regardless
+            std::unique_ptr<std::pmr::monotonic_buffer_resource> m_arena;  // Optional tree arena
 
           public:
             page();
@@ -325,18 +793,34 @@ namespace html {
             // Dependency mode
             void set_dependency_mode(dependency_mode mode);
             dependency_mode get_dependency_mode() const;
+            // Where dependency_mode::external writes the resource files (default
+            // "assets") and the URL prefix pages use for them (default: the directory)
+            void set_asset_directory(const std::string& dir, const std::string& url_prefix = "");
+            // Embedded mode: inline only the Bootstrap rules that can match the
+            // classes, ids and tags on this page (see html::css_index)
+            void set_css_tree_shaking(bool enabled = true);
+            // Classes only added at runtime (space separated) that must survive shaking
+            void keep_css_classes(const std::string& names);
 
             // Check if dependency is registered
             bool has_dependency(dependency dep) const;
 
+            // Allocate everything built on this thread while the returned scope
+            // is alive from a page-owned arena, released with the page. The
+            // scope must end before the page is destroyed.
+            [[nodiscard]] arena_scope use_arena(size_t initial_size = 64 * 1024);
+
           public:
             virtual element* make_copy()const override;
-            virtual void write_html(std::ostream&) override;
+            virtual element* make_move() override;
+            virtual void write_html(writer&) override;
 
           private:
-            void write_dependency_css(std::ostream& _s);
-            void write_dependency_js(std::ostream& _s);
-            void write_init_scripts(std::ostream& _s);
+            void write_dependency_css(writer& _s);
+            void write_dependency_js(writer& _s);
+            void write_init_scripts(writer& _s);
+            void write_asset_link(writer& _s, std::string_view stem, std::string_view ext, std::string_view content);
+            css_usage collect_css_usage();
         };
         std::ostream& operator<<(std::ostream& _s, page& _p);
 
@@ -345,28 +829,25 @@ namespace html {
 
         class text : public element {
           public:
-            std::string m_text;
+            std::pmr::string m_text;
           public:
-            text() {
+            text() : m_text(detail::resource()) {
                 element::m_type = text_t;
+                element::m_writer = writer_text;
                 element::m_is_container = false;
             }
-            text(const std::string& _s) {
+            // Built straight in the node's storage: one allocation, none for short text
+            text(std::string_view _s) : m_text(_s, detail::resource()) {
                 element::m_type = text_t;
+                element::m_writer = writer_text;
                 element::m_is_container = false;
-                m_text = _s;
-            }
-            text(const char* _s) {
-                element::m_type = text_t;
-                element::m_is_container = false;
-                m_text = _s;
             }
             virtual ~text() { ; }
-            virtual void write_html(std::ostream& _s) override {
+            virtual void write_html(writer& _s) override {
                 assert(element::m_is_container == false);
-                _s << m_text;
+                _s.write_escaped(m_text);
                 if(m_newline_after_element)
-                { _s << std::endl; }
+                { _s << '\n'; }
             }
             virtual element* make_copy()const override {
                 text* ptr = new text();
@@ -374,6 +855,47 @@ namespace html {
                 ptr->m_text = m_text;
                 return ptr;
             }
+            virtual element* make_move() override {
+                text* ptr = new text();
+                ptr->move(std::move(*this));
+                ptr->m_text = std::move(m_text);
+                return ptr;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Raw HTML - written verbatim, the explicit opt-out from escaping.
+        // Only for trusted, already valid markup.
+
+        class raw_html : public text {
+          public:
+            raw_html() {
+                element::m_writer = writer_raw;
+            }
+            explicit raw_html(std::string_view _s) {
+                element::m_writer = writer_raw;
+                m_text = _s;
+            }
+            virtual ~raw_html() { ; }
+            virtual void write_html(writer& _s) override {
+                _s << std::string_view(m_text);
+                if(m_newline_after_element)
+                { _s << '\n'; }
+            }
+            std::string_view content()const { return m_text; }
+            operator std::string()const { return std::string(m_text); }
+            virtual element* make_copy()const override {
+                raw_html* ptr = new raw_html();
+                ptr->copy(*this);
+                ptr->m_text = m_text;
+                return ptr;
+            }
+            virtual element* make_move() override {
+                raw_html* ptr = new raw_html();
+                ptr->move(std::move(*this));
+                ptr->m_text = std::move(m_text);
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -384,10 +906,10 @@ namespace html {
                 element::m_type = title_t;
                 m_newline_after_element = true;
             }
-            title(const std::string& _s) {
+            title(std::string_view _s) {
                 element::m_type = title_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             virtual ~title() { ; }
             virtual element* make_copy()const override {
@@ -395,6 +917,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                title* ptr = new title();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -406,13 +933,83 @@ namespace html {
             element_group(const element_group& _g);
             virtual ~element_group() { ; }
             virtual element* make_copy() const override;
-            virtual void write_html(std::ostream& _s) override {
+            virtual element* make_move() override;
+            virtual void write_html(writer& _s) override {
                 for(auto& e : m_elements) {
-                    e->write_html(_s);
+                    if(e.is_run()) {
+                        e.write(_s);
+                    } else {
+                        e->write_html(_s);
+                    }
+                }
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Pre-rendered subtree. The markup is produced once into an immutable,
+        // reference-counted buffer and written back with a single block copy.
+        // Copies share the buffer, so one fragment can serve any number of
+        // trees and threads.
+
+        class static_fragment : public element {
+          private:
+            std::shared_ptr<const std::string> m_bytes;
+          public:
+            static_fragment();
+            explicit static_fragment(element& _e);
+            explicit static_fragment(element&& _e) : static_fragment(_e) { ; }
+            virtual ~static_fragment() { ; }
+            virtual element* make_copy() const override;
+            virtual element* make_move() override;
+            virtual void write_html(writer& _s) override {
+                if(m_bytes) {
+                    _s.write(*m_bytes);
+                }
+            }
+            std::string_view markup()const { return m_bytes ? std::string_view(*m_bytes) : std::string_view(); }
+            const std::shared_ptr<const std::string>& buffer()const { return m_bytes; }
+        };
+
+        // Render _e once and return it as a static_fragment
+        inline static_fragment freeze(element& _e) { return static_fragment(_e); }
+        inline static_fragment freeze(element&& _e) { return static_fragment(_e); }
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Shared subtree. Holds an element tree by reference count: copying it
+        // (add, operator+, content, copy constructors) shares the nodes instead
+        // of cloning them, so a prebuilt component placed in many spots costs
+        // one pointer each. The tree is read only through the handle; edit()
+        // clones it first if other copies share it. find / get and selector
+        // queries do not descend into it. Unlike static_fragment it renders
+        // with the current page and escape context, on one thread at a time.
+
+        class shared_subtree : public element {
+          private:
+            std::shared_ptr<element> m_node;
+          public:
+            shared_subtree();
+            // Copies _e once
+            explicit shared_subtree(const element& _e);
+            explicit shared_subtree(element&& _e);
+            virtual ~shared_subtree() { ; }
+            virtual element* make_copy() const override;
+            virtual element* make_move() override;
+            virtual void write_html(writer& _s) override {
+                if(m_node) {
+                    m_node->page(page());
+                    m_node->write_html(_s);
                 }
             }
+            const element* get()const { return m_node.get(); }
+            // The tree for changing it, unshared first
+            element& edit();
+            long use_count()const { return m_node.use_count(); }
         };
 
+        // Wrap _e as a shared_subtree
+        inline shared_subtree share(const element& _e) { return shared_subtree(_e); }
+        inline shared_subtree share(element&& _e) { return shared_subtree(std::move(_e)); }
+
         // Global operator+ overloads for all combinations
         element_group operator+(element&, element&);
         element_group operator+(element_group&, element_group&);
@@ -0,0 +1,99 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_CSS__INCLUDED
+#define HTML_CSS__INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace html {
+
+        class element;
+        class writer;
+
+        //=============================================================================
+        // CSS TREE SHAKING
+        //
+        // A css_index splits a stylesheet into rules once and indexes every
+        // selector by the classes, ids and tag names it requires. Given the
+        // names a document actually uses (css_usage) it writes only the rules
+        // that can match, the @media/@supports wrappers around them, the
+        // @keyframes they reference and everything it cannot judge (:root and
+        // attribute-only selectors, @font-face, @charset, license comments).
+        //=============================================================================
+
+        // Class names, ids and tag names used by a document
+        class css_usage {
+          private:
+            std::unordered_set<std::string> m_keys;     // ".class", "#id", "tag"
+          public:
+            // Whitespace separated lists are split
+            void add_class(std::string_view _names);
+            void add_id(std::string_view _id);
+            void add_tag(std::string_view _tag);
+
+            // An element and its subtree, including shared subtrees. Raw markup
+            // (raw_html, static_fragment) is scanned for tags and class/id attributes.
+            void collect(const element& _e);
+            void collect_markup(std::string_view _html);
+
+            bool uses(std::string_view _key)const { return m_keys.count(std::string(_key)) > 0; }
+            const std::unordered_set<std::string>& keys()const { return m_keys; }
+        };
+
+        class css_index {
+          private:
+            enum item_kind : std::uint8_t {
+                rule_item,          // selector list + declarations
+                group_open,         // "@media ...{"
+                group_close,        // "}"
+                keyframes_item,     // "@keyframes name{...}"
+                always_item         // kept as is
+            };
+            struct item {
+                item_kind kind;
+                bool unconditional;     // rule with a selector that needs no name
+                std::uint32_t begin;
+                std::uint32_t end;
+                std::uint32_t body;     // rule: offset of '{'; keyframes: start of the name
+                std::uint32_t partner;  // group_open: index of its group_close; keyframes: end of the name
+            };
+            struct selector {
+                std::uint32_t item;
+                std::uint32_t need;     // distinct names required
+            };
+
+            std::string_view m_css;
+            std::vector<item> m_items;
+            std::vector<selector> m_selectors;
+            std::unordered_map<std::string, std::vector<std::uint32_t>> m_postings;  // name -> selectors
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> m_keyframe_refs;   // rule -> keyframes
+
+            size_t parse_list(size_t _p, bool _nested);
+            void add_rule(size_t _begin, size_t _brace, size_t _end);
+            void link_keyframes();
+          public:
+            // _css must stay valid for the lifetime of the index
+            explicit css_index(std::string_view _css);
+
+            size_t rule_count()const;
+            // Rules (with their wrappers) that can match a document using _u
+            void write(writer& _w, const css_usage& _u)const;
+            std::string shake(const css_usage& _u)const;
+
+            // The embedded bootstrap.min.css, parsed on first use
+            static const css_index& bootstrap();
+        };
+
+}//html
+
+#endif
@@ -0,0 +1,157 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_FLAT__INCLUDED
+#define HTML_FLAT__INCLUDED
+
+#include "html_core.h"
+#include <cstdint>
+
+namespace html {
+
+        //=============================================================================
+        // FLAT DOCUMENT
+        //
+        // An index-based tree for large, mostly generated documents. Nodes live
+        // in one contiguous array and refer to each other by index (parent,
+        // first child, next sibling); attributes and text live in two shared
+        // buffers. Building a node is a push_back, not a heap allocation, and
+        // a document built front to back is serialized with a single linear
+        // pass over the array. The output is byte-identical to the element
+        // tree it mirrors:
+        //
+        //     html::flat_document doc;
+        //     auto t = doc.root().add(html::table_t).cl("table");
+        //     for(auto& r : rows) {
+        //         auto tr = t.add(html::tr_t);
+        //         tr.add(html::td_t).text(r.name);
+        //     }
+        //     std::string s = doc.html();
+        //
+        // Convert with flat_document(const element&) and to_element().
+        //=============================================================================
+
+        class flat_document;
+
+        // Builder handle for one node. Stays valid while the document lives.
+        class flat_node {
+          private:
+            flat_document* m_doc;
+            std::uint32_t m_index;
+          public:
+            flat_node(flat_document* _doc, std::uint32_t _index) : m_doc(_doc), m_index(_index) { ; }
+
+            std::uint32_t index()const { return m_index; }
+            flat_document& document()const { return *m_doc; }
+            flat_node parent()const;
+
+            // Appends a child element with the flags of its element class (see defaults)
+            flat_node add(element_t _type);
+            flat_node add(element_t _type, std::string_view _text);
+            // Appends escaped text / verbatim markup
+            flat_node& text(std::string_view _s);
+            flat_node& raw(std::string_view _s);
+            flat_node& operator<<(std::string_view _s) { return text(_s); }
+
+            flat_node& attr(std::string_view _name, std::string_view _value);
+            flat_node& attr(attr_id _id, std::string_view _value);
+            flat_node& id(std::string_view _s) { return attr(id_attr, _s); }
+            flat_node& data_id(std::string_view _s) { return attr(data_id_attr, _s); }
+            flat_node& cl(std::string_view _s) { return attr(class_attr, _s); }
+            flat_node& type(std::string_view _s) { return attr(type_attr, _s); }
+            flat_node& role(std::string_view _s) { return attr(role_attr, _s); }
+            flat_node& style(std::string_view _s) { return attr(style_attr, _s); }
+            flat_node& src(std::string_view _s) { return attr(src_attr, _s); }
+            flat_node& alt(std::string_view _s) { return attr(alt_attr, _s); }
+            flat_node& href(std::string_view _s) { return attr(href_attr, _s); }
+            flat_node& rel(std::string_view _s) { return attr(rel_attr, _s); }
+            flat_node& data(std::string_view _name, std::string_view _value);
+        };
+
+        class flat_document {
+          public:
+            static constexpr std::uint32_t npos = 0xffffffffu;
+
+            enum node_kind : std::uint8_t {
+                element_node,
+                text_node,          // escaped in the current context
+                raw_node            // written verbatim
+            };
+            enum node_flags : std::uint8_t {
+                closing_tag = 1,
+                newline_after_tag = 2,
+                newline_after_element = 4
+            };
+            struct node {
+                element_t type;
+                node_kind kind;
+                std::uint8_t flags;
+                std::uint32_t parent;
+                std::uint32_t first_child;
+                std::uint32_t last_child;
+                std::uint32_t next_sibling;
+                std::uint32_t attr_begin;       // span in attributes()
+                std::uint32_t attr_count;
+                std::uint32_t text_begin;       // text / raw nodes: span in the character buffer
+                std::uint32_t text_size;
+            };
+            struct attribute {
+                attr_id id;
+                std::uint32_t value_begin;
+                std::uint32_t value_size;
+            };
+          private:
+            std::vector<node> m_nodes;          // [0] is the root, which has no tag
+            std::vector<attribute> m_attrs;
+            std::string m_chars;
+            bool m_preorder;                    // m_nodes is in document order
+
+            std::uint32_t append(std::uint32_t _parent, node_kind _kind, element_t _type, std::uint8_t _flags);
+            std::uint32_t store(std::string_view _s);
+            void append_element(std::uint32_t _parent, const element& _e, escape_context _ctx);
+            void append_child(std::uint32_t _parent, const detail::child& _c, escape_context _ctx);
+            void append_attributes(std::uint32_t _n, const element& _e);
+            void write_open(writer& _w, const node& _n)const;
+            void write_close(writer& _w, const node& _n)const;
+            void write_leaf(writer& _w, const node& _n)const;
+            void build(element& _parent, std::uint32_t _n)const;
+
+            friend class flat_node;
+          public:
+            flat_document();
+            // Flattens _e and its subtree
+            explicit flat_document(const element& _e);
+
+            flat_node root() { return flat_node(this, 0); }
+            flat_node operator[](std::uint32_t _index) { return flat_node(this, _index); }
+            // Appends _e and its subtree under _parent
+            void append(flat_node _parent, const element& _e);
+
+            size_t size()const { return m_nodes.size(); }
+            const node& at(std::uint32_t _index)const { return m_nodes.at(_index); }
+            const std::vector<node>& nodes()const { return m_nodes; }
+            const std::vector<attribute>& attributes()const { return m_attrs; }
+            std::string_view text(const node& _n)const { return std::string_view(m_chars).substr(_n.text_begin, _n.text_size); }
+            std::string_view value(const attribute& _a)const { return std::string_view(m_chars).substr(_a.value_begin, _a.value_size); }
+            std::string_view attr(std::uint32_t _index, attr_id _id)const;
+            void clear();
+            void reserve(size_t _nodes, size_t _chars);
+
+            void write_html(writer& _w)const;
+            std::string html()const;
+
+            // Rebuilds an element tree producing the same markup
+            element_group to_element()const;
+
+            // Flags the element class for _type sets when constructed with
+            // content (closing tag, newlines)
+            static std::uint8_t defaults(element_t _type);
+        };
+
+}//html
+
+#endif
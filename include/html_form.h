@@ -32,10 +32,10 @@ namespace html {
                 add_children(std::forward<Args>(args)...);
             }
             HTML_FLUENT_METHODS(form)
-            form& action(const std::string& _a) { add_attr("action", _a); return *this; }
-            form& method(const std::string& _m) { add_attr("method", _m); return *this; }
-            form& enctype(const std::string& _e) { add_attr("enctype", _e); return *this; }
-            form& target(const std::string& _t) { add_attr("target", _t); return *this; }
+            form& action(std::string_view _a) { add_attr("action", _a); return *this; }
+            form& method(std::string_view _m) { add_attr("method", _m); return *this; }
+            form& enctype(std::string_view _e) { add_attr("enctype", _e); return *this; }
+            form& target(std::string_view _t) { add_attr("target", _t); return *this; }
             form& novalidate() { add_attr("novalidate", "novalidate"); return *this; }
             virtual ~form() { ; }
             virtual element* make_copy()const override {
@@ -43,6 +43,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                form* ptr = new form();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class input : public element {
@@ -53,49 +58,68 @@ namespace html {
                 element::m_is_container = false;
             }
             HTML_FLUENT_METHODS(input)
-            input& name(const std::string& _n) { add_attr("name", _n); return *this; }
-            input& value(const std::string& _v) { add_attr("value", _v); return *this; }
-            input& placeholder(const std::string& _p) { add_attr("placeholder", _p); return *this; }
+            input& name(std::string_view _n) { add_attr("name", _n); return *this; }
+            input& value(std::string_view _v) { add_attr("value", _v); return *this; }
+            input& placeholder(std::string_view _p) { add_attr("placeholder", _p); return *this; }
             input& disabled() { add_attr("disabled", "disabled"); return *this; }
             input& readonly() { add_attr("readonly", "readonly"); return *this; }
             input& required() { add_attr("required", "required"); return *this; }
             input& checked() { add_attr("checked", "checked"); return *this; }
-            input& min(const std::string& _m) { add_attr("min", _m); return *this; }
-            input& max(const std::string& _m) { add_attr("max", _m); return *this; }
-            input& step(const std::string& _s) { add_attr("step", _s); return *this; }
-            input& pattern(const std::string& _p) { add_attr("pattern", _p); return *this; }
-            input& autocomplete(const std::string& _a) { add_attr("autocomplete", _a); return *this; }
+            input& min(std::string_view _m) { add_attr("min", _m); return *this; }
+            input& max(std::string_view _m) { add_attr("max", _m); return *this; }
+            input& step(std::string_view _s) { add_attr("step", _s); return *this; }
+            // Numeric values (templates, so min(0) is not taken for a null string)
+            template<typename T, typename = std::enable_if_t<is_number_v<T>>>
+            input& value(T _v) { add_attr("value", number(_v)); return *this; }
+            template<typename T, typename = std::enable_if_t<is_number_v<T>>>
+            input& min(T _m) { add_attr("min", number(_m)); return *this; }
+            template<typename T, typename = std::enable_if_t<is_number_v<T>>>
+            input& max(T _m) { add_attr("max", number(_m)); return *this; }
+            template<typename T, typename = std::enable_if_t<is_number_v<T>>>
+            input& step(T _s) { add_attr("step", number(_s)); return *this; }
+            input& pattern(std::string_view _p) { add_attr("pattern", _p); return *this; }
+            input& autocomplete(std::string_view _a) { add_attr("autocomplete", _a); return *this; }
             input& autofocus() { add_attr("autofocus", "autofocus"); return *this; }
-            input& list(const std::string& _l) { add_attr("list", _l); return *this; }
-            input& minlength(int _m) { add_attr("minlength", std::to_string(_m)); return *this; }
-            input& maxlength(int _m) { add_attr("maxlength", std::to_string(_m)); return *this; }
+            input& list(std::string_view _l) { add_attr("list", _l); return *this; }
+            input& minlength(int _m) { add_attr("minlength", number(_m)); return *this; }
+            input& maxlength(int _m) { add_attr("maxlength", number(_m)); return *this; }
             virtual ~input() { ; }
             virtual element* make_copy()const override {
                 input* ptr = new input();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                input* ptr = new input();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class button : public element {
           public:
             button() { element::m_type = button_t; }
-            button(const std::string& _text) {
+            button(std::string_view _text) {
                 element::m_type = button_t;
-                add(text(_text));
+                add(_text);
             }
             HTML_FLUENT_METHODS(button)
-            button& name(const std::string& _n) { add_attr("name", _n); return *this; }
-            button& value(const std::string& _v) { add_attr("value", _v); return *this; }
+            button& name(std::string_view _n) { add_attr("name", _n); return *this; }
+            button& value(std::string_view _v) { add_attr("value", _v); return *this; }
             button& disabled() { add_attr("disabled", "disabled"); return *this; }
-            button& formaction(const std::string& _a) { add_attr("formaction", _a); return *this; }
-            button& formmethod(const std::string& _m) { add_attr("formmethod", _m); return *this; }
+            button& formaction(std::string_view _a) { add_attr("formaction", _a); return *this; }
+            button& formmethod(std::string_view _m) { add_attr("formmethod", _m); return *this; }
             virtual ~button() { ; }
             virtual element* make_copy()const override {
                 button* ptr = new button();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                button* ptr = new button();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class select : public element {
@@ -112,33 +136,38 @@ namespace html {
                 add_children(std::forward<Args>(args)...);
             }
             HTML_FLUENT_METHODS(select)
-            select& name(const std::string& _n) { add_attr("name", _n); return *this; }
+            select& name(std::string_view _n) { add_attr("name", _n); return *this; }
             select& multiple() { add_attr("multiple", "multiple"); return *this; }
             select& disabled() { add_attr("disabled", "disabled"); return *this; }
             select& required() { add_attr("required", "required"); return *this; }
-            select& size(int _s) { add_attr("size", std::to_string(_s)); return *this; }
+            select& size(int _s) { add_attr("size", number(_s)); return *this; }
             virtual ~select() { ; }
             virtual element* make_copy()const override {
                 html::select* ptr = new html::select();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                html::select* ptr = new html::select();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class option : public element {
           public:
             option() { element::m_type = option_t; }
-            option(const std::string& _text) {
+            option(std::string_view _text) {
                 element::m_type = option_t;
-                add(text(_text));
+                add(_text);
             }
-            option(const std::string& _value, const std::string& _text) {
+            option(std::string_view _value, std::string_view _text) {
                 element::m_type = option_t;
                 add_attr("value", _value);
-                add(text(_text));
+                add(_text);
             }
             HTML_FLUENT_METHODS(option)
-            option& value(const std::string& _v) { add_attr("value", _v); return *this; }
+            option& value(std::string_view _v) { add_attr("value", _v); return *this; }
             option& selected() { add_attr("selected", "selected"); return *this; }
             option& disabled() { add_attr("disabled", "disabled"); return *this; }
             virtual ~option() { ; }
@@ -147,23 +176,33 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                option* ptr = new option();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class label : public element {
           public:
             label() { element::m_type = label_t; }
-            label(const std::string& _text) {
+            label(std::string_view _text) {
                 element::m_type = label_t;
-                add(text(_text));
+                add(_text);
             }
             HTML_FLUENT_METHODS(label)
-            label& for_id(const std::string& _id) { add_attr("for", _id); return *this; }
+            label& for_id(std::string_view _id) { add_attr("for", _id); return *this; }
             virtual ~label() { ; }
             virtual element* make_copy()const override {
                 label* ptr = new label();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                label* ptr = new label();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class fieldset : public element {
@@ -183,22 +222,27 @@ namespace html {
             }
             HTML_FLUENT_METHODS(fieldset)
             fieldset& disabled() { add_attr("disabled", "disabled"); return *this; }
-            fieldset& name(const std::string& _n) { add_attr("name", _n); return *this; }
-            fieldset& form_attr(const std::string& _f) { add_attr("form", _f); return *this; }
+            fieldset& name(std::string_view _n) { add_attr("name", _n); return *this; }
+            fieldset& form_attr(std::string_view _f) { add_attr("form", _f); return *this; }
             virtual ~fieldset() { ; }
             virtual element* make_copy()const override {
                 fieldset* ptr = new fieldset();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                fieldset* ptr = new fieldset();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class legend : public element {
           public:
             legend() { element::m_type = legend_t; }
-            legend(const std::string& _text) {
+            legend(std::string_view _text) {
                 element::m_type = legend_t;
-                add(text(_text));
+                add(_text);
             }
             HTML_FLUENT_METHODS(legend)
             virtual ~legend() { ; }
@@ -207,6 +251,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                legend* ptr = new legend();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -233,21 +282,31 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                datalist* ptr = new datalist();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class output : public element {
           public:
             output() { element::m_type = output_t; }
             HTML_FLUENT_METHODS(output)
-            output& for_id(const std::string& ids) { add_attr("for", ids); return *this; }
-            output& name(const std::string& n) { add_attr("name", n); return *this; }
-            output& form_attr(const std::string& f) { add_attr("form", f); return *this; }
+            output& for_id(std::string_view ids) { add_attr("for", ids); return *this; }
+            output& name(std::string_view n) { add_attr("name", n); return *this; }
+            output& form_attr(std::string_view f) { add_attr("form", f); return *this; }
             virtual ~output() { ; }
             virtual element* make_copy()const override {
                 output* ptr = new output();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                output* ptr = new output();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class optgroup : public element {
@@ -264,8 +323,8 @@ namespace html {
                 add_children(std::forward<Args>(args)...);
             }
             HTML_FLUENT_METHODS(optgroup)
-            optgroup& label(const std::string& l) { add_attr("label", l); return *this; }
-            optgroup& label_attr(const std::string& l) { add_attr("label", l); return *this; }
+            optgroup& label(std::string_view l) { add_attr("label", l); return *this; }
+            optgroup& label_attr(std::string_view l) { add_attr("label", l); return *this; }
             optgroup& disabled() { add_attr("disabled", "disabled"); return *this; }
             virtual ~optgroup() { ; }
             virtual element* make_copy()const override {
@@ -273,38 +332,53 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                optgroup* ptr = new optgroup();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class progress : public element {
           public:
             progress() { element::m_type = progress_t; }
             HTML_FLUENT_METHODS(progress)
-            progress& value(double v) { add_attr("value", std::to_string(v)); return *this; }
-            progress& max(double m) { add_attr("max", std::to_string(m)); return *this; }
+            progress& value(number v) { add_attr("value", v); return *this; }
+            progress& max(number m) { add_attr("max", m); return *this; }
             virtual ~progress() { ; }
             virtual element* make_copy()const override {
                 progress* ptr = new progress();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                progress* ptr = new progress();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class meter : public element {
           public:
             meter() { element::m_type = meter_t; }
             HTML_FLUENT_METHODS(meter)
-            meter& value(double v) { add_attr("value", std::to_string(v)); return *this; }
-            meter& min(double m) { add_attr("min", std::to_string(m)); return *this; }
-            meter& max(double m) { add_attr("max", std::to_string(m)); return *this; }
-            meter& low(double l) { add_attr("low", std::to_string(l)); return *this; }
-            meter& high(double h) { add_attr("high", std::to_string(h)); return *this; }
-            meter& optimum(double o) { add_attr("optimum", std::to_string(o)); return *this; }
+            meter& value(number v) { add_attr("value", v); return *this; }
+            meter& min(number m) { add_attr("min", m); return *this; }
+            meter& max(number m) { add_attr("max", m); return *this; }
+            meter& low(number l) { add_attr("low", l); return *this; }
+            meter& high(number h) { add_attr("high", h); return *this; }
+            meter& optimum(number o) { add_attr("optimum", o); return *this; }
             virtual ~meter() { ; }
             virtual element* make_copy()const override {
                 meter* ptr = new meter();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                meter* ptr = new meter();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
@@ -8,10 +8,12 @@
 #ifndef HTML_FORWARD__INCLUDED
 #define HTML_FORWARD__INCLUDED
 
+#include <array>
 #include <vector>
 #include <string>
 #include <string_view>
 #include <memory>
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <cassert>
@@ -40,7 +42,8 @@ namespace html {
         // How dependencies are included in output
         enum class dependency_mode {
             cdn,        // Use CDN links (default, smaller output)
-            embedded    // Embed full CSS/JS (self-contained, larger output)
+            embedded,   // Embed full CSS/JS (self-contained, larger output)
+            external    // Content-hashed files in an asset directory, shared by all pages
         };
 
         // Forward declarations
@@ -51,6 +54,14 @@ namespace html {
             // Thread-local pointer to current page being built
             // This allows components to register dependencies without explicit page reference
             extern thread_local page* current_page;
+
+            // Thread-local memory resource used for new element trees: the top
+            // of the html::arena_scope stack, or null for the global heap.
+            extern thread_local std::pmr::memory_resource* current_resource;
+
+            inline std::pmr::memory_resource* resource() {
+                return current_resource ? current_resource : std::pmr::new_delete_resource();
+            }
         }
 
         //=============================================================================
@@ -173,7 +184,156 @@ namespace html {
             picture_t,
             track_t,
             iframe_t,
-            canvas_t
+            canvas_t,
+
+            // Pre-rendered markup and template placeholders (no tag of their own)
+            static_fragment_t,
+            slot_t,
+            shared_subtree_t,
+
+            element_type_count
+        };
+
+        namespace detail {
+            // Tag name and the exact open / close tag bytes for an element_t,
+            // e.g. "div", "<div" and "</div>". Empty for types without a tag.
+            struct tag_text {
+                std::string_view name;
+                std::string_view open;
+                std::string_view close;
+            };
+
+            constexpr std::array<tag_text, element_type_count> make_tag_table() {
+                std::array<tag_text, element_type_count> v{};
+#define HTML_TAG_TEXT(n) v[n##_t] = tag_text{#n, "<" #n, "</" #n ">"}
+                HTML_TAG_TEXT(body);
+                HTML_TAG_TEXT(head);
+                HTML_TAG_TEXT(title);
+                HTML_TAG_TEXT(meta);
+                HTML_TAG_TEXT(div);
+                HTML_TAG_TEXT(nav);
+                HTML_TAG_TEXT(span);
+                HTML_TAG_TEXT(a);
+                HTML_TAG_TEXT(link);
+                HTML_TAG_TEXT(p);
+                HTML_TAG_TEXT(script);
+                HTML_TAG_TEXT(img);
+                HTML_TAG_TEXT(style);
+                HTML_TAG_TEXT(h1);
+                HTML_TAG_TEXT(h2);
+                HTML_TAG_TEXT(h3);
+                HTML_TAG_TEXT(h4);
+                HTML_TAG_TEXT(h5);
+                HTML_TAG_TEXT(h6);
+                HTML_TAG_TEXT(table);
+                HTML_TAG_TEXT(td);
+                HTML_TAG_TEXT(tr);
+                HTML_TAG_TEXT(thead);
+                HTML_TAG_TEXT(tfoot);
+                HTML_TAG_TEXT(tbody);
+                HTML_TAG_TEXT(th);
+                HTML_TAG_TEXT(caption);
+                HTML_TAG_TEXT(br);
+                HTML_TAG_TEXT(hr);
+                HTML_TAG_TEXT(em);
+                HTML_TAG_TEXT(strong);
+                HTML_TAG_TEXT(small);
+                HTML_TAG_TEXT(b);
+                HTML_TAG_TEXT(ol);
+                HTML_TAG_TEXT(ul);
+                HTML_TAG_TEXT(li);
+                HTML_TAG_TEXT(textarea);
+                // Form elements
+                HTML_TAG_TEXT(form);
+                HTML_TAG_TEXT(input);
+                HTML_TAG_TEXT(button);
+                HTML_TAG_TEXT(select);
+                HTML_TAG_TEXT(option);
+                HTML_TAG_TEXT(label);
+                HTML_TAG_TEXT(fieldset);
+                HTML_TAG_TEXT(legend);
+                // Semantic HTML5 elements
+                HTML_TAG_TEXT(header);
+                HTML_TAG_TEXT(footer);
+                HTML_TAG_TEXT(section);
+                HTML_TAG_TEXT(article);
+                HTML_TAG_TEXT(aside);
+                HTML_TAG_TEXT(main);
+                // Media elements
+                HTML_TAG_TEXT(video);
+                HTML_TAG_TEXT(audio);
+                HTML_TAG_TEXT(source);
+                // Table structure
+                HTML_TAG_TEXT(colgroup);
+                HTML_TAG_TEXT(col);
+                // Interactive elements
+                HTML_TAG_TEXT(details);
+                HTML_TAG_TEXT(summary);
+                HTML_TAG_TEXT(dialog);
+                HTML_TAG_TEXT(template);
+                // Semantic text elements
+                HTML_TAG_TEXT(figure);
+                HTML_TAG_TEXT(figcaption);
+                HTML_TAG_TEXT(time);
+                HTML_TAG_TEXT(mark);
+                HTML_TAG_TEXT(code);
+                HTML_TAG_TEXT(pre);
+                HTML_TAG_TEXT(kbd);
+                HTML_TAG_TEXT(samp);
+                HTML_TAG_TEXT(var);
+                HTML_TAG_TEXT(blockquote);
+                HTML_TAG_TEXT(q);
+                HTML_TAG_TEXT(abbr);
+                HTML_TAG_TEXT(cite);
+                HTML_TAG_TEXT(dfn);
+                HTML_TAG_TEXT(address);
+                HTML_TAG_TEXT(sub);
+                HTML_TAG_TEXT(sup);
+                HTML_TAG_TEXT(ins);
+                HTML_TAG_TEXT(del);
+                HTML_TAG_TEXT(s);
+                HTML_TAG_TEXT(u);
+                // Form enhancements
+                HTML_TAG_TEXT(datalist);
+                HTML_TAG_TEXT(output);
+                HTML_TAG_TEXT(optgroup);
+                HTML_TAG_TEXT(progress);
+                HTML_TAG_TEXT(meter);
+                // Media & embedded
+                HTML_TAG_TEXT(picture);
+                HTML_TAG_TEXT(track);
+                HTML_TAG_TEXT(iframe);
+                HTML_TAG_TEXT(canvas);
+#undef HTML_TAG_TEXT
+                return v;
+            }
+
+            // Built at compile time, so there is no static initialization order
+            inline constexpr std::array<tag_text, element_type_count> tag_table = make_tag_table();
+        }
+
+        //=============================================================================
+        // ATTRIBUTE IDS
+        //=============================================================================
+
+        // Interned attribute names. The attributes with a dedicated accessor have
+        // fixed ids in output order; any other name gets an id >= first_generic_attr
+        // the first time it is used (see attribute_list::intern).
+        enum attr_id : unsigned short {
+            no_attr = 0,
+            id_attr,
+            data_id_attr,
+            class_attr,
+            type_attr,
+            role_attr,
+            style_attr,
+            src_attr,
+            alt_attr,
+            width_attr,
+            height_attr,
+            href_attr,
+            rel_attr,
+            first_generic_attr
         };
 
         // Forward declarations (page declared above with dependency system)
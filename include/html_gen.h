@@ -26,6 +26,12 @@
 #include "html_media.h"
 #include "html_interactive.h"
 #include "html_misc.h"
+#include "html_template.h"
+#include "html_stream.h"
+#include "html_gzip.h"
+#include "html_css.h"
+#include "html_query.h"
+#include "html_flat.h"
 
 // Namespace alias to allow htmlgen::html:: prefix
 namespace htmlgen {
@@ -27,7 +27,7 @@ namespace chart {
       public:
         line_chart();
         void add(double value);
-        [[nodiscard]] std::string html();
+        [[nodiscard]] html::raw_html html();
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -44,7 +44,7 @@ namespace chart {
       public:
         timeseries_line_chart();
         void add(const std::chrono::system_clock::time_point& ts, double value);
-        [[nodiscard]] std::string html();
+        [[nodiscard]] html::raw_html html();
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -60,7 +60,7 @@ namespace chart {
       public:
         bar_chart();
         void add(const std::string& category, double value);
-        [[nodiscard]] std::string html();
+        [[nodiscard]] html::raw_html html();
     };
 
 }
@@ -9,6 +9,7 @@
 #define HTML_GEN_RESOURCES__INCLUDED
 
 #include <string>
+#include <string_view>
 #include <cstddef>
 
 namespace resources {
@@ -19,30 +20,96 @@ namespace resources {
         extern const char bootstrap_min_css[];
         extern const size_t bootstrap_min_css_size;
 
+        // View of the static array, no copy
+        inline std::string_view bootstrap_css_view() {
+            return std::string_view(bootstrap_min_css, bootstrap_min_css_size);
+        }
+
         inline std::string bootstrap_css_string() {
             return std::string(bootstrap_min_css, bootstrap_min_css_size);
         }
 
+        // Precompressed: one complete gzip member
+        extern const char bootstrap_min_css_gz[];
+        extern const size_t bootstrap_min_css_gz_size;
+
+        inline std::string_view bootstrap_css_gz_view() {
+            return std::string_view(bootstrap_min_css_gz, bootstrap_min_css_gz_size);
+        }
+#ifdef HTML_GEN_BROTLI_RESOURCES
+        // Precompressed: brotli stream (generate_resources.py --brotli)
+        extern const char bootstrap_min_css_br[];
+        extern const size_t bootstrap_min_css_br_size;
+
+        inline std::string_view bootstrap_css_br_view() {
+            return std::string_view(bootstrap_min_css_br, bootstrap_min_css_br_size);
+        }
+#endif
+
         //---------------------------------------------------------------------------------
         // Bootstrap 5 JS Bundle (minified, includes Popper)
         //---------------------------------------------------------------------------------
         extern const char bootstrap_min_js[];
         extern const size_t bootstrap_min_js_size;
 
+        // View of the static array, no copy
+        inline std::string_view bootstrap_js_view() {
+            return std::string_view(bootstrap_min_js, bootstrap_min_js_size);
+        }
+
         inline std::string bootstrap_js_string() {
             return std::string(bootstrap_min_js, bootstrap_min_js_size);
         }
 
+        // Precompressed: one complete gzip member
+        extern const char bootstrap_min_js_gz[];
+        extern const size_t bootstrap_min_js_gz_size;
+
+        inline std::string_view bootstrap_js_gz_view() {
+            return std::string_view(bootstrap_min_js_gz, bootstrap_min_js_gz_size);
+        }
+#ifdef HTML_GEN_BROTLI_RESOURCES
+        // Precompressed: brotli stream (generate_resources.py --brotli)
+        extern const char bootstrap_min_js_br[];
+        extern const size_t bootstrap_min_js_br_size;
+
+        inline std::string_view bootstrap_js_br_view() {
+            return std::string_view(bootstrap_min_js_br, bootstrap_min_js_br_size);
+        }
+#endif
+
         //---------------------------------------------------------------------------------
         // ApexCharts JS (minified)
         //---------------------------------------------------------------------------------
         extern const char apexcharts_min_js[];
         extern const size_t apexcharts_min_js_size;
 
+        // View of the static array, no copy
+        inline std::string_view apexcharts_js_view() {
+            return std::string_view(apexcharts_min_js, apexcharts_min_js_size);
+        }
+
         inline std::string apexcharts_js_string() {
             return std::string(apexcharts_min_js, apexcharts_min_js_size);
         }
 
+        // Precompressed: one complete gzip member
+        extern const char apexcharts_min_js_gz[];
+        extern const size_t apexcharts_min_js_gz_size;
+
+        inline std::string_view apexcharts_js_gz_view() {
+            return std::string_view(apexcharts_min_js_gz, apexcharts_min_js_gz_size);
+        }
+#ifdef HTML_GEN_BROTLI_RESOURCES
+        // Precompressed: brotli stream (generate_resources.py --brotli)
+        extern const char apexcharts_min_js_br[];
+        extern const size_t apexcharts_min_js_br_size;
+
+        inline std::string_view apexcharts_js_br_view() {
+            return std::string_view(apexcharts_min_js_br, apexcharts_min_js_br_size);
+        }
+#endif
+
 } // namespace resources
 
 // Namespace alias to allow htmlgen::resources:: prefix
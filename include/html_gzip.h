@@ -0,0 +1,66 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_GZIP__INCLUDED
+#define HTML_GZIP__INCLUDED
+
+#include "html_writer.h"
+#include <cstdint>
+
+namespace html {
+
+        //=============================================================================
+        // GZIP OUTPUT
+        //
+        // gzip_writer turns the rendered page into a gzip stream (RFC 1952) for
+        // "Content-Encoding: gzip" responses. The stream is a sequence of gzip
+        // members: dynamic output is compressed into members on the fly, and
+        // precompressed resources (embedded Bootstrap / ApexCharts) are spliced in
+        // as their own, ready-made members. A self-contained page therefore only
+        // costs compression time for its dynamic content.
+        //
+        // Built with zlib (HTML_GEN_HAVE_ZLIB) the dynamic members are deflated;
+        // without it they use stored (uncompressed) deflate blocks, which is still
+        // a valid stream and still splices the compressed resources.
+        //=============================================================================
+
+        class gzip_writer : public buffered_writer {
+          private:
+            struct state;
+            writer& m_out;
+            std::unique_ptr<state> m_state;
+            bool m_in_member;
+            bool m_finished;
+            size_t m_members;
+          private:
+            void begin_member();
+            void end_member();
+          protected:
+            virtual void consume(const char* _p, size_t _n) override;
+          public:
+            // _level: zlib compression level (ignored without zlib)
+            explicit gzip_writer(writer& _out, int _level = 6, size_t _capacity = 16 * 1024);
+            virtual ~gzip_writer();
+
+            virtual void write_precompressed(std::string_view _raw, std::string_view _gzip_member) override;
+            // Make everything written so far decodable downstream, then flush _out
+            virtual void flush() override;
+            // Close the last member and flush _out; called by the destructor
+            void finish();
+
+            size_t members()const { return m_members; }
+            // True when dynamic parts are deflated (built with zlib)
+            static bool compresses();
+        };
+
+        namespace detail {
+            std::uint32_t crc32(std::uint32_t _crc, const char* _p, size_t _n);
+        }
+
+}//html
+
+#endif
@@ -39,14 +39,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                details* ptr = new details();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class summary : public element {
           public:
             summary() { element::m_type = summary_t; }
-            summary(const std::string& _s) {
+            summary(std::string_view _s) {
                 element::m_type = summary_t;
-                add(text(_s));
+                add(_s);
             }
             HTML_FLUENT_METHODS(summary)
             virtual ~summary() { ; }
@@ -55,6 +60,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                summary* ptr = new summary();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class dialog : public element {
@@ -80,6 +90,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                dialog* ptr = new dialog();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class template_ : public element {
@@ -96,6 +111,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                template_* ptr = new template_();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
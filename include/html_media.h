@@ -36,8 +36,8 @@ namespace html {
             video& autoplay() { add_attr("autoplay", "autoplay"); return *this; }
             video& loop() { add_attr("loop", "loop"); return *this; }
             video& muted() { add_attr("muted", "muted"); return *this; }
-            video& poster(const std::string& _p) { add_attr("poster", _p); return *this; }
-            video& preload(const std::string& _p) { add_attr("preload", _p); return *this; }
+            video& poster(std::string_view _p) { add_attr("poster", _p); return *this; }
+            video& preload(std::string_view _p) { add_attr("preload", _p); return *this; }
             video& playsinline() { add_attr("playsinline", "playsinline"); return *this; }
             virtual ~video() { ; }
             virtual element* make_copy()const override {
@@ -45,6 +45,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                video* ptr = new video();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class audio : public element {
@@ -67,13 +72,18 @@ namespace html {
             audio& autoplay() { add_attr("autoplay", "autoplay"); return *this; }
             audio& loop() { add_attr("loop", "loop"); return *this; }
             audio& muted() { add_attr("muted", "muted"); return *this; }
-            audio& preload(const std::string& _p) { add_attr("preload", _p); return *this; }
+            audio& preload(std::string_view _p) { add_attr("preload", _p); return *this; }
             virtual ~audio() { ; }
             virtual element* make_copy()const override {
                 audio* ptr = new audio();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                audio* ptr = new audio();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class source : public element {
@@ -83,7 +93,7 @@ namespace html {
                 element::m_has_closing_tag = false;
                 element::m_is_container = false;
             }
-            source(const std::string& _src, const std::string& _type) {
+            source(std::string_view _src, std::string_view _type) {
                 element::m_type = source_t;
                 element::m_has_closing_tag = false;
                 element::m_is_container = false;
@@ -91,15 +101,20 @@ namespace html {
                 type(_type);
             }
             HTML_FLUENT_METHODS(source)
-            source& media(const std::string& m) { add_attr("media", m); return *this; }
-            source& srcset(const std::string& s) { add_attr("srcset", s); return *this; }
-            source& sizes(const std::string& s) { add_attr("sizes", s); return *this; }
+            source& media(std::string_view m) { add_attr("media", m); return *this; }
+            source& srcset(std::string_view s) { add_attr("srcset", s); return *this; }
+            source& sizes(std::string_view s) { add_attr("sizes", s); return *this; }
             virtual ~source() { ; }
             virtual element* make_copy()const override {
                 source* ptr = new source();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                source* ptr = new source();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -128,6 +143,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                picture* ptr = new picture();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class track : public element {
@@ -138,10 +158,10 @@ namespace html {
                 element::m_is_container = false;
             }
             HTML_FLUENT_METHODS(track)
-            track& kind(const std::string& k) { add_attr("kind", k); return *this; }
-            track& srclang(const std::string& l) { add_attr("srclang", l); return *this; }
-            track& label(const std::string& l) { add_attr("label", l); return *this; }
-            track& label_attr(const std::string& l) { add_attr("label", l); return *this; }
+            track& kind(std::string_view k) { add_attr("kind", k); return *this; }
+            track& srclang(std::string_view l) { add_attr("srclang", l); return *this; }
+            track& label(std::string_view l) { add_attr("label", l); return *this; }
+            track& label_attr(std::string_view l) { add_attr("label", l); return *this; }
             track& default_() { add_attr("default", "default"); return *this; }
             virtual ~track() { ; }
             virtual element* make_copy()const override {
@@ -149,6 +169,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                track* ptr = new track();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class iframe : public element {
@@ -158,18 +183,23 @@ namespace html {
                 m_newline_after_element = true;
             }
             HTML_FLUENT_METHODS(iframe)
-            iframe& sandbox(const std::string& s) { add_attr("sandbox", s); return *this; }
-            iframe& allow(const std::string& a) { add_attr("allow", a); return *this; }
-            iframe& loading(const std::string& l) { add_attr("loading", l); return *this; }
-            iframe& name(const std::string& n) { add_attr("name", n); return *this; }
-            iframe& srcdoc(const std::string& s) { add_attr("srcdoc", s); return *this; }
-            iframe& referrerpolicy(const std::string& r) { add_attr("referrerpolicy", r); return *this; }
+            iframe& sandbox(std::string_view s) { add_attr("sandbox", s); return *this; }
+            iframe& allow(std::string_view a) { add_attr("allow", a); return *this; }
+            iframe& loading(std::string_view l) { add_attr("loading", l); return *this; }
+            iframe& name(std::string_view n) { add_attr("name", n); return *this; }
+            iframe& srcdoc(std::string_view s) { add_attr("srcdoc", s); return *this; }
+            iframe& referrerpolicy(std::string_view r) { add_attr("referrerpolicy", r); return *this; }
             virtual ~iframe() { ; }
             virtual element* make_copy()const override {
                 iframe* ptr = new iframe();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                iframe* ptr = new iframe();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class canvas : public element {
@@ -185,6 +215,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                canvas* ptr = new canvas();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
@@ -36,11 +36,11 @@ namespace html {
                 add(_b);
             }
 
-            script(const std::string& _s) {
+            script(std::string_view _s) {
                 element::m_type = script_t;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             virtual ~script() { ; }
           public:
@@ -49,6 +49,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                script* ptr = new script();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -60,7 +65,7 @@ namespace html {
                 element::m_has_closing_tag = false;
                 m_newline_after_element = true;
             }
-            img(const std::string& _src, const std::string& _width = "") {
+            img(std::string_view _src, std::string_view _width = {}) {
                 element::m_type = img_t;
                 element::m_has_closing_tag = false;
                 m_newline_after_element = true;
@@ -69,8 +74,8 @@ namespace html {
                 { width(_width); }
             }
             HTML_FLUENT_METHODS(img)
-            img& loading(const std::string& l) { add_attr("loading", l); return *this; }
-            img& decoding(const std::string& d) { add_attr("decoding", d); return *this; }
+            img& loading(std::string_view l) { add_attr("loading", l); return *this; }
+            img& decoding(std::string_view d) { add_attr("decoding", d); return *this; }
             virtual ~img() { ; }
           public:
             virtual element* make_copy()const override {
@@ -78,6 +83,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                img* ptr = new img();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +107,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                link* ptr = new link();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -127,6 +142,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                head_link* ptr = new head_link();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
 
         };
 
@@ -165,6 +185,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                meta* ptr = new meta();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
 
         };
 
@@ -173,24 +198,24 @@ namespace html {
         class anchor : public element {
           public:
             anchor() { element::m_type = a_t; }
-            anchor(const std::string& _href) {
+            anchor(std::string_view _href) {
                 element::m_type = a_t;
                 href(_href);
             }
 
-            anchor(const std::string& _href, const element& _e) {
+            anchor(std::string_view _href, const element& _e) {
                 element::m_type = a_t;
                 href(_href);
                 add(_e);
             }
-            anchor(const std::string& _href, const std::string& _text) {
+            anchor(std::string_view _href, std::string_view _text) {
                 element::m_type = a_t;
                 href(_href);
-                add(text(_text));
+                add(_text);
             }
             HTML_FLUENT_METHODS(anchor)
-            anchor& target(const std::string& t) { add_attr("target", t); return *this; }
-            anchor& download(const std::string& d = "") {
+            anchor& target(std::string_view t) { add_attr("target", t); return *this; }
+            anchor& download(std::string_view d = {}) {
                 if (d.empty()) add_attr("download", "download");
                 else add_attr("download", d);
                 return *this;
@@ -202,6 +227,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                anchor* ptr = new anchor();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -212,10 +242,10 @@ namespace html {
                 element::m_type = style_t;
                 m_newline_after_element = true;
             }
-            style(const std::string& _s) {
+            style(std::string_view _s) {
                 element::m_type = style_t;
                 m_newline_after_element = true;
-                element::add(text(_s));
+                element::add(_s);
             }
             virtual ~style() { ; }
           public:
@@ -224,10 +254,13 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
-            virtual element& add(const std::string& _s) override {
-                text t(_s);
-                t.m_newline_after_element = true;
-                element::add(t);
+            virtual element* make_move() override {
+                style* ptr = new style();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
+            virtual element& add(std::string_view _s) override {
+                add_run(_s, false, true);
                 return *this;
             }
         };
@@ -0,0 +1,74 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_QUERY__INCLUDED
+#define HTML_QUERY__INCLUDED
+
+#include "html_core.h"
+
+namespace html {
+
+        //=============================================================================
+        // SELECTOR QUERIES
+        //
+        // A parsed CSS selector list. Supported: type and universal selectors,
+        // .class, #id, [attr], [attr=value], :nth-child(an+b | odd | even),
+        // :first-child, :last-child, the descendant (space) and child (>)
+        // combinators and comma separated lists. Anything else throws
+        // std::runtime_error. Parse once and reuse for repeated queries:
+        //
+        //     html::selector cells("table.report td:nth-child(3)");
+        //     for(element* td : pg.query_selector_all(cells)) { td->add_cl("text-end"); }
+        //=============================================================================
+
+        class selector {
+          public:
+            struct attr_test {
+                attr_id id;
+                bool has_value;
+                std::string value;
+            };
+            struct nth_test {
+                int a;
+                int b;
+                bool from_end;                      // :last-child
+            };
+            struct compound {
+                element_t type;                     // undefined_t: any element
+                bool unknown_type;                  // type name without an element type
+                std::string id;
+                std::vector<std::string> classes;
+                std::vector<attr_test> attrs;
+                std::vector<nth_test> nth;
+                char combinator;                    // to the compound on the left: ' ', '>' or 0
+            };
+            using complex = std::vector<compound>;
+          private:
+            std::vector<complex> m_list;
+
+            friend class element;
+
+            static bool is_element(const element& _e);
+            // 1-based position among the element siblings of _e
+            static int child_position(const element& _e, bool _from_end);
+            static bool match_compound(const compound& _c, const element& _e);
+            static bool match_complex(const complex& _c, size_t _k, const element& _e);
+            // Sorts nodes of one indexed tree into document order
+            static void document_order(std::vector<element*>& _nodes, detail::tree_index& _index);
+            // Descendants of _root matching, in document order (walks the tree)
+            void collect(element& _root, std::vector<element*>& _out, bool _first)const;
+          public:
+            explicit selector(std::string_view _text);
+
+            // True if _e matches any selector in the list
+            bool matches(const element& _e)const;
+            const std::vector<complex>& list()const { return m_list; }
+        };
+
+}//html
+
+#endif
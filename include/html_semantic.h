@@ -38,6 +38,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                header* ptr = new header();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class footer : public element {
@@ -62,6 +67,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                footer* ptr = new footer();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class section : public element {
@@ -86,6 +96,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                section* ptr = new section();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class article : public element {
@@ -110,6 +125,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                article* ptr = new article();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class aside : public element {
@@ -134,6 +154,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                aside* ptr = new aside();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class main : public element {
@@ -158,6 +183,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                html::main* ptr = new html::main();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         ////////////////////////////////////////////////////////////////////////////////////
@@ -186,14 +216,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                figure* ptr = new figure();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class figcaption : public element {
           public:
             figcaption() { element::m_type = figcaption_t; }
-            figcaption(const std::string& _s) {
+            figcaption(std::string_view _s) {
                 element::m_type = figcaption_t;
-                add(text(_s));
+                add(_s);
             }
             HTML_FLUENT_METHODS(figcaption)
             virtual ~figcaption() { ; }
@@ -202,31 +237,41 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                figcaption* ptr = new figcaption();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class time_ : public element {
           public:
             time_() { element::m_type = time_t; }
-            time_(const std::string& _s) {
+            time_(std::string_view _s) {
                 element::m_type = time_t;
-                add(text(_s));
+                add(_s);
             }
             HTML_FLUENT_METHODS(time_)
-            time_& datetime(const std::string& dt) { add_attr("datetime", dt); return *this; }
+            time_& datetime(std::string_view dt) { add_attr("datetime", dt); return *this; }
             virtual ~time_() { ; }
             virtual element* make_copy()const override {
                 time_* ptr = new time_();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                time_* ptr = new time_();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class mark : public element {
           public:
             mark() { element::m_type = mark_t; }
-            mark(const std::string& _s) {
+            mark(std::string_view _s) {
                 element::m_type = mark_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~mark() { ; }
             virtual element* make_copy()const override {
@@ -234,14 +279,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                mark* ptr = new mark();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class code : public element {
           public:
             code() { element::m_type = code_t; }
-            code(const std::string& _s) {
+            code(std::string_view _s) {
                 element::m_type = code_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~code() { ; }
             virtual element* make_copy()const override {
@@ -249,6 +299,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                code* ptr = new code();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class pre : public element {
@@ -257,10 +312,10 @@ namespace html {
                 element::m_type = pre_t;
                 m_newline_after_element = true;
             }
-            pre(const std::string& _s) {
+            pre(std::string_view _s) {
                 element::m_type = pre_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             virtual ~pre() { ; }
             virtual element* make_copy()const override {
@@ -268,14 +323,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                pre* ptr = new pre();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class kbd : public element {
           public:
             kbd() { element::m_type = kbd_t; }
-            kbd(const std::string& _s) {
+            kbd(std::string_view _s) {
                 element::m_type = kbd_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~kbd() { ; }
             virtual element* make_copy()const override {
@@ -283,14 +343,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                kbd* ptr = new kbd();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class samp : public element {
           public:
             samp() { element::m_type = samp_t; }
-            samp(const std::string& _s) {
+            samp(std::string_view _s) {
                 element::m_type = samp_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~samp() { ; }
             virtual element* make_copy()const override {
@@ -298,14 +363,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                samp* ptr = new samp();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class var : public element {
           public:
             var() { element::m_type = var_t; }
-            var(const std::string& _s) {
+            var(std::string_view _s) {
                 element::m_type = var_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~var() { ; }
             virtual element* make_copy()const override {
@@ -313,6 +383,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                var* ptr = new var();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class blockquote : public element {
@@ -322,11 +397,11 @@ namespace html {
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
             }
-            blockquote(const std::string& _s) {
+            blockquote(std::string_view _s) {
                 element::m_type = blockquote_t;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             // Variadic constructor for nested children
             template<typename... Args, typename = std::enable_if_t<(sizeof...(Args) > 1)>>
@@ -337,37 +412,47 @@ namespace html {
                 add_children(std::forward<Args>(args)...);
             }
             HTML_FLUENT_METHODS(blockquote)
-            blockquote& cite(const std::string& url) { add_attr("cite", url); return *this; }
+            blockquote& cite(std::string_view url) { add_attr("cite", url); return *this; }
             virtual ~blockquote() { ; }
             virtual element* make_copy()const override {
                 blockquote* ptr = new blockquote();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                blockquote* ptr = new blockquote();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class q : public element {
           public:
             q() { element::m_type = q_t; }
-            q(const std::string& _s) {
+            q(std::string_view _s) {
                 element::m_type = q_t;
-                add(text(_s));
+                add(_s);
             }
-            q& cite(const std::string& url) { add_attr("cite", url); return *this; }
+            q& cite(std::string_view url) { add_attr("cite", url); return *this; }
             virtual ~q() { ; }
             virtual element* make_copy()const override {
                 q* ptr = new q();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                q* ptr = new q();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class abbr : public element {
           public:
             abbr() { element::m_type = abbr_t; }
-            abbr(const std::string& _s) {
+            abbr(std::string_view _s) {
                 element::m_type = abbr_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~abbr() { ; }
             virtual element* make_copy()const override {
@@ -375,14 +460,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                abbr* ptr = new abbr();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class cite_ : public element {
           public:
             cite_() { element::m_type = cite_t; }
-            cite_(const std::string& _s) {
+            cite_(std::string_view _s) {
                 element::m_type = cite_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~cite_() { ; }
             virtual element* make_copy()const override {
@@ -390,14 +480,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                cite_* ptr = new cite_();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class dfn : public element {
           public:
             dfn() { element::m_type = dfn_t; }
-            dfn(const std::string& _s) {
+            dfn(std::string_view _s) {
                 element::m_type = dfn_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~dfn() { ; }
             virtual element* make_copy()const override {
@@ -405,6 +500,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                dfn* ptr = new dfn();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class address : public element {
@@ -429,14 +529,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                address* ptr = new address();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class sub : public element {
           public:
             sub() { element::m_type = sub_t; }
-            sub(const std::string& _s) {
+            sub(std::string_view _s) {
                 element::m_type = sub_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~sub() { ; }
             virtual element* make_copy()const override {
@@ -444,14 +549,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                sub* ptr = new sub();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class sup : public element {
           public:
             sup() { element::m_type = sup_t; }
-            sup(const std::string& _s) {
+            sup(std::string_view _s) {
                 element::m_type = sup_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~sup() { ; }
             virtual element* make_copy()const override {
@@ -459,48 +569,63 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                sup* ptr = new sup();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class ins : public element {
           public:
             ins() { element::m_type = ins_t; }
-            ins(const std::string& _s) {
+            ins(std::string_view _s) {
                 element::m_type = ins_t;
-                add(text(_s));
+                add(_s);
             }
-            ins& cite(const std::string& url) { add_attr("cite", url); return *this; }
-            ins& datetime(const std::string& dt) { add_attr("datetime", dt); return *this; }
+            ins& cite(std::string_view url) { add_attr("cite", url); return *this; }
+            ins& datetime(std::string_view dt) { add_attr("datetime", dt); return *this; }
             virtual ~ins() { ; }
             virtual element* make_copy()const override {
                 ins* ptr = new ins();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                ins* ptr = new ins();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class del : public element {
           public:
             del() { element::m_type = del_t; }
-            del(const std::string& _s) {
+            del(std::string_view _s) {
                 element::m_type = del_t;
-                add(text(_s));
+                add(_s);
             }
-            del& cite(const std::string& url) { add_attr("cite", url); return *this; }
-            del& datetime(const std::string& dt) { add_attr("datetime", dt); return *this; }
+            del& cite(std::string_view url) { add_attr("cite", url); return *this; }
+            del& datetime(std::string_view dt) { add_attr("datetime", dt); return *this; }
             virtual ~del() { ; }
             virtual element* make_copy()const override {
                 del* ptr = new del();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                del* ptr = new del();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class s : public element {
           public:
             s() { element::m_type = s_t; }
-            s(const std::string& _s) {
+            s(std::string_view _s) {
                 element::m_type = s_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~s() { ; }
             virtual element* make_copy()const override {
@@ -508,14 +633,19 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                html::s* ptr = new html::s();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class u : public element {
           public:
             u() { element::m_type = u_t; }
-            u(const std::string& _s) {
+            u(std::string_view _s) {
                 element::m_type = u_t;
-                add(text(_s));
+                add(_s);
             }
             virtual ~u() { ; }
             virtual element* make_copy()const override {
@@ -523,6 +653,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                u* ptr = new u();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
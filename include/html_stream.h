@@ -0,0 +1,71 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_STREAM__INCLUDED
+#define HTML_STREAM__INCLUDED
+
+#include "html_core.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace html {
+
+        //=============================================================================
+        // CHUNKED STREAMING
+        //
+        // Render a page (or any element) in bounded chunks so the first bytes can
+        // go out before the rest is rendered. The tree must not be modified until
+        // streaming has finished.
+        //=============================================================================
+
+        // Push model: _cb receives each chunk (at most _chunk_size bytes) as soon as
+        // it is full. Rendering waits for the callback, so a slow consumer slows the
+        // render instead of growing a buffer.
+        void write_chunked(element& _e, size_t _chunk_size, const callback_writer::callback& _cb);
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Pull model: rendering runs on a worker thread and stops once _max_pending
+        // chunks are waiting, so memory stays at about (_max_pending + 1) chunks.
+        //
+        //   chunk_stream cs(pg, 8 * 1024);
+        //   std::string chunk;
+        //   while(cs.next(chunk)) { send(chunk); }
+
+        class chunk_stream {
+          private:
+            size_t m_chunk_size;
+            size_t m_max_pending;
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<std::string> m_pending;
+            std::vector<std::string> m_free;
+            bool m_done;
+            bool m_cancelled;
+            std::exception_ptr m_error;
+            std::thread m_worker;
+          private:
+            void produce(element& _e);
+            void push(std::string_view _chunk);
+          public:
+            explicit chunk_stream(element& _e, size_t _chunk_size = 16 * 1024, size_t _max_pending = 2);
+            chunk_stream(const chunk_stream&) = delete;
+            chunk_stream& operator=(const chunk_stream&) = delete;
+            // Stops the render if it is still running
+            virtual ~chunk_stream();
+
+            // Next chunk into _chunk (its old buffer is recycled). Returns false
+            // once the page is complete; rethrows errors raised while rendering.
+            bool next(std::string& _chunk);
+            size_t chunk_size()const { return m_chunk_size; }
+        };
+
+}//html
+
+#endif
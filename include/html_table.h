@@ -17,10 +17,15 @@ namespace html {
         class td : public element {
           public:
             td() { element::m_type = td_t; m_newline_after_element = true; }
-            td(const std::string& _s) {
+            td(std::string_view _s) {
                 element::m_type = td_t;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
+            }
+            td(text_ref _s) {
+                element::m_type = td_t;
+                m_newline_after_element = true;
+                add(_s);
             }
             td( element& _e) {
                 element::m_type = td_t;
@@ -34,14 +39,19 @@ namespace html {
             }
             virtual ~td() { ; }
             HTML_FLUENT_METHODS(td)
-            td& colspan(int n) { add_attr("colspan", std::to_string(n)); return *this; }
-            td& rowspan(int n) { add_attr("rowspan", std::to_string(n)); return *this; }
-            td& headers(const std::string& h) { add_attr("headers", h); return *this; }
+            td& colspan(int n) { add_attr("colspan", number(n)); return *this; }
+            td& rowspan(int n) { add_attr("rowspan", number(n)); return *this; }
+            td& headers(std::string_view h) { add_attr("headers", h); return *this; }
             virtual element* make_copy()const override {
                 td* ptr = new html::td();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                td* ptr = new html::td();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
         typedef td cell;
 
@@ -70,6 +80,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                tr* ptr = new tr();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -85,7 +100,9 @@ namespace html {
             }
             row& add_all(const html::attr& _a) {
                 for(auto& e : m_elements) {
-                    e->add_attr(_a);
+                    if(!e.is_run()) {
+                        e->add_attr(_a);
+                    }
                 }
                 return *this;
             }
@@ -104,7 +121,9 @@ namespace html {
             }
             hrow& add_all(const html::attr& _a) {
                 for(auto& e : m_elements) {
-                    e->add_attr(_a);
+                    if(!e.is_run()) {
+                        e->add_attr(_a);
+                    }
                 }
                 return *this;
             }
@@ -119,25 +138,36 @@ namespace html {
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
             }
-            th(const std::string& _s) {
+            th(std::string_view _s) {
                 m_type = th_t;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
+            }
+            th(text_ref _s) {
+                m_type = th_t;
+                m_newline_after_tag = true;
+                m_newline_after_element = true;
+                add(_s);
             }
             virtual ~th() { ; }
             HTML_FLUENT_METHODS(th)
-            th& scope(const std::string& s) { add_attr("scope", s); return *this; }
-            th& colspan(int n) { add_attr("colspan", std::to_string(n)); return *this; }
-            th& rowspan(int n) { add_attr("rowspan", std::to_string(n)); return *this; }
-            th& abbr(const std::string& s) { add_attr("abbr", s); return *this; }
-            th& headers(const std::string& h) { add_attr("headers", h); return *this; }
+            th& scope(std::string_view s) { add_attr("scope", s); return *this; }
+            th& colspan(int n) { add_attr("colspan", number(n)); return *this; }
+            th& rowspan(int n) { add_attr("rowspan", number(n)); return *this; }
+            th& abbr(std::string_view s) { add_attr("abbr", s); return *this; }
+            th& headers(std::string_view h) { add_attr("headers", h); return *this; }
 
             virtual element* make_copy()const override {
                 th* ptr = new th();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                th* ptr = new th();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +195,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                tbody* ptr = new tbody();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +227,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                thead* ptr = new thead();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -219,6 +259,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                tfoot* ptr = new tfoot();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class caption : public element {
@@ -228,11 +273,11 @@ namespace html {
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
             }
-            caption(const std::string& _s) {
+            caption(std::string_view _s) {
                 m_type = caption_t;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
-                add(text(_s));
+                add(_s);
             }
             // Variadic constructor for nested children
             template<typename... Args, typename = std::enable_if_t<(sizeof...(Args) > 1)>>
@@ -250,6 +295,11 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                caption* ptr = new caption();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +313,7 @@ namespace html {
           public:
             table() {
                 element::m_type = table_t;
+                element::m_writer = writer_custom;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
             }
@@ -270,6 +321,7 @@ namespace html {
             template<typename... Args, typename = std::enable_if_t<(sizeof...(Args) > 0)>>
             table(Args&&... args) {
                 element::m_type = table_t;
+                element::m_writer = writer_custom;
                 m_newline_after_tag = true;
                 m_newline_after_element = true;
                 add_children(std::forward<Args>(args)...);
@@ -277,7 +329,7 @@ namespace html {
             virtual ~table() { ; }
             HTML_FLUENT_METHODS(table)
           public:
-            virtual void write_html(std::ostream& _s)override {
+            virtual void write_html(writer& _s)override {
                 element::write_open_tag(_s);
 
                 if(caption.size()) {
@@ -309,6 +361,15 @@ namespace html {
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                table* ptr = new table();
+                ptr->move(std::move(*this));
+                ptr->caption.move(std::move(caption));
+                ptr->thead.move(std::move(thead));
+                ptr->tfoot.move(std::move(tfoot));
+                ptr->tbody.move(std::move(tbody));
+                return ptr;
+            }
         };
 
         /////////////////////////////////////////////////////////////////////////////////////
@@ -331,14 +392,19 @@ namespace html {
                 add_children(std::forward<Args>(args)...);
             }
             HTML_FLUENT_METHODS(colgroup)
-            colgroup& span(int n) { add_attr("span", std::to_string(n)); return *this; }
-            colgroup& span_attr(int n) { add_attr("span", std::to_string(n)); return *this; }
+            colgroup& span(int n) { add_attr("span", number(n)); return *this; }
+            colgroup& span_attr(int n) { add_attr("span", number(n)); return *this; }
             virtual ~colgroup() { ; }
             virtual element* make_copy()const override {
                 colgroup* ptr = new colgroup();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                colgroup* ptr = new colgroup();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
         class col : public element {
@@ -349,14 +415,19 @@ namespace html {
                 element::m_is_container = false;
             }
             HTML_FLUENT_METHODS(col)
-            col& span(int n) { add_attr("span", std::to_string(n)); return *this; }
-            col& span_attr(int n) { add_attr("span", std::to_string(n)); return *this; }
+            col& span(int n) { add_attr("span", number(n)); return *this; }
+            col& span_attr(int n) { add_attr("span", number(n)); return *this; }
             virtual ~col() { ; }
             virtual element* make_copy()const override {
                 col* ptr = new col();
                 ptr->copy(*this);
                 return ptr;
             }
+            virtual element* make_move() override {
+                col* ptr = new col();
+                ptr->move(std::move(*this));
+                return ptr;
+            }
         };
 
 }//html
@@ -0,0 +1,151 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_TEMPLATE__INCLUDED
+#define HTML_TEMPLATE__INCLUDED
+
+#include "html_core.h"
+#include <map>
+#include <vector>
+
+namespace html {
+
+        //=============================================================================
+        // COMPILED TEMPLATES
+        //
+        // A tree is authored with the normal element classes, with slot()
+        // placeholders where values change per request. page_template renders it
+        // once and keeps only the static bytes between the slots. Rendering a
+        // request then writes those segments and the escaped slot values; no
+        // elements are built.
+        //=============================================================================
+
+        enum class slot_kind {
+            text,       // string value, escaped for where the slot sits (text, script, style)
+            attribute,  // string value inside an attribute (see attr_slot)
+            tree        // element subtree
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Placeholder element. Renders a marker that page_template replaces, so a
+        // tree holding slots is only meaningful as template source.
+
+        class slot : public element {
+          private:
+            std::string m_name;
+            slot_kind m_kind;
+          public:
+            slot() : m_kind(slot_kind::text) {
+                element::m_type = slot_t;
+                element::m_writer = writer_custom;
+                element::m_is_container = false;
+            }
+            explicit slot(std::string_view _name, slot_kind _kind = slot_kind::text)
+                :
+                m_name(_name),
+                m_kind(_kind) {
+                element::m_type = slot_t;
+                element::m_writer = writer_custom;
+                element::m_is_container = false;
+                if(_kind == slot_kind::attribute) {
+                    throw std::runtime_error("slot: use attr_slot() for attribute values");
+                }
+            }
+            virtual ~slot() { ; }
+            const std::string& name()const { return m_name; }
+            slot_kind kind()const { return m_kind; }
+            virtual void write_html(writer& _s) override;
+            virtual element* make_copy()const override {
+                slot* ptr = new slot();
+                ptr->copy(*this);
+                ptr->m_name = m_name;
+                ptr->m_kind = m_kind;
+                return ptr;
+            }
+            virtual element* make_move() override {
+                slot* ptr = new slot();
+                ptr->move(std::move(*this));
+                ptr->m_name = std::move(m_name);
+                ptr->m_kind = m_kind;
+                return ptr;
+            }
+        };
+
+        // Placeholder for an attribute value: d.add_attr("href", attr_slot("url"))
+        std::string attr_slot(std::string_view _name);
+
+        /////////////////////////////////////////////////////////////////////////////////////
+
+        class slot_values;
+
+        class page_template {
+          public:
+            static constexpr size_t npos = static_cast<size_t>(-1);
+          private:
+            struct segment {
+                size_t offset;
+                size_t length;
+                size_t slot;            // npos for the trailing segment
+                escape_context context;
+            };
+            struct slot_info {
+                std::string name;
+                bool tree;
+            };
+            std::string m_static;
+            std::vector<segment> m_segments;
+            std::vector<slot_info> m_slots;
+            std::map<std::string, size_t, std::less<>> m_index;
+          private:
+            void compile(const std::string& _html);
+          public:
+            explicit page_template(element& _e);
+            explicit page_template(element&& _e) : page_template(_e) { ; }
+            virtual ~page_template() { ; }
+
+            size_t slot_count()const { return m_slots.size(); }
+            // Slot index by name, npos if the template has no such slot
+            size_t slot_index(std::string_view _name)const;
+            bool is_tree_slot(size_t _idx)const { return m_slots.at(_idx).tree; }
+            const std::string& slot_name(size_t _idx)const { return m_slots.at(_idx).name; }
+            // Total size of the static segments
+            size_t static_size()const { return m_static.size(); }
+
+            void render(writer& _w, const slot_values& _v)const;
+            std::string render(const slot_values& _v)const;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Values for one render. String values are copied in (the storage is
+        // reused when the object is refilled); subtrees are referenced and must
+        // outlive the render.
+
+        class slot_values {
+            friend class page_template;
+          private:
+            struct value {
+                std::string text;
+                element* tree;
+                value() : tree(nullptr) { ; }
+            };
+            const page_template& m_template;
+            std::vector<value> m_values;
+          public:
+            explicit slot_values(const page_template& _t);
+            virtual ~slot_values() { ; }
+
+            slot_values& set(size_t _idx, std::string_view _value);
+            slot_values& set(size_t _idx, element& _tree);
+            slot_values& set(std::string_view _name, std::string_view _value);
+            slot_values& set(std::string_view _name, element& _tree);
+            // Reset every slot to empty
+            void clear();
+        };
+
+}//html
+
+#endif
@@ -0,0 +1,255 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#ifndef HTML_WRITER__INCLUDED
+#define HTML_WRITER__INCLUDED
+
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace html {
+
+        //=============================================================================
+        // OUTPUT SINKS
+        //
+        // Elements render into a writer. Appends are inline copies into a window
+        // [m_pos, m_end) owned by the concrete sink; only when the window is full
+        // does the sink get a (virtual) chance to flush or grow it. Nothing is
+        // flushed per line.
+        //=============================================================================
+
+        // What the text currently being written ends up as. Text nodes are
+        // escaped for the context they are written in; attribute values
+        // always use the attribute rules.
+        enum class escape_context {
+            text,           // element content: & < >
+            attribute,      // quoted attribute value: & < > " '
+            script,         // <script> body: neutralise </script and <!--
+            style           // <style> body: neutralise </style
+        };
+
+        class writer;
+
+        namespace detail {
+            // Implemented alongside html_escape (src/html_escape.cpp)
+            void write_escaped(writer& _w, std::string_view _s, escape_context _ctx);
+        }
+
+        class writer {
+          protected:
+            char* m_pos;
+            char* m_end;
+            bool m_failed;
+            escape_context m_context;
+          protected:
+            writer() : m_pos(nullptr), m_end(nullptr), m_failed(false), m_context(escape_context::text) { ; }
+            // Make room for at least one more byte (ideally _need bytes).
+            // Returns false if the sink cannot take more data.
+            virtual bool overflow(size_t _need) = 0;
+          private:
+            void write_slow(const char* _p, size_t _n);
+          public:
+            writer(const writer&) = delete;
+            writer& operator=(const writer&) = delete;
+            virtual ~writer() { ; }
+
+            void write(const char* _p, size_t _n) {
+                if(static_cast<size_t>(m_end - m_pos) >= _n) {
+                    std::memcpy(m_pos, _p, _n);
+                    m_pos += _n;
+                } else {
+                    write_slow(_p, _n);
+                }
+            }
+            void write(std::string_view _s) { write(_s.data(), _s.size()); }
+            void put(char _c) {
+                if(m_pos != m_end) {
+                    *m_pos++ = _c;
+                } else {
+                    write_slow(&_c, 1);
+                }
+            }
+
+            writer& operator<<(std::string_view _s) { write(_s); return *this; }
+            writer& operator<<(const char* _s) { write(std::string_view(_s)); return *this; }
+            writer& operator<<(char _c) { put(_c); return *this; }
+
+            // Large block that stays valid at least until the call returns
+            // (e.g. static resources). Sinks that can pass it on without
+            // copying it through their buffer do so.
+            virtual void write_ref(std::string_view _s) { write(_s); }
+            // Same bytes, also available as a complete gzip member. Only
+            // compressing sinks (gzip_writer) use the member.
+            virtual void write_precompressed(std::string_view _raw, std::string_view _gzip_member) { (void)_gzip_member; write_ref(_raw); }
+
+            // Escaped output, straight into the buffer
+            void write_escaped(std::string_view _s) { detail::write_escaped(*this, _s, m_context); }
+            void write_escaped(std::string_view _s, escape_context _ctx) { detail::write_escaped(*this, _s, _ctx); }
+            escape_context context()const { return m_context; }
+            void context(escape_context _ctx) { m_context = _ctx; }
+
+            // Push buffered bytes to the destination
+            virtual void flush() { ; }
+            // True if the sink dropped data (e.g. fixed buffer full)
+            bool failed()const { return m_failed; }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Decimal text of a number, formatted with std::to_chars into inline
+        // storage. Converts to std::string_view, so it can be passed to any
+        // attribute setter or text constructor and written to a sink without
+        // allocating. Floating-point values use the shortest text that reads
+        // back as the same value, or a fixed number of decimals if given.
+
+        // Arithmetic types html::number formats (not bool or char)
+        template<typename T>
+        inline constexpr bool is_number_v = std::is_arithmetic_v<T> &&
+                                            !std::is_same_v<T, bool> && !std::is_same_v<T, char>;
+
+        class number {
+          private:
+            char m_buf[48];
+            unsigned char m_size;
+
+            template<typename F>
+            void format_float(F _v, int _precision) {
+                std::to_chars_result r = _precision < 0
+                    ? std::to_chars(m_buf, m_buf + sizeof(m_buf), _v)
+                    : std::to_chars(m_buf, m_buf + sizeof(m_buf), _v, std::chars_format::fixed, _precision);
+                if(r.ec != std::errc()) {
+                    // Too wide for fixed notation (huge values or precision)
+                    r = std::to_chars(m_buf, m_buf + sizeof(m_buf), _v);
+                }
+                m_size = static_cast<unsigned char>(r.ptr - m_buf);
+            }
+          public:
+            template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && is_number_v<T>>>
+            number(T _v) {
+                m_size = static_cast<unsigned char>(std::to_chars(m_buf, m_buf + sizeof(m_buf), _v).ptr - m_buf);
+            }
+            number(double _v, int _precision = -1) { format_float(_v, _precision); }
+            number(float _v, int _precision = -1) { format_float(_v, _precision); }
+
+            std::string_view view()const { return std::string_view(m_buf, m_size); }
+            operator std::string_view()const { return view(); }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Appends straight into a std::string, growing it geometrically
+
+        class string_writer : public writer {
+          private:
+            std::string m_own;
+            std::string& m_out;
+          protected:
+            virtual bool overflow(size_t _need) override;
+          public:
+            string_writer();
+            explicit string_writer(std::string& _out);
+            virtual ~string_writer();
+
+            virtual void flush() override;
+            // Finished output (for the owning constructor)
+            std::string& str() { flush(); return m_out; }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Renders into caller memory; output beyond the capacity is dropped
+
+        class buffer_writer : public writer {
+          private:
+            char* m_begin;
+          protected:
+            virtual bool overflow(size_t) override { return false; }
+          public:
+            buffer_writer(char* _buf, size_t _size) : m_begin(_buf) {
+                m_pos = _buf;
+                m_end = _buf + _size;
+            }
+            size_t size()const { return static_cast<size_t>(m_pos - m_begin); }
+            std::string_view view()const { return std::string_view(m_begin, size()); }
+            bool truncated()const { return failed(); }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Base for sinks that collect into an internal buffer and hand it on in blocks
+
+        class buffered_writer : public writer {
+          private:
+            std::unique_ptr<char[]> m_buffer;
+            size_t m_capacity;
+          protected:
+            virtual bool overflow(size_t) override;
+            // Receives each block of output
+            virtual void consume(const char* _p, size_t _n) = 0;
+            // Receives several blocks at once (buffered bytes + a referenced
+            // block); the default hands them to consume() in capacity-sized slices
+            virtual void consume_parts(const std::string_view* _parts, size_t _count);
+            // Hand the buffered bytes to consume()
+            void drain();
+            const char* buffer_begin()const { return m_buffer.get(); }
+          public:
+            explicit buffered_writer(size_t _capacity = 16 * 1024);
+            virtual void flush() override;
+            // Blocks of at least a quarter of the buffer bypass it
+            virtual void write_ref(std::string_view _s) override;
+            size_t capacity()const { return m_capacity; }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Writes to a file descriptor (POSIX write / Windows _write). Referenced
+        // blocks go out together with the buffered bytes in one writev call.
+
+        class fd_writer : public buffered_writer {
+          private:
+            int m_fd;
+          protected:
+            virtual void consume(const char* _p, size_t _n) override;
+            virtual void consume_parts(const std::string_view* _parts, size_t _count) override;
+          public:
+            explicit fd_writer(int _fd, size_t _capacity = 16 * 1024);
+            virtual ~fd_writer();
+            int fd()const { return m_fd; }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Hands each block to a user callback
+
+        class callback_writer : public buffered_writer {
+          public:
+            using callback = std::function<void(std::string_view)>;
+          private:
+            callback m_callback;
+          protected:
+            virtual void consume(const char* _p, size_t _n) override;
+          public:
+            explicit callback_writer(callback _cb, size_t _capacity = 16 * 1024);
+            virtual ~callback_writer();
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // Compatibility adapter for std::ostream
+
+        class ostream_writer : public buffered_writer {
+          private:
+            std::ostream& m_stream;
+          protected:
+            virtual void consume(const char* _p, size_t _n) override;
+          public:
+            explicit ostream_writer(std::ostream& _s, size_t _capacity = 16 * 1024);
+            virtual ~ostream_writer();
+        };
+
+}//html
+
+#endif
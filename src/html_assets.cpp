@@ -0,0 +1,191 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_assets.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+        // SHA-256 (FIPS 180-4)
+
+        namespace {
+            const std::uint32_t k_sha256[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+            };
+
+            inline std::uint32_t rotr(std::uint32_t _x, int _n) {
+                return (_x >> _n) | (_x << (32 - _n));
+            }
+
+            void sha256_block(std::uint32_t* _h, const unsigned char* _p) {
+                std::uint32_t w[64];
+                for(int i = 0; i < 16; i++) {
+                    w[i] = static_cast<std::uint32_t>(_p[i * 4]) << 24 | static_cast<std::uint32_t>(_p[i * 4 + 1]) << 16 |
+                           static_cast<std::uint32_t>(_p[i * 4 + 2]) << 8 | static_cast<std::uint32_t>(_p[i * 4 + 3]);
+                }
+                for(int i = 16; i < 64; i++) {
+                    std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                    std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+                std::uint32_t a = _h[0], b = _h[1], c = _h[2], d = _h[3];
+                std::uint32_t e = _h[4], f = _h[5], g = _h[6], h = _h[7];
+                for(int i = 0; i < 64; i++) {
+                    std::uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k_sha256[i] + w[i];
+                    std::uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                    h = g; g = f; f = e; e = d + t1;
+                    d = c; c = b; b = a; a = t1 + t2;
+                }
+                _h[0] += a; _h[1] += b; _h[2] += c; _h[3] += d;
+                _h[4] += e; _h[5] += f; _h[6] += g; _h[7] += h;
+            }
+        }
+
+        namespace detail {
+            std::array<std::uint8_t, 32> sha256(std::string_view _data) {
+                std::uint32_t h[8] = {
+                    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+                };
+                const unsigned char* p = reinterpret_cast<const unsigned char*>(_data.data());
+                size_t n = _data.size();
+                size_t full = n / 64;
+                for(size_t i = 0; i < full; i++) {
+                    sha256_block(h, p + i * 64);
+                }
+                // Padding: 0x80, zeros, 64-bit big-endian bit length
+                unsigned char tail[128] = {};
+                size_t rest = n - full * 64;
+                for(size_t i = 0; i < rest; i++) {
+                    tail[i] = p[full * 64 + i];
+                }
+                tail[rest] = 0x80;
+                size_t tail_len = rest < 56 ? 64 : 128;
+                std::uint64_t bits = static_cast<std::uint64_t>(n) * 8;
+                for(int i = 0; i < 8; i++) {
+                    tail[tail_len - 1 - i] = static_cast<unsigned char>(bits >> (i * 8));
+                }
+                sha256_block(h, tail);
+                if(tail_len == 128) {
+                    sha256_block(h, tail + 64);
+                }
+                std::array<std::uint8_t, 32> out;
+                for(int i = 0; i < 8; i++) {
+                    out[i * 4] = static_cast<std::uint8_t>(h[i] >> 24);
+                    out[i * 4 + 1] = static_cast<std::uint8_t>(h[i] >> 16);
+                    out[i * 4 + 2] = static_cast<std::uint8_t>(h[i] >> 8);
+                    out[i * 4 + 3] = static_cast<std::uint8_t>(h[i]);
+                }
+                return out;
+            }
+
+            std::string base64(const std::uint8_t* _p, size_t _n) {
+                static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                std::string s;
+                s.reserve((_n + 2) / 3 * 4);
+                size_t i = 0;
+                for(; i + 2 < _n; i += 3) {
+                    std::uint32_t v = static_cast<std::uint32_t>(_p[i]) << 16 | static_cast<std::uint32_t>(_p[i + 1]) << 8 | _p[i + 2];
+                    s += table[(v >> 18) & 63];
+                    s += table[(v >> 12) & 63];
+                    s += table[(v >> 6) & 63];
+                    s += table[v & 63];
+                }
+                if(i < _n) {
+                    std::uint32_t v = static_cast<std::uint32_t>(_p[i]) << 16;
+                    if(i + 1 < _n) {
+                        v |= static_cast<std::uint32_t>(_p[i + 1]) << 8;
+                    }
+                    s += table[(v >> 18) & 63];
+                    s += table[(v >> 12) & 63];
+                    s += (i + 1 < _n) ? table[(v >> 6) & 63] : '=';
+                    s += '=';
+                }
+                return s;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // publish_asset
+
+        namespace {
+            std::mutex s_assets_mutex;
+            std::map<std::string, asset_info> s_assets;
+
+            void write_asset_file(const std::filesystem::path& _path, std::string_view _content) {
+                namespace fs = std::filesystem;
+                std::error_code ec;
+                if(fs::exists(_path, ec) && fs::file_size(_path, ec) == _content.size()) {
+                    return;  // same name, same size: written before (the name is the hash)
+                }
+                // Write to a private temporary and rename, so readers never see a partial file
+                fs::path tmp = _path;
+                tmp += ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+                {
+                    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+                    out.write(_content.data(), static_cast<std::streamsize>(_content.size()));
+                    if(!out) {
+                        throw std::runtime_error("publish_asset: cannot write " + tmp.string());
+                    }
+                }
+                fs::rename(tmp, _path, ec);
+                if(ec) {
+                    fs::remove(tmp, ec);
+                    throw std::runtime_error("publish_asset: cannot create " + _path.string());
+                }
+            }
+        }
+
+        const asset_info& publish_asset(const std::string& _dir, std::string_view _stem,
+                                        std::string_view _ext, std::string_view _content) {
+            std::string key = _dir;
+            key += '\0';
+            key += _stem;
+            key += _ext;
+
+            std::lock_guard<std::mutex> lock(s_assets_mutex);
+            auto it = s_assets.find(key);
+            if(it != s_assets.end()) {
+                return it->second;
+            }
+
+            std::array<std::uint8_t, 32> digest = detail::sha256(_content);
+            static const char hex[] = "0123456789abcdef";
+            std::string short_hash;
+            for(int i = 0; i < 6; i++) {
+                short_hash += hex[digest[i] >> 4];
+                short_hash += hex[digest[i] & 15];
+            }
+
+            asset_info info;
+            info.file_name = std::string(_stem) + "." + short_hash + std::string(_ext);
+            info.integrity = "sha256-" + detail::base64(digest.data(), digest.size());
+
+            std::filesystem::path dir(_dir.empty() ? std::string(".") : _dir);
+            std::error_code ec;
+            std::filesystem::create_directories(dir, ec);
+            if(ec) {
+                throw std::runtime_error("publish_asset: cannot create directory " + dir.string());
+            }
+            write_asset_file(dir / info.file_name, _content);
+
+            return s_assets.emplace(std::move(key), std::move(info)).first->second;
+        }
+
+}
@@ -0,0 +1,520 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_css.h"
+#include "../include/html_core.h"
+#include "../include/html_gen_resources.h"
+#include <algorithm>
+
+namespace html {
+
+        namespace {
+            inline bool is_space(char _c) {
+                return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\r' || _c == '\f';
+            }
+
+            inline bool is_name_char(char _c) {
+                return (_c >= 'a' && _c <= 'z') || (_c >= 'A' && _c <= 'Z') || (_c >= '0' && _c <= '9') ||
+                       _c == '-' || _c == '_' || static_cast<unsigned char>(_c) >= 0x80;
+            }
+
+            inline bool is_hex(char _c) {
+                return (_c >= '0' && _c <= '9') || (_c >= 'a' && _c <= 'f') || (_c >= 'A' && _c <= 'F');
+            }
+
+            void append_utf8(std::string& _out, unsigned long _cp) {
+                if(_cp < 0x80) {
+                    _out += static_cast<char>(_cp);
+                } else if(_cp < 0x800) {
+                    _out += static_cast<char>(0xc0 | (_cp >> 6));
+                    _out += static_cast<char>(0x80 | (_cp & 0x3f));
+                } else if(_cp < 0x10000) {
+                    _out += static_cast<char>(0xe0 | (_cp >> 12));
+                    _out += static_cast<char>(0x80 | ((_cp >> 6) & 0x3f));
+                    _out += static_cast<char>(0x80 | (_cp & 0x3f));
+                } else {
+                    _out += static_cast<char>(0xf0 | (_cp >> 18));
+                    _out += static_cast<char>(0x80 | ((_cp >> 12) & 0x3f));
+                    _out += static_cast<char>(0x80 | ((_cp >> 6) & 0x3f));
+                    _out += static_cast<char>(0x80 | (_cp & 0x3f));
+                }
+            }
+
+            // CSS identifier starting at _p (escapes decoded); returns the end
+            size_t read_name(std::string_view _s, size_t _p, std::string& _out) {
+                while(_p < _s.size()) {
+                    char c = _s[_p];
+                    if(c == '\\' && _p + 1 < _s.size()) {
+                        _p++;
+                        if(is_hex(_s[_p])) {
+                            unsigned long cp = 0;
+                            for(int i = 0; i < 6 && _p < _s.size() && is_hex(_s[_p]); i++, _p++) {
+                                char h = _s[_p];
+                                cp = cp * 16 + static_cast<unsigned long>(h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+                            }
+                            if(_p < _s.size() && is_space(_s[_p])) {
+                                _p++;
+                            }
+                            append_utf8(_out, cp);
+                        } else {
+                            _out += _s[_p++];
+                        }
+                    } else if(is_name_char(c)) {
+                        _out += c;
+                        _p++;
+                    } else {
+                        break;
+                    }
+                }
+                return _p;
+            }
+
+            // Past a quoted string starting at _p
+            size_t skip_string(std::string_view _s, size_t _p) {
+                char q = _s[_p++];
+                while(_p < _s.size() && _s[_p] != q) {
+                    _p += (_s[_p] == '\\') ? 2 : 1;
+                }
+                return std::min(_p + 1, _s.size());
+            }
+
+            // Past a comment starting at _p ("/*")
+            size_t skip_comment(std::string_view _s, size_t _p) {
+                size_t e = _s.find("*/", _p + 2);
+                return e == std::string_view::npos ? _s.size() : e + 2;
+            }
+
+            // Past the bracket opened at _p; nested brackets, strings and comments skipped
+            size_t skip_balanced(std::string_view _s, size_t _p) {
+                int depth = 0;
+                while(_p < _s.size()) {
+                    char c = _s[_p];
+                    if(c == '"' || c == '\'') {
+                        _p = skip_string(_s, _p);
+                        continue;
+                    }
+                    if(c == '/' && _p + 1 < _s.size() && _s[_p + 1] == '*') {
+                        _p = skip_comment(_s, _p);
+                        continue;
+                    }
+                    if(c == '(' || c == '[' || c == '{') {
+                        depth++;
+                    } else if(c == ')' || c == ']' || c == '}') {
+                        if(--depth == 0) {
+                            return _p + 1;
+                        }
+                    }
+                    _p++;
+                }
+                return _p;
+            }
+
+            // First of _stops at bracket depth 0 from _p, or the end
+            size_t find_top_level(std::string_view _s, size_t _p, std::string_view _stops) {
+                while(_p < _s.size()) {
+                    char c = _s[_p];
+                    if(_stops.find(c) != std::string_view::npos) {
+                        return _p;
+                    }
+                    if(c == '"' || c == '\'') {
+                        _p = skip_string(_s, _p);
+                    } else if(c == '/' && _p + 1 < _s.size() && _s[_p + 1] == '*') {
+                        _p = skip_comment(_s, _p);
+                    } else if(c == '(' || c == '[') {
+                        _p = skip_balanced(_s, _p);
+                    } else {
+                        _p++;
+                    }
+                }
+                return _p;
+            }
+
+            // Names a complex selector (no top-level commas) requires: ".class",
+            // "#id" and type names. Anything inside :not()/:is()/[...] is ignored,
+            // which can only keep more rules, never fewer.
+            void selector_names(std::string_view _s, std::vector<std::string>& _out) {
+                bool compound_start = true;
+                size_t p = 0;
+                while(p < _s.size()) {
+                    char c = _s[p];
+                    if(is_space(c) || c == '>' || c == '+' || c == '~') {
+                        compound_start = true;
+                        p++;
+                    } else if(c == '.' || c == '#') {
+                        std::string name(1, c);
+                        p = read_name(_s, p + 1, name);
+                        if(name.size() > 1) {
+                            _out.push_back(std::move(name));
+                        }
+                        compound_start = false;
+                    } else if(c == '[') {
+                        p = skip_balanced(_s, p);
+                        compound_start = false;
+                    } else if(c == ':') {
+                        while(p < _s.size() && _s[p] == ':') {
+                            p++;
+                        }
+                        std::string pseudo;
+                        p = read_name(_s, p, pseudo);
+                        if(p < _s.size() && _s[p] == '(') {
+                            p = skip_balanced(_s, p);
+                        }
+                        compound_start = false;
+                    } else if(c == '/' && p + 1 < _s.size() && _s[p + 1] == '*') {
+                        p = skip_comment(_s, p);
+                    } else if(compound_start && (is_name_char(c) || c == '\\')) {
+                        std::string name;
+                        p = read_name(_s, p, name);
+                        for(auto& ch : name) {
+                            if(ch >= 'A' && ch <= 'Z') {
+                                ch = static_cast<char>(ch | 0x20);
+                            }
+                        }
+                        _out.push_back(std::move(name));
+                        compound_start = false;
+                    } else {
+                        // '*', '|', '&' ...
+                        compound_start = false;
+                        p++;
+                    }
+                }
+            }
+
+            bool is_group_rule(std::string_view _name) {
+                return _name == "media" || _name == "supports" || _name == "container" ||
+                       _name == "layer" || _name == "document" || _name == "-moz-document";
+            }
+
+            bool ends_with(std::string_view _s, std::string_view _suffix) {
+                return _s.size() >= _suffix.size() && _s.substr(_s.size() - _suffix.size()) == _suffix;
+            }
+
+            std::string_view trim(std::string_view _s) {
+                while(!_s.empty() && is_space(_s.front())) {
+                    _s.remove_prefix(1);
+                }
+                while(!_s.empty() && is_space(_s.back())) {
+                    _s.remove_suffix(1);
+                }
+                return _s;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // css_usage
+
+        void css_usage::add_class(std::string_view _names) {
+            size_t p = 0;
+            while(p < _names.size()) {
+                while(p < _names.size() && is_space(_names[p])) {
+                    p++;
+                }
+                size_t e = p;
+                while(e < _names.size() && !is_space(_names[e])) {
+                    e++;
+                }
+                if(e > p) {
+                    std::string key(1, '.');
+                    key.append(_names.data() + p, e - p);
+                    m_keys.insert(std::move(key));
+                }
+                p = e;
+            }
+        }
+
+        void css_usage::add_id(std::string_view _id) {
+            _id = trim(_id);
+            if(!_id.empty()) {
+                std::string key(1, '#');
+                key.append(_id.data(), _id.size());
+                m_keys.insert(std::move(key));
+            }
+        }
+
+        void css_usage::add_tag(std::string_view _tag) {
+            if(!_tag.empty()) {
+                std::string key(_tag);
+                for(auto& ch : key) {
+                    if(ch >= 'A' && ch <= 'Z') {
+                        ch = static_cast<char>(ch | 0x20);
+                    }
+                }
+                m_keys.insert(std::move(key));
+            }
+        }
+
+        void css_usage::collect(const element& _e) {
+            if(const raw_html* r = dynamic_cast<const raw_html*>(&_e)) {
+                collect_markup(r->content());
+                return;
+            }
+            if(const static_fragment* f = dynamic_cast<const static_fragment*>(&_e)) {
+                collect_markup(f->markup());
+                return;
+            }
+            if(const shared_subtree* t = dynamic_cast<const shared_subtree*>(&_e)) {
+                if(t->get()) {
+                    collect(*t->get());
+                }
+                return;
+            }
+            add_tag(_e.tag());
+            add_class(_e.m_attributes.get(class_attr));
+            add_id(_e.m_attributes.get(id_attr));
+            for(const auto& child : _e.m_elements) {
+                collect(*child);
+            }
+        }
+
+        void css_usage::collect_markup(std::string_view _html) {
+            size_t p = 0;
+            while((p = _html.find('<', p)) != std::string_view::npos) {
+                p++;
+                if(p >= _html.size() || !((_html[p] | 0x20) >= 'a' && (_html[p] | 0x20) <= 'z')) {
+                    continue;
+                }
+                size_t e = p;
+                while(e < _html.size() && is_name_char(_html[e])) {
+                    e++;
+                }
+                add_tag(_html.substr(p, e - p));
+                // Attributes up to the end of the tag
+                p = e;
+                while(p < _html.size() && _html[p] != '>') {
+                    if(is_space(_html[p])) {
+                        p++;
+                        continue;
+                    }
+                    size_t n = p;
+                    while(p < _html.size() && !is_space(_html[p]) && _html[p] != '=' && _html[p] != '>') {
+                        p++;
+                    }
+                    std::string_view name = _html.substr(n, p - n);
+                    if(p >= _html.size() || _html[p] != '=') {
+                        continue;
+                    }
+                    p++;
+                    std::string_view value;
+                    if(p < _html.size() && (_html[p] == '"' || _html[p] == '\'')) {
+                        size_t q = _html.find(_html[p], p + 1);
+                        if(q == std::string_view::npos) {
+                            q = _html.size();
+                        }
+                        value = _html.substr(p + 1, q - p - 1);
+                        p = std::min(q + 1, _html.size());
+                    } else {
+                        size_t v = p;
+                        while(p < _html.size() && !is_space(_html[p]) && _html[p] != '>') {
+                            p++;
+                        }
+                        value = _html.substr(v, p - v);
+                    }
+                    if(name == "class") {
+                        add_class(value);
+                    } else if(name == "id") {
+                        add_id(value);
+                    }
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // css_index
+
+        css_index::css_index(std::string_view _css)
+            :
+            m_css(_css) {
+            parse_list(0, false);
+            link_keyframes();
+        }
+
+        size_t css_index::parse_list(size_t _p, bool _nested) {
+            std::string_view s = m_css;
+            auto push = [this](item_kind _k, size_t _b, size_t _e) {
+                m_items.push_back(item{_k, false, static_cast<std::uint32_t>(_b), static_cast<std::uint32_t>(_e), 0, 0});
+            };
+            while(_p < s.size()) {
+                char c = s[_p];
+                if(is_space(c) || c == ';') {
+                    _p++;
+                    continue;
+                }
+                if(c == '/' && _p + 1 < s.size() && s[_p + 1] == '*') {
+                    size_t e = skip_comment(s, _p);
+                    // License comments ("/*! ... */") stay
+                    if(!_nested && _p + 2 < s.size() && s[_p + 2] == '!') {
+                        push(always_item, _p, e);
+                    }
+                    _p = e;
+                    continue;
+                }
+                if(c == '}') {
+                    if(_nested) {
+                        return _p;
+                    }
+                    _p++;
+                    continue;
+                }
+                if(c == '@') {
+                    std::string name;
+                    size_t n = read_name(s, _p + 1, name);
+                    size_t stop = find_top_level(s, n, ";{");
+                    if(stop >= s.size() || s[stop] == ';') {
+                        push(always_item, _p, std::min(stop + 1, s.size()));
+                        _p = stop + 1;
+                    } else if(is_group_rule(name)) {
+                        size_t open = m_items.size();
+                        push(group_open, _p, stop + 1);
+                        _p = parse_list(stop + 1, true);
+                        m_items[open].partner = static_cast<std::uint32_t>(m_items.size());
+                        push(group_close, _p, std::min(_p + 1, s.size()));
+                        _p++;
+                    } else {
+                        size_t e = skip_balanced(s, stop);
+                        push(ends_with(name, "keyframes") ? keyframes_item : always_item, _p, e);
+                        if(m_items.back().kind == keyframes_item) {
+                            m_items.back().body = static_cast<std::uint32_t>(n);
+                            m_items.back().partner = static_cast<std::uint32_t>(stop);
+                        }
+                        _p = e;
+                    }
+                    continue;
+                }
+                size_t brace = find_top_level(s, _p, "{}");
+                if(brace >= s.size() || s[brace] == '}') {
+                    // Selector without a block: nothing to keep
+                    _p = brace;
+                    continue;
+                }
+                size_t e = skip_balanced(s, brace);
+                add_rule(_p, brace, e);
+                _p = e;
+            }
+            return _p;
+        }
+
+        void css_index::add_rule(size_t _begin, size_t _brace, size_t _end) {
+            std::uint32_t index = static_cast<std::uint32_t>(m_items.size());
+            m_items.push_back(item{rule_item, false, static_cast<std::uint32_t>(_begin), static_cast<std::uint32_t>(_end),
+                                   static_cast<std::uint32_t>(_brace), 0});
+            std::string_view list = m_css.substr(_begin, _brace - _begin);
+            std::vector<std::string> names;
+            size_t p = 0;
+            while(p <= list.size()) {
+                size_t comma = find_top_level(list, p, ",");
+                names.clear();
+                selector_names(list.substr(p, comma - p), names);
+                std::sort(names.begin(), names.end());
+                names.erase(std::unique(names.begin(), names.end()), names.end());
+                if(names.empty()) {
+                    m_items[index].unconditional = true;
+                } else {
+                    std::uint32_t sel = static_cast<std::uint32_t>(m_selectors.size());
+                    m_selectors.push_back(selector{index, static_cast<std::uint32_t>(names.size())});
+                    for(auto& name : names) {
+                        m_postings[name].push_back(sel);
+                    }
+                }
+                p = comma + 1;
+            }
+        }
+
+        void css_index::link_keyframes() {
+            // A rule references a @keyframes if its declarations mention the name
+            for(std::uint32_t k = 0; k < m_items.size(); k++) {
+                if(m_items[k].kind != keyframes_item) {
+                    continue;
+                }
+                std::string_view name = trim(m_css.substr(m_items[k].body, m_items[k].partner - m_items[k].body));
+                if(name.empty()) {
+                    continue;
+                }
+                for(std::uint32_t r = 0; r < m_items.size(); r++) {
+                    const item& it = m_items[r];
+                    if(it.kind != rule_item) {
+                        continue;
+                    }
+                    std::string_view decl = m_css.substr(it.body, it.end - it.body);
+                    size_t p = 0;
+                    while((p = decl.find(name, p)) != std::string_view::npos) {
+                        size_t e = p + name.size();
+                        if((p == 0 || !is_name_char(decl[p - 1])) && (e >= decl.size() || !is_name_char(decl[e]))) {
+                            m_keyframe_refs.emplace_back(r, k);
+                            break;
+                        }
+                        p = e;
+                    }
+                }
+            }
+        }
+
+        size_t css_index::rule_count()const {
+            return static_cast<size_t>(std::count_if(m_items.begin(), m_items.end(),
+                                                     [](const item& _i) { return _i.kind == rule_item; }));
+        }
+
+        void css_index::write(writer& _w, const css_usage& _u)const {
+            std::vector<char> kept(m_items.size(), 0);
+            for(size_t i = 0; i < m_items.size(); i++) {
+                const item& it = m_items[i];
+                kept[i] = it.kind == always_item || (it.kind == rule_item && it.unconditional);
+            }
+            // Count the names each selector still needs; it matches at zero
+            std::vector<std::uint32_t> missing(m_selectors.size());
+            for(size_t i = 0; i < m_selectors.size(); i++) {
+                missing[i] = m_selectors[i].need;
+            }
+            for(const auto& key : _u.keys()) {
+                auto found = m_postings.find(key);
+                if(found == m_postings.end()) {
+                    continue;
+                }
+                for(std::uint32_t sel : found->second) {
+                    if(--missing[sel] == 0) {
+                        kept[m_selectors[sel].item] = 1;
+                    }
+                }
+            }
+            for(const auto& ref : m_keyframe_refs) {
+                if(kept[ref.first]) {
+                    kept[ref.second] = 1;
+                }
+            }
+            // Kept items before each position, for empty-wrapper checks
+            std::vector<std::uint32_t> before(m_items.size() + 1, 0);
+            for(size_t i = 0; i < m_items.size(); i++) {
+                before[i + 1] = before[i] + (kept[i] ? 1 : 0);
+            }
+            for(size_t i = 0; i < m_items.size(); i++) {
+                const item& it = m_items[i];
+                if(it.kind == group_open) {
+                    if(before[it.partner] == before[i + 1]) {
+                        i = it.partner;
+                        continue;
+                    }
+                } else if(it.kind != group_close && !kept[i]) {
+                    continue;
+                }
+                _w.write(m_css.substr(it.begin, it.end - it.begin));
+            }
+        }
+
+        std::string css_index::shake(const css_usage& _u)const {
+            std::string out;
+            {
+                string_writer w(out);
+                write(w, _u);
+            }
+            return out;
+        }
+
+        const css_index& css_index::bootstrap() {
+            static const css_index index(resources::bootstrap_css_view());
+            return index;
+        }
+
+}
@@ -0,0 +1,307 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_core.h"
+#include <algorithm>
+#include <cstring>
+
+#if !defined(HTML_GEN_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define HTML_ESCAPE_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+        // HTML escape
+        //
+        // Input is scanned for the next character that needs an entity; the
+        // clean run before it is block-copied and the entity appended. The scan
+        // is the hot part and has SSE2 / AVX2 variants, picked once at runtime.
+        // The same scan backs writer::write_escaped, which renders text nodes
+        // and attribute values without an intermediate string.
+
+        namespace {
+
+            // _quotes selects the attribute set (& < > " ') over the text set (& < >)
+            template<bool _quotes>
+            struct escape_table {
+                bool special[256];
+                constexpr escape_table() : special() {
+                    special[static_cast<unsigned char>('&')] = true;
+                    special[static_cast<unsigned char>('<')] = true;
+                    special[static_cast<unsigned char>('>')] = true;
+                    special[static_cast<unsigned char>('"')] = _quotes;
+                    special[static_cast<unsigned char>('\'')] = _quotes;
+                }
+            };
+            template<bool _quotes>
+            constexpr escape_table<_quotes> s_escape;
+
+            template<bool _quotes>
+            const char* find_special_scalar(const char* _p, const char* _end) {
+                while(_p < _end && !s_escape<_quotes>.special[static_cast<unsigned char>(*_p)]) {
+                    ++_p;
+                }
+                return _p;
+            }
+
+#ifdef HTML_ESCAPE_X86
+            inline unsigned first_bit(unsigned _mask) {
+#ifdef _MSC_VER
+                unsigned long idx;
+                _BitScanForward(&idx, _mask);
+                return static_cast<unsigned>(idx);
+#else
+                return static_cast<unsigned>(__builtin_ctz(_mask));
+#endif
+            }
+
+            template<bool _quotes>
+            const char* find_special_sse2(const char* _p, const char* _end) {
+                const __m128i amp = _mm_set1_epi8('&');
+                const __m128i lt = _mm_set1_epi8('<');
+                const __m128i gt = _mm_set1_epi8('>');
+                const __m128i dq = _mm_set1_epi8('"');
+                const __m128i sq = _mm_set1_epi8('\'');
+                while(_end - _p >= 16) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_p));
+                    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, lt)),
+                                             _mm_cmpeq_epi8(v, gt));
+                    if constexpr(_quotes) {
+                        m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, dq), _mm_cmpeq_epi8(v, sq)));
+                    }
+                    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(m));
+                    if(mask != 0) {
+                        return _p + first_bit(mask);
+                    }
+                    _p += 16;
+                }
+                return find_special_scalar<_quotes>(_p, _end);
+            }
+
+            template<bool _quotes>
+#ifndef _MSC_VER
+            __attribute__((target("avx2")))
+#endif
+            const char* find_special_avx2(const char* _p, const char* _end) {
+                const __m256i amp = _mm256_set1_epi8('&');
+                const __m256i lt = _mm256_set1_epi8('<');
+                const __m256i gt = _mm256_set1_epi8('>');
+                const __m256i dq = _mm256_set1_epi8('"');
+                const __m256i sq = _mm256_set1_epi8('\'');
+                while(_end - _p >= 32) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_p));
+                    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, amp), _mm256_cmpeq_epi8(v, lt)),
+                                                _mm256_cmpeq_epi8(v, gt));
+                    if constexpr(_quotes) {
+                        m = _mm256_or_si256(m, _mm256_or_si256(_mm256_cmpeq_epi8(v, dq), _mm256_cmpeq_epi8(v, sq)));
+                    }
+                    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(m));
+                    if(mask != 0) {
+                        return _p + first_bit(mask);
+                    }
+                    _p += 32;
+                }
+                return find_special_sse2<_quotes>(_p, _end);
+            }
+
+            bool cpu_has_avx2() {
+#ifdef _MSC_VER
+                int info[4];
+                __cpuid(info, 0);
+                if(info[0] < 7) {
+                    return false;
+                }
+                __cpuid(info, 1);
+                // OSXSAVE + AVX, then check the OS saves YMM state
+                if((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+                    return false;
+                }
+                if((_xgetbv(0) & 0x6) != 0x6) {
+                    return false;
+                }
+                __cpuidex(info, 7, 0);
+                return (info[1] & (1 << 5)) != 0;
+#else
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2");
+#endif
+            }
+#endif
+
+            using find_fn = const char* (*)(const char*, const char*);
+
+            struct escape_impl {
+                find_fn find_attr;
+                find_fn find_text;
+                const char* name;
+            };
+
+            escape_impl select_escape_impl() {
+#ifdef HTML_ESCAPE_X86
+                if(cpu_has_avx2()) {
+                    return { find_special_avx2<true>, find_special_avx2<false>, "avx2" };
+                }
+                return { find_special_sse2<true>, find_special_sse2<false>, "sse2" };
+#else
+                return { find_special_scalar<true>, find_special_scalar<false>, "scalar" };
+#endif
+            }
+
+            const escape_impl& active_escape_impl() {
+                static const escape_impl impl = select_escape_impl();
+                return impl;
+            }
+
+            inline std::string_view entity(char _c) {
+                switch(_c) {
+                    case '&':  return std::string_view("&amp;", 5);
+                    case '<':  return std::string_view("&lt;", 4);
+                    case '>':  return std::string_view("&gt;", 4);
+                    case '"':  return std::string_view("&quot;", 6);
+                    default:   return std::string_view("&#39;", 5);
+                }
+            }
+
+            void escape_with(find_fn _find, std::string_view _in, std::string& _out) {
+                const char* p = _in.data();
+                const char* end = p + _in.size();
+                const char* hit = _find(p, end);
+                if(hit == end) {
+                    // Nothing to escape: one block copy
+                    _out.append(p, _in.size());
+                    return;
+                }
+                // Write through a raw cursor into spare room at the end of _out,
+                // growing it geometrically, and trim once at the end
+                size_t used = _out.size();
+                _out.resize(used + _in.size() + _in.size() / 8 + 16);
+                char* q = _out.data() + used;
+                char* qend = _out.data() + _out.size();
+                while(true) {
+                    size_t run = static_cast<size_t>(hit - p);
+                    if(static_cast<size_t>(qend - q) < run + 6) {
+                        size_t at = static_cast<size_t>(q - _out.data());
+                        _out.resize(std::max(_out.size() * 2, at + run + 6 + (end - hit)));
+                        q = _out.data() + at;
+                        qend = _out.data() + _out.size();
+                    }
+                    std::memcpy(q, p, run);
+                    q += run;
+                    if(hit == end) {
+                        break;
+                    }
+                    std::string_view e = entity(*hit);
+                    std::memcpy(q, e.data(), e.size());
+                    q += e.size();
+                    p = hit + 1;
+                    hit = _find(p, end);
+                }
+                _out.resize(static_cast<size_t>(q - _out.data()));
+            }
+
+            void escape_with(find_fn _find, std::string_view _in, writer& _w) {
+                const char* p = _in.data();
+                const char* end = p + _in.size();
+                while(true) {
+                    const char* hit = _find(p, end);
+                    _w.write(p, static_cast<size_t>(hit - p));
+                    if(hit == end) {
+                        break;
+                    }
+                    _w.write(entity(*hit));
+                    p = hit + 1;
+                }
+            }
+
+            bool iequals_ascii(const char* _p, const char* _end, std::string_view _lower) {
+                if(static_cast<size_t>(_end - _p) < _lower.size()) {
+                    return false;
+                }
+                for(size_t i = 0; i < _lower.size(); i++) {
+                    char c = _p[i];
+                    if(c >= 'A' && c <= 'Z') {
+                        c = static_cast<char>(c - 'A' + 'a');
+                    }
+                    if(c != _lower[i]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // Raw text elements cannot carry entities; the only thing to prevent
+            // is the content closing the element early (or opening a comment in
+            // script). "</script" becomes "<\/script", "<!--" becomes "<\!--".
+            void escape_raw_text(std::string_view _in, writer& _w, std::string_view _end_tag, bool _comment) {
+                const char* p = _in.data();
+                const char* end = p + _in.size();
+                const char* run = p;
+                while(true) {
+                    const char* lt = static_cast<const char*>(std::memchr(p, '<', static_cast<size_t>(end - p)));
+                    if(lt == nullptr) {
+                        break;
+                    }
+                    const char* next = lt + 1;
+                    if(next < end && *next == '/' && iequals_ascii(next + 1, end, _end_tag)) {
+                        _w.write(run, static_cast<size_t>(next - run));
+                        _w.put('\\');
+                        run = next;
+                    } else if(_comment && iequals_ascii(next, end, "!--")) {
+                        _w.write(run, static_cast<size_t>(next - run));
+                        _w.put('\\');
+                        run = next;
+                    }
+                    p = next;
+                }
+                _w.write(run, static_cast<size_t>(end - run));
+            }
+
+        }
+
+        void html_escape(std::string_view _input, std::string& _out) {
+            escape_with(active_escape_impl().find_attr, _input, _out);
+        }
+
+        std::string html_escape(std::string_view _input) {
+            std::string result;
+            html_escape(_input, result);
+            return result;
+        }
+
+        namespace detail {
+            void html_escape_scalar(std::string_view _input, std::string& _out) {
+                escape_with(find_special_scalar<true>, _input, _out);
+            }
+
+            const char* html_escape_impl() {
+                return active_escape_impl().name;
+            }
+
+            void write_escaped(writer& _w, std::string_view _s, escape_context _ctx) {
+                switch(_ctx) {
+                    case escape_context::text:
+                        escape_with(active_escape_impl().find_text, _s, _w);
+                        break;
+                    case escape_context::attribute:
+                        escape_with(active_escape_impl().find_attr, _s, _w);
+                        break;
+                    case escape_context::script:
+                        escape_raw_text(_s, _w, "script", true);
+                        break;
+                    case escape_context::style:
+                        escape_raw_text(_s, _w, "style", false);
+                        break;
+                }
+            }
+        }
+
+}
@@ -0,0 +1,481 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_gen.h"
+#include <array>
+
+namespace html {
+
+        namespace {
+            // An element as its constructors with content leave it
+            template<typename T>
+            T sample() {
+                if constexpr (std::is_constructible_v<T, element&&>) {
+                    return T(html::text());
+                } else if constexpr (std::is_constructible_v<T, const std::string&>) {
+                    return T(std::string());
+                } else {
+                    return T();
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // flat_node
+
+        flat_node flat_node::parent()const {
+            return flat_node(m_doc, m_doc->m_nodes[m_index].parent);
+        }
+
+        flat_node flat_node::add(element_t _type) {
+            return flat_node(m_doc, m_doc->append(m_index, flat_document::element_node, _type, flat_document::defaults(_type)));
+        }
+
+        flat_node flat_node::add(element_t _type, std::string_view _text) {
+            flat_node n = add(_type);
+            n.text(_text);
+            return n;
+        }
+
+        flat_node& flat_node::text(std::string_view _s) {
+            std::uint32_t begin = m_doc->store(_s);
+            std::uint32_t n = m_doc->append(m_index, flat_document::text_node, text_t, 0);
+            m_doc->m_nodes[n].text_begin = begin;
+            m_doc->m_nodes[n].text_size = static_cast<std::uint32_t>(_s.size());
+            return *this;
+        }
+
+        flat_node& flat_node::raw(std::string_view _s) {
+            std::uint32_t begin = m_doc->store(_s);
+            std::uint32_t n = m_doc->append(m_index, flat_document::raw_node, text_t, 0);
+            m_doc->m_nodes[n].text_begin = begin;
+            m_doc->m_nodes[n].text_size = static_cast<std::uint32_t>(_s.size());
+            return *this;
+        }
+
+        flat_node& flat_node::attr(std::string_view _name, std::string_view _value) {
+            return attr(attribute_list::intern(_name), _value);
+        }
+
+        flat_node& flat_node::attr(attr_id _id, std::string_view _value) {
+            // Same order as attribute_list: dedicated ids sorted first, generic
+            // ones in insertion order, a second set replaces the value in place
+            auto& attrs = m_doc->m_attrs;
+            flat_document::node& n = m_doc->m_nodes[m_index];
+            if(n.kind != flat_document::element_node || m_index == 0) {
+                throw std::runtime_error("flat_document: attributes need an element node");
+            }
+            std::uint32_t begin = m_doc->store(_value);
+            std::uint32_t size = static_cast<std::uint32_t>(_value.size());
+            for(std::uint32_t c = 0; c < n.attr_count; c++) {
+                if(attrs[n.attr_begin + c].id == _id) {
+                    attrs[n.attr_begin + c].value_begin = begin;
+                    attrs[n.attr_begin + c].value_size = size;
+                    return *this;
+                }
+            }
+            if(n.attr_count == 0) {
+                n.attr_begin = static_cast<std::uint32_t>(attrs.size());
+            } else if(n.attr_begin + n.attr_count != attrs.size()) {
+                // Another node appended after this span: move the span to the end
+                std::uint32_t from = n.attr_begin;
+                attrs.reserve(attrs.size() + n.attr_count + 1);
+                n.attr_begin = static_cast<std::uint32_t>(attrs.size());
+                for(std::uint32_t c = 0; c < n.attr_count; c++) {
+                    attrs.push_back(attrs[from + c]);
+                }
+            }
+            std::uint32_t pos = n.attr_count;
+            if(_id < first_generic_attr) {
+                pos = 0;
+                while(pos < n.attr_count && attrs[n.attr_begin + pos].id < _id) {
+                    ++pos;
+                }
+            }
+            attrs.insert(attrs.begin() + n.attr_begin + pos, flat_document::attribute{_id, begin, size});
+            n.attr_count++;
+            return *this;
+        }
+
+        flat_node& flat_node::data(std::string_view _name, std::string_view _value) {
+            std::string name("data-");
+            name += _name;
+            return attr(name, _value);
+        }
+
+        /////////////////////////////////////////////////////////////
+        // flat_document
+
+        flat_document::flat_document() {
+            clear();
+        }
+
+        flat_document::flat_document(const element& _e) {
+            clear();
+            append_element(0, _e, escape_context::text);
+        }
+
+        void flat_document::clear() {
+            m_nodes.clear();
+            m_attrs.clear();
+            m_chars.clear();
+            m_nodes.push_back(node{undefined_t, element_node, 0, npos, npos, npos, npos, 0, 0, 0, 0});
+            m_preorder = true;
+        }
+
+        void flat_document::reserve(size_t _nodes, size_t _chars) {
+            m_nodes.reserve(_nodes);
+            m_chars.reserve(_chars);
+        }
+
+        std::uint32_t flat_document::store(std::string_view _s) {
+            if(m_chars.size() + _s.size() >= npos) {
+                throw std::runtime_error("flat_document: character buffer exceeds 4 GB");
+            }
+            std::uint32_t begin = static_cast<std::uint32_t>(m_chars.size());
+            m_chars.append(_s);
+            return begin;
+        }
+
+        std::uint32_t flat_document::append(std::uint32_t _parent, node_kind _kind, element_t _type, std::uint8_t _flags) {
+            if(m_nodes[_parent].kind != element_node) {
+                throw std::runtime_error("flat_document: text nodes have no children");
+            }
+            if(_kind == element_node &&
+               (_type >= element_type_count || detail::tag_table[_type].name.empty())) {
+                throw std::runtime_error("flat_document: element type without a tag");
+            }
+            std::uint32_t n = static_cast<std::uint32_t>(m_nodes.size());
+            if(m_preorder) {
+                // Still in document order if _parent is the last node or one of its ancestors
+                std::uint32_t p = n - 1;
+                while(p != npos && p != _parent) {
+                    p = m_nodes[p].parent;
+                }
+                m_preorder = p == _parent;
+            }
+            m_nodes.push_back(node{_type, _kind, _flags, _parent, npos, npos, npos, 0, 0, 0, 0});
+            node& parent = m_nodes[_parent];
+            if(parent.last_child == npos) {
+                parent.first_child = n;
+            } else {
+                m_nodes[parent.last_child].next_sibling = n;
+            }
+            parent.last_child = n;
+            return n;
+        }
+
+        void flat_document::append(flat_node _parent, const element& _e) {
+            escape_context ctx = escape_context::text;
+            for(std::uint32_t p = _parent.index(); p != npos; p = m_nodes[p].parent) {
+                if(m_nodes[p].type == script_t || m_nodes[p].type == style_t) {
+                    ctx = m_nodes[p].type == script_t ? escape_context::script : escape_context::style;
+                    break;
+                }
+            }
+            append_element(_parent.index(), _e, ctx);
+        }
+
+        void flat_document::append_attributes(std::uint32_t _n, const element& _e) {
+            m_nodes[_n].attr_begin = static_cast<std::uint32_t>(m_attrs.size());
+            m_nodes[_n].attr_count = static_cast<std::uint32_t>(_e.m_attributes.size());
+            for(const auto& a : _e.m_attributes) {
+                std::uint32_t begin = store(a.value());
+                m_attrs.push_back(attribute{a.id, begin, static_cast<std::uint32_t>(a.value().size())});
+            }
+        }
+
+        void flat_document::append_element(std::uint32_t _parent, const element& _e, escape_context _ctx) {
+            // Classes with their own write_html are mapped to what they write
+            if(auto r = dynamic_cast<const raw_html*>(&_e)) {
+                flat_node(this, _parent).raw(r->m_text);
+                if(r->m_newline_after_element) {
+                    m_nodes.back().flags = newline_after_element;
+                }
+                return;
+            }
+            if(auto t = dynamic_cast<const html::text*>(&_e)) {
+                flat_node(this, _parent).text(t->m_text);
+                if(t->m_newline_after_element) {
+                    m_nodes.back().flags = newline_after_element;
+                }
+                return;
+            }
+            if(auto f = dynamic_cast<const static_fragment*>(&_e)) {
+                flat_node(this, _parent).raw(f->markup());
+                return;
+            }
+            if(auto t = dynamic_cast<const shared_subtree*>(&_e)) {
+                if(t->get()) {
+                    append_element(_parent, *t->get(), _ctx);
+                }
+                return;
+            }
+            if(dynamic_cast<const element_group*>(&_e)) {
+                for(const auto& c : _e.m_elements) {
+                    append_child(_parent, c, _ctx);
+                }
+                return;
+            }
+            if(dynamic_cast<const br*>(&_e) || dynamic_cast<const hr*>(&_e)) {
+                // Written as a bare tag, attributes and flags ignored
+                append(_parent, element_node, _e.m_type, 0);
+                return;
+            }
+            if(dynamic_cast<const html::page*>(&_e) || dynamic_cast<const slot*>(&_e)) {
+                // Rendered once, in the context it would be written in
+                std::string s;
+                {
+                    string_writer w(s);
+                    w.context(_ctx);
+                    const_cast<element&>(_e).write_html(w);
+                }
+                flat_node(this, _parent).raw(s);
+                return;
+            }
+
+            std::uint8_t flags = (_e.m_has_closing_tag ? closing_tag : 0) |
+                                 (_e.m_newline_after_tag ? newline_after_tag : 0) |
+                                 (_e.m_newline_after_element ? newline_after_element : 0);
+            std::uint32_t n = append(_parent, element_node, _e.m_type, flags);
+            append_attributes(n, _e);
+            if(_e.m_type == script_t) {
+                _ctx = escape_context::script;
+            } else if(_e.m_type == style_t) {
+                _ctx = escape_context::style;
+            }
+            if(auto t = dynamic_cast<const table*>(&_e)) {
+                if(t->caption.size()) {
+                    append_element(n, t->caption, _ctx);
+                }
+                if(t->thead.size()) {
+                    append_element(n, t->thead, _ctx);
+                }
+                if(t->tbody.size()) {
+                    append_element(n, t->tbody, _ctx);
+                } else {
+                    for(const auto& c : _e.m_elements) {
+                        append_child(n, c, _ctx);
+                    }
+                }
+                if(t->tfoot.size()) {
+                    append_element(n, t->tfoot, _ctx);
+                }
+                return;
+            }
+            for(const auto& c : _e.m_elements) {
+                append_child(n, c, _ctx);
+            }
+        }
+
+        void flat_document::append_child(std::uint32_t _parent, const detail::child& _c, escape_context _ctx) {
+            if(!_c.is_run()) {
+                append_element(_parent, *_c, _ctx);
+                return;
+            }
+            if(_c.is_raw()) {
+                flat_node(this, _parent).raw(_c.text());
+            } else {
+                flat_node(this, _parent).text(_c.text());
+            }
+            if(_c.is_newline()) {
+                m_nodes.back().flags = newline_after_element;
+            }
+        }
+
+        std::string_view flat_document::attr(std::uint32_t _index, attr_id _id)const {
+            const node& n = m_nodes.at(_index);
+            for(std::uint32_t c = 0; c < n.attr_count; c++) {
+                if(m_attrs[n.attr_begin + c].id == _id) {
+                    return value(m_attrs[n.attr_begin + c]);
+                }
+            }
+            return std::string_view();
+        }
+
+        /////////////////////////////////////////////////////////////
+        // Output, the same bytes element::write_html produces
+
+        void flat_document::write_open(writer& _w, const node& _n)const {
+            _w.write(detail::tag_table[_n.type].open);
+            for(std::uint32_t c = 0; c < _n.attr_count; c++) {
+                const attribute& a = m_attrs[_n.attr_begin + c];
+                if(a.value_size == 0 && a.id < first_generic_attr) {
+                    continue;
+                }
+                _w << " " << attribute_list::name(a.id) << "=\"";
+                _w.write_escaped(value(a), escape_context::attribute);
+                _w << '"';
+            }
+            _w << ">";
+            if(_n.flags & newline_after_tag) {
+                _w << '\n';
+            }
+        }
+
+        void flat_document::write_close(writer& _w, const node& _n)const {
+            if(_n.flags & closing_tag) {
+                _w.write(detail::tag_table[_n.type].close);
+            }
+            if(_n.flags & newline_after_element) {
+                _w << '\n';
+            }
+        }
+
+        void flat_document::write_leaf(writer& _w, const node& _n)const {
+            if(_n.kind == raw_node) {
+                _w << text(_n);
+            } else {
+                _w.write_escaped(text(_n));
+            }
+            if(_n.flags & newline_after_element) {
+                _w << '\n';
+            }
+        }
+
+        void flat_document::write_html(writer& _w)const {
+            struct open_element {
+                std::uint32_t index;
+                escape_context context;     // to restore after a script / style
+            };
+            std::vector<open_element> open;
+            auto enter = [&](std::uint32_t _i) {
+                const node& n = m_nodes[_i];
+                if(n.kind != element_node) {
+                    write_leaf(_w, n);
+                    return false;
+                }
+                write_open(_w, n);
+                open.push_back(open_element{_i, _w.context()});
+                if(n.type == script_t) {
+                    _w.context(escape_context::script);
+                } else if(n.type == style_t) {
+                    _w.context(escape_context::style);
+                }
+                return true;
+            };
+            auto leave = [&]() {
+                _w.context(open.back().context);
+                write_close(_w, m_nodes[open.back().index]);
+                open.pop_back();
+            };
+
+            if(m_preorder) {
+                // Nodes are in document order: one pass over the array
+                for(std::uint32_t i = 1; i < m_nodes.size(); i++) {
+                    while(!open.empty() && open.back().index != m_nodes[i].parent) {
+                        leave();
+                    }
+                    enter(i);
+                }
+                while(!open.empty()) {
+                    leave();
+                }
+                return;
+            }
+
+            // Built out of order: follow the child / sibling links
+            std::uint32_t i = m_nodes[0].first_child;
+            while(i != npos) {
+                if(enter(i) && m_nodes[i].first_child != npos) {
+                    i = m_nodes[i].first_child;
+                    continue;
+                }
+                if(m_nodes[i].kind == element_node) {
+                    leave();
+                }
+                while(m_nodes[i].next_sibling == npos && m_nodes[i].parent != 0) {
+                    i = m_nodes[i].parent;
+                    leave();
+                }
+                i = m_nodes[i].next_sibling;
+            }
+        }
+
+        std::string flat_document::html()const {
+            std::string s;
+            {
+                string_writer w(s);
+                write_html(w);
+            }
+            return s;
+        }
+
+        /////////////////////////////////////////////////////////////
+        // Conversion to elements
+
+        void flat_document::build(element& _parent, std::uint32_t _n)const {
+            for(std::uint32_t c = m_nodes[_n].first_child; c != npos; c = m_nodes[c].next_sibling) {
+                const node& n = m_nodes[c];
+                if(n.kind == text_node || n.kind == raw_node) {
+                    _parent.add_run(text(n), n.kind == raw_node, (n.flags & newline_after_element) != 0);
+                    continue;
+                }
+                element e;
+                e.m_type = n.type;
+                e.m_has_closing_tag = (n.flags & closing_tag) != 0;
+                e.m_is_container = e.m_has_closing_tag;
+                e.m_newline_after_tag = (n.flags & newline_after_tag) != 0;
+                e.m_newline_after_element = (n.flags & newline_after_element) != 0;
+                for(std::uint32_t a = 0; a < n.attr_count; a++) {
+                    const attribute& at = m_attrs[n.attr_begin + a];
+                    e.m_attributes.set(at.id, value(at));
+                }
+                _parent.add(std::move(e));
+                build(*_parent.m_elements.back(), c);
+            }
+        }
+
+        element_group flat_document::to_element()const {
+            element_group g;
+            build(g, 0);
+            return g;
+        }
+
+        /////////////////////////////////////////////////////////////
+
+        std::uint8_t flat_document::defaults(element_t _type) {
+            static const std::array<std::uint8_t, shared_subtree_t + 1> type_flags = [] {
+                std::array<std::uint8_t, shared_subtree_t + 1> t;
+                t.fill(0xff);
+                auto record = [&t](const element& _e) {
+                    if(t[_e.m_type] == 0xff) {
+                        t[_e.m_type] = (_e.m_has_closing_tag ? closing_tag : 0) |
+                                       (_e.m_newline_after_tag ? newline_after_tag : 0) |
+                                       (_e.m_newline_after_element ? newline_after_element : 0);
+                    }
+                };
+                record(sample<html::body>()); record(sample<html::head>()); record(sample<html::title>());
+                record(sample<div>()); record(sample<nav>()); record(sample<span>()); record(sample<p>());
+                record(sample<h1>()); record(sample<h2>()); record(sample<h3>()); record(sample<h4>()); record(sample<h5>()); record(sample<h6>());
+                record(sample<em>()); record(sample<strong>()); record(sample<b>()); record(sample<small_>());
+                record(sample<ul>()); record(sample<ol>()); record(sample<li>()); record(sample<textarea>()); record(sample<br>()); record(sample<hr>());
+                record(sample<table>()); record(sample<tr>()); record(sample<td>()); record(sample<th>()); record(sample<tbody>()); record(sample<thead>());
+                record(sample<tfoot>()); record(sample<caption>()); record(sample<colgroup>()); record(sample<col>());
+                record(sample<form>()); record(sample<input>()); record(sample<button>()); record(sample<select>()); record(sample<option>());
+                record(sample<label>()); record(sample<fieldset>()); record(sample<legend>()); record(sample<datalist>()); record(sample<output>());
+                record(sample<optgroup>()); record(sample<progress>()); record(sample<meter>());
+                record(sample<header>()); record(sample<footer>()); record(sample<section>()); record(sample<article>()); record(sample<aside>());
+                record(sample<main>()); record(sample<figure>()); record(sample<figcaption>());
+                record(sample<time_>()); record(sample<mark>()); record(sample<code>()); record(sample<pre>()); record(sample<kbd>()); record(sample<samp>());
+                record(sample<var>()); record(sample<blockquote>()); record(sample<q>()); record(sample<abbr>()); record(sample<cite_>()); record(sample<dfn>());
+                record(sample<address>()); record(sample<sub>()); record(sample<sup>()); record(sample<ins>()); record(sample<del>()); record(sample<s>()); record(sample<u>());
+                record(sample<video>()); record(sample<audio>()); record(sample<source>()); record(sample<picture>()); record(sample<track>());
+                record(sample<iframe>()); record(sample<canvas>());
+                record(sample<details>()); record(sample<summary>()); record(sample<dialog>()); record(sample<template_>());
+                record(sample<script>()); record(sample<style>()); record(sample<img>()); record(sample<link>()); record(sample<meta>()); record(sample<anchor>());
+                for(auto& f : t) {
+                    if(f == 0xff) {
+                        f = closing_tag;    // plain element defaults
+                    }
+                }
+                return t;
+            }();
+            return _type <= shared_subtree_t ? type_flags[_type] : closing_tag;
+        }
+
+}//html
@@ -7,6 +7,15 @@
 
 #include "../include/html_gen.h"
 #include "../include/html_gen_resources.h"
+#include "../include/html_assets.h"
+#include "../include/html_css.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 
 namespace html {
 
@@ -14,134 +23,410 @@ namespace html {
         // Thread-local page context for implicit dependency registration
         namespace detail {
             thread_local page* current_page = nullptr;
+            thread_local std::pmr::memory_resource* current_resource = nullptr;
+            // Resources of the open arena_scopes, innermost last
+            thread_local std::vector<std::pmr::memory_resource*> resource_stack;
+
+            // Drop the innermost entry for _res, wherever it is in the stack
+            static void pop_resource(std::pmr::memory_resource* _res) {
+                for (auto it = resource_stack.rbegin(); it != resource_stack.rend(); ++it) {
+                    if (*it == _res) {
+                        resource_stack.erase(std::next(it).base());
+                        break;
+                    }
+                }
+                current_resource = resource_stack.empty() ? nullptr : resource_stack.back();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // attribute_list
+
+        attribute_list::attribute_list(std::pmr::memory_resource* _res)
+            :
+            m_entries(_res) {
+            ;
+        }
+
+        void attribute_list::copy(const attribute_list& _other) {
+            std::pmr::memory_resource* res = m_entries.get_allocator().resource();
+            m_entries.clear();
+            m_entries.reserve(_other.m_entries.size());
+            for(const auto& a : _other.m_entries) {
+                // Borrowed values stay borrowed
+                m_entries.push_back(entry{a.id, a.check, std::pmr::string(a.text, res), a.ref});
+            }
+        }
+
+        std::string_view attribute_list::get(attr_id _id)const {
+            for(const auto& a : m_entries) {
+                if(a.id == _id) {
+                    return a.value();
+                }
+            }
+            return std::string_view();
+        }
+
+        bool attribute_list::has(attr_id _id)const {
+            for(const auto& a : m_entries) {
+                if(a.id == _id) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::pmr::string* attribute_list::find(attr_id _id) {
+            for(auto& a : m_entries) {
+                if(a.id == _id) {
+                    if(a.ref.data()) {
+                        // Edited in place: take a copy of the borrowed value
+                        a.text.assign(a.ref);
+                        a.ref = std::string_view();
+                        a.check = 0;
+                    }
+                    return &a.text;
+                }
+            }
+            return nullptr;
+        }
+
+        std::pmr::string& attribute_list::ensure(attr_id _id) {
+            if(std::pmr::string* v = find(_id)) {
+                return *v;
+            }
+            return slot(_id).text;
+        }
+
+        attribute_list::entry& attribute_list::slot(attr_id _id) {
+            for(auto& a : m_entries) {
+                if(a.id == _id) {
+                    return a;
+                }
+            }
+            auto it = m_entries.end();
+            if(_id < first_generic_attr) {
+                // dedicated attributes stay sorted ahead of the generic ones
+                it = m_entries.begin();
+                while(it != m_entries.end() && it->id < _id) {
+                    ++it;
+                }
+            }
+            it = m_entries.insert(it, entry{_id, 0, std::pmr::string(m_entries.get_allocator().resource()), std::string_view()});
+            return *it;
+        }
+
+        void attribute_list::set(attr_id _id, std::string_view _value) {
+            entry& e = slot(_id);
+            e.text.assign(_value);
+            e.ref = std::string_view();
+            e.check = 0;
+        }
+
+        void attribute_list::borrow(attr_id _id, std::string_view _value) {
+            entry& e = slot(_id);
+            if(!_value.data()) {
+                // Nothing to point at: an empty owned value
+                e.text.clear();
+                e.ref = std::string_view();
+                e.check = 0;
+                return;
+            }
+            e.ref = _value;
+            e.text.clear();
+            e.check = 0;
+#ifndef NDEBUG
+            e.check = detail::borrow_check(_value);
+#endif
+        }
+
+        void attribute_list::remove(attr_id _id) {
+            for(auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+                if(it->id == _id) {
+                    m_entries.erase(it);
+                    return;
+                }
+            }
+        }
+
+        namespace {
+            constexpr std::string_view s_dedicated_attr_names[first_generic_attr] = {
+                "", "id", "data-id", "class", "type", "role", "style",
+                "src", "alt", "width", "height", "href", "rel"
+            };
+
+            // Generic names live in fixed-size chunks that are published once and
+            // never move, so name() can read them without taking the lock.
+            constexpr size_t s_attr_chunk_size = 256;
+            constexpr size_t s_attr_chunk_count = (65536 - first_generic_attr) / s_attr_chunk_size;
+
+            struct attr_name_chunk {
+                std::string names[s_attr_chunk_size];
+            };
+
+            struct attr_name_table {
+                std::shared_mutex mutex;
+                std::map<std::string, attr_id, std::less<>> ids;
+                std::atomic<attr_name_chunk*> chunks[s_attr_chunk_count] = {};
+                size_t next = first_generic_attr;
+
+                attr_name_table() {
+                    for(size_t c = 1; c < first_generic_attr; c++) {
+                        ids.emplace(std::string(s_dedicated_attr_names[c]), static_cast<attr_id>(c));
+                    }
+                }
+                ~attr_name_table() {
+                    for(auto& c : chunks) {
+                        delete c.load();
+                    }
+                }
+            };
+
+            attr_name_table& attr_names() {
+                static attr_name_table table;
+                return table;
+            }
+        }
+
+        attr_id attribute_list::intern(std::string_view _name) {
+            attr_name_table& table = attr_names();
+            {
+                std::shared_lock<std::shared_mutex> lock(table.mutex);
+                auto it = table.ids.find(_name);
+                if(it != table.ids.end()) {
+                    return it->second;
+                }
+            }
+            std::unique_lock<std::shared_mutex> lock(table.mutex);
+            auto it = table.ids.find(_name);
+            if(it != table.ids.end()) {
+                return it->second;
+            }
+            size_t idx = table.next - first_generic_attr;
+            if(idx >= s_attr_chunk_count * s_attr_chunk_size) {
+                throw std::runtime_error("too many distinct attribute names");
+            }
+            attr_name_chunk* chunk = table.chunks[idx / s_attr_chunk_size].load(std::memory_order_relaxed);
+            if(!chunk) {
+                chunk = new attr_name_chunk();
+                table.chunks[idx / s_attr_chunk_size].store(chunk, std::memory_order_release);
+            }
+            chunk->names[idx % s_attr_chunk_size] = std::string(_name);
+            attr_id id = static_cast<attr_id>(table.next++);
+            table.ids.emplace(std::string(_name), id);
+            return id;
+        }
+
+        std::string_view attribute_list::name(attr_id _id) {
+            if(_id < first_generic_attr) {
+                return s_dedicated_attr_names[_id];
+            }
+            // ids are only handed out after their name is stored
+            size_t idx = _id - first_generic_attr;
+            attr_name_chunk* chunk = attr_names().chunks[idx / s_attr_chunk_size].load(std::memory_order_acquire);
+            assert(chunk);
+            return chunk->names[idx % s_attr_chunk_size];
+        }
+
+        /////////////////////////////////////////////////////////////
+        // traversal
+
+        std::vector<detail::walk_frame>& detail::walk_stack() {
+            thread_local std::vector<walk_frame> stack;
+            return stack;
+        }
+
+        bool element::traverse(visitor& _v) {
+            return walk(*this, _v);
         }
 
         /////////////////////////////////////////////////////////////
-        // HTML escape utility implementation
-        std::string html_escape(std::string_view input) {
-            std::string result;
-            result.reserve(input.size() * 1.1); // Pre-allocate slightly larger
-            for (char c : input) {
-                switch (c) {
-                    case '&':  result += "&amp;";  break;
-                    case '<':  result += "&lt;";   break;
-                    case '>':  result += "&gt;";   break;
-                    case '"':  result += "&quot;"; break;
-                    case '\'': result += "&#39;";  break;
-                    default:   result += c;        break;
+        // tree_index
+
+        namespace detail {
+
+            namespace {
+                // Calls _f for each whitespace separated class name
+                template<typename F>
+                void for_each_class(std::string_view _list, F&& _f) {
+                    size_t p = 0;
+                    while(p < _list.size()) {
+                        while(p < _list.size() && std::isspace(static_cast<unsigned char>(_list[p]))) {
+                            p++;
+                        }
+                        size_t e = p;
+                        while(e < _list.size() && !std::isspace(static_cast<unsigned char>(_list[e]))) {
+                            e++;
+                        }
+                        if(e > p) {
+                            _f(_list.substr(p, e - p));
+                        }
+                        p = e;
+                    }
+                }
+            }
+
+            void tree_index::insert_id(std::string_view _id, element* _e) {
+                entry& en = m_ids[std::string(_id)];
+                if(en.count == 0) {
+                    en.first = _e;
+                } else if(en.count == 1) {
+                    m_duplicates.insert(std::string(_id));
+                }
+                en.count++;
+            }
+
+            void tree_index::erase_id(std::string_view _id, element* _e) {
+                auto it = m_ids.find(std::string(_id));
+                if(it == m_ids.end()) {
+                    return;
+                }
+                entry& en = it->second;
+                if(--en.count == 0) {
+                    m_ids.erase(it);
+                    return;
+                }
+                // The remaining holder is found by the next walk (see settle)
+                if(en.first == _e) {
+                    en.first = nullptr;
+                }
+                if(en.count == 1) {
+                    m_duplicates.erase(std::string(_id));
+                }
+            }
+
+            void tree_index::add(element* _e) {
+                std::string_view id = _e->id();
+                if(!id.empty()) {
+                    insert_id(id, _e);
+                }
+                size_t type = static_cast<size_t>(_e->m_type);
+                if(m_tags.size() <= type) {
+                    m_tags.resize(type + 1);
+                }
+                m_tags[type].insert(_e);
+                for_each_class(_e->cl(), [&](std::string_view _c) {
+                    m_classes[std::string(_c)].insert(_e);
+                });
+            }
+
+            void tree_index::remove(element* _e, const element& _values) {
+                std::string_view id = _values.id();
+                if(!id.empty()) {
+                    erase_id(id, _e);
+                }
+                size_t type = static_cast<size_t>(_values.m_type);
+                if(type < m_tags.size()) {
+                    m_tags[type].erase(_e);
+                }
+                for_each_class(_values.cl(), [&](std::string_view _c) {
+                    auto it = m_classes.find(std::string(_c));
+                    if(it != m_classes.end()) {
+                        it->second.erase(_e);
+                        if(it->second.empty()) {
+                            m_classes.erase(it);
+                        }
+                    }
+                });
+            }
+
+            void tree_index::attach(element& _e) {
+                struct attacher {
+                    tree_index* index;
+                    visitor::action enter(element& _n) {
+                        if(_n.m_index != index) {
+                            if(_n.m_index) {
+                                _n.m_index->remove(&_n);
+                            }
+                            _n.m_index = index;
+                            index->add(&_n);
+                        }
+                        for(auto& c : _n.m_elements) {
+                            if(!c.is_run()) {
+                                c->m_parent_ptr = &_n;
+                            }
+                        }
+                        return visitor::descend;
+                    }
+                    void leave(element&) { ; }
+                    visitor::action text(element& _n) { return enter(_n); }
+                    visitor::action run(const child&) { return visitor::descend; }
+                };
+                changed();
+                attacher a{this};
+                element::walk(_e, a);
+            }
+
+            void tree_index::detach(element& _e) {
+                struct detacher {
+                    tree_index* index;
+                    visitor::action enter(element& _n) {
+                        if(_n.m_index == index) {
+                            index->remove(&_n);
+                            _n.m_index = nullptr;
+                        }
+                        return visitor::descend;
+                    }
+                    void leave(element&) { ; }
+                    visitor::action text(element& _n) { return enter(_n); }
+                    visitor::action run(const child&) { return visitor::descend; }
+                };
+                changed();
+                detacher d{this};
+                element::walk(_e, d);
+            }
+
+            bool tree_index::lookup(const std::string& _id, element*& _e)const {
+                auto it = m_ids.find(_id);
+                if(it == m_ids.end()) {
+                    _e = nullptr;
+                    return true;
+                }
+                if(it->second.count == 1 && it->second.first) {
+                    _e = it->second.first;
+                    return true;
                 }
+                return false;
+            }
+
+            void tree_index::settle(const std::string& _id, element* _e) {
+                auto it = m_ids.find(_id);
+                if(it != m_ids.end() && it->second.count == 1) {
+                    it->second.first = _e;
+                }
+            }
+
+            std::uint32_t tree_index::position(const element* _child) {
+                if(!m_positions_valid) {
+                    m_positions.clear();
+                    m_positions_valid = true;
+                }
+                auto it = m_positions.find(_child);
+                if(it == m_positions.end()) {
+                    const auto& siblings = _child->m_parent_ptr->m_elements;
+                    for(std::uint32_t i = 0; i < siblings.size(); i++) {
+                        if(!siblings[i].is_run()) {
+                            m_positions[siblings[i].get()] = i;
+                        }
+                    }
+                    it = m_positions.find(_child);
+                }
+                return it->second;
+            }
+
+            const tree_index::node_set* tree_index::tagged(element_t _type)const {
+                size_t type = static_cast<size_t>(_type);
+                return type < m_tags.size() ? &m_tags[type] : nullptr;
+            }
+
+            const tree_index::node_set* tree_index::classed(std::string_view _class)const {
+                auto it = m_classes.find(std::string(_class));
+                return it != m_classes.end() ? &it->second : nullptr;
             }
-            return result;
         }
 
         /////////////////////////////////////////////////////////////
-        std::vector<std::string> init_static_tag_names() {
-            std::vector<std::string> v;
-            v.resize(120); // Increased for new elements
-            v[body_t] = "body";
-            v[head_t] = "head";
-            v[title_t] = "title";
-            v[meta_t] = "meta";
-            v[div_t] = "div";
-            v[nav_t] = "nav";
-            v[span_t] = "span";
-            v[element_group_t] = ""; //no tag
-            v[a_t] = "a";
-            v[link_t] = "link";
-            v[p_t] = "p";
-            v[text_t] = ""; //no tag
-            v[script_t] = "script";
-            v[img_t] = "img";
-            v[style_t] = "style";
-            v[h1_t] = "h1";
-            v[h2_t] = "h2";
-            v[h3_t] = "h3";
-            v[h4_t] = "h4";
-            v[h5_t] = "h5";
-            v[h6_t] = "h6";
-            v[table_t] = "table";
-            v[td_t] = "td";
-            v[tr_t] = "tr";
-            v[thead_t] = "thead";
-            v[tfoot_t] = "tfoot";
-            v[tbody_t] = "tbody";
-            v[th_t] = "th";
-            v[caption_t] = "caption";
-            v[br_t] = "br";
-            v[hr_t] = "hr";
-            v[em_t] = "em";
-            v[strong_t] = "strong";
-            v[small_t] = "small";
-            v[b_t] = "b";
-            v[ol_t] = "ol";
-            v[ul_t] = "ul";
-            v[li_t] = "li";
-            v[textarea_t] = "textarea";
-            // Form elements
-            v[form_t] = "form";
-            v[input_t] = "input";
-            v[button_t] = "button";
-            v[select_t] = "select";
-            v[option_t] = "option";
-            v[label_t] = "label";
-            v[fieldset_t] = "fieldset";
-            v[legend_t] = "legend";
-            // Semantic HTML5 elements
-            v[header_t] = "header";
-            v[footer_t] = "footer";
-            v[section_t] = "section";
-            v[article_t] = "article";
-            v[aside_t] = "aside";
-            v[main_t] = "main";
-            // Media elements
-            v[video_t] = "video";
-            v[audio_t] = "audio";
-            v[source_t] = "source";
-            // Table structure
-            v[colgroup_t] = "colgroup";
-            v[col_t] = "col";
-            // Interactive elements
-            v[details_t] = "details";
-            v[summary_t] = "summary";
-            v[dialog_t] = "dialog";
-            v[template_t] = "template";
-            // Semantic text elements
-            v[figure_t] = "figure";
-            v[figcaption_t] = "figcaption";
-            v[time_t] = "time";
-            v[mark_t] = "mark";
-            v[code_t] = "code";
-            v[pre_t] = "pre";
-            v[kbd_t] = "kbd";
-            v[samp_t] = "samp";
-            v[var_t] = "var";
-            v[blockquote_t] = "blockquote";
-            v[q_t] = "q";
-            v[abbr_t] = "abbr";
-            v[cite_t] = "cite";
-            v[dfn_t] = "dfn";
-            v[address_t] = "address";
-            v[sub_t] = "sub";
-            v[sup_t] = "sup";
-            v[ins_t] = "ins";
-            v[del_t] = "del";
-            v[s_t] = "s";
-            v[u_t] = "u";
-            // Form enhancements
-            v[datalist_t] = "datalist";
-            v[output_t] = "output";
-            v[optgroup_t] = "optgroup";
-            v[progress_t] = "progress";
-            v[meter_t] = "meter";
-            // Media & embedded
-            v[picture_t] = "picture";
-            v[track_t] = "track";
-            v[iframe_t] = "iframe";
-            v[canvas_t] = "canvas";
-            return v;
-        }
-
-        std::vector<std::string> element::s_static_tag_names = init_static_tag_names();
+        // element
 
         element::element()
             :
@@ -150,13 +435,141 @@ namespace html {
             m_is_container(true),
             m_has_closing_tag(true),
             m_type(undefined_t),
+            m_index(nullptr),
+            m_writer(writer_tag),
             m_is_head_element(false),
             m_newline_after_tag(false),
-            m_newline_after_element(false) {
+            m_newline_after_element(false),
+            m_attributes(detail::resource()),
+            m_elements(detail::resource()) {
             ;
         }
 
-        element::~element() { m_elements.clear(); }
+        element::~element() {
+            detail::tree_index* owned = nullptr;
+            if(m_index) {
+                m_index->remove(this);
+                m_index->changed();
+                if(m_index->root() == this) {
+                    owned = m_index;
+                }
+            }
+            // Children unregister themselves while the index is still alive
+            release_children();
+            delete owned;
+        }
+
+        void element::release_children() {
+            bool deep = false;
+            for(const auto& c : m_elements) {
+                if(!c.is_run() && !c->m_elements.empty()) {
+                    deep = true;
+                    break;
+                }
+            }
+            if(!deep) {
+                m_elements.clear();
+                return;
+            }
+            // Each node is emptied before it is destroyed, so no destructor
+            // reaches further than its own node
+            std::vector<detail::child> work;
+            work.reserve(m_elements.size());
+            for(auto& c : m_elements) {
+                work.push_back(std::move(c));
+            }
+            m_elements.clear();
+            while(!work.empty()) {
+                detail::child e = std::move(work.back());
+                work.pop_back();
+                if(e.is_run()) {
+                    continue;
+                }
+                for(auto& c : e->m_elements) {
+                    work.push_back(std::move(c));
+                }
+                e->m_elements.clear();
+            }
+        }
+
+        // Every node carries a small header recording the resource it came from,
+        // so heap and arena nodes can be mixed and freed through the same path.
+        static constexpr std::size_t s_node_header = alignof(std::max_align_t);
+
+        void* element::operator new(std::size_t _sz) {
+            std::pmr::memory_resource* res = detail::resource();
+            char* base = static_cast<char*>(res->allocate(_sz + s_node_header, alignof(std::max_align_t)));
+            *reinterpret_cast<std::pmr::memory_resource**>(base) = res;
+            return base + s_node_header;
+        }
+
+        void element::operator delete(void* _p, std::size_t _sz) {
+            if(!_p) {
+                return;
+            }
+            char* base = static_cast<char*>(_p) - s_node_header;
+            std::pmr::memory_resource* res = *reinterpret_cast<std::pmr::memory_resource**>(base);
+            res->deallocate(base, _sz + s_node_header, alignof(std::max_align_t));
+        }
+
+        /////////////////////////////////////////////////////////////
+        // child slots
+
+        // Out-of-line run characters follow the resource they came from
+        static constexpr std::size_t s_run_header = sizeof(std::pmr::memory_resource*);
+
+        detail::child detail::child::run(std::string_view _s, kind_t _kind, bool _newline, std::pmr::memory_resource* _res) {
+            assert(_kind != node_kind && _s.size() <= std::numeric_limits<std::uint32_t>::max());
+            child c;
+            c.m_size = static_cast<std::uint32_t>(_s.size());
+            c.m_kind = _kind;
+            c.m_flags = _newline ? newline : 0;
+            if(_s.size() <= s_inline) {
+                c.m_flags |= inline_chars;
+                if(!_s.empty()) {
+                    std::memcpy(c.m_small, _s.data(), _s.size());
+                }
+            } else {
+                char* base = static_cast<char*>(_res->allocate(s_run_header + _s.size(), alignof(std::pmr::memory_resource*)));
+                *reinterpret_cast<std::pmr::memory_resource**>(base) = _res;
+                c.m_chars = base + s_run_header;
+                std::memcpy(c.m_chars, _s.data(), _s.size());
+            }
+            return c;
+        }
+
+        void detail::child::reset() {
+            if(m_kind == node_kind) {
+                delete m_node;
+            } else if(!(m_flags & (inline_chars | borrowed))) {
+                char* base = m_chars - s_run_header;
+                std::pmr::memory_resource* res = *reinterpret_cast<std::pmr::memory_resource**>(base);
+                res->deallocate(base, s_run_header + m_size, alignof(std::pmr::memory_resource*));
+            }
+            m_node = nullptr;
+            m_size = 0;
+            m_kind = node_kind;
+            m_flags = 0;
+        }
+
+        std::uint16_t detail::borrow_check(std::string_view _s) {
+            // FNV-1a folded to 16 bits; never 0, which marks "not checked"
+            std::uint32_t h = 2166136261u;
+            for(char c : _s) {
+                h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+            }
+            return static_cast<std::uint16_t>((h ^ (h >> 16)) | 1);
+        }
+
+        element* detail::child::promote()const {
+            html::text* n = m_kind == raw_kind ? new raw_html(text()) : new html::text(text());
+            n->m_newline_after_element = is_newline();
+            // Slots are never const objects; only the representation changes
+            child& self = const_cast<child&>(*this);
+            self.reset();
+            self.m_node = n;
+            return n;
+        }
 
         element::element(const element& _e)
             :
@@ -165,9 +578,15 @@ namespace html {
             m_is_container(true),
             m_has_closing_tag(true),
             m_type(undefined_t),
+            m_index(nullptr),
+            // Only an implicit copy of the same class may keep a specialised
+            // writer; a slice into a base class goes through write_html
+            m_writer(_e.m_writer == writer_tag ? writer_tag : writer_custom),
             m_is_head_element(false),
             m_newline_after_tag(false),
-            m_newline_after_element(false) {
+            m_newline_after_element(false),
+            m_attributes(detail::resource()),
+            m_elements(detail::resource()) {
             this->copy(_e);
         }
 
@@ -176,34 +595,37 @@ namespace html {
             m_page_ptr(_e.m_page_ptr),
             m_parent_ptr(_e.m_parent_ptr),
             m_type(_e.m_type),
+            m_index(nullptr),
+            m_writer(_e.m_writer == writer_tag ? writer_tag : writer_custom),
             m_is_container(_e.m_is_container),
             m_has_closing_tag(_e.m_has_closing_tag),
             m_is_head_element(_e.m_is_head_element),
             m_newline_after_tag(_e.m_newline_after_tag),
             m_newline_after_element(_e.m_newline_after_element),
-            m_class_attr(std::move(_e.m_class_attr)),
-            m_id_attr(std::move(_e.m_id_attr)),
-            m_data_id_attr(std::move(_e.m_data_id_attr)),
-            m_type_attr(std::move(_e.m_type_attr)),
-            m_role_attr(std::move(_e.m_role_attr)),
-            m_style_attr(std::move(_e.m_style_attr)),
-            m_src_attr(std::move(_e.m_src_attr)),
-            m_alt_attr(std::move(_e.m_alt_attr)),
-            m_width_attr(std::move(_e.m_width_attr)),
-            m_height_attr(std::move(_e.m_height_attr)),
-            m_href_attr(std::move(_e.m_href_attr)),
-            m_rel_attr(std::move(_e.m_rel_attr)),
-            m_other_attr(std::move(_e.m_other_attr)),
+            m_attributes(std::move(_e.m_attributes)),
             m_elements(std::move(_e.m_elements)) {
+            // The id and the children leave _e's indexed tree
+            if(_e.m_index) {
+                // Its id and classes have already moved here
+                _e.m_index->remove(&_e, *this);
+            }
+            for(auto& e : m_elements) {
+                if(!e.is_run()) {
+                    adopt(e.get());
+                }
+            }
             // Reset moved-from object
             _e.m_page_ptr = nullptr;
             _e.m_parent_ptr = nullptr;
             _e.m_type = undefined_t;
+            _e.index_self();
         }
 
         element& element::operator=(element&& _e) noexcept {
             if (this != &_e) {
                 m_page_ptr = _e.m_page_ptr;
+                unindex_self();
+                _e.unindex_self();
                 m_parent_ptr = _e.m_parent_ptr;
                 m_type = _e.m_type;
                 m_is_container = _e.m_is_container;
@@ -211,157 +633,223 @@ namespace html {
                 m_is_head_element = _e.m_is_head_element;
                 m_newline_after_tag = _e.m_newline_after_tag;
                 m_newline_after_element = _e.m_newline_after_element;
-                m_class_attr = std::move(_e.m_class_attr);
-                m_id_attr = std::move(_e.m_id_attr);
-                m_data_id_attr = std::move(_e.m_data_id_attr);
-                m_type_attr = std::move(_e.m_type_attr);
-                m_role_attr = std::move(_e.m_role_attr);
-                m_style_attr = std::move(_e.m_style_attr);
-                m_src_attr = std::move(_e.m_src_attr);
-                m_alt_attr = std::move(_e.m_alt_attr);
-                m_width_attr = std::move(_e.m_width_attr);
-                m_height_attr = std::move(_e.m_height_attr);
-                m_href_attr = std::move(_e.m_href_attr);
-                m_rel_attr = std::move(_e.m_rel_attr);
-                m_other_attr = std::move(_e.m_other_attr);
+                m_attributes = std::move(_e.m_attributes);
                 m_elements = std::move(_e.m_elements);
+                for(auto& e : m_elements) {
+                    if(!e.is_run()) {
+                        adopt(e.get());
+                    }
+                }
+                index_self();
                 // Reset moved-from object
                 _e.m_page_ptr = nullptr;
                 _e.m_parent_ptr = nullptr;
                 _e.m_type = undefined_t;
+                _e.index_self();
             }
             return *this;
         }
 
+        namespace {
+            // Node whose next copy() is a single-node clone (see element::copy)
+            thread_local const element* t_shallow_copy_source = nullptr;
+        }
+
         void element::copy(const element& _other) {
+            unindex_self();
             m_type = _other.m_type;
-            m_class_attr = _other.m_class_attr;
-            m_id_attr = _other.m_id_attr;
-            m_data_id_attr = _other.m_data_id_attr;
-            m_style_attr = _other.m_style_attr;
-            m_src_attr = _other.m_src_attr;
-            m_alt_attr = _other.m_alt_attr;
-            m_type_attr = _other.m_type_attr;
-            m_role_attr = _other.m_role_attr;
-            m_other_attr = _other.m_other_attr;
-            m_width_attr = _other.m_width_attr;
-            m_height_attr = _other.m_height_attr;
-            m_href_attr = _other.m_href_attr;
-            m_rel_attr = _other.m_rel_attr;
+            m_attributes.copy(_other.m_attributes);
+            index_self();
             m_is_container = _other.m_is_container;
             m_has_closing_tag = _other.m_has_closing_tag;
             m_is_head_element = _other.m_is_head_element;
             m_newline_after_tag = _other.m_newline_after_tag;
             m_newline_after_element = _other.m_newline_after_element;
-            m_elements.clear();
-            for(auto& e : _other.m_elements) {
-                m_elements.push_back(
-                    std::unique_ptr<element>(e->make_copy()));
+            release_children();
+            if(t_shallow_copy_source == &_other) {
+                // make_copy of a node inside the copy below: children follow
+                t_shallow_copy_source = nullptr;
+                return;
+            }
+            // Clone level by level from a work list. Each make_copy copies
+            // one node; its children are queued instead of recursed into.
+            struct pending {
+                const element* from;
+                element* to;
+            };
+            std::vector<pending> work;
+            work.push_back(pending{&_other, this});
+            while(!work.empty()) {
+                pending p = work.back();
+                work.pop_back();
+                for(const auto& c : p.from->m_elements) {
+                    if(c.is_run()) {
+                        p.to->m_elements.push_back(c.clone_run(p.to->m_elements.get_allocator().resource()));
+                        continue;
+                    }
+                    t_shallow_copy_source = c.get();
+                    element* n = c->make_copy();
+                    t_shallow_copy_source = nullptr;
+                    p.to->m_elements.push_back(std::unique_ptr<element>(n));
+                    p.to->adopt(n);
+                    if(!c->m_elements.empty()) {
+                        work.push_back(pending{c.get(), n});
+                    }
+                }
             }
         }
 
-        const std::string& element::tag()const {
-            assert(m_type != 0);
-            assert(s_static_tag_names.size() > (size_t)m_type);
-            return s_static_tag_names[m_type];
+        void element::move(element&& _other) {
+            unindex_self();
+            _other.unindex_self();
+            m_type = _other.m_type;
+            m_attributes = std::move(_other.m_attributes);
+            index_self();
+            _other.index_self();
+            m_is_container = _other.m_is_container;
+            m_has_closing_tag = _other.m_has_closing_tag;
+            m_is_head_element = _other.m_is_head_element;
+            m_newline_after_tag = _other.m_newline_after_tag;
+            m_newline_after_element = _other.m_newline_after_element;
+            // Children change owner, not address - just re-parent them
+            m_elements = std::move(_other.m_elements);
+            _other.m_elements.clear();
+            for(auto& e : m_elements) {
+                if(!e.is_run()) {
+                    adopt(e.get());
+                }
+            }
+        }
+
+        void element::adopt(element* _child) {
+            _child->m_parent_ptr = this;
+            if(m_index) {
+                m_index->attach(*_child);
+            } else if(_child->m_index) {
+                _child->m_index->detach(*_child);
+            }
+        }
+
+        void element::unindex_self() {
+            if(m_index) {
+                m_index->remove(this);
+            }
+        }
+
+        void element::index_self() {
+            if(m_index) {
+                m_index->add(this);
+            }
+        }
+
+        std::string_view element::tag()const {
+            return detail::tag_table[m_type].name;
         }
 
 
-        element& element::id(const std::string& _a) { m_id_attr = _a; return *this; }
-        const std::string& element::id()const { return m_id_attr; }
+        element_t element::tag_type(std::string_view _name) {
+            static const std::unordered_map<std::string_view, element_t> types = [] {
+                std::unordered_map<std::string_view, element_t> m;
+                for(size_t t = 0; t < detail::tag_table.size(); t++) {
+                    if(!detail::tag_table[t].name.empty()) {
+                        m.emplace(detail::tag_table[t].name, static_cast<element_t>(t));
+                    }
+                }
+                return m;
+            }();
+            auto it = types.find(_name);
+            return it != types.end() ? it->second : undefined_t;
+        }
+
+        element& element::id(std::string_view _a) {
+            unindex_self();
+            m_attributes.set(id_attr, _a);
+            index_self();
+            return *this;
+        }
+        std::string_view element::id()const { return m_attributes.get(id_attr); }
 
-        element& element::data_id(const std::string& _a) { m_data_id_attr = _a; return *this; }
-        const std::string& element::data_id()const { return m_data_id_attr; }
+        element& element::data_id(std::string_view _a) { m_attributes.set(data_id_attr, _a); return *this; }
+        std::string_view element::data_id()const { return m_attributes.get(data_id_attr); }
 
-        element& element::cl(const std::string& _a) { m_class_attr = _a; return *this; }
-        element& element::add_cl(const std::string& _c) { m_class_attr += (" " + _c); return *this; }
-        const std::string& element::cl()const { return m_class_attr; }
+        element& element::cl(std::string_view _a) {
+            unindex_self();
+            m_attributes.set(class_attr, _a);
+            index_self();
+            return *this;
+        }
+        element& element::add_cl(std::string_view _c) {
+            unindex_self();
+            std::pmr::string& cls = m_attributes.ensure(class_attr);
+            cls += ' ';
+            cls += _c;
+            index_self();
+            return *this;
+        }
+        std::string_view element::cl()const { return m_attributes.get(class_attr); }
 
-        element& element::type(const std::string& _a) { m_type_attr = _a; return *this; }
-        const std::string& element::type()const { return m_type_attr; }
+        element& element::type(std::string_view _a) { m_attributes.set(type_attr, _a); return *this; }
+        std::string_view element::type()const { return m_attributes.get(type_attr); }
 
-        element& element::role(const std::string& _a) { m_role_attr = _a; return *this; }
-        const std::string& element::role()const { return m_role_attr; }
+        element& element::role(std::string_view _a) { m_attributes.set(role_attr, _a); return *this; }
+        std::string_view element::role()const { return m_attributes.get(role_attr); }
 
-        element& element::rel(const std::string& _a) { m_rel_attr = _a; return *this; }
-        const std::string& element::rel()const { return m_rel_attr; }
+        element& element::rel(std::string_view _a) { m_attributes.set(rel_attr, _a); return *this; }
+        std::string_view element::rel()const { return m_attributes.get(rel_attr); }
 
-        element& element::src(const std::string& _a) { m_src_attr = _a; return *this; }
-        const std::string& element::src()const { return m_src_attr; }
+        element& element::src(std::string_view _a) { m_attributes.set(src_attr, _a); return *this; }
+        std::string_view element::src()const { return m_attributes.get(src_attr); }
 
-        element& element::height(const std::string& _a) { m_height_attr = _a; return *this; }
-        const std::string& element::height()const { return m_height_attr; }
+        element& element::height(std::string_view _a) { m_attributes.set(height_attr, _a); return *this; }
+        std::string_view element::height()const { return m_attributes.get(height_attr); }
 
-        element& element::width(const std::string& _a) { m_width_attr = _a; return *this; }
-        const std::string& element::width()const { return m_width_attr; }
+        element& element::width(std::string_view _a) { m_attributes.set(width_attr, _a); return *this; }
+        std::string_view element::width()const { return m_attributes.get(width_attr); }
 
-        element& element::alt(const std::string& _a) { m_alt_attr = _a; return *this; }
-        const std::string& element::alt()const { return m_alt_attr; }
+        element& element::alt(std::string_view _a) { m_attributes.set(alt_attr, _a); return *this; }
+        std::string_view element::alt()const { return m_attributes.get(alt_attr); }
 
-        element& element::style(const std::string& _a) { m_style_attr = _a; return *this; }
-        const std::string& element::style()const { return m_style_attr; }
+        element& element::style(std::string_view _a) { m_attributes.set(style_attr, _a); return *this; }
+        std::string_view element::style()const { return m_attributes.get(style_attr); }
 
-        element& element::href(const std::string& _a) { m_href_attr = _a; return *this; }
-        const std::string& element::href()const { return m_href_attr; }
+        element& element::href(std::string_view _a) { m_attributes.set(href_attr, _a); return *this; }
+        std::string_view element::href()const { return m_attributes.get(href_attr); }
 
         // Data attributes
-        element& element::data(const std::string& name, const std::string& value) {
-            add_attr("data-" + name, value);
+        element& element::data(std::string_view name, std::string_view value) {
+            std::string key("data-");
+            key += name;
+            add_attr(key, value);
             return *this;
         }
 
         // ARIA accessibility attributes
-        element& element::aria_label(const std::string& s) { add_attr("aria-label", s); return *this; }
-        element& element::aria_labelledby(const std::string& s) { add_attr("aria-labelledby", s); return *this; }
-        element& element::aria_describedby(const std::string& s) { add_attr("aria-describedby", s); return *this; }
+        element& element::aria_label(std::string_view s) { add_attr("aria-label", s); return *this; }
+        element& element::aria_labelledby(std::string_view s) { add_attr("aria-labelledby", s); return *this; }
+        element& element::aria_describedby(std::string_view s) { add_attr("aria-describedby", s); return *this; }
         element& element::aria_hidden(bool b) { add_attr("aria-hidden", b ? "true" : "false"); return *this; }
         element& element::aria_expanded(bool b) { add_attr("aria-expanded", b ? "true" : "false"); return *this; }
-        element& element::aria_controls(const std::string& s) { add_attr("aria-controls", s); return *this; }
-        element& element::aria_current(const std::string& s) { add_attr("aria-current", s); return *this; }
-        element& element::aria_live(const std::string& s) { add_attr("aria-live", s); return *this; }
+        element& element::aria_controls(std::string_view s) { add_attr("aria-controls", s); return *this; }
+        element& element::aria_current(std::string_view s) { add_attr("aria-current", s); return *this; }
+        element& element::aria_live(std::string_view s) { add_attr("aria-live", s); return *this; }
 
         // Global boolean attributes
         element& element::hidden(bool b) { if (b) add_attr("hidden", "hidden"); return *this; }
         element& element::contenteditable(bool b) { add_attr("contenteditable", b ? "true" : "false"); return *this; }
         element& element::draggable(bool b) { add_attr("draggable", b ? "true" : "false"); return *this; }
         element& element::spellcheck(bool b) { add_attr("spellcheck", b ? "true" : "false"); return *this; }
-        element& element::tabindex(int n) { add_attr("tabindex", std::to_string(n)); return *this; }
-        element& element::title(const std::string& s) { add_attr("title", s); return *this; }
-        element& element::lang(const std::string& s) { add_attr("lang", s); return *this; }
-        element& element::dir(const std::string& s) { add_attr("dir", s); return *this; }
+        element& element::tabindex(int n) { add_attr("tabindex", number(n)); return *this; }
+        element& element::title(std::string_view s) { add_attr("title", s); return *this; }
+        element& element::lang(std::string_view s) { add_attr("lang", s); return *this; }
+        element& element::dir(std::string_view s) { add_attr("dir", s); return *this; }
 
         element& element::add_attr(const html::attr& _atr) {
             return add(_atr);
         }
 
         element& element::add(const html::attr& _atr) {
-            if(_atr.name == "class") {
-                cl(_atr.value);
-            } else if(_atr.name == "id") {
-                id(_atr.value);
-            } else if(_atr.name == "data-id") {
-                data_id(_atr.value);
-            } else if(_atr.name == "type") {
-                type(_atr.value);
-            } else if(_atr.name == "role") {
-                role(_atr.value);
-            } else if(_atr.name == "style") {
-                style(_atr.value);
-            } else if(_atr.name == "src") {
-                src(_atr.value);
-            } else if(_atr.name == "alt") {
-                alt(_atr.value);
-            } else if(_atr.name == "width") {
-                width(_atr.value);
-            } else if(_atr.name == "height") {
-                height(_atr.value);
-            } else if(_atr.name == "href") {
-                href(_atr.value);
-            } else if(_atr.name == "rel") {
-                rel(_atr.value);
-            } else {
-                add_attr(_atr.name, _atr.value);
-            }
+            // dedicated names ("class", "id", ...) intern to their own slots
+            add_attr(_atr.name, _atr.value);
             return *this;
         }
 
@@ -372,19 +860,9 @@ namespace html {
         void element::clear() { m_elements.clear(); }
 
         void element::clear_all() {
-            m_class_attr.clear();
-            m_id_attr.clear();
-            m_data_id_attr.clear();
-            m_type_attr.clear();
-            m_style_attr.clear();
-            m_src_attr.clear();
-            m_alt_attr.clear();
-            m_width_attr.clear();
-            m_height_attr.clear();
-            m_other_attr.clear();
-            m_href_attr.clear();
-            m_rel_attr.clear();
-            m_role_attr.clear();
+            unindex_self();
+            m_attributes.clear();
+            index_self();
             m_elements.clear();
         }
 
@@ -412,37 +890,116 @@ namespace html {
         }
 
         element& element::at(size_t _sz) {
-            return *m_elements[_sz];
+            return *node_at(_sz);
+        }
+
+        element* element::node_at(size_t _idx) {
+            detail::child& c = m_elements[_idx];
+            if(c.is_run()) {
+                adopt(c.get());
+            }
+            return c.get();
         }
 
         element* element::find(const std::string& _id) {
-            for(auto& e : m_elements) {
-                if(e->id() == _id) {
-                    return e.get();
-                }
-                //search recursively
-                if(!e->empty()) {
-                    element* ele_ptr = e->find(_id);
-                    if(ele_ptr) {
-                        assert(ele_ptr->id() == _id);
-                        return ele_ptr;
+            element* found = nullptr;
+            if(m_index && m_index->lookup(_id, found)) {
+                // Unique in the tree: a match only if it is below this node
+                for(element* p = found ? found->m_parent_ptr : nullptr; p; p = p->m_parent_ptr) {
+                    if(p == this) {
+                        return found;
                     }
                 }
+                return nullptr;
             }
-            return nullptr;
+            found = find_walk(_id);
+            if(found && m_index) {
+                m_index->settle(_id, found);
+            }
+            return found;
+        }
+
+        element* element::find_walk(const std::string& _id) {
+            // First descendant with the id, in document order
+            struct finder {
+                const std::string& id;
+                element* root;
+                element* found;
+                visitor::action enter(element& _e) {
+                    if(&_e != root && _e.id() == id) {
+                        found = &_e;
+                        return visitor::stop;
+                    }
+                    return visitor::descend;
+                }
+                void leave(element&) { ; }
+                visitor::action text(element& _e) { return enter(_e); }
+                visitor::action run(const detail::child&) { return visitor::descend; }
+            };
+            finder f{_id, this, nullptr};
+            walk(*this, f);
+            return f.found;
         }
 
         element* element::find_child(const std::string& _id) {
+            element* found = nullptr;
+            if(m_index && m_index->lookup(_id, found)) {
+                return (found && found->m_parent_ptr == this) ? found : nullptr;
+            }
             for(auto& e : m_elements) {
-                if(e->id() == _id) {
+                if(!e.is_run() && e->id() == _id) {
                     return e.get();
                 }
             }
             return nullptr;
         }
 
-        element& element::operator<<(const std::string& _s) {
-            add(text(_s));
+        void element::index_tree(bool _enabled) {
+            if(_enabled) {
+                // Inside an indexed tree the ancestor's index already covers us
+                if(!m_index) {
+                    detail::tree_index* idx = new detail::tree_index(this);
+                    idx->attach(*this);
+                }
+            } else if(m_index && m_index->root() == this) {
+                detail::tree_index* idx = m_index;
+                idx->detach(*this);
+                delete idx;
+            }
+        }
+
+        std::vector<std::string> element::duplicate_ids()const {
+            if(m_index && m_index->root() == this && id().empty()) {
+                return std::vector<std::string>(m_index->duplicates().begin(), m_index->duplicates().end());
+            }
+            struct id_counter {
+                const element* root;
+                std::map<std::string, size_t> counts;
+                visitor::action enter(const element& _e) {
+                    std::string_view id = _e.id();
+                    if(&_e != root && !id.empty()) {
+                        counts[std::string(id)]++;
+                    }
+                    return visitor::descend;
+                }
+                void leave(const element&) { ; }
+                visitor::action text(const element& _e) { return enter(_e); }
+                visitor::action run(const detail::child&) { return visitor::descend; }
+            };
+            id_counter ids{this, {}};
+            walk(*this, ids);
+            std::map<std::string, size_t>& counts = ids.counts;
+            std::vector<std::string> dups;
+            for(const auto& c : counts) {
+                if(c.second > 1) {
+                    dups.push_back(c.first);
+                }
+            }
+            return dups;
+        }
+
+        element& element::operator<<(std::string_view _s) {
+            add(_s);
             return *this;
         }
 
@@ -458,9 +1015,9 @@ namespace html {
 
         //////////////////////////////////////////////////////////////
 
-        element& element::operator<<=(const std::string& _s) {
+        element& element::operator<<=(std::string_view _s) {
             clear();
-            add(text(_s));
+            add(_s);
             return *this;
         }
 
@@ -483,8 +1040,59 @@ namespace html {
             return *this;
         }
 
-        element& element::add(const std::string& _s) {
-            return add(html::text(_s));
+        element& element::operator<<(text_ref _t) {
+            return add(_t);
+        }
+
+        element& element::operator<<(const attr_ref& _a) {
+            return add(_a);
+        }
+
+        element& element::add(text_ref _t) {
+            if(!m_is_container) {
+                throw std::runtime_error("cannot add element - this element is not a container!");
+            }
+            if(_t.view.size() > std::numeric_limits<std::uint32_t>::max()) {
+                // Too long to borrow in a slot
+                add_run(_t.view);
+            } else {
+                m_elements.push_back(detail::child::borrow(_t.view));
+            }
+            return *this;
+        }
+
+        element& element::add(const attr_ref& _a) {
+            attr_id a = attribute_list::intern(_a.name);
+            bool indexed_attr = (a == id_attr || a == class_attr);
+            if(indexed_attr) {
+                unindex_self();
+            }
+            m_attributes.borrow(a, _a.value);
+            if(indexed_attr) {
+                index_self();
+            }
+            return *this;
+        }
+
+        element& element::add(std::string_view _s) {
+            if(!m_is_container) {
+                throw std::runtime_error("cannot add element - this element is not a container!");
+            }
+            add_run(_s);
+            return *this;
+        }
+
+        void element::add_run(std::string_view _s, bool _raw, bool _newline) {
+            if(_s.size() > std::numeric_limits<std::uint32_t>::max()) {
+                // Beyond what a run can hold: an ordinary text node
+                html::text* n = _raw ? new raw_html(_s) : new html::text(_s);
+                n->m_newline_after_element = _newline;
+                m_elements.push_back(std::unique_ptr<element>(n));
+                adopt(n);
+                return;
+            }
+            m_elements.push_back(detail::child::run(_s, _raw ? detail::child::raw_kind : detail::child::text_kind,
+                                                    _newline, m_elements.get_allocator().resource()));
         }
 
         html::element& element::add(const html::element& _e) {
@@ -492,8 +1100,8 @@ namespace html {
                 throw std::runtime_error("cannot add element - this element is not a container!");
             }
             element* ele_ptr = _e.make_copy();
-            ele_ptr->m_parent_ptr = this;
             m_elements.push_back(std::unique_ptr<element>(ele_ptr));
+            adopt(ele_ptr);
             return *ele_ptr;
         }
 
@@ -501,11 +1109,11 @@ namespace html {
             if(!m_is_container) {
                 throw std::runtime_error("cannot add element - this element is not a container!");
             }
-            // Create a copy via make_copy which handles polymorphic types correctly
-            // then move from the original to preserve any data
-            element* ele_ptr = _e.make_copy();
-            ele_ptr->m_parent_ptr = this;
+            // make_move keeps the dynamic type and hands over the subtree,
+            // so only the top-level node is allocated here
+            element* ele_ptr = _e.make_move();
             m_elements.push_back(std::unique_ptr<element>(ele_ptr));
+            adopt(ele_ptr);
             return *ele_ptr;
         }
 
@@ -519,9 +1127,12 @@ namespace html {
             }
             for(size_t c = 0; c < _e.m_elements.size(); c++) {
                 m_elements.push_back(std::move(_e.m_elements[c]));
+                if(!m_elements.back().is_run()) {
+                    adopt(m_elements.back().get());
+                }
             }
             _e.m_elements.clear();
-            return *m_elements.back();
+            return *node_at(m_elements.size() - 1);
         }
 
         ///////////////////////////////////////////////////////////////////////////////////
@@ -534,14 +1145,14 @@ namespace html {
             if(_idx >= m_elements.size()) {
                 throw std::runtime_error(std::string("bounds error at pos: ") + std::to_string(_idx));
             }
-            return *m_elements[_idx];
+            return *node_at(_idx);
         }
 
         //////////////////////////////////////////////////////////////////////////////////
 
-        element& element::content(const std::string& _s) {
+        element& element::content(std::string_view _s) {
             m_elements.clear();
-            add(text(_s));
+            add(_s);
             return *this;
         }
 
@@ -551,6 +1162,7 @@ namespace html {
             m_elements.clear();
             element* ele_ptr = _e.make_copy();
             m_elements.push_back(std::unique_ptr<element>(ele_ptr));
+            adopt(ele_ptr);
             return *ele_ptr;
         }
 
@@ -560,51 +1172,116 @@ namespace html {
                 std::string s = html_string();
                 return s;
             }
-            std::ostringstream ss;
-            for(auto& ele_ptr : m_elements) {
-                ele_ptr->write_html(ss);
+            std::string s;
+            {
+                string_writer w(s);
+                for(auto& ele_ptr : m_elements) {
+                    if(ele_ptr.is_run()) {
+                        ele_ptr.write(w);
+                    } else {
+                        ele_ptr->write_html(w);
+                    }
+                }
             }
-            std::string s = ss.str();
             return s;
         }
 
-        void element::write_elements(std::ostream& _s) {
-            for(size_t c = 0; c < m_elements.size(); c++) {
-                m_elements[c]->page(page());
-                m_elements[c]->write_html(_s);
+        // Renders a subtree in one walk. Nodes with writer_tag are written
+        // from the tag tables, text from m_text; only custom writers are
+        // called through write_html.
+        struct element::tree_writer {
+            writer& out;
+            element* root;
+            bool root_tags;                         // write the root's own tags
+            std::vector<escape_context> saved;      // outside the open script / style
+
+            visitor::action enter(element& _e) {
+                if(&_e != root) {
+                    _e.m_page_ptr = root->m_page_ptr;
+                    if(_e.m_writer == writer_custom) {
+                        _e.write_html(out);
+                        return visitor::skip;
+                    }
+                } else if(!root_tags) {
+                    return visitor::descend;
+                }
+                _e.write_open_tag(out);
+                if(_e.m_type == script_t || _e.m_type == style_t) {
+                    // Children of raw text elements are not entity-escaped
+                    saved.push_back(out.context());
+                    out.context(_e.m_type == script_t ? escape_context::script : escape_context::style);
+                }
+                return visitor::descend;
+            }
+            void leave(element& _e) {
+                if(&_e == root && !root_tags) {
+                    return;
+                }
+                if(_e.m_type == script_t || _e.m_type == style_t) {
+                    out.context(saved.back());
+                    saved.pop_back();
+                }
+                _e.write_close_tag(out);
             }
+            visitor::action text(element& _e) {
+                if(&_e == root) {
+                    return visitor::descend;
+                }
+                _e.m_page_ptr = root->m_page_ptr;
+                if(_e.m_writer == writer_text) {
+                    out.write_escaped(static_cast<const html::text&>(_e).m_text);
+                } else {
+                    out.write(static_cast<const html::text&>(_e).m_text);
+                }
+                if(_e.m_newline_after_element) {
+                    out.put('\n');
+                }
+                return visitor::descend;
+            }
+            visitor::action run(const detail::child& _c) {
+                _c.write(out);
+                return visitor::descend;
+            }
+        };
+
+        void element::write_elements(writer& _s) {
+            tree_writer w{_s, this, false, {}};
+            walk(*this, w);
         }
 
-        void element::write_open_tag(std::ostream& _s)const {
-            _s << "<" << tag();
+        void element::write_open_tag(writer& _s)const {
+            _s.write(detail::tag_table[m_type].open);
             element::write_attributes(_s);
-            _s << ">";
             if(m_newline_after_tag) {
-                _s << std::endl;
+                _s.write(">\n", 2);
+            } else {
+                _s.put('>');
             }
         }
-        void element::write_close_tag(std::ostream& _s)const {
+        void element::write_close_tag(writer& _s)const {
             if(m_has_closing_tag) {
-                _s << "</" << tag() << ">";
+                _s.write(detail::tag_table[m_type].close);
             }
             if(m_newline_after_element) {
-                _s << std::endl;
+                _s.put('\n');
             }
         }
 
-        void element::write_html(std::ostream& _s) {
-            write_open_tag(_s);
-            write_elements(_s);
-            write_close_tag(_s);
+        void element::write_html(writer& _s) {
+            write_tag(_s);
+        }
+
+        void element::write_tag(writer& _s) {
+            tree_writer w{_s, this, true, {}};
+            walk(*this, w);
         }
 
 
         std::string element::html() {
             std::string s;
             {
-                std::ostringstream ss;
-                write_html(ss);
-                s = ss.str();
+                string_writer w(s);
+                write_html(w);
             }
             return s;
         }
@@ -615,69 +1292,61 @@ namespace html {
         }
 
 
-        void element::write_attributes(std::ostream& _s)const {
-            if(!m_id_attr.empty()) {
-                _s << " ";
-                _s << "id=\"" << m_id_attr << "\"";
-            }
-            if(!m_data_id_attr.empty()) {
-                _s << " ";
-                _s << "data-id=\"" << m_data_id_attr << "\"";
-            }
-            if(!m_class_attr.empty()) {
-                _s << " ";
-                _s << "class=\"" << m_class_attr << "\"";
-            }
-            if(!m_type_attr.empty()) {
-                _s << " ";
-                _s << "type=\"" << m_type_attr << "\"";
-            }
-            if(!m_role_attr.empty()) {
-                _s << " ";
-                _s << "role=\"" << m_role_attr << "\"";
-            }
-            if(!m_style_attr.empty()) {
-                _s << " ";
-                _s << "style=\"" << m_style_attr << "\"";
-            }
-            if(!m_src_attr.empty()) {
-                _s << " ";
-                _s << "src=\"" << m_src_attr << "\"";
-            }
-            if(!m_alt_attr.empty()) {
-                _s << " ";
-                _s << "alt=\"" << m_alt_attr << "\"";
-            }
-            if(!m_width_attr.empty()) {
-                _s << " ";
-                _s << "width=\"" << m_width_attr << "\"";
-            }
-            if(!m_height_attr.empty()) {
-                _s << " ";
-                _s << "height=\"" << m_height_attr << "\"";
-            }
-            if(!m_href_attr.empty()) {
-                _s << " ";
-                _s << "href=\"" << m_href_attr << "\"";
-            }
-            if(!m_rel_attr.empty()) {
-                _s << " ";
-                _s << "rel=\"" << m_rel_attr << "\"";
-            }
-            if(!m_other_attr.empty()) {
-                _s << " ";
-                _s << m_other_attr;
+        namespace {
+            // ' name="' for the dedicated attributes, in attr_id order
+            constexpr std::string_view s_dedicated_attr_prefix[first_generic_attr] = {
+                "", " id=\"", " data-id=\"", " class=\"", " type=\"", " role=\"", " style=\"",
+                " src=\"", " alt=\"", " width=\"", " height=\"", " href=\"", " rel=\""
+            };
+        }
+
+        void element::write_attributes(writer& _s)const {
+            for(const auto& a : m_attributes) {
+                if(a.id < first_generic_attr) {
+                    // dedicated attributes are omitted when empty, generic ones never
+                    if(a.value().empty()) {
+                        continue;
+                    }
+                    _s.write(s_dedicated_attr_prefix[a.id]);
+                } else {
+                    _s.put(' ');
+                    _s.write(attribute_list::name(a.id));
+                    _s.write("=\"", 2);
+                }
+                assert((a.check == 0 || a.check == detail::borrow_check(a.ref)) && "attr_ref memory changed or freed before rendering");
+                _s.write_escaped(a.value(), escape_context::attribute);
+                _s.put('"');
             }
         }
 
         //////////////////////////////////////////////////////////////////////////////
 
-        std::string nbsp(size_t repeat) {
+        arena_scope::arena_scope(std::pmr::memory_resource* _resource)
+            :
+            m_resource(_resource) {
+            detail::resource_stack.push_back(m_resource);
+            detail::current_resource = m_resource;
+        }
+
+        arena_scope::~arena_scope() {
+            detail::pop_resource(m_resource);
+        }
+
+        arena::arena(size_t initial_size, std::pmr::memory_resource* upstream)
+            :
+            m_resource(initial_size, upstream),
+            m_scope(&m_resource) {
+            ;
+        }
+
+        //////////////////////////////////////////////////////////////////////////////
+
+        raw_html nbsp(size_t repeat) {
             std::string s;
             for(size_t c = 0; c < repeat; c++) {
                 s += "&nbsp;";
             }
-            return s;
+            return raw_html(s);
         }
 
 
@@ -689,34 +1358,95 @@ namespace html {
             return ele_ptr;
         }
 
+        element* element::make_move() {
+            element* ele_ptr = new element();
+            ele_ptr->move(std::move(*this));
+            return ele_ptr;
+        }
+
 
-        void element::add_attr(const std::string& _name, const std::string& _value) {
-            m_other_attr += " " + _name + "=\"" + _value + "\"";
+        void element::add_attr(std::string_view _name, std::string_view _value) {
+            attr_id a = attribute_list::intern(_name);
+            if(a == id_attr) {
+                id(_value);
+                return;
+            }
+            if(a == class_attr) {
+                cl(_value);
+                return;
+            }
+            m_attributes.set(a, _value);
+        }
+
+        std::string_view element::attr(std::string_view _name)const {
+            return m_attributes.get(attribute_list::intern(_name));
         }
 
-        const std::string& element::attr()const {
-            return m_other_attr;
+        bool element::has_attr(std::string_view _name)const {
+            return m_attributes.has(attribute_list::intern(_name));
+        }
+
+        element& element::remove_attr(std::string_view _name) {
+            attr_id a = attribute_list::intern(_name);
+            bool indexed_attr = (a == id_attr || a == class_attr);
+            if(indexed_attr) {
+                unindex_self();
+            }
+            m_attributes.remove(a);
+            if(indexed_attr) {
+                index_self();
+            }
+            return *this;
+        }
+
+        std::string element::attr()const {
+            std::string s;
+            for(const auto& a : m_attributes) {
+                if(a.id < first_generic_attr) {
+                    continue;
+                }
+                s += ' ';
+                s += attribute_list::name(a.id);
+                s += "=\"";
+                html_escape(a.value(), s);
+                s += '"';
+            }
+            return s;
         }
 
         ///////////////////////////////////////////////////////////////////////
 
         std::ostream& operator<<(std::ostream& _s, html::element& _e) {
-            _e.write_html(_s);
+            ostream_writer w(_s);
+            _e.write_html(w);
             return _s;
         }
 
         //////////////////////////////////////////////////////////////////////
 
         page::page() {
+            m_writer = writer_custom;
             preamble = "<!DOCTYPE html>";
             m_bWriteNewlineAfterTag = true;
             m_dependency_mode = dependency_mode::cdn;  // Default to CDN
+            m_asset_dir = "assets";
+            m_css_tree_shaking = false;
             // Set thread-local context so components can register dependencies
             detail::current_page = this;
         }
 
         page::~page() {
             m_bWriteNewlineAfterTag = true;
+            // Arena nodes must be gone before the arena releases its memory
+            m_elements.clear();
+            head.m_elements.clear();
+            if (m_arena) {
+                // A use_arena() scope must not outlive the page
+                auto& stack = detail::resource_stack;
+                assert(std::find(stack.begin(), stack.end(), m_arena.get()) == stack.end() && "page destroyed inside its use_arena() scope");
+                stack.erase(std::remove(stack.begin(), stack.end(), m_arena.get()), stack.end());
+                detail::current_resource = stack.empty() ? nullptr : stack.back();
+            }
             // Clear thread-local context
             if (detail::current_page == this) {
                 detail::current_page = nullptr;
@@ -763,132 +1493,238 @@ namespace html {
             return m_dependency_mode;
         }
 
+        void page::set_asset_directory(const std::string& dir, const std::string& url_prefix) {
+            m_asset_dir = dir;
+            m_asset_url = url_prefix;
+        }
+
+        void page::set_css_tree_shaking(bool enabled) {
+            m_css_tree_shaking = enabled;
+        }
+
+        void page::keep_css_classes(const std::string& names) {
+            m_css_keep += ' ';
+            m_css_keep += names;
+        }
+
+        void page::write_asset_link(writer& _s, std::string_view stem, std::string_view ext, std::string_view content) {
+            const asset_info& a = publish_asset(m_asset_dir, stem, ext, content);
+            std::string url = m_asset_url.empty() ? m_asset_dir : m_asset_url;
+            if (!url.empty() && url.back() != '/') {
+                url += '/';
+            }
+            url += a.file_name;
+            if (ext == ".css") {
+                _s << "<link href=\"";
+                _s.write_escaped(url, escape_context::attribute);
+                _s << "\" rel=\"stylesheet\" integrity=\"" << a.integrity << "\">" << '\n';
+            } else {
+                _s << "<script src=\"";
+                _s.write_escaped(url, escape_context::attribute);
+                _s << "\" integrity=\"" << a.integrity << "\"></script>" << '\n';
+            }
+        }
+
         bool page::has_dependency(dependency dep) const {
             return m_dependencies.count(dep) > 0;
         }
 
+        arena_scope page::use_arena(size_t initial_size) {
+            if (!m_arena) {
+                m_arena = std::make_unique<std::pmr::monotonic_buffer_resource>(initial_size);
+            }
+            return arena_scope(m_arena.get());
+        }
+
         element* page::make_copy()const {
             assert(false);
             return (element*)nullptr;
         }
 
-        void page::write_dependency_css(std::ostream& _s) {
+        element* page::make_move() {
+            assert(false);
+            return (element*)nullptr;
+        }
+
+        void page::write_dependency_css(writer& _s) {
             // Write CSS dependencies to head
             if (m_dependency_mode == dependency_mode::cdn) {
                 // CDN mode - output links
                 if (m_dependencies.count(dependency::bootstrap_css) > 0) {
-                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/css/bootstrap.min.css\" rel=\"stylesheet\">" << std::endl;
+                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/css/bootstrap.min.css\" rel=\"stylesheet\">" << '\n';
                 }
                 if (m_dependencies.count(dependency::bootstrap_icons) > 0) {
-                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap-icons@1.10.0/font/bootstrap-icons.css\" rel=\"stylesheet\">" << std::endl;
+                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap-icons@1.10.0/font/bootstrap-icons.css\" rel=\"stylesheet\">" << '\n';
                 }
                 // ApexCharts has no separate CSS file
+            } else if (m_dependency_mode == dependency_mode::external) {
+                // External mode - shared content-hashed files
+                if (m_dependencies.count(dependency::bootstrap_css) > 0) {
+                    write_asset_link(_s, "bootstrap", ".css", resources::bootstrap_css_view());
+                }
+                // Icon fonts are not bundled, keep them on the CDN
+                if (m_dependencies.count(dependency::bootstrap_icons) > 0) {
+                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap-icons@1.10.0/font/bootstrap-icons.css\" rel=\"stylesheet\">" << '\n';
+                }
             } else {
                 // Embedded mode - output inline styles
-                if (m_dependencies.count(dependency::bootstrap_css) > 0) {
-                    _s << "<style>" << std::endl;
-                    _s << resources::bootstrap_css_string();
-                    _s << std::endl << "</style>" << std::endl;
+                if (m_dependencies.count(dependency::bootstrap_css) > 0 && m_css_tree_shaking) {
+                    _s << "<style>" << '\n';
+                    css_index::bootstrap().write(_s, collect_css_usage());
+                    _s << '\n' << "</style>" << '\n';
+                } else if (m_dependencies.count(dependency::bootstrap_css) > 0) {
+                    _s << "<style>" << '\n';
+                    _s.write_precompressed(resources::bootstrap_css_view(), resources::bootstrap_css_gz_view());
+                    _s << '\n' << "</style>" << '\n';
                 }
                 // Note: bootstrap_icons would need icon font files, so keep as CDN
                 if (m_dependencies.count(dependency::bootstrap_icons) > 0) {
-                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap-icons@1.10.0/font/bootstrap-icons.css\" rel=\"stylesheet\">" << std::endl;
+                    _s << "<link href=\"https://cdn.jsdelivr.net/npm/bootstrap-icons@1.10.0/font/bootstrap-icons.css\" rel=\"stylesheet\">" << '\n';
                 }
                 // ApexCharts has no separate CSS file
             }
 
             // Write user's embedded styles
             for (const auto& css : m_styles) {
-                _s << "<style>" << std::endl;
-                _s << css << std::endl;
-                _s << "</style>" << std::endl;
+                _s << "<style>" << '\n';
+                _s << css << '\n';
+                _s << "</style>" << '\n';
             }
         }
 
-        void page::write_dependency_js(std::ostream& _s) {
+        css_usage page::collect_css_usage() {
+            // Classes Bootstrap's JavaScript adds and removes at runtime
+            static const char* const bootstrap_js_classes =
+                "show showing hiding fade collapse collapsing collapse-horizontal active disabled "
+                "modal-open modal-backdrop modal-static offcanvas-backdrop was-validated "
+                "carousel-item-next carousel-item-prev carousel-item-start carousel-item-end "
+                "tooltip tooltip-inner tooltip-arrow bs-tooltip-auto bs-tooltip-top bs-tooltip-end "
+                "bs-tooltip-bottom bs-tooltip-start popover popover-arrow popover-header popover-body "
+                "bs-popover-auto bs-popover-top bs-popover-end bs-popover-bottom bs-popover-start";
+
+            css_usage u;
+            // Written by write_html itself
+            u.add_tag("html");
+            u.add_tag("head");
+            u.add_tag("body");
+            for (const auto& e : head.m_elements) {
+                if (!e.is_run()) {
+                    u.collect(*e);
+                }
+            }
+            for (const auto& e : m_elements) {
+                if (!e.is_run()) {
+                    u.collect(*e);
+                }
+            }
+            if (m_dependencies.count(dependency::bootstrap_js) > 0) {
+                u.add_class(bootstrap_js_classes);
+            }
+            u.add_class(m_css_keep);
+            return u;
+        }
+
+        void page::write_dependency_js(writer& _s) {
             // Write JS dependencies at end of body
             if (m_dependency_mode == dependency_mode::cdn) {
                 // CDN mode - output script src links
                 if (m_dependencies.count(dependency::apexcharts_js) > 0) {
-                    _s << "<script src=\"https://cdn.jsdelivr.net/npm/apexcharts@3.44.0/dist/apexcharts.min.js\"></script>" << std::endl;
+                    _s << "<script src=\"https://cdn.jsdelivr.net/npm/apexcharts@3.44.0/dist/apexcharts.min.js\"></script>" << '\n';
+                }
+                if (m_dependencies.count(dependency::bootstrap_js) > 0) {
+                    _s << "<script src=\"https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/js/bootstrap.bundle.min.js\"></script>" << '\n';
+                }
+            } else if (m_dependency_mode == dependency_mode::external) {
+                // External mode - shared content-hashed files
+                if (m_dependencies.count(dependency::apexcharts_js) > 0) {
+                    write_asset_link(_s, "apexcharts", ".js", resources::apexcharts_js_view());
                 }
                 if (m_dependencies.count(dependency::bootstrap_js) > 0) {
-                    _s << "<script src=\"https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/js/bootstrap.bundle.min.js\"></script>" << std::endl;
+                    write_asset_link(_s, "bootstrap.bundle", ".js", resources::bootstrap_js_view());
                 }
             } else {
                 // Embedded mode - output inline scripts
                 if (m_dependencies.count(dependency::apexcharts_js) > 0) {
-                    _s << "<script>" << std::endl;
-                    _s << resources::apexcharts_js_string();
-                    _s << std::endl << "</script>" << std::endl;
+                    _s << "<script>" << '\n';
+                    _s.write_precompressed(resources::apexcharts_js_view(), resources::apexcharts_js_gz_view());
+                    _s << '\n' << "</script>" << '\n';
                 }
                 if (m_dependencies.count(dependency::bootstrap_js) > 0) {
-                    _s << "<script>" << std::endl;
-                    _s << resources::bootstrap_js_string();
-                    _s << std::endl << "</script>" << std::endl;
+                    _s << "<script>" << '\n';
+                    _s.write_precompressed(resources::bootstrap_js_view(), resources::bootstrap_js_gz_view());
+                    _s << '\n' << "</script>" << '\n';
                 }
             }
 
             // Write body scripts
             for (const auto& script : m_body_scripts) {
-                _s << "<script>" << std::endl;
-                _s << script << std::endl;
-                _s << "</script>" << std::endl;
+                _s << "<script>" << '\n';
+                _s << script << '\n';
+                _s << "</script>" << '\n';
             }
         }
 
-        void page::write_init_scripts(std::ostream& _s) {
+        void page::write_init_scripts(writer& _s) {
             if (m_init_scripts.empty()) {
                 return;
             }
-            _s << "<script>" << std::endl;
-            _s << "document.addEventListener('DOMContentLoaded', function() {" << std::endl;
+            _s << "<script>" << '\n';
+            _s << "document.addEventListener('DOMContentLoaded', function() {" << '\n';
             for (const auto& script : m_init_scripts) {
-                _s << "    " << script << std::endl;
+                _s << "    " << script << '\n';
             }
-            _s << "});" << std::endl;
-            _s << "</script>" << std::endl;
+            _s << "});" << '\n';
+            _s << "</script>" << '\n';
         }
 
-        void page::write_html(std::ostream& _s) {
-            _s << preamble << std::endl;
-            _s << "<html>" << std::endl;
+        void page::write_html(writer& _s) {
+            _s << preamble << '\n';
+            _s << "<html>" << '\n';
 
             // Write head with dependency CSS
-            _s << "<head>" << std::endl;
+            _s << "<head>" << '\n';
             write_dependency_css(_s);
             // Write head scripts
             for (const auto& script : m_head_scripts) {
-                _s << "<script>" << std::endl;
-                _s << script << std::endl;
-                _s << "</script>" << std::endl;
+                _s << "<script>" << '\n';
+                _s << script << '\n';
+                _s << "</script>" << '\n';
             }
             // Write user's head content
             for (size_t c = 0; c < head.m_elements.size(); c++) {
-                head.m_elements[c]->page(this);
-                head.m_elements[c]->write_html(_s);
-                _s << std::endl;
+                if (head.m_elements[c].is_run()) {
+                    head.m_elements[c].write(_s);
+                } else {
+                    head.m_elements[c]->page(this);
+                    head.m_elements[c]->write_html(_s);
+                }
+                _s << '\n';
             }
-            _s << "</head>" << std::endl;
+            _s << "</head>" << '\n';
 
             // Write body
-            _s << "<body>" << std::endl;
+            _s << "<body>" << '\n';
             for(size_t c = 0; c < m_elements.size(); c++) {
-                m_elements[c]->page(this);
-                m_elements[c]->write_html(_s);
-                _s << std::endl;
+                if (m_elements[c].is_run()) {
+                    m_elements[c].write(_s);
+                } else {
+                    m_elements[c]->page(this);
+                    m_elements[c]->write_html(_s);
+                }
+                _s << '\n';
             }
 
             // Write JS dependencies and init scripts at end of body
             write_dependency_js(_s);
             write_init_scripts(_s);
 
-            _s << "</body>" << std::endl;
-            _s << "</html>" << std::endl;
+            _s << "</body>" << '\n';
+            _s << "</html>" << '\n';
         }
 
         std::ostream& operator<<(std::ostream& _s, page& _p) {
-            _p.write_html(_s);
+            ostream_writer w(_s);
+            _p.write_html(w);
             return _s;
         }
 
@@ -917,32 +1753,44 @@ namespace html {
 
         // C++20 rvalue overloads - implementations
         element_group operator+(element&& lhs, element&& rhs) {
-            return operator+(lhs, rhs);
+            element_group g;
+            g.add(std::move(lhs));
+            g.add(std::move(rhs));
+            return g;
         }
 
         element_group operator+(element& lhs, element&& rhs) {
-            return operator+(lhs, rhs);
+            element_group g;
+            g.add(lhs);
+            g.add(std::move(rhs));
+            return g;
         }
 
         element_group operator+(element&& lhs, element& rhs) {
-            return operator+(lhs, rhs);
+            element_group g;
+            g.add(std::move(lhs));
+            g.add(rhs);
+            return g;
         }
 
         //////////////////////////////////////////////////////////
 
         element_group::element_group() {
             element::m_type = element_group_t;
+            element::m_writer = writer_custom;
         }
 
         element_group::element_group(element_group&& _g) noexcept
             : element(std::move(_g)) {
             element::m_type = element_group_t;
+            element::m_writer = writer_custom;
             // Elements already moved via base class move constructor
         }
 
         element_group::element_group(const element_group& _g)
             : element(_g) {
             element::m_type = element_group_t;
+            element::m_writer = writer_custom;
             // Elements already copied via base class copy constructor
         }
 
@@ -952,4 +1800,87 @@ namespace html {
             return ele_ptr;
         }
 
+        element* element_group::make_move() {
+            element_group* ele_ptr = new element_group(std::move(*this));
+            return ele_ptr;
+        }
+
+        //////////////////////////////////////////////////////////////////////////////
+
+        static_fragment::static_fragment() {
+            m_type = static_fragment_t;
+            m_writer = writer_custom;
+            m_is_container = false;
+        }
+
+        static_fragment::static_fragment(element& _e) {
+            m_type = static_fragment_t;
+            m_writer = writer_custom;
+            m_is_container = false;
+            std::string s;
+            {
+                string_writer w(s);
+                _e.write_html(w);
+            }
+            m_bytes = std::make_shared<const std::string>(std::move(s));
+        }
+
+        element* static_fragment::make_copy() const {
+            static_fragment* ptr = new static_fragment();
+            ptr->copy(*this);
+            ptr->m_bytes = m_bytes;
+            return ptr;
+        }
+
+        element* static_fragment::make_move() {
+            static_fragment* ptr = new static_fragment();
+            ptr->move(std::move(*this));
+            ptr->m_bytes = std::move(m_bytes);
+            return ptr;
+        }
+
+        //////////////////////////////////////////////////////////////////////////////
+
+        shared_subtree::shared_subtree() {
+            m_type = shared_subtree_t;
+            m_writer = writer_custom;
+            m_is_container = false;
+        }
+
+        shared_subtree::shared_subtree(const element& _e) : shared_subtree() {
+            m_node.reset(_e.make_copy());
+            m_node->parent(nullptr);
+        }
+
+        shared_subtree::shared_subtree(element&& _e) : shared_subtree() {
+            m_node.reset(_e.make_move());
+            m_node->parent(nullptr);
+        }
+
+        element& shared_subtree::edit() {
+            if(!m_node) {
+                throw std::runtime_error("shared_subtree: empty");
+            }
+            if(m_node.use_count() > 1) {
+                // Other copies keep the old nodes
+                m_node.reset(m_node->make_copy());
+                m_node->parent(nullptr);
+            }
+            return *m_node;
+        }
+
+        element* shared_subtree::make_copy() const {
+            shared_subtree* ptr = new shared_subtree();
+            ptr->copy(*this);
+            ptr->m_node = m_node;
+            return ptr;
+        }
+
+        element* shared_subtree::make_move() {
+            shared_subtree* ptr = new shared_subtree();
+            ptr->move(std::move(*this));
+            ptr->m_node = std::move(m_node);
+            return ptr;
+        }
+
 }
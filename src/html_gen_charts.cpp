@@ -23,7 +23,7 @@ namespace chart {
         m_values.push_back(value);
     }
 
-    std::string line_chart::html() {
+    html::raw_html line_chart::html() {
         if (m_values.empty()) {
             throw std::runtime_error("line_chart: no data added");
         }
@@ -37,7 +37,7 @@ namespace chart {
         std::string data;
         for (size_t i = 0; i < m_values.size(); i++) {
             if (i > 0) data += ", ";
-            data += std::to_string(m_values[i]);
+            data += html::number(m_values[i]).view();
         }
 
         // Generate ApexCharts script
@@ -65,7 +65,7 @@ chart_{0}.render();
         html::element_group group;
         group << html::div().id(m_id);
         group << html::script(script);
-        return group.html();
+        return html::raw_html(group.html());
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -82,7 +82,7 @@ chart_{0}.render();
         m_timestamps.push_back(ts);
     }
 
-    std::string timeseries_line_chart::html() {
+    html::raw_html timeseries_line_chart::html() {
         if (m_values.empty()) {
             throw std::runtime_error("timeseries_line_chart: no data added");
         }
@@ -133,7 +133,7 @@ chart_{0}.render();
         html::element_group group;
         group << html::div().id(m_id);
         group << html::script(script);
-        return group.html();
+        return html::raw_html(group.html());
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -149,7 +149,7 @@ chart_{0}.render();
         m_categories.push_back(category);
     }
 
-    std::string bar_chart::html() {
+    html::raw_html bar_chart::html() {
         if (m_values.empty()) {
             throw std::runtime_error("bar_chart: no data added");
         }
@@ -163,7 +163,7 @@ chart_{0}.render();
         std::string data;
         for (size_t i = 0; i < m_values.size(); i++) {
             if (i > 0) data += ", ";
-            data += std::to_string(m_values[i]);
+            data += html::number(m_values[i]).view();
         }
 
         // Build categories array
@@ -202,7 +202,7 @@ chart_{0}.render();
         html::element_group group;
         group << html::div().id(m_id);
         group << html::script(script);
-        return group.html();
+        return html::raw_html(group.html());
     }
 
 }
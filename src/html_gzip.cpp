@@ -0,0 +1,218 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_gzip.h"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef HTML_GEN_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+        // CRC-32 (IEEE 802.3), as used in the gzip trailer
+
+        namespace {
+            struct crc_table {
+                std::uint32_t v[256];
+                constexpr crc_table() : v() {
+                    for(std::uint32_t n = 0; n < 256; n++) {
+                        std::uint32_t c = n;
+                        for(int k = 0; k < 8; k++) {
+                            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                        }
+                        v[n] = c;
+                    }
+                }
+            };
+            constexpr crc_table s_crc;
+        }
+
+        namespace detail {
+            std::uint32_t crc32(std::uint32_t _crc, const char* _p, size_t _n) {
+                std::uint32_t c = _crc ^ 0xFFFFFFFFu;
+                for(size_t i = 0; i < _n; i++) {
+                    c = s_crc.v[(c ^ static_cast<unsigned char>(_p[i])) & 0xFF] ^ (c >> 8);
+                }
+                return c ^ 0xFFFFFFFFu;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // gzip_writer
+
+#ifdef HTML_GEN_HAVE_ZLIB
+        struct gzip_writer::state {
+            z_stream zs;
+            char out[16 * 1024];
+
+            explicit state(int _level) : zs() {
+                // windowBits 15 + 16: zlib writes the gzip header and trailer
+                if(deflateInit2(&zs, _level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                    throw std::runtime_error("gzip_writer: deflateInit2 failed");
+                }
+            }
+            ~state() {
+                deflateEnd(&zs);
+            }
+            void run(writer& _out, const char* _p, size_t _n, int _flush) {
+                zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(_p));
+                zs.avail_in = static_cast<uInt>(_n);
+                do {
+                    zs.next_out = reinterpret_cast<Bytef*>(out);
+                    zs.avail_out = sizeof(out);
+                    int rc = deflate(&zs, _flush);
+                    if(rc == Z_STREAM_ERROR) {
+                        throw std::runtime_error("gzip_writer: deflate failed");
+                    }
+                    _out.write(out, sizeof(out) - zs.avail_out);
+                } while(zs.avail_out == 0 || zs.avail_in > 0);
+            }
+        };
+#else
+        struct gzip_writer::state {
+            std::uint32_t crc;
+            std::uint32_t size;
+
+            explicit state(int) : crc(0), size(0) { ; }
+        };
+
+        namespace {
+            void put_le32(writer& _w, std::uint32_t _v) {
+                char b[4] = {
+                    static_cast<char>(_v & 0xFF), static_cast<char>((_v >> 8) & 0xFF),
+                    static_cast<char>((_v >> 16) & 0xFF), static_cast<char>((_v >> 24) & 0xFF)
+                };
+                _w.write(b, 4);
+            }
+        }
+#endif
+
+        gzip_writer::gzip_writer(writer& _out, int _level, size_t _capacity)
+            :
+            buffered_writer(_capacity),
+            m_out(_out),
+            m_state(new state(_level)),
+            m_in_member(false),
+            m_finished(false),
+            m_members(0) {
+            ;
+        }
+
+        gzip_writer::~gzip_writer() {
+            try {
+                finish();
+            } catch(...) {
+                ;
+            }
+        }
+
+        bool gzip_writer::compresses() {
+#ifdef HTML_GEN_HAVE_ZLIB
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        void gzip_writer::begin_member() {
+#ifndef HTML_GEN_HAVE_ZLIB
+            // ID1 ID2 CM=deflate FLG=0 MTIME=0 XFL=0 OS=unknown
+            static const char header[10] = { '\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff' };
+            m_out.write(header, sizeof(header));
+            m_state->crc = 0;
+            m_state->size = 0;
+#endif
+            m_in_member = true;
+            m_members++;
+        }
+
+        void gzip_writer::end_member() {
+#ifdef HTML_GEN_HAVE_ZLIB
+            m_state->run(m_out, nullptr, 0, Z_FINISH);
+            deflateReset(&m_state->zs);
+#else
+            // Final empty stored block, then CRC32 and ISIZE
+            static const char last_block[5] = { 1, 0, 0, '\xff', '\xff' };
+            m_out.write(last_block, sizeof(last_block));
+            put_le32(m_out, m_state->crc);
+            put_le32(m_out, m_state->size);
+#endif
+            m_in_member = false;
+        }
+
+        void gzip_writer::consume(const char* _p, size_t _n) {
+            if(m_finished) {
+                throw std::runtime_error("gzip_writer: write after finish()");
+            }
+            if(!m_in_member) {
+                begin_member();
+            }
+#ifdef HTML_GEN_HAVE_ZLIB
+            m_state->run(m_out, _p, _n, Z_NO_FLUSH);
+#else
+            m_state->crc = detail::crc32(m_state->crc, _p, _n);
+            m_state->size += static_cast<std::uint32_t>(_n);
+            while(_n > 0) {
+                // Stored block: BFINAL=0 BTYPE=00, LEN, NLEN, data
+                size_t len = std::min<size_t>(_n, 0xFFFF);
+                char hdr[5] = {
+                    0,
+                    static_cast<char>(len & 0xFF), static_cast<char>(len >> 8),
+                    static_cast<char>(~len & 0xFF), static_cast<char>((~len >> 8) & 0xFF)
+                };
+                m_out.write(hdr, sizeof(hdr));
+                m_out.write(_p, len);
+                _p += len;
+                _n -= len;
+            }
+#endif
+        }
+
+        void gzip_writer::write_precompressed(std::string_view _raw, std::string_view _gzip_member) {
+            (void)_raw;
+            if(m_finished) {
+                throw std::runtime_error("gzip_writer: write after finish()");
+            }
+            // Close the running member and splice the ready-made one in as-is
+            drain();
+            if(m_in_member) {
+                end_member();
+            }
+            m_out.write_ref(_gzip_member);
+            m_members++;
+        }
+
+        void gzip_writer::flush() {
+            drain();
+#ifdef HTML_GEN_HAVE_ZLIB
+            if(m_in_member && !m_finished) {
+                m_state->run(m_out, nullptr, 0, Z_SYNC_FLUSH);
+            }
+#endif
+            m_out.flush();
+        }
+
+        void gzip_writer::finish() {
+            if(m_finished) {
+                return;
+            }
+            drain();
+            if(m_in_member) {
+                end_member();
+            } else if(m_members == 0) {
+                // An empty page still needs one (empty) member
+                begin_member();
+                end_member();
+            }
+            m_finished = true;
+            m_out.flush();
+        }
+
+}
@@ -0,0 +1,457 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_query.h"
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace html {
+
+        namespace {
+            inline bool is_space(char _c) {
+                return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\r' || _c == '\f';
+            }
+
+            inline bool is_name_char(char _c) {
+                return std::isalnum(static_cast<unsigned char>(_c)) || _c == '-' || _c == '_' ||
+                       static_cast<unsigned char>(_c) >= 0x80;
+            }
+
+            [[noreturn]] void fail(std::string_view _text, const char* _what) {
+                throw std::runtime_error("invalid selector \"" + std::string(_text) + "\": " + _what);
+            }
+
+            bool contains_class(std::string_view _list, std::string_view _c) {
+                size_t p = 0;
+                while((p = _list.find(_c, p)) != std::string_view::npos) {
+                    size_t e = p + _c.size();
+                    if((p == 0 || is_space(_list[p - 1])) && (e == _list.size() || is_space(_list[e]))) {
+                        return true;
+                    }
+                    p = e;
+                }
+                return false;
+            }
+
+            // "an+b", "odd", "even", "3", "-n+2" ...
+            selector::nth_test parse_nth(std::string_view _text, std::string_view _arg, bool _from_end) {
+                std::string s;
+                for(char c : _arg) {
+                    if(!is_space(c)) {
+                        s += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                    }
+                }
+                if(s == "odd") {
+                    return selector::nth_test{2, 1, _from_end};
+                }
+                if(s == "even") {
+                    return selector::nth_test{2, 0, _from_end};
+                }
+                auto number = [&](std::string_view _n, int _default) {
+                    if(_n.empty() || _n == "+") {
+                        return _default;
+                    }
+                    if(_n == "-") {
+                        return -_default;
+                    }
+                    size_t p = (_n[0] == '+' || _n[0] == '-') ? 1 : 0;
+                    if(p == _n.size()) {
+                        fail(_text, "bad :nth-child argument");
+                    }
+                    int v = 0;
+                    for(; p < _n.size(); p++) {
+                        if(!std::isdigit(static_cast<unsigned char>(_n[p]))) {
+                            fail(_text, "bad :nth-child argument");
+                        }
+                        v = v * 10 + (_n[p] - '0');
+                    }
+                    return _n[0] == '-' ? -v : v;
+                };
+                size_t n = s.find('n');
+                if(n == std::string::npos) {
+                    return selector::nth_test{0, number(s, 0), _from_end};
+                }
+                std::string_view sv(s);
+                int a = number(sv.substr(0, n), 1);
+                std::string_view rest = sv.substr(n + 1);
+                if(!rest.empty() && rest[0] != '+' && rest[0] != '-') {
+                    fail(_text, "bad :nth-child argument");
+                }
+                return selector::nth_test{a, number(rest, 0), _from_end};
+            }
+
+            bool nth_matches(const selector::nth_test& _t, int _pos) {
+                if(_t.a == 0) {
+                    return _pos == _t.b;
+                }
+                int d = _pos - _t.b;
+                return d % _t.a == 0 && d / _t.a >= 0;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // selector
+
+        selector::selector(std::string_view _text) {
+            std::string_view s = _text;
+            size_t p = 0;
+            complex current;
+            char pending = 0;
+            auto skip_space = [&] {
+                bool any = false;
+                while(p < s.size() && is_space(s[p])) {
+                    p++;
+                    any = true;
+                }
+                return any;
+            };
+            auto read_name = [&] {
+                size_t b = p;
+                while(p < s.size() && is_name_char(s[p])) {
+                    p++;
+                }
+                if(p == b) {
+                    fail(_text, "name expected");
+                }
+                return std::string(s.substr(b, p - b));
+            };
+            skip_space();
+            while(true) {
+                if(p >= s.size() || s[p] == ',') {
+                    if(current.empty() || pending == '>') {
+                        fail(_text, "empty selector");
+                    }
+                    m_list.push_back(std::move(current));
+                    current.clear();
+                    pending = 0;
+                    if(p >= s.size()) {
+                        break;
+                    }
+                    p++;
+                    skip_space();
+                    continue;
+                }
+                compound c{undefined_t, false, {}, {}, {}, {}, current.empty() ? char(0) : (pending ? pending : ' ')};
+                bool any = false;
+                if(s[p] == '*') {
+                    p++;
+                    any = true;
+                } else if(is_name_char(s[p])) {
+                    std::string name = read_name();
+                    for(auto& ch : name) {
+                        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+                    }
+                    c.type = element::tag_type(name);
+                    c.unknown_type = c.type == undefined_t;
+                    any = true;
+                }
+                while(p < s.size()) {
+                    char ch = s[p];
+                    if(ch == '.') {
+                        p++;
+                        c.classes.push_back(read_name());
+                    } else if(ch == '#') {
+                        p++;
+                        c.id = read_name();
+                    } else if(ch == '[') {
+                        p++;
+                        skip_space();
+                        attr_test t{attribute_list::intern(read_name()), false, {}};
+                        skip_space();
+                        if(p < s.size() && s[p] == '=') {
+                            p++;
+                            skip_space();
+                            t.has_value = true;
+                            if(p < s.size() && (s[p] == '"' || s[p] == '\'')) {
+                                size_t q = s.find(s[p], p + 1);
+                                if(q == std::string_view::npos) {
+                                    fail(_text, "unterminated string");
+                                }
+                                t.value = std::string(s.substr(p + 1, q - p - 1));
+                                p = q + 1;
+                            } else {
+                                t.value = read_name();
+                            }
+                            skip_space();
+                        }
+                        if(p >= s.size() || s[p] != ']') {
+                            fail(_text, "']' expected");
+                        }
+                        p++;
+                        c.attrs.push_back(std::move(t));
+                    } else if(ch == ':') {
+                        p++;
+                        std::string name = read_name();
+                        if(name == "first-child") {
+                            c.nth.push_back(nth_test{0, 1, false});
+                        } else if(name == "last-child") {
+                            c.nth.push_back(nth_test{0, 1, true});
+                        } else if(name == "nth-child" || name == "nth-last-child") {
+                            size_t close = s.find(')', p);
+                            if(p >= s.size() || s[p] != '(' || close == std::string_view::npos) {
+                                fail(_text, "'(' expected");
+                            }
+                            c.nth.push_back(parse_nth(_text, s.substr(p + 1, close - p - 1), name == "nth-last-child"));
+                            p = close + 1;
+                        } else {
+                            fail(_text, "unsupported pseudo-class");
+                        }
+                    } else {
+                        break;
+                    }
+                    any = true;
+                }
+                if(!any) {
+                    fail(_text, "unsupported syntax");
+                }
+                current.push_back(std::move(c));
+                // Combinator (or the end of this selector)
+                bool space = skip_space();
+                pending = space ? ' ' : 0;
+                if(p < s.size() && s[p] == '>') {
+                    p++;
+                    skip_space();
+                    pending = '>';
+                } else if(p < s.size() && s[p] != ',' && !space) {
+                    fail(_text, "unsupported syntax");
+                }
+            }
+        }
+
+        bool selector::is_element(const element& _e) {
+            // Text, groups and fragments have no tag
+            return _e.m_type != undefined_t && !_e.tag().empty();
+        }
+
+        int selector::child_position(const element& _e, bool _from_end) {
+            const element* parent = _e.m_parent_ptr;
+            int pos = 0;
+            size_t n = parent->m_elements.size();
+            for(size_t i = 0; i < n; i++) {
+                const detail::child& slot = parent->m_elements[_from_end ? n - 1 - i : i];
+                if(slot.is_run()) {
+                    continue;
+                }
+                const element* c = slot.get();
+                if(is_element(*c)) {
+                    pos++;
+                }
+                if(c == &_e) {
+                    return pos;
+                }
+            }
+            return 0;
+        }
+
+        bool selector::match_compound(const compound& _c, const element& _e) {
+            if(_c.unknown_type) {
+                return false;
+            }
+            if(_c.type != undefined_t) {
+                if(_e.m_type != _c.type) {
+                    return false;
+                }
+            } else if(!is_element(_e)) {
+                return false;
+            }
+            if(!_c.id.empty() && _e.id() != _c.id) {
+                return false;
+            }
+            if(!_c.classes.empty()) {
+                std::string_view list = _e.cl();
+                for(const auto& cls : _c.classes) {
+                    if(!contains_class(list, cls)) {
+                        return false;
+                    }
+                }
+            }
+            for(const auto& a : _c.attrs) {
+                if(!_e.m_attributes.has(a.id) || (a.has_value && _e.m_attributes.get(a.id) != a.value)) {
+                    return false;
+                }
+            }
+            for(const auto& n : _c.nth) {
+                if(!_e.m_parent_ptr || !nth_matches(n, child_position(_e, n.from_end))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool selector::match_complex(const complex& _c, size_t _k, const element& _e) {
+            if(!match_compound(_c[_k], _e)) {
+                return false;
+            }
+            if(_k == 0) {
+                return true;
+            }
+            const element* p = _e.m_parent_ptr;
+            if(_c[_k].combinator == '>') {
+                return p && match_complex(_c, _k - 1, *p);
+            }
+            for(; p; p = p->m_parent_ptr) {
+                if(match_complex(_c, _k - 1, *p)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool selector::matches(const element& _e)const {
+            for(const auto& c : m_list) {
+                if(match_complex(c, c.size() - 1, _e)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////
+        // element queries
+
+        void selector::collect(element& _root, std::vector<element*>& _out, bool _first)const {
+            // Text and text runs never match; runs are passed over as they are
+            struct matcher {
+                const selector& sel;
+                std::vector<element*>& out;
+                element* root;
+                bool first;
+                visitor::action enter(element& _e) {
+                    if(&_e != root && sel.matches(_e)) {
+                        out.push_back(&_e);
+                        if(first) {
+                            return visitor::stop;
+                        }
+                    }
+                    return visitor::descend;
+                }
+                void leave(element&) { ; }
+                visitor::action text(element& _e) { return enter(_e); }
+                visitor::action run(const detail::child&) { return visitor::descend; }
+            };
+            matcher m{*this, _out, &_root, _first};
+            element::walk(_root, m);
+        }
+
+        void selector::document_order(std::vector<element*>& _nodes, detail::tree_index& _index) {
+            if(_nodes.size() < 2) {
+                return;
+            }
+            std::vector<std::pair<std::vector<std::uint32_t>, element*>> keys;
+            keys.reserve(_nodes.size());
+            for(element* e : _nodes) {
+                std::vector<std::uint32_t> path;
+                for(const element* n = e; n != _index.root() && n->m_parent_ptr; n = n->m_parent_ptr) {
+                    path.push_back(_index.position(n));
+                }
+                std::reverse(path.begin(), path.end());
+                keys.emplace_back(std::move(path), e);
+            }
+            std::sort(keys.begin(), keys.end());
+            for(size_t i = 0; i < keys.size(); i++) {
+                _nodes[i] = keys[i].second;
+            }
+        }
+
+        std::vector<element*> element::query_selector_all(const html::selector& _s) {
+            std::vector<element*> out;
+            if(!m_index) {
+                _s.collect(*this, out, false);
+                return out;
+            }
+            // Candidates for the rightmost compound of each selector, from the index
+            std::unordered_set<element*> seen;
+            for(const auto& c : _s.list()) {
+                const selector::compound& last = c.back();
+                std::vector<element*> single;
+                const detail::tree_index::node_set* from = nullptr;
+                if(last.unknown_type) {
+                    continue;
+                }
+                if(!last.id.empty()) {
+                    element* e = nullptr;
+                    if(!m_index->lookup(last.id, e)) {
+                        // Duplicated id: no shortcut
+                        out.clear();
+                        _s.collect(*this, out, false);
+                        return out;
+                    }
+                    if(e) {
+                        single.push_back(e);
+                    }
+                } else if(!last.classes.empty()) {
+                    for(const auto& cls : last.classes) {
+                        const detail::tree_index::node_set* set = m_index->classed(cls);
+                        if(!set) {
+                            from = nullptr;
+                            break;
+                        }
+                        if(!from || set->size() < from->size()) {
+                            from = set;
+                        }
+                    }
+                    if(!from) {
+                        continue;
+                    }
+                } else if(last.type != undefined_t) {
+                    from = m_index->tagged(last.type);
+                    if(!from) {
+                        continue;
+                    }
+                } else {
+                    // Nothing to start from
+                    out.clear();
+                    _s.collect(*this, out, false);
+                    return out;
+                }
+                auto consider = [&](element* _e) {
+                    if(_e == this || seen.count(_e) || !selector::match_complex(c, c.size() - 1, *_e)) {
+                        return;
+                    }
+                    for(element* p = _e->m_parent_ptr; p; p = p->m_parent_ptr) {
+                        if(p == this) {
+                            seen.insert(_e);
+                            out.push_back(_e);
+                            return;
+                        }
+                    }
+                };
+                if(from) {
+                    for(element* e : *from) {
+                        consider(e);
+                    }
+                } else {
+                    for(element* e : single) {
+                        consider(e);
+                    }
+                }
+            }
+            selector::document_order(out, *m_index);
+            return out;
+        }
+
+        std::vector<element*> element::query_selector_all(std::string_view _s) {
+            return query_selector_all(html::selector(_s));
+        }
+
+        element* element::query_selector(const html::selector& _s) {
+            std::vector<element*> out;
+            if(!m_index) {
+                _s.collect(*this, out, true);
+                return out.empty() ? nullptr : out.front();
+            }
+            out = query_selector_all(_s);
+            return out.empty() ? nullptr : out.front();
+        }
+
+        element* element::query_selector(std::string_view _s) {
+            return query_selector(html::selector(_s));
+        }
+
+}
@@ -0,0 +1,107 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_stream.h"
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+
+        void write_chunked(element& _e, size_t _chunk_size, const callback_writer::callback& _cb) {
+            callback_writer w(_cb, _chunk_size);
+            _e.write_html(w);
+            w.flush();
+        }
+
+        /////////////////////////////////////////////////////////////
+        // chunk_stream
+
+        namespace {
+            // Thrown from the writer callback to unwind an abandoned render
+            struct stream_cancelled { ; };
+        }
+
+        chunk_stream::chunk_stream(element& _e, size_t _chunk_size, size_t _max_pending)
+            :
+            m_chunk_size(_chunk_size > 0 ? _chunk_size : 1),
+            m_max_pending(_max_pending > 0 ? _max_pending : 1),
+            m_done(false),
+            m_cancelled(false) {
+            m_worker = std::thread([this, &_e]() { produce(_e); });
+        }
+
+        chunk_stream::~chunk_stream() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cancelled = true;
+            }
+            m_cv.notify_all();
+            if(m_worker.joinable()) {
+                m_worker.join();
+            }
+        }
+
+        void chunk_stream::produce(element& _e) {
+            try {
+                callback_writer w([this](std::string_view _s) { push(_s); }, m_chunk_size);
+                _e.write_html(w);
+                w.flush();
+            } catch(const stream_cancelled&) {
+                ;
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done = true;
+            }
+            m_cv.notify_all();
+        }
+
+        void chunk_stream::push(std::string_view _chunk) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // Backpressure: wait for the consumer to take a chunk
+            m_cv.wait(lock, [this]() { return m_cancelled || m_pending.size() < m_max_pending; });
+            if(m_cancelled) {
+                throw stream_cancelled();
+            }
+            std::string buf;
+            if(!m_free.empty()) {
+                buf = std::move(m_free.back());
+                m_free.pop_back();
+            }
+            buf.assign(_chunk.data(), _chunk.size());
+            m_pending.push_back(std::move(buf));
+            lock.unlock();
+            m_cv.notify_all();
+        }
+
+        bool chunk_stream::next(std::string& _chunk) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return !m_pending.empty() || m_done; });
+            if(m_pending.empty()) {
+                if(m_error) {
+                    std::exception_ptr e = m_error;
+                    m_error = nullptr;
+                    std::rethrow_exception(e);
+                }
+                return false;
+            }
+            // Hand over the chunk and keep the caller's previous buffer for reuse
+            std::string previous = std::move(_chunk);
+            _chunk = std::move(m_pending.front());
+            m_pending.pop_front();
+            if(previous.capacity() > 0 && m_free.size() < m_max_pending) {
+                m_free.push_back(std::move(previous));
+            }
+            lock.unlock();
+            m_cv.notify_all();
+            return true;
+        }
+
+}
@@ -0,0 +1,229 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_template.h"
+#include <stdexcept>
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+        // Slot markers: \x01 <kind> <name> \x02
+        // Control characters never appear in valid markup and pass through
+        // text and attribute escaping unchanged.
+
+        namespace {
+            const char marker_begin = '\x01';
+            const char marker_end = '\x02';
+
+            char kind_code(slot_kind _kind, escape_context _ctx) {
+                if(_kind == slot_kind::tree) {
+                    return 'e';
+                }
+                if(_kind == slot_kind::attribute) {
+                    return 'a';
+                }
+                switch(_ctx) {
+                    case escape_context::script:    return 's';
+                    case escape_context::style:     return 'y';
+                    case escape_context::attribute: return 'a';
+                    default:                        return 't';
+                }
+            }
+
+            std::string make_marker(char _code, std::string_view _name) {
+                if(_name.empty() || _name.find(marker_end) != std::string_view::npos) {
+                    throw std::runtime_error("slot: invalid name");
+                }
+                std::string s;
+                s.reserve(_name.size() + 3);
+                s += marker_begin;
+                s += _code;
+                s += _name;
+                s += marker_end;
+                return s;
+            }
+        }
+
+        void slot::write_html(writer& _s) {
+            if(m_kind == slot_kind::tree && _s.context() != escape_context::text) {
+                throw std::runtime_error("slot: subtree slot inside script or style");
+            }
+            _s.write(make_marker(kind_code(m_kind, _s.context()), m_name));
+        }
+
+        std::string attr_slot(std::string_view _name) {
+            return make_marker('a', _name);
+        }
+
+        /////////////////////////////////////////////////////////////
+        // page_template
+
+        page_template::page_template(element& _e) {
+            std::string s;
+            {
+                string_writer w(s);
+                _e.write_html(w);
+            }
+            compile(s);
+        }
+
+        void page_template::compile(const std::string& _html) {
+            m_static.reserve(_html.size());
+            size_t pos = 0;
+            size_t run_start = 0;
+            while(true) {
+                size_t b = _html.find(marker_begin, pos);
+                if(b == std::string::npos) {
+                    break;
+                }
+                size_t e = _html.find(marker_end, b + 1);
+                if(e == std::string::npos || e < b + 3) {
+                    throw std::runtime_error("page_template: malformed slot marker");
+                }
+                char code = _html[b + 1];
+                std::string_view name(_html.data() + b + 2, e - b - 2);
+
+                escape_context ctx;
+                bool tree = false;
+                switch(code) {
+                    case 't': ctx = escape_context::text;      break;
+                    case 'a': ctx = escape_context::attribute; break;
+                    case 's': ctx = escape_context::script;    break;
+                    case 'y': ctx = escape_context::style;     break;
+                    case 'e': ctx = escape_context::text; tree = true; break;
+                    default:
+                        throw std::runtime_error("page_template: malformed slot marker");
+                }
+
+                size_t idx;
+                auto it = m_index.find(name);
+                if(it == m_index.end()) {
+                    idx = m_slots.size();
+                    m_slots.push_back(slot_info{ std::string(name), tree });
+                    m_index.emplace(std::string(name), idx);
+                } else {
+                    idx = it->second;
+                    if(m_slots[idx].tree != tree) {
+                        throw std::runtime_error("page_template: slot '" + std::string(name) + "' used as both text and subtree");
+                    }
+                }
+
+                segment seg;
+                seg.offset = m_static.size();
+                m_static.append(_html, run_start, b - run_start);
+                seg.length = m_static.size() - seg.offset;
+                seg.slot = idx;
+                seg.context = ctx;
+                m_segments.push_back(seg);
+
+                pos = e + 1;
+                run_start = pos;
+            }
+            segment tail;
+            tail.offset = m_static.size();
+            m_static.append(_html, run_start, std::string::npos);
+            tail.length = m_static.size() - tail.offset;
+            tail.slot = npos;
+            tail.context = escape_context::text;
+            m_segments.push_back(tail);
+            m_static.shrink_to_fit();
+        }
+
+        size_t page_template::slot_index(std::string_view _name)const {
+            auto it = m_index.find(_name);
+            return it == m_index.end() ? npos : it->second;
+        }
+
+        void page_template::render(writer& _w, const slot_values& _v)const {
+            if(&_v.m_template != this) {
+                throw std::runtime_error("page_template: values belong to another template");
+            }
+            const char* base = m_static.data();
+            for(const auto& seg : m_segments) {
+                _w.write(base + seg.offset, seg.length);
+                if(seg.slot == npos) {
+                    continue;
+                }
+                const slot_values::value& v = _v.m_values[seg.slot];
+                if(m_slots[seg.slot].tree) {
+                    if(v.tree) {
+                        escape_context prev = _w.context();
+                        _w.context(escape_context::text);
+                        v.tree->write_html(_w);
+                        _w.context(prev);
+                    }
+                } else {
+                    _w.write_escaped(v.text, seg.context);
+                }
+            }
+        }
+
+        std::string page_template::render(const slot_values& _v)const {
+            std::string s;
+            {
+                string_writer w(s);
+                render(w, _v);
+            }
+            return s;
+        }
+
+        /////////////////////////////////////////////////////////////
+        // slot_values
+
+        slot_values::slot_values(const page_template& _t)
+            :
+            m_template(_t),
+            m_values(_t.slot_count()) {
+            ;
+        }
+
+        slot_values& slot_values::set(size_t _idx, std::string_view _value) {
+            if(_idx >= m_values.size()) {
+                throw std::runtime_error("slot_values: slot index out of range");
+            }
+            if(m_template.is_tree_slot(_idx)) {
+                throw std::runtime_error("slot_values: '" + m_template.slot_name(_idx) + "' expects a subtree");
+            }
+            m_values[_idx].text.assign(_value.data(), _value.size());
+            return *this;
+        }
+
+        slot_values& slot_values::set(size_t _idx, element& _tree) {
+            if(_idx >= m_values.size()) {
+                throw std::runtime_error("slot_values: slot index out of range");
+            }
+            if(!m_template.is_tree_slot(_idx)) {
+                throw std::runtime_error("slot_values: '" + m_template.slot_name(_idx) + "' expects a string");
+            }
+            m_values[_idx].tree = &_tree;
+            return *this;
+        }
+
+        slot_values& slot_values::set(std::string_view _name, std::string_view _value) {
+            size_t idx = m_template.slot_index(_name);
+            if(idx == page_template::npos) {
+                throw std::runtime_error("slot_values: no slot named '" + std::string(_name) + "'");
+            }
+            return set(idx, _value);
+        }
+
+        slot_values& slot_values::set(std::string_view _name, element& _tree) {
+            size_t idx = m_template.slot_index(_name);
+            if(idx == page_template::npos) {
+                throw std::runtime_error("slot_values: no slot named '" + std::string(_name) + "'");
+            }
+            return set(idx, _tree);
+        }
+
+        void slot_values::clear() {
+            for(auto& v : m_values) {
+                v.text.clear();
+                v.tree = nullptr;
+            }
+        }
+
+}
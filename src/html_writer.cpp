@@ -0,0 +1,254 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*/
+
+#include "../include/html_writer.h"
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace html {
+
+        /////////////////////////////////////////////////////////////
+        // writer
+
+        void writer::write_slow(const char* _p, size_t _n) {
+            while(_n > 0) {
+                if(m_pos == m_end && !overflow(_n)) {
+                    m_failed = true;
+                    return;
+                }
+                size_t chunk = std::min(_n, static_cast<size_t>(m_end - m_pos));
+                std::memcpy(m_pos, _p, chunk);
+                m_pos += chunk;
+                _p += chunk;
+                _n -= chunk;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // string_writer
+
+        string_writer::string_writer()
+            :
+            m_out(m_own) {
+            ;
+        }
+
+        string_writer::string_writer(std::string& _out)
+            :
+            m_out(_out) {
+            ;
+        }
+
+        string_writer::~string_writer() {
+            flush();
+        }
+
+        bool string_writer::overflow(size_t _need) {
+            // Grow the string itself and keep writing into its storage
+            size_t used = m_pos ? static_cast<size_t>(m_pos - m_out.data()) : m_out.size();
+            size_t grow = std::max(_need, std::max<size_t>(m_out.size(), 256));
+            m_out.resize(used + grow);
+            m_pos = m_out.data() + used;
+            m_end = m_out.data() + m_out.size();
+            return true;
+        }
+
+        void string_writer::flush() {
+            if(m_pos) {
+                m_out.resize(static_cast<size_t>(m_pos - m_out.data()));
+                m_pos = m_end = nullptr;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////
+        // buffered_writer
+
+        buffered_writer::buffered_writer(size_t _capacity)
+            :
+            m_buffer(new char[_capacity > 0 ? _capacity : 1]),
+            m_capacity(_capacity > 0 ? _capacity : 1) {
+            m_pos = m_buffer.get();
+            m_end = m_buffer.get() + m_capacity;
+        }
+
+        bool buffered_writer::overflow(size_t) {
+            drain();
+            return true;
+        }
+
+        void buffered_writer::drain() {
+            size_t n = static_cast<size_t>(m_pos - m_buffer.get());
+            m_pos = m_buffer.get();
+            if(n > 0) {
+                consume(m_buffer.get(), n);
+            }
+        }
+
+        void buffered_writer::flush() {
+            drain();
+        }
+
+        void buffered_writer::consume_parts(const std::string_view* _parts, size_t _count) {
+            // Slices keep every block within the buffer capacity
+            for(size_t i = 0; i < _count; i++) {
+                std::string_view p = _parts[i];
+                while(!p.empty()) {
+                    size_t n = std::min(p.size(), m_capacity);
+                    consume(p.data(), n);
+                    p.remove_prefix(n);
+                }
+            }
+        }
+
+        void buffered_writer::write_ref(std::string_view _s) {
+            if(_s.size() < m_capacity / 4) {
+                write(_s);
+                return;
+            }
+            std::string_view parts[2] = {
+                std::string_view(m_buffer.get(), static_cast<size_t>(m_pos - m_buffer.get())),
+                _s
+            };
+            m_pos = m_buffer.get();
+            consume_parts(parts, 2);
+        }
+
+        /////////////////////////////////////////////////////////////
+        // fd_writer
+
+        fd_writer::fd_writer(int _fd, size_t _capacity)
+            :
+            buffered_writer(_capacity),
+            m_fd(_fd) {
+            ;
+        }
+
+        fd_writer::~fd_writer() {
+            try {
+                flush();
+            } catch(...) {
+                ;
+            }
+        }
+
+        void fd_writer::consume(const char* _p, size_t _n) {
+            while(_n > 0) {
+#ifdef _WIN32
+                int written = ::_write(m_fd, _p, static_cast<unsigned int>(std::min<size_t>(_n, 1u << 30)));
+#else
+                ssize_t written = ::write(m_fd, _p, _n);
+#endif
+                if(written < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    m_failed = true;
+                    throw std::runtime_error("fd_writer: write failed");
+                }
+                _p += written;
+                _n -= static_cast<size_t>(written);
+            }
+        }
+
+        void fd_writer::consume_parts(const std::string_view* _parts, size_t _count) {
+#ifdef _WIN32
+            buffered_writer::consume_parts(_parts, _count);
+#else
+            const size_t max_parts = 8;
+            if(_count > max_parts) {
+                buffered_writer::consume_parts(_parts, _count);
+                return;
+            }
+            std::string_view rest[max_parts];
+            size_t count = 0;
+            for(size_t i = 0; i < _count; i++) {
+                if(!_parts[i].empty()) {
+                    rest[count++] = _parts[i];
+                }
+            }
+            size_t first = 0;
+            while(first < count) {
+                iovec iov[max_parts];
+                int n = 0;
+                for(size_t i = first; i < count; i++, n++) {
+                    iov[n].iov_base = const_cast<char*>(rest[i].data());
+                    iov[n].iov_len = rest[i].size();
+                }
+                ssize_t written = ::writev(m_fd, iov, n);
+                if(written < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    m_failed = true;
+                    throw std::runtime_error("fd_writer: write failed");
+                }
+                // Drop what went out; a partial write continues with the remainder
+                size_t left = static_cast<size_t>(written);
+                while(first < count && left >= rest[first].size()) {
+                    left -= rest[first].size();
+                    first++;
+                }
+                if(first < count) {
+                    rest[first].remove_prefix(left);
+                }
+            }
+#endif
+        }
+
+        /////////////////////////////////////////////////////////////
+        // callback_writer
+
+        callback_writer::callback_writer(callback _cb, size_t _capacity)
+            :
+            buffered_writer(_capacity),
+            m_callback(std::move(_cb)) {
+            ;
+        }
+
+        callback_writer::~callback_writer() {
+            try {
+                flush();
+            } catch(...) {
+                ;
+            }
+        }
+
+        void callback_writer::consume(const char* _p, size_t _n) {
+            m_callback(std::string_view(_p, _n));
+        }
+
+        /////////////////////////////////////////////////////////////
+        // ostream_writer
+
+        ostream_writer::ostream_writer(std::ostream& _s, size_t _capacity)
+            :
+            buffered_writer(_capacity),
+            m_stream(_s) {
+            ;
+        }
+
+        ostream_writer::~ostream_writer() {
+            try {
+                flush();
+            } catch(...) {
+                ;
+            }
+        }
+
+        void ostream_writer::consume(const char* _p, size_t _n) {
+            m_stream.write(_p, static_cast<std::streamsize>(_n));
+        }
+
+}
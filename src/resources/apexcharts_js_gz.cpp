@@ -0,0 +1,8307 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*
+*
+*  Auto-generated by tools/generate_resources.py
+*  Source: https://cdn.jsdelivr.net/npm/apexcharts@3.44.0/dist/apexcharts.min.js
+*  gzip member of 517,155 bytes, size: 132,589 bytes
+*/
+
+#include "../../include/html_gen_resources.h"
+
+namespace resources {
+    const char apexcharts_min_js_gz[] = {
+        31, -117, 8, 0, 0, 0, 0, 0, 2, 3, -28, -67, 107, 99, -37, 70,
+        -110, 40, -6, -3, -4, 10, 10, -39, 81, 0, 11, -92, 72, -54, 118, 108,
+        -48, 48, 87, -106, -19, -40, 123, -84, -40, 27, 105, 50, 118, 20, -51, 92,
+        -120, -124, 72, -116, 65, -128, 11, -128, 18, 25, -111, -9, -73, -33, -86, -22,
+        55, 30, -92, 108, 39, -5, -70, -109, 93, -117, -24, 119, 87, 87, -41, -85,
+        -85, -85, 15, 31, -20, -3, -97, -42, -125, -42, -15, 60, 92, -98, 76, -125,
+        -84, -56, 91, 55, 71, -99, -121, 15, 59, 93, 76, -75, 71, 78, -85, -33,
+        -19, 61, 105, -9, -69, -3, 35, -83, 12, -26, -3, 28, -58, 97, -112, -121,
+        -29, -42, 34, 25, -121, 89, -85, -104, -122, -83, -45, -73, -25, -83, 119, -47,
+        40, 76, -14, -80, 3, 69, 14, -1, -49, -34, -11, 34, 25, 21, 81, -102,
+        -40, -123, 27, 58, 119, 86, 122, -11, -49, 112, 84, 88, -66, 95, -84, -26,
+        97, 122, -35, 10, -105, -13, 20, -102, -37, -33, -73, -80, -111, -21, 40, 9,
+        -57, -42, -98, -56, -100, -91, -29, 69, 28, 14, -39, -97, 14, 47, -22, -121,
+        -74, -29, 89, -94, 89, -43, 18, -85, -67, -65, -49, -2, 118, -126, -39, 120,
+        -56, 126, -38, -95, -29, -39, -123, 95, -41, -63, 36, 78, -81, -126, -8, 124,
+        26, -27, 67, -11, -45, 43, -42, -21, 60, -116, -81, -99, -114, -102, 46, 118,
+        -70, -79, 11, -56, 117, 109, 57, 35, -104, -50, 34, 15, 91, 121, -111, 69,
+        48, -91, -127, 72, 111, 21, 108, -82, 55, 65, -42, -118, -4, -9, 52, -31,
+        -50, -25, 112, -107, -37, -123, 51, -120, -82, 109, -98, 50, 9, -117, -9, -73,
+        -55, -121, 44, -99, -121, 89, -79, 58, 91, -51, -82, -46, 56, 103, -75, 2,
+        127, 91, 25, 108, 6, -26, 105, 7, 126, -48, -71, -114, -30, 34, -52, 108,
+        53, 38, -24, 55, 11, -117, 69, -106, -76, 106, -101, 120, 25, -26, -93, 44,
+        -102, 23, 105, 70, 99, -20, -124, -55, 98, 22, 102, -63, 85, 28, 110, 28,
+        -57, 113, -93, -50, 124, -111, 79, 59, -63, 124, 30, -81, -20, -56, 13, -100,
+        13, 111, 44, -38, -56, -39, 33, 60, -17, -82, -95, 1, 54, -65, -34, 32,
+        122, 22, 100, 19, 104, 38, 41, -14, 78, 28, 38, -109, 98, 58, -120, 14,
+        14, -60, 76, -110, 69, 28, -17, -7, -78, -60, 69, 116, 57, -44, 63, -68,
+        -69, -51, 32, -6, 75, 127, 88, 112, -80, -40, -127, -29, -18, 117, -99, 14,
+        116, -16, 42, 24, 77, -75, -103, 21, -50, 93, 106, -121, 110, -31, 6, 23,
+        -59, -91, 3, -61, -11, 118, -52, 48, 31, -14, 2, 108, -39, 121, -127, 40,
+        -52, -95, -107, 93, 85, 97, 24, -114, -89, -115, -87, 97, 64, 117, 29, -84,
+        104, -112, -69, -96, 31, -72, -123, -125, -109, 16, 0, 14, 21, -128, 35, 108,
+        89, -64, -35, -81, -63, 116, -122, 7, -80, 101, 114, -6, 81, -50, -24, 68,
+        -128, 18, 1, 116, 50, -44, -121, -54, 27, -28, 37, -117, -115, 87, -105, 9,
+        109, 54, 119, 87, 116, 70, 105, 2, -56, -66, 24, 65, -37, -66, -17, -53,
+        -12, 61, -15, -69, 51, -49, -46, 34, -59, 106, 67, 49, 54, 79, 118, -24,
+        -30, -68, -44, 44, 3, -74, 73, 96, 63, -20, -39, 69, 43, -126, -122, -125,
+        100, 68, 20, -63, 113, -118, 105, -106, -34, -74, -110, -16, -74, 117, 14, -75,
+        95, 101, 25, 0, -52, 58, 9, -110, 36, 45, 90, -93, 32, -114, 91, 65,
+        107, 20, 7, 121, -34, 10, -32, -1, 90, 114, -60, 90, -21, 57, 107, 93,
+        -95, 105, 23, -48, 52, -84, 65, -49, 16, 112, 112, 16, 104, -5, -64, -41,
+        63, -42, -21, -67, -98, 27, -32, -68, -81, -93, -55, -126, -27, -17, 117, 93,
+        -21, 38, -120, 23, -95, 21, -63, 44, 112, 31, 118, 110, -77, -88, -32, 121,
+        -114, 91, -113, 19, -128, -74, 72, 3, 112, 75, -87, 81, -46, 38, 116, 35,
+        9, 127, -40, -43, 48, 112, 5, 69, -104, -126, 27, 81, 26, 20, 114, 11,
+        85, 49, 45, 87, 4, 0, -74, -118, 97, 83, -41, -95, 123, 71, 35, -10,
+        34, 87, -51, -51, -125, -119, -24, 19, -61, 111, 49, 17, -8, -67, 1, -4,
+        -65, 8, 47, -3, 72, -17, 55, -111, -117, -90, -16, 68, 18, 83, 24, 61,
+        -37, -20, 126, 88, -65, -126, 103, 11, 24, 16, 82, -4, 44, -52, 115, 108,
+        110, -74, -56, -117, 86, 24, 1, -29, -56, 90, 87, 97, 11, 107, -73, -46,
+        -52, 88, -46, -127, 6, 14, 65, 21, 71, 89, 24, 20, 64, -122, -10, -9,
+        67, 13, 86, 119, 26, 118, 122, 124, -66, -123, 62, -93, -14, 108, 55, 27,
+        -57, -123, 54, -90, 52, 39, 53, -57, 88, -37, 16, -79, -24, 50, 15, -117,
+        15, -94, -89, -9, -41, 67, -75, -69, -75, -44, -38, 29, -43, -7, -57, 63,
+        104, -120, -1, -8, -57, 122, 93, 91, 11, 55, -123, 27, 27, 91, -125, -115,
+        72, 52, 49, -83, 31, -61, 122, 109, 114, -42, 106, -121, 62, -48, -95, -115,
+        91, -98, -34, 72, 46, 33, -14, -112, 42, 63, 94, -81, 107, 72, 0, -20,
+        73, -127, 105, -56, -63, 110, -46, 104, -36, -22, 54, 47, -12, -53, 48, -117,
+        110, 64, 46, -48, 86, 36, 111, -51, -126, 85, 43, 77, -30, 85, -117, -73,
+        -60, 122, -58, -11, 86, -116, -39, 25, -16, 76, 29, -108, -78, 67, -96, 57,
+        -123, -42, -31, -49, -31, 117, -104, -123, 64, 52, 120, -81, -56, -99, 91, -45,
+        32, 79, -66, 47, 0, -101, 66, 32, -98, 73, 84, 68, 65, 28, -95, -120,
+        -46, 110, -27, -120, 125, -74, 99, -108, 64, 98, -94, 119, 91, 108, -116, -123,
+        24, 99, -9, 72, 39, 66, 95, 99, -6, -120, -3, 106, -56, 18, 70, 48,
+        -100, 24, 38, 4, 36, -125, -1, 82, -28, -110, 3, 111, -81, -121, -64, -85,
+        -28, 118, -14, 105, 48, 51, -118, -44, -84, 0, -84, -4, 114, 37, 10, 117,
+        7, 69, -74, 18, 43, -2, 34, 77, 65, 12, 75, -44, 78, -24, 16, -18,
+        -65, -65, -18, -32, -20, -86, -35, -39, -68, -126, 123, 113, 105, -56, 50, 36,
+        0, -64, -82, 24, 5, 5, -80, 57, -119, -62, 123, -67, -51, -58, -82, -82,
+        11, 23, 111, -36, -64, -113, -71, 88, -61, 37, -98, 28, 19, 96, 37, 28,
+        -99, 91, 12, 34, -65, 58, -114, -64, -107, -126, -128, -101, 59, -101, 48, 6,
+        89, 42, 2, -14, -53, -92, 15, -110, -75, 100, 1, 57, -128, 17, -53, -120,
+        116, 50, 58, 49, 118, 64, 9, 117, -114, -77, 44, 88, 117, -94, -100, -2,
+        66, -102, -93, 47, 117, 121, 19, 49, 94, -127, 116, 8, 0, 63, -60, -65,
+        94, -99, -40, 40, 57, -33, 69, -119, -29, 94, -82, -41, -59, -123, -11, -81,
+        -1, 42, -66, -83, 75, -124, 12, 107, 47, -30, 61, 15, -120, -15, -72, -71,
+        -101, -7, -80, 2, 41, -14, -109, -60, -121, 117, -57, 37, 69, 126, 21, -7,
+        17, 91, 57, 0, -21, -98, -99, -6, 32, -25, 69, -99, 36, 92, 22, 54,
+        72, 33, -29, 52, 9, 29, -40, -73, 25, 9, 106, -64, 122, 104, -83, 97,
+        -35, 96, -33, 102, -100, -67, -47, -66, 28, 96, -61, -50, 64, -83, 102, -126,
+        29, -27, 62, 16, -13, 40, -127, -42, 87, 119, -40, 95, -70, 94, -13, -63,
+        117, -40, -32, -42, 107, -15, 11, -28, 93, 81, 18, -89, -64, -9, 93, -66,
+        17, 2, 75, -74, 33, -112, -83, -41, 115, -2, 87, 67, -115, 90, -94, -16,
+        54, -127, -79, -62, 54, 14, -118, 34, -100, -51, -117, 86, -111, -126, -56, -50,
+        80, 97, -111, 1, -15, 79, -109, 54, -127, 13, -120, -77, 20, 7, 58, -65,
+        37, 111, -127, 82, 100, -92, 94, -92, -56, 35, 68, 17, -105, 42, 4, -72,
+        -88, -100, -110, -28, -116, -99, 76, -125, -101, 16, 56, 72, 101, 101, 96, -25,
+        -49, -62, 98, -102, -114, 59, 32, 39, -40, -38, 38, 95, 104, -28, -6, -98,
+        -72, 67, 68, -69, -124, 62, 101, -70, 80, 65, 22, -58, 27, -21, 80, 70,
+        -28, 24, -120, 35, -6, 98, 99, -72, -50, -46, -103, -20, 116, 110, 118, 125,
+        127, 120, -25, -64, 121, -125, -15, 127, 29, -88, -25, -110, -9, 112, 112, -95,
+        -22, -108, 76, 20, -107, 43, 52, 8, 67, -55, -127, -95, 66, 41, 2, 87,
+        -92, 103, 84, 81, -20, -109, 78, 30, -125, -50, 105, 63, 113, -37, 61, 65,
+        40, -84, -9, -126, -79, -7, 81, 73, 116, -123, -19, 19, -7, 70, 74, 39,
+        9, 102, -80, -119, -84, -45, 96, 78, 21, -128, 7, -98, -123, -84, -18, -48,
+        -128, -65, 103, 29, 11, -118, -60, 11, 30, -2, -35, 30, 122, 127, -115, -42,
+        111, -99, -92, -128, 95, 79, -42, -67, -57, -21, -93, -66, 3, 63, 79, -30,
+        96, 54, 15, -57, 14, 107, -31, 95, 14, 59, 5, 96, -69, 29, 57, 67,
+        54, 55, -113, -15, 52, -115, -116, -79, -12, 59, 78, 46, 96, 67, -121, -49,
+        11, -66, -91, 113, -53, -121, -66, -4, 26, 104, 114, 45, 80, 96, 92, 120,
+        -122, -94, 0, 50, 16, 115, 73, -66, 13, 64, -80, 5, -100, 2, -23, -106,
+        -125, 52, -40, 96, -115, -91, -50, -55, 52, -115, -43, -71, 11, 24, 101, 45,
+        -92, 74, -126, -46, -23, -59, 29, 8, -83, -98, 5, 28, 106, 28, -2, -4,
+        -29, -117, -109, 52, 6, -36, 116, -103, 112, 85, 71, 58, -61, 78, 62, -113,
+        -93, -62, -74, 92, -53, -127, -111, 21, -49, -70, -61, -82, -41, 127, -12, 8,
+        41, 15, -4, 110, -9, 30, 20, 32, -108, 101, -2, 60, -56, -14, -16, 45,
+        -128, 44, -70, -24, 94, -14, -27, 123, -24, -72, 61, -112, -97, 83, 61, -77,
+        119, 73, 105, -119, -98, -42, -89, 52, -79, -50, -39, -28, -54, -74, 14, -20,
+        -45, -96, -104, 118, -78, 20, -10, -97, 109, 7, -19, -52, 121, -112, 59, 7,
+        -103, 115, 0, -29, 40, -25, -91, -108, -105, -42, -26, 37, -108, -105, 64, -98,
+        99, 109, 54, -82, 54, -7, 55, -31, 114, -25, -28, -27, 24, 67, 62, -93,
+        30, -52, -24, -15, 86, 56, 68, -49, -97, -9, 30, -61, -108, -31, -17, -109,
+        125, -52, 79, 124, -8, 119, 63, 18, -77, -5, 14, -122, -40, 123, -4, -61,
+        15, 63, -12, 123, -113, 15, 30, 63, 122, 116, -12, -8, 65, -45, 84, -5,
+        -113, 42, 121, 114, -86, 13, -45, 116, -28, 78, -126, 78, 28, 57, 104, 115,
+        -26, -11, -45, -42, -75, -113, 2, 72, 36, -107, 2, 32, 33, -126, 35, 30,
+        117, 12, -88, 81, 113, 79, -91, 11, 84, -94, -12, -51, -26, 82, -32, -39,
+        85, -108, -116, -21, 33, 92, -107, 63, 100, -25, 76, 94, 8, 53, 97, 97,
+        35, 103, 16, -27, -100, 14, 84, 26, 53, -108, -34, 84, 17, 11, -56, -39,
+        -33, -33, 43, 83, 126, 73, -66, -75, -106, -73, 14, 116, 7, -51, 10, 29,
+        -24, -53, -70, -32, 50, -80, 117, 80, 28, 88, -105, 10, -29, 64, 100, 45,
+        -50, 83, -22, -69, 110, -32, 36, -111, -70, 17, -120, 15, 68, 8, 66, 80,
+        110, -61, 103, -126, 56, 12, 66, -40, -4, 17, 106, 110, -88, -66, 13, -92,
+        -3, 70, -76, 13, -126, 68, -40, 4, 100, -122, -58, -72, 76, -125, 26, -3,
+        -114, 79, 9, -12, -18, 104, -110, 0, 65, 50, -66, -3, 18, 39, -28, 50,
+        -44, 118, 85, 62, 77, 110, 64, 67, 85, -14, 63, 42, 3, -92, 4, 2,
+        3, -30, 75, -94, 104, -99, 80, -1, -96, 3, 119, -73, -39, 73, -73, 49,
+        9, 25, 108, -49, 15, 28, -47, 90, -114, 26, 115, -32, 4, 29, 80, 7,
+        52, 11, -115, -99, 19, -87, -67, -56, 47, -3, 0, -2, -47, -52, 51, -116,
+        25, 73, -53, 28, -101, -75, 125, -73, 1, -126, 41, -75, 7, -60, 111, -127,
+        113, -124, 52, 102, 10, 74, 110, -70, 57, 48, -84, -77, 42, -27, 0, 62,
+        -83, 10, 14, 98, 127, 63, 103, -6, 61, 14, 9, 68, 53, -74, -124, 118,
+        1, 95, 46, 21, -16, -52, 65, 5, 110, -118, 3, -53, 89, 38, 90, -103,
+        -36, -96, -76, -2, -11, -72, 69, -101, -102, 77, -13, 66, -94, 78, -40, -103,
+        5, 115, -45, -62, 24, 48, -23, -77, 16, 35, -119, 0, 121, -88, -101, -48,
+        87, 29, -51, -46, -92, -104, -98, -90, -29, 109, 91, -17, 47, -67, -66, 44,
+        63, -118, 65, -74, -83, 14, -119, -119, 11, 0, 17, -37, -30, -125, -122, -66,
+        -92, 97, 7, 7, 10, 52, -75, 59, -56, -107, 117, 39, 39, -18, 7, -112,
+        34, -24, 83, -77, 12, -114, -118, 19, -54, 38, 127, 2, -76, -96, 22, 121,
+        22, -94, -55, 64, -26, -66, 12, -118, 80, -49, 37, -27, -41, 32, 22, 56,
+        22, 28, 71, -26, -33, 109, 36, -90, -90, -72, 90, -95, 19, -106, 113, 43,
+        37, -55, -3, 34, 45, -115, 44, -123, 53, 26, 72, -87, 90, 34, -100, 36,
+        6, -23, -92, -41, -35, 2, 68, 34, -19, 80, 8, -110, 14, -23, -9, -69,
+        -97, 122, 93, 89, -101, 104, -2, 121, -6, 34, -56, -61, -35, -83, -52, -45,
+        91, -69, -41, 117, -23, -9, 117, -100, -62, 116, 68, -29, -67, 46, -118, -65,
+        78, 93, -77, 91, -55, -96, 108, 54, -84, 107, 85, 14, 25, 127, -121, 122,
+        -5, -60, 74, 127, 90, -52, -82, -62, 108, -53, -96, 25, -111, 1, 77, -83,
+        -16, -88, -62, -21, 56, 13, 112, -29, 41, 6, 6, 36, 119, -34, -36, 12,
+        35, 43, 101, 50, -14, -68, -73, -65, 47, 45, 28, -118, -114, -12, 116, -61,
+        117, -17, -46, -21, -117, 53, 99, -19, 3, -62, 0, -21, 15, 39, 33, -120,
+        77, 78, 105, 64, 64, -4, 63, 100, -31, 40, -54, 25, 70, 107, 96, 12,
+        -110, 113, 58, 123, 91, -35, 35, 98, -118, -100, 113, 83, 49, -37, 57, -24,
+        105, 28, -5, 8, 57, -10, -30, -118, -119, -48, 32, 60, -55, 70, -109, -12,
+        -43, 114, 14, -88, -123, 66, 106, -29, -92, 121, 35, 40, 59, -109, -64, 118,
+        120, 17, -66, -70, 60, 36, 69, -66, 7, 32, 21, -101, 73, 98, 62, -120,
+        105, 92, 26, -73, 44, 46, -48, 88, 109, -53, -125, -113, -36, -57, 76, -48,
+        26, -25, 113, 0, -30, -125, -43, 1, -71, 10, -124, -65, -52, 103, 112, 1,
+        4, -17, 93, -62, -56, -79, -27, -20, 89, -41, -31, 58, 110, 112, 96, 117,
+        59, -42, 32, 59, 56, 24, 56, -47, -127, 111, 117, 45, -55, -86, 14, 114,
+        -39, -40, -31, -33, -37, -121, -40, -38, 6, 43, 101, 109, 95, 82, -6, -84,
+        -35, 46, -41, -53, 15, 20, -109, -101, -124, -59, -53, 8, 86, 10, 1, -66,
+        5, 8, 80, -20, 36, -99, -51, 23, 69, 56, 62, 43, 86, 113, 8, -88,
+        -117, 40, -123, -4, 5, -12, -125, 56, 2, 16, -66, 9, -93, -55, -76, -64,
+        25, -13, -124, -65, 69, 99, -20, -97, -113, -75, -19, 107, -21, 28, 118, -26,
+        -63, 120, 12, 96, 61, 79, -25, -50, 65, 93, -58, -117, -76, 40, -46, -103,
+        -29, 94, 4, -11, 21, -33, -123, -41, 69, 125, -51, -97, 113, 24, 48, -80,
+        75, 125, -114, 47, 112, 23, 66, -26, 9, -115, -20, -25, 6, 57, -121, -51,
+        -107, -20, -114, -43, 10, -46, -76, 115, 87, -92, 115, 15, -59, -108, -71, -101,
+        97, 95, -16, -101, -2, -70, 87, 52, 102, -8, 100, 63, -36, 24, -58, -24,
+        33, 126, 92, 23, -18, 45, 2, -61, 51, 64, -29, 78, 9, 98, 94, 9,
+        -128, 75, 81, 101, -59, 58, -39, -24, -13, 120, 7, 27, 11, -108, 35, -122,
+        -109, -81, 65, -43, 2, 74, -65, -115, 109, 0, 126, -116, 23, -128, 30, 118,
+        45, -51, 49, 101, -73, -112, -23, 78, -31, -10, 58, 66, 122, 122, 46, 16,
+        31, 118, 48, 59, 18, 107, -56, 113, -69, 106, -61, 77, -61, -27, 121, -6,
+        -13, -28, 42, -88, -39, -58, 8, -4, -94, 74, 98, -70, -75, 36, -90, -85,
+        -109, -104, -18, -91, 103, 125, -9, -108, -2, 103, -71, 95, 77, -91, 58, -113,
+        7, -96, 68, 64, -111, 66, 35, 22, 93, -73, -121, 80, 41, 124, -39, -127,
+        80, -75, 11, -75, -113, -65, -93, 125, 60, 64, 115, -44, -116, -116, 72, -52,
+        -26, 58, 1, -30, 98, 91, 118, -25, -50, 58, -120, -8, 80, 14, -113, 14,
+        -84, -115, 3, -59, 39, -106, -93, -28, -75, 0, -72, 114, -16, 76, -108, 25,
+        4, 36, -106, 6, -105, 74, 75, 66, 58, -125, 41, 2, -82, -8, -5, 0,
+        -1, -15, -16, 31, -44, -100, -60, 54, 83, -10, -26, -3, 125, 118, 68, 105,
+        -93, -70, 14, -86, 95, 96, -29, 48, -2, -103, 70, 9, -87, -100, -122, -34,
+        -122, 103, 111, -13, 96, 20, 21, 43, 68, 41, 80, 57, -114, -73, -32, -108,
+        65, -82, 21, -7, -23, 60, 112, -19, -50, -127, -13, -101, 3, 100, -24, 95,
+        122, -106, 78, -70, 39, 87, 125, 88, -8, -26, 38, 1, -68, 5, -121, -36,
+        -31, -33, 113, -88, -61, -117, -33, -14, -125, -53, -31, 111, 54, -5, 107, -1,
+        54, 62, 112, -40, 79, -9, 30, 41, -121, -111, 3, 107, -10, 16, -39, -99,
+        0, 24, 105, -121, 64, 1, 15, 36, 72, 11, -82, 48, 27, 122, -99, 80,
+        -20, -38, 125, -89, 82, -68, -1, 101, -59, -113, -74, 22, 7, 110, -96, -87,
+        71, 66, 35, 108, -122, -48, -95, -3, -9, -17, 46, -70, -19, -89, -57, -19,
+        -41, -105, 119, -113, 55, -1, -30, -84, -11, -124, -93, 114, -62, 19, 72, 56,
+        -116, -104, 25, 69, -29, -15, 120, -100, -110, -58, -85, 73, -102, 124, 72, 27,
+        116, 50, 101, 46, 1, 105, 49, -16, -5, 15, -120, -85, 126, 120, 123, 24,
+        10, -39, -111, -124, 70, 37, -55, 101, -99, -91, 95, -80, 82, 57, -96, 86,
+        -2, 32, 0, -122, -42, 89, -7, 109, -98, 56, 74, 115, -106, -56, -79, 49,
+        -45, 14, -54, -91, 8, -109, -58, 65, 118, -98, -98, 4, 25, -116, 56, 10,
+        -110, -70, -95, -71, 120, -58, -50, -51, -26, -96, -105, 63, -19, 58, 114, 104,
+        -67, 39, 93, 65, -103, -105, 94, 113, 16, 105, 29, 59, 72, 68, 69, 10,
+        -115, 79, -45, 120, -61, 124, 20, -52, 67, -74, 62, 127, -72, -52, 99, -63,
+        106, 34, -111, -112, 8, 32, 86, 95, 110, -43, -120, 76, -55, 124, -5, 92,
+        -4, 63, -83, -1, 119, -17, 95, -65, -5, -105, -65, -4, 125, -1, -127, -19,
+        -84, 15, 126, -13, -121, 3, -17, 123, -53, -19, 60, 123, 126, -73, -71, -8,
+        -19, -14, -73, -33, 14, 47, 15, 39, -88, 61, 40, -31, 37, 4, -18, -7,
+        107, -104, -91, -37, -24, 63, 89, 83, 10, 77, -45, -72, 1, -4, 28, -121,
+        -53, -73, 73, -125, -50, -52, 14, 75, 65, 2, -119, -98, 43, 43, -102, 34,
+        84, 81, 91, 36, -126, -100, 18, -96, 104, 81, -80, 117, 101, 32, 81, 10,
+        30, 9, 75, 48, -77, -56, -19, -70, -14, 35, 4, 106, 10, -44, 26, 15,
+        104, 53, 37, 43, 11, 70, -59, 78, 1, -74, -98, -22, 92, -4, -3, -73,
+        113, -25, -14, -63, -31, 4, 9, -80, 2, 13, -88, -56, -29, -29, 100, 4,
+        -24, -33, 100, -122, -62, 25, 13, -120, -18, 64, -61, -80, 102, -81, -30, 16,
+        -105, 14, 13, 26, -56, -114, 65, 61, 124, 23, -27, 100, -7, 44, -126, 40,
+        65, 5, 116, -96, 29, 125, 73, -95, 57, 44, 94, -67, -53, 81, 30, -38,
+        -75, -99, 26, -12, -100, -120, -104, 75, -121, -102, 64, 77, -105, 14, -39, 29,
+        -115, 52, -20, -126, -53, 30, 20, 9, 126, 34, 13, 90, -125, 16, -105, 39,
+        65, 15, 65, 34, 8, 115, 98, -91, 20, 121, 66, -38, -92, 119, 67, -43,
+        -74, 64, 95, 54, -56, -38, 3, 109, 116, -49, -17, 106, -11, -49, -126, -21,
+        32, -117, 26, 101, -13, -61, -65, -37, -10, 112, 111, 52, 5, -26, 18, -82,
+        65, 66, -49, 0, 89, -100, -114, -13, 32, -89, 106, -126, 82, 37, -63, 77,
+        52, 65, -77, 120, 103, -111, -121, -39, -15, 4, -41, 67, 31, 99, -108, -123,
+        -41, -23, -78, -79, -109, 86, 77, 125, -40, 126, -17, -46, -37, 48, 59, 1,
+        -19, 11, 118, 96, -124, -88, -1, 30, 79, 13, 121, 91, -50, -13, 118, 79,
+        -21, -30, -19, -85, 94, -81, -90, 125, -40, 13, 109, -104, -80, 127, 11, -11,
+        -45, -37, 78, 93, 63, -78, -27, -45, -77, -73, -81, 44, 103, -67, -82, -108,
+        13, -26, -13, 95, -62, 12, -59, 108, 85, -8, 60, -117, -58, 80, -5, -112,
+        -58, 33, -113, 44, -115, 1, 53, 10, 74, -51, -125, 113, 81, -124, 53, 6,
+        -44, -78, -40, -71, -29, -13, -82, -93, 111, 39, 66, 5, 77, -40, 9, 15,
+        30, -71, 90, -51, 14, 41, -12, 100, 65, 102, 122, 126, -51, -80, -69, -46,
+        20, -90, -78, -77, 27, 79, -99, 19, -41, 118, 20, 29, 28, -107, 58, -118,
+        88, 71, 27, 70, 101, -76, -68, 87, -29, 73, 120, -88, -102, 11, 80, 30,
+        -84, 109, 51, -88, 12, 62, -32, 109, 110, -120, -32, -40, -114, 123, -43, 96,
+        -47, 15, 53, -109, -66, -53, 12, 14, -59, 18, 125, 2, -16, -25, 45, 8,
+        -60, -73, -20, 39, 110, -9, 32, 71, -63, -101, -41, -51, -19, -38, 35, -128,
+        74, -79, -90, 69, 68, -72, -18, -79, 94, 58, -52, -85, 46, -17, -124, 84,
+        -43, -71, -53, 111, 35, 58, -113, 100, -71, -52, 33, -93, 51, 66, 23, -69,
+        78, -112, 68, 32, 45, 97, -61, -78, -12, 8, -51, 11, 113, -108, -124, 65,
+        102, 121, 32, -83, -74, -83, -63, 85, 22, 6, -97, 7, -108, -127, -66, -121,
+        81, 66, 25, -49, 42, 25, -23, -94, -96, -100, -25, 53, 85, 40, 111, 28,
+        94, 7, -117, -72, -96, -38, 102, 33, 24, 35, -80, 78, -56, -88, -78, -51,
+        94, -25, -121, 110, -17, -47, -109, -127, -112, -16, -38, 126, -49, 121, 80, 60,
+        -80, 1, -55, -16, -57, 65, 8, -118, -18, 70, 111, -21, 10, 20, -82, 81,
+        88, 110, 76, -14, -79, -34, 97, -65, -13, -61, -93, -31, 15, -99, 71, -113,
+        -5, -113, -96, 33, 24, -50, -77, -66, -111, 70, 125, 116, 30, 81, 26, -10,
+        0, 127, -80, 12, 79, -47, 75, -11, 59, 125, -83, -40, -45, 35, 40, 104,
+        -28, 62, 54, -78, -97, 60, -124, 2, -58, 80, 67, -32, 15, 69, 52, 106,
+        26, 43, -48, -56, -67, 61, -76, -76, 72, -109, 78, -33, 109, -9, -70, 15,
+        10, 71, -55, 33, -48, 81, -89, -117, 61, -40, 82, -60, 114, 14, 59, 71,
+        8, -108, 77, 45, 66, -96, 61, 93, -48, 5, -74, -2, -31, -69, 40, 9,
+        -101, 69, 37, 64, -109, -94, -56, -48, 114, -54, -117, -37, -127, -61, -110, 34,
+        -89, -36, -46, 105, -112, 125, 14, -77, -90, -74, -16, 0, -34, -71, 11, -41,
+        107, -76, -97, -93, -102, 71, -83, -36, 101, 94, -56, -75, -38, 80, 104, -78,
+        -96, -19, -87, -34, -36, -36, -111, 37, 35, 94, 50, -22, -36, -22, -102, 111,
+        -44, 97, 63, -80, -38, 117, 1, -28, 43, -114, 109, -35, -47, 34, -77, -55,
+        -15, -81, 52, -38, -109, 40, 27, -59, 97, -13, 104, -27, -36, 113, -120, -99,
+        -52, 29, -95, 70, 61, 90, -70, 35, 84, -88, 71, -85, -58, 49, -78, -94,
+        17, 47, 26, 81, -47, 114, -33, -11, -106, -125, 74, -49, -75, 80, 111, -104,
+        35, -73, -55, -44, 78, -11, 3, -96, 70, -2, 99, 22, -116, 23, -24, 94,
+        -80, -51, 100, 17, -58, 46, -45, 73, -125, -104, 4, 60, -78, -61, -4, 19,
+        15, -47, -48, -13, 53, 118, 51, 18, 117, -118, 41, 42, 120, 110, -54, 63,
+        -50, 83, 55, 65, 117, 119, 30, -122, 99, 55, -10, -47, 31, 46, 14, 86,
+        -18, -108, 89, 93, 111, -35, 17, -120, -4, -45, 70, -38, -61, -57, 40, -121,
+        -41, 9, 19, 60, 4, 31, -125, 72, 51, -14, -65, -96, 26, 117, -22, -72,
+        -51, 53, -58, -85, 36, -104, 69, -93, 99, -111, -94, 58, -102, -54, 93, 50,
+        14, -118, -32, 100, 26, 36, 19, 76, -74, -82, -128, 12, 2, -61, 46, 53,
+        -119, -89, 51, 52, -72, 46, 39, -13, -77, 52, -101, 79, -49, 126, -7, -47,
+        102, -21, 71, 4, -76, -95, -34, 122, -83, -6, 26, -91, -77, -85, -108, 121,
+        59, 15, 115, 50, -99, -90, -97, 1, 31, 51, 23, -64, -23, -58, 15, 70,
+        -6, -79, 96, 122, -5, 18, -89, 23, -114, -71, -124, 89, -57, 11, 74, 27,
+        126, 108, 86, -88, -9, -89, 85, -21, 62, 8, 53, -127, 53, 11, 81, -60,
+        -73, 45, 80, 108, -106, 52, -8, -68, 29, -78, 118, -38, -45, 104, 12, 92,
+        -37, 114, 92, -67, 124, 48, 30, 27, -123, 89, 33, 89, 7, -57, -113, -34,
+        -94, 21, -52, -124, 81, -96, 61, 48, 14, -117, 112, -68, 5, 45, 105, 98,
+        48, 64, 49, 53, 89, -7, 21, -32, -24, 24, 41, 74, 67, 22, -70, -32,
+        -16, 67, -48, 10, 4, -127, -109, -41, 57, -34, -103, 107, 22, -34, 16, -20,
+        -12, 86, -47, 9, 114, 87, 25, 91, -80, 127, -9, 46, -116, -47, 41, -110,
+        108, 91, -102, -2, -60, 16, 102, 27, -87, 68, 44, 96, 0, -120, 9, 0,
+        114, 59, 13, 114, -104, 48, 110, 72, -94, 7, -106, -40, -115, -96, -72, -72,
+        25, -28, 100, 70, -50, 121, -118, 22, 34, 108, 101, 84, -61, 100, 44, -40,
+        60, -128, -30, 126, 19, -118, -89, -64, 109, 93, -21, -76, -43, 109, 89, -104,
+        63, 2, -99, 64, -95, -17, 4, -60, 55, 102, 107, 116, 54, 3, 123, 15,
+        70, -107, 43, -71, 73, -13, 48, 4, -103, -44, -56, 2, 21, -126, 9, -86,
+        -48, 65, -18, -113, 108, 24, -73, -67, -105, -95, 55, 85, 99, -19, -84, -66,
+        118, -58, 106, -85, 33, -63, 42, 47, -30, 49, -37, -32, -56, 104, 104, -4,
+        64, -93, -30, -76, -80, 115, 69, 75, 123, 90, 21, -58, 22, 1, -44, -107,
+        82, 105, 115, -87, -84, -127, 8, 47, 59, 66, -43, -62, 83, -7, -120, -32,
+        42, -57, 22, 102, 81, -104, 95, -88, -124, 89, -80, -4, 5, -2, 114, 21,
+        -102, -88, -83, -80, -52, -75, -5, 58, 77, 50, 102, -75, -65, 31, 119, -86,
+        123, -121, 60, 101, -110, -108, -111, -99, 96, 75, 101, 123, -81, -106, -2, 0,
+        78, -41, 12, 86, -116, -90, -41, 64, -75, -100, -58, -63, -72, 113, -3, -114,
+        -93, 77, 32, -28, -24, -101, -81, -106, -93, 107, -92, 101, 60, -128, 96, 2,
+        -26, 107, -70, -95, -79, -21, -68, 29, -10, 81, -47, 89, 36, -4, 58, 7,
+        -70, -111, -109, -71, -107, -85, 67, -80, 55, 59, -84, 29, 7, -28, -84, -33,
+        -127, 18, -10, -6, -35, -65, 88, -82, -43, 123, 66, 127, -38, -113, -24, -33,
+        -121, -16, 1, 27, 68, 0, 62, 18, -101, 40, 47, 0, -40, 121, 39, 73,
+        -77, 89, 16, -13, 43, 35, -52, 73, -125, 92, 39, 88, -53, 108, -77, 111,
+        -85, 66, -37, 112, 71, 17, -26, -114, -24, 69, -26, -2, 5, -43, 120, 126,
+        54, 13, 112, 42, -110, -55, 81, -1, 42, 3, 93, -36, -101, 42, -23, -10,
+        33, 32, -19, 63, 81, -113, -9, -122, -21, 61, -58, -78, 87, -64, 52, -58,
+        97, -99, -119, 68, 103, 35, 51, 38, 80, 58, -33, 50, -8, 119, 72, -95,
+        -62, -92, 121, -12, -22, 8, -98, 112, 46, 23, 82, 75, 6, -21, 25, 37,
+        5, -98, 105, 21, -85, 18, -78, 12, 106, 113, 101, 80, 84, -81, 7, 21,
+        2, 56, 121, -45, 120, 7, 118, 36, 0, 51, 12, -112, -109, -54, 41, 50,
+        31, 30, -12, -21, -99, -79, -29, -59, -13, 44, 72, -14, -21, 16, -27, -52,
+        -55, -107, 119, -121, -24, -31, 9, 117, -51, -51, -29, 20, 62, 65, 117, 113,
+        113, -44, -39, 40, -100, 23, 94, -74, -39, -112, -101, -128, 24, 24, 32, 12,
+        -63, 29, 116, -53, 99, -32, 17, -47, -43, 2, 8, -99, -59, -14, -2, -102,
+        68, 40, 86, -32, 13, -85, -20, 108, 30, -116, -62, -9, -55, 95, 65, 75,
+        -31, 91, -16, 31, -7, 40, -120, 67, 54, -49, 51, -36, 17, -91, 38, 13,
+        -104, -65, -60, 117, -5, -1, 13, -56, -1, 75, -128, -84, -24, -56, 118, 0,
+        87, -20, -50, 71, -75, 118, -25, 35, -35, -18, 124, 116, -23, 117, 30, 13,
+        -72, -27, 32, -30, 86, 1, 34, 114, -52, -93, -84, 68, 18, -104, -25, -88,
+        -90, -40, -58, 108, -53, -87, -46, -58, 30, 100, -41, 99, -28, 50, 123, -63,
+        -58, -88, 60, 38, -36, 81, 117, 117, 92, -86, -87, -70, -47, -15, -114, 45,
+        -29, 118, -128, 68, -99, -85, 120, -111, 1, -50, 69, -20, -24, -43, -113, -40,
+        49, 105, 74, -28, 59, 78, 51, -48, 101, -94, 78, -54, -50, -79, 72, -101,
+        65, 23, -118, 113, -55, 53, 57, 117, -122, -23, 69, 120, -23, -95, -112, -58,
+        -112, 5, 6, -124, -21, -107, -89, 11, -40, 122, -57, -15, 124, 10, -118, 64,
+        4, 66, 111, 39, -67, -66, 6, 76, -80, 51, 84, 18, 39, -63, 34, -57,
+        -93, -119, 23, 48, 4, 84, -23, 102, 97, 54, 81, -75, 52, -77, 55, -96,
+        38, 74, -111, 60, -61, -115, -43, -54, 43, 44, -34, 70, -118, 43, -53, -34,
+        -81, 93, -10, -66, -66, -20, -3, 75, 15, -99, 91, -39, -111, 116, -18, -13,
+        -29, -29, 12, 126, 16, -60, 82, 63, -108, 0, 10, 53, 0, -123, -128, -102,
+        127, 53, -48, 89, -119, -86, 114, 62, 6, -89, 69, 49, -23, -19, 43, 27,
+        -56, 58, 10, -96, 81, 16, -65, 104, 20, 66, 73, -120, -85, 1, 125, -124,
+        -96, 111, -34, -5, 33, 93, 41, 24, -124, 62, 118, -59, -84, -54, -74, -77,
+        94, -29, 23, -73, -1, -118, 79, 28, -57, 80, -84, -15, -3, 87, 51, 119,
+        -125, -46, 106, 102, 64, 55, -2, -112, 102, -54, 72, -31, 86, -80, 33, 36,
+        114, 19, -81, -41, -1, 9, 20, 71, 63, 100, -127, -26, -49, 66, -68, 83,
+        2, -112, -66, 47, 113, 71, 121, 64, -69, -65, 20, 104, 34, 38, -74, 20,
+        -62, -2, 46, -126, 15, 105, -124, 8, 24, 94, -18, -17, -17, 40, 32, 21,
+        -127, -120, -108, -128, -69, -94, 110, -30, -94, -90, -123, 23, 91, 7, -20, -80,
+        47, 40, 73, 81, 1, -116, -9, 38, -28, -109, 29, 72, 17, 46, -25, -94,
+        70, 89, 78, -53, -103, 44, -106, 115, 121, 75, 81, -99, 50, 0, -21, -76,
+        -40, 61, -35, -71, -18, 62, 103, 57, -123, 57, -95, -56, 101, -25, 57, -10,
+        29, 51, 127, 89, -3, 46, 74, -95, -36, -6, -59, -65, -106, 30, 72, -91,
+        -8, 99, -59, 127, 108, 52, 81, 123, -10, 71, -118, -38, -28, -118, -122, 38,
+        -91, -109, 52, 75, -62, -84, -23, -52, 74, -69, 93, -85, -112, 2, -55, -54,
+        -78, 93, 116, -106, 68, 87, 86, -16, 107, 5, -124, -123, -39, 51, -1, 35,
+        -125, 13, -15, 32, 63, -56, 30, 100, -54, 80, 79, -107, 41, 127, 22, 37,
+        -96, -71, 69, -121, -87, 83, -66, -44, -86, 60, -93, -15, -28, -74, -77, 60,
+        -80, 121, 39, -50, -125, 8, -64, 1, 125, 96, 10, 117, 6, 41, -101, -54,
+        -91, -43, 66, 35, -110, 118, 113, 81, 72, 45, -20, 18, 71, -21, 106, 41,
+        61, 76, 89, 57, -58, -123, 82, -83, 111, -3, 116, 81, 111, 6, -49, -113,
+        -21, -13, 122, 120, 76, 87, 84, -43, 91, -26, 44, -62, -67, 68, 82, -65,
+        -112, 78, 99, -18, 111, -7, -27, -95, -45, -32, 91, 35, -82, 4, 48, 39,
+        8, -53, -66, 8, -38, -65, 31, -73, 127, -67, 116, -48, -91, 66, -99, 126,
+        68, 67, -101, 31, -73, -94, -65, 63, 105, -56, -20, 3, 70, -118, 84, 76,
+        -8, 123, 20, 27, -57, -67, -72, 116, -74, 59, -14, -24, -66, 83, 14, 57,
+        -116, 72, 119, 9, 99, -98, -94, 85, -47, 62, 108, 102, -39, 3, 112, -108,
+        11, 114, 26, 78, -27, -23, -72, 48, 125, 100, 118, 74, 71, -67, 83, 70,
+        -47, -83, 95, -127, 81, -92, 23, -87, 106, 23, 114, -9, -9, -79, -116, -66,
+        -120, 83, -1, -62, 122, 103, -127, 22, -70, -124, -1, 95, 93, -70, 70, 13,
+        127, 10, 29, -78, 65, 80, -37, -46, -127, 102, -28, -9, 6, -93, 103, -94,
+        -28, 96, 36, 60, 20, -58, 126, 114, -111, -88, -6, -18, 4, 70, 48, -70,
+        116, 23, -2, 4, 120, 22, 48, -93, 30, 48, -93, -117, -47, 65, -113, -90,
+        -80, -40, -33, 7, 5, 103, -84, -115, 6, 70, -30, -5, 19, 26, -25, -94,
+        -100, -68, -64, 1, 80, 39, 115, -9, -38, 93, -62, 116, -57, 120, -64, -108,
+        -39, 19, -44, -113, 51, 123, -31, 12, -26, 126, 100, 95, -71, 75, -68, -102,
+        124, 77, 63, 111, -16, 103, 110, 79, -36, -71, -29, 78, 58, 105, 22, 77,
+        -120, 60, -6, 87, 98, 86, 19, -122, 54, 51, 63, -80, -25, -18, -107, -37,
+        121, 4, -8, 7, -65, -81, -96, 7, -4, 125, 11, -64, 57, -79, -36, 25,
+        0, 103, 6, -37, 111, 5, 127, 87, -16, -9, 26, -2, 94, 3, -80, 6,
+        -73, 117, 109, -34, -14, -5, -126, -78, 11, 116, -23, -99, -78, -95, 127, -122,
+        -127, 26, 16, 2, 97, -99, 47, 50, -84, -41, 37, 14, 54, -127, 121, -70,
+        -97, 1, -41, 89, 35, 126, 42, 112, 49, -39, -31, 38, 118, 16, 114, 103,
+        -93, 22, 58, 27, -75, -128, -86, -111, 123, -94, -110, -122, -126, -37, -19, 7,
+        24, -100, -4, -105, -27, -95, -121, -75, -14, -48, 67, 93, 30, 122, -120, -2,
+        96, -63, 19, -4, -49, 2, 114, 85, 105, -30, 81, 109, 19, -113, -12, 38,
+        30, -95, 72, -107, 86, -85, 62, -82, -83, -6, 88, -81, -6, -8, -46, 67,
+        -116, -121, -83, 81, -87, -3, 67, 109, -19, 31, -12, -38, 63, -64, -40, -127,
+        119, 20, -106, -31, 42, -81, 25, -121, -45, 89, -25, 3, 104, -38, 89, 7,
+        117, 25, 91, 28, 95, 44, 123, 94, -31, -82, 122, 94, -24, 46, -5, 30,
+        -48, -50, -66, 23, -72, -52, 46, -19, -27, 46, -73, 80, -73, -57, 65, 62,
+        -91, -53, 105, -106, -105, -55, 68, -30, 76, 22, 8, 101, 34, 1, -37, 29,
+        5, 115, -53, 75, 54, -26, 114, -43, -98, 125, 124, -93, -33, 94, -9, -21,
+        -3, -11, -70, -18, 55, 73, -53, 95, -87, 95, -31, -51, -48, -81, -60, -55,
+        -18, -41, -29, -94, -11, -35, 117, -120, -1, 89, 95, -113, -109, -67, -81, 71,
+        72, 66, -25, -72, 90, -5, 73, 109, -19, 39, 122, -19, 39, -68, -10, -76,
+        90, -5, 105, 109, -19, -89, 122, -19, -89, 8, -76, -111, -33, -72, 5, 50,
+        -35, 45, -73, 53, 18, 123, -63, 35, -33, 89, 113, -28, -8, -68, 59, -116,
+        -96, 25, 46, 116, 5, -16, 25, -32, 82, 44, 97, 99, 100, 43, -8, -121,
+        43, 68, -38, 14, -32, 91, -126, -121, 104, 72, -122, 9, -82, 58, -37, 76,
+        60, 45, 30, -58, -36, 108, 91, -73, -71, -90, 64, -21, 70, 13, -126, 125,
+        12, 20, 9, 114, -115, -115, -59, -99, -14, -2, 120, 31, -76, -17, -62, 30,
+        -2, 103, 125, -3, 78, -23, 125, -3, 78, 97, -16, -39, 73, -58, -26, 108,
+        -14, -24, 95, -49, -106, 15, -127, -92, -88, 87, 88, 94, -107, -88, 68, -107,
+        -102, 78, -125, -65, 17, 118, 36, -76, 20, -49, -70, 36, -49, 117, -91, -45,
+        111, -45, 44, 70, 52, 10, -69, -1, 64, -35, 113, 18, 17, 62, -48, 17,
+        -105, 31, 10, -69, -111, -71, -18, 32, 29, 111, 59, -45, 29, -61, -70, -55,
+        120, 14, -31, -48, -78, 0, 26, 120, -84, -53, 0, 2, -124, 72, 102, 6,
+        67, -55, -16, 0, 116, -103, 44, -61, -4, -52, 83, 85, 48, 27, -10, -68,
+        -116, 14, 125, -23, 84, 56, -26, 63, -72, -9, 47, 108, 83, 89, 50, -122,
+        -110, 49, 110, 62, -34, -108, 40, 50, 86, 69, 70, 80, 100, 4, 66, 21,
+        -9, -104, 11, 115, -112, -84, 68, -15, 119, -116, -117, -72, 115, 85, 124, -63,
+        -62, 4, 44, 64, 26, 18, -91, 94, -62, -90, 33, -29, 0, 72, 80, -78,
+        -36, -11, -80, -21, 93, -125, 44, 101, -102, 34, -8, 13, -106, 57, 44, -56,
+        -36, -65, 82, 74, 33, 54, 67, -68, -16, 36, 0, -79, -54, -114, -102, 15,
+        -93, -94, -6, -61, -88, -56, 55, 15, -54, -82, -22, 14, -54, 64, -74, -85,
+        -61, 93, 88, 64, 58, -40, 87, -120, -101, -72, -76, -53, -37, -100, -86, 0,
+        49, -88, -14, 97, -103, 55, -82, 50, -35, 121, 51, 99, -42, 40, -52, -46,
+        37, -120, 123, 19, 109, 51, 76, 64, -67, -101, -1, -47, -4, -103, -120, 119,
+        -40, -116, -9, -44, -87, 93, -58, -7, 2, -113, 90, 9, 40, -96, -99, -122,
+        -122, -9, -23, 54, -37, -41, -123, 117, 106, -71, -16, 125, -87, 36, -57, -22,
+        -83, -52, -72, 65, 104, -4, 70, 3, 26, 77, -108, -59, -32, 42, 97, 92,
+        52, 12, 96, 100, -83, 119, -27, -95, 121, -42, 27, 75, 101, -65, -127, 108,
+        35, -13, 23, 126, -95, -34, -90, -20, 95, 44, -93, -82, 126, -51, 112, -76,
+        -56, 110, -62, -19, -66, 55, 76, -105, 36, -31, 95, 75, -81, 1, 83, 42,
+        91, -3, -113, 69, 0, 36, -90, -120, 70, 39, -37, -102, 23, -30, -6, -123,
+        -11, -17, -78, 105, -83, 89, 101, -94, -51, 70, -37, -113, -68, -39, 24, 19,
+        -33, 58, -74, 6, -9, -106, 50, -10, -9, -51, 47, 27, -22, 7, 92, 117,
+        -114, -3, -117, -60, 53, -70, -88, -103, 110, -84, -18, 24, -124, 24, 88, -113,
+        -36, 101, -102, 40, 106, -92, -71, -60, 40, 55, -103, -83, 126, 49, -116, -50,
+        -58, 37, 114, 58, -83, 16, -71, -111, -96, -89, 99, 95, 115, 92, -95, 67,
+        84, 34, -113, 60, -68, -50, 25, -7, -39, 32, -115, 84, -34, 42, 44, 109,
+        46, 104, -24, 79, -63, 44, 100, -12, -111, -114, 127, 79, -30, 104, 126, -98,
+        -2, 8, 116, -56, 32, -112, -21, -11, -75, 59, -125, 66, 120, 9, -4, 21,
+        57, 49, -68, 79, 104, -18, -96, 46, -54, 82, -77, -11, 122, 6, 42, 35,
+        30, -97, 4, -73, -4, -124, -19, -77, -54, -66, 93, -81, 111, -35, 99, 113,
+        -128, 115, 70, -95, 17, 110, -92, -5, -125, -29, -98, 80, -54, -107, -106, -14,
+        -50, -33, -27, -116, -56, 78, 102, -36, 15, -2, 59, 110, -115, -69, -3, 98,
+        -97, 30, -9, -83, -65, -73, 103, -65, -61, -117, -27, -110, -36, 100, 33, 30,
+        -27, -114, -41, -21, 15, -5, -5, -57, -11, 30, 63, -57, -11, -25, -26, -50,
+        -32, -19, 48, -14, 51, 15, -120, 124, -22, 30, 55, -5, -102, 48, -100, 59,
+        -9, -113, 75, 124, 101, 44, -7, -45, -87, -33, 29, -100, -106, 12, -38, -25,
+        -50, -16, -4, 34, -65, -12, 26, 107, 81, -85, -65, -5, -4, 12, -108, 49,
+        124, -5, 110, 12, 10, -102, 16, 39, 93, 13, -79, -128, -35, 18, 11, 25,
+        -71, 26, 75, 6, 9, -116, 51, 87, 96, 13, 6, -42, 73, -50, 34, -103,
+        -88, 119, -70, 33, 87, -35, -33, -71, 31, 9, -79, 59, -53, -51, 29, 119,
+        -71, -65, -49, 19, -17, -84, 17, -32, 84, 27, -79, -36, -14, -84, 69, 22,
+        -37, -33, 33, -101, 67, -35, -18, 52, -56, 63, 75, 46, -88, -128, 53, 90,
+        0, -10, 89, 14, 122, 1, -87, 19, -13, -29, -99, -57, -33, -50, 89, -89,
+        124, -76, 111, -1, 14, 99, 25, -80, -24, 69, -41, -10, -15, -18, -45, -26,
+        -49, -24, -9, -80, -77, -36, -5, -28, -116, -68, 30, -42, -21, 123, 23, -35,
+        -33, 39, -121, -18, 123, -105, -105, -110, 67, -18, -16, 107, -52, 31, -101, 43,
+        15, -50, -12, 3, -17, -33, -35, -113, 24, -77, 105, 5, 83, -7, -99, -23,
+        4, -63, -104, 109, 90, 60, 62, 15, 19, 0, 11, 48, -58, 69, 30, -122,
+        9, -39, -27, 9, 89, 112, 121, 78, 49, -15, 21, 38, -46, 62, 103, -42,
+        -34, -33, -127, 117, 108, 111, 38, 14, 3, -92, -9, 102, 51, -17, 48, -15,
+        -117, -102, 25, -93, -29, 87, -87, -107, -105, -112, 102, 54, -126, -83, 48, -76,
+        98, 100, 19, -92, 21, 65, 76, -67, -116, 7, 2, 120, -27, -93, 43, -43,
+        -17, -18, 63, 81, 50, 21, 116, 23, -92, 33, 85, -48, -107, -107, 57, -2,
+        -101, -101, -126, -4, -31, -68, -15, -122, 83, -3, -67, 119, -72, -48, 21, -38,
+        80, 75, 24, -122, 85, 42, -46, 64, 66, -42, -21, -109, 122, -49, 23, -17,
+        -92, 83, -21, -116, 105, -121, -16, -33, -35, -58, 125, -27, -72, -16, -17, 29,
+        -7, 80, -94, 60, -26, -72, 13, 36, 10, -120, -41, -37, -3, -3, 47, 105,
+        109, -127, -83, -3, 94, 86, 25, 0, 33, -110, 63, -27, -24, 88, -39, -52,
+        -66, -34, -60, -79, 91, -35, 99, 19, 32, -113, 75, 101, 57, 4, 25, -57,
+        -102, -90, 89, -12, 59, 58, -109, -60, 72, -32, 40, 106, 80, 49, -28, 102,
+        -82, -82, -37, -123, -14, 93, -121, 83, 88, -5, -114, -50, 51, 1, -95, -104,
+        -114, -97, 31, -12, 54, 32, 114, 97, -120, -116, 104, -44, 84, -65, -117, 81,
+        92, -73, -42, -49, -29, 0, -74, -37, -72, -66, 58, -62, -73, -87, 58, 85,
+        6, -119, 43, 83, -11, -56, 52, 65, 117, 16, -89, 109, 70, 56, -73, 54,
+        -64, 84, 72, -42, -64, -2, -66, 84, 41, -61, -5, -74, -96, -5, 41, 34,
+        -86, 32, 110, -31, -75, -30, 109, -18, -54, 116, -115, -81, -50, -90, 116, 63,
+        -77, 84, -109, -99, -13, 11, -84, -92, -15, 55, 25, -91, -90, 95, 107, -108,
+        82, 102, -91, -127, -72, -83, -4, -20, -23, -2, 62, 41, -38, 74, 77, -4,
+        -50, 98, 87, -94, -105, 29, 121, 113, 25, -93, -25, 80, -8, 95, -77, 82,
+        84, -82, 20, 25, -107, -128, -31, 115, 111, -50, -79, -33, 5, -111, -80, 7,
+        82, 96, 15, -92, 62, 82, 55, -124, -99, 9, 106, 9, -27, 26, 63, 81,
+        23, -61, 127, 14, 123, -35, -82, -121, -107, -76, -84, 30, 102, -11, 88, 22,
+        -74, -91, 101, -11, 49, -85, 47, -78, -26, 122, -42, 17, 102, 29, -79, 44,
+        -70, -67, 79, 35, -70, -10, -9, 108, 107, -100, 38, -117, 2, 25, -5, -88,
+        -50, -97, -44, -102, 71, -31, -106, 76, -68, -66, 121, 12, -92, -67, -71, -56,
+        -43, -30, 10, -40, 105, 67, 62, -55, 44, 25, -113, 37, -24, -57, -21, 53,
+        -103, 31, -60, 89, -44, -88, 86, -21, 100, -88, 109, 95, 15, -71, 35, -126,
+        -91, 124, 123, 12, -97, 2, 116, -87, -75, -57, 46, 46, 26, 93, 92, -80,
+        39, 46, -82, 5, -5, -67, 96, -65, 57, -4, -25, 120, 0, 6, -87, 115,
+        42, -115, 81, -109, -65, -83, -21, -110, -29, 73, 124, 49, -67, 116, -122, -8,
+        -81, 23, -41, 69, -77, 9, -7, 96, 67, -18, 98, -128, -85, -28, 10, -57,
+        13, -23, -74, 65, -69, 28, -16, -17, -102, -19, -35, 43, 127, 100, 88, 43,
+        -120, 101, 30, -10, -35, -101, 82, 58, -77, 98, 28, -10, 7, -37, 87, 2,
+        -24, 22, -29, -26, 98, -106, -28, -125, -32, -107, 93, 16, -16, -102, -60, 21,
+        -34, -111, -72, 113, 51, 47, 5, -38, 37, -86, 65, 122, -25, 17, 102, -64,
+        -65, -103, -41, 121, -30, 94, 67, 66, -33, -67, -122, -124, -2, -122, -99, 67,
+        73, 34, 45, 8, 37, -59, -117, -21, -70, 116, 87, -102, -82, -37, 3, -11,
+        -118, -126, 73, -102, 52, 20, -23, 81, 17, -59, 44, 74, -123, 122, 90, 33,
+        -47, 78, 95, -46, 84, 42, -44, -45, 58, 83, -47, 100, -76, 75, -46, -25,
+        -31, -78, -64, 120, 45, 32, -2, -99, 6, 75, -126, -23, 54, 51, 93, 1,
+        -59, -23, -14, -59, -116, 23, 38, 69, -13, 26, 70, -121, 126, 5, -20, 10,
+        6, 124, -68, 6, 125, 39, 94, -95, -62, -119, 116, -121, 119, -125, 114, 55,
+        70, -39, 70, 106, 12, 116, 56, 99, -9, 99, 14, 5, 77, 2, -30, -86,
+        5, -125, -63, 35, 116, 105, 16, 121, -58, -53, 14, 69, 8, -75, -82, -101,
+        -76, -113, -100, 3, -85, -45, -23, 88, 94, 104, -80, 2, -20, -87, 81, 45,
+        102, -82, 124, 56, -28, 37, -115, -107, -122, -56, 38, -107, -14, 31, -57, -55,
+        104, -102, 114, -77, -95, -104, 86, 108, 78, 107, -54, 63, -1, -58, -126, 88,
+        -112, 70, -100, 102, 44, 36, 26, -87, -59, -62, -17, 104, -94, 3, 10, 117,
+        -31, 81, -98, -97, -96, -122, 99, -102, 10, 45, -117, 27, 10, -93, -4, 67,
+        28, 68, 9, 78, -95, -94, 3, 75, 27, -95, -78, 111, -110, 119, -71, 56,
+        127, -65, -15, -77, 65, 74, -98, 72, 22, -24, 41, 89, 97, 57, -18, 104,
+        127, 127, -60, -127, 11, 25, 35, 101, 73, 100, -69, 64, -114, -39, -127, 9,
+        2, 41, -86, 100, 107, 19, -122, 6, -84, 44, -100, 44, -128, -6, 89, -20,
+        -36, 22, -44, -17, 59, 49, 55, 111, -30, 10, 88, 121, -119, -97, 64, -39,
+        94, 111, 14, -38, -104, 106, -62, -117, -123, 72, 91, 10, -60, -111, 57, -61,
+        -103, 95, 103, 111, -60, -75, 48, 125, -90, -52, 16, 18, -103, 30, 66, 2,
+        38, -113, -63, 33, 38, 0, -111, 27, -32, 79, -11, 120, -115, 82, 39, -74,
+        -22, 97, -39, -115, -69, 66, -111, -98, 25, -108, 97, -27, -13, 121, -112, -40,
+        55, 120, -16, 47, 126, 118, -110, -112, 78, 109, -55, 33, -36, -77, 89, -37,
+        58, 62, 55, 54, -49, -37, -98, -7, -53, 97, -83, 37, 21, -41, 24, 93,
+        -79, -18, 55, 109, -23, -98, 38, 6, 70, 1, 72, 102, -14, 0, 40, 112,
+        -15, 100, -57, -62, -118, -19, -128, -112, -105, 12, -87, -48, 100, -108, -128, -116,
+        -41, -66, -126, 97, -110, 33, -47, -77, -126, 69, -111, 90, -82, -123, -53, -46,
+        70, 5, -63, 34, 19, 46, 126, 93, -45, 42, 89, -96, -127, -80, -17, 91,
+        66, 109, -76, -24, 114, 53, -123, -39, 96, 117, -65, 103, -20, -80, 101, 29,
+        -52, 55, 56, 24, 118, 0, 68, 87, -69, -43, -94, -5, -79, -103, -61, -73,
+        -123, 63, 118, 103, -58, -106, -35, 118, 37, 15, 56, -123, 95, 0, -101, 28,
+        8, -57, -56, 57, 98, 25, 36, -64, -2, 21, 97, -71, -72, 60, 74, 70,
+        72, -116, 36, -120, 30, 121, 86, 38, -94, 113, -79, 20, 17, -58, 65, -18,
+        30, 104, -23, 103, 32, -4, -117, 124, 24, 28, -10, 61, -7, 53, 80, 71,
+        25, 1, 108, 26, -64, 53, 32, 17, 93, -31, -30, -46, -21, -12, 31, 4,
+        7, 68, 29, -124, -99, -125, -62, -27, -92, 46, -5, 47, 67, -89, 2, 121,
+        50, -41, 78, -127, 61, -83, -68, -112, -2, -114, -16, -88, 14, -81, -27, 113,
+        80, 70, -52, 8, 54, -28, 127, 49, 102, 18, -127, 26, 70, -126, 78, 13,
+        -81, -31, 55, 35, 40, 37, 27, -69, -106, -49, -51, 38, -61, 106, 18, 72,
+        67, -36, -22, -62, -13, -50, -24, -117, 55, 88, 58, 100, -46, 75, 16, 38,
+        15, -85, 73, 32, -108, 85, 44, -6, 70, -87, -46, 88, -116, 68, 15, 52,
+        14, 92, 46, -58, 20, -103, -84, -49, -82, 34, -48, -46, -32, -95, 17, 95,
+        53, 91, -69, -100, -126, -47, -125, 9, -2, 116, 19, 51, 87, 16, 103, -89,
+        96, 118, -32, -34, -35, 3, -90, -51, 96, -8, 67, -95, -3, 95, 2, 83,
+        -55, 32, 115, 45, 66, -102, 110, 76, -39, 125, 15, -126, -57, -119, -43, -115,
+        -95, -71, -81, -35, 57, -89, -35, 59, 49, 14, 118, -103, -91, -115, 69, 101,
+        -51, 118, -108, -3, -89, 37, -17, -44, -41, 92, 99, -117, 106, -81, -88, -115,
+        -123, 43, -91, -102, 7, 98, -56, 61, -117, -38, -95, -85, -82, -75, -79, 27,
+        66, -62, 8, 35, 75, -77, -124, -52, -67, -59, 3, 86, 89, 92, 52, -118,
+        -15, 18, -56, 74, 4, -102, 66, -75, 125, -53, -67, -8, -62, 30, 46, 29,
+        -105, 43, -76, 126, -11, -10, -115, -31, -31, -55, -99, -119, -83, 34, 91, -124,
+        44, 56, 83, 13, 72, -91, -33, 40, 6, -2, 105, -68, -43, 51, 77, 65,
+        -10, -44, -101, -59, -64, 24, -110, -35, 68, -7, 121, -70, 24, 77, 95, -122,
+        55, 32, 76, -119, 35, -105, 109, 77, 12, -126, -110, -77, 105, -18, -90, -52,
+        -39, 52, -83, 56, -101, -102, -122, -72, -1, 54, 40, -8, -107, -8, 71, -109,
+        -72, 31, -2, 81, -47, 63, 17, -1, 56, 60, -65, 2, -1, 26, -47, -92,
+        -118, 126, -128, 83, -124, 126, -2, 78, -12, 3, 68, -3, 2, -20, 11, -86,
+        22, -14, 2, 109, -59, 21, -84, 121, 73, -58, -40, -1, 30, 72, 3, 74,
+        -127, 117, 29, 32, -45, 34, 10, 118, 79, -64, -16, -40, -92, 91, 125, -66,
+        121, -77, 104, 92, -39, -30, 74, -98, 43, 87, -14, -116, -71, -110, -77, -109,
+        -57, -5, 87, 26, -20, 42, -54, -93, 21, 37, 110, -113, -5, 61, -46, -37,
+        59, 13, 120, 18, -60, 113, 122, 123, 10, 43, 24, -51, -29, 80, -75, 35,
+        -3, -19, 113, -97, 52, 119, 39, 79, -29, 49, -106, 109, 115, 49, -12, -78,
+        101, -89, -94, 81, -115, 124, -52, -54, -37, 86, 71, -109, 68, -39, 38, 104,
+        -47, 57, 15, -34, 76, 64, -15, 1, -81, 34, 127, 97, 125, 38, -104, -72,
+        -83, -102, 44, 18, 38, 85, -45, -26, 53, 101, -90, -48, -88, -104, -50, -36,
+        -34, -63, -61, -48, -105, 109, 52, -9, 67, -117, -90, -19, -30, 56, -101, -63,
+        -56, -114, 65, -73, -77, -89, -50, 102, 87, 107, -124, -80, -124, -59, -12, -53,
+        -43, -124, -33, -83, 88, -127, 54, -67, -19, 37, 124, 116, -120, -34, -123, 91,
+        34, 8, -102, -66, 119, 82, -31, -83, -68, -107, 20, -47, 118, 19, -44, 101,
+        -20, 84, -71, -49, -104, 113, -97, 49, -25, 62, -14, -96, -19, 94, 36, 105,
+        23, 47, -100, 124, 41, 47, -100, -80, -47, 76, 36, 47, -36, 57, -100, 42,
+        -31, 117, 100, 113, -1, 30, 4, 21, 61, 124, -22, 103, -48, -128, 57, 4,
+        -95, -69, 111, -98, -39, -105, 115, 81, -125, 56, -36, -81, 100, -119, -121, -106,
+        81, -53, -37, -122, 119, -18, -67, 120, 110, -56, -49, -20, 119, -80, 93, 57,
+        -94, 10, -41, -3, -61, -57, 116, -87, 71, 81, -58, -91, 57, -90, 27, 44,
+        39, 97, -67, 28, 47, 44, 114, 119, -46, -84, 82, -1, 74, 27, -117, -17,
+        -6, 34, 93, -14, -89, 34, -8, 23, 70, 36, -72, -61, 80, 49, -53, -125,
+        -112, -101, -31, 72, 83, -19, -84, -32, 123, -54, 13, -88, -101, -78, -99, -112,
+        12, 120, -69, -100, -40, -9, -20, 123, -97, -89, -127, 8, -95, 127, 10, 115,
+        -31, 45, -38, -30, -124, -78, -121, -3, -94, 50, -35, -18, 119, -69, 48, 66,
+        -6, 67, 86, -106, -62, 85, -42, 58, -113, -101, -68, -108, 21, 42, -44, 109,
+        79, -111, 43, 77, 93, -24, 93, 124, 125, 109, 73, 71, -40, -18, -58, 25,
+        4, -5, -5, 41, -9, 34, 40, -24, 34, 109, -102, -51, 48, -94, -106, -101,
+        -43, -16, 15, 12, 34, -110, 50, 115, 64, -30, -89, -99, -85, 43, 4, -90,
+        -44, -61, 64, 99, -59, 84, 33, 30, -44, 5, -42, 5, 114, 44, 34, -105,
+        -64, 26, -80, 19, -83, -60, 12, 21, -108, -120, 80, 65, 74, 58, -62, 16,
+        -128, 8, -118, -65, 69, -59, -12, 85, 28, 71, -13, 60, -54, -73, 4, 52,
+        108, -62, 4, 17, -41, 24, -101, 122, 71, -117, 67, 49, -7, 16, -110, 39,
+        41, -34, 88, 45, -4, -48, 13, 53, -73, -71, -122, 90, -74, -13, -36, -113,
+        14, 123, -99, -98, 17, 116, 93, 84, 108, 31, 13, -126, -25, -35, 65, -48,
+        -10, -113, 28, 18, -123, -96, -115, -77, -59, 21, 11, 14, -55, 27, -24, 2,
+        -128, -97, -15, 54, -76, 120, -82, -27, -63, 24, -31, 105, 3, 110, -15, -59,
+        -25, -33, -12, 82, 86, -57, -38, 104, -49, 69, 112, 118, -8, 13, 97, 10,
+        27, -82, -74, -55, -101, 106, -85, 63, 56, 40, -60, 89, 17, -116, 62, -121,
+        99, -26, 127, 113, 14, -37, 63, -50, -1, 104, -25, -58, -117, 75, -23, -38,
+        -56, -34, -120, -128, -123, 97, 39, -128, -75, -31, 52, -60, -102, 68, -91, -64,
+        -67, -27, -30, 23, -31, 125, 66, -123, -112, -115, 86, 66, 62, 103, 54, -75,
+        65, -10, -84, -95, 115, -116, -1, -19, -88, -24, -66, -27, 46, -77, -53, -117,
+        -32, 18, -67, 90, 72, 20, 87, -78, 46, -122, 106, 57, 104, 40, -114, -126,
+        48, -119, 35, 121, 77, 76, 86, 92, 1, 5, -6, 23, 108, -20, 127, -122,
+        119, -23, -96, 18, -95, -34, 112, 28, -29, 64, -40, 117, -41, -120, -62, 76,
+        123, 37, -81, 3, 62, -39, -30, -14, 126, -43, -11, 120, -106, 84, -109, 61,
+        121, -16, -25, 77, 25, 113, -51, -34, 62, -17, -70, 123, -46, 37, 95, 91,
+        -76, -60, -41, -43, -59, 121, 35, 91, -67, 103, 27, 14, -97, -121, 118, 105,
+        24, 91, 121, 3, -6, -11, 89, 48, 11, 127, 65, 40, -28, -37, 66, -51,
+        54, -63, 30, 100, -119, 108, 101, -126, 94, 127, 17, -121, 66, 91, 119, 47,
+        117, -17, 5, 36, -81, -64, -19, 39, 105, -74, 122, 23, 92, -123, 113, -66,
+        43, -62, 20, -99, -66, -107, -62, -21, -54, 88, 79, -53, 96, 25, 81, 64,
+        9, 60, 121, 12, -57, -48, -14, 121, -6, 19, 62, -19, 25, -115, -8, -5,
+        86, -26, -85, 29, -123, -2, 90, -88, -39, 72, 76, -93, 65, 101, 102, 70,
+        110, 44, 118, -47, -42, -10, 122, -108, 124, 60, -24, -79, -109, -120, -88, 46,
+        102, 59, 65, -92, 17, -97, 100, 108, -101, 45, -76, -61, 47, -54, -60, -95,
+        52, -12, 74, -108, 118, 24, -115, -92, 6, -20, 50, 110, -80, -28, -49, 0,
+        -31, -89, -5, 53, 13, -102, 43, -59, 103, -57, -50, 43, 106, 47, 82, -101,
+        51, 68, -45, -75, 10, 47, -96, 38, -117, -43, 115, -118, -39, 83, 31, -16,
+        44, -12, -59, -8, 81, 20, -26, 113, 59, -8, -22, -120, -38, -29, 40, 31,
+        65, -45, 33, 127, -58, -84, 46, -117, 79, 99, 91, -119, 123, 116, 79, -29,
+        100, -17, -72, -32, -66, -73, -61, 3, -65, -46, 30, -45, 34, -80, -32, 123,
+        58, -48, 63, -96, -112, 86, -27, 9, -57, 28, 57, -96, 24, -118, 25, 13,
+        -12, -9, 11, -48, 38, -41, 106, -19, -60, 23, 101, 66, -22, 14, -22, 94,
+        -15, 51, 25, 93, 97, 68, -88, -121, 41, 3, 19, -31, 90, 38, 124, 40,
+        87, 125, 19, 65, -12, 105, 124, -4, 25, -99, -31, -18, 17, -118, 72, -76,
+        -75, 125, -4, -28, -61, 36, -58, 8, -20, 19, -124, -28, -18, 32, 125, 22,
+        -120, 113, -90, 56, -50, 82, 19, 31, 65, 11, -65, 72, 47, -97, 23, -90,
+        97, 70, -53, 122, -122, -31, -74, -78, 3, 63, -64, -9, 102, -108, -125, -128,
+        57, -85, 15, 24, -88, 39, -7, -30, 77, -51, 58, -30, -107, 119, 45, -113,
+        -7, -56, 80, 101, 125, 66, -75, 62, 53, -17, -6, -16, -77, 61, -83, -117,
+        -86, 64, -123, -49, 34, 33, -56, 50, 22, 50, -82, -37, 125, -128, -81, -1,
+        28, 102, 104, 107, 97, -41, -84, -103, -45, 6, 55, -79, 81, -127, -61, 122,
+        84, -69, 31, -117, 29, -16, 118, 19, 41, 113, 4, 21, -62, 31, -113, 22,
+        49, 80, -1, -15, -49, -24, -95, -35, 8, 90, -31, -61, 86, -70, -102, 34,
+        -98, 10, -19, -46, -51, 116, 55, -10, 59, 61, 119, -54, -112, 59, -17, -84,
+        8, -5, -24, 29, 36, 0, -94, -80, -39, 125, 58, 6, -46, -18, -88, -85,
+        -28, -35, -63, -24, 25, 81, -13, 79, 0, 102, -3, 74, -71, 104, -128, 77,
+        -127, -56, 65, 112, -107, -37, -78, -20, -59, -24, -78, 77, 100, -101, 127, 56,
+        -14, -74, 122, -105, 27, 99, -74, -74, -64, -21, 58, -50, 32, -17, 44, -39,
+        72, -11, 18, -63, -14, 99, -101, 49, 25, 7, -122, -1, 123, 93, -127, 95,
+        89, -127, 95, -43, -59, -8, 49, -52, 102, -4, 76, 118, -53, 39, 51, -122,
+        -55, -16, 103, 81, 69, -42, -59, -8, -14, -48, -72, -16, 68, -15, -94, 125,
+        49, -110, 67, -51, -67, 8, -104, -83, -42, 45, -65, -38, 112, -54, -122, 39,
+        -66, 112, -108, 70, -99, -62, 23, 61, 25, -55, 65, -71, 7, -2, 6, 10,
+        96, -93, -104, -93, -111, -15, -96, -9, -40, 17, -31, 1, 25, -44, 64, 122,
+        -31, -81, 10, -99, -66, -3, -23, 31, -65, 28, -65, -5, -21, -85, -3, 125,
+        20, -63, 74, -48, 37, 73, 24, -11, -102, -97, -62, 73, 78, -81, -113, 87,
+        113, -32, 46, 17, 15, -59, 49, -117, 87, 119, 48, 81, 46, 21, 19, 0,
+        26, 95, -50, -74, 90, -14, 9, -20, 22, -8, -57, -68, 99, -49, -13, 33,
+        7, 3, 32, 124, -7, 56, 99, 95, -76, 80, 0, -14, -78, 69, 63, -108,
+        65, -122, -18, 86, -76, 51, -68, -52, -115, -72, 72, -13, -119, 37, 20, -18,
+        -17, -20, 71, -22, 46, -39, 15, -40, 35, 108, 65, 62, -78, -17, 72, 86,
+        -31, 9, -127, -117, -98, 16, -24, -47, -15, 86, -76, -27, -59, 50, -19, -109,
+        -105, -56, -33, 31, -67, -87, -7, 16, 77, 58, 105, -96, 125, -122, 108, -26,
+        -18, -94, -24, -48, 78, -115, 4, 38, 47, 38, 41, 75, -38, 10, 37, 48,
+        82, 114, 42, 73, -8, 40, 86, -112, 69, -59, 116, 22, -115, -122, 69, -93,
+        8, 35, 37, 109, -70, -122, 72, -58, 8, -24, 29, 100, 44, -69, -74, 69,
+        116, 101, 113, 11, -18, 10, -120, 18, -78, 102, -37, -115, -40, -117, -79, 8,
+        4, -116, 34, 51, 44, -68, -102, 121, 25, -17, 15, 33, 24, -45, -55, -18,
+        23, -64, -40, -5, 94, -121, -38, -69, 95, 37, -88, -61, 120, -73, 24, 57,
+        72, 125, 21, -118, -86, 112, 16, -31, -126, 23, 48, 9, 95, 15, -28, 35,
+        112, 56, -70, 28, -74, 123, -98, -16, -30, -31, 35, -59, 69, -88, 41, -119,
+        -57, 68, 118, -87, 25, 78, -16, -96, -103, -18, -10, 86, 100, 65, -57, 105,
+        -25, 82, 78, 127, -42, 27, -122, -121, -103, 103, 87, -85, -122, 80, -52, 57,
+        -52, 74, 0, -8, -44, -64, 24, -22, -15, -50, 13, 74, 28, 66, 6, -88,
+        -23, -84, -96, 49, 106, 75, 41, 15, 48, -38, -104, 122, 64, -30, 26, 8,
+        -78, 89, -58, -50, -100, 61, -112, 97, 34, 13, -98, 16, -124, 74, 7, 19,
+        -119, 58, 110, 42, 127, -21, -74, -96, 5, -57, 31, 25, 45, 0, 118, 85,
+        38, 15, 106, -96, 18, -93, -22, 68, 83, 22, 7, -89, 86, 102, 45, -115,
+        48, -84, -18, -99, -48, 24, 31, 73, 1, 82, -52, 45, -36, -44, 17, -2,
+        -121, 24, -62, -89, 112, 19, 71, -72, -97, 102, -66, -116, 109, 46, -96, -124,
+        -78, -124, -92, 101, 73, 59, 117, 14, -75, 28, 4, -84, 4, 55, 30, -107,
+        100, -112, -85, -47, 123, -116, -60, -121, 101, 42, -5, 74, 44, -116, -89, -43,
+        -41, -52, 90, -93, 105, 56, -6, 124, -126, -127, 77, 119, 17, -93, -67, -98,
+        -53, -98, 0, -42, -108, 15, -95, 10, 72, -75, -67, -64, 104, 52, -20, 108,
+        -74, 1, -92, 34, -78, -76, -12, 108, 30, -91, -15, 98, -106, -104, 73, 65,
+        50, -114, 67, -116, 16, -1, -39, 72, -65, 74, -105, 31, -30, -76, 80, 105,
+        -21, 117, 116, 112, -32, -86, -34, -59, -79, -16, -63, 1, 65, -125, 105, 22,
+        -60, -85, -18, 40, 120, -21, -117, 32, 59, 73, 23, 9, 16, 27, 87, 11,
+        -26, -118, -66, -98, 53, 79, 86, -94, -15, -82, -47, 28, 42, -43, 91, 66,
+        3, 110, 7, 103, -107, -119, 21, -110, -24, -119, -111, -94, -23, -7, 81, 118,
+        101, 15, 75, -23, -33, 77, 117, -113, 85, 17, 20, 81, -51, 70, -104, 34,
+        109, 84, -6, -72, -69, 18, -71, -6, -104, -75, -24, -80, -96, 84, -117, -18,
+        26, 11, 123, -28, -19, -67, -19, -111, -38, 11, 15, -40, -23, 9, -102, 39,
+        -21, -97, 117, 120, -97, -95, -51, 58, 40, -74, -65, -107, -9, 13, 17, 7,
+        20, -69, 68, -125, -75, -31, 42, -51, -116, 15, 24, -31, 71, 12, 65, -24,
+        6, -62, 59, 111, 24, 82, 116, 18, -13, -124, 23, -7, -9, -85, -72, -13,
+        31, -117, 48, 91, -79, -93, 27, 124, 86, 86, 63, -50, -91, 21, 105, 107,
+        -32, 110, 109, -53, 109, -45, 48, 46, -78, 48, -10, -65, -105, -105, 5, 3,
+        -41, -6, -2, 18, -29, 85, -53, -25, 99, 125, 113, -71, -60, -49, 27, 95,
+        -45, -53, 75, -121, -76, 75, -53, -43, 98, 82, -27, 37, 95, -126, 37, -76,
+        -33, -50, -8, 41, -64, -63, 67, -57, -75, -118, 116, -82, 67, -122, -126, -10,
+        -63, 8, -121, -27, 118, 87, 91, -37, 93, 65, -69, 7, -36, -105, -38, -15,
+        -66, -68, 110, 91, -44, 21, 17, -65, 52, 60, -62, -37, 2, -13, 105, 52,
+        2, -19, -88, 114, 126, -123, -113, 83, -31, -71, -56, 18, -108, -108, -76, -77,
+        -86, 64, 67, 59, 118, -31, -89, 95, 118, -5, -87, 22, -90, 32, 113, -15,
+        38, -76, -8, -118, -23, -122, 38, 122, 28, 105, 81, 53, 95, -128, -62, 55,
+        -31, -17, -113, -30, 86, -71, 79, 8, 96, 124, -112, 100, -67, 86, 81, 39,
+        56, 112, -15, 104, 65, 36, -17, -103, -55, -5, -5, 123, -4, -119, 43, 61,
+        -43, -23, 64, -38, -52, 54, -97, -117, 21, -2, -86, 95, -122, -96, -56, 39,
+        96, -90, 13, 104, 68, 62, -21, 77, 121, -103, 28, 41, -13, -74, -27, 79,
+        68, -118, -64, -95, -11, -103, -20, 49, -57, -92, 33, 23, 99, 108, -58, 13,
+        121, -20, -35, -57, -127, -79, 113, -61, -22, -58, -91, -101, -18, 91, 6, 22,
+        111, 29, 88, -74, 101, 96, -23, -42, -127, 49, 20, -99, -46, -37, -96, -41,
+        69, 59, 96, 127, 50, 119, 4, 41, 80, 27, 18, -16, -33, 4, -35, -11,
+        107, -111, 88, -70, -10, 78, -37, 106, 13, -127, 33, 126, 8, -58, -81, -45,
+        -116, -37, 84, -111, -102, -69, 35, -48, 122, 104, 87, 28, 100, 7, 41, -4,
+        -26, -69, 54, 57, -120, 93, 49, -64, -85, 52, 27, -121, 25, 115, 48, 118,
+        -51, 81, 95, 73, -68, 117, 123, -91, -14, 76, 109, 52, -45, -104, -109, 106,
+        87, -77, -4, 70, 20, -56, -83, 20, -88, 26, 79, 41, 49, -53, 113, -57,
+        -38, 99, 6, -110, -22, -87, -51, -78, -43, -102, -93, -97, 24, -55, 2, -6,
+        109, 58, -19, -80, -27, 126, -24, 45, 119, 116, -18, 90, -115, 100, 88, -19,
+        116, -77, -108, 65, -114, -99, 58, 122, 44, -61, 71, 100, -4, -87, -77, -97,
+        0, 44, 116, -107, -93, -122, 66, -40, -96, 84, 58, 3, 68, -48, 20, 100,
+        49, -112, 59, -117, 23, 33, -98, 19, -37, 9, 65, 19, 67, 23, 69, 28,
+        -10, 51, -51, 19, 53, -71, -49, -59, -26, 106, 69, 126, -105, -104, 68, 13,
+        35, -105, 59, 24, 38, -9, -71, -24, 92, -83, 88, -41, -20, 8, -60, -56,
+        -49, 91, 90, -92, 124, -53, 44, -82, -75, 3, -124, 117, 32, -49, 2, 42,
+        -30, 76, -99, 85, -107, 5, -49, -76, 40, -33, 98, -106, -30, -70, -6, -85,
+        29, -11, 87, 59, -22, 51, -55, 104, 75, 3, 84, -64, 124, -63, 3, -120,
+        -27, -89, -34, -89, -2, 22, 110, 0, 98, -78, -75, -22, -79, -101, 85, 32,
+        35, -94, 15, 68, 95, -102, -38, -24, 49, 48, -99, 62, 48, -101, 2, -77,
+        -96, 72, -98, -49, -73, 0, 63, 49, 17, 71, 16, 1, 114, -3, 123, -99,
+        -53, -24, -115, -116, -116, -61, 32, -83, 49, -63, 115, -13, 47, -36, 114, 4,
+        85, -70, -84, 1, -36, -91, 69, -82, 19, 73, 49, 109, -113, -90, 81, 60,
+        -74, -83, 3, 59, 59, -24, -47, 3, -87, -50, 32, -91, 35, 34, 77, 4,
+        72, 107, 68, 0, -35, 72, -54, 44, -115, -90, -110, -43, 89, 33, 112, -60,
+        -23, -81, -90, 15, 38, -66, -51, 124, 54, 87, 38, 68, -47, 119, 83, 51,
+        79, 4, -82, -34, -124, 67, -106, 53, 62, 95, -91, 84, 25, -67, 12, 120,
+        -76, 70, 59, 104, -25, 21, 45, -34, 40, -23, 28, -38, 90, 107, 76, 95,
+        51, 10, 104, -99, 25, -26, 65, -65, 46, 29, -104, -57, 94, -56, -49, 54,
+        12, 113, 97, 5, 123, -113, -117, -87, -99, -43, 122, 13, 48, 37, 11, 92,
+        51, -100, -10, -9, -73, 66, 49, -61, 83, -59, -100, -34, 26, -118, 124, 105,
+        77, -74, -104, 91, -124, 114, -16, 8, -48, -55, 86, -34, -52, -99, 47, 69,
+        -120, 86, 99, 73, -125, -14, -127, -35, -57, -34, -57, -2, -67, -36, 109, 27,
+        -74, -63, 48, 50, 96, -18, 25, -97, 31, -59, 70, -38, 94, 47, 88, 26,
+        -11, -126, -27, 71, -31, 10, -76, -75, 30, 95, -63, -18, -91, 86, -103, 25,
+        88, 65, 54, -96, -24, -70, 1, -84, 120, 118, 24, 85, -81, -115, 58, -125,
+        106, -13, 0, -31, -97, 57, -92, -113, -103, -34, 6, -83, -28, 109, 104, -89,
+        -79, 21, 16, -52, -59, 126, 53, -100, -4, -40, 118, -105, 110, -9, -69, -119,
+        -64, 122, -35, 48, 93, -35, -49, 15, 15, -72, 95, -45, 113, -20, 71, 89,
+        -51, 78, -27, -107, 52, 38, -104, 126, -60, -119, 59, -62, 65, 9, 63, -6,
+        -37, -64, -96, 31, 104, -17, -128, 70, -62, -95, -47, -1, -17, 12, -114, -92,
+        14, 28, 125, 24, -103, -74, 63, -105, -38, -2, 92, -82, -41, -38, 38, -74,
+        83, -65, 110, 94, -64, -38, 122, -4, 90, 109, 101, -41, 81, 115, -16, 79,
+        -35, -50, 75, -51, -41, -36, -105, 8, -96, 101, 127, 75, 75, 125, 106, -86,
+        95, -41, 86, 82, 106, -85, -17, -88, 97, 13, 83, 47, 49, 78, 33, -39,
+        -44, -17, -29, 73, 48, -72, -97, -21, 64, -40, -60, -97, 98, -23, 68, -26,
+        -121, -69, 120, 88, -31, 0, -85, 25, 8, 87, -79, 6, -82, 89, 56, 20,
+        -43, -1, 107, -44, -6, 102, 30, 23, 72, 30, 39, 28, -11, -54, 116, -79,
+        78, 3, 39, 74, 41, 76, 44, -97, -65, -55, -60, -62, 62, 21, 30, 55,
+        81, 55, 86, 110, 26, -58, 115, -40, 121, -60, 45, 111, 13, 110, 89, -9,
+        4, 39, 8, 120, 31, 3, -61, -84, -76, 53, 98, -118, -2, -112, -119, -34,
+        91, -121, 51, 3, 27, -79, 10, 39, -109, 74, 107, 3, -35, -113, 78, -86,
+        -127, 12, -111, -1, 107, 23, -10, 50, 118, -13, 65, 28, 61, 0, -114, 106,
+        -54, 53, 126, -22, 47, -123, -43, 107, 92, 116, -33, 54, 59, 40, 120, 92,
+        -128, -113, 110, 87, -2, -2, -28, -22, -23, 117, 12, 89, 43, 90, 24, -22,
+        82, 34, -65, 57, -43, 11, -47, 45, 36, 76, -58, 39, -124, 32, 49, 123,
+        68, 0, 95, 84, 29, -29, 99, 81, 53, -70, 20, 102, 57, -14, 122, -124,
+        29, 52, 65, -82, -113, -112, 115, -98, 113, 61, 100, -22, 103, -125, -52, 15,
+        -128, 121, 78, 55, -20, -68, 117, -121, -82, -39, 52, -13, 0, 20, -41, 29,
+        51, -18, -78, -121, 38, -8, 45, 70, 117, 5, -67, 87, -122, -123, 51, 24,
+        -43, -51, 80, -65, -39, -85, -87, 92, -20, -30, -125, -53, -61, -51, 106, -15,
+        -76, -36, 45, -15, -76, -14, 106, 60, 45, -78, 114, 106, 48, 31, 25, 48,
+        31, 53, -61, -100, -99, -20, -42, -61, -51, -120, 43, -112, -70, -58, -77, -39,
+        -70, -114, 45, -68, -126, 97, 20, 19, -65, -47, -108, -10, -48, -77, 70, 76,
+        125, -85, 55, -76, -43, -59, -104, 56, -40, 105, -72, 28, -114, -123, 127, -75,
+        -41, 69, -109, 91, -75, 21, 12, 12, -48, -120, 22, -62, -3, 25, 49, -125,
+        -73, -51, -15, 99, -27, 77, 74, 105, -97, -38, -69, 71, -45, 56, 123, 57,
+        -52, 118, -81, -17, -75, -11, 65, 51, 119, -21, 84, 119, -73, -42, 9, 3,
+        -113, -105, 32, 61, -81, -21, 65, -81, -69, 99, 87, 75, -16, 48, 3, 42,
+        -90, 66, 77, 25, 30, 108, 65, 121, 114, -101, 69, 88, -20, 16, 17, 95,
+        -63, -72, -88, 94, 111, -42, 85, -42, -59, 82, 67, 34, 68, -125, 110, 114,
+        68, 92, 28, -30, 63, 30, -58, 117, 119, 6, 11, -15, -110, 106, 24, -77,
+        -5, 4, 6, 114, 47, 4, 114, -21, -53, 42, -120, 69, -55, -76, 78, 58,
+        -9, -58, -72, 14, 95, 62, 36, -72, -73, -115, -90, 97, -105, 80, -40, -46,
+        -69, -47, 78, -72, -28, -42, -90, -22, 81, -72, -53, 0, 16, -14, -9, 119,
+        43, 76, 8, -113, 85, -104, 33, -123, 78, -107, 117, 94, 122, -4, 7, -16,
+        -46, 47, -26, -111, -97, -66, -106, 71, 86, -62, -9, -90, 21, -22, -113, 38,
+        6, 27, -83, 8, 56, -16, -60, -32, -101, 3, -99, 35, -82, 76, -114, -72,
+        -70, 47, 71, -20, 106, 124, 33, -43, -39, 28, -67, -114, -125, 3, 48, 81,
+        -122, -59, -93, 64, 30, -34, -56, 19, -77, 63, -97, 39, 114, -88, 48, -98,
+        -8, 60, 21, 60, 49, 29, -92, 95, -62, 19, -11, -71, 7, 95, 52, -9,
+        118, 112, 111, -82, -104, -3, -113, -28, -118, 22, 25, -55, -17, -63, -82, 88,
+        -72, -127, -5, -77, -73, -65, 9, -30, -113, 17, 108, 118, -14, -90, 113, 13,
+        111, -30, 71, 99, -63, 48, -16, 82, -89, -62, -89, -114, 24, 79, 73, -2,
+        -25, -14, -108, -43, 31, -49, 83, 38, 91, 121, -54, -92, -12, -74, 94, 19,
+        -26, 127, -63, 3, -59, 114, -91, -27, -61, -11, -116, -21, 43, -11, -13, 47,
+        -92, 125, 14, 107, -86, 60, -48, -18, 79, -77, -69, 75, -67, -82, 67, -63,
+        -42, -22, 50, 28, -75, -121, 13, 78, -9, -23, 63, -119, -45, -83, -66, -108,
+        -45, -83, -74, 114, -70, 79, -9, -26, 116, 103, -1, 21, -100, -82, -28, 46,
+        -48, 24, 87, -121, -121, -109, 82, 110, 83, 77, -102, 96, -66, -107, -31, -107,
+        -76, -64, -64, 17, -106, -15, -69, 57, -33, -68, -52, -68, 66, -18, -31, 110,
+        37, 8, -118, -54, -42, -62, 78, -101, 65, 89, 84, 25, 69, -53, -53, -31,
+        92, -54, -19, -80, 82, 20, 86, 70, -53, -62, 79, -105, 71, -6, 81, -55,
+        25, 59, -104, -85, -30, 13, 117, -94, -17, 114, 86, 65, -33, -26, -68, -119,
+        123, -20, 112, 55, -35, 66, 75, -39, -107, 2, 27, 25, 28, 111, 81, 106,
+        -70, -27, -92, 79, -56, -83, 76, -30, -64, 110, 28, 10, -93, -97, 78, 73,
+        -121, -6, 7, -58, -61, -119, -17, 65, -48, -125, 26, -126, -98, 87, -120, -72,
+        -79, -82, -19, -35, -54, -41, 97, -81, -13, -8, 127, 60, -35, -81, 96, -60,
+        -73, -45, 125, -40, 62, -15, 86, -46, -81, 100, -79, -47, 34, 47, -46, 25,
+        62, 44, 11, -1, 47, -28, -87, 47, -92, -123, -27, 25, -28, 109, -42, 106,
+        59, -65, -103, -76, -84, 3, -67, 19, 49, 124, 24, -28, -108, -113, 80, 122,
+        106, 120, -52, 105, 3, -67, -41, 109, -27, 27, 99, 84, 23, -56, 99, -71,
+        -38, -20, -13, -102, 34, -97, 68, -56, -19, 41, -109, 120, -94, 36, 9, -77,
+        55, -25, -89, -17, -4, -46, -108, 75, -128, -103, 114, -98, 72, 119, 76, -93,
+        89, -128, -50, -26, 32, -123, 49, -64, 96, 84, 62, -106, -58, 66, 7, 26,
+        95, 94, -65, 75, -127, -6, 88, 18, 59, -79, 31, -102, -97, 80, 100, 80,
+        -38, -79, 64, 91, -33, 98, 9, -79, 71, 88, 113, 62, -51, -10, -120, -82,
+        80, -25, -91, -12, 79, -19, 49, -92, -77, 78, 71, -30, -126, -17, -104, -94,
+        64, 123, -6, -96, 93, 54, -79, -13, -44, 51, 44, -101, -107, -43, -62, 23,
+        19, 11, -29, 64, 58, -67, 87, -92, -19, -22, 81, 52, -29, 62, -114, -56,
+        -30, -25, -48, -23, -67, 2, 110, 87, 79, -96, 85, 107, -4, -8, 57, -35,
+        113, -4, 92, 24, 7, -49, -68, -6, -90, -12, 86, -112, -23, -9, -10, 103,
+        -119, 7, 117, 64, -34, 42, 30, -44, -98, 68, 43, -7, -96, 52, -18, 102,
+        -7, -128, 8, -10, -119, 127, -105, 4, -77, -48, -77, -62, 4, -17, -91, 83,
+        15, -34, -35, 12, -56, -44, 52, -9, 46, -84, 127, 11, -110, 69, -112, -83,
+        64, -75, 120, 29, 94, 101, -4, 39, -80, -117, 17, 106, 27, -57, -13, 44,
+        -118, -23, 27, 83, -1, 109, 65, -113, 52, -3, -37, 34, -58, -81, -29, -59,
+        4, -10, 14, -4, 56, 11, -25, 5, 5, 46, -127, -33, -17, 71, 69, -54,
+        126, -3, -108, -34, -120, -60, -105, -31, -120, -3, -68, 4, -122, -103, 102, -59,
+        -87, -42, 55, -21, -105, 117, -55, 58, -44, -69, 99, -67, -79, -50, 88, 79,
+        -84, 15, -42, 62, 107, 26, 90, 29, 7, 43, 108, -18, 108, -111, -116, -87,
+        38, 116, -64, 126, -100, 47, -62, -100, -3, -6, 91, 56, 78, -60, -17, -13,
+        -23, 34, -29, 63, 95, -125, -64, 73, 63, -50, 2, 88, 14, -4, -55, -57,
+        -8, 82, 54, -55, -38, 99, -115, -79, -122, 88, 19, -84, 54, -85, 10, -75,
+        -118, 52, -115, -81, -126, -52, -69, 11, -105, 115, -88, 127, -98, 2, 61, -15,
+        44, -116, 54, 4, 76, 107, -36, -126, 47, -53, 21, 89, 31, 126, -46, -77,
+        -32, 75, 101, -99, -100, -3, -94, 101, -63, -105, -27, -50, -62, 100, -31, 89,
+        -89, -16, -81, -27, -26, 34, 98, -124, 103, 105, -63, 35, 100, -22, -81, 105,
+        58, -45, 114, 90, -8, 109, -71, -65, -61, -65, 111, -95, 6, 126, -75, -34,
+        38, 44, -31, -3, -94, -32, 41, -16, 11, 61, -13, -96, -64, 7, 64, 66,
+        60, 51, 114, -77, 16, 72, -117, 103, -3, -116, 127, 88, 35, -72, 115, -34,
+        53, 72, -101, 21, 97, -109, 78, -105, -3, 59, -116, 1, -17, -19, 117, 17,
+        -96, -73, -57, -15, 45, 66, 116, -81, 71, 95, -28, -30, 20, -57, -52, -47,
+        -104, -118, -80, 75, -62, -120, -89, -52, -128, 1, -104, -54, 94, 14, -58, 42,
+        -30, -124, 26, 127, 107, 103, -2, -4, 19, -99, -36, -67, 30, -88, -30, -80,
+        -35, -113, 103, -28, -44, -53, -37, 0, 70, 50, 10, 127, -118, 70, 33, 121,
+        64, 99, -15, 89, -80, 20, -103, -77, 40, -111, -27, 80, -82, -128, -119, 99,
+        -119, 113, 56, 2, -86, -119, 119, 69, 73, -38, 16, 69, -40, 49, -110, 39,
+        -25, 4, -75, 69, -112, 61, 25, -91, -76, -9, 24, -122, -51, -88, -75, 39,
+        126, 125, -62, 7, -14, -30, 104, 34, -5, 98, -2, -121, -112, -54, -3, -55,
+        -112, 85, 16, 55, -9, 88, 24, -14, 28, -81, -46, 75, 9, 69, 11, 116,
+        -54, -91, -115, -121, -35, -82, 46, -96, -16, 86, -107, 48, 97, 109, 92, 121,
+        -89, -106, -25, 110, 92, 84, 40, 94, -112, 61, 66, -52, -96, -25, -114, 120,
+        -68, -118, -80, -117, -1, 89, -100, -121, -12, -22, 102, -64, 26, 56, 7, -8,
+        -26, -69, -22, 63, -82, -81, 95, 68, 5, -50, -112, -60, 51, 19, 16, -19,
+        -89, 58, -88, 84, 101, 29, 38, 106, 61, 27, -63, -14, 116, 39, 88, 54,
+        -76, 69, -117, 104, 14, 91, -108, -67, 72, -127, -77, -112, 29, 110, -36, 81,
+        -106, -26, 32, -63, 71, -103, -74, -52, -62, -128, -31, 89, -41, 89, -118, -15,
+        -33, 121, -68, -57, 59, 49, -5, -85, -57, -8, -97, -126, -98, 124, -81, 4,
+        90, -60, 46, -23, -47, 7, -109, 94, -5, 119, 32, -101, -15, 1, 46, 61,
+        -116, 58, 66, -18, -54, -54, 37, -61, -21, 26, 17, 93, 0, -61, 36, 111,
+        -107, -56, 43, -7, -93, -100, 42, 114, 59, -103, 77, -110, 51, 76, 3, -127,
+        -11, -48, -107, 106, -115, 8, 79, -94, 63, 10, -47, 119, 53, -115, 6, 10,
+        28, 29, 29, 89, 92, -79, 17, -79, 52, 107, -79, -102, 105, 53, 80, -35,
+        -64, 61, -38, 39, -34, -99, 102, -4, -126, 38, 71, 125, -4, -49, 114, 53,
+        -125, 32, -128, 74, -9, 90, -124, 102, 116, -36, -48, 67, -81, -52, -94, -15,
+        -72, 105, 12, 95, 12, 24, -114, 85, -54, 43, 82, 64, 100, 39, -98, -103,
+        -120, 85, -38, -112, 26, 8, -28, -66, -66, 67, -113, 80, -17, -111, 75, 70,
+        52, -8, 91, -92, 115, -104, 37, -13, 30, -11, 40, -8, -115, -108, 61, -67,
+        59, -4, -89, -116, -77, -126, 16, -42, -19, 39, 18, -20, 60, 122, 41, 68,
+        -108, -109, -126, -89, -108, 47, 107, -85, 110, 52, 18, 93, -113, -109, 43, -60,
+        -55, 62, 67, -54, -14, -85, 56, 61, 3, -105, -52, 117, -35, -66, -38, 34,
+        34, 78, -25, -88, 118, 37, -7, -93, -34, 61, 122, -58, -37, -40, 10, 127,
+        60, 70, -123, -24, -105, -86, 118, 54, -77, 114, -42, -116, -86, 125, -12, 63,
+        27, -63, -8, 82, 47, -101, -105, 26, -31, -69, -4, -49, 94, -22, 63, -111,
+        68, -88, -125, 47, -11, -126, -119, -66, -44, 120, 58, -7, -65, -113, -112, -16,
+        117, 70, -120, -8, 119, -116, -93, -16, 32, 86, -48, 74, 109, 20, 43, 97,
+        -105, -88, 14, -13, -24, 94, -61, -84, 87, 38, 117, 13, -57, 85, -112, -31,
+        75, 76, -6, 60, 115, -101, -34, -114, 70, 124, -71, -69, 6, 46, 72, 121,
+        -23, 29, 2, -29, -95, -8, -6, -103, 13, 73, 124, -98, 19, 104, -8, -57,
+        11, 9, -95, -86, 25, 19, -17, -14, -42, -88, 123, -4, 86, -80, 54, 17,
+        -17, -114, 108, -75, -34, 69, 29, -43, -68, 116, -105, 90, -26, -78, -100, -55,
+        -44, 56, -98, 91, 18, 2, 46, 105, 97, 72, -40, 35, 90, 78, -65, -120,
+        -21, -30, 47, -32, 13, 8, 82, -17, 78, -67, -14, -90, 73, 45, 93, 55,
+        12, 114, -60, 12, 11, -2, -122, 81, -110, -94, 0, -49, -98, 57, 122, -126,
+        -117, -61, 30, 69, -110, -17, 33, 121, 119, -20, -43, -89, -34, 35, -88, 40,
+        -37, -40, -72, -27, 103, -29, -116, 30, 88, 115, 71, -113, -112, 97, -24, 72,
+        110, -84, 98, -100, -94, 92, 13, 3, 62, 1, 29, -116, -123, 4, 124, 71,
+        73, 76, -39, 84, 47, 119, 25, 34, 87, -23, 61, 48, -71, -95, 105, -19,
+        8, -41, 1, -69, -29, 69, 6, -53, 42, -92, -84, 110, -73, 107, 105, 100,
+        -27, -47, -58, 101, 81, -11, 52, 0, -67, 74, 36, 85, -69, 34, 63, -5,
+        83, 93, 19, 32, -75, 32, -108, 37, 22, -13, 113, -96, 125, -102, -78, 19,
+        110, -4, -45, 84, -19, -5, 42, 37, -96, -107, 38, -17, -77, 19, -67, 102,
+        28, 78, -48, 118, 84, 21, -60, -116, 36, -91, -62, -15, -124, 106, 56, -64,
+        74, -50, 105, -123, 60, -43, -124, -18, 53, -89, 79, -86, -96, -111, 66, -38,
+        -100, -98, -116, 106, -96, 2, 66, 14, -14, 111, 28, -85, -17, -85, 108, -111,
+        79, -49, -52, -60, -115, 17, -23, -18, -24, -121, -93, -15, -47, -75, 65, 46,
+        -84, 55, 97, 124, 19, 34, -35, 117, 91, -57, 89, 20, -60, 110, 43, 7,
+        -124, -95, 56, -89, 80, -110, -117, 38, -4, -95, 0, -122, 70, -52, 75, -123,
+        -59, 117, 1, 28, 5, 101, 15, 109, 51, -8, 8, 99, 70, -105, -113, 72,
+        -122, 5, -116, 20, -23, 127, -117, 18, -64, 40, -107, -82, -72, 25, 25, 96,
+        -74, -120, 77, 26, -24, 117, 124, 68, -1, 72, 15, 111, -52, 81, -60, 118,
+        41, -39, -9, 31, -10, -97, -10, 67, 13, -19, 122, 27, 41, -3, 11, 105,
+        -65, -79, -20, 67, 77, 17, 56, -38, 112, 50, 113, -89, -87, -100, 74, 17,
+        -35, -72, -85, 109, -71, -48, 41, -64, -23, 51, -66, -80, -96, -113, 122, -61,
+        -42, -57, -104, 8, 66, -107, 52, 93, 58, 64, 66, -40, 20, 24, 17, 71,
+        -79, 76, -6, -54, 101, -65, 60, -118, 9, 41, -27, -8, -13, -100, 0, -63,
+        -98, 31, -76, -108, 65, 67, -24, 66, 117, 16, -59, 66, 48, -12, 49, 55,
+        88, 48, 85, 94, 0, 121, -113, -95, -104, -8, 27, -55, 20, 32, 88, -92,
+        92, 5, 9, 91, 88, 92, 121, -8, -63, -28, -31, -73, 35, -92, 118, 72,
+        3, -103, 77, 4, 86, 36, -65, -15, -16, 69, -32, 48, -47, -20, 3, -20,
+        -78, -16, -53, 48, -114, 102, 17, -18, 11, -53, 69, -12, 10, -112, -85, 112,
+        -9, 80, 79, 121, 11, -13, 28, 10, -68, 5, -110, 1, -2, -79, 112, 11,
+        -123, -81, -91, -86, 92, 23, -28, 32, -68, 109, -67, 68, 3, 52, -34, -64,
+        75, -15, 23, -65, -100, -121, -57, -92, 115, -28, -52, -91, 65, 1, 72, 111,
+        106, 82, 55, 108, 101, 120, -36, 78, -49, -6, -99, 12, 42, 28, -17, -40,
+        27, -68, -122, -8, 75, 64, -45, -119, -79, -60, -48, -14, 10, -9, -8, 30,
+        -58, 23, -93, -68, 59, 19, 127, -97, 118, 79, -114, 95, 63, -43, 113, 114,
+        83, -47, 94, -69, 47, 31, -2, 112, -36, 51, -16, -106, -93, 54, -119, 21,
+        -13, 56, 45, -34, 11, -117, 97, 32, -5, 64, -66, 15, -94, -42, 36, 74,
+        44, 100, 14, -128, 34, -22, 9, 33, 110, 25, -128, -91, -31, 78, 1, 63,
+        -32, -116, -96, -48, 27, -66, -11, -23, 123, 28, -27, -36, 21, -106, -80, -81,
+        -106, -17, -77, -49, -29, 57, 6, -112, -26, 34, 93, -64, -17, -108, -23, 5,
+        -2, 54, 13, 19, 30, -33, 16, -128, 25, -96, 69, 50, 67, 31, -3, 23,
+        65, -10, 30, 68, -64, 56, -104, 19, -114, -15, -92, 31, -111, 68, -4, -100,
+        -34, 18, -20, -90, -47, 56, -4, 53, -52, -16, 46, 56, 53, 67, -103, 108,
+        68, 81, -2, 114, 49, -69, 2, 2, 79, 19, 26, -13, -33, 39, -52, 64,
+        -61, 49, 48, -54, 95, 47, -110, 36, -116, 89, 121, -10, -5, -120, -42, -117,
+        27, 114, -18, -88, 87, -30, -20, -118, -123, -46, -59, 115, 97, -25, 49, -110,
+        -43, 107, 15, 70, -78, 0, -53, -122, 104, -2, 59, 110, -121, 42, -55, -76,
+        64, 48, -34, 22, -31, 44, -9, -16, -91, 43, -100, 23, -50, -3, 58, 78,
+        111, 81, 98, 98, 85, 112, 7, -21, -14, -79, -10, -20, 19, 108, 99, 92,
+        58, -99, -106, -108, 109, 72, -11, -12, 84, -73, -47, -104, -4, -128, -117, -109,
+        -3, -99, -30, -28, -29, 110, -105, 112, -115, 61, -90, -27, -35, -3, -114, -8,
+        77, -74, 56, 50, -78, -67, -96, 100, 14, 3, 69, 29, 107, -110, 65, 102,
+        82, -63, 2, -92, 49, -19, 110, 49, -65, 13, -78, 49, -55, 16, 47, 126,
+        120, -8, 24, 112, 15, 104, 21, 79, 122, -11, -6, 97, -9, -24, 4, -112,
+        -8, -106, -86, 0, 35, 85, 103, -62, 123, 36, -7, -80, 48, 3, 122, 107,
+        -13, -112, 9, 36, -81, -114, -98, 62, 70, 9, -24, -106, 127, 63, 121, -3,
+        -6, 5, 26, -103, -128, -46, 20, 51, 64, -70, 59, 105, 31, 97, 80, 69,
+        65, -120, -37, 58, -15, -41, 91, 12, 45, -102, -45, -98, 123, 36, -20, -101,
+        63, -123, -109, 0, -61, 54, 83, 81, -62, 59, 115, -101, -24, -29, 59, -50,
+        -39, -31, -76, -76, -60, 49, 19, -25, 29, -65, 92, 65, 86, 83, -119, 125,
+        77, -100, -91, -56, -62, -112, -58, -70, 123, -120, -91, -95, 52, -115, -72, 105,
+        -120, 58, -22, 50, -44, 2, 109, 4, 71, 12, -64, -1, -22, -31, -77, 55,
+        -29, 94, 32, 1, -30, -11, -34, -109, -119, -109, -15, -77, 12, -92, -19, 73,
+        -116, -106, 86, 12, -29, 64, 63, -113, 26, 12, -76, -45, 20, 3, -49, 3,
+        7, 6, 6, 9, 125, 61, 114, 73, -74, -80, 30, 49, -46, -43, 32, -4,
+        50, 19, -116, -96, 5, -8, -63, -75, -42, 71, -4, -109, 83, 60, -7, -3,
+        94, -10, -84, 125, 126, 18, -97, -8, 60, -11, -100, -111, -5, -118, -47, -79,
+        65, -112, 70, -119, -71, -53, 36, -26, 46, -109, -104, -113, 26, 36, -26, 71,
+        -76, -40, 1, 34, -71, 52, -54, 43, 8, -15, 57, 72, 48, 9, 1, -48,
+        -48, 109, -5, -8, -97, 105, 57, -76, -98, -2, -16, 23, -43, 9, 26, -41,
+        57, -8, -2, -112, -15, -22, 40, 35, 6, 77, 92, 85, 126, 105, 116, -26,
+        -15, 125, -24, -116, -87, -101, -85, -27, -65, -34, 38, 4, 20, 48, 20, -90,
+        39, -42, -11, -5, -16, 126, 90, 125, 93, -65, -67, -57, 59, 58, 62, -80,
+        -2, -62, -84, -42, 68, -101, -123, -39, -99, 89, 79, 44, -118, 20, 103, -43,
+        -126, 64, -101, 112, -115, 69, -36, -44, -5, -73, -11, -1, 13, -79, -23, 42,
+        -127, -19, -8, 69, 30, 54, 37, -108, 44, 34, -28, 27, -52, -2, 73, 59,
+        -65, -41, -64, 96, -102, -74, 49, -56, -122, 64, -19, -33, 39, 76, -75, -38,
+        -21, 26, -24, -62, 26, -16, -120, -127, 80, -107, -13, -12, 12, -64, 71, -39,
+        -64, 33, 1, -73, -16, -119, 78, 110, 30, -73, 30, 63, -38, -74, -51, -51,
+        -125, -97, -34, -97, -126, -126, -19, -34, -73, 32, 97, -65, -5, 13, 72, 120,
+        -113, -114, 75, 8, 104, -98, -26, -35, 27, 29, 31, -2, 23, -94, -29, -122,
+        -31, -100, 120, 91, 21, 120, 51, 8, 24, -72, -90, 26, 49, -21, -107, -114,
+        65, -62, 39, -8, -97, -123, -22, 23, -92, 86, 10, -125, -110, -110, -48, 77,
+        49, 46, -52, -87, 10, -60, -105, 2, 113, -8, -78, 69, 122, -126, -15, -84,
+        38, 36, 90, 55, -114, 67, 107, -73, -71, 71, 93, 111, -107, -62, 16, -99,
+        47, 24, -30, -86, -66, 65, 116, 83, 82, -67, 53, 102, -21, 90, -120, 80,
+        -57, -61, -126, -50, 124, -22, 76, -79, 37, 121, 97, -117, -12, -8, -91, -46,
+        -94, 57, 45, -61, 58, -91, -49, -85, 18, -110, -65, 100, 75, 22, -42, -43,
+        -121, -118, -21, 60, -83, -75, 62, 27, -115, 108, -31, 108, 61, -58, -39, 122,
+        -116, -77, -11, 26, 56, -37, 67, 98, 109, 127, 72, 43, 108, -39, -103, 110,
+        -104, -89, 113, 52, -74, 74, 43, 46, -117, 63, 121, -28, -118, 87, 104, 113,
+        31, -93, -84, 102, 1, -118, -94, -105, 12, -43, -42, 85, -127, -86, -24, 39,
+        -86, -98, -89, 37, -3, -121, -55, 92, 60, 113, 79, -10, 71, 15, -47, -53,
+        83, 0, 80, 22, 17, -91, -45, 57, -120, 114, 93, 23, 100, 33, -48, 80,
+        46, -71, -52, -57, 82, 47, -27, 113, 86, -98, -115, 80, -34, 99, 42, 40,
+        -17, -123, -101, -116, -60, 106, -13, 55, -49, 113, -49, 32, -10, -56, -89, -62,
+        -27, -15, 51, 47, -1, -40, 60, -29, -36, 48, -53, -43, 8, -12, 67, -19,
+        81, 13, -40, 51, 104, 35, -20, 18, 40, -33, 75, -31, -61, -88, 42, 119,
+        -113, 48, -25, -128, 26, -115, 110, -54, -118, 18, -101, 104, 34, -114, -61, -53,
+        -57, 41, -70, 88, -121, 40, 107, 9, -93, 16, 26, 0, 20, 127, -39, 72,
+        115, -112, -111, 78, -30, 46, -94, 75, -61, 10, 63, -38, 112, -83, 123, 91,
+        9, 121, -96, -64, 4, 49, 118, -98, -48, -21, -118, -93, 4, 46, -102, -11,
+        16, 88, -100, -21, 97, -40, 87, 50, 106, 122, -122, 51, -57, 107, 88, -69,
+        8, -7, -86, 112, -32, 104, -14, -22, 96, -119, -88, 99, -85, 68, -35, -39,
+        66, 3, 9, -115, -63, 114, 21, 42, 30, -109, -41, -124, -72, 84, -32, -106,
+        37, -4, 47, 34, 27, -56, 124, -102, -79, -86, -86, -20, 114, 79, -127, 55,
+        24, 118, -6, 117, -109, 38, -36, -18, 43, 106, -10, -112, 27, -81, -34, 17,
+        -76, -104, 42, -114, -64, -29, -12, -42, 92, 19, 80, -110, 24, 56, -60, -42,
+        -23, 109, -72, -95, 56, -105, -90, -59, -66, 24, 98, -81, 111, -96, 99, 87,
+        -99, -54, -27, -22, 44, 74, 103, 92, 68, -89, -72, -14, 9, -107, -39, -72,
+        -48, -37, 113, 27, 47, 74, 19, -35, 70, 13, 27, 18, 102, 112, -54, -60,
+        121, -35, -72, -13, -56, 21, -89, 106, -80, -91, -96, 18, 78, -108, 85, 4,
+        -100, -102, 76, -40, -93, 93, 114, -87, 69, 9, 2, 35, -76, 3, -13, -119,
+        113, 78, 102, 33, 109, -18, 34, 108, 56, -99, -123, -32, -38, -106, -120, 125,
+        -103, 53, 54, -6, 50, -68, 87, 36, -67, -70, 15, -81, -51, 119, 76, 77,
+        79, 7, 6, -2, 39, 2, -6, 79, -108, -101, -61, 110, -80, -63, -25, -53,
+        43, -13, 72, 0, 119, 0, -18, 9, -115, -24, -20, -95, -66, 121, 19, -106,
+        4, 4, 21, -37, -36, 59, 2, -112, 36, 104, 110, 12, 76, -121, -103, -64,
+        -36, 16, 98, 37, -8, 62, -39, -26, 38, -79, -61, -105, -90, 94, -119, 65,
+        -118, 19, -126, -16, 3, 124, -32, -122, -83, -120, 33, 32, -80, -9, -99, -68,
+        59, 102, 46, 38, -61, 32, -18, 17, -50, -113, -24, -95, 41, 46, -78, 98,
+        75, 124, -58, 102, 33, 66, -122, 80, 94, 32, -24, 32, -15, 99, 15, 87,
+        121, 119, -69, -98, -126, 35, 18, 96, -76, -122, 12, 77, 107, -20, 17, -99,
+        -117, 86, -35, -114, 56, 20, -111, -44, 89, 74, 99, -83, -125, -102, 78, -88,
+        -86, -78, -54, -61, -5, 57, 32, 105, 32, 71, 83, -2, -30, -22, 27, -122,
+        116, -76, 107, 76, -3, 47, -106, -71, 55, -54, 38, 44, 8, -4, 104, -111,
+        -35, 32, 99, -99, -91, 41, 94, -9, 65, 54, 116, 18, -52, -127, 66, 47,
+        -118, 66, -20, -113, 126, 69, -74, 52, -73, -41, -1, 14, -79, -92, -42, 101,
+        -84, 81, 98, -122, 17, 102, 66, -12, 68, -28, 61, 89, 100, 121, 74, -84,
+        42, -62, 13, -101, 3, -34, -78, 15, -109, -113, 49, -6, 44, 119, 101, 36,
+        -8, 39, -73, 66, -126, 84, 56, 13, 103, 98, -77, 88, -122, -125, -64, 125,
+        5, 104, -92, -61, -72, -123, 0, -119, -74, -111, 98, -32, 66, 75, 93, -65,
+        100, 86, -70, -15, -72, 117, 122, 122, 106, -43, 56, 21, -82, -124, 41, 79,
+        103, -100, 12, -69, -73, 107, 114, -61, -30, -64, -14, 90, 22, 57, -27, 109,
+        -36, -33, 27, -101, -79, 104, 86, 45, 107, -93, -4, -39, -60, -32, -54, 60,
+        -112, 113, 44, -58, 66, -26, 120, -40, 109, 93, -57, -31, 18, 125, 33, -93,
+        101, 56, 54, -92, 108, -61, 114, -2, 115, -109, -17, 15, -18, 12, 46, -96,
+        49, 100, 84, 103, 73, -4, 87, -60, -116, -109, -75, 17, 77, -102, 84, 30,
+        -124, -2, 109, 6, 67, 61, 81, 109, 52, 56, -104, 10, -9, -56, -121, -113,
+        -8, 79, -91, 115, 11, -5, 126, 28, -52, -25, -122, 125, 31, -61, 68, -110,
+        -105, 107, -108, -68, 49, 4, -100, 89, -80, 20, -42, -56, 62, 99, 74, 47,
+        23, -20, 92, -123, 11, 106, 91, 28, 80, -5, 95, -18, -128, 90, 75, 77,
+        25, 62, 53, 73, 92, 120, 24, 87, 68, -77, -16, -81, -25, 39, -36, -102,
+        67, -97, 74, -8, -70, 91, -123, -96, 84, 91, 43, -8, 31, 16, 73, -12,
+        32, -9, 44, 64, -52, -42, -9, -8, 61, -58, 21, 23, -104, 58, 77, 65,
+        115, -78, -34, -68, -15, 102, 32, 79, 2, 40, 64, 7, -27, -97, 94, -98,
+        -93, -77, 52, 44, -39, 88, 75, -39, 108, -8, -55, -15, 29, -3, 97, -98,
+        24, 127, 40, 64, -22, 28, 112, -69, 13, 14, -76, -4, 12, 80, 72, 127,
+        -9, 116, -57, -83, -74, 38, -11, -96, 6, 127, -36, -78, -81, 52, -90, 124,
+        -64, 103, -32, 48, -120, -82, 103, -95, 91, 121, -83, -35, -99, -39, -27, -65,
+        -64, 115, -70, 42, -29, -41, -80, -64, -81, -112, 90, -6, 95, -31, 1, 92,
+        -25, -30, 43, -50, -14, -53, -22, 89, 90, -106, 33, -17, -29, -12, 123, -44,
+        -84, -106, 67, -67, 23, -67, 23, 79, 79, 30, 90, 26, -41, -93, 28, -30,
+        76, -42, 119, 47, -97, -68, 58, 122, -35, -27, -91, -15, -116, -11, -69, 23,
+        -81, 94, -10, 94, 61, -74, 20, -97, 34, 38, -91, -13, -77, -50, 67, -115,
+        -95, 117, -74, -40, 22, -72, -43, -99, 105, 126, -36, -74, -96, -99, 12, -41,
+        115, -70, 58, 19, -71, -23, -1, -74, -101, -9, 72, -123, 86, 57, 80, 113,
+        -106, 118, 55, 75, -57, -118, -79, -51, -125, 56, 44, 112, -89, -14, 31, 61,
+        -38, -27, -23, 104, 10, -45, 52, 60, 31, 52, -109, 8, -99, -71, 49, -47,
+        0, -31, -59, 91, 42, -117, 10, -113, 31, -111, -3, 79, -36, -103, -3, -16,
+        -43, -113, -21, -79, -97, -30, -66, 15, 93, -104, -99, 105, 15, 68, -105, 94,
+        -19, -126, 13, 31, 100, 111, -92, 8, -125, 49, -84, 74, 65, -102, 48, 26,
+        121, -61, 21, 92, -89, -42, 117, -109, -107, -8, -84, -105, 88, -43, -107, 56,
+        -42, 75, 48, 47, -76, 114, -111, 51, -67, -56, -106, 65, -101, -81, -95, -79,
+        -16, -127, 93, 35, 102, -96, -102, 85, 41, -90, -101, -102, -33, -14, 101, 116,
+        19, -27, -24, 123, 90, -22, 78, 5, 3, 40, 101, 72, -9, -90, -68, -58,
+        121, 15, -3, -128, -114, -105, -31, -67, 111, 118, -13, 56, -101, -78, 113, -100,
+        4, -117, -9, -82, 94, 60, -30, -73, -69, -54, -32, -20, -44, 93, 35, 7,
+        36, -30, 119, -64, -106, 117, -59, 63, 86, -117, -13, 11, -48, -107, -91, -24,
+        -44, 93, 67, -29, 113, -104, -115, -73, 108, -107, 31, 96, -121, -17, 4, 124,
+        -99, -121, -34, -19, -63, 39, 122, 46, -8, 5, -80, -112, -33, 3, -93, 63,
+        -105, 110, -30, 119, 7, -55, -77, -93, 65, 114, 112, -32, 20, 70, -52, -77,
+        48, -2, -111, -95, 113, 16, 83, -40, -121, -20, 34, -127, -3, -79, -105, -81,
+        -41, -86, 92, 70, 46, 86, 99, 61, 9, -105, 5, 32, 7, 12, 0, -110,
+        -15, 0, 23, 73, 2, 11, -62, 111, 12, 87, 68, -23, -89, 83, -6, -58,
+        -4, -94, 102, -71, 49, -64, 123, 10, -125, -39, 18, 40, 3, 84, 64, -28,
+        81, 109, 16, -125, -58, -96, -16, -23, 47, -127, -111, -93, 99, 56, 126, -59,
+        74, -28, -20, 9, -103, -69, 48, -10, -80, 73, 55, 98, 30, -27, 27, 30,
+        -99, 81, -36, 55, -81, 13, 92, 108, -105, -18, 10, -46, -59, 76, 92, -92,
+        -19, -88, 54, 48, -9, -117, 126, -87, -113, -71, 121, -42, 61, 75, 85, -88,
+        -101, -97, -8, -83, -57, -105, 21, -41, -90, -65, -87, 103, -14, 52, 109, -20,
+        -104, 110, 101, -105, -5, -67, 127, -48, -73, -6, 125, 80, 19, -81, -121, -107,
+        -41, 123, -8, -12, 5, 61, -84, 106, 122, -8, -76, -77, -121, 47, 9, 85,
+        80, -35, -100, 53, 87, 45, -85, 93, 32, -8, -74, 6, 56, -19, 44, 113,
+        -5, 119, 86, -76, -87, 41, -44, 93, -58, 127, -16, -21, -24, 24, 8, 79,
+        -98, 86, 80, 120, 31, 121, 19, 61, -26, 31, -4, -46, -7, -108, 127, -14,
+        -5, -27, 120, 5, 89, 94, 1, -57, -21, -58, 37, -97, 107, -116, -82, 98,
+        -60, -6, 94, -44, 68, 27, -102, -53, 50, 60, 126, -8, -75, 111, -58, -82,
+        -63, -105, 18, -123, -65, -73, 123, -27, -53, -8, 66, -53, 97, -93, -13, -73,
+        -73, 116, 111, -96, -106, -26, -79, -19, -50, 84, -59, -101, -31, 67, -17, -58,
+        93, -87, 2, -92, -124, -71, -73, -86, -60, 10, 74, -84, -36, -49, -86, 4,
+        115, -27, 118, -113, 85, -111, -49, -61, -66, -9, -39, 61, 83, 69, -50, -45,
+        -71, 123, -94, -14, -49, 32, -1, -52, 125, 39, -18, -20, 126, -16, 13, -34,
+        109, -124, 35, -120, 64, -109, 13, -104, -65, 124, -82, -97, 101, 101, 72, -30,
+        74, -17, 62, 39, -112, 86, -111, 60, -89, -112, -104, -123, -109, 69, -116, 87,
+        88, 53, 9, 40, 94, -81, -33, -103, 116, -49, 8, 32, 32, -50, -89, -46,
+        -102, 98, 2, 27, -92, -8, 58, -38, 56, -18, 91, -1, -35, -18, -64, -107,
+        87, -50, -32, -19, -2, -2, 91, -29, 34, -5, 7, 45, 126, -61, -71, -1,
+        65, -68, 42, -115, -31, -107, 25, -102, -98, -42, -128, -121, -94, 35, -99, 119,
+        -106, -19, -103, 123, -34, 89, -75, 79, -32, 95, 22, -122, 126, 118, 112, 11,
+        -65, 121, 24, -6, -29, -125, 19, 119, -18, 34, 55, 48, 78, -51, 123, -18,
+        -60, -67, 118, 23, 48, 22, 51, -10, -7, 41, 99, 80, 31, 68, -76, 25,
+        109, 35, 17, 1, -68, 95, -88, 96, 118, -93, 61, -89, -67, -107, -87, 53,
+        -49, -121, 93, 88, -63, -108, 54, 91, -94, -110, 83, 72, 78, 105, 43, -15,
+        87, -80, 85, 86, 60, -20, 119, -67, -104, 54, 18, -101, 15, 108, 35, -103,
+        57, -62, -52, 17, 109, 34, -119, -1, 11, -107, 61, -39, -126, -1, 19, -40,
+        86, 81, -51, -21, -34, -60, 3, 48, 114, -9, -100, -94, 90, -40, 83, 119,
+        -20, 116, -24, -83, 110, -118, -100, -120, -13, -68, -66, -49, -101, 14, 11, 121,
+        127, -4, 122, 127, -1, -38, 88, -21, 57, -113, -26, 48, -33, 66, -53, 95,
+        45, -15, 12, -83, -7, -15, 43, 35, 106, -17, 120, 92, -83, 104, -33, -63,
+        66, 7, 51, 16, -22, 93, 100, -79, -25, -23, 105, 56, 67, -113, -37, 16,
+        -51, 33, -76, -109, 34, -31, -76, 74, 65, -41, 69, -14, 105, 88, 76, -45,
+        -79, 23, -43, -16, -121, -115, 30, 56, -70, 74, -36, -1, 19, -121, -68, 106,
+        28, -14, -89, -19, 67, 46, 49, -117, 123, 14, 89, 5, 108, 51, -43, -125,
+        26, -123, 33, 106, -106, -44, 69, 52, -64, 111, -101, 58, -117, 112, 95, 55,
+        -11, -46, -36, -54, 83, -65, -49, -84, 101, -96, -88, 14, 27, 14, -67, 52,
+        -84, 15, -120, -74, 54, -17, -101, 113, 75, 24, 20, 113, 75, 99, 64, 46,
+        -58, 119, -61, -25, 94, 110, 97, 83, 39, 127, -48, 11, 17, 24, 44, 109,
+        -22, -57, 29, -118, -23, -117, -49, 58, 72, -105, 37, 80, 56, 73, 99, 122,
+        7, -76, -31, -3, -43, 63, -95, -51, 14, 16, -28, 104, -110, -40, 119, 27,
+        -15, 40, 1, 17, -97, 81, 89, 12, 18, -88, -60, 115, 75, 34, -116, 55,
+        42, -33, 9, -62, -16, -95, 75, -2, 38, -109, 61, 6, -62, 55, -56, 111,
+        -93, 98, -124, -113, -118, -33, -115, 96, 102, -68, 51, 79, -84, 116, 89, -62,
+        -102, -72, -79, 59, 117, 6, 87, 89, 24, 124, 30, 80, -123, -107, 89, -31,
+        -45, -50, 10, 12, 1, 100, -123, -78, -8, -61, 42, 80, 120, -72, -59, 31,
+        6, -6, 111, 120, -100, 99, -54, 31, -25, 64, 41, -58, 16, -23, 107, -98,
+        -29, 88, -72, 19, 73, 53, -25, 24, 115, -48, 96, 76, -116, 108, 2, -57,
+        114, 35, 124, -38, 66, 6, -117, 39, -60, -124, 63, -120, 120, -7, 121, -6,
+        106, 25, -114, -72, 86, 33, -10, 78, -118, 55, 80, 38, 24, 116, 7, -1,
+        -15, -106, 29, -32, -125, 0, -112, -73, -96, 66, -72, -84, -98, -105, 9, 55,
+        41, 99, -89, -48, 5, 24, -36, -106, -24, -92, 20, -56, -35, 52, -118, -61,
+        32, -37, -90, -38, 106, 27, 9, -125, -111, -20, 14, 102, 125, 28, -57, 117,
+        111, 54, 104, 75, -32, 110, 125, -89, -86, -108, 93, 13, 103, -30, 104, 81,
+        -33, 106, 33, 86, -13, 42, -72, -108, -99, -9, 100, -72, 64, -48, 24, 77,
+        0, -87, -84, -11, 122, 71, 15, -7, -100, 30, -73, -117, -36, 30, -117, -127,
+        2, 27, 41, 6, -27, 17, -42, -98, -34, -9, -115, 28, -105, 61, -8, 59,
+        -49, -46, 34, 69, -70, 34, -34, -92, -21, -128, 10, 28, 67, 61, -29, 105,
+        58, -76, 10, 12, 48, -76, 99, -106, 23, -60, 86, 7, -96, 63, 103, 33,
+        114, 106, -58, 101, -11, 60, 67, 113, 98, -123, -74, -85, 28, 74, 53, 64,
+        105, 38, -70, -25, -6, -55, -19, 19, 58, -50, 32, -64, 0, -29, 95, 6,
+        115, -118, 30, 19, -115, -15, 25, 37, -3, -71, -26, 109, -48, 12, 56, 52,
+        -73, -126, 46, 48, 65, 87, -16, -89, 113, -72, 14, 110, 66, -115, 94, 116,
+        87, -90, -72, -73, -33, 104, -118, 99, 65, 108, -114, 122, -2, 69, -49, 61,
+        114, 31, -71, 63, -72, 79, -36, 94, -41, -19, -11, 47, -115, -4, -82, 127,
+        -47, 119, 31, -70, -113, -35, -89, 110, -81, -57, -77, 48, 100, -52, 73, 82,
+        -68, -65, -2, 4, -69, -51, -65, -24, -70, 71, 61, -9, -47, 83, -9, 41,
+        -42, -122, -1, 127, -44, 115, 123, 79, 122, 110, -65, -41, 119, -5, 15, -113,
+        -36, -2, 15, 71, -18, 81, -9, -95, 123, 116, -12, -16, -78, -18, 54, 105,
+        -2, 11, 62, -75, -120, 55, -124, -22, 118, 43, -85, -80, 23, -27, 63, 5,
+        63, 49, -98, 78, -47, -52, -8, -43, 34, -29, 49, -103, -13, 104, 22, -98,
+        21, -63, 108, -34, -36, 14, 93, 73, 98, 45, 64, -30, -48, 84, -5, 89,
+        8, 93, 30, -13, 94, 59, 83, 25, -54, -69, 76, -26, -91, -90, -73, 103,
+        -17, -59, -99, -90, 78, -66, -72, 2, -27, -48, -18, -70, -3, 71, 14, 61,
+        -103, -126, -125, -79, 29, 79, -81, -95, 82, 11, 125, -40, -37, 103, -34, -6,
+        -74, 49, 66, -106, 24, -93, 49, 24, 57, 0, 9, -51, 102, 82, 105, -64,
+        -116, 94, 102, 99, -85, 17, -54, 71, -43, -60, -69, 14, 114, 5, -80, 32,
+        -37, -89, 122, 101, -64, -25, 57, -98, -110, -40, -121, -19, -61, -119, 107, 29,
+        2, 47, -110, 41, 23, 65, -5, -9, -53, -125, -61, 73, 68, -15, -40, 36,
+        -77, -119, -4, 106, -37, 81, -51, -24, -1, 22, 21, 83, 44, -15, -69, -26,
+        59, -79, 99, -7, -65, 96, 52, -78, 63, 102, -54, -81, 7, 87, 89, -39,
+        82, -81, 40, -48, -75, 94, -11, 0, -20, -114, -91, 4, -23, -19, -62, -6,
+        -83, 107, 93, 10, -102, -75, 0, 106, -59, 118, 35, -67, 120, 10, -103, -53,
+        110, -49, -52, -42, 66, 67, 57, -8, 58, 0, -107, -23, -101, 101, 112, -41,
+        -30, 83, -32, 44, -13, -88, -90, -127, -105, 84, 98, 32, -119, 73, 108, 76,
+        -22, -64, -78, -24, 77, -22, -48, 15, -41, -21, -2, 32, -30, 50, -34, -77,
+        112, -32, 68, -66, -43, -75, 14, 34, -71, 104, 27, 22, -3, 46, 24, -46,
+        -117, 120, 48, -89, -41, -117, 56, 70, 98, -127, -72, -113, 73, -22, 123, 16,
+        -6, 54, -3, 95, -88, -96, 111, -1, 125, 125, -15, -9, -33, 126, -69, 116,
+        -16, -64, -14, 0, 23, -25, 95, 122, -42, -63, -44, 113, 106, -117, -56, 124,
+        64, -9, -14, 126, 4, 10, -28, -44, 87, 83, -83, 14, 88, 68, 58, 91,
+        -115, -106, 0, 41, -122, -54, 63, -100, -125, -98, 28, 106, -61, 104, 79, -31,
+        127, 114, -76, 104, -23, -81, -19, 25, 10, -119, 50, 89, 115, 25, 81, 36,
+        -74, 71, -11, 19, -112, 37, 70, 108, 2, 99, 13, -38, -76, -57, -7, -16,
+        -39, -17, 93, 67, 31, -61, -1, -28, -48, -45, -90, 97, 65, 33, 81, 38,
+        105, 46, -93, -122, 62, -82, 31, -70, 44, 49, 102, 67, -97, 104, 67, 127,
+        -109, 46, -78, 92, -116, -99, 127, -128, -128, 58, 121, -34, -21, 15, 39, 24,
+        -2, -98, 89, 15, -32, -57, 100, -41, -100, -34, -68, 57, 80, 67, -103, -44,
+        15, -27, -115, 40, 49, -87, -51, -98, 78, -75, 38, -26, -11, 77, 76, 69,
+        -119, -71, -80, 65, 104, -120, 68, 7, -24, 114, 62, -14, 115, -48, 56, -24,
+        -39, 76, -21, -15, -70, -66, -57, -103, 40, 113, -51, 122, 92, 106, 61, -98,
+        -47, 1, -67, -20, 81, 126, 54, -9, -104, -25, 90, -113, -53, -6, 30, 115,
+        81, 98, -55, 122, -68, 50, -26, 24, -125, -80, 104, 118, 107, -90, 13, -22,
+        59, -66, -66, -66, -42, 122, -66, 114, -113, -128, 56, 93, -79, -9, -100, -39,
+        41, -62, -43, 97, -81, -21, -72, 77, -107, -75, -86, -75, 21, 105, -96, 55,
+        -2, -28, 25, 96, -114, 117, 124, 106, 121, -42, -121, 83, 107, 43, -75, -111,
+        77, 94, -43, 2, -31, -4, 92, 14, -9, -90, -66, -128, -52, 38, 83, -28,
+        113, 97, 119, -7, 99, 79, 51, -1, 6, -120, -45, 59, -68, -17, 120, 2,
+        50, -22, -74, -27, 40, 10, -39, -53, -84, -74, -105, 66, 102, -105, 123, 89,
+        -7, -19, 66, 112, 74, -28, -125, -52, 37, -110, -98, 32, 14, -42, -21, -67,
+        -43, -48, -6, -43, -14, 86, -49, -69, 67, -21, 0, -96, -47, -74, -120, -107,
+        7, -116, -66, 127, -10, -19, -107, 47, -97, -51, 94, 57, -50, 95, 30, 119,
+        7, -73, 7, 126, 108, 83, -30, 117, -100, 2, -27, 95, 29, 62, -58, 120,
+        -47, 80, 25, -96, -2, -39, -39, -44, -49, -32, -1, -118, 1, -34, -78, 97,
+        29, -21, -92, 21, 88, -116, -94, 76, 43, 70, 86, 69, 52, 71, -75, -99,
+        13, -40, -96, -44, -14, 115, 56, 121, -75, -100, -37, 72, -103, 92, 107, 98,
+        1, -117, -69, 56, -42, -23, -113, 86, 38, -111, 101, -110, -58, 50, -71, 44,
+        -109, 95, -116, 26, -54, 100, -78, 76, 102, -106, 57, -4, -19, 55, -69, -29,
+        -16, 73, 86, 4, -48, -65, 38, 81, -111, 95, 103, -23, 12, 63, -14, 122,
+        105, 84, 123, -51, 64, -100, -79, -86, 119, -103, 77, -15, 96, 22, 37, -12,
+        -128, 83, 53, 89, 123, 54, -85, -100, 25, 44, -23, -119, -22, 106, 50, 91,
+        -112, 92, -54, 84, 92, 24, 20, -81, 13, -119, -108, -48, 17, -15, -112, -107,
+        -68, -125, 38, 5, 100, -57, -83, -45, -45, -42, 120, -36, 122, -13, -90, 53,
+        -101, -75, -14, -68, -123, 110, -60, 14, -23, 60, -123, -115, -78, -110, -101, 84,
+        106, 102, -9, -85, -55, -15, 0, 67, 57, 104, -12, 67, -59, 44, 79, 47,
+        30, 95, 98, -64, 114, -12, -89, -87, 45, -112, -56, 2, 81, 114, 86, -87,
+        -4, 72, 86, 62, -85, -44, 123, 36, -21, 49, 18, -83, -41, 123, -88, 117,
+        106, -26, 37, 50, 47, 74, -112, 85, -23, -75, -114, 100, 45, 51, 39, -111,
+        57, 17, -70, 21, 26, 61, -11, 101, 29, 51, 39, -111, 57, 48, 62, 114,
+        -34, -46, 42, -11, 40, -85, 77, -47, 25, 75, -103, -119, -106, 25, 37, 40,
+        110, -23, 21, -69, -78, 55, 51, 39, -31, 57, -22, 124, 33, -54, -33, -123,
+        -63, 28, 75, 109, 83, 83, -2, -14, -48, -9, -69, -5, -5, -59, 95, 122,
+        93, -64, -55, -18, 122, 13, 41, 93, -32, -42, 93, 101, -100, 9, -30, -47,
+        34, 70, -65, -71, 119, 116, -107, 100, -107, -65, -65, -90, 33, -33, -57, 46,
+        61, 14, -117, 48, -125, 105, -124, 90, -67, -100, -28, -45, -74, 50, -90, -106,
+        10, 53, 13, -103, -87, 53, 71, -113, 31, 25, 79, -20, -87, 105, 66, 25,
+        -38, 64, 71, -113, 31, -45, 83, -18, -27, -42, 127, 14, 103, 65, -124, -63,
+        62, -73, 117, 83, -39, -28, -122, -42, 124, 17, 94, 42, 121, 57, -60, -125,
+        -5, -14, 24, 96, 8, -63, -63, -127, 102, -37, -86, -123, -64, 54, 53, -28,
+        -88, 43, 108, -96, -123, -65, 100, 26, -60, 105, -118, -122, 4, 119, -81, -53,
+        -116, -94, 45, 67, -45, -41, -34, 121, 123, -34, -18, 121, 125, -10, 22, -98,
+        -51, -11, 25, 109, 104, -95, 51, -20, 63, -11, -6, 79, 116, -21, -89, -47,
+        84, -81, -44, 20, -113, 111, -28, -63, -104, 122, 27, -87, 36, 72, 83, -58,
+        -7, 55, -102, 50, -72, -5, -43, -1, 13, 87, -52, -27, -47, 23, -18, -116,
+        53, -26, -122, 37, 121, 124, -78, 114, -11, -117, -26, 114, -106, -88, -65, 51,
+        107, 9, -3, -116, -20, -47, 117, 111, 39, -86, -125, -76, 90, -3, 78, -6,
+        -128, -43, -107, -28, -29, -17, 44, 85, 49, 17, -89, 31, 25, -46, 91, -27,
+        39, 37, 48, 38, 51, -24, -85, 78, -72, 27, 27, -107, 15, 18, -112, -61,
+        2, -122, 59, 86, -120, 69, -85, -13, 35, -122, -128, 14, 98, -23, 53, -70,
+        101, -77, 51, -101, 86, -108, 51, -5, 32, 26, 82, -54, 22, 51, -19, 18,
+        -84, -93, -37, 59, 120, 95, -97, -74, -12, 82, -61, 29, 121, 91, -38, 75,
+        6, -76, 67, 11, -97, 113, 63, -7, -24, 40, -59, -88, 121, -55, 92, 41,
+        97, 76, 69, -6, 26, 61, -104, 109, -19, 125, -55, -110, -97, -27, -80, -110,
+        -30, 53, 52, -25, 104, 25, 72, 51, -15, 1, -37, -24, -78, 29, 84, 94,
+        -75, -115, 46, -97, 61, -46, -6, -18, -95, -76, 35, 62, -70, 24, -124, 91,
+        -62, 2, -124, 51, 13, 25, -47, -51, -3, 126, 65, -76, 85, -8, 107, -7,
+        -78, 42, -7, -76, -78, 5, -105, -83, -87, 77, -91, 93, -22, -19, 52, 44,
+        54, -108, -39, -72, -86, -63, -94, -112, -101, -23, -101, 91, -6, -75, -90, 29,
+        29, 63, -76, -62, -20, -66, -36, 55, -12, -85, -83, -12, -42, 93, -88, 61,
+        -101, -78, 52, -41, 96, 87, 77, -81, -71, -90, 62, 59, -13, -35, -115, -126,
+        -67, -66, -72, 119, -65, 7, 61, -83, -124, -3, 66, 90, 19, 86, 105, 77,
+        -71, -15, 82, -111, 18, 62, 43, 27, -99, -60, -62, 29, 21, -72, -31, 46,
+        52, 30, -3, 109, -121, -58, -37, -63, -46, -46, -13, 28, 88, 126, -12, 12,
+        88, 126, 51, -54, -29, 19, 0, 97, -29, -47, -85, -111, -119, 27, -53, -20,
+        9, -73, -44, -77, -121, -43, 57, -12, -44, -13, -72, 122, 87, 10, -87, 44,
+        -79, 26, -6, 35, -82, -51, -12, 118, -40, -120, -5, -37, 106, 121, 91, 106,
+        53, 96, -55, -42, -127, -15, 69, -26, 29, 105, 60, -61, -34, -75, -41, 119,
+        53, -31, -72, -74, 73, -76, 43, -45, 90, 57, -58, 67, -39, -27, 92, -83,
+        41, 99, 56, 69, 1, 84, -78, -90, -68, -29, 54, 55, -10, 123, -61, -44,
+        12, 90, -79, -83, 86, 93, -29, -116, 118, 52, -76, 92, 38, 44, -115, -75,
+        -76, -25, -19, -39, 59, 67, -4, -72, 70, -29, 109, 76, 64, 16, -3, 71,
+        -37, 104, -53, -86, 68, -33, 47, -126, -53, -102, 10, -34, -10, 10, -78, -29,
+        92, 18, 65, 13, 27, 86, -52, 25, 119, 104, -82, 110, -18, 12, 43, 78,
+        -117, 85, 18, -6, 73, 35, -98, 76, 36, 64, 94, 93, -109, -101, 83, -82,
+        -105, 111, 54, -12, 44, 26, -17, 92, 50, 50, 30, -74, -23, 75, -104, 25,
+        23, -85, 120, 77, -10, -20, 89, -59, -53, 21, 15, -60, 36, 100, -48, 1,
+        -128, -62, -99, 48, 23, -22, 28, 70, -24, -105, -29, 90, 96, 12, 124, -8,
+        77, -25, 111, -116, -114, -123, 13, 101, -74, -121, -66, -32, -90, -19, -25, 33,
+        -1, 49, 44, 60, 22, 12, 99, -48, 52, -96, 4, -70, 60, 13, 72, 56,
+        -35, 86, 34, 74, -4, 80, 115, -89, 63, -11, 43, 106, 9, 57, 118, -32,
+        5, -107, 89, -120, -73, 7, -103, 91, 71, -79, 36, -105, 14, 45, -80, 57,
+        121, 118, 72, -49, 95, -106, 68, -50, 91, 61, 114, -126, 92, -11, -103, -49,
+        22, -71, 101, -104, -13, -89, 71, -40, -49, -48, 53, -17, 34, -65, -68, -56,
+        46, -35, 81, 125, -111, 87, -55, -104, 23, 24, 107, 5, 24, -18, 98, -22,
+        4, 29, 62, -40, -118, -79, 90, 80, -70, -125, 1, 94, -122, 13, -23, 120,
+        -21, 110, -95, 53, 101, 82, 76, 119, -82, -38, 83, 68, -121, 110, -69, -88,
+        -99, -30, 94, -5, 119, -73, 94, 108, 68, 120, -49, 93, 19, 12, 94, -58,
+        34, -33, 120, 83, 12, 122, -29, -115, 54, 3, -69, -122, -28, -50, -127, 60,
+        76, -4, -71, 61, 113, -81, -15, 76, -124, -59, -28, 0, -107, -81, 102, -20,
+        -40, 60, 76, -40, 17, -110, -5, 30, 29, 2, -45, -37, -30, -10, 120, 75,
+        -123, -50, -46, 1, 65, 118, -67, 54, 116, -121, -72, 78, 119, -128, 102, 80,
+        -50, 63, -73, 3, -57, 96, 23, 118, 35, -80, -58, -16, -33, 93, -92, -33,
+        -1, 82, -105, -67, -104, -54, 0, 77, 41, 21, -63, 5, -96, -63, -42, 29,
+        -44, 0, 98, 65, -35, 47, -20, 49, 1, -126, -119, 20, -128, 127, -81, 49,
+        -56, 111, 104, -89, 48, -21, 114, 90, -126, 12, 96, -22, -89, -24, -38, 35,
+        12, -48, -80, -76, 87, -8, -49, -115, -74, -66, -20, -2, 23, 0, 4, 119,
+        -70, -14, 26, -36, -90, -12, -108, 53, -83, -72, 78, -6, 97, 6, 85, 49,
+        -53, -63, -46, -97, -23, -54, -48, 76, 42, 67, 83, -57, 109, -20, 12, 13,
+        -58, 13, -43, 70, -37, -86, -47, -109, -102, 48, -33, 41, -44, 31, 13, -8,
+        -57, -74, 41, -31, 40, -82, -74, -105, 24, 73, -53, -105, -127, -73, 12, -117,
+        -127, -71, 122, 75, 76, -64, 31, 87, -18, -118, -7, -62, -116, -59, 61, 100,
+        -3, -19, -113, 9, -34, 7, -11, -21, 60, 93, -40, -101, 89, -111, -92, 32,
+        88, -100, -7, 85, 83, 115, -116, -74, 96, 111, 68, 85, -96, 51, 34, 37,
+        58, -75, 73, -86, -44, 38, 102, -124, 73, 78, -119, -1, -27, -17, -54, -29,
+        25, -97, -28, 4, -128, 70, -125, 28, -128, -80, 122, 119, -91, -15, 20, 52,
+        59, -106, -46, 50, -122, 79, -45, 114, 122, -95, -99, -90, -14, 125, -106, 94,
+        -46, -83, -117, -111, -1, -3, -77, 124, 30, 36, 45, -70, -14, -32, -77, -16,
+        -92, 45, -102, 76, -101, -123, 42, 125, -2, 91, -46, 106, 125, -81, 28, -93,
+        -66, -57, -17, 103, -121, 88, -23, 121, -53, -88, -101, -121, -24, 83, 84, -92,
+        -103, -11, -68, 93, 91, -128, 53, 14, -16, 49, -102, -106, 14, 85, 32, -37,
+        105, 109, 75, -125, -26, -9, -49, -58, -47, -115, 104, 66, 115, 5, -30, 0,
+        107, -45, -99, -64, -85, 0, 122, -59, -126, -107, 49, -31, 108, -37, 72, 63,
+        -83, 22, -35, 27, -13, 45, -74, -10, -83, -17, 15, -62, -125, -17, -83, -25,
+        -33, 31, -40, 17, 16, 25, -53, 57, -8, -98, -9, -4, -20, 16, -37, -87,
+        105, 76, 94, -61, -123, 74, 1, 94, 35, 22, -77, -76, 14, 12, 16, -113,
+        -46, -39, 85, -54, -27, 10, -117, -122, -121, -111, -97, 24, -109, -66, 45, -47,
+        -69, -12, -110, -74, 37, 122, 113, -13, 48, -95, 91, -53, 13, 71, -98, -11,
+        -116, -63, 71, -13, 67, -109, 32, -13, 70, -50, -127, -43, -30, 19, -96, 127,
+        -83, -115, -5, -15, -34, -26, -95, 116, 94, -28, -64, 96, -85, 86, 31, -68,
+        -11, 75, 55, -111, 106, -124, 18, 89, 83, -35, -48, -62, -21, -115, 62, 93,
+        31, -81, 100, 49, -114, 68, -31, -30, 49, 64, 124, -75, -128, -70, -83, -70,
+        -83, 25, 121, 9, 117, 91, 33, 113, 65, -44, -33, 83, 70, 84, 22, -14,
+        -74, 41, -8, 122, 93, -28, 115, 30, -18, 60, -57, 112, -90, 86, 41, 54,
+        -96, 30, 19, -39, -116, -49, -4, 72, -58, 50, 40, -78, -128, -18, 6, 106,
+        -79, 70, 120, 124, 17, 45, 20, 7, 15, -65, -15, 88, -35, -4, -42, -81,
+        -117, 106, 113, 113, -91, -15, 67, 4, 102, -82, 51, 51, 49, 127, 68, -79,
+        102, -74, -93, 12, 64, -36, -63, -77, 112, -17, -12, 56, 66, -67, 82, -68,
+        127, 17, -97, 71, -34, -39, -28, 65, 122, 48, 56, -113, 17, -110, -89, 39,
+        -121, 91, 10, 85, 87, -5, -32, 77, -19, 91, 64, 117, -17, -5, 108, 100,
+        12, -6, 82, 32, 104, 40, 93, 10, 80, -36, 107, 94, -111, -115, 50, -47,
+        93, -43, 88, -104, -53, -117, -82, 69, -92, -34, -70, -2, 70, 96, 98, 26,
+        91, 125, 108, 92, 30, 43, 101, 83, 14, 39, 105, -34, -18, 102, -127, 100,
+        46, 27, 66, -119, -11, 54, 101, -68, -22, -86, -96, 24, 44, 32, -79, -72,
+        -12, -85, 69, -74, 80, -85, -92, 48, -114, 69, -102, 97, 17, -85, 44, 21,
+        88, -122, 48, -15, -119, 126, 5, 87, -124, -110, 48, 66, 71, 116, 85, 64,
+        -126, -70, 101, 45, -35, -33, -66, 10, -117, -37, 16, -61, -95, 84, 113, 24,
+        87, -126, -65, -27, 91, -66, -13, -84, -33, 93, 22, -105, -108, -83, -90, 59,
+        -59, 21, -80, 108, -12, -51, 113, 77, -15, -112, 27, 87, -68, 85, -34, 31,
+        110, 104, -121, -24, 81, 77, -23, 87, 120, 120, -32, -72, -16, -71, -115, 28,
+        -32, 42, 32, 82, 109, 123, -6, 64, 95, -58, 58, -68, -47, 35, 87, 127,
+        97, -28, 105, -81, -21, -18, -60, -70, 123, -19, -16, -51, -97, -75, -125, -75,
+        -35, -89, -59, 70, -34, 126, -115, 80, -54, 113, 53, -111, -18, 105, -81, -32,
+        -5, 80, -105, 101, -116, -17, 53, -45, -28, 10, 86, -117, 64, -17, -98, -82,
+        -41, 11, -125, -99, 46, -79, 5, 104, -20, 54, 37, -74, 28, 79, 76, -108,
+        -39, 12, 95, -87, 126, -111, 46, -71, 41, -119, -23, -8, -18, -123, -11, 126,
+        -114, -104, 111, -67, 1, -16, -62, 31, -8, -65, 119, -23, 45, -4, 123, 18,
+        -89, 121, 104, 93, -70, 6, 48, 28, -38, -34, 44, -106, -111, 8, 62, 84,
+        19, -53, 104, 115, 111, -82, -64, 99, 70, -33, 11, -54, 53, -56, -67, -27,
+        85, 14, 66, -31, -26, -123, -31, -113, 16, 92, -2, -73, 90, -118, 83, 80,
+        -72, 102, -117, 25, 64, -1, -33, 123, -8, -110, 98, 56, -114, -24, -47, -57,
+        127, 63, -94, 119, 30, -105, -108, 9, 75, 34, -96, -26, 108, -54, 60, -38,
+        12, -57, 87, 9, -113, -39, -21, -11, -84, -5, 46, -115, 20, -17, -66, 68,
+        -8, -88, -48, -108, -19, 28, -127, -109, -9, 58, 90, -13, -91, -60, -93, 126,
+        25, 107, 67, 115, -94, -27, 39, 68, 93, 102, -16, 37, -85, -25, 102, 126,
+        5, 61, -13, 102, 91, 75, 116, 121, 17, 92, -118, 21, -49, -101, 12, 46,
+        84, -86, 93, 108, -86, 5, -85, 50, 57, 23, -75, -13, -110, -96, 29, -103,
+        2, -71, -112, -36, 27, -118, 13, -55, 37, -45, -125, 127, 27, 57, -72, -37,
+        -64, -15, -53, -72, -122, -79, -127, 107, -72, -80, 25, -48, -87, -70, 105, -12,
+        40, -75, 82, 105, -48, -42, 31, -81, -70, -41, -91, 35, -97, -37, -106, -41,
+        81, -36, 105, 88, 86, -118, 35, -1, -44, 22, 44, -109, 113, 74, 101, 113,
+        67, 97, -63, 113, -24, 110, 1, -45, -101, -15, -22, -104, -90, 55, 103, -16,
+        -55, -11, -26, 20, 115, -72, -106, 14, 42, 114, -44, 97, 122, -70, 88, -68,
+        -33, 75, 125, 48, -67, 45, -48, 117, -10, 92, 104, -12, -62, 104, -107, -110,
+        -14, -97, -32, -83, 8, 24, -84, 87, 55, -16, -30, 11, 7, 39, 70, -10,
+        -57, 13, 75, 11, -17, -44, 32, 56, -43, -78, 94, 35, -128, -52, 22, -23,
+        71, -68, 24, -47, -24, -70, -31, 74, -49, 9, 101, -72, 43, -54, -21, 95,
+        -79, -41, -55, 119, 52, -42, 107, -69, 82, 90, -27, -6, 125, 101, 15, -116,
+        -74, 55, 27, -31, 93, 16, -19, -63, -114, -38, -122, -75, 124, 108, 90, 29,
+        -1, -30, -101, 32, -51, -60, -44, 4, -48, -61, -70, -56, 56, 42, 18, 78,
+        41, 108, 91, -49, -27, 1, -31, 120, 80, 23, 86, 75, -67, -23, 102, 4,
+        -63, 121, -4, -56, -120, -126, 99, -60, -53, -95, -104, 57, -101, 82, -72, 92,
+        41, -37, -2, -25, 13, -32, -98, -102, -89, -60, -70, 82, 16, -71, 50, 23,
+        59, -66, 23, -28, -53, -6, -81, 43, 112, -75, 110, 45, -92, -10, -14, -72,
+        50, 88, 37, 34, -43, 6, 114, -28, 18, -110, -69, 67, 126, -110, 115, 51,
+        2, -30, 53, -59, -51, -37, 70, 102, -1, -69, -46, 20, 77, 10, -60, -41,
+        -103, -74, -72, -97, -24, 102, -128, -78, -98, 109, -66, 22, -108, 107, -17, 60,
+        127, -71, 2, 94, -106, 23, 27, 84, -118, 45, -102, -91, -82, 69, 112, -3,
+        -68, -121, -63, -88, 107, 76, 30, 29, 53, 8, 95, -1, 88, -81, 17, -84,
+        90, -126, 50, 29, -5, -11, -55, -30, 28, 87, 30, -128, -43, 21, 82, -62,
+        103, -45, 57, 39, -113, 114, -62, -84, 81, 32, 46, -52, -94, -60, -17, -70,
+        122, 66, -80, -12, 97, 54, -56, 45, -55, 64, -63, 14, -15, -76, 24, 53,
+        118, -61, -80, 65, 56, -87, -82, 42, 122, 61, -32, 59, -25, -14, 100, -94,
+        0, -18, 62, -44, 79, -9, -15, 1, 4, -81, -40, 24, 46, 52, 12, -90,
+        -8, 8, -47, -10, -29, 70, 82, -118, -91, -29, -116, -127, -85, -70, -84, 41,
+        114, 116, 42, -50, 74, 33, 114, -43, -27, 18, 79, 96, 37, -102, -12, -33,
+        112, -9, -77, 75, -128, 38, -114, -82, 112, 50, -57, 16, -35, 45, 100, -101,
+        -21, -27, 54, 119, 18, 31, 67, 27, 110, 107, -8, 99, 80, 103, 22, 21,
+        -63, 93, -76, -109, 23, 95, -6, -91, -72, -123, -31, 28, -29, -101, -97, 28,
+        97, -21, -35, 103, -4, -90, -116, 58, -108, 48, 29, -66, -122, -102, 39, 122,
+        -127, 62, 101, 3, -18, 35, -42, -48, -94, -85, 6, -90, -94, 78, -94, -60,
+        88, 78, -109, -121, -68, -107, 28, -113, -33, -96, -51, -91, -65, 11, 114, 124,
+        86, 28, -48, 27, 9, 101, -109, -33, 91, -43, 69, -50, -29, -105, -109, -40,
+        69, 78, 23, -122, -110, -85, -90, 26, -31, -75, 19, 42, -127, -99, 95, 24,
+        -112, 105, -9, 46, 29, 47, -96, 110, -36, -22, -108, -4, -117, 75, 87, -52,
+        -118, -3, -26, 43, 44, -125, 26, -6, -43, 36, 118, -120, -55, -93, 76, 89,
+        26, 62, -15, 32, 85, -115, -68, -12, 30, -122, -61, -5, -101, -18, -86, 10,
+        106, -73, 62, -110, 127, 37, 48, 46, 23, 67, -28, 3, 73, 53, -113, 52,
+        61, -38, 18, 26, -16, -119, 97, -72, 30, -43, -5, 45, -42, -50, 121, -85,
+        1, -95, 60, 77, 83, 110, 120, 92, 82, -35, -85, 34, 79, 95, 31, -106,
+        -16, -92, -72, -65, -107, 120, -121, 25, -86, 113, -71, -116, -128, -114, -70, 5,
+        -72, 65, -4, -22, -106, 34, -48, -22, -95, 114, 123, -102, 69, -66, -14, 42,
+        91, -67, -23, -105, -21, -102, 50, -66, 98, 95, 90, 10, -91, -123, 48, -29,
+        111, 120, -21, -16, -31, -49, 117, -19, -124, -49, 14, -23, -96, 28, -70, -79,
+        -9, -80, -31, -123, -115, 26, -128, -103, 65, 51, -5, -107, -110, -43, -77, 9,
+        -74, 64, 26, 58, -21, -79, 44, 55, 91, 32, 110, 0, -72, 4, -99, 38,
+        -5, 105, 53, -66, 103, -125, -64, -93, 65, 117, 30, -19, 62, -116, -86, 28,
+        -127, -108, -52, 59, -12, -100, 17, 127, 84, -88, 108, -61, 45, 91, 114, 118,
+        -68, 114, -93, -68, 3, -23, -79, 36, -9, 11, -49, 42, -22, 109, -11, -35,
+        109, 56, 95, -38, 66, -115, -92, -89, 113, -27, 120, -124, 106, 22, -70, -69,
+        18, -63, -70, 91, -73, 61, -40, -101, -21, -70, -62, -116, -64, -5, -102, 117,
+        -8, -33, 1, -38, 18, 41, 63, -110, 42, -28, -109, -102, -96, -81, 70, 16,
+        -13, 63, 122, 33, -28, 43, 73, 59, -114, 110, -54, 71, -54, -118, -11, 110,
+        -53, 29, 110, -51, 5, -122, -15, -25, -84, 116, -99, 66, 84, 34, 101, -107,
+        51, -68, 31, -2, 96, -64, -46, -85, 80, 95, 4, 84, 46, 72, 113, 46,
+        -31, -17, 44, 49, -36, 89, 2, 1, -36, 96, 85, -82, 6, -12, -59, 23,
+        -21, 43, -106, -18, 126, -103, -57, 31, -43, -102, -25, -33, 43, -122, 92, 2,
+        107, 127, -89, 20, 81, -74, 3, -108, 78, -47, 42, -121, 101, 59, 30, 48,
+        -85, 110, -13, -32, 9, -2, 103, 25, 65, -67, -7, 100, 119, 27, -3, 20,
+        85, -41, 22, -106, 61, 67, -7, 69, -57, 10, -9, 120, 125, -3, 73, -73,
+        -53, -121, 84, -38, 9, 21, -98, -86, -65, -99, 80, -90, 37, 15, -35, -118,
+        101, -117, 63, -104, 17, 5, -109, 52, 9, -30, -66, -75, -5, -119, -124, 31,
+        -70, -18, -45, 39, -126, -16, -105, 120, -68, 91, 65, -6, 58, 48, -42, 109,
+        27, 5, 67, -13, -12, -88, -23, 82, -109, -101, -117, 59, 69, 101, -113, -40,
+        19, 58, -47, 123, 127, 17, 94, -126, 86, 79, -82, 95, 117, -7, 111, 120,
+        126, -46, -112, 127, -54, -13, -29, -122, -4, 119, 60, 127, -38, -112, 127, -62,
+        -14, -107, 93, -62, 60, -81, 8, 47, 101, -32, -37, -38, -116, 61, -116, 19,
+        -42, -28, 106, -59, -116, 97, -62, -29, -118, -7, 109, -119, -1, 73, -41, -80,
+        -102, -122, -55, -99, -75, 33, -35, 19, -66, 89, -42, -127, 29, 30, -12, 28,
+        23, -3, -87, 112, 3, 39, -109, -25, 42, -56, 86, 121, -82, 28, 8, -24,
+        -15, -60, -118, -86, -95, 112, 127, 39, -57, -37, -27, 48, 118, -107, 46, 91,
+        53, -55, -43, -119, 40, 91, -116, -117, -114, 98, 64, -49, -55, 41, 76, 122,
+        94, 5, 120, -43, -13, 123, -81, -58, -55, -115, 74, 103, 7, -106, -31, 81,
+        102, 85, -21, -9, -74, -43, 79, 43, -11, -19, 100, 88, 105, -94, -65, -83,
+        -119, -92, -36, -124, -121, -114, 110, -107, 54, -114, -74, -75, 17, -17, -98, -58,
+        -61, 109, -11, -89, -91, -6, -62, 47, 77, 122, 113, -65, -6, 118, -1, 52,
+        -12, -84, -35, 22, -85, 76, 61, 38, -124, 111, 87, 0, 69, -105, -31, 100,
+        -80, 73, 55, -25, 65, -10, -40, 125, -63, -113, -24, 22, -53, -82, 12, 34,
+        2, -32, -53, -12, 120, 23, 92, 33, 3, -81, -54, -116, -88, -52, -123, 36,
+        112, -52, 84, 61, -92, 118, -64, -68, 50, 83, 31, -29, 41, 70, 24, 80,
+        32, -15, -17, 54, -24, -43, 27, -20, -17, 91, 41, -123, -11, 67, -29, 95,
+        4, 37, -39, -112, 99, 119, -22, -114, -36, -79, 59, 113, 23, -18, -36, -67,
+        118, -81, -36, 27, 119, -122, 117, 102, 126, -69, 7, 59, -11, -126, -69, -79,
+        -15, 51, 16, -26, -34, 100, -70, 89, 40, 87, 0, -19, -28, 89, 55, -33,
+        75, -37, -125, -46, -56, -107, 18, -84, -44, 61, -90, -94, -24, -110, -103, 16,
+        -105, -123, 80, -95, -15, -96, 75, 121, 111, 85, -121, -105, 51, -52, 46, -12,
+        -17, 75, -37, -15, -78, 14, -50, -64, 86, 71, 69, 49, -128, 88, 55, 26,
+        106, -57, 68, -15, -2, -66, 40, -123, -98, -83, -91, 67, -92, -23, -2, -2,
+        -76, 35, -98, 64, -33, -33, -73, 103, 126, -42, 97, -2, 63, -24, -59, 35,
+        -6, -27, 106, 59, -58, 5, 103, -106, -42, -64, -76, -76, 98, 45, -51, 24,
+        106, 107, 78, -19, 35, 89, -106, -20, -22, 122, -33, -93, -3, -3, -111, -120,
+        -119, -50, 27, -95, 50, -10, -84, -74, 107, 122, 93, 67, -21, -101, 114, -50,
+        -39, 0, 2, 53, 0, 40, -122, -104, 32, 7, 48, 110, 6, -51, 88, -127,
+        102, -30, -113, -53, -96, -103, -20, -17, 79, 58, -22, 53, 121, -34, -117, 56,
+        30, -92, 62, 44, 124, -25, -96, 72, -109, -16, 100, 113, -59, 110, -52, -39,
+        -40, 32, -2, 93, -8, -127, -68, -46, 4, -33, -117, -11, 90, -28, -52, -3,
+        5, 15, -27, -84, 23, -104, 15, -39, 79, 111, -34, -95, -93, 31, 116, 115,
+        15, 120, 57, -106, -30, -117, -121, -99, -60, 109, -28, 105, 56, -6, -4, 58,
+        -51, 94, -126, -20, 112, -114, 82, -82, 125, 11, -8, -109, -34, 118, -114, -127,
+        58, 55, -106, -63, -83, -58, 44, 108, 62, -1, -69, 94, 107, -11, 68, -46,
+        29, 72, -34, -21, -75, 29, 108, 55, -18, 2, -33, -79, 5, 4, -81, 125,
+        -101, -17, 97, -47, -87, 97, -25, -91, 125, 110, -110, 5, 119, -26, 2, 16,
+        -59, 106, 10, -113, 76, 125, 9, 40, 68, 46, -57, 16, 6, 64, -20, -23,
+        -54, -41, 7, 76, -43, -11, 74, 87, 106, 85, 111, -4, -85, -6, -122, 111,
+        -32, -73, 104, -40, 17, 8, 44, 10, 18, -2, 37, 42, -98, 103, -22, -50,
+        88, -32, -52, -107, 74, 75, 92, 29, -40, 66, 108, 72, 85, -127, 21, -52,
+        77, -60, -79, -104, 18, 105, -7, 43, -16, -32, -73, -55, 124, 81, -68, -54,
+        -78, -108, -36, -46, -107, 97, -68, 9, 98, 91, -17, 39, -69, -71, 36, -71,
+        17, -10, 101, -53, 115, -112, -11, 90, 18, 48, -4, -60, 25, 10, -20, -61,
+        -125, 54, 125, 59, 104, 40, 24, 40, 28, 69, -28, -64, -19, -96, -27, -26,
+        2, 65, 115, -51, -73, 1, -31, 68, 52, -114, -9, -86, 8, 29, 79, 96,
+        -44, -114, 127, 48, -110, -89, 62, 56, -35, -29, 9, -6, 109, 44, -112, -29,
+        -44, 85, 12, -70, -25, -90, -33, 88, -111, 71, 1, -91, 28, -112, -18, 34,
+        -51, 122, 44, 93, 3, -122, -75, -87, 94, -56, 82, -23, 54, 77, 53, 91,
+        -82, 41, 64, 101, -67, -34, -117, 17, -90, -36, -63, 0, 70, -120, -89, -19,
+        -111, -97, 117, 106, -114, 52, 96, 49, -12, 16, -69, 26, -97, -37, 22, 46,
+        -127, 88, -24, 64, -35, 84, -31, 39, 93, -48, -77, -4, 85, 50, -22, -77,
+        100, 88, 91, -83, 56, 55, -23, -45, -11, 116, -106, 2, 124, -49, 17, -57,
+        102, 56, 90, -96, 40, 11, -116, 76, 9, -96, -93, 118, -10, -9, -11, -51,
+        -76, 98, 0, -87, 36, -43, -41, -108, 125, -88, 35, 81, -106, -32, 86, 26,
+        112, -74, 14, 98, 40, 26, -70, -112, 45, 69, -30, -63, 25, 94, -1, -46,
+        43, 119, 102, -128, -63, -27, -27, 29, 126, 44, -77, -41, 27, 52, -97, 45,
+        -46, -127, 103, -100, 78, -126, 44, 42, -90, 51, -68, -12, 12, -37, 98, -81,
+        -117, 39, 35, 34, 68, 13, 23, -104, -27, -103, -35, -2, -2, 94, 78, 103,
+        46, -95, 41, -113, 3, 53, 85, 39, 41, 123, -27, 117, 40, 29, -78, -80,
+        -15, 87, -33, 115, 8, -24, 82, 117, 72, -126, 61, -32, 21, -34, -69, -92,
+        -33, -14, 2, -122, 18, 22, 65, -44, -105, -112, -124, 98, -114, 121, -114, -118,
+        21, -43, -95, -73, 47, 27, -46, 106, 12, -104, 22, -42, 4, 103, 12, -84,
+        -90, -62, 60, -120, -37, 1, 25, -99, 25, 105, 51, -59, -112, 33, 91, 102,
+        -115, 75, -100, -58, 97, -25, 54, -56, 18, -37, 58, 110, -51, -16, 53, -56,
+        54, 27, 89, 75, 3, 124, -117, -120, 119, 11, -70, 89, -60, -29, -42, 52,
+        -72, 9, 91, -31, 127, 44, -126, -72, -59, 78, 99, 91, -23, 117, -117, 87,
+        2, 10, -38, 90, -75, -125, 101, -104, 91, -6, 9, 108, 69, 92, -36, 114,
+        80, -87, 109, 45, 45, 2, 46, 45, -116, -10, -19, -45, -15, -95, -2, 6,
+        7, -57, -52, -53, 82, -14, -78, 62, -103, -67, 69, 1, -23, 48, -52, -118,
+        -96, -85, -53, -75, 69, -87, -64, -57, 93, 5, 42, -113, -51, 104, 113, 52,
+        -21, -5, 104, -106, -23, 25, -75, -111, -56, 83, -99, -82, -71, -55, 36, -33,
+        -84, 41, 58, -84, 73, -61, 103, -41, -62, 114, -44, -20, -22, -70, 125, -4,
+        35, -58, -69, -68, -1, 120, -105, 53, -29, 93, -86, -15, 46, 119, -115, -73,
+        -68, 2, 95, 53, 94, -114, 32, -9, 26, 48, 43, 59, -84, 75, 100, 67,
+        -82, -124, 33, 47, 42, 50, -123, 20, -3, -22, -3, 62, -56, 62, 10, 44,
+        -107, 44, 80, -76, 57, 40, -91, -125, 47, 124, -47, -34, -32, 10, 62, 121,
+        -105, -15, -33, -60, 83, -72, 1, -100, -58, 44, 111, -31, -79, -58, -20, 82,
+        -118, -49, 90, 71, -62, 85, 122, 37, -125, 90, 45, -91, -7, -42, 119, -41,
+        -113, -81, 127, -72, 126, -94, 85, 80, 118, 125, -83, -122, 74, -124, 42, 15,
+        -5, -8, 31, 85, 97, 19, -32, -113, -111, -79, 113, -21, 41, -66, 120, -89,
+        -20, -95, 30, 91, -75, 86, 70, -37, -94, 20, 15, -120, 98, -117, 105, 50,
+        115, 40, 74, 18, 34, 69, -102, 69, -99, 98, -102, -91, -73, 45, -60, 8,
+        106, -44, -74, -52, 74, -83, 17, 45, 110, -21, 10, -17, -10, -111, 64, -38,
+        -70, -99, -122, -128, 53, -27, -122, 90, 81, -34, 2, -66, 25, 118, 90, -25,
+        36, -105, 92, 95, 3, 85, 92, -75, 64, 35, 64, 74, 73, -30, 92, -21,
+        106, 5, 4, -77, -64, 91, 91, -83, -88, -128, 38, 90, -41, 65, -100, -121,
+        29, -117, 2, -25, 10, -15, 48, 52, -108, -73, 112, -117, -21, 42, -25, 75,
+        58, 113, 127, -34, -85, 78, 72, 60, -10, -37, -6, -44, -62, 45, -44, -126,
+        -91, 108, 65, 67, 64, -75, -77, -80, -123, 115, -53, 23, -13, 121, -118, -22,
+        67, -89, 117, 70, 49, -95, 112, 104, -52, 53, -111, -77, 0, 109, -32, -51,
+        -61, -15, 105, 54, 20, -77, -68, -18, 57, 51, 45, 53, -99, -109, 101, 51,
+        -92, -121, -52, -62, 82, 88, 10, 14, 102, 100, 108, 90, -107, -38, 92, 6,
+        40, 60, -107, -43, -46, -71, 5, -123, -64, -71, 87, 6, -89, -78, 23, -108,
+        -78, 48, 14, 122, 25, 93, -44, 125, 30, 90, 22, -82, 107, 73, -101, 53,
+        123, -11, 4, -105, -120, 113, 65, -115, -7, -38, 77, -91, 125, 11, -91, 88,
+        -42, -88, 99, 90, 53, -86, 99, 21, 74, 66, -51, 80, -21, 0, 108, -78,
+        117, -15, 96, 28, -15, 101, 88, -11, 40, 105, -87, 64, -25, -70, -63, -57,
+        -30, 107, 12, 101, 76, 100, -80, 40, -98, 67, -91, 39, -46, 43, 67, 101,
+        -31, -6, -44, 96, -31, -46, 12, 92, 13, 70, -83, 31, -55, -6, -7, 75,
+        80, -65, -109, -123, -112, -57, -104, -72, 97, -115, -82, 38, -67, -87, 38, -99,
+        86, -109, -34, 85, -109, 78, -12, 36, -27, -110, 95, 73, 125, 5, 100, -84,
+        -100, -90, 39, 124, 8, 51, -68, 96, -96, 39, -3, -104, 6, -79, 49, -6,
+        -113, -6, -57, -81, -6, 7, -59, -99, -48, 19, -50, -127, 101, -104, -107, -33,
+        -91, 19, 99, -12, 116, -26, -64, 83, -104, 105, -27, -84, -95, -26, 71, -126,
+        -83, -111, -12, 73, 79, -46, -3, 125, -90, 65, 78, 62, 95, 63, -46, -125,
+        -83, 116, -11, -76, -61, 30, 111, -107, -7, -84, 27, -67, 64, -82, -89, 80,
+        49, 113, -103, -8, -99, -42, 52, 42, -117, 57, 6, -68, -48, 19, -109, -108,
+        125, 125, -56, -46, -101, 104, -52, -10, 117, -63, 31, -56, 67, -89, 123, -48,
+        -96, 65, -25, -91, 62, -72, -77, -26, -49, -43, -68, -46, -29, 116, -84, 101,
+        -2, -22, 24, -14, 111, -106, -96, -114, -25, -16, 1, 38, 94, 42, -54, 63,
+        42, 115, 9, 118, -13, 25, 111, -87, -25, -123, 112, -8, 39, -40, -88, -84,
+        -41, -8, 54, 65, 77, 94, -108, -29, 123, -49, 31, 63, -3, 42, 62, -119,
+        -26, -66, -125, 66, 31, -115, 20, -96, -62, -97, -40, 11, -114, -104, -120, 17,
+        -115, -4, 54, 15, -95, 112, 122, -4, -15, 31, -65, 28, -65, -5, -21, 43,
+        -52, -120, -110, 79, -66, 72, 127, -5, -109, -111, 14, 51, 98, 67, -25, -127,
+        -58, -28, -57, -57, -90, -90, 62, -6, 53, -23, -72, -1, 64, -63, 63, 109,
+        -86, 39, -14, 27, -86, -13, 56, -108, -28, -13, -55, -93, 85, -6, -11, -67,
+        -1, -38, 80, -3, -41, -58, -31, -66, -116, -82, -81, -21, 42, -87, -112, 41,
+        -36, 55, 77, 125, 115, 68, -96, 20, -70, -85, -9, -127, -97, -100, -15, 101,
+        -26, -120, 120, -110, -90, -39, 88, 36, -99, -29, 101, 109, 61, 5, -88, -3,
+        -121, 0, -29, 0, 113, -116, -96, -123, -62, 9, -50, -125, -79, 10, 74, 69,
+        41, 75, -74, -1, -55, -29, 85, 35, 5, -65, -85, 100, -27, 18, -57, 42,
+        -100, -85, 115, 124, 117, 95, 123, -78, -107, 0, -22, 71, -100, 111, 95, 122,
+        52, -57, -47, 34, 26, -77, 95, 64, -115, 81, -50, -68, -69, -94, 103, 86,
+        78, -23, -108, 31, 6, 65, 93, -124, 99, -4, -71, -104, -93, -115, -122, 126,
+        -114, -30, -120, 28, -69, -16, 1, 102, -79, -111, -16, 67, -114, -14, 76, 79,
+        69, -122, -54, 11, 3, -1, -118, 99, -6, -67, 113, -43, -101, -51, -48, 28,
+        116, -2, -111, 15, -119, 62, 62, -79, 15, 118, -128, 42, 75, 86, 61, 56,
+        46, -73, 58, -110, -31, 33, 40, -103, -95, 62, -92, -15, 106, 66, -57, -71,
+        -27, 22, -75, 99, 114, 53, 32, 58, 48, 71, -76, -94, 28, 122, 2, -52,
+        -115, -125, 108, 2, -84, -11, -116, -5, -39, -53, 35, 98, -96, -28, -4, 104,
+        28, 104, -27, 98, 52, 125, 25, -34, 68, -93, 16, 31, 102, 46, -16, -109,
+        61, 76, 7, -36, -110, 25, 73, -42, -21, 36, -72, -119, 38, 24, -7, -95,
+        51, -53, 97, -69, 80, 29, -74, -78, -48, -62, -53, 40, 43, 86, -84, 49,
+        124, -33, -29, 36, -120, 99, 113, -18, 78, -5, -25, -124, -84, 17, 12, 54,
+        60, -119, -65, 10, 15, -93, 70, -17, 94, 82, -78, -60, -57, 39, -15, -63,
+        -124, 47, 94, -110, 42, -13, 51, 121, 68, 51, -109, -114, 98, 82, -103, -118,
+        -46, 53, 111, -19, 80, 56, 14, -26, -71, 124, -30, -105, 125, -88, 81, -108,
+        -110, -34, 38, 99, 0, 7, -27, 4, -55, 8, -128, 31, 100, -85, -109, 106,
+        -83, -90, 60, -83, 122, 22, -31, 109, 98, 85, 5, -41, -99, -123, -19, -8,
+        -88, -67, -26, 62, 10, -26, -128, -26, 90, -11, 112, -23, -75, 85, -14, 75,
+        51, 126, 15, -28, -28, -36, -127, 95, -26, 80, -29, -109, 52, 30, -121, -55,
+        7, -18, -57, 118, -12, 8, -49, -26, -15, -23, 16, 96, -101, 68, 34, 104,
+        77, 38, 9, 108, 21, 2, 50, -75, -58, -122, -59, -56, 10, 48, 96, 42,
+        -89, -115, 31, -120, -44, 47, 20, -6, -114, -104, 8, -21, -65, -21, 50, -61,
+        40, -61, 42, 109, 51, -15, 104, 59, -72, 117, 94, -15, -93, 121, 11, 63,
+        12, -57, 119, -26, 112, -48, -47, -81, 33, -48, -103, -75, -111, -117, 127, 115,
+        18, 106, 85, -98, 46, -30, -70, -13, 32, -111, 93, -64, -17, -81, -19, 1,
+        -86, -86, -15, -53, 6, -43, -91, -120, -81, 108, 86, 54, -64, 95, -89, 38,
+        -20, 5, -86, 4, 24, -110, -34, 38, -12, 98, 54, 96, -6, 9, 17, 13,
+        65, -91, -67, -69, -115, -117, -17, 24, -61, 16, 62, -2, -84, -65, -126, 110,
+        68, -39, -92, -120, 13, 5, -3, 61, -5, -27, -57, -97, -50, 64, 43, 44,
+        -118, -71, 119, 120, 120, 123, 123, -37, -71, 61, -22, -92, -39, -28, -80, -33,
+        -19, 118, 15, -13, -101, -119, -27, -62, 63, 127, -29, 87, 72, -31, 39, -69,
+        -66, 5, -65, -109, 20, -15, -122, -122, 65, 47, 111, 96, -41, 99, -12, -22,
+        4, -70, -62, 30, 111, -69, 51, 94, -20, 97, 68, -116, 44, 96, -52, -93,
+        -124, 121, 8, -41, -119, 9, -28, -20, 83, 43, 36, -80, 71, -36, 13, 33,
+        -123, -10, -112, 124, 46, 25, -37, -108, 50, 4, -106, -26, 79, 4, -85, -97,
+        36, -16, 112, -126, -85, 110, 123, 82, -61, -22, -23, 96, -14, 25, 1, 57,
+        61, 2, 112, 127, 8, -118, 41, -21, 69, 16, -126, 55, 65, -2, 10, -51,
+        119, 31, -79, 55, 77, 60, 18, 123, 83, 19, -114, 4, 65, 122, -103, 5,
+        -73, -56, -36, 121, -98, -74, 107, 64, 16, -4, 9, 6, 67, -21, 67, -61,
+        -32, -79, 3, 104, -124, -100, -127, -20, -11, 92, -7, 14, 53, -128, 30, 127,
+        -53, 117, -56, -48, 38, 18, 126, -28, 52, -116, -32, 67, -127, -27, 84, 66,
+        41, 54, -94, 68, -119, 82, 36, 57, 28, 76, 109, -40, 67, 81, -63, -116,
+        -114, -91, 82, 49, 104, -110, -4, -8, -75, 82, -32, -35, -37, -97, 94, -3,
+        -29, -51, -85, -73, 63, -66, 57, -1, -57, -49, -57, -25, 111, -33, 123, -67,
+        -50, -29, -34, 19, -105, 100, 12, 54, 74, 57, 25, 74, 35, -7, -73, 46,
+        -125, -91, 9, 40, -84, -86, 73, 68, -51, 63, -94, 79, 16, -2, -8, 4,
+        63, -24, -55, -49, 24, 1, -124, 72, 47, 62, 62, 25, 31, -40, -50, 71,
+        73, -64, -88, 45, -58, 31, 100, 93, 76, 55, -22, 124, 100, 117, -70, -46,
+        -115, 8, 87, 75, -117, -27, -67, -35, -47, -128, -94, -64, 75, -119, 5, 95,
+        -15, 49, 34, 100, 27, 10, 29, 70, 27, 14, 59, 6, 19, 84, 70, 109,
+        118, -67, 70, 102, 51, -20, -124, -20, 81, -100, 38, -8, -10, -114, -80, -35,
+        -121, 29, -55, 33, 101, 110, -87, 81, -90, 102, -117, -94, -97, -74, 22, 93,
+        -15, -94, 74, 117, 125, -3, 39, 57, 103, -120, -37, 69, 100, -124, -79, 101,
+        3, 14, 115, -111, -72, -85, 58, 108, -96, -9, -103, -116, -12, -59, 78, 48,
+        -68, -62, -27, -34, 65, 30, -67, 60, -16, -119, -41, -90, -37, 112, 98, 2,
+        63, 127, 99, 112, 108, -102, 22, 19, -98, -15, 83, -69, -38, 14, 82, 106,
+        117, -78, 32, -22, -51, -25, -31, -8, -19, 108, 82, -21, -57, 106, -94, 10,
+        123, 66, -113, 77, -58, 13, 124, 25, 67, 62, -84, 62, 82, 79, -63, -26,
+        -13, -90, 34, 108, 55, 81, -103, -52, 15, -98, -25, -61, -128, 63, 70, 75,
+        -113, -66, -30, 91, -20, 46, 72, -27, 3, -19, 0, -127, 27, 102, -76, 20,
+        -10, 8, -19, 80, -117, -52, -119, 114, 37, 107, -63, 44, 94, -50, -28, 53,
+        -19, -92, -90, -50, 1, 112, -111, -70, -46, 14, 44, -103, -97, 81, 110, 70,
+        -65, -59, 11, -71, -79, 28, -118, 8, 102, 54, 78, 71, 11, 122, -50, 109,
+        4, 16, 45, 66, -50, 30, 126, 58, -45, 96, 64, -52, -50, 5, 86, -113,
+        -28, 41, -79, -100, -63, 12, 22, -86, 56, 46, 10, -40, 102, 83, -9, 14,
+        20, 2, 122, -73, 23, 51, -33, -66, 116, -7, 47, 122, 106, 66, 101, -48,
+        -25, -48, -4, -12, 44, 96, -54, -39, -39, 60, 24, -123, -17, -109, -65, -26,
+        -95, -72, -60, -102, 28, 88, -8, 14, 51, 27, -89, 23, -45, -41, 70, -68,
+        -124, 116, -1, -15, 18, 64, 96, -76, 83, -29, 21, -35, -111, -29, -114, -60,
+        -16, -93, -85, 69, 17, 66, 85, 126, 28, 9, -11, 58, 75, -32, -103, -97,
+        93, 107, -102, -123, -41, -106, -101, 58, -82, 54, -43, -111, 123, -121, -14, -41,
+        10, -2, 31, 120, 28, -116, -4, 38, 60, -50, -25, -64, -83, 126, 70, -79,
+        -98, -33, -122, -35, 58, 5, -20, 25, -11, -115, 14, -9, -61, -124, -59, -32,
+        -65, 92, -13, -83, -57, 48, 126, 25, 94, -25, -12, 112, -91, 49, -8, -87,
+        -15, -94, -121, 38, -79, 126, -63, 86, -48, 76, 111, 124, -61, 75, -53, 111,
+        84, 10, -108, 22, 57, 104, 92, 108, -120, 96, 48, -114, 114, 14, -63, -79,
+        121, 58, 31, -47, -109, -47, -52, -61, 9, 63, -121, -107, -83, 45, -83, 78,
+        -92, 99, 123, 59, -14, -1, 18, -106, -36, 20, -71, -99, -77, 66, 50, 84,
+        -124, 34, -40, 15, 40, 126, -20, -126, -54, 64, -47, -96, -126, -123, -41, 112,
+        -103, -41, -124, -15, 22, -38, -96, 58, 62, -2, 30, -119, -74, 0, -30, 77,
+        -71, 84, 102, -66, -122, 65, 48, 35, -103, -19, 92, -108, -101, -72, 28, 104,
+        49, -126, 75, 14, -89, 44, 50, 101, -91, -58, -2, -66, -99, -34, -69, -80,
+        83, 23, -55, 57, -91, 38, 82, -5, 78, -113, 80, 90, -82, 90, 14, 88,
+        90, 9, -83, -56, 64, 90, 116, -24, -81, 123, -117, -79, 103, -39, -44, -23,
+        125, 123, -104, 52, -6, -18, 12, -43, 79, 79, 7, 8, 38, -40, -27, 46,
+        29, 32, 75, -90, -13, 66, -58, 72, 26, -33, 28, -50, -48, -4, -82, 78,
+        -41, 51, 11, 12, 120, 84, 73, -102, 47, -1, -19, -72, -23, 122, 13, -97,
+        -20, 6, -121, 107, -38, -86, 23, -48, -54, 53, 8, -53, -29, 22, -107, 109,
+        -75, 91, -24, -102, -64, 68, 92, -53, 17, -92, 50, -59, 83, -110, 118, 15,
+        31, 30, -105, -82, 120, 86, 54, -71, -78, -100, 97, 42, -34, -101, 123, 74,
+        -31, 71, -105, 64, 100, 65, 81, -1, 121, 114, 21, -40, -87, 27, 59, -114,
+        103, -42, 8, 44, 124, 121, 2, -118, -58, 80, 20, 64, -13, 94, 121, 105,
+        -1, -4, -29, -117, 99, 59, -91, 83, 124, 62, 27, 42, 38, -65, 28, 69,
+        -120, 97, 32, 9, -7, 38, 104, 94, 68, 31, 88, 30, -62, -38, 38, -45,
+        5, 55, 0, -80, -11, 96, 31, -126, 68, 99, 33, 47, 112, -81, 5, -94,
+        122, 41, -3, 22, 30, -2, -79, 16, -119, 89, -26, -108, -82, 82, -53, -8,
+        10, -68, -13, 92, -17, -4, 71, -98, -71, -67, -9, -26, -2, -94, 10, 54,
+        82, -97, -116, -112, 99, -121, 108, -5, -114, -4, 76, 103, 121, 121, 54, 114,
+        -57, -66, -58, -126, -122, -38, 111, -49, -78, -72, -73, -87, 33, 58, -40, -14,
+        -38, 2, -12, -118, -83, 120, 38, 2, -114, -16, -43, 8, -99, 8, 61, 27,
+        -119, -117, -72, -93, 11, 51, -25, -46, 27, 93, 116, -31, 31, 78, -7, 57,
+        -89, 29, -14, -65, 66, -102, -25, -100, 64, 10, 2, -30, -121, -56, -33, -62,
+        53, 93, 109, 50, 98, -23, -43, 65, -118, 12, -63, -77, -120, -58, -102, 99,
+        -73, 62, -62, -125, -98, -52, -64, 39, 109, -127, 23, 88, -117, 44, -74, -65,
+        -5, -26, -58, 92, -53, -79, 120, -44, 89, 104, -45, 64, -115, 97, -18, 25,
+        120, 10, 50, -45, 84, 29, 120, -45, 85, 88, 122, -67, 101, -86, -5, 66,
+        105, 68, 98, 39, -23, -82, -67, -55, 44, -103, 21, -95, 7, 115, -113, -83,
+        -90, 93, 20, -105, 94, 53, -75, 60, 10, 70, 90, 119, -60, 9, 119, 67,
+        25, 26, -36, -115, 52, -97, -25, -64, -65, -48, 46, 11, -44, -122, 73, 34,
+        39, 99, 61, -76, 56, -9, -63, -81, 16, 55, 22, 10, -87, -20, -35, 37,
+        -7, 0, 119, 1, -91, -47, 58, -61, -64, 111, -56, -14, 2, -10, -70, 117,
+        83, 77, -81, -87, 3, 2, 80, 93, -13, 90, 70, -75, 113, -67, -106, 39,
+        -25, -86, -97, -5, -3, 79, -98, -111, 91, 18, -43, 25, -82, 16, 45, 6,
+        5, -40, -20, 87, 47, -127, -35, -23, -33, 34, 26, -68, -24, -51, 40, -85,
+        63, 29, 94, 33, -18, -37, -4, -15, 53, 90, 27, 41, -70, -120, -75, 40,
+        -82, -78, -20, -126, 98, 16, 104, 20, -104, -123, 109, -41, 104, -66, 112, 80,
+        -67, -43, 55, -53, 32, 100, -110, -120, 100, -6, 18, -23, 99, -46, 55, 103,
+        -22, 65, 32, 119, 90, -30, -21, -87, 24, 76, 71, -69, 90, -122, -36, -77,
+        38, -71, -122, -53, -41, -106, 115, 71, 126, 48, 104, -18, 6, -60, 109, 103,
+        24, -7, 114, -63, 74, 121, 23, -119, 73, -52, -121, 113, 103, -100, 5, -73,
+        28, -46, -10, -114, -46, -82, -54, 103, -6, -107, -6, 102, -28, -35, 29, -71,
+        83, 23, 80, 49, -13, 34, 127, 107, -53, -9, 109, 73, -67, 98, 107, -94,
+        -122, -50, 122, -101, 112, 35, 50, 22, 63, 40, 45, 126, 110, 98, 14, -30,
+        66, 84, -113, 0, 57, 67, 0, 22, 111, 4, 116, -92, 92, 8, -128, -88,
+        94, 74, 108, -104, 86, -80, 97, 68, 41, 32, 97, -62, 34, 8, 102, -63,
+        92, 0, 38, 126, -28, 46, 124, -87, 46, 107, -39, -38, -3, 53, 96, 33,
+        -27, 101, -82, 43, -122, -24, 84, -105, 126, -111, 33, 2, -43, -27, 12, 38,
+        -11, -62, -39, -94, 94, 56, -101, -16, -23, -50, -73, 13, -8, 60, -67, -57,
+        112, -49, -45, -70, -63, -98, -89, -11, 67, 61, 79, -115, 88, -11, 90, 1,
+        -15, -29, 60, 101, -92, 99, -67, -34, 81, 64, -8, 1, 39, -66, 116, -20,
+        -46, 74, -45, 61, -61, -31, -120, -3, -91, 10, 32, -11, 62, 32, -29, 8,
+        61, -62, 99, -105, -53, -54, 59, -119, -64, -52, 75, -110, 49, 64, 114, -72,
+        -20, -64, -49, 62, 72, -60, 118, -28, 120, -16, 127, 70, -53, 127, 88, -77,
+        44, -32, 61, 64, 104, -53, -68, 47, 98, 115, -1, -78, 125, 113, -19, 127,
+        65, -107, 65, -30, 95, -69, -41, -11, 8, 51, -81, 71, -104, 107, -121, 11,
+        73, -119, 31, 13, -22, 7, -120, 101, -23, -47, -121, -122, 60, -48, 94, -22,
+        -122, -120, -114, -5, -11, -125, 55, 42, 24, -41, 68, -39, -100, -81, -4, -55,
+        96, -30, 39, 110, -30, 95, 9, 59, -37, -92, 10, 99, 26, -110, -126, -13,
+        4, 47, 62, -44, -106, 74, -76, 82, 9, -108, -102, 18, -83, 19, 68, -55,
+        -58, -53, 86, 9, 93, -73, -118, -39, -39, -88, -66, -44, 120, 15, 85, 79,
+        32, 30, 123, 70, -87, -103, -93, 76, -115, 111, -102, 76, -115, 120, -31, 97,
+        -121, -79, -79, -58, -108, -104, -121, -36, 90, 124, 74, 103, -74, 120, -98, 118,
+        -113, 55, 97, 10, -19, 53, 40, 117, -44, -21, -105, 37, 13, 78, 45, -11,
+        50, -50, -80, 54, -39, -69, -88, 77, -66, 116, -21, 123, 18, 46, 94, -35,
+        -1, -113, -69, 119, -31, 110, -37, -72, 26, 69, -1, -118, -60, -98, -93, 2,
+        38, 72, -111, -78, -27, 36, -96, 96, 46, 91, 118, -102, 124, -57, 73, 124,
+        -21, -76, -75, -93, 106, 117, 65, 36, 68, -94, -122, 0, 126, 0, 36, -111,
+        -97, -60, -1, 126, -9, -34, -13, 30, 12, 64, -54, 73, -49, 93, -21, -82,
+        54, 22, -127, 121, 96, 30, 123, -10, 107, -10, -125, 76, -17, 58, -21, -100,
+        -43, 110, -75, 9, 48, -16, -104, 40, -99, 49, 11, -93, 73, 114, 22, -75,
+        84, -100, 36, -3, -66, -81, -87, 48, 93, -33, -70, 72, 46, -15, 30, -50,
+        57, 12, -117, 127, 50, -102, -115, 46, -7, -111, 104, 89, 80, -117, 41, -18,
+        -56, 22, -28, 88, -68, -83, 102, -73, -119, 90, 43, -30, -72, -39, 54, 87,
+        59, -78, 42, -94, -126, -73, 92, -112, -126, 81, -102, -45, -67, -48, 52, -77,
+        -78, -16, -30, 5, 76, 92, 127, -110, -92, 18, -114, 84, -126, -124, 16, 9,
+        32, -35, -106, 53, -24, 32, -46, 63, 107, -40, -13, -76, -102, -63, -108, -128,
+        -75, 106, 45, 18, -69, 2, -5, -114, 24, -60, -67, 25, -81, 70, -113, -113,
+        -27, -29, -29, -100, 101, 65, -103, 49, -45, 41, -17, -127, -36, 70, 67, 44,
+        -104, -10, 122, -95, -18, -74, -53, 61, 8, 120, 55, 61, 88, -70, 33, -80,
+        29, -91, 71, -86, -10, -63, -118, -108, 104, 76, 90, 68, 77, 56, -34, -51,
+        -79, -123, -4, 41, -82, -66, 72, -63, -79, 48, 4, 71, -110, 10, 125, -117,
+        11, -50, -122, 107, 95, -62, -35, 2, -32, 110, 113, 6, -81, -60, -100, 22,
+        0, 105, -76, 1, -73, -128, 33, 81, -63, -110, 50, -73, -107, 5, 81, -31,
+        -111, 31, -16, 119, 99, -7, 110, 44, 104, -80, 62, 25, 54, 11, 74, 29,
+        -51, 68, 14, -30, -9, 26, 106, -49, -93, 35, -26, -38, -23, 46, 125, 124,
+        44, 92, 2, 27, -66, -74, -14, -92, 72, -45, -37, -57, 71, 111, -43, -113,
+        122, 7, 121, 49, -96, 107, -51, -92, 28, 48, -21, -104, 94, 35, -77, 89,
+        -31, -58, 13, 29, 27, 26, 58, -101, 0, 6, -32, 59, -3, -96, 69, -36,
+        -54, -122, -101, -117, -59, -91, 63, -91, -47, -36, -53, -3, 1, -36, 12, 76,
+        98, 113, -13, -29, -36, -13, -3, -48, 92, 51, -124, 81, 26, 116, -113, 39,
+        -120, 23, -22, 58, -74, -49, -116, 27, 4, 8, -86, -86, 115, 2, -94, -107,
+        -111, -33, 40, -79, -43, -123, -73, 91, 127, 82, 88, 18, 109, -50, -77, 14,
+        -35, -110, 14, -77, -75, 80, -15, -90, 80, -19, -102, -39, -49, 73, 65, 60,
+        -38, -89, 29, 18, -67, -42, 90, 90, 116, 105, -43, -1, 71, -11, 50, -38,
+        -81, 45, 115, 116, -63, -10, 72, 50, -94, 24, 118, 24, 0, 25, 86, -3,
+        12, -114, 30, -5, -11, -86, 104, -34, 48, 97, 25, -18, -51, -39, -96, -71,
+        -43, -102, -95, -112, -88, 102, 117, -63, 110, -96, -6, -99, 77, 125, 109, 84,
+        112, 98, -68, 10, -114, 63, 18, 97, -74, -113, 124, -112, 1, -21, 30, -45,
+        41, -15, 115, 94, 98, 40, -1, 91, 76, -51, -54, -98, -1, 109, 60, -91,
+        -20, 114, -127, 82, -73, -46, 109, -124, 126, 115, -30, -119, -124, -87, -4, -32,
+        13, 42, 34, -94, 124, 16, -64, 42, 0, -34, -69, 83, 120, 15, -37, 74,
+        51, -81, -17, 41, -112, -88, 87, 1, -10, -67, -27, 68, 59, -98, -49, -33,
+        -47, -87, -63, -20, 59, -28, 120, 12, 111, -32, 55, 35, 20, 58, -33, -53,
+        23, 65, 51, 33, 32, 58, -28, -75, 21, -111, -69, 77, 91, 33, -93, 83,
+        23, -58, -6, 92, 74, -117, -31, -91, -82, 22, -46, -113, 68, -105, 0, 46,
+        14, -117, -106, -43, 72, -124, -21, -82, -101, -31, -70, -107, -125, -27, 20, 15,
+        99, 24, -109, -20, 117, -99, -26, 105, -75, 100, 33, 25, -127, -74, -56, 74,
+        37, -85, 84, -118, 84, -26, -9, 66, -24, -110, -29, -5, -120, -14, 36, -70,
+        124, 2, 1, 114, -93, -107, 20, -13, -86, -27, 22, 90, -79, -94, 22, 87,
+        -24, 125, 109, -47, 30, -29, 85, 35, -74, -96, 49, 85, -122, -81, -19, -39,
+        70, -44, 47, -64, 98, -29, -16, -43, -6, 25, 11, 50, -5, -12, -21, -126,
+        43, -58, -24, 96, 6, 118, -68, 27, 12, -63, 22, -111, -52, -80, 74, -48,
+        73, 47, 120, 32, 0, 12, -71, -73, 106, 49, 93, -122, 69, -80, -30, -47,
+        -39, 103, 67, -106, -98, -125, -85, 107, 45, -75, 47, 19, -66, -3, 41, -1,
+        1, 43, 21, -14, -97, 66, -125, 107, 55, -32, -73, -87, 83, -15, -117, 53,
+        -31, 50, -69, 54, -51, 127, 56, 63, 103, -88, 65, -116, 71, -42, -113, -82,
+        -25, -80, -41, 44, 108, 46, 99, 96, 46, 91, 104, -81, 99, -64, -62, -43,
+        -23, 11, 7, -76, -85, 49, 40, 90, -56, 41, -1, -63, 7, 66, -17, 2,
+        -58, 72, 36, -6, 88, -124, -6, -34, 61, -75, 95, -60, 21, -114, -11, 66,
+        -97, -98, -48, 64, 104, -99, -66, -115, -85, 37, -77, 13, 114, 119, 43, -53,
+        85, -57, -14, -107, -34, -75, 124, -87, 86, -90, 109, -68, -102, 46, 4, 59,
+        -43, 30, 89, -121, -122, -82, 68, 35, -127, -87, -78, 95, -111, 24, 108, -113,
+        -21, 88, -117, 41, -100, -44, -4, -74, -105, 119, -15, 62, -83, 106, -52, 33,
+        -20, -11, -56, 116, -115, -91, 14, 0, 49, 24, 57, -78, -97, -16, -51, 59,
+        124, 51, -68, 74, -47, -85, -106, 119, 2, -30, -113, 31, 116, -9, -109, 37,
+        -15, 93, 98, -12, -13, 30, -33, 60, -71, 31, 52, -91, 51, -70, 121, 11,
+        47, -98, -46, 11, 25, 4, -9, 84, 62, 83, -127, -97, -118, -4, 28, 75,
+        58, 90, -50, -81, -78, -10, -58, 111, -81, -78, 93, -19, 53, 35, -37, -99,
+        19, 0, 76, 2, -16, -114, -111, -81, 49, -18, 126, -109, 20, 16, -86, -35,
+        -21, -18, -35, -58, -61, 76, -111, 76, -7, 27, 108, -18, 78, 29, 103, 116,
+        -76, 105, 47, -107, -71, 70, 26, -120, -63, 4, -19, -40, -97, -58, 120, -27,
+        17, -37, -40, -63, -46, 83, -5, -45, 20, -85, -91, -102, 121, -49, -37, -33,
+        105, -34, -61, -19, -97, -48, 112, -47, 82, 36, 50, 126, 91, -123, -51, -110,
+        -58, -91, 84, 77, 11, -95, 21, -39, 29, 1, 85, -23, -18, -55, -114, -65,
+        37, -70, 118, 40, 1, -112, 63, -38, 39, -57, 59, -113, 97, -93, 11, 113,
+        24, 120, 28, -124, -120, 76, 100, 55, 77, 57, 91, -15, -95, -88, 40, -2,
+        -8, -1, -112, 85, 8, -103, -25, 36, -39, 7, -112, 55, 114, -108, 8, 43,
+        83, 34, 107, -105, -60, 14, -102, 37, -54, -53, -37, -111, -116, 118, 75, 46,
+        124, -53, -81, 16, -34, -30, -35, -62, 91, -95, 11, 111, 51, 16, -34, 102,
+        103, -123, 18, -34, 102, 66, 120, -101, 71, 73, 127, 28, 96, 66, -72, 9,
+        114, 42, 9, -109, -31, 102, -108, -61, 19, 56, 82, -2, 110, 44, -33, 113,
+        25, 14, 4, -68, 96, 21, -59, 110, 86, -91, -92, 4, -99, 57, 48, 36,
+        -29, -29, -111, 80, -41, -59, 78, -101, 20, -118, -72, 51, -47, 123, -30, -114,
+        78, -48, -55, -59, 28, 120, -34, -31, -1, -96, -123, 117, -102, -93, 4, -71,
+        58, -114, 114, 31, 94, -35, -92, -7, 27, 106, -56, -40, -125, -93, -93, -43,
+        -103, -29, -91, -73, -118, 26, 111, -87, 117, -68, -74, 90, -65, 114, -68, 100,
+        -83, -51, -73, -2, 54, -34, 117, 20, -128, 50, -33, 70, 43, -111, -60, 20,
+        22, -4, 98, 118, 25, 92, -63, -113, 13, -4, -64, 85, -71, -59, -80, 49,
+        35, 17, -55, -26, 74, 87, 83, -40, -127, -67, 104, 5, -96, -61, 5, 57,
+        -49, 45, -40, 66, -34, 49, -24, -90, 91, 9, -124, 93, 111, 29, 92, -111,
+        -110, 14, 83, -72, 38, 100, 56, 5, 12, -8, -99, -65, -51, -24, 7, 26,
+        31, -55, -96, -98, -94, 77, 123, 64, 55, -24, -91, 96, -33, -47, 56, 85,
+        113, 45, 112, -43, -72, 22, -72, 51, 20, 36, -8, -26, -81, -38, -101, 5,
+        -67, -7, 65, 123, 115, -37, 56, -111, -85, 104, -47, 33, -73, 58, -12, 4,
+        6, 25, -49, -102, -103, 122, 117, 22, 92, 70, -109, -58, -53, 108, -105, -46,
+        32, 119, 41, 13, -114, -114, -14, 70, 6, 94, -12, -85, 108, 118, -91, 18,
+        -12, -46, -35, 104, -52, 44, 99, -3, 73, 28, -83, -104, 56, -59, -92, -13,
+        96, 29, -51, -121, -62, -68, 73, 24, -14, 112, 51, 42, 71, -82, 97, -106,
+        -23, 96, 101, 115, -127, -90, 17, 30, -117, -111, -11, 6, 29, -91, -31, 108,
+        -68, 41, -92, 49, 89, 110, 67, 81, 117, 121, 81, 92, 50, 76, -45, -101,
+        -91, -27, -116, -51, 97, -59, -104, -61, -23, 117, 116, 75, -80, 116, 78, 37,
+        -88, -108, 23, 97, -111, 15, 101, 37, 116, -128, -59, -128, 92, -22, 13, 0,
+        -91, 104, -120, 8, -54, 27, 5, -128, 13, 24, -53, 61, 88, 13, 109, 6,
+        -6, -8, 4, 10, 25, 115, -35, 86, -54, 25, 125, 82, 85, -101, -117, -101,
+        -55, -20, -57, -51, 125, 81, 101, -122, 26, 98, 29, -19, 83, 17, 81, 1,
+        33, -34, -121, 117, -120, -29, -70, 103, -125, 113, -113, 112, 19, 38, 3, 49,
+        -121, -74, 58, 51, -24, 39, -104, 65, 77, -26, -49, -76, 14, -56, -92, 109,
+        -64, 47, -126, 122, -6, -114, 74, -106, -108, -7, 57, -83, -102, 50, 1, -90,
+        -70, -24, -79, -30, 1, -115, -84, 23, 54, 63, 42, 107, -52, 99, -12, 62,
+        6, -84, 111, -43, 82, -100, -76, -88, 105, -113, -58, 16, 7, -74, -38, -14,
+        -77, 99, -94, 98, -20, -54, -56, 74, 15, 44, 106, 82, 107, -59, -55, 76,
+        123, -16, -82, 3, -104, -91, -65, 5, -32, 59, -76, 121, 2, -3, -8, 105,
+        -18, 8, -6, 107, -18, -48, -32, -85, 55, -90, 67, 22, 82, 45, 84, 52,
+        -48, -104, -18, -19, 49, 105, -40, -103, 34, 120, 34, 110, 100, -34, 24, 92,
+        -67, 114, 13, 96, -21, 56, 19, -79, -120, -82, -70, 50, -91, 72, 1, 0,
+        -37, -32, 62, 80, 35, 98, 46, 12, -127, -89, 49, 93, -36, 52, -75, 74,
+        -56, -95, -93, -72, -83, 61, -67, 116, -87, 6, 118, 94, -36, -84, 50, -112,
+        -53, -25, -34, 53, -38, -8, -116, 71, 20, -81, 6, 87, -53, -71, 52, 112,
+        16, 27, -93, -59, 12, -41, 54, -5, -59, -10, -24, 75, -16, 58, -8, 24,
+        -100, 7, -17, 59, -42, -91, -63, 118, -79, -123, 98, -44, -55, 59, -41, 116,
+        17, -122, -121, 8, 97, -60, -10, 50, 64, 56, -88, -40, -6, 18, -99, 15,
+        -41, -63, 107, -8, 119, 19, 124, 84, -105, -7, -25, -61, 114, 10, -1, -123,
+        -79, 63, 17, -20, -55, 7, 96, 79, 62, -100, -23, -40, -40, 112, 15, 19,
+        76, -53, 7, 96, 90, 90, 43, 93, 124, -32, -79, -10, -72, -66, -30, 125,
+        52, 6, 78, 125, -28, 19, 91, 83, 51, -74, -122, -123, -107, 27, -31, 85,
+        23, -121, 4, -114, -9, -82, -125, 7, 56, -66, 95, -16, -8, -66, -122, -77,
+        -9, 113, 75, -49, -4, 56, -61, 80, -73, -63, -5, -58, -106, 115, 29, -105,
+        -64, 34, 88, 75, -34, -12, -53, -105, -108, -99, -26, -33, -16, 95, -54, 83,
+        -53, 59, -43, 111, -40, -108, 89, 56, -37, -70, -74, 107, -92, -55, 64, 74,
+        53, 69, -37, 53, 98, 46, -110, -109, -120, 31, 69, 33, -119, 72, -67, -125,
+        88, 66, 77, 21, 59, -124, -60, -47, 95, -109, 53, 16, -102, 55, -18, 36,
+        11, 110, 115, -83, -121, 77, 88, -9, 117, 51, 123, 14, 76, 90, 34, 22,
+        102, 32, 45, -30, -9, -94, -47, -3, -15, 11, 77, 34, -7, -27, -85, 37,
+        18, 23, -5, 47, 63, 123, 94, -108, -91, -56, -59, -13, 36, -122, -26, 112,
+        -36, 52, 116, 64, 46, 4, 23, -121, 60, -103, -68, 20, 77, 36, 102, -47,
+        -110, 35, -128, 57, -4, 98, 103, 127, -110, -100, -115, 48, 82, 3, 2, 81,
+        -14, 42, 119, 41, 124, 41, 108, 69, -28, 46, 58, 62, 17, 102, 72, -60,
+        71, -24, 103, 92, 115, -92, -70, -120, 81, 49, -38, 85, 76, -54, -47, -82,
+        10, 76, 65, -118, -92, 13, 105, 23, -41, -101, -51, 4, 38, -101, 115, -53,
+        -4, 69, -25, 24, -8, -79, 27, -100, 72, 51, -113, 67, 125, -48, -19, -82,
+        94, -48, 118, -70, 103, -67, -117, 61, -21, -119, -79, -116, 47, -61, -111, -78,
+        -88, 56, -20, 94, 68, -68, 86, 121, 96, 55, 78, -99, -43, 110, 47, 39,
+        94, -3, 106, 53, 92, -9, 57, -58, 7, 25, 30, 30, 55, 125, -127, -15,
+        -31, -71, 63, 63, -125, 55, -113, -113, 117, 127, 6, 63, -42, 62, 25, -8,
+        98, 124, 49, 110, -114, 79, -31, -12, 30, 31, 75, 89, 16, -56, -59, -81,
+        5, 88, -123, 0, 73, 56, 65, 120, -90, 17, -124, -103, -55, -100, -53, -119,
+        119, -97, 76, -46, 80, -117, -80, -85, 64, -58, 43, 50, 3, 74, 73, 3,
+        -3, 111, -26, -29, -94, 5, -91, -96, -16, -54, -70, 74, 50, 83, 122, -23,
+        124, 122, 18, -26, -88, -101, 101, 39, -61, 117, -21, -71, 108, 30, 119, 96,
+        -20, 71, 1, 19, 0, -127, -33, -90, 11, 83, -36, -110, -61, -71, 18, -126,
+        14, 45, 109, 6, -54, -94, 2, 53, 78, -82, -19, 59, 78, 29, 115, -31,
+        103, 6, -52, 111, 25, -3, 71, 4, -123, 88, 3, -123, 88, -97, -59, 74,
+        -128, 93, 3, 45, -128, -113, 46, 48, -30, -27, -59, -6, -78, 63, -25, 65,
+        -43, 63, -63, -56, 98, -112, -74, -76, 87, -97, -5, 89, 112, -104, 86, 63,
+        -57, 63, -93, 49, -60, 3, -54, -78, 37, -93, 7, 107, -110, -13, -8, 85,
+        101, -55, -60, 92, -10, -114, -117, -71, 87, 48, -1, 38, 63, -67, -70, -100,
+        -104, -87, 48, 83, 104, 115, -123, 58, -21, -10, 108, -99, -44, 44, 92, -74,
+        -91, -23, -92, 98, -10, -51, 59, 76, 3, -65, 113, -91, -23, 113, -20, -123,
+        -54, -21, 67, -87, -53, -22, 117, 72, 121, 71, 13, 41, -87, 33, 99, -84,
+        -126, 123, -76, 12, -33, -78, 0, 66, 82, -82, 89, 58, 84, 20, 119, -47,
+        -58, 107, 46, -62, 111, 124, -68, 114, -83, -71, 100, -9, 86, -61, -89, 77,
+        122, -29, -35, 2, 62, 94, -7, -61, -51, 68, -69, 28, 98, 66, -80, 71,
+        -33, -15, 121, -112, 97, -44, 16, 40, 36, -128, 93, 32, 38, 91, -64, 97,
+        -70, -91, -61, 20, -34, 5, 41, -52, -22, -33, 48, -111, 21, 41, 105, -62,
+        107, -98, -68, 69, -111, 4, 116, 87, -43, 73, 5, -103, -76, 59, 22, 112,
+        43, 111, -115, -82, 13, -5, 3, -13, -5, 79, -41, 13, -45, -39, 92, -45,
+        -55, -36, 40, -69, 60, 56, -97, 120, 28, 113, 18, -28, -42, -123, 63, 94,
+        -25, -77, 37, -65, 33, -111, 20, 116, 70, 38, -96, -92, 127, -102, 27, -23,
+        -42, -72, -95, -33, 66, 120, 72, -64, -62, 3, -11, -49, -18, -29, 77, -11,
+        86, -57, 32, 112, 54, -21, -95, -67, 38, 116, 74, -67, 22, -21, 107, 13,
+        -90, -8, 49, -2, -123, -57, 18, -48, 29, -118, -38, 107, 73, 19, -93, -46,
+        63, 27, -7, 66, -21, 3, -5, 22, -61, -66, 85, 22, -30, -61, 20, 98,
+        18, 43, -110, -44, 60, 89, -31, 85, 40, 87, 110, 56, 72, -68, -121, -60,
+        60, 71, 114, -114, -38, 14, -63, -116, -52, 29, -84, 7, 5, 32, 18, -16,
+        -54, -100, -118, 49, -22, 109, 116, 77, -37, 113, 61, -36, 32, -1, 36, -65,
+        -114, 28, -31, -39, 96, 60, 26, 104, -17, 4, 17, -120, 95, 57, -36, 14,
+        -5, -115, -118, 125, -8, 40, -103, 83, -11, 122, 66, -15, -109, 56, -56, 13,
+        31, 42, 83, 34, -93, -114, -52, -45, -93, 119, 53, -107, 19, -122, 87, -105,
+        -93, -58, -34, 126, 94, -82, -51, -45, 42, -8, 36, 50, -17, 30, 113, -31,
+        118, 80, 90, 83, -13, -75, -48, 107, -124, -74, -73, -109, -127, -118, 74, 27,
+        21, 21, -36, 25, 41, 88, 80, 55, 11, -127, 118, 21, 58, -33, -56, -33,
+        -97, 101, -64, -77, 67, -25, -126, 52, 3, 117, 53, 23, 21, -112, -39, 8,
+        -70, 28, 33, 12, 24, 32, -23, 115, 25, 50, -91, -41, 12, -25, -16, 36,
+        -115, 35, -23, 9, -46, 9, 119, 1, -128, 122, -1, 10, -127, -67, -65, 9,
+        100, -28, -69, 112, 29, -88, 67, 30, 102, -113, -113, 115, -3, -48, 19, 54,
+        -53, 85, -26, -117, 37, -106, 91, 93, -29, -113, -17, 65, 74, -53, 54, -95,
+        94, -58, 94, -23, -71, -94, -12, -46, 127, 112, -66, -91, -105, 35, 125, -56,
+        122, 76, 1, 116, -49, -59, 18, 55, -39, -51, 24, -21, 49, -61, 35, 11,
+        -126, 15, -96, -58, 96, -34, -86, 1, -8, 18, -23, 101, 19, -37, 108, 64,
+        83, 1, -36, 7, 95, -4, -19, -116, 68, -108, 123, -115, -5, 77, -10, 97,
+        -4, 80, -21, -29, -19, 89, -109, 120, -30, 61, -21, 50, -10, -72, -16, -73,
+        -58, 61, -32, 27, 25, 124, -16, -41, -94, -125, 23, 83, 1, 126, 57, -14,
+        103, -119, 78, -19, 35, -90, 66, 25, 6, 24, 122, -103, 103, -53, 66, 99,
+        53, -15, -5, -8, 36, 64, -17, 64, 38, 99, -28, -111, 112, 4, 110, -38,
+        -28, 43, 77, 91, 50, 92, 15, 42, 12, -80, 54, 40, -79, 117, -1, -28,
+        25, 96, -59, 126, 25, -60, 67, 61, 29, 36, 70, -85, -113, -13, -118, 81,
+        16, 98, 80, -52, -77, -96, -122, 54, 101, -82, 117, 97, 107, 5, -24, 89,
+        -72, -69, -118, 111, 48, 54, 82, 60, 49, 101, -38, 36, 118, 64, -54, -47,
+        81, 7, 88, 100, -127, -34, 68, 74, -50, -103, -30, -120, -27, 82, -86, 125,
+        -39, -61, -38, 83, 48, 52, -121, -102, -105, -114, -122, 52, -107, 25, 101, 109,
+        120, -17, 94, -59, 85, -14, 46, 27, -2, -9, 109, 82, 110, -104, 16, 94,
+        -108, -81, -77, -52, -21, 13, 93, -89, -92, 58, -64, -109, -37, 67, -73, 44,
+        16, 71, -50, -108, -99, -97, -72, 86, -119, 35, -78, -40, -64, -115, -57, 92,
+        42, 111, -118, -75, -121, -41, 79, -126, 87, -106, 97, 0, 43, -66, -25, 0,
+        -26, -36, -125, -75, 13, 14, -111, 0, 2, -98, 44, 65, 102, -26, -84, -63,
+        -49, -88, 3, 72, 115, -64, -81, -11, 27, -118, -25, -28, -107, -92, 23, 8,
+        100, 122, 5, -6, -72, 102, -6, -125, 10, -55, -98, 63, -87, 119, -35, 98,
+        28, 29, 29, -42, -74, 18, -50, 120, -89, 41, -91, -90, -91, -48, -91, 120,
+        -36, 60, -119, 69, 95, 42, -74, -104, -45, -64, 124, 1, 91, 94, 53, 7,
+        20, -44, -99, -89, 71, 69, 17, -11, -115, -116, -66, 112, -128, -66, 47, -54,
+        -5, -72, 116, 65, -123, -40, 102, -61, -25, -21, 119, -20, 55, 109, -11, -18,
+        30, -52, -26, 72, -107, -7, 69, 96, -120, -24, 104, 48, 67, -121, -16, 30,
+        -14, -122, -93, 73, -84, -96, 38, 70, 89, 6, -13, -128, 26, -101, -103, -128,
+        104, 26, -92, 67, -92, 80, 31, -45, -85, -116, 52, 78, 82, -91, -14, -13,
+        -17, -68, -28, 101, 73, -125, 126, -52, 89, -114, -24, 115, -106, -95, -124, -67,
+        28, -112, -79, 0, -26, -122, 28, -92, -68, -68, -25, -48, -61, 32, 100, -119,
+        32, 49, -17, -78, 106, 71, 42, -83, 123, -41, -46, 65, 23, 34, -78, -51,
+        -101, 13, -115, 1, 67, 26, 122, -51, 11, -42, -98, -61, -123, -2, -51, 6,
+        43, 119, 37, -79, 109, -3, 110, -57, -106, -91, 121, -98, -108, 7, -61, -58,
+        8, 46, -76, 16, -36, 127, -42, 108, 52, 49, -88, -42, 42, -111, 121, 88,
+        -125, -34, -97, 47, -11, 8, -76, 41, 15, 124, -8, 67, 58, -97, 39, -7,
+        -82, 48, 41, -26, -44, -80, -69, -44, 8, 111, 97, -102, -15, 97, 68, 34,
+        121, -103, -35, 67, -19, -79, 12, 6, -110, -14, 15, -122, -70, -114, 112, -122,
+        -111, -24, 0, -62, 28, -21, 59, -112, -70, 84, -24, 71, -10, 105, 89, -55,
+        -56, -104, 93, -76, 83, -65, 22, 108, -84, -69, -55, -29, 68, -126, 103, -20,
+        -91, -22, 100, -78, 51, -112, 26, 103, 0, 21, 61, 66, -121, 75, -119, -103,
+        118, -88, 57, -101, -93, -33, -62, 55, -38, 52, -60, 112, -18, -76, -62, -74,
+        88, 100, 106, -13, -22, 98, -79, -56, -110, -74, 105, 26, 91, 103, -18, -77,
+        29, -27, 6, -114, 32, 63, 112, -4, -49, 15, 73, -74, -62, -37, 114, -10,
+        5, 68, -15, -84, 57, 108, -78, 50, 79, 0, -36, -50, -5, -13, -75, -33,
+        42, 107, -20, -78, -72, -1, -54, -79, -87, -34, -72, 93, -58, -41, 13, 16,
+        -75, 95, -46, -95, 45, -99, 39, -65, 123, 52, -113, -113, -65, 103, 52, 99,
+        53, 26, -116, -12, 81, -73, 12, 71, 112, 12, -121, 94, -61, 105, 96, -28,
+        116, 26, 24, 93, -6, 32, 10, 106, -113, 64, 75, 28, -115, -57, -50, -58,
+        99, -77, -15, 24, 48, -70, -85, -15, -119, -77, -15, -119, -39, -8, -28, 50,
+        -48, 108, 91, 68, -64, 34, 101, 54, 96, 68, 70, 66, -114, -52, 121, 63,
+        -125, -50, -82, -23, 84, -73, 32, 49, -31, 31, -53, -29, -99, -89, -60, -84,
+        -27, -114, 6, -72, 95, 79, -86, -78, 31, -14, -64, 4, -55, -51, -86, -74,
+        -85, -95, 125, 113, 108, 94, -21, 70, 64, -28, 80, 60, -96, -84, 58, -90,
+        -64, 79, -95, 82, 5, 44, -79, -112, -106, 2, -120, 40, 34, 113, -3, -106,
+        -35, -62, 96, -24, -89, -97, -46, -4, -89, 120, -115, -7, -115, 90, 90, -4,
+        -117, 61, -118, 113, 4, -15, -109, -83, -104, 52, -118, -32, -102, -101, -21, -56,
+        104, 124, -86, -48, 48, 33, -89, 89, -21, -100, 102, -78, 99, 3, -92, 74,
+        38, -27, 30, 95, 104, -24, 74, 76, 22, -82, -74, 68, 81, 78, -124, -9,
+        75, -2, 3, -78, 0, 123, -96, 119, -108, -86, -111, -69, -86, -47, -84, -67,
+        22, -55, 58, -46, -89, 115, 91, 92, 95, 112, -48, -58, -127, 17, 119, 79,
+        -52, -55, 13, 12, -115, 7, -74, 71, -98, -98, -71, 1, -75, -109, 74, 52,
+        -105, 39, -6, 56, 24, 115, 30, 28, -28, 46, -58, -118, 43, -16, -108, 97,
+        -11, -20, 60, 54, 105, 83, -118, -104, -70, -38, 77, -67, 114, -113, 89, -69,
+        -90, 124, -127, -77, -4, -25, 63, 21, 53, -41, 88, -116, -118, -77, 20, 100,
+        -83, -10, -76, -50, -43, -38, -19, -13, 1, -32, -42, -65, 118, -8, -80, -66,
+        122, -121, -3, 49, -17, -14, 15, -18, -15, -128, -116, -29, 124, 117, 41, -112,
+        -61, -111, -56, -49, 98, 113, 36, 114, 56, 18, 49, 122, -128, -104, 12, 67,
+        27, -65, -21, -13, 107, 110, 84, -4, 123, 110, 64, 40, 117, 73, 75, -11,
+        90, 18, 0, -74, 119, 28, -108, 79, -87, -52, 71, 81, -112, 27, -39, -34,
+        -51, 68, 8, 15, 113, 36, 10, -98, -110, -55, -108, 114, 49, -60, 89, -90,
+        86, 40, -93, 21, -54, 46, -97, -16, 29, -115, -62, 47, -106, -108, 30, -126,
+        -18, 44, 126, -52, -9, 99, -1, 116, -118, 21, 127, -91, 12, -64, -61, 84,
+        13, -56, 8, 9, -91, 104, 55, -98, 68, -73, 72, -61, 13, -110, 18, 107,
+        -54, -103, 94, -44, -105, 94, -22, -98, 98, 55, 98, 41, -10, 66, 44, 19,
+        0, 100, -128, 54, -68, 114, -33, 111, 116, 92, 77, 32, -5, -90, -47, -102,
+        -35, -61, -46, 114, -66, 62, 126, -123, -73, 3, -28, 111, 28, -97, 81, 114,
+        -114, -93, 35, 115, 122, 98, 35, 91, -90, -72, -11, -100, -10, -105, 124, 105,
+        -71, -5, 46, 6, -110, 28, -110, 10, -107, -76, -67, 4, 97, 14, -24, 58,
+        58, 34, 23, 36, 90, 43, 67, 48, 123, -51, -66, 72, -97, -23, -118, 115,
+        38, 88, -80, -67, 25, -80, -87, -2, 0, -62, 72, 53, -21, 1, 19, -74,
+        55, 11, 54, -43, 31, 48, -38, -91, -90, -71, -93, -37, -28, -44, -14, 92,
+        -107, 105, 49, -60, -2, 85, 81, -38, -23, -36, 90, -93, 51, -86, 116, 111,
+        69, 108, 43, -4, 104, -76, -87, 81, 20, -86, 116, 95, -102, 29, -93, 94,
+        -2, 48, 117, -69, 53, 50, 5, 42, -21, 26, 21, -4, -62, -43, 39, 81,
+        36, -33, 50, -127, -117, -103, -111, 34, 50, 2, -2, 52, 14, 7, 99, 84,
+        -70, -105, 17, -83, 37, -18, -20, 20, -109, -64, -119, 75, -10, -119, 122, 93,
+        74, -88, 13, -53, 87, -80, 90, 90, 73, -65, 31, -106, -125, -127, 79, -15,
+        -75, -48, -7, -24, 2, 125, -13, 99, -6, 59, -71, 2, 82, -13, 69, 104,
+        13, 98, 29, 72, -128, -86, 26, 19, -34, 91, 113, -96, 7, -30, 49, -83,
+        -55, 91, -74, 68, 122, 28, -53, 28, 122, -30, 102, -123, 69, -54, 86, -81,
+        -90, 9, 91, 16, -76, 14, -60, -85, 84, -81, -87, 78, -96, 41, -42, 80,
+        39, 124, -38, -73, 15, 12, -49, 102, -104, -1, 7, -99, 25, -33, -91, -49,
+        -108, -94, 115, -30, 113, -113, 103, 5, -111, -88, 96, 28, -110, 70, 9, -55,
+        19, 122, 65, 63, 80, 38, -23, 24, 77, 69, 89, 84, 87, 37, -54, 83,
+        -27, 110, 5, -62, 22, 88, -116, -47, -92, 80, 88, -86, 96, 87, -20, -120,
+        11, 48, -123, -125, -42, 20, 63, -16, 107, -47, -13, -123, 101, 13, 85, 49,
+        123, 23, 85, 38, 37, -71, 107, 84, -36, 32, 101, 30, -26, 91, 127, 91,
+        -69, 69, 19, 86, -89, 108, 45, -57, -8, 76, -18, 68, -81, -124, -76, -82,
+        26, 9, 93, -51, -4, -81, 44, 85, -31, -91, 35, 121, -100, -82, -106, 0,
+        66, -123, 9, 21, -125, -81, 80, 23, 42, -13, -4, -96, 39, 50, -93, 13,
+        29, -54, 44, 58, 121, -93, -119, 58, 90, -109, 18, -71, 121, 15, -83, -107,
+        82, 114, -122, -45, -125, -61, -63, 10, -80, -5, -13, -113, 44, 43, 45, 45,
+        -123, 84, 115, -17, 85, 87, -28, -77, 101, -52, 121, 26, -3, -98, -71, -71,
+        114, 65, -9, -36, -45, 100, -88, 85, 70, 63, 80, -102, 31, 61, 40, -128,
+        120, -5, 127, 103, 84, 46, 78, 88, -58, 70, 75, -120, -53, 100, 108, -122,
+        79, -31, -64, -16, -62, -72, -95, -57, 112, -124, 52, 64, 39, 28, -13, 0,
+        36, 112, -98, 42, -68, -2, -42, 98, -91, -64, -79, 88, 99, -49, 27, -21,
+        -27, 6, 95, 114, -109, 83, -93, -128, 89, -2, 98, 104, 14, -19, -2, 81,
+        -106, -78, -105, -88, 110, -100, -16, 80, 84, 15, 56, -10, -80, -30, 38, -28,
+        -51, 65, -11, -88, 0, -114, 58, 12, -114, 65, 96, -86, 67, 96, 5, 103,
+        111, -46, 121, 54, 99, -102, -43, 104, 82, -87, -122, 21, -14, -108, 32, -99,
+        107, 13, 117, 22, -38, 107, 59, -53, 118, 0, 11, 59, 109, -105, 27, -106,
+        -97, -28, -73, -11, 21, 96, -76, -29, -32, -74, 66, 116, 67, -105, -87, 35,
+        -22, -1, -44, -128, 58, -127, 57, 38, 96, -26, -10, -62, -124, 113, 46, 46,
+        93, 24, -66, -108, -90, -126, 14, 44, 62, 67, -59, -14, -58, 89, -78, 65,
+        86, -36, 85, 66, -16, 53, 73, 118, -96, 120, 101, -105, -102, 37, 113, -7,
+        36, -94, -40, 78, 29, 52, -92, -35, -52, 100, -127, 89, -66, 76, 16, -5,
+        -103, 110, -41, -10, -113, 22, 56, 100, 121, 0, 90, -116, 125, 36, 56, -13,
+        28, 2, -57, 39, 65, 101, -66, -2, -127, -5, 15, 32, -33, 117, -109, -50,
+        97, 4, 61, 51, 62, 13, -21, 63, 66, -21, -104, 118, -117, -9, -96, -105,
+        37, -41, 53, 51, 10, -119, 65, 34, -53, -89, 64, -81, -58, 35, -20, -108,
+        121, 72, -6, 97, -81, 36, -52, -96, -86, -80, -120, -93, -115, 33, 14, 88,
+        51, 16, 23, 48, -81, 88, 93, -84, 88, 19, 84, -112, -91, 32, 12, -68,
+        -90, -34, -85, -24, 116, 20, -10, -82, -118, -70, 102, -119, 41, -84, 114, 22,
+        79, -76, 57, -51, -63, -23, 8, -42, -91, 15, -43, -123, 37, 71, 21, 85,
+        125, 77, -108, 106, 90, 80, -12, 79, -6, -94, -10, -25, 64, -117, -75, -117,
+        119, -83, 71, 71, -67, -98, 124, 16, -126, -103, 110, -84, 33, 12, -115, -56,
+        -92, -126, 85, -45, 45, 47, 74, 101, 100, -111, 116, 88, 88, 36, 46, 11,
+        11, 97, -54, -111, -24, 6, 49, -127, 8, 70, 58, 14, -102, -26, 20, -8,
+        -31, 65, 94, -32, -7, 68, -45, 11, -109, -78, 125, -128, -118, 37, -87, 38,
+        10, -19, 28, -64, -92, 49, 55, -126, -56, -57, -11, 91, 82, 22, 44, 79,
+        -62, -41, 106, 7, 1, -78, -56, -12, 29, 57, 63, 30, 58, -52, -60, 87,
+        -11, -123, -18, -30, -38, 72, 91, 114, -87, -93, 51, -22, -123, -50, -18, -56,
+        -95, 56, 68, -18, 80, -34, 5, 82, -74, -120, -50, 43, 89, -128, 97, 109,
+        -32, -12, -125, 49, -34, 66, 22, -6, -28, -119, 59, -46, 84, -55, 36, 49,
+        -101, 19, 94, 18, -127, 20, -120, 97, 28, 47, -30, -2, 24, 127, -5, 15,
+        53, 38, 7, 54, 100, -114, -92, -119, 9, 100, 42, -117, -88, -42, 114, 106,
+        90, 95, -34, -127, 13, 44, -94, -11, -87, 25, 81, 65, 74, -127, -126, 74,
+        76, 49, -59, 18, -58, 91, 86, -53, 38, 110, 113, -1, -15, 59, 111, 113,
+        -21, -5, -30, -83, -46, -57, -77, 87, -53, 50, 73, 26, 47, 101, -67, 79,
+        -14, -99, -99, 110, -114, -66, 2, -96, -2, -73, 58, -51, -104, -25, -20, 70,
+        33, 56, 87, 14, 3, -106, -100, -116, -91, -64, -40, 33, -60, -91, 21, 79,
+        -31, -13, -39, -13, -7, 37, -113, 120, 117, -14, -106, -39, 33, -22, 119, -90,
+        -94, -14, -82, -67, 48, 69, 48, 30, -106, 51, 96, -103, 90, 127, -42, -36,
+        -12, -123, -117, 12, -45, -120, 104, -102, -119, -120, 41, 116, -36, 106, 11, 79,
+        -117, 24, 90, 95, -72, 59, -72, 20, -78, 126, 103, -71, -90, 3, -32, -54,
+        -66, -18, -6, 0, -46, -102, 38, 99, 103, -35, -31, 122, -1, 126, -71, 21,
+        -10, -31, -88, -79, -36, 124, 35, -2, 127, -72, -26, -5, -81, -28, 83, -10,
+        103, -9, -74, 104, 73, -47, 35, -98, 20, -67, -71, -4, -116, 19, -23, -34,
+        2, 82, 39, 104, 114, -110, -66, 19, 82, -63, 42, 48, 19, -112, 89, -103,
+        3, -108, -35, 94, -24, 54, -91, 70, 9, -25, 34, 19, -90, 26, -30, 18,
+        65, -115, -49, -38, 10, -110, 100, -96, 123, 92, -56, 10, -24, -96, 60, 70,
+        3, 61, 43, -110, -98, 89, -18, 31, 29, -67, -120, 26, -83, -92, -58, -22,
+        -112, 43, 115, 20, -118, 98, 100, 102, 61, 36, 86, -127, -57, -56, -78, 90,
+        95, 60, -65, 68, 69, -116, -10, 82, 108, 119, 116, -6, -28, -18, 94, 92,
+        10, -91, -50, -109, -58, -128, 18, -30, -80, -103, -99, -116, 92, 63, 80, -73,
+        -110, 96, -54, 53, -74, -50, 60, 85, -83, -90, 81, 38, 99, 121, 52, -103,
+        50, 58, -59, 60, -19, 90, 89, -63, -100, -110, -96, 27, -49, 111, -32, 113,
+        105, -63, -56, 34, -14, 57, 75, 27, -99, -101, 23, 39, -115, -99, -50, 101,
+        -20, 64, 99, -101, -13, -53, -117, 19, -36, -26, 6, 125, -79, -65, 66, 21,
+        113, 89, -76, -52, -106, 35, -33, 9, -22, 14, -28, -34, -72, 89, -20, -128,
+        112, 92, -93, 31, -115, -64, 14, -55, 36, -34, -91, 81, 77, -8, 45, -88,
+        48, -76, -77, 79, -82, 90, 31, 38, 38, 53, -42, -89, 112, -81, 15, 72,
+        64, -101, -114, 83, -128, -59, -2, -45, -96, 18, -101, 92, -104, -113, -54, 1,
+        -22, -87, -48, 74, -33, -9, 13, -60, -86, 21, 45, -112, 1, 56, 58, -22,
+        24, 60, -43, -16, -89, 42, -120, -83, -51, 62, -80, 56, 94, -114, -73, 100,
+        -111, -21, 120, 111, -61, -115, -4, -120, 31, -2, -31, 95, 65, -124, -18, 55,
+        33, -65, 108, 66, -2, 3, -69, 48, 67, 79, -23, 52, 95, 40, 3, 119,
+        89, 25, -81, 22, -41, -115, -16, -40, 102, 49, 122, 13, 30, 34, 90, 59,
+        68, 22, -25, -17, -104, 76, -112, -97, 115, -67, -42, -80, 46, -72, -55, 24,
+        83, 41, 100, -113, -113, 51, -97, -3, 21, -40, 2, 96, 31, -59, -84, 100,
+        126, 30, -41, -65, 22, 28, -71, -120, -112, 29, 120, -62, -34, -60, -91, -54,
+        47, 122, 116, 20, 11, -89, 47, 60, 121, 19, -123, -128, 14, 77, 4, -124,
+        -47, 36, -39, 34, 94, 3, 95, -116, 70, -106, -65, 22, -25, 60, -17, 46,
+        -55, -99, 45, -120, -60, -100, 35, 115, -90, -78, -34, -94, 94, -99, -9, -44,
+        19, -5, 39, -7, 5, 125, 4, 59, 86, 24, -99, 53, -116, 20, -69, -93,
+        38, -60, -13, 113, 85, 12, -28, 29, 43, -52, -17, 71, 91, 17, -15, -12,
+        -87, 29, -22, 91, 6, 96, -38, -126, -6, 3, 107, -28, 45, -21, -87, -23,
+        -15, -20, 97, -13, -112, -56, -53, -33, -65, 75, 52, 74, 115, 52, 109, -93,
+        -34, -81, 63, -12, 75, 87, -121, -42, -30, 81, -43, -21, -31, -1, 40, 102,
+        -123, 5, 13, 109, 32, 82, 12, 29, -70, -109, -102, 44, -80, -89, -119, 73,
+        76, -74, 22, 49, -111, 16, -65, 7, 53, 17, -44, 35, -114, 30, -74, 19,
+        -105, 116, 34, 69, -111, -87, -111, -99, 69, 126, -125, -43, -14, 122, 44, -46,
+        66, -128, 95, 8, 27, -30, -115, -99, -37, -91, -47, 122, -51, -101, 98, 124,
+        108, -37, 75, -112, 43, 89, -121, -92, -57, -79, 42, -68, -53, -25, -94, 56,
+        -55, -25, 86, -95, 40, -95, -53, -113, -65, -27, -23, 127, -33, -94, -71, -93,
+        89, -91, 121, -19, 65, 107, 84, -29, 77, 101, 91, 25, -48, -99, 102, 17,
+        69, 90, -78, 84, 9, -110, 64, 73, 49, 29, -17, 96, -123, 101, 78, 50,
+        -36, -96, -27, 13, -4, 57, 33, 47, -72, 13, 94, 71, 110, -58, -109, -22,
+        76, 62, -100, 28, 29, 21, 103, 100, -118, 81, 15, -47, -16, 8, 9, -71,
+        -94, -36, 108, 98, 104, 25, -32, -93, -1, -75, 86, -123, 38, -82, -105, 7,
+        -114, -10, -4, 35, -35, -99, 52, 42, 1, -25, -30, -5, -20, -1, -115, -84,
+        14, 44, 15, -4, 71, -68, 89, 122, 83, -84, -1, -61, 16, -40, -4, -40,
+        87, -127, 98, 123, 55, 77, -104, 100, 117, 127, 65, -14, 26, 15, 11, -21,
+        -11, 15, -20, -11, -46, 122, -3, 19, 123, 125, 99, -67, 126, -49, 94, 103,
+        -42, -21, 115, -10, 122, -42, 88, 90, -21, -60, 116, -121, -6, -94, 43, 26,
+        -68, -23, 100, -41, -95, -124, 100, -102, -105, -72, -84, -123, -48, 12, 69, 44,
+        3, 8, -38, 72, -96, -56, -23, 10, 81, -99, 12, -41, 116, 57, -68, 102,
+        -37, -33, 126, -67, -117, 78, -34, -64, 20, 8, 72, -94, -52, -102, -108, 112,
+        -102, 17, 118, -66, 65, -40, -105, 111, 50, -105, 106, -72, 26, 115, 105, -71,
+        102, -118, 42, 104, -116, -127, 22, -101, 12, -42, -75, -73, 23, 76, -3, 21,
+        84, -18, 34, -30, 21, 93, -19, -100, 45, 124, 21, -115, 31, 1, -62, 24,
+        115, -34, -72, 6, 43, -94, -74, -63, -42, -56, 111, 6, 20, 92, 94, 6,
+        48, 14, -78, -56, -88, -128, 108, -44, -61, 102, 28, 22, 83, -77, 29, -102,
+        119, -104, 111, -126, -51, 73, -77, -42, -72, 81, 75, -98, -38, 48, -33, 78,
+        -116, 50, 89, 18, -27, 19, -107, -120, -86, -71, -7, -70, -22, 14, 55, 63,
+        35, -107, -35, -59, 12, 121, 111, 90, -85, 37, 74, 54, -20, 23, -32, 46,
+        -71, -124, -16, 112, -30, 111, 3, 102, 105, -43, -40, 85, -76, -72, -54, -67,
+        76, 90, -26, 19, 102, 15, -29, 0, 80, 120, 88, 5, 58, -70, 14, -53,
+        -19, 78, 28, -77, -49, -119, -112, -26, 86, -70, -84, 31, 59, 29, 76, 93,
+        21, -72, 78, 32, -107, 58, 1, -70, 53, -62, 116, -31, -8, 79, -122, -1,
+        44, -15, 30, -34, 2, 110, -76, 19, 56, 58, 122, -119, -41, 3, 114, -15,
+        71, -105, -46, 66, -27, 16, 10, 79, -35, -123, 86, -116, -70, -58, 10, -50,
+        -44, 29, -107, 106, 61, 35, -32, -58, 124, 43, -115, -9, 40, -127, 86, 83,
+        47, 119, 20, 61, -121, -94, -52, -15, -2, -59, 37, 70, -124, 105, -66, 63,
+        -91, -13, -109, -75, -12, -76, 116, -9, -60, 79, -111, -104, -43, 28, 102, 53,
+        111, -50, 106, -34, 113, -38, -25, 92, 109, -30, 53, -90, 61, -105, 39, -66,
+        112, 23, -115, 91, 38, -49, 74, 79, 92, -13, -97, 11, -123, 74, 115, 66,
+        -84, -24, -123, 123, 21, 84, -105, -53, -42, 46, -69, 80, 10, 99, 13, 27,
+        11, -77, -24, 88, -104, 5, 98, 22, -41, -70, 44, 24, -22, 112, 44, -53,
+        -126, -95, 11, -9, -86, 80, -95, 115, 81, -88, -60, -71, 38, 84, -46, -78,
+        36, -78, -65, 101, 91, 127, -14, 22, -32, -95, 8, -53, 0, 67, 28, -33,
+        -124, 121, -112, -123, 89, 48, 11, -105, -22, -4, 11, 33, 36, 126, 45, 111,
+        -46, 91, 47, -66, 3, 105, 104, -7, -107, -10, 112, 50, 116, 106, 101, -23,
+        93, 74, -101, 111, 41, -72, -34, 37, 70, -12, -114, 30, -74, -28, -87, 39,
+        -17, 57, -28, 27, -111, 32, -85, 18, -78, 44, 19, 93, 52, -123, 49, -94,
+        -113, 82, 72, -84, 32, -55, 70, -122, -77, 123, 101, 56, 117, -105, -74, -80,
+        27, -108, 104, -114, -12, 41, 22, -23, -77, 1, -43, -23, -126, 103, -91, -119,
+        121, -24, 96, -55, -98, 40, -32, 8, -5, 87, 13, -71, -47, 19, 1, 23,
+        -85, 20, -71, 90, -6, -84, 5, 19, 88, -8, -57, 121, -60, 106, -76, -127,
+        103, -66, 34, -54, -59, -103, -89, 14, 70, -97, 120, -84, -37, 108, 44, -108,
+        14, -124, 85, 111, 41, 101, -13, -57, 4, -83, 89, -38, -81, -107, -88, 39,
+        -96, 77, 24, 44, -93, -115, 111, 103, 92, -25, 82, -29, 127, -87, -107, 63,
+        -55, 0, 34, 65, -66, -58, 63, -92, 54, -55, -28, -75, 94, 61, -52, -111,
+        -25, 37, -85, 64, -95, 72, 97, -13, -53, -74, 10, 67, 59, -81, -13, 70,
+        -109, -6, 44, 23, -25, -73, 102, -20, 127, 67, -58, -49, -127, 22, 83, -2,
+        -109, -61, -62, 80, -116, -48, 123, 16, 6, -53, -30, -2, -128, 50, 95, -105,
+        37, -38, -124, 127, 46, 110, 15, -106, -15, 93, 114, -80, 42, -117, -69, 116,
+        -98, -52, 15, -46, -4, 14, 27, -111, 106, -12, -128, 69, 61, 25, 30, 124,
+        -56, -110, -72, -110, -107, 14, -30, 3, 86, -25, -65, -30, -69, -8, -29, -84,
+        76, 87, 53, 85, 71, -41, 1, -121, -18, 84, -109, -11, -39, 40, -72, 73,
+        117, -77, 42, 21, 111, 3, -122, -53, 107, 29, -121, 63, -120, 123, 14, -41,
+        85, -100, -29, -42, -51, -66, -98, 83, -22, 46, -64, -102, -124, 43, 68, -100,
+        28, 42, 17, 25, 79, 19, -74, 42, 63, -42, 7, 105, 5, -77, 92, 21,
+        85, -107, 94, -91, 89, 90, 111, 64, -128, -120, -21, -125, 13, 44, -41, 77,
+        -68, 97, 75, -106, 23, 80, 45, -97, 101, -73, -72, 108, 127, -58, 62, -1,
+        -116, 43, -76, 74, 74, -88, -98, -26, 7, -4, -18, -122, 59, 84, -24, 33,
+        19, 42, 71, 52, -123, -41, 60, -21, 70, -43, 30, 105, -127, -58, -18, 106,
+        35, 11, 0, -26, 74, 93, 65, -123, 74, 7, 124, 113, -82, 39, 87, 124,
+        106, -105, 46, 41, 27, -32, 127, -114, -10, 15, 95, 49, -87, -114, 14, -71,
+        126, -47, -72, -14, -12, 124, -65, 69, 118, -45, -70, 49, -117, 104, 108, 14,
+        49, -83, -47, 0, 94, 99, 93, -45, -128, -79, 57, 21, -85, 84, 95, 51,
+        -63, -38, 53, 27, 105, 37, -18, -75, 108, -78, -99, 108, 48, 2, 45, 112,
+        124, 97, 66, 56, 22, 115, -20, -17, 42, -2, -92, -102, 127, -38, 85, -127,
+        93, 73, -37, 10, -35, 96, 126, 24, -75, -24, -19, -7, -24, -101, -86, 50,
+        14, 117, -70, 38, -111, -123, -117, 52, -44, -126, 58, -67, -104, -38, 13, -126,
+        -103, -73, 123, -24, 0, 112, 57, 107, -47, -92, 63, -115, 14, 115, -19, 102,
+        -78, -47, 85, -108, -17, -2, -40, -50, -91, -26, -95, -35, 36, 70, 105, 37,
+        38, -42, -115, -127, 79, 18, -113, -79, -53, 11, 127, 43, 94, -4, -90, 127,
+        77, -61, 98, -58, -59, 2, 124, 17, -55, -56, 84, 52, 66, -71, 75, 42,
+        -10, 120, 33, -122, 5, 104, -108, -10, 68, -68, 108, 101, 33, 52, -17, -113,
+        41, -100, -113, -43, 63, 25, -33, -56, 15, -16, -44, 120, -22, 11, 44, 111,
+        116, -24, 42, 103, -3, 72, 91, 6, -58, -36, 52, 121, -82, -97, -117, 124,
+        15, -74, -53, -26, -115, -84, 75, -85, 73, 34, -100, 20, 107, 117, 73, -82,
+        79, 59, 74, 45, 110, 105, 98, 106, -44, 18, 43, -81, 87, -84, -25, -11,
+        50, 122, -94, 104, -127, 73, -41, -110, 122, 113, 127, -20, -101, 46, -55, -9,
+        -106, -84, -7, 110, -115, -63, -123, -29, -116, 69, 95, 112, -21, -77, -84, -103,
+        -101, 25, 116, -27, 74, 32, 81, 73, -102, -116, -97, -76, -103, 20, -13, -114,
+        -102, -107, -92, -80, -112, -40, -68, -91, -34, -54, 90, 54, -47, -90, 5, 7,
+        16, -123, -106, -83, -59, 15, -12, -30, 53, -75, -93, -30, 62, -38, 51, 95,
+        59, 18, -90, 56, 120, 46, -8, -120, 24, -106, 98, -71, -42, 92, -53, -72,
+        -58, -56, 14, -58, -127, -123, 34, -82, 86, -108, 3, 99, 34, 15, 122, -8,
+        72, 38, 80, 54, -62, 49, -4, -41, -57, 95, 126, 30, 50, -98, 42, -67,
+        -34, 64, 75, 122, 65, 48, 75, -15, -82, -70, 46, -115, -80, -61, 79, 94,
+        -30, -117, 98, -67, -112, 120, 95, 47, -111, 70, 70, 114, 85, 62, -111, 60,
+        69, -81, -1, -75, -64, 36, 12, -80, -98, 38, -112, 32, -62, 80, -105, -49,
+        29, -107, 4, -92, -75, 84, -7, -38, 35, -58, -14, 53, 19, -76, 40, -125,
+        99, -38, 110, -21, -20, 32, -8, 112, -8, -48, -23, -82, -31, -36, -77, -45,
+        -115, -93, -34, 75, -73, -8, 20, -67, 34, -98, 99, 14, 6, 101, -124, 126,
+        -55, -13, 91, 0, 104, -81, -103, -28, 78, 120, -47, -96, 54, -117, -49, 72,
+        -64, -21, -76, 14, -45, -83, 31, -116, 124, 97, -39, -85, 76, 33, 72, -95,
+        -56, 21, 86, 5, -100, 127, 83, 45, -63, -18, 65, 19, 105, 2, -46, 105,
+        0, -104, -85, -98, 114, -22, 73, -64, 8, 110, -128, -23, 106, 88, -21, -118,
+        -81, -60, 36, 101, 49, 15, -17, -89, -116, -24, 44, -63, 14, 29, -119, 45,
+        122, -67, -27, 86, -116, 66, 63, -128, 14, 70, -6, 126, 79, 47, 48, 45,
+        -8, 110, 39, -100, 62, -70, -9, -56, -79, 46, 97, -84, 75, 53, -42, -91,
+        107, -84, 91, -127, 105, -94, 56, -24, -68, -108, -91, 8, 85, 66, 0, 125,
+        -49, -101, -76, -46, 92, -47, 85, -42, 8, -33, -120, -112, -128, 71, 57, 47,
+        88, 39, 31, -72, -28, 19, 105, -42, 66, -110, 72, -19, 101, 7, 47, -49,
+        73, -94, 35, 103, -26, 98, -65, 38, -7, -96, -31, -117, -1, 25, 73, -97,
+        48, 55, 113, 93, 62, 106, 126, -11, 104, 45, 56, -92, 80, 11, 44, 41,
+        -89, 108, 39, 11, 57, -61, -68, -54, -110, -49, 104, -47, 105, 56, 75, -77,
+        72, -113, 77, 69, -121, 39, 77, 30, -123, 49, 34, 90, -63, -68, -25, 57,
+        -45, -104, 15, -66, -72, 16, 118, -45, 108, 10, -100, -62, -103, -34, -86, -122,
+        -15, -117, -104, 101, 85, -61, 74, 45, -106, -95, 4, -122, -83, -10, -73, 94,
+        44, 61, 20, -102, -29, 18, -43, 107, 54, 125, 125, -118, 20, -106, -128, 127,
+        95, -81, 22, 57, 122, 105, -42, 82, -15, 8, -12, -118, 31, -110, 18, -29,
+        106, -118, 101, 112, 94, -24, 62, 62, -22, -41, -66, 48, 10, -55, -100, 54,
+        108, 1, 88, 50, 116, -125, -42, -118, -105, 45, 4, -36, 55, 68, -123, 38,
+        -41, -128, 1, 61, -60, 41, 43, 29, 51, 61, 55, -50, 9, 44, 16, -5,
+        -72, -64, 95, -91, -27, 123, 102, 106, 2, 75, -70, -91, 120, -120, 5, 92,
+        -67, 79, -13, -28, 19, -58, -128, 103, -106, -65, 42, -58, 66, 23, 112, 119,
+        26, 56, 74, -69, 100, -51, 127, 33, 93, -28, 48, 3, 106, -53, 3, -56,
+        69, -83, -127, 23, -84, 99, 79, -24, -101, 44, -4, 117, -100, 39, -49, 4,
+        118, 121, 116, 116, 104, 5, 42, 20, 32, 43, 17, 6, -79, 20, -28, 69,
+        40, -20, -122, -33, -4, -111, 1, -75, -23, 116, -75, 4, -70, -45, -78, -84,
+        -18, -97, 99, 117, -86, 63, -112, 27, 98, -77, -19, -87, -77, -19, -87, -34,
+        -10, -12, 50, -20, -115, 79, 86, -21, 30, -64, -122, 35, 100, -54, 75, 103,
+        15, 47, -51, -112, 41, 47, 47, -11, -108, 123, -102, -78, 37, -66, -60, -92,
+        -86, -8, 55, 88, 70, -108, -17, 85, 110, -48, -102, 86, -29, 123, -127, -104,
+        49, -79, -119, 105, -59, 98, -93, 110, -52, -98, 51, -26, 17, 112, 127, 53,
+        114, -101, 100, -109, -126, 114, -70, -34, 26, -99, 122, -77, 32, 11, 86, -63,
+        67, 26, -58, 24, 14, 51, -111, -97, 10, 45, -77, 54, -2, 9, -44, 80,
+        5, -9, -24, 56, -87, 68, -95, 57, -11, 59, -9, -78, -128, -26, -16, 21,
+        125, -15, -124, -24, -41, -63, 122, -94, 50, 20, 79, -67, -21, 8, -29, -114,
+        13, 111, -13, -76, 14, -42, 44, 86, 70, -30, 102, 121, 123, 55, 64, -76,
+        -105, -52, -119, 22, -85, 79, -41, 81, 111, -109, -60, 101, 15, 67, -9, 109,
+        -52, -9, -84, 42, 8, 27, -59, 109, 105, -106, 96, -43, -80, 119, -109, -26,
+        -73, 117, -94, 74, 40, 24, 40, -85, 77, 12, -46, 34, 66, -66, -23, 26,
+        -87, 26, 5, 55, 47, -86, 20, -121, 1, 123, 71, -49, 4, -72, 126, 104,
+        -120, -11, 121, -45, -12, 72, 64, 76, 36, -42, -81, -41, -45, 2, 82, 46,
+        -27, 43, -37, -60, 107, -23, 79, -105, -31, 82, -77, 0, -30, 65, 74, 109,
+        47, -96, 59, -68, -41, -65, -45, 64, -87, 4, 84, 94, 39, -97, 24, -78,
+        59, 58, 42, -90, 87, 102, -104, -7, -91, -118, 100, 91, 82, 8, 81, 90,
+        -17, 30, 107, -26, 73, 39, 48, 55, -4, -79, 90, 65, -17, 96, 4, 66,
+        45, -116, -6, 112, -20, -121, 59, -6, 103, 3, 7, 42, -18, -18, 17, 67,
+        74, -67, -67, 93, -127, 96, 5, 29, 87, 90, 108, 40, 92, 83, -118, 14,
+        -64, 101, -56, 67, 123, 125, 96, -23, 104, 9, 85, -98, -15, -97, -29, -97,
+        123, 62, 115, 84, -57, -107, 123, 95, -36, 39, -27, 121, 92, 97, -112, 64,
+        89, -121, -85, 116, -79, 94, 71, 29, -52, -24, 83, 111, 122, -2, -85, 104,
+        -12, -8, -88, 4, -84, 37, -66, 56, 58, -38, -8, 114, -37, 30, -42, 97,
+        -54, -36, 127, -106, 50, -70, 48, -122, -118, -82, -34, 20, -39, 60, 92, 104,
+        46, 103, -53, 100, -10, -123, 54, -27, 13, 124, 109, -2, 75, -2, 107, 58,
+        -5, 18, -33, 20, -73, -7, -66, 119, -85, -79, 5, 92, -48, -2, 53, -75,
+        -25, 11, -44, -109, 97, 110, -85, 30, -49, 71, 81, 69, 63, -59, -11, 114,
+        72, 33, 13, -75, 120, 69, 50, -82, -16, -15, -8, 4, -107, 29, -43, -85,
+        20, 72, -20, -1, -42, -22, -90, -57, 24, 0, 5, -27, -123, 17, 49, -56,
+        56, 53, -102, 111, 98, 78, 8, -114, -2, 47, -64, -99, 94, 103, -59, 61,
+        0, 105, -101, 108, 37, 18, 35, -80, 41, -107, 90, -32, 76, -98, 39, -93,
+        84, 46, 46, 95, -46, -43, -9, 105, 89, -111, 9, 50, 122, 93, 19, -104,
+        16, -69, 43, -57, 80, -93, 49, 5, 90, -43, -102, -51, -34, -57, -99, -83,
+        74, 39, -8, 97, 12, -79, 95, -104, 33, -59, 74, -50, 0, 45, 27, 85,
+        -2, 116, 102, 121, 80, 93, -88, 80, 5, -105, -128, -67, -42, 103, -123, -116,
+        -55, -52, -13, -8, 120, -91, -5, 16, 78, 105, 97, -29, -85, -54, 43, 59,
+        14, -107, 15, -101, 17, -114, -121, -93, -79, -33, 47, 80, 126, -41, -58, 46,
+        -3, -117, 26, -117, -1, 87, 12, 44, 5, -32, -44, -66, -14, 86, -32, 36,
+        73, -32, -7, 64, 54, 56, 16, 16, -14, 80, 95, 96, -67, 98, 81, -85,
+        42, -116, -62, -103, -120, -33, -98, 14, 1, 105, 69, -36, -60, 94, 113, 6,
+        69, -76, 114, -51, -65, 71, -100, -21, -92, -15, 97, -60, 9, -113, -113, 45,
+        5, 48, 107, -59, 51, 83, 0, 75, 126, -69, -123, 111, -31, -85, 60, -26,
+        -59, -34, 113, -86, 106, 35, 82, 2, -51, -24, 123, -31, 125, -73, -1, -126,
+        90, -10, -71, 62, 14, 76, 12, 96, -125, 125, 18, 42, 35, 123, 98, -123,
+        -31, -106, -55, 13, -77, -94, 3, -98, -74, -116, -103, -38, 16, 62, -47, -46,
+        18, -59, 30, -32, -30, 56, 20, 34, -22, -43, 60, -54, -48, 39, -111, -58,
+        -114, 104, -91, 122, 98, 110, 18, -101, -90, -24, -7, -128, 41, -88, 111, 6,
+        -16, 73, -111, -80, 99, -38, 2, 0, 8, 60, 24, -121, 35, -99, -28, -79,
+        77, -86, 46, -121, -59, -118, 72, 37, -22, -95, -21, 62, 96, 45, -106, 41,
+        119, -94, 46, -12, -110, -55, 12, -93, 122, -52, 6, 3, 97, 91, -68, -20,
+        39, -57, -29, 81, -65, -39, 23, 63, 33, -36, 63, 115, 48, -98, -28, 109,
+        114, 60, 37, 10, 44, -97, -51, -4, -96, -57, 3, -52, -76, 100, 96, -61,
+        -118, -3, -88, 60, 62, 17, 58, -21, -116, 28, 58, -111, -81, -121, -15, -90,
+        -62, 115, 116, -64, 7, -34, -113, -91, 47, -23, 92, -2, -2, 28, 104, 53,
+        91, 106, -60, 92, 45, 60, 41, -56, -19, 114, 1, -53, 10, -97, -35, 106,
+        41, 106, -2, -14, 71, 114, -44, 21, 66, -55, -57, -69, 5, -58, -27, -24,
+        2, 91, -35, 12, -40, 112, -94, -2, -7, -93, -57, 56, 1, 25, 0, 32,
+        -34, -93, -78, -116, 7, 48, -87, -115, 48, -69, 86, 111, 65, -6, -116, -84,
+        36, -85, -114, 62, -126, -72, -93, -50, 93, -102, -36, 83, -58, -71, 30, 112,
+        30, 7, -67, 126, -38, -17, -63, -65, -79, -81, -71, 84, -82, 97, -10, -116,
+        89, -126, -13, -5, 99, 50, 30, -69, 80, 18, 94, 6, -81, 1, 118, 126,
+        124, 55, 30, 123, 50, 63, 8, 70, 50, 90, 101, -15, 44, -15, -114, -113,
+        -14, -85, 106, 53, 57, 94, 4, -67, -93, 63, -115, 95, -114, 38, 60, 126,
+        69, 18, -115, 40, 24, -81, -84, -73, -66, -55, -14, 10, -40, -59, -70, 94,
+        -123, -1, 60, -2, -25, -15, -3, -3, -3, -16, -2, -7, -80, 40, 23, -1,
+        60, 62, 25, -115, 70, -1, 60, -82, -18, 22, -67, 99, 61, 73, -105, 82,
+        -56, -100, 0, 104, -10, -5, -55, -12, -49, -44, 75, -72, 6, -110, -11, -123,
+        -9, 117, -84, -11, 116, 60, -2, -18, -69, -17, -114, -87, -76, 119, -64, -86,
+        66, -89, -1, -82, 100, 85, 122, 26, -50, -109, -69, -34, -97, -61, 90, 115,
+        -9, 76, 35, 47, -91, -76, -93, -6, 96, -61, -97, 63, -2, 19, 32, -65,
+        -121, -125, 2, -94, -30, -85, 98, 42, 8, -67, 127, -34, -9, 67, -8, 47,
+        -22, -7, 88, -29, 127, -115, -83, 8, -72, 98, 117, 93, -53, -54, -20, 17,
+        -112, -123, -82, 69, 26, 19, 91, -107, -86, -71, 33, -61, -80, -103, 57, 6,
+        -59, -73, 113, 27, -84, 106, -43, 121, 64, -42, 34, 79, 16, -72, 61, -68,
+        81, 99, 55, 117, 26, -56, -125, -40, 91, -93, 75, 32, 105, -78, 63, -3,
+        -12, 30, 113, 61, -16, 121, -1, -109, -108, 62, 105, 82, -24, -9, -81, -126,
+        -103, 78, -51, 11, 25, 7, -20, 96, 44, 13, 61, 90, 64, 126, -69, -38,
+        -57, 103, -1, -21, -126, -115, -83, 103, 101, 81, 85, -53, 24, -8, -98, -10,
+        -104, -49, 123, -12, -77, 49, -6, -119, -65, 38, -72, 9, -122, -78, -92, -96,
+        103, -127, 21, -5, -127, -89, 8, -29, 1, -47, 38, -116, -34, -83, -128, 117,
+        41, 16, -87, 10, 105, 109, 8, 91, -126, 81, -61, 27, -7, -34, -11, 96,
+        13, 28, 37, 80, -34, -71, 0, -16, 113, 66, 118, -3, 30, -2, -79, 106,
+        -62, 121, 31, -100, -114, 48, -19, -107, -93, 108, -36, 85, 120, -62, 11, 97,
+        57, -127, 20, -77, 15, -92, -51, 122, 27, -88, -122, 25, -16, 2, 87, -39,
+        -72, -85, -16, -124, 23, 42, 48, 1, -88, -2, 91, -103, 57, -96, -124, -95,
+        112, 6, 68, 92, -114, -85, 85, -12, 101, 1, 120, -46, -93, -11, 13, -20,
+        -103, 7, -36, 78, -64, 66, 43, -11, -46, -101, 120, -111, -32, 81, -17, -61,
+        49, -98, -32, -122, -64, 80, -94, -37, -6, 122, -16, 109, 79, 101, 127, -5,
+        -37, 95, -33, 15, 103, 37, 80, -66, -28, 23, 74, -45, 9, -49, 58, 12,
+        -93, 108, -16, -73, -65, -2, -40, -51, -91, -119, -66, 112, 20, 31, -54, -30,
+        38, -83, 18, 51, 96, 17, -113, 50, 79, -30, 72, 61, -83, -39, 9, 4,
+        -47, -127, 51, -64, 113, 35, -40, 67, 56, -98, 36, -42, -44, -53, 104, 94,
+        -52, 72, 85, -62, -57, -53, -95, -38, 67, -45, -126, -69, -72, -94, -16, 77,
+        -44, 95, -44, -20, -17, 89, -123, -10, 76, 68, 47, 84, 20, 59, 51, -58,
+        95, -110, -3, -93, -116, 87, 60, 106, 2, 79, 110, 0, 98, -24, -77, -118,
+        -57, -89, -73, -45, 20, -60, -69, -46, 20, -76, 86, 8, -14, -88, 36, -3,
+        34, 48, 32, 24, 14, -94, 119, 2, 98, 37, 112, 40, 24, 96, -98, 18,
+        126, 71, 69, -64, -98, 100, -62, 82, 62, 51, 109, 26, -49, 42, -74, 44,
+        25, -13, 81, 86, -32, 80, -79, -20, 25, 44, -83, 35, 46, -51, -30, -24,
+        72, -93, 92, 15, -20, 78, 65, 47, 31, -98, -45, -65, 120, -95, -57, -5,
+        -56, -125, 44, 120, 96, -70, -60, 115, 12, 121, -126, 57, 112, -40, -29, 91,
+        16, -108, -14, 10, -29, -15, 81, -58, -14, -55, -110, -7, 127, -16, 61, 66,
+        123, -27, -101, -22, -41, -126, 64, -111, 21, 22, -80, 127, 65, -22, 61, 92,
+        -63, -85, 112, -74, 101, -41, 112, -100, 125, 99, 97, -67, 12, 56, 13, 122,
+        -3, 36, -97, 1, 98, 6, -96, -61, -116, -109, -128, -68, 97, -89, 50, -111,
+        -96, -9, 71, -84, 59, -127, 37, 69, -124, -11, 75, -103, 46, -46, 60, -22,
+        -59, 121, -111, 111, 48, -12, 95, 47, 88, 12, -117, 28, -40, -114, -71, -50,
+        33, 81, -122, 74, 100, -43, -88, -79, -73, -128, -27, 28, -95, 88, 39, 6,
+        42, -48, -79, 49, 116, 49, -30, 90, 31, 113, 2, 117, 106, 10, 123, -126,
+        -89, -124, 31, -80, 21, 80, 54, -86, -97, -34, 44, 96, -48, -104, 33, 6,
+        78, -49, 98, 88, -107, -77, 104, -66, -43, 3, -86, 37, -21, 85, 81, -42,
+        64, 76, -2, -2, -105, -74, -45, 14, -53, -65, 88, 36, 37, -26, -118, -57,
+        105, 112, 23, 66, 66, 16, -30, -62, -62, -54, 75, 94, 23, 69, -122, 89,
+        116, 88, -25, 88, 23, 33, 39, 65, -29, -123, -96, -121, -113, -67, -26, 0,
+        62, 56, -120, -79, 78, -108, 38, 50, -77, 17, 76, -56, -13, 81, -32, -56,
+        -51, 43, 66, 70, 121, -109, 33, -101, 51, -35, -38, -32, 114, 77, -30, 105,
+        30, -33, -91, -117, 24, 72, 4, -84, -26, -57, -8, 46, -7, -91, -4, 101,
+        -107, -28, -76, -86, 113, -96, -21, -106, 105, -8, 63, -66, -19, -9, -122, -76,
+        -126, 97, -35, -104, 124, 74, -11, -69, 102, 11, 45, -11, -39, 82, 71, -82,
+        21, 63, -1, -8, -9, 61, -46, -44, -15, -104, -66, 72, -1, -80, 83, 36,
+        -109, 20, 21, -121, 69, -32, 123, -101, 100, -23, 77, -118, 42, -44, 82, 41,
+        103, -85, 41, 112, -106, 97, 69, -114, 66, -88, 63, 80, -107, 114, 85, -87,
+        -104, -10, -2, -103, -9, 66, -52, -43, 46, 52, 24, -113, -113, -64, 104, 101,
+        -90, 29, 59, 59, 66, 104, -80, 30, -52, -16, -97, 57, -26, 86, 67, 49,
+        -61, 12, -29, -47, 126, 115, 72, -14, 107, -74, -81, -4, -102, -8, 34, -40,
+        71, -80, 98, -22, -98, -101, 120, 13, -76, 123, -107, 109, 60, 124, 12, 110,
+        -67, -76, -61, -76, 19, -95, 99, 106, -124, -115, 12, 71, 100, -23, -119, 89,
+        -10, -32, -92, -2, 67, -109, 11, -103, -10, -15, -115, -95, 125, -76, -9, 33,
+        -123, -39, -110, 123, -87, 35, 50, 23, -99, 97, -61, 110, 54, 115, -7, 106,
+        90, 47, -35, 6, 6, -58, 39, 44, 89, 80, 16, 42, 85, 97, 99, -22,
+        -41, -55, 22, 67, -36, -52, 37, 50, 23, 103, 107, -128, -120, 73, 26, -59,
+        -38, -25, -72, 61, 7, -110, -24, -50, -100, 119, 117, 112, 31, 102, 91, 97,
+        -30, 25, 93, 13, -59, -75, 71, -93, -81, 64, -67, 64, -67, 39, -47, 85,
+        -98, -8, 112, 4, -116, 45, 105, -126, 38, -122, -86, 57, 115, -87, -102, 61,
+        123, -23, -20, -85, -76, 105, 26, -75, 86, -127, -7, -124, -78, -48, -72, -97,
+        67, -34, 41, -78, -118, 116, -29, 85, 71, -103, 91, 47, -110, -6, -44, 85,
+        58, -4, 55, 44, -110, 7, 18, 28, -128, 25, -46, 52, 110, 13, -106, -6,
+        -45, 52, 76, -121, -43, 42, 75, 107, 15, 24, 119, 86, 11, -93, 68, -34,
+        68, -26, 65, -127, -35, 95, -54, -63, -15, 44, -69, 51, -31, 27, 67, -51,
+        74, -68, -53, 100, -58, -83, 15, -20, 111, 100, 64, -71, -120, -107, -6, -8,
+        120, -53, 110, -4, -68, 85, -61, -25, 74, -58, -14, -20, -23, 23, -7, -62,
+        -5, 80, -9, 32, -96, -24, 107, -28, -93, -62, -18, -83, -18, -48, -16, 0,
+        -3, 83, 48, 107, -71, 97, 1, 50, -83, -94, 84, -70, -101, -58, -105, -61,
+        117, 120, -35, 52, -25, 36, -43, -83, 94, 109, -86, 63, 80, 60, 90, 92,
+        58, -102, 56, 38, 119, -90, -119, 123, -13, -88, 10, 118, -61, 8, 103, 13,
+        -26, -66, 12, 95, 49, 30, 77, -77, 78, -12, 60, -85, -18, -122, -58, 69,
+        15, 48, 39, -95, -74, 111, 21, -52, 42, -84, -102, -5, -26, -37, -47, 13,
+        26, 56, 80, -69, 121, 101, 74, 41, 92, 52, 115, -63, -4, -91, 114, -86,
+        71, -109, -9, 28, 22, -90, -112, 107, -95, -101, -66, -25, -62, -12, 61, 31,
+        110, -124, 75, 51, 55, 41, 68, -25, 52, -88, -68, -35, 122, -122, 1, -85,
+        -66, 70, -122, 81, -82, -53, -38, 85, -123, 104, 70, -19, -1, 112, 69, 28,
+        17, -1, -128, 61, 49, -27, -54, -120, -97, -19, -82, -11, -61, 94, -75, -34,
+        -17, 85, -21, -100, -41, -14, 3, 79, -9, -76, -22, -98, -92, 86, -15, -1,
+        -61, 9, -2, -12, 31, 89, 6, -61, -57, 35, 115, 106, 3, 119, -52, 84,
+        -53, -89, -38, -3, 105, -103, 87, 85, 124, 91, 97, -88, 6, 106, -38, 110,
+        -119, 115, -34, 78, 100, 95, -69, -50, -33, 50, -119, 49, -15, -103, -80, 48,
+        12, 118, 108, -17, -44, -29, 61, -29, 53, 103, 122, 115, 123, -45, -109, -29,
+        -18, -3, -9, 88, 123, -72, 73, -26, 105, -100, -21, -91, -49, -11, 82, 64,
+        28, -44, -40, 15, -9, 56, 56, -22, -93, 5, -16, -118, 90, 55, 24, -57,
+        93, 123, -52, -118, 123, -19, 105, -106, 21, 85, 66, 95, -40, -79, 87, 93,
+        115, -46, 6, -102, -70, 56, 43, -58, -102, 112, -113, -109, 41, -5, 19, 74,
+        107, 85, 25, -116, -43, -9, -5, -64, -66, -72, 120, -105, -93, 35, -2, 41,
+        7, 125, -102, 58, -34, 57, 59, 71, 38, 45, 115, -121, 44, 125, 34, 32,
+        -112, -103, 16, -26, 111, -73, 0, 11, -83, -112, 28, -45, 119, 125, 116, 122,
+        67, 101, -95, -25, 33, -31, -14, 109, -96, -26, -92, 28, -56, 78, 19, -81,
+        7, 18, -81, 38, -105, -82, 65, -32, 60, -25, -3, 104, -58, -34, -28, 34,
+        -110, -112, 37, 23, 48, -79, 17, 89, -101, 99, -104, -40, -28, -64, 80, 109,
+        -72, 5, -56, -34, 63, 111, -81, 19, 16, -54, -5, 115, 63, -120, 53, 78,
+        -79, 117, -75, 52, -87, 2, 30, 53, 25, -54, 26, 76, -9, 29, 108, -101,
+        -58, 34, -18, -95, 57, -41, -78, 76, -82, -93, 26, -19, -94, 120, 103, -111,
+        39, -68, 27, 26, 98, -110, -33, 79, 3, -39, -37, 85, 49, -33, 32, -89,
+        -98, -28, -13, 115, -116, -87, -115, 78, 110, -15, 112, -106, -63, 9, 3, 124,
+        100, 86, 99, -79, -17, 69, 53, 117, -119, -16, -9, -74, 75, 4, 28, 125,
+        -5, 53, 66, -110, -31, 37, 48, -122, -100, -106, -105, 10, -100, 117, 17, 1,
+        79, -55, -19, 97, -99, 84, 42, 54, -33, 27, 47, -31, 29, 17, 63, -63,
+        -51, 14, 43, 11, 98, -92, -23, 121, -43, -58, -46, 106, -50, 8, -121, 85,
+        -57, 125, 78, -57, -89, -20, 30, -7, 55, -15, -93, 6, -53, -125, 62, -14,
+        -9, 37, 8, 114, -25, -110, -51, 117, 119, -68, -85, 21, -97, 56, -91, 111,
+        -27, -115, -124, 123, -107, -10, -114, 44, 32, -80, 64, -60, 53, -75, 58, 22,
+        54, 36, -52, 93, -89, -72, -66, -2, 28, -115, 66, -11, -69, 50, 110, -24,
+        89, 72, -45, 62, 55, 126, -92, 10, -14, 87, -33, -22, 24, -1, 121, 67,
+        -87, 49, -43, 13, 21, -77, 61, 22, 20, -61, 88, -36, 72, 68, -89, -81,
+        92, 20, -79, 106, -53, -16, -69, 84, -18, -112, 106, 9, -65, -25, 17, 77,
+        -19, -71, 102, 122, 58, 95, 25, -10, -44, 108, -57, -94, -99, -18, 108, -55,
+        -125, -94, -22, 109, -7, 5, 109, -43, -39, -106, 37, 17, -42, -38, -67, 81,
+        -71, 68, -93, -10, 21, 100, -71, 81, -69, -42, -49, -128, 33, 103, -89, -20,
+        6, 115, 116, -39, -24, 87, -113, -23, -29, 30, -103, -78, 67, -7, -33, 61,
+        -116, 30, 54, 109, -5, 84, -61, -100, -29, -103, 84, -119, 58, -101, -96, 26,
+        -12, 120, 60, -30, 16, -41, -24, 112, 119, -29, -58, 120, 25, -120, 118, 44,
+        37, -41, -65, 82, 59, 90, -110, -26, 10, 57, -18, 50, -15, 68, -111, -109,
+        -64, -18, 43, 23, -5, -22, -102, 66, 113, -93, 15, -87, 43, -31, -16, -102,
+        -11, 73, 10, 96, 52, 77, 11, 123, -14, 118, -37, 107, 70, 117, -25, -72,
+        -128, 95, -19, -10, -126, 3, 21, -25, -38, 89, -25, 115, -48, -13, 81, 109,
+        -59, 108, -97, 59, -57, 64, -79, 122, -85, -63, 98, -9, 88, 26, -41, -16,
+        -97, -16, -110, -65, 49, 28, 119, 53, 49, -94, 73, 74, 87, -48, -79, 18,
+        -57, 120, -4, 18, -118, -67, 104, 33, 67, 35, 56, -69, -26, 127, -91, 85,
+        -63, -92, 27, -46, -86, -101, 54, -21, -75, 40, 123, -99, -49, -55, -123, -41,
+        -61, 120, -69, 100, 112, 80, 107, 24, 94, 24, 8, 7, -19, 105, 43, -76,
+        -6, -90, -101, -76, 48, -60, -87, 53, -72, -57, -9, -109, 74, -9, 8, 96,
+        62, 6, -123, -18, 69, -64, 39, 81, 96, 68, -87, 58, -83, -77, 68, 40,
+        -36, 31, -74, 19, 107, 35, -103, -37, 53, 33, 15, 82, -90, -104, 8, -82,
+        -67, -78, -62, 111, 89, 3, -71, -19, 104, -59, 113, 91, -42, 64, 108, 29,
+        -19, 56, 94, -53, -76, -84, -37, -69, 62, -13, 15, -98, -27, 25, -72, -96,
+        -118, 101, 94, -19, -22, -97, -41, -47, -120, -98, 107, -121, -57, 124, -121, -31,
+        -121, 123, 63, 11, -76, -39, -127, -63, 86, -49, 96, 103, -125, -116, 28, 43,
+        -108, 99, -99, 109, -50, 6, 59, -93, 5, -38, 94, -18, 113, -120, -80, 73,
+        111, -117, -31, -17, 18, 35, 40, 119, -19, -80, 116, 59, -23, 59, 63, 40,
+        51, -66, 43, 50, -36, -41, -83, 30, 26, 100, -50, -17, 123, 90, 92, -14,
+        -70, -115, -66, 43, -53, 94, -71, 112, 21, -61, -106, -31, -96, -93, 112, -128,
+        17, -55, 59, 6, -6, -103, -39, 26, -74, -82, -99, 30, 125, 92, -124, 123,
+        87, 65, -56, -99, -51, -38, -29, -110, -17, -88, -34, 76, 6, -65, -93, 1,
+        -121, 65, 21, -37, -68, -93, 62, 11, 119, 46, 0, -79, 109, -13, 9, -113,
+        30, -12, -6, 93, 29, -15, 46, -24, -114, 11, -79, -32, 12, 69, 36, -4,
+        -79, 100, -63, -27, 90, 105, 23, 90, 58, 9, 3, 37, -75, 101, -64, 7,
+        125, -120, -25, 100, -124, 70, -88, 12, 119, 48, 88, 112, 0, 100, 70, 68,
+        42, 85, 64, 60, 87, 60, 67, -65, -34, -63, -78, 125, 26, -52, 21, -85,
+        -25, 102, 13, -6, 70, -115, -42, -2, -40, -30, -115, 90, -56, 53, -73, -98,
+        96, 18, 0, 55, 71, 99, 15, -16, -25, 47, -16, -121, 85, 70, 91, 92,
+        -15, 5, 42, -60, -11, -104, -74, -42, -26, 70, 78, 97, -54, 127, 8, -78,
+        -98, 26, 38, 106, 77, 52, -46, 101, -86, -58, 81, 62, 55, -89, 15, -78,
+        104, 111, -125, -4, -87, -2, 16, 62, 108, 3, -3, 58, -122, 51, 15, 120,
+        37, 99, 28, 109, 46, -77, 25, -17, -126, -37, -88, -127, -46, -19, 122, -4,
+        32, -84, -94, 6, 18, 55, 107, -118, -73, -63, 117, -92, -93, -18, -57, -57,
+        -7, 14, -2, -105, 31, -100, 117, -92, -48, 119, 119, 35, 81, 43, -72, -118,
+        -26, 110, 104, 12, -18, -92, 123, 91, 112, 99, -58, 50, -103, 55, -75, -58,
+        -45, -71, -111, -123, -99, 25, 25, -121, 119, -62, -126, -9, 6, 118, -31, 21,
+        -4, -29, -35, 68, 119, -66, 48, -13, -35, 68, 55, -81, -58, -45, -101, -63,
+        56, -68, -103, 20, -38, 48, 20, 74, 102, -105, 85, 105, -18, 109, -126, -69,
+        -63, 24, -81, -105, -82, -6, -91, 55, 10, 10, 31, -80, -75, 123, 122, -4,
+        -92, -80, 123, 7, 119, -81, 55, 90, 63, -35, -67, 72, -90, -31, 94, -55,
+        -48, 50, 58, -54, -43, -96, -12, -86, 61, -122, 50, 25, 49, 91, 107, -68,
+        -77, -69, 59, 58, 42, -114, -47, -74, -21, -118, 61, -29, -110, 100, -50, 65,
+        -98, 8, -85, -8, 92, -55, -40, -22, 118, 40, 14, -26, -83, -41, 65, 25,
+        28, -116, 101, -80, 64, -103, -2, 62, 58, -7, 118, 50, 111, 51, -4, 71,
+        99, 44, -88, 113, -30, 7, -13, 54, 106, 113, 116, 36, -28, -44, -71, -101,
+        -114, 97, 23, 125, -35, 10, 112, -66, -101, -126, -8, 125, -8, 36, 0, 53,
+        124, -4, 94, 39, -91, 11, -96, -100, -13, 14, -54, 103, -107, 17, 114, -48,
+        43, 24, -51, 77, -5, -22, -15, 40, 68, 75, -97, 77, -92, 92, 85, -38,
+        108, -27, 97, -54, -102, -103, -4, -18, -102, 50, -96, -83, -21, 84, -24, -101,
+        -41, 97, -33, 15, 112, 4, 16, -18, -121, -115, -22, 46, -21, 121, 86, 25,
+        -74, 120, 70, 44, -10, -68, -43, 105, -126, 1, -22, 23, -117, -11, -39, 12,
+        -41, -64, -53, -28, -116, -111, -23, 2, -36, -49, -3, -5, -127, -73, 99, -5,
+        -89, -42, -98, 112, -115, -60, -68, 73, 120, -56, -22, -104, 75, 123, -125, -109,
+        16, 69, 69, -28, 83, 54, -35, 76, 9, 103, 27, -16, 126, 16, -35, 37,
+        -90, 47, 65, 54, -67, 86, -20, -54, 66, 103, 70, 110, 53, -66, -63, -68,
+        84, 92, -7, 83, -40, -84, -7, 30, -105, -58, -45, -43, -123, -102, 17, 32,
+        -98, 79, -3, 106, 48, -66, 12, 87, 23, 21, -4, 19, -92, -43, -121, 44,
+        78, 115, 92, -55, 16, 88, 90, -55, 123, 120, -11, -76, -55, 126, -48, 90,
+        30, -12, 28, -116, 9, 49, -83, -94, -36, -17, -81, -73, 60, -127, 19, -110,
+        -59, 47, 126, -16, 101, 8, 88, -90, 71, 58, -66, -98, 105, 38, -121, 119,
+        -29, -30, 89, -59, 48, -102, -101, 26, -102, -28, -114, -56, -97, 58, 62, -25,
+        -40, -109, 48, -127, 96, -90, 95, 67, 24, 117, -70, -56, 61, 32, 123, -13,
+        -32, -127, 70, -62, 47, -88, 97, 44, 123, -11, 7, 68, 56, 39, -49, -4,
+        -124, -30, -111, 6, -100, 39, 127, -35, -94, 8, -3, -7, -93, 118, 52, 63,
+        -2, -3, 47, 63, 127, 12, 122, -116, 57, -9, 39, -81, 9, 4, -56, 68,
+        42, -81, 45, 31, 39, 6, 30, -2, -108, -3, 85, -105, -62, 2, 110, -66,
+        48, -45, 79, 93, 67, -6, -38, 15, 40, 39, -49, -122, 35, 48, -95, 55,
+        -25, 93, 9, 93, -12, 6, -81, 88, -86, -77, 59, -118, -67, 126, -43, -113,
+        74, -54, -25, 91, -64, -37, -32, 11, 72, -120, 95, -50, 34, 40, -102, 124,
+        1, -23, -16, 30, 54, -59, 100, 81, 98, 114, -70, 100, -82, 15, 29, 17,
+        -48, 120, -120, 120, 25, -63, 12, -77, 60, 91, -54, -120, -62, -95, 15, 18,
+        -42, -15, -45, -54, 97, 98, 79, -78, 61, -34, -61, -113, -104, 109, 89, -101,
+        -4, 67, -67, 29, 52, 64, 47, -107, -93, 46, -109, 12, 77, -98, -128, 101,
+        -38, -43, -117, 80, 69, -76, -9, -74, 75, 89, -47, 47, -6, -67, 0, -35,
+        -63, -74, 104, -4, -122, 96, -98, 41, 19, 24, -70, 4, 119, -6, 113, 88,
+        49, 24, -37, -44, 16, 24, -118, 113, -39, -94, -122, -104, 93, -6, -109, -60,
+        -87, 53, 61, 22, 119, 111, 65, 26, 13, -110, -29, -109, -31, -55, -124, 49,
+        -14, 85, -89, 73, -56, -62, -79, 97, 12, 107, -30, 60, 22, -26, -72, 111,
+        21, -41, 32, 93, 42, -108, 99, -33, 69, 65, -34, -98, -8, 119, -110, 71,
+        115, 47, 55, 109, 69, 106, -37, 86, -92, 8, -18, -23, 124, -78, 21, -119,
+        77, -74, -64, -12, 74, -63, -127, 24, -6, 77, 31, -72, -44, -47, -60, 60,
+        91, 57, 94, -30, -34, 70, 34, -14, -49, -15, -119, 82, 14, 46, 28, 105,
+        -80, -40, -121, 87, -47, 66, 10, 35, -29, 83, -32, 83, 41, 77, -41, 36,
+        102, -85, -95, 123, 118, 92, -53, -60, 95, 42, 53, 88, -37, -38, -119, -116,
+        97, 90, -17, -63, -75, -106, 56, 12, -67, -53, -109, -14, 43, 122, -32, -76,
+        68, -49, 61, -42, -35, 3, 27, 56, -91, 30, -93, -7, -82, -31, 120, -24,
+        -44, 115, 5, -76, 51, -19, 39, -3, -123, -12, 56, -71, 101, -124, 44, -41,
+        105, -40, 117, 43, 41, -102, -7, -45, 25, 108, 120, 56, -45, -120, 88, -121,
+        -128, -67, -24, -108, -90, 23, 77, 9, -96, -115, 68, 53, 79, 53, -89, 63,
+        -3, -123, 45, 17, -36, -60, 107, 102, -103, -69, 24, -118, -97, 0, 117, 25,
+        -99, -37, 53, 90, -29, 60, -115, 60, 85, -65, -117, 60, 85, 6, 121, 42,
+        96, 32, -43, -98, -28, 41, -42, -56, 19, -9, -116, 109, -91, 77, 85, 27,
+        109, -126, 41, 93, 117, -112, -89, -36, 7, 14, 79, 17, -91, 28, 22, -89,
+        65, -113, -82, -4, 96, 116, -40, 0, -69, -6, -46, -14, -19, -93, 5, -72,
+        3, 104, 99, -49, -81, -55, 126, -8, -100, -32, -34, 99, -67, -6, 19, -34,
+        -69, 105, 103, 46, 81, 110, -81, -23, -94, -69, -29, -93, -28, -91, -85, -108,
+        -60, 119, -61, 13, -87, -125, -3, 109, -38, -113, -110, 45, -120, -85, -93, -55,
+        -22, 44, 90, -86, 100, 103, 43, 64, -75, -73, -64, 78, 77, 116, 53, 93,
+        -13, 64, -39, -102, -70, -21, 61, 104, 12, 54, 57, 104, -47, -31, 40, -86,
+        -75, -109, -66, 4, -10, -127, 109, 27, -99, 82, -21, 57, -87, -61, 73, -65,
+        -69, 33, 87, -77, 117, -51, -67, -123, -87, 21, 120, -95, -83, -87, -82, -35,
+        -110, 56, -94, -69, -78, -127, 57, 56, 110, -40, -35, 66, 42, -37, 36, -74,
+        -39, -35, -122, -29, -96, 14, -76, 98, 104, -35, 118, -52, 81, 41, -34, -82,
+        5, 118, 97, -20, -63, -75, -65, 101, 39, 118, 52, -23, -66, 100, 107, -25,
+        -98, -112, -85, 115, -35, -128, 49, 92, 112, -41, 126, 35, 69, -80, -83, -55,
+        79, 27, 14, 80, -92, -71, -85, 90, 52, 119, 119, -46, -43, -17, 42, 24,
+        -53, -89, -49, -63, 62, -11, -99, 119, -70, -86, -117, 59, -95, -84, -37, 95,
+        43, 87, 61, 85, 43, -73, 33, -47, -109, 126, 8, -83, -100, -5, -98, -110,
+        73, 113, -52, -61, -45, -68, -1, 31, -102, -2, -91, -34, -107, 52, 110, 10,
+        -70, -82, 60, -125, -114, -17, 4, 120, 65, -108, 3, 76, 52, -71, -17, 14,
+        31, -42, -122, 87, 124, -115, 59, 122, -24, -43, 103, -93, -57, 71, 16, 61,
+        95, 57, -68, -36, 125, -61, -17, -100, 36, -29, -72, 77, -124, -27, -5, 66,
+        33, -66, -94, -92, 95, -74, -41, -28, 87, -101, 66, -124, -114, 91, 53, 40,
+        73, 84, 14, 118, -12, 66, 102, 31, -18, 10, 10, 84, 11, 91, -66, -48,
+        -3, 86, 119, 76, -24, 83, -48, -104, -119, 4, -30, -35, 109, -109, -74, -74,
+        -83, 45, -71, -21, 107, -54, 51, -114, 6, -123, 112, -30, 3, -124, -16, 62,
+        -83, 106, 122, -17, 82, -22, 3, -37, -127, -7, 73, 53, -65, -61, 79, 18,
+        -22, 62, -16, 53, -35, -29, 90, -8, -30, 82, 68, 110, 107, -118, 20, -122,
+        99, -100, 113, 112, -51, -60, -72, 109, 86, 43, 90, 12, 55, 74, 74, -51,
+        -78, 81, 55, -66, -122, -18, -53, 50, 102, 72, 34, -93, -111, 25, 17, -47,
+        -54, 40, 21, 65, -120, 52, 27, -40, -88, -100, -72, 46, 77, -47, 82, -109,
+        7, -86, 117, -38, 49, -26, -125, 104, 76, -39, 111, 93, -41, 95, -38, 16,
+        -102, -47, 4, 52, -10, -86, 40, 75, -26, -24, -9, 85, 119, -17, -69, 29,
+        14, 77, 111, 67, -13, 50, -4, 43, 93, 22, -115, 78, 14, 24, -69, 94,
+        -44, -34, -80, 75, 51, -125, -79, 75, -86, -81, -7, -40, -58, 16, -115, -23,
+        107, 24, 91, -30, -21, -57, 109, 75, -39, -44, -27, 65, 93, -83, -48, 40,
+        -45, 4, 72, 67, -23, -119, -10, -69, -19, -63, 36, 94, 103, -9, -15, -90,
+        -78, -46, 127, -60, 77, 115, -21, 40, 113, 113, -92, -108, -103, 3, 100, 121,
+        84, 79, 111, 6, 99, 32, -37, 107, -8, -75, -18, -113, 3, -54, -101, -74,
+        63, -121, 90, 119, 7, -111, 81, -52, 41, -12, 110, 61, 115, 102, -43, -7,
+        69, 76, 116, 28, 19, -21, 5, -33, 100, -46, 92, -38, 49, 42, -59, 75,
+        -114, -126, 3, 57, 54, -52, 67, 77, -97, -32, -42, 0, -12, -95, 25, 50,
+        -11, -24, 79, 92, 77, -36, 99, -121, 15, -36, -120, -52, 117, 45, -34, -81,
+        89, 96, -8, 76, -62, -71, 67, 47, 107, -28, 88, -1, -111, -42, -53, 119,
+        89, -106, -82, -86, -76, -14, -46, 32, -43, 101, -113, -96, -21, 86, -40, 121,
+        -27, -100, 37, -117, 4, -13, 51, 9, 101, -19, -55, 40, 68, 65, 126, -53,
+        -35, 50, 14, 29, 113, -45, 83, 39, 110, -48, 64, -52, 112, -5, -24, 99,
+        -62, 17, -62, 113, 18, 114, 42, 1, 57, 37, -84, 87, -75, -9, 122, 25,
+        -102, -12, -38, -27, -107, -48, -71, -94, -91, 41, -119, -74, -83, 40, -82, -95,
+        -66, -94, 41, -13, 33, 99, -82, -26, -107, 21, -47, 101, 105, 70, 116, 65,
+        45, -53, -101, 55, 5, 38, -125, -99, 69, -60, -88, -56, 23, -109, -27, 112,
+        125, 54, 56, 25, 1, -25, 101, -76, 96, 46, -92, 56, 121, -61, 56, -45,
+        -88, -124, 10, -55, 117, 127, -58, 76, -65, 94, 57, 22, -1, -24, -24, -80,
+        110, 55, -127, -92, -127, -76, 126, 71, -49, -82, -55, -62, -60, -105, 122, -104,
+        -8, -74, 101, 42, 47, -26, -105, 65, 73, 97, -72, 13, -16, 107, 81, -100,
+        8, 45, -63, -64, -85, 59, -60, -95, 41, -41, 47, -119, 96, 17, -5, 8,
+        52, 126, 56, -14, 7, -29, 83, 95, 11, -119, -15, -17, -81, 14, -119, 49,
+        49, -94, -78, 52, 44, 60, -45, 54, 43, -43, 78, 59, 87, 45, 89, 68,
+        -22, -78, -10, -105, 6, -2, 105, -37, 30, 106, -63, 92, -38, -83, 96, -67,
+        -114, -31, -74, 89, -70, -74, -104, -51, 33, -17, 79, -127, -26, -37, -88, 119,
+        -29, 10, 125, -28, -68, 66, 31, -23, 87, -24, -93, -53, -112, 5, 101, 51,
+        99, -7, 104, -76, 127, -62, -67, 115, 88, 4, -120, -76, 93, 31, -128, -128,
+        -33, 19, 58, -101, 24, 106, 74, 30, 54, 105, -71, -88, 30, 7, 109, 37,
+        -119, 67, -76, 10, 12, -9, 110, -60, 95, 123, 124, -62, -39, 81, -46, 60,
+        -84, -5, 124, 81, 70, -68, 38, 22, 23, 77, -88, -72, -19, -99, 21, -84,
+        7, 55, -86, 117, -109, 112, 53, -51, -48, -39, 78, -113, 4, -113, 51, 99,
+        -16, 101, 16, -74, -80, 71, 79, 51, -39, 18, -96, 0, -89, 17, 24, 30,
+        -3, -5, 76, 65, -122, -27, 63, -59, -43, -105, 39, -60, -75, 104, 110, 60,
+        -80, 108, 86, -24, 35, -23, 12, 91, -105, -59, -105, -124, 71, -1, -103, -114,
+        66, 103, -63, -92, 17, 111, -45, -35, 94, -60, -125, 28, 77, -100, -27, -18,
+        96, -127, -107, 116, -121, -11, 16, 111, 80, 74, -67, -88, -38, 38, 60, 76,
+        0, -50, 31, 13, -74, 113, 13, -38, -107, -121, -119, 80, 26, -50, 0, 125,
+        126, -120, 49, 50, 78, -32, -22, -63, -30, 63, 112, 115, 123, 11, -83, 92,
+        -71, -127, 12, 103, -73, -23, -36, 119, -11, 82, 126, 73, -54, 63, 98, 52,
+        -94, -97, -18, 49, -119, 90, -19, 35, -61, 27, -121, 89, 92, -3, -114, 21,
+        -46, 123, 112, -115, -26, 90, 43, 111, 31, -57, -49, 69, -2, -5, -121, 98,
+        117, -30, 26, 77, 110, 86, 105, 12, -120, -57, -81, 112, -120, 95, 40, -59,
+        5, 104, 123, -22, 9, -53, -6, -14, -15, -47, -16, 103, 42, 41, 85, -83,
+        -31, 65, 85, -102, -23, -48, 74, 100, -23, -107, -45, -9, -51, 85, 1, 77,
+        -49, -47, -128, 0, 120, 22, 52, -58, 114, -119, -124, 93, -36, -125, 87, 68,
+        -90, 5, 23, 96, -67, 121, -102, 35, -25, 120, 93, -93, 81, -107, -77, -80,
+        -28, -40, -49, 101, -24, -10, -86, -96, 94, -35, -123, 65, -34, 82, -32, -128,
+        117, -114, -107, 41, 46, -58, 32, 30, 20, -125, -109, -32, -28, 25, -4, 56,
+        65, 20, 43, -48, 109, 63, -18, -25, -3, -94, -1, -126, -65, -29, -70, -77,
+        23, -49, 98, 120, 5, -68, 59, 69, -25, 16, -36, -69, 90, -122, 27, 2,
+        108, -92, -13, 44, 122, 51, 48, 26, 125, -116, 66, -30, 58, 36, -6, 48,
+        -32, -5, 89, 64, -1, -24, 67, 120, -15, 44, -77, 63, -97, -87, -113, -69,
+        49, -127, 126, 63, 96, 87, 96, -70, -2, -82, 51, -37, -43, -102, 85, -29,
+        -9, 5, -62, 74, -74, 93, -44, -98, 39, -41, 24, 78, 101, -71, -93, -49,
+        -22, 11, 58, 116, -71, -22, -24, -89, -95, -83, -114, 117, -82, -38, -86, 53,
+        103, -86, 5, -23, 23, -28, 10, -87, 116, 87, 108, -2, 97, 74, 74, -122,
+        -11, -104, 52, 5, -101, 49, -55, -16, -21, 19, -110, -65, 121, -102, -41, 53,
+        -99, 24, -126, 110, 70, -110, -75, 104, 13, -88, 40, -28, -50, -30, -39, -114,
+        -120, -109, -113, -113, -104, -78, -77, 64, -5, -127, 108, 87, -108, -55, -61, -84,
+        59, 86, 47, 97, -126, 121, -85, 91, -93, -113, -18, 121, -6, 73, -28, -67,
+        -32, 90, -24, -54, 88, 99, -107, -68, -121, 52, 76, -126, -11, 56, 76, -125,
+        -51, 56, -116, -125, -11, 73, 88, 97, -38, -54, 50, 96, 11, 16, 22, 1,
+        -101, 62, -122, -35, -99, -120, -8, -13, 70, -48, 4, 59, 11, 89, -17, 42,
+        -87, -17, -109, 36, 119, 121, -114, 3, -58, -6, -128, -62, 4, -30, 89, -74,
+        27, 51, 45, -70, 2, 55, -60, -121, -34, 103, 74, -42, 4, -119, 36, 88,
+        -80, 68, -124, 71, 71, -117, -77, -103, -98, 108, 15, 125, 3, 49, 63, 29,
+        -38, -122, 79, -26, 108, 71, -68, 101, 52, 124, -7, 44, 107, -105, -126, 1,
+        94, -112, -7, -8, -69, -91, 0, 85, 26, 99, 16, -87, -105, -102, 123, -91,
+        -128, -69, 120, -75, 76, -127, -127, -10, -73, 110, 120, -5, 79, -127, 91, -80,
+        -60, 8, -51, 24, -28, -39, 82, 125, -50, 16, 61, -89, 121, -27, -39, 124,
+        49, -19, -8, 64, 57, 89, 1, 126, -103, 71, 38, 104, 48, -90, -25, 109,
+        92, 45, -119, 91, 50, -62, -118, -72, 80, -17, -124, 37, 50, 96, 49, 18,
+        74, 22, 26, 55, 101, 79, 21, 11, 98, 123, 56, 66, -82, 40, 50, 118,
+        83, 32, -69, -93, -93, -78, -75, -124, 55, 61, -52, -38, 19, 43, -96, 68,
+        -127, -31, -67, 14, -23, 32, -95, -113, 43, 101, 67, 98, -74, 19, -118, -113,
+        -44, -12, -40, -23, -64, -101, 77, 23, 104, 62, 22, 7, 85, 95, -4, 46,
+        3, 115, 17, -82, -24, 110, -127, -18, -39, -126, -71, 63, -71, -35, -91, 91,
+        22, 107, -117, -18, -62, 120, -100, -37, -82, 79, -20, 123, -109, 91, 113, 111,
+        114, -21, 64, 85, 111, -128, -106, 35, 62, -21, 2, -97, -39, 78, -16, 33,
+        -34, 97, -49, 72, -100, -50, -3, -91, -128, 42, 20, -41, 6, 85, 43, 5,
+        -96, 26, 93, -43, -30, -120, 71, 45, 78, 111, -82, 47, 3, -87, -66, -56,
+        -104, -28, 34, -71, 36, -96, -109, 100, 17, -74, -92, 87, 22, -9, 61, -118,
+        127, -77, -108, 91, -93, -34, -99, 60, 91, -78, 77, 26, 5, -77, -96, -47,
+        107, -79, -118, 103, 105, -67, 81, -73, 91, -76, -96, 115, 52, 74, 5, -36,
+        88, -110, -87, -63, 106, -80, 66, 86, 45, -24, -35, -106, -103, -9, 39, 39,
+        -45, -84, 86, 1, 57, 49, -82, 26, -100, -17, -77, -15, -54, -1, 26, -83,
+        -65, -52, 125, -4, -12, 121, 23, -63, 17, 33, -123, -8, 49, -57, 125, 84,
+        22, -94, -46, -12, -53, 48, 114, 114, -94, 112, 12, 34, -67, -13, -126, -89,
+        36, -125, 49, -73, -120, -102, 59, -51, -100, 38, -69, 124, 108, -89, -6, -100,
+        84, 0, 19, -100, 16, -125, -58, 49, -125, -58, 49, 67, 102, 39, -124, -56,
+        0, 54, 89, 98, -107, -104, 50, -86, -56, -84, 73, -4, 94, 35, -45, -18,
+        53, -118, -114, -78, -60, -92, 88, 21, -110, -84, 12, 73, 86, -123, 36, -85,
+        68, -110, 85, 32, -55, -54, 5, -55, 74, 5, -55, 74, -8, 93, 38, 53,
+        -5, -5, -42, -33, 122, 15, -21, 115, 40, -122, -74, 5, -74, 29, 97, -37,
+        -110, -38, 110, -3, -48, -85, -100, -100, -79, -105, 106, 75, -74, -106, -127, 116,
+        -51, 40, -70, 126, -48, -79, 64, 37, 91, -96, -126, 45, 80, -50, 22, 40,
+        99, 11, -60, -78, -71, -60, 125, -25, -57, 65, -38, 29, -5, -108, -31, -123,
+        -57, 120, 31, 51, 36, 60, 38, 3, -91, -90, 37, 61, 94, -34, 68, -91,
+        -21, 62, -5, -8, -60, 119, -82, -29, 18, -41, -94, -60, -75, 40, 112, 45,
+        114, 92, -117, 108, -25, 58, -94, 81, 97, -33, -7, 25, -9, 52, -30, 1,
+        -80, 22, -35, -85, 79, 62, 52, 38, -20, 111, 44, -40, 23, 22, -11, 35,
+        92, 52, -44, -82, 58, 20, 43, -13, 40, 6, 38, -35, -46, -71, 81, 72,
+        -33, -54, -83, -101, 86, -102, 79, -106, -45, 119, -34, -9, -84, -42, 83, 24,
+        -87, 79, -36, -122, -101, 123, 90, -120, -27, 106, 105, -118, -13, 29, -31, 124,
+        51, -100, -17, 12, -25, -69, 20, 11, -85, -35, -73, -45, -38, -2, -80, 69,
+        84, -99, -11, -35, -74, -120, -115, -18, -25, -72, -86, 38, 42, -6, -111, -101,
+        43, -17, 70, 73, 2, 23, -91, 26, -14, 73, 119, 32, -97, -76, 19, -7,
+        72, -80, 15, 116, -59, -93, -119, 127, 116, 5, -88, -90, -5, -30, 121, -27,
+        97, -17, -24, 78, 41, -3, 42, 62, -74, 16, 59, 1, -3, 72, -4, 64,
+        80, 22, 51, -106, -74, 101, -43, 9, -94, -69, 57, 66, -76, 50, 72, 91,
+        57, 66, 84, 7, 69, 85, 63, 117, 28, -120, -92, 63, 124, -66, 109, -84,
+        108, 3, -76, 53, -73, -45, -128, 65, -72, -93, -77, -128, 89, -72, -90, -114,
+        -109, 15, 11, 55, 107, -123, -48, -103, 60, -48, -50, -106, 18, 64, 115, 92,
+        -86, 37, 67, 1, 29, 0, 10, -36, 69, -33, -71, -117, -57, -82, -2, 37,
+        120, 42, -27, -30, -109, 111, -124, 37, -47, -17, -14, -27, -28, 26, -31, -96,
+        49, -28, 93, -115, 26, -20, -78, -93, -109, -65, -17, -41, 9, -98, 61, -124,
+        8, -83, 11, -115, 25, -36, -43, -57, -128, 49, -92, -107, 62, 0, -30, 69,
+        26, 83, -38, 81, -2, 119, 63, 104, -70, -36, 1, -33, -36, -88, 71, 105,
+        11, 60, -57, -102, 89, 5, 58, 71, -53, 74, 20, -34, 76, -115, -37, 118,
+        21, 105, 94, 102, 121, 115, 69, -95, 31, 89, 81, -24, -127, 64, -100, -14,
+        59, -62, -38, 29, -37, 11, -112, -72, -26, -14, -21, -24, -78, -62, -48, -68,
+        113, 91, -103, -3, 57, -112, 56, -68, -8, -43, 9, -52, 3, -81, 34, 69,
+        10, -127, -70, 93, 8, -79, 113, -81, -41, 110, 23, -46, 36, 63, -23, 96,
+        96, -84, 82, 102, -42, 111, 119, 29, -86, -69, 53, 2, -60, -99, -76, 54,
+        23, -127, 33, 116, 30, 21, 105, 48, 39, -18, -86, 98, 24, 111, 49, 39,
+        124, 26, -59, -58, 40, -41, -65, 42, 22, 85, 117, 100, 81, -104, -10, 14,
+        -51, 27, 4, -108, 115, 42, 74, 42, 21, 60, -96, 83, 1, -121, -72, -64,
+        0, -82, -80, 9, 111, -63, 90, -40, -19, 48, 115, 99, -41, -59, 115, -70,
+        109, 92, -119, -48, -25, -10, 72, -69, -96, -101, -88, -102, 56, -70, -60, 112,
+        -72, 36, -53, 104, 57, 45, -84, -110, -90, 45, 79, 12, -56, -69, 114, 99,
+        -57, -92, 65, -4, 24, 86, 23, 42, 95, -96, 127, 72, -3, 2, -116, 53,
+        -112, -65, -118, 118, 124, -109, 120, -67, -111, -66, -61, -70, 52, 9, 40, 6,
+        -47, 57, 71, -20, -79, -28, -76, -86, -128, -59, -126, 70, -87, 107, 75, 70,
+        62, -18, -95, 118, -84, 11, -109, 18, 91, -106, -58, 40, 108, -82, 78, 22,
+        -91, -19, 39, -84, 87, -28, 61, -3, 107, 14, -107, 17, -23, -66, -71, -121,
+        -87, -93, 42, 89, 0, 28, -90, -5, 120, 112, 1, 105, 27, -116, 13, 50,
+        107, -14, 41, -77, -74, 18, 39, -107, -49, -128, -15, 116, -14, 53, -64, 84,
+        -110, 79, -59, -30, -84, 70, 22, 50, -72, 69, -45, -24, 87, -47, -18, 69,
+        35, -89, -117, -50, -19, -67, -59, -19, 93, 74, 22, -121, 24, -53, 57, -33,
+        94, 46, -55, 111, 41, 87, -124, 115, -64, -22, -86, -4, 95, 127, 100, -10,
+        -120, 60, -99, -79, 100, 75, 93, 71, -81, 113, 117, 124, -30, -68, 58, 62,
+        -47, -81, -114, 79, 46, -61, -15, 8, -80, 83, -93, -19, 115, 103, -37, -25,
+        122, -37, -25, -24, 7, -27, -54, 1, 103, 38, 123, 99, -35, 4, 34, -83,
+        16, -100, 75, -103, 111, 39, 25, -44, 44, -31, -68, -103, 26, 73, -48, -128,
+        127, -59, -13, 127, -33, -94, 58, 23, 88, -59, -17, -117, -14, -29, 77, -100,
+        101, -124, -3, 17, -33, -95, -73, 24, -31, -23, -46, -63, 29, 33, 33, -62,
+        52, 68, 44, 0, -26, -16, -89, 31, 127, -2, -41, -33, 95, -65, -1, -37,
+        59, 30, -116, -12, -15, -15, 80, 11, -113, -119, -39, 96, -12, -25, 4, 19,
+        26, 58, 27, -93, -50, 121, 32, 94, -65, -2, -60, 94, -53, 36, 21, 0,
+        -109, -119, -120, -40, -123, 124, 75, 92, -46, -106, 113, -61, -40, 73, -3, 42,
+        -103, 122, 0, -97, 85, 1, 68, -4, 62, 46, 115, -81, 71, 7, -23, 38,
+        -51, 15, 102, 113, -98, 23, -11, -63, 85, 114, -80, -96, 43, 51, -32, -38,
+        -106, 113, 126, -64, -54, -29, 53, -34, 100, 68, 117, 127, 56, -10, -61, -102,
+        107, 99, -31, 107, 120, -97, -113, 23, -73, -125, -31, 41, 20, -45, -60, -90,
+        39, -64, -92, 15, 79, -103, 18, 47, 71, -1, -82, -30, 108, 124, 116, -124,
+        18, 108, -29, 118, -53, 21, 115, -78, -75, 18, -49, 9, 27, -117, -36, -16,
+        -58, -59, -104, -77, 39, 87, 5, -69, -105, 82, -61, 90, -76, -79, 24, -13,
+        27, 119, 53, 121, 22, 81, -86, 37, 126, 123, -108, 2, 31, -98, -99, -99,
+        76, -77, 8, 120, 104, 4, 107, 47, 27, 68, 39, 66, 111, 94, 28, 35,
+        94, 33, -96, -70, -50, -118, 2, 61, 54, -78, 98, 49, 30, 121, 75, 84,
+        66, -79, -126, 85, 113, -17, 1, -96, -49, 48, -64, -71, -106, 71, 107, 121,
+        60, 7, 25, 20, -105, -56, 91, -120, -60, 24, -73, -47, -30, -39, 60, 88,
+        69, -73, -49, -76, 46, -21, -29, 91, -116, -72, -52, -33, -51, -110, 52, -13,
+        18, 124, 117, 21, -83, 72, -69, 116, 116, 84, 0, -41, 67, 26, -118, 73,
+        -50, 44, 57, -41, -108, -101, 121, -59, -127, -22, 42, -8, -58, 71, -26, 8,
+        -67, 29, 111, -3, 87, -41, -2, 68, 112, 71, 15, -116, -123, 2, -70, -126,
+        -89, -4, -89, 52, 15, 115, -12, 117, -93, -121, 120, 13, 15, -71, -78, 87,
+        98, 113, 41, -17, -94, 122, -30, -27, 42, 40, -96, -7, -91, 59, -4, -110,
+        100, 35, 111, -52, -45, 118, -100, 6, 27, -64, -101, -101, -77, 40, -99, 108,
+        48, 125, 120, 63, -70, 9, -8, -128, -17, -92, 113, -124, -10, -51, -109, -53,
+        87, 8, 111, 57, 15, -62, -7, -76, -63, 10, -18, 65, 59, 13, -1, -9,
+        16, -104, -119, -87, 56, 22, -86, 44, -28, -13, 85, -104, -89, -30, -104, -57,
+        -50, -120, -94, -93, 31, 126, 23, 93, 29, -89, -109, 84, -61, 37, 2, 105,
+        80, -5, 49, 98, -59, -79, 30, -124, -9, -126, 114, 83, 78, 82, -52, -65,
+        -28, 23, 60, -80, 46, 72, -47, -3, -88, 12, -46, 65, 52, -74, 64, -90,
+        -112, -69, 80, -24, -69, 80, 92, 20, -50, 93, 40, 22, 113, -103, -42, -53,
+        -101, 116, 70, 91, -15, 51, 84, 111, -77, -30, 79, -50, 48, -111, -98, -105,
+        40, 19, 13, -76, -41, 3, -92, -54, -34, -41, -111, 12, 14, -127, -43, -11,
+        -32, -53, 23, -105, 98, -111, -23, -108, -48, 47, -8, 50, 96, -43, 99, -7,
+        59, -11, -47, 118, -79, -44, -49, -84, 44, -85, -115, 122, 0, -110, 103, 21,
+        -59, -70, -30, -55, -90, -27, 105, 78, -125, -46, -73, -113, 80, 44, -41, 35,
+        -42, -41, 35, -66, -120, -9, 89, -113, -1, -28, 90, 52, 87, 64, 76, -65,
+        57, 103, 84, 51, 15, 48, -78, -67, -122, -88, 10, -44, 15, 20, -57, 57,
+        -41, -47, -107, -109, -27, 89, -114, 26, -52, 96, -42, -113, 50, -57, -38, -52,
+        84, -78, -95, 102, 33, -34, -8, 55, -105, -84, -106, -21, -107, 104, -54, -81,
+        -74, -125, -80, -61, -3, -61, 96, 116, 19, -82, 89, -70, 55, -51, 14, -109,
+        75, -121, -32, -91, -14, -79, -70, 91, 104, 98, 24, -73, 57, 18, 84, 124,
+        -65, 47, 120, 99, 31, 93, -7, -76, -40, -40, -116, 39, -80, -50, -14, -122,
+        2, -72, -66, 77, 102, -23, 13, -103, 106, -60, 26, 72, -89, -54, -70, 47,
+        62, -85, -89, 113, -88, 44, -73, -48, -21, -126, 96, 9, -45, 20, -95, -45,
+        -28, 62, 94, 50, -46, 122, -85, -78, -110, -39, -105, 81, 108, -77, -13, 83,
+        46, 25, -121, -107, -12, 42, -100, -56, 37, -117, 117, -39, -68, 38, -71, -35,
+        124, -125, 36, -125, -89, 89, -111, 104, 48, 29, 36, -60, -125, -107, 67, -19,
+        60, 0, 57, 59, -117, 78, -87, 3, -98, -112, -13, 125, -79, -96, 94, -24,
+        86, -47, -82, -5, -22, 20, 64, 48, 22, 73, -1, 100, -114, 101, -68, 96,
+        -75, 71, -64, -72, 35, -21, -28, -31, -63, 97, -99, 98, 112, 14, -65, -47,
+        -88, -60, -3, -101, 17, -62, -94, 119, 83, 103, 47, 88, 108, -11, 20, -18,
+        -13, 57, -26, -13, -127, -54, -60, 67, 7, 123, -57, -78, -70, -56, 8, -8,
+        62, 101, -39, 115, -49, 85, 110, 68, -119, -40, 64, -125, -27, 18, -79, 6,
+        -78, 59, -26, 52, 26, 94, -23, 106, 83, -79, -127, -42, -127, 94, -112, -26,
+        120, 91, 37, -97, -51, 46, 39, -50, -11, -106, -30, 3, -97, -71, 58, 68,
+        83, -3, 33, 44, -50, 78, 113, 55, -57, -45, -94, -113, -118, 35, -64, 8,
+        60, -123, -128, 123, 23, 53, 30, -41, -18, 23, -124, -101, -55, 126, 45, 71,
+        -63, 105, 112, -22, -21, 39, -24, -45, 78, 70, -127, 75, 18, -79, -110, -63,
+        72, 57, -96, -53, -89, 2, -67, 74, 74, 47, -68, 106, 118, -18, 113, -30,
+        79, 99, -19, 66, 42, 114, -14, -13, -70, 62, 104, -86, 63, -124, 37, -82,
+        97, 9, 107, 88, -46, 26, -114, -4, -80, -69, 55, 54, -1, 64, -81, -92,
+        47, -122, 76, 12, 78, 37, 123, 102, 42, -41, -20, 65, 77, -116, -126, -95,
+        47, 1, -128, 62, -65, 46, 75, 113, -19, 10, 40, 33, 64, 21, 42, 0,
+        -100, -3, -70, -92, 0, 17, 92, -85, -34, 52, -31, 76, 84, -86, -54, -126,
+        28, 60, 72, -83, -24, 48, -11, 68, -124, -57, 66, 122, 83, -30, 79, 86,
+        17, -45, -66, -112, -78, 37, 13, 10, -44, 57, 0, 36, 18, -99, 122, -96,
+        -16, -86, 33, 80, -87, -12, 38, -51, -30, 82, -124, 95, -120, 51, -112, -116,
+        -26, -101, 119, 48, -106, -102, 37, 69, 10, -83, 22, 91, 114, -82, -112, -18,
+        34, 57, -90, -15, -82, -32, 15, 75, 125, 104, -30, 101, -81, 8, -78, 96,
+        -23, 75, 117, 90, 21, -13, 108, -58, 63, -26, 98, -59, 95, -81, -109, -54,
+        99, 113, -50, -44, -122, -72, -85, -19, -58, -14, 14, -36, 110, 109, 85, -63,
+        22, -37, 105, 41, 91, 15, -115, -39, 75, -99, 45, 94, -16, 95, -44, 44,
+        32, 45, -94, 123, -11, -128, -104, 62, 80, -113, 60, 64, 7, 123, 114, 21,
+        -24, -117, -51, -30, -125, -105, -4, -32, -86, 25, 83, 94, -101, -88, 8, 10,
+        -25, 30, -61, -31, 116, 21, -88, 100, -15, 65, 57, -63, -61, 23, 83, -14,
+        -116, 26, -107, 118, 1, -90, -10, -53, -112, 40, 59, 114, -33, 12, 48, -7,
+        96, -87, -89, -127, -11, 125, 95, 55, -54, 47, -128, -68, 71, -8, -113, 52,
+        32, -96, -80, -2, 26, 20, 0, 92, 118, 100, -42, 105, 124, -102, -74, 76,
+        22, -85, -4, 61, 104, -109, -61, 122, -19, -24, -83, 42, 48, 59, 23, 126,
+        -71, -128, -81, -74, 79, -21, -16, -80, 86, 64, -102, 75, 55, -121, 101, -108,
+        -75, 118, -2, 95, 31, 127, -7, -103, 36, -68, 124, -111, 94, 111, -40, 74,
+        76, 50, -116, 81, -41, -8, -118, 22, -36, 83, -59, 41, 110, -76, -57, 25,
+        37, 98, 20, 60, -24, -34, 5, 30, -109, -106, -77, -101, 57, 10, 40, 93,
+        116, 44, -65, -111, 98, 36, 100, 29, 46, 103, -20, -30, 0, -1, -48, 7,
+        -40, 95, 63, -104, -111, -33, 37, 29, 91, 60, 81, 41, 63, 57, 24, 12,
+        103, -18, 46, 74, 46, -46, -53, -83, -79, -81, 11, 110, -45, -50, -110, 40,
+        -111, -21, 3, 51, 78, -49, -60, -19, 51, -37, 41, -114, -26, -107, -41, 18,
+        117, -8, -53, 117, 96, 107, 118, 48, 64, -53, -17, -20, -78, -87, 22, -102,
+        -52, -38, -50, 73, -21, 66, 99, -68, 126, 37, 77, -44, -84, -13, -128, -94,
+        -8, 111, 121, -44, -2, 39, -9, 121, -85, -6, 68, -55, -123, -9, 121, -85,
+        -11, 89, -73, -11, 57, 111, -21, -109, -79, -112, 11, -40, 24, -112, 82, 110,
+        -31, -49, -124, 7, -48, -57, 44, 117, -77, 47, -104, -110, 26, -75, -24, -19,
+        61, -13, 97, -72, 105, -79, -105, -93, -113, -20, 29, -53, -96, -128, -76, -95,
+        -87, -120, -13, 10, -76, 80, 76, 47, -15, -12, -77, -118, -120, 29, -100, -33,
+        75, -125, 12, -66, -121, -106, 47, 0, 84, 92, 121, -90, 69, -49, -112, -126,
+        2, 113, 108, 94, 17, 57, -125, -88, -24, -75, -90, -26, -93, 71, -52, -34,
+        103, 63, 52, 95, -5, -127, -13, 35, -56, -43, -63, -46, -20, -8, 72, -68,
+        -98, -102, -113, 30, 113, -112, -42, 71, 98, 116, -17, 112, -112, 54, -96, -53,
+        -64, -72, -7, -14, -52, 72, -22, 21, -33, -42, 5, 85, -3, -36, 70, -80,
+        48, 46, 32, -29, 37, -124, 7, 80, -51, 46, 115, 98, 77, 83, 39, 89,
+        18, -92, 15, -113, -113, 113, 91, 38, 52, 113, 114, 56, 66, -78, 84, -97,
+        114, 44, 20, 43, 11, -75, -97, -43, -19, 10, -13, 66, 36, -13, -125, 20,
+        36, -85, -125, 27, -4, 12, 15, -91, -59, -128, 11, -43, -96, 60, 11, 66,
+        108, -35, 102, 126, 66, 121, -65, -76, -109, 69, 114, 104, -108, -68, -97, 19,
+        28, 11, 101, 88, -60, -51, 4, 38, -39, -103, -116, 111, -123, 22, 86, -88,
+        -32, 3, 0, -62, -5, -123, -75, 80, -39, -6, 15, 121, -108, 77, -82, -128,
+        42, 127, 33, -99, -36, 50, -104, -95, -107, -116, 30, -66, 14, -39, -87, -117,
+        2, -93, 86, 105, -81, 25, -105, -123, -81, 111, -11, 73, -80, -127, -78, 117,
+        -5, -75, 0, 65, -81, -102, -40, 83, 116, 12, -66, 8, 120, 46, -75, 85,
+        -124, -31, -77, 39, 37, -122, 96, -70, 101, -100, -49, 44, 90, 5, -73, 109,
+        -25, 15, 1, -24, 76, 77, 7, -95, 18, 95, 25, 51, 68, -43, -58, 43,
+        -112, -18, 16, 25, 30, 50, -41, -79, 89, 84, 35, -13, 0, 109, -105, -14,
+        125, 65, 73, -45, -67, 37, -3, 32, 120, -13, 67, -113, 125, -66, -107, 81,
+        -96, 5, -35, 61, 2, 25, 23, 2, 109, -68, -10, 89, 15, 98, 54, -76,
+        -15, -106, 10, -103, 98, -126, 46, -32, -28, -60, -19, 3, -98, 41, 122, 85,
+        48, 28, 88, 104, 51, 45, 104, -90, 5, -80, 64, -38, 52, 75, -102, 99,
+        73, 1, -115, 124, 37, -23, 45, 53, 33, 109, 70, 85, -26, -63, 44, 90,
+        0, -99, 123, 22, -51, -50, 70, -45, -31, 119, -31, 120, 56, -90, 76, 96,
+        -34, -14, 89, -76, -124, 87, -16, 28, 14, -65, -29, 106, 7, -42, 102, -128,
+        -122, -56, 99, 104, 116, 6, -116, -51, -20, 108, 65, 3, -64, -116, -28, -8,
+        -68, 124, 53, 103, 29, -93, -87, 25, -25, 127, -58, 83, 47, 65, -108, 6,
+        51, 83, -46, 99, 77, -40, 9, -81, 114, -31, 111, -64, -54, -29, -75, 81,
+        14, -120, 101, 22, -46, 95, -40, 36, 50, 23, -24, -20, 97, -44, -39, 3,
+        39, 31, -119, -70, -13, -6, -37, 87, -33, 121, 5, 42, 99, 52, 115, -14,
+        -4, 23, 102, -57, 109, 94, -124, -91, 121, 90, -73, 37, -11, 68, 76, -56,
+        -108, -76, -126, -87, 7, 89, -46, 126, -15, 27, 127, -95, -121, -80, -8, 9,
+        -50, -22, 79, 112, 48, -37, -83, -70, 26, -38, -27, -79, 83, 51, 61, -42,
+        53, -45, -29, -53, -48, -90, 109, -63, 87, -21, -72, 27, 100, -14, -21, -17,
+        -20, -120, -71, -39, 67, 28, 105, 126, 50, 111, 80, 98, -31, 87, 26, 51,
+        27, -111, -66, -68, -79, 41, 69, -106, 79, 96, 108, 1, -74, -77, -119, 125,
+        -77, 84, -103, -119, -93, 100, 3, -98, 70, 12, 117, -100, 102, -110, 50, 63,
+        -44, -81, -108, -70, -101, -1, -46, 104, 126, -114, -46, -94, 118, -55, -60, 78,
+        115, 35, -123, -104, -42, 78, -92, 11, -45, 125, -72, -21, -55, -4, 44, 38,
+        -25, -19, -121, 82, 83, -9, 43, -108, -94, -65, 13, 50, -12, -31, 22, 118,
+        -84, -91, -56, -28, -72, 121, 111, -91, 110, 52, 122, 106, 84, 107, -105, 36,
+        14, -108, -35, -50, 86, 74, 70, -92, -101, 51, 63, 96, 88, -100, 87, -58,
+        -99, -2, -120, 68, 44, -114, 78, -53, 100, 126, 59, 75, 90, -92, -119, -70,
+        47, 112, 15, 48, -22, -24, -18, -26, -19, -79, 0, -42, 80, 124, -37, 40,
+        84, 124, 90, -83, 19, -39, -125, 62, -80, 91, 56, 92, -66, -117, -59, -27,
+        -124, 35, -32, 91, 67, 73, 115, -21, 79, 21, 23, 55, 99, 53, -119, 125,
+        -109, 35, 41, 2, -2, 26, -17, 78, 53, 13, -67, 120, -85, 49, 104, 75,
+        -39, -34, -88, -71, 20, -19, 83, -115, 102, -56, -73, 126, 96, -128, -12, -95,
+        -83, -79, -42, 99, -65, 72, -56, -19, -82, 69, -2, -120, -28, 29, 30, -19,
+        -82, -57, -3, 22, -37, -86, 1, 35, -9, -57, -114, 79, 36, 114, -44, 64,
+        70, 36, -13, 115, -82, -66, 117, 34, -59, 90, 118, -44, -7, 97, -113, 58,
+        -17, -9, -88, 115, 46, -22, 24, -103, 19, 91, 39, -33, 53, -20, -97, -60,
+        102, -5, -63, 97, -91, 65, -85, -5, -74, -36, -82, 97, -26, 110, 116, -108,
+        26, 27, -34, 86, -2, 70, -92, -126, -78, 63, -17, 30, -72, 19, -24, -83,
+        66, 4, 105, -28, 111, -8, -37, -65, 20, -128, -15, -95, -24, -24, -56, 126,
+        67, -5, 106, 58, -128, 59, -86, -8, -50, -122, 110, 85, 86, -18, -106, -25,
+        114, 53, -38, 60, -112, -62, 95, 18, -27, -42, 78, -53, 34, -104, -64, -106,
+        103, -89, 101, 49, 45, 110, 89, 64, 85, -116, -46, -8, 110, -51, -46, -47,
+        85, -16, 18, -11, 88, -6, 93, -114, -114, -86, -116, 2, 96, -106, 85, -22,
+        39, -98, 83, -81, 7, 34, 7, -48, 113, -119, -65, -126, -4, -107, -60, 21,
+        -4, 7, 114, 104, 48, 122, -119, 21, -128, -52, 44, 99, -64, 82, 89, 70,
+        -99, 87, -47, -31, 104, -53, -7, 24, 107, 59, 117, 24, 108, 82, 34, -119,
+        -66, 75, -121, -29, 112, 30, 37, 8, -35, -82, -98, -68, 28, 71, 84, -48,
+        -80, 10, -76, 116, -54, -93, -106, 5, -57, -112, -20, 15, 40, -90, -124, 57,
+        70, 29, -3, -116, -119, -77, -117, 123, -128, -26, -49, 33, -32, -66, 116, -79,
+        -92, -97, -102, 13, -96, -28, -81, 118, 24, 26, 75, 30, 34, 49, 79, -35,
+        -124, -40, -58, -49, 14, -58, -126, -8, -51, -49, 77, -18, -126, 105, -5, -19,
+        -22, 44, -22, -110, 37, -121, -6, 118, -6, 95, 51, -125, 109, 44, -24, 10,
+        103, 124, 52, -82, -49, -117, -125, 52, 32, -90, 40, 70, -2, -91, -106, 10,
+        114, 82, 69, 49, 73, 14, 85, 11, 66, 65, 46, 94, -93, 60, 30, -96,
+        19, 11, 95, -75, -83, 22, -60, 78, -17, 126, 36, -70, -73, -58, -60, -93,
+        71, -47, -52, -103, 14, -127, 127, -124, 93, 23, 125, 14, -48, -76, -119, -9,
+        13, -100, -65, -91, 95, 97, 102, 10, -80, 37, 31, -39, 27, -8, 28, 124,
+        -51, -61, -60, -78, -28, 75, 71, -102, 118, -61, 32, 39, -26, 120, 38, -23,
+        -76, -8, 73, 90, -83, 120, -84, 18, 29, -104, 19, 3, 4, 15, -21, 70,
+        -62, 111, -76, -72, -91, -119, -70, 96, -79, -27, -38, 45, 61, -28, 2, -57,
+        103, -107, 90, 10, -97, 6, -23, -60, 67, 3, 9, -88, 113, 22, -115, 71,
+        26, 93, 74, 84, 60, 27, -70, 37, 115, 22, -128, -32, 34, -114, 6, 31,
+        83, 58, 56, 125, 86, 96, -30, -75, 32, 69, -59, 50, 123, 75, 7, -120,
+        87, 24, -119, -19, -25, 35, -24, -13, -6, -24, -128, -112, 116, 92, -113, -96,
+        -90, 76, 13, -127, -23, 126, 122, 57, 77, 84, -23, 125, -88, 96, 42, -63,
+        -21, 34, -67, 100, 117, 67, -121, -114, 72, 116, -46, -84, -35, 60, 16, 70,
+        -105, 33, 95, 72, 107, 34, -84, 80, -29, -124, 18, 46, -8, -69, 70, -103,
+        98, -38, 36, -95, -42, 96, -33, 77, -13, -106, 81, 50, -19, 65, -93, -74,
+        123, -108, -86, 82, 19, 58, 40, 48, -119, -86, -63, 31, 124, -71, 119, 122,
+        33, 87, 102, 54, -110, -51, 95, 96, 62, -38, 94, -128, 57, 104, 123, 46,
+        -86, 100, 110, 19, -15, -57, -48, 27, -112, -33, -26, 34, -88, 66, 74, 114,
+        -117, -80, -97, -14, 41, 104, 77, -7, 106, 107, 111, 72, 86, 86, 87, 11,
+        -42, 26, 120, -102, -16, 59, 108, -34, -7, 121, 10, 82, -31, -121, -26, 9,
+        -48, 2, 115, -42, -70, 115, -5, -114, -64, 2, 26, 110, -20, -63, -12, 53,
+        -42, 0, 44, -123, -30, -120, 127, -97, 119, -95, 45, -66, -23, 122, 96, 126,
+        -55, 93, 28, -81, 3, 53, -66, -47, -27, -114, 62, -70, 42, -95, -6, -109,
+        -47, 47, 62, 58, 34, 98, -84, 93, -64, -65, -96, -128, 39, -32, -35, -123,
+        -78, -29, 64, -11, 25, -22, 31, 48, 8, -34, -89, -33, 67, -16, 0, -125,
+        35, 12, -95, 97, 52, -61, -110, 74, -10, -46, 29, -127, -101, 69, 122, -70,
+        -97, -60, -76, -62, -58, 8, 21, 76, 52, -4, 80, 22, 119, -23, 60, -103,
+        99, 88, 18, -41, 59, -27, 40, 40, 8, -90, 114, -66, 116, -60, -98, 75,
+        -128, 110, 38, 13, -70, -103, 48, -11, 103, -83, -46, 13, -5, 42, 88, -35,
+        104, -110, -98, 105, 37, -94, 77, -118, -122, -10, 92, 9, -89, 74, -23, -44,
+        -24, 86, -73, 70, -111, 47, -80, -38, 39, -3, -82, 2, -97, 3, -85, 34,
+        -98, -16, 60, -83, -45, 56, -5, 105, -65, -38, -104, 72, 68, -65, 84, -63,
+        -25, -114, 78, -9, -88, -19, 111, -23, 72, -38, -117, -50, -115, -117, -123, 125,
+        -68, -52, 77, -85, 68, 125, 62, 67, -39, 93, 109, 10, -56, -125, -15, -91,
+        53, -69, -18, -102, 52, -77, -79, 53, -10, 49, -61, -127, 98, -81, -37, -96,
+        3, -59, 116, -106, 92, 65, -44, -28, -41, -43, -54, 114, 75, 7, 62, 101,
+        -20, 32, 76, -95, -104, 93, 26, -64, -53, -35, -126, -39, -66, -113, 79, -127,
+        78, -74, -63, 59, -110, 85, -91, 25, 56, 123, 62, -30, 78, 69, -90, -55,
+        118, -4, -86, 54, -36, 110, -103, 83, -110, -31, -120, -37, 104, -28, -121, -106,
+        13, -89, 107, -52, 22, 88, -93, -6, -114, 122, -30, 82, 17, -19, 11, -16,
+        -21, -43, -113, 57, 9, 57, 63, -78, -69, 113, -27, -44, 100, -98, 30, 106,
+        -118, 59, 57, 96, 123, 64, -93, -120, 29, 31, -122, 118, -102, -77, 79, 20,
+        7, 54, -99, 97, -12, -68, -115, -48, -24, -44, -2, -109, -34, -60, 119, 116,
+        -124, 36, -73, -67, 35, 69, -112, 63, -23, 77, 28, 29, 17, 95, -89, 42,
+        -13, -119, 26, -91, -30, 84, 29, -70, -20, 90, 89, 3, 23, 75, -25, 19,
+        -69, -44, -31, 61, 66, -24, -51, 5, -104, 86, 90, 84, -79, -22, -104, 29,
+        -107, -66, -90, 39, 67, 45, 25, 19, -81, -103, -36, 8, 83, -57, 74, -102,
+        58, 86, -70, 117, -88, 17, 16, 114, -53, -20, -99, -22, -122, -55, -114, 34,
+        -114, -97, -72, 21, -112, 64, 13, 56, 0, 110, -20, -44, -38, -52, 52, -8,
+        -119, -47, 91, -53, -123, 63, -84, 83, -50, 98, 15, -18, -45, -25, 56, -80,
+        -102, 6, 49, 3, 91, 126, 59, 38, 17, -119, -116, 79, 56, 73, -87, 111,
+        -10, 54, -86, 29, 30, -8, 118, 36, -61, -70, 41, -120, -42, -74, -82, -47,
+        51, 1, -34, 42, 23, 110, 55, 75, 18, 57, 62, -126, -92, -99, -111, 50,
+        -106, -50, -82, -48, -47, -1, -117, -55, 78, -97, -34, -90, -41, -41, 30, -93,
+        -16, -97, 66, -66, -40, -72, -44, -116, -128, 127, 50, -88, -12, 111, 79, -95,
+        -46, -126, 26, -30, -105, 63, 125, -2, -51, -33, -117, 0, 106, 62, -110, -84,
+        -4, 55, 23, 41, 84, 69, 78, 90, -88, -118, -101, -60, -48, 40, -109, -44,
+        -16, 55, -117, -66, -3, 22, -40, 53, -39, 81, -4, -51, 34, 89, -51, 122,
+        90, -120, 20, -25, -14, 127, -83, 76, 47, 100, -40, 79, -30, 122, -24, -109,
+        48, -46, -61, 91, -100, 31, 53, 103, 99, -18, -25, -29, -28, 121, -124, -87,
+        84, -118, -110, -13, 91, 12, 5, -52, 58, -123, 115, 101, -70, 104, -118, 14,
+        -2, -10, -21, -7, -108, -18, -66, -31, 7, -43, -113, -79, -91, 120, -16, 7,
+        39, 104, 118, 87, -15, -66, 98, -39, 43, 22, 8, -62, -119, -29, 99, -59,
+        62, -106, 99, -48, 40, -49, -25, -41, -53, -58, 56, -40, -7, 110, 31, 71,
+        -91, -113, -93, 50, -58, -47, 63, -63, 43, 123, 49, -114, 74, -115, -93, 127,
+        -62, 69, 49, 109, 28, -107, 54, 14, 66, 67, 94, 7, -9, -8, 36, 22,
+        -47, 55, -16, 57, -30, -50, 19, -117, 107, 48, -80, 25, -33, -56, -2, 73,
+        -125, 27, -95, -75, -48, -84, -61, -75, -77, -70, -17, -23, 51, 73, -87, -60,
+        80, 109, -62, -52, -104, -26, 39, -16, 75, 34, -19, -43, -8, -83, -65, -101,
+        114, 95, -20, -86, -96, 69, 0, -26, 118, 14, -119, -64, 119, -109, -104, -39,
+        114, -75, -36, -125, 12, 40, 9, 118, -36, 54, 92, -76, 34, 22, 33, -116,
+        -85, 40, 25, -60, 23, 41, 124, 100, 82, -67, -110, -22, 4, 90, 44, 117,
+        92, -85, 64, -67, -11, 89, 54, -73, 113, -125, -21, 81, 85, 28, 36, 23,
+        77, 54, 84, -57, -61, 83, -61, -28, -93, -95, 33, 122, -102, 1, 41, -27,
+        89, -80, -44, 86, -4, 120, -117, -41, 127, -31, -63, -59, 120, 49, -116, 38,
+        -115, 46, 76, 109, 59, 111, -33, 110, 60, -121, -90, -95, 48, 106, -71, 25,
+        -104, 122, 8, -45, 127, -89, 110, 105, 61, 70, 9, 22, 125, 43, -8, -33,
+        122, -41, -89, -76, 13, 76, -107, 69, 33, 125, 22, -19, -42, -90, 9, 93,
+        -118, -30, 45, 90, -57, 117, -101, 64, -29, 84, -51, -91, -38, 86, 89, 3,
+        48, 111, -69, 88, -97, -117, -92, 11, 2, -119, 115, 81, 6, -4, 104, -46,
+        84, -110, -31, 62, -5, -123, 94, -49, -30, -105, 31, -16, 17, -56, -98, 107,
+        86, 89, -73, 93, 54, -118, -56, -109, -50, 120, -13, 106, 52, -27, 61, 27,
+        105, 67, -83, 102, -3, 113, 50, 120, 17, 86, -69, 43, 10, 19, 0, -98,
+        56, 42, -55, 107, 44, 68, -124, -22, 92, 32, 6, 56, 11, -40, -113, -79,
+        15, 28, -40, 4, -121, -30, 52, 17, 41, 49, -120, 56, -23, 16, 36, -7,
+        99, -49, 1, 31, 61, -102, 66, -112, 10, 66, -35, 113, 48, 29, 0, 31,
+        -76, -76, 124, -110, -90, 9, -1, -35, 102, -102, -128, -89, -74, -35, 56, -127,
+        5, 111, 16, 94, -99, 42, -110, 117, -43, -116, 100, 45, -13, -48, 87, 59,
+        -46, 5, 83, -78, 32, 30, -41, -38, 72, 69, -65, -85, 33, -49, -1, -29,
+        -54, 89, -36, -39, 86, -28, -95, -21, 72, -26, 19, 105, -73, 9, -51, 43,
+        50, -7, 114, -107, 21, -11, 47, 43, -54, 63, -127, -15, -50, -122, 42, -70,
+        7, 31, 21, 114, -111, -59, -11, -11, 39, 0, 92, 45, 38, 126, -43, -102,
+        124, -59, 106, -27, -118, -49, -93, 5, 60, -56, 121, -8, 109, 60, -13, -18,
+        -72, -32, 45, 97, -73, -55, -56, 108, 119, 28, 49, -31, 86, 96, -121, 121,
+        -45, -100, 11, -20, 92, 94, -76, -62, 1, 6, -121, -110, 91, 91, -16, 7,
+        -66, 93, 57, 127, -28, 25, -97, 50, 52, -5, -22, 76, -57, -59, -45, 67,
+        -74, -91, -37, 74, 59, 18, 83, -86, 76, -113, -56, -105, -103, 41, -126, -46,
+        -118, -86, -3, -112, -50, -25, 9, -50, 93, -40, -27, 101, -36, -115, 54, -34,
+        51, 19, 101, 79, -26, -93, 91, 10, 11, -30, -44, 21, 28, -92, 110, 4,
+        7, 105, -15, -26, 63, -98, 5, -117, -56, 53, -85, -32, 86, -17, -39, -50,
+        7, 89, 95, 6, -85, 93, 95, 22, 52, 125, 21, 89, -117, 33, -14, -5,
+        -2, 53, 97, -23, 61, 120, 114, -33, 58, 88, -79, 57, 93, 71, -67, -98,
+        17, -71, -87, -79, -17, 122, 120, -95, -75, 66, 46, -36, 32, 111, 29, -83,
+        46, -78, -53, -55, 58, -70, -11, -42, 65, -122, -18, -33, 44, -91, 86, 107,
+        127, 60, -68, -17, -92, 89, 65, -27, -44, 50, -126, 70, -16, 88, 71, 66,
+        -16, -70, 122, 22, 9, -81, -45, 59, -98, 22, -78, -85, 43, -17, -50, -111,
+        32, -78, 117, 112, 44, -67, -93, 108, -94, -89, -124, -36, -35, -122, 39, 95,
+        -45, -110, 64, 118, -73, 97, -125, 83, 73, 32, 111, 0, -23, 118, 101, -37,
+        -84, -76, 60, -101, -101, -10, -66, 69, -26, -88, -34, 50, -119, 107, -32, 15,
+        -116, -127, 24, 55, -88, -101, 65, -28, -19, -120, -61, 100, 112, 68, -80, -18,
+        34, 97, -8, 61, -100, 34, 61, -1, -35, 85, -80, 9, 23, -3, -39, -15,
+        120, -44, -33, -12, -57, 44, 107, -35, 90, 79, 77, 119, -89, -78, -52, -107,
+        122, 50, -72, 66, -49, 38, -105, -85, -84, -112, -83, -45, 19, 53, 90, 115,
+        95, -34, -8, -45, 27, 0, -55, -16, -26, 43, -78, 84, 86, 122, -74, -72,
+        -116, -101, 45, 94, 71, -9, 20, 76, 24, 16, -63, 61, -101, 125, 71, -28,
+        -17, -76, 35, -57, -29, -105, -114, 28, -113, 107, 127, -70, -42, 114, 60, -82,
+        -125, -5, 102, -114, -57, 47, 44, -57, 99, -70, 79, -114, -57, -41, -80, 65,
+        -114, -116, 58, -41, 60, -18, -13, 71, 119, -15, 61, 15, -23, 124, -1, -44,
+        20, -112, -23, -50, 20, -112, 42, -89, -50, 107, 43, -57, -50, 71, -103, 16,
+        114, -47, -113, -26, -37, -32, 42, -102, 77, -82, -48, 49, -4, 106, 48, -16,
+        -41, -34, -107, -17, 14, 38, 35, -65, 100, -25, -127, -68, -37, 3, -61, -45,
+        -90, 108, 125, -118, 17, -48, -119, 62, 54, 81, 23, 25, 114, 31, -122, 13,
+        102, 111, 117, -89, 123, 116, 117, -42, 111, -101, -110, -111, 3, -78, 107, -34,
+        70, 14, 72, 68, 40, -38, -31, 104, 107, -25, 76, 0, -39, 93, -39, -107,
+        0, 114, 119, -117, 102, 2, -56, -35, 109, -98, -104, 0, 114, -57, 28, -43,
+        -111, -66, -29, -89, 56, 96, 116, -3, -114, 37, -128, -4, -30, 0, 42, 45,
+        119, -32, -21, -24, -7, -72, -1, 69, 36, -95, 115, 19, 75, 13, 98, 94,
+        71, -125, -25, -29, -127, -84, -113, -103, -42, 85, -12, -55, -113, 28, 84, 40,
+        -76, -34, -21, -64, 9, 14, 95, 100, -46, -33, -109, 64, -81, -94, 5, 127,
+        -17, 110, -41, 63, -127, 111, -14, 116, -114, -16, -117, 101, -82, -32, -84, -52,
+        71, -55, 57, -70, -25, -68, 127, -22, -59, -41, -63, 44, -8, 18, 116, -12,
+        18, -44, -63, 60, -56, 96, -83, -115, -32, 90, -97, -9, 74, 107, -34, -102,
+        -32, -123, -7, -62, -74, -99, -18, -75, -99, -113, -36, 76, -109, -122, 39, -66,
+        -38, -39, 126, 87, -98, 113, -107, -115, -95, -79, 9, -108, 35, -16, 83, 0,
+        -52, -87, 66, 111, 109, -43, 62, 19, -46, -37, -94, 30, -122, 101, 104, -31,
+        -111, 52, -110, 61, 121, -52, 34, 114, 100, -122, 57, 46, -5, 67, 12, 17,
+        91, -12, 19, -89, -100, 36, 50, 41, 102, 90, -29, -75, -55, 112, 6, -53,
+        93, 67, 16, -66, 124, 51, -83, -94, 21, -10, 119, 50, -21, 76, 43, 52,
+        -109, 125, -108, 17, -6, 80, 72, 29, -68, 84, -96, 47, -9, 102, 100, 57,
+        115, 62, -113, 100, 100, 119, -46, -27, 56, -91, 68, -99, -105, 93, 68, -13,
+        -23, 40, 44, 39, -13, -23, -30, 108, 30, 46, -112, -32, -64, -49, 126, 63,
+        92, 0, -39, -31, -90, -71, 75, -76, -53, -67, -115, 50, -17, 54, 88, 4,
+        -119, -56, 77, -18, 88, -9, 126, 75, 74, -97, -127, -105, 15, 118, -20, 5,
+        -111, -73, -103, -95, 116, -70, -74, 39, 15, -52, 32, -51, -41, 67, -17, -101,
+        21, -116, -59, -106, 20, -125, -90, 120, -114, -62, -64, 53, -112, -38, 91, -8,
+        -105, 17, 9, -85, 13, 83, 49, -78, 66, -97, 60, 55, 22, -88, 120, -20,
+        -50, 71, 64, -74, -121, -67, 30, -122, 23, -118, -76, -100, -51, 118, 67, 71,
+        118, 2, -42, 110, -53, -124, -122, -76, -111, -18, -36, 20, -112, 59, -105, -20,
+        115, -1, -7, 104, -32, -119, -124, -89, -119, 91, -26, -98, 38, 102, -48, 101,
+        -114, 57, -109, -18, 4, -88, -125, 19, -116, -72, 75, 4, -9, 118, 71, 102,
+        101, 43, 93, -112, 67, 87, -31, 79, 93, 111, -31, 32, -123, -82, -9, -118,
+        10, 55, -9, 82, -89, -98, 102, 105, 51, 93, 123, -78, 67, -71, -14, -124,
+        20, -18, 107, -125, 57, -18, -22, 88, -93, -79, -107, 74, -31, 78, -39, 35,
+        -67, -37, -99, -119, -47, -109, 54, -90, -39, -52, -118, 126, -37, -110, -8, 60,
+        -17, 71, -59, 86, -49, 82, 37, -16, 61, -89, 86, -48, 23, 65, 90, 44,
+        -78, -87, -23, -59, -116, -56, 99, 89, 44, -23, -108, -93, -62, 87, 81, -86,
+        -92, 43, -5, 115, -84, -79, 5, 24, -71, 84, 40, -90, 18, -105, -84, -106,
+        -72, 67, -117, 87, -125, 104, 124, 42, 8, -57, -18, 4, 99, 125, -52, -79,
+        43, 72, -128, 121, -32, -100, 105, -58, -84, 42, -79, 100, 42, 98, -111, 47,
+        120, -17, 100, -47, -55, 83, -109, 69, -105, 126, 88, -13, 31, 91, -9, -58,
+        -56, -115, 125, -6, -34, -104, 81, 123, -20, -128, -111, -90, 56, 17, -17, -63,
+        48, -40, 105, -27, 55, -82, -76, -14, 91, -107, 5, 78, 32, 62, 23, 5,
+        63, -23, 59, 7, -92, 50, -55, 91, -104, 82, 79, 119, -40, 36, 2, 125,
+        67, -87, -19, -24, -41, 74, -123, -40, -11, 113, 96, 44, 71, 12, 55, -74,
+        46, 89, 11, -50, -28, -120, 109, -113, 1, -24, -104, 110, 71, -11, -99, -88,
+        -81, 85, 18, 17, 40, -68, -93, 62, -125, -12, 14, -84, 104, 8, 32, 93,
+        29, 41, -52, 24, -37, -87, -8, 20, 96, 111, 36, 64, -1, -107, 4, -26,
+        -67, -126, -62, 52, -75, -73, 15, -60, -21, -121, -93, -128, 29, -49, 112, -76,
+        5, 6, -53, -15, -78, -120, -46, 61, 50, 36, 31, 52, 18, 14, 95, -108,
+        73, 22, -3, 89, -91, -43, 13, 122, 127, -66, 108, -42, 82, -119, -108, -3,
+        -119, -26, 106, 90, 69, 5, 37, 51, 69, 125, 67, -102, 47, -50, -77, 20,
+        -112, 58, 69, 35, -107, 97, 44, -46, 39, -26, 109, 126, -46, -96, -24, -112,
+        -78, 68, -55, -124, 0, -8, -48, 114, -14, -97, -51, 91, -121, 38, 110, -93,
+        114, -111, 63, -128, -99, -78, 15, 76, -113, 9, -12, 91, 33, 35, -8, 118,
+        21, -108, -56, 40, -26, -106, -18, 100, -35, 3, -111, 115, -3, -95, -88, 6,
+        94, 50, 29, -113, -62, 17, 75, 88, 96, 118, -67, 116, 43, 101, -14, 102,
+        119, 93, -86, -104, 100, 58, 24, 63, 107, -109, -120, 89, -27, -80, -69, -40,
+        -48, -50, 44, 45, 109, -51, 82, 106, 107, 84, -38, 110, -41, 90, -72, 61,
+        -17, 101, -112, 20, 1, -59, 101, 52, -30, 1, -116, -57, -93, -119, -31, -17,
+        -89, 95, -89, 56, 116, 30, -113, -113, -11, -39, 104, -6, -128, 107, 74, 57,
+        -90, -26, 115, 0, -20, -48, -117, -89, -108, 23, -114, 64, -66, 95, 117, 42,
+        86, 62, -127, 24, 125, -49, 81, 110, 126, 124, -62, 124, -105, -53, 126, 52,
+        38, -69, -7, 65, 4, -17, -48, 100, -72, -120, 96, 61, -9, -19, 49, 39,
+        29, 15, -17, 53, -88, 58, 114, -30, -27, -47, -55, 105, -96, -9, 61, -40,
+        -47, -9, 32, 71, 63, 22, 125, -66, -7, -42, 8, 39, -59, -76, 82, 34,
+        57, -3, 94, 24, 4, -29, 68, 82, 108, -58, 111, 97, 40, -29, -119, 83,
+        -25, 78, 54, -124, -44, -30, 70, -104, 107, 87, 20, 28, -51, -86, 109, 94,
+        69, -25, -62, 99, 95, 15, -111, -100, 46, 114, -64, -67, 52, 78, -70, 28,
+        78, 42, 121, 73, -99, -31, -3, -12, -29, -29, 97, -50, 99, -51, -25, 24,
+        46, 49, -82, 1, -86, 88, -78, 40, 10, 108, 113, -49, -77, 24, -88, -121,
+        126, 34, 127, -62, 33, 17, 90, -104, 105, 107, -108, -24, -87, 87, -71, -30,
+        25, -69, 20, 42, -97, 64, -58, 110, -41, -3, 101, -105, 81, 53, -56, 109,
+        81, 46, 124, 66, -9, -3, 34, 88, -110, 111, 91, -47, -97, 1, 97, -11,
+        -97, -6, 49, 108, 3, -16, 30, 57, -121, 94, 82, -33, 101, 84, -18, -45,
+        119, -36, 111, 76, 68, 55, -83, 16, -96, -123, 76, -53, 107, -68, -72, 32,
+        15, -21, 39, 100, 107, -43, -111, 57, 96, 89, -50, -9, 87, 111, 54, 68,
+        24, 49, 62, -106, -41, -68, 27, -12, 39, 94, 18, -83, -121, 89, 10, -126,
+        100, -63, 100, -84, -60, 105, -112, -96, 7, -96, 50, 79, 80, 122, 73, 124,
+        -10, -47, -47, 97, 44, -95, 73, -9, 28, 55, 110, 99, 36, 94, -6, 3,
+        72, 80, -70, -109, 46, -110, 113, -25, -82, 15, -67, -50, -78, -81, -1, 22,
+        -51, 13, 41, 93, 105, -83, 98, 41, 34, 35, 86, 109, 36, 111, 34, 47,
+        -54, -52, 37, -102, 122, 101, 123, -100, 27, -117, 64, -63, 76, 7, 49, -15,
+        -127, 64, -94, -8, 5, 28, 51, 40, 18, -121, 20, -125, -5, -75, 83, 53,
+        -91, 111, -45, 18, 103, 113, 4, -64, -18, 126, -47, -97, 67, -69, -97, -5,
+        -125, -122, -54, 121, 86, 26, -21, 126, -29, -77, -121, 119, 124, -14, -52, 83,
+        -77, -100, -114, 67, 52, 80, -43, -122, 44, 111, 7, 99, -5, 54, -16, 43,
+        -121, 76, 55, -120, -26, -38, -94, 37, -61, -41, -116, 93, -115, 115, 75, 24,
+        64, 24, -107, -4, -10, 59, -29, 93, 8, -55, -1, -35, 29, -54, -15, -21,
+        -31, 85, -102, -13, -84, 35, 70, 9, 85, 118, -103, 54, 0, -75, -93, 10,
+        -104, 93, 45, -55, 93, -46, 120, 51, 49, -125, 60, 94, -55, 29, -59, -114,
+        88, -58, -43, 47, -9, -7, -121, -78, 88, 37, 101, -115, -47, -63, -90, 118,
+        21, 36, -71, -92, 19, 75, -4, -48, 81, 22, 93, 36, -105, 90, 54, -102,
+        -101, -30, 46, 121, -14, -96, -82, -67, -35, -29, -46, -60, -50, -58, -16, 84,
+        -80, -74, 9, -59, -115, -117, -11, -108, -17, -86, 26, 122, -11, -50, 18, 47,
+        14, -58, 26, -101, 118, -99, -106, 108, -64, 127, -36, 64, 73, 51, 33, -19,
+        -31, 18, 10, -69, -86, -4, 83, 29, 35, -61, 48, -6, -62, 114, -101, -103,
+        -113, -15, -96, -57, 23, -27, -91, 30, -109, 44, -15, 13, -69, -25, -37, 21,
+        13, -4, 7, 50, -24, 45, -9, 12, 14, 41, 12, 93, 0, 36, 73, 23,
+        -77, 19, -81, -85, 42, -124, 73, -119, 58, 113, 13, 7, -12, -63, 38, 65,
+        -7, -3, -100, 70, 95, 36, -35, 25, 0, 1, -21, -38, 48, 11, -117, 35,
+        110, 67, 6, 125, -61, -87, -9, 30, -74, -64, 22, 63, -80, 107, 118, 22,
+        1, 82, 27, 69, -68, -126, -125, 32, -94, 37, 81, 105, 32, -83, 37, -37,
+        42, -65, 53, 42, -128, -44, -39, -69, 41, 110, 43, -126, 86, 10, 15, 32,
+        -20, 106, -21, -30, 118, -74, 52, -33, 78, -99, 62, -114, -122, 54, -118, -125,
+        2, 117, -7, 19, 52, -42, 20, 59, -18, 10, 24, 71, 13, -104, -2, -112,
+        -115, 34, 75, 98, -41, 48, -84, -41, 79, 28, -57, 123, 108, -35, 57, 16,
+        -86, 33, 70, -30, -79, -95, -36, -82, -44, 7, 89, 70, -68, 122, 120, -65,
+        76, 103, 75, 49, 40, 68, -85, -78, 6, -118, 4, 123, -113, 106, 6, -121,
+        -17, 75, -37, -128, -88, -112, -113, 5, 89, 104, 1, 88, 24, 1, -123, -97,
+        79, 74, 70, 57, -5, -46, 11, 46, -88, 26, -103, 31, 6, 15, 124, -125,
+        81, 89, -69, 66, -32, -71, 75, 40, 56, -88, -116, -20, -71, 11, 68, 49,
+        -64, -73, -21, 12, 52, -96, 22, -99, 47, 77, -76, -4, -48, -6, -63, 25,
+        -16, -13, 67, 58, -96, 111, 74, -64, -100, -4, -128, 106, 81, -121, -116, -114,
+        -10, 80, -44, -63, 114, 99, -66, -20, -102, 101, -45, 68, -34, -112, -91, 22,
+        -51, -72, -37, 118, 109, -104, -47, 39, 79, 100, -42, 96, 36, -73, -64, 89,
+        2, -42, -116, 119, 37, -62, -59, -86, 3, 64, 117, 121, 15, -10, -66, 81,
+        -112, -50, 120, -78, 25, -77, 39, 70, 21, -38, -6, -39, 106, -89, -107, -40,
+        -83, 79, -111, -13, 24, -62, 31, 2, 64, -14, -29, -26, 53, -61, 90, -4,
+        10, -20, 94, 62, -17, -35, -53, 103, -39, -53, 103, 69, -37, -1, -41, 31,
+        -103, -65, 5, 64, -31, -4, -74, -60, -44, 111, -17, 11, -68, 13, 100, -79,
+        33, 118, -19, -69, 121, 80, 50, 106, 89, 77, -18, -127, -40, 21, -9, -61,
+        -41, -80, -106, -84, -28, -24, -88, -15, 74, 84, -18, 40, -46, 47, 34, 59,
+        63, 40, 120, -95, -42, -98, -72, -102, 10, 77, -62, -101, 49, 85, -91, -7,
+        116, 34, 2, 0, -93, 1, 53, 90, -1, 98, -70, -17, -44, -81, -105, 101,
+        113, 127, -128, 42, -69, 119, 101, -119, 112, -7, -113, -78, -56, 23, 7, -84,
+        -21, 3, 108, 114, -80, -30, 94, 12, -61, -125, 15, -128, 17, -85, -28, -32,
+        38, -2, -110, 28, 84, 112, -24, 15, 54, -59, -19, 1, -84, -19, 65, -67,
+        76, 14, -32, -52, -107, 0, -37, 70, -45, 52, 63, 40, -104, -71, 106, 79,
+        -40, -106, 3, 54, 88, -61, -127, -98, 123, -25, -108, -108, -59, 12, -5, -50,
+        -38, 70, -56, 49, 82, 43, 5, 14, -1, -11, 71, -126, 3, -22, -70, 95,
+        59, 45, 82, 37, -57, -127, 105, 38, 24, -35, 118, -124, -26, 50, -67, -116,
+        -13, -56, -52, -78, 8, 125, -16, 84, -59, -1, -83, -65, -101, -108, 116, -45,
+        114, 78, -25, -113, -126, -53, 96, -50, 115, 17, 41, -81, -87, 17, -120, 121,
+        -102, 97, -61, 50, -63, 67, -95, 57, -54, 85, 30, 71, -67, -96, -76, 51,
+        56, -110, 62, 55, 109, 43, -120, 89, 114, 52, -83, 51, -81, -93, -113, -62,
+        -87, 79, 17, -31, 4, 7, 99, 10, -77, -34, -95, 73, 33, 90, 101, -52,
+        9, 94, -15, -49, 125, 0, -60, 84, -14, 49, 97, 92, 21, 17, -50, -25,
+        -34, -72, -99, 17, 87, -88, -66, 96, 10, -11, -58, 51, -68, 117, -125, 3,
+        -18, 97, -64, 24, -32, -78, 57, -54, 107, 126, 33, 101, 33, 4, 53, 41,
+        -30, -1, -7, -93, 65, -21, -45, 121, 89, 84, -43, 50, 78, -53, -22, -55,
+        57, 33, -7, -91, -48, -99, 113, 97, 103, -91, -62, -101, -55, -18, -15, -64,
+        103, -80, 58, -15, 28, -79, 39, -91, 44, 110, -85, 57, 7, 6, -7, -29,
+        50, 6, 20, 66, 66, 126, 103, -121, -108, 118, -69, -120, -8, -59, -38, -9,
+        101, 113, 3, 64, -50, -97, 126, 45, -56, -124, -102, 39, -82, -90, -78, -91,
+        122, -122, -46, 25, 60, 85, 117, -79, -86, 2, -52, 78, -101, -28, -15, 85,
+        -106, -52, -125, 5, 6, 106, 1, -15, 61, -72, -123, 31, 80, 26, -84, -32,
+        -17, 85, 118, 91, 6, -41, 17, -73, 32, 13, -82, -32, 23, -17, 39, -40,
+        -20, 26, 35, 53, 97, -18, 111, 109, -11, -40, 69, 102, 79, 44, 15, -91,
+        66, 34, -37, -71, -124, -89, -17, 99, -17, -67, -98, -52, 111, -119, -111, 91,
+        49, 48, 57, 11, 24, 51, -93, 63, -66, -80, -90, 75, 84, -42, 111, 127,
+        -62, 56, -77, -74, 47, -109, -44, 10, -97, 18, -115, -24, -10, -45, 23, 86,
+        -102, -75, 43, 85, -75, -89, -89, -64, -6, -30, 63, 62, 126, 57, -93, 56,
+        111, 95, 34, -98, 19, -2, -11, -82, -17, -103, 93, -68, -122, 46, 94, -77,
+        46, 94, -93, -13, -54, 61, 75, 40, -18, -70, 44, -100, 105, -32, -70, -58,
+        -44, 122, -8, -33, 73, -8, 37, 96, 55, 52, -81, -59, 13, -51, -105, 0,
+        87, 62, -36, 4, -116, -52, -124, -67, -68, -56, 19, 16, -36, -15, -19, -128,
+        111, 92, 47, 108, 31, -91, -40, -37, -86, 46, -117, 47, 73, 71, 69, 86,
+        -127, 67, 69, -113, 61, 13, 104, 48, -67, -35, -83, -72, -58, -128, -73, -102,
+        -57, 80, -118, 10, -90, 61, 90, 98, 93, 82, 70, 97, 48, 108, -38, -67,
+        84, 59, 54, -34, 125, -16, -128, 16, 28, 46, 2, -128, -33, -16, 54, 64,
+        -24, 13, 87, 1, -115, 50, -68, 14, -8, -20, -62, 43, 22, 6, -91, 37,
+        -87, 46, -73, -12, 51, 51, 59, 126, -2, 125, 8, -61, -46, 47, 34, 95,
+        37, -5, 51, 50, 95, 94, -59, -27, -121, 120, -2, 125, 81, -14, -85, 122,
+        -60, -45, -58, 17, 114, 116, 96, -104, 3, 104, -48, 60, -120, -125, 81, -32,
+        -56, 90, -39, -113, 41, -89, -80, -79, -123, 105, 99, -123, -43, 43, 110, 6,
+        88, -75, -126, -25, 70, 3, -49, -19, -82, -107, -83, -4, -83, 48, 87, -5,
+        -86, -111, -114, -126, 17, 17, -22, -35, 99, 25, 44, -55, -111, 99, -9, -112,
+        74, -115, -44, -4, -97, 63, -110, -44, -112, -23, -39, 95, -109, 106, 5, -116,
+        18, 72, 65, -25, -76, -123, -5, 59, -39, -92, -102, 11, 49, -45, 59, -105,
+        -78, 47, -61, -20, -85, 50, -117, -124, 79, 71, -43, -23, -89, 57, -92, -48,
+        -52, 43, -108, -8, 95, 37, -38, -61, 116, 28, -22, -113, -81, -12, -118, -45,
+        -63, 56, 28, -95, 123, 95, -55, -116, -23, 60, 97, 66, 66, -20, -87, -9,
+        -80, -59, 96, 116, -115, -125, -47, 8, -61, 58, 114, -122, 97, 29, -23, 97,
+        88, 71, -105, -31, -61, 22, -45, 91, 35, -84, -85, 1, 64, -9, -100, -53,
+        78, 115, 16, 57, 9, 74, 94, -115, -90, -115, 119, 97, 53, 43, -109, 36,
+        -25, 104, 23, -42, -81, 120, 21, -117, 84, 28, 27, -50, -33, 18, -104, -93,
+        86, -86, -14, 74, -19, -98, -125, -5, -13, -98, -13, 0, 53, -64, 1, 43,
+        -114, 56, -89, -35, 87, -49, 98, -121, -16, 117, 50, 4, 118, -90, 4, -48,
+        77, -44, -114, 115, 79, 48, -52, 72, 64, -31, 15, 84, 58, -46, 70, 8,
+        -19, -30, 12, 35, 104, 107, 83, -91, -60, 89, -50, -79, 82, 69, -50, 127,
+        -61, 0, -65, 110, 64, -2, -106, -16, 74, -25, -94, 96, 40, -5, 73, -18,
+        -24, 29, -125, 14, 122, -71, -71, 46, 124, -118, 5, 66, -127, 66, -98, -83,
+        67, 104, 63, 6, 12, -106, 106, -97, 118, -62, 123, 80, -128, -3, 11, -17,
+        -117, -76, 9, 19, -125, -59, -113, -76, 24, -53, 117, -3, 53, 103, -104, -71,
+        -56, 72, -57, 57, -27, -56, -104, 26, -114, -116, 105, 69, 22, 32, -33, -25,
+        -104, -50, -120, -65, -7, -127, -7, -53, -68, 77, 43, -82, 53, -97, -125, 96,
+        13, -32, -41, -27, 67, -109, -70, 28, 6, 121, -93, -31, 92, -11, -12, -8,
+        -72, -45, 29, -57, -39, 21, 111, -92, 119, 37, -122, 11, 82, -116, 62, -44,
+        -76, -51, 117, 81, 107, -118, 74, 44, 110, 101, -106, 58, 115, 89, -22, -79,
+        -18, 28, 53, -66, 34, 80, -11, -37, -28, 58, -66, -51, 106, 102, -30, -24,
+        25, -105, -118, 70, 81, 27, 57, 14, -36, 78, -117, 107, 83, 67, -51, -56,
+        -63, 63, -128, 28, 104, -54, 24, -92, 9, 58, 77, 1, -39, -7, 38, 25,
+        52, 93, 86, -24, -3, -16, 6, 29, 95, -76, -128, -25, 106, -6, 52, 62,
+        118, 11, -19, -15, 48, -48, 112, -92, -83, 114, 95, 68, -31, -93, 100, -91,
+        -20, 103, 40, -84, -75, -11, -85, 6, 14, -96, 52, -101, 85, -103, -52, -109,
+        107, 32, -99, 115, 15, 37, 68, -69, -114, -11, -119, -64, -76, 56, -75, 7,
+        -96, 65, -112, -107, 62, 25, 100, -32, -90, -22, -46, -86, 12, -8, 25, 83,
+        53, -74, 14, -95, -59, -33, 92, -102, 115, -40, -35, -59, -105, -62, -102, 3,
+        -106, -50, 107, -106, -113, 48, 108, -83, 35, 57, -60, -44, 75, -12, -61, 57,
+        10, 42, -17, -127, 65, -122, 26, -101, -110, -18, -89, -74, -89, 26, 124, 23,
+        9, -112, -5, 117, 56, 10, 29, 5, -127, -82, 124, -113, 109, 5, 123, 28,
+        -36, 83, -62, -91, -80, 34, 97, 54, -80, 59, 96, -48, -21, 18, -42, 107,
+        -57, 122, 98, -118, 18, 74, 107, 19, 52, -96, 47, 47, 102, 75, -112, -15,
+        18, 33, -56, -119, -123, -91, 64, 64, 45, 14, 121, 19, -49, -119, 11, 100,
+        -78, -7, 38, 70, -93, -128, -42, -115, -18, -112, 56, -77, 30, -97, -75, 124,
+        73, -49, -35, -39, 62, 116, -58, -38, -27, -47, -8, -40, 43, -113, -37, -85,
+        1, 95, 55, 79, 126, 68, -101, -34, 10, -8, 120, -44, -31, -20, -88, 11,
+        -62, 46, 75, 7, 57, -102, -52, -50, -54, -55, 76, -60, 56, -99, -13, -120,
+        -3, -104, -35, -76, 36, 85, 70, 54, -11, 48, 57, 5, -75, 98, 94, -109,
+        -125, -15, -77, 101, 80, 80, 34, -21, 28, 14, -103, 85, -86, -118, 2, 110,
+        15, 63, -9, -73, -115, 83, 32, -93, 9, 109, -103, -29, -128, 93, 65, -78,
+        106, -20, 84, 67, 55, -17, -42, 117, 25, 115, -92, 103, -41, -10, 39, 23,
+        36, -55, -11, -124, -20, -44, 107, 9, 33, -36, -64, 69, 120, -75, -57, -6,
+        80, 16, -82, -34, 69, -38, -55, -103, 90, -25, 45, 92, -124, -82, 22, -51,
+        -114, -91, 99, 70, -46, 62, 15, 85, -101, 64, -71, -119, 50, -15, 12, -67,
+        111, 58, -26, 107, -57, -78, -91, 70, -92, 13, -77, -75, -50, -82, -49, -56,
+        41, -20, -40, -115, -106, -26, 1, -122, 119, 107, -50, 73, 39, -85, -92, 81,
+        28, -82, -118, 108, -77, -64, 71, -91, 38, -47, -89, 72, -107, 62, 56, -22,
+        68, 23, 18, 92, 29, 52, 104, -38, -5, -45, -117, 19, -4, 95, -113, -117,
+        -3, -105, -31, 62, 125, 62, 113, -100, -5, -82, 81, -21, 7, -125, 19, -25,
+        42, -35, -64, -60, -48, -126, -69, -79, 26, 102, -127, -79, -49, 86, 81, 75,
+        95, -5, -114, -40, 108, -91, 24, 14, -85, -59, 127, 32, 61, 51, 11, -83,
+        44, -8, -108, 10, -77, -81, -57, 45, 120, -101, -101, 126, 70, 116, -127, 36,
+        18, 44, 63, 1, -115, -101, -20, 100, -20, 98, 39, -29, 46, 118, -110, 22,
+        -121, 5, 65, -29, -26, -23, 64, -111, -80, -115, 115, -72, 100, -69, 27, 55,
+        40, -89, -98, -21, -89, 45, -20, -53, -77, -106, 46, 81, -106, 103, -65, -50,
+        84, 68, -21, 50, 2, 38, 77, 88, 7, 20, -128, -20, 11, 64, -10, 5,
+        32, -5, -102, 71, 67, -70, 40, 46, -43, -122, -34, -82, 48, 54, -43, -81,
+        120, 112, 58, 100, -111, -102, 45, 74, -60, -1, 62, 62, -126, 56, -118, 55,
+        99, 5, -102, 50, 70, -14, 23, -66, -97, 112, -15, 93, 59, -116, -80, -50,
+        25, -103, -21, -80, -101, 73, 122, -65, -126, 85, -85, 107, -70, 95, -45, -97,
+        67, 121, -88, -31, 8, -13, 119, 47, -32, 12, -13, -97, -29, 30, 83, 47,
+        -45, 14, 73, 11, -12, 105, -29, -115, -47, -51, -97, -82, 95, 94, 127, 115,
+        -3, 45, -12, -14, -89, -25, -33, 60, -97, 63, -65, -18, 77, -92, -40, -49,
+        7, -50, 6, -127, -46, -113, -35, 83, 20, 7, -42, 16, 49, -70, -117, 58,
+        15, -110, -9, 116, -80, -34, -43, 125, 90, 3, 53, 50, 47, -53, -116, -66,
+        -4, -121, 89, 92, 37, 106, 118, -31, -100, 113, -13, -95, 33, -123, -11, -2,
+        52, 26, 125, -5, -3, -9, 111, -128, -44, -63, -81, 119, -49, -65, 123, -119,
+        -65, -66, 127, -9, 102, 52, -2, -114, 126, 125, -1, -30, -12, -27, 8, 127,
+        125, -13, -51, -23, -37, -73, -93, -34, 37, -53, 52, 53, -47, 59, 7, 76,
+        104, 117, -6, -4, -6, 116, 124, 117, 74, -99, 62, -113, -65, -69, 126, -127,
+        -65, 94, -52, -30, -21, 83, -22, -22, -6, -69, 89, 50, -98, -77, -18, -65,
+        -5, 118, -28, -18, -12, 121, -77, -45, -25, 87, 39, -13, 107, 108, 118, -6,
+        -30, -27, -69, 111, 94, -29, -81, -7, -117, -45, -109, -105, -88, 121, -3, -45,
+        -8, -7, -4, -37, 56, -58, 95, -81, 79, -65, -5, -26, -37, 55, -50, 78,
+        95, 52, 58, 125, -111, -52, -26, 51, 26, -33, -20, -101, -21, 23, 47, -23,
+        -41, -73, -29, -73, 47, -66, -89, -18, -81, -25, 47, -29, -105, -79, -10, 73,
+        87, -89, -89, -115, 78, 79, -82, -66, 27, 125, 123, -51, -90, 26, 63, -113,
+        -87, -45, -17, 70, 73, -14, 13, -115, -12, 58, 126, -15, -30, -59, 115, -4,
+        -11, -14, -69, -7, 73, -14, -115, -77, -45, -105, -51, -111, -66, -8, -18, -19,
+        -37, 49, -83, -38, -73, 47, 95, -98, 80, -89, -17, 94, 63, -121, -127, 81,
+        87, 47, 79, -34, 125, 71, -37, 120, 126, -6, -10, -37, -105, 111, -99, -99,
+        126, -45, -24, -12, -19, 55, 39, 47, -97, -65, -91, -11, 123, -13, -35, 119,
+        -33, 82, 7, 39, -17, 78, -66, 123, -15, -114, 62, -12, -30, -27, -24, 57,
+        117, -1, -18, -28, 124, -12, -30, -123, -77, -45, 111, 27, -99, -86, -79, -88,
+        -111, 126, -1, -35, -7, -73, -93, 119, -26, -104, 95, 60, 127, 115, 126, -18,
+        30, -23, 119, -115, 78, 79, -49, 95, 124, 3, 52, 87, -19, 47, 110, -44,
+        -37, -45, 55, 47, -50, 105, 123, 94, -97, -68, 62, -7, -122, -90, -1, -30,
+        -51, -101, -41, -33, 59, 59, 29, -113, 26, -67, -66, 126, 62, 26, -67, -91,
+        -63, 124, -13, 118, 116, -14, -114, 122, 61, 125, 121, -6, -4, 123, 26, -22,
+        -55, 119, -33, 62, -1, -2, 123, 118, 54, -34, -116, -65, 63, -23, 93, 26,
+        94, 108, -84, 27, -91, 16, 73, -22, 63, -6, -2, -84, 77, 110, 39, 23,
+        37, -76, 61, -1, 120, 123, 69, 54, -24, -98, -16, -56, 11, -38, -54, 43,
+        -2, -85, -25, 27, 10, 119, -93, -42, 30, -26, 31, -4, 59, 36, 68, 75,
+        -5, 25, 122, -89, -100, 117, -60, -89, 12, -93, 46, 25, -99, -9, -124, -100,
+        -84, 68, -24, -124, 82, -122, 101, 33, 51, 18, 21, 0, -122, 91, -119, -58,
+        -47, 24, -19, -33, -123, -123, -86, 17, -69, 69, -104, 101, -70, 62, 51, 96,
+        -51, -56, -12, 50, -120, -5, -14, -117, -97, -32, -21, 21, -13, -71, 2, 1,
+        -57, 75, 109, -17, -90, -15, -56, -17, -89, -56, -93, 44, 82, 116, 57, -48,
+        -94, 90, 40, -121, -77, -62, -66, 121, 48, 92, -58, -30, 96, 19, 86, 34,
+        36, -124, -19, 114, 101, -124, 114, 104, 119, -84, 74, 59, -67, -88, -46, 46,
+        -105, -87, -44, -16, -113, 18, 87, 49, -29, -83, 63, 41, 92, 49, 67, 72,
+        27, 3, 16, -82, -87, 97, 116, 71, -99, 1, 119, -57, 9, 76, 67, 30,
+        117, -119, 92, -24, -95, -51, -46, -3, 15, -128, 110, 123, 122, -114, -121, -63,
+        113, 2, 40, 6, -91, 6, -98, -25, 69, 81, -50, -85, 61, -128, 116, -60,
+        61, 39, -38, -127, 85, -102, -101, 55, -95, 86, 22, 5, -27, -109, -51, -105,
+        92, 75, -89, 121, 50, -107, 71, 71, -121, -107, -128, -95, -78, -43, -70, 59,
+        -115, -124, -75, -81, 14, -39, -102, 82, -91, -32, -34, -99, -3, -45, 80, -4,
+        -28, -53, -57, 93, -55, 82, 113, 81, 25, 111, -11, -12, 114, -17, -109, 5,
+        28, -120, 10, 63, -13, 84, -17, -128, 36, 99, -115, 81, -123, 55, -111, -73,
+        100, 25, -67, -29, 67, 32, -69, -68, 21, -39, 113, 88, -27, 42, -52, -102,
+        8, -59, -42, 81, 9, -19, 84, 57, 12, 3, -33, -54, -18, -124, -75, -63,
+        -64, 1, -105, -63, 90, 122, -85, 117, 79, -104, -4, 52, -84, 54, -41, 45,
+        -21, -101, -8, 50, 5, -69, 8, 99, 72, -95, 74, -51, -47, 40, 119, 4,
+        -69, 68, -71, -58, 34, -32, 14, -77, 5, -10, 26, -63, -63, 79, -121, 107,
+        -118, 43, -77, 17, -117, -97, -14, -123, -31, -73, -57, 76, 14, 99, -81, -90,
+        -88, -23, -94, -41, -37, -48, -43, 23, -69, 122, 22, -2, -128, -94, -125, 45,
+        -113, -112, -43, -67, -60, 12, 67, 118, -82, -16, 120, 120, -6, -52, -2, 44,
+        27, -50, -85, -70, -127, 74, -123, 119, 81, -93, 110, -44, -84, 123, 12, 61,
+        -5, -127, 93, -35, -128, 65, -76, 30, -84, 106, -106, -33, 8, -115, 38, 40,
+        -57, 4, 8, 38, -99, 70, -49, 50, -118, -36, -67, -99, -2, 21, 47, 54,
+        63, 41, 115, -61, -10, 120, -101, 86, 56, 0, 127, 42, 36, 25, 68, -114,
+        -24, -101, 41, 34, 60, 114, 51, 103, 124, 12, 110, -47, 54, 8, 14, 100,
+        114, -95, 50, 76, 87, -66, 100, 3, 82, -123, -5, -30, 63, 28, -9, -111,
+        7, 49, -45, 127, -76, 96, 62, 83, 5, 79, -88, 79, -31, 11, 51, -52,
+        -74, 35, -26, 70, 75, -28, 115, 6, -90, 82, -80, -44, -69, 52, 51, 2,
+        -22, 68, -63, -118, 46, 34, 53, -37, 122, -26, -7, -95, -104, 19, -58, -99,
+        -8, -88, 42, -77, -55, -95, 114, 78, 120, -62, -58, 28, -3, 9, 36, 38,
+        112, -100, -10, 65, -26, 8, -7, -119, -121, 43, 57, 28, -45, -91, -40, -125,
+        14, 120, 4, -113, -33, -125, 20, -99, -50, 19, -114, -8, 34, 121, 124, -110,
+        61, -114, 79, -46, 122, 124, -110, 22, 100, -127, 57, 98, -100, 39, 101, 34,
+        -116, 6, -38, 66, -70, -96, 15, -112, -21, 112, 0, -80, -110, -55, 89, -92,
+        -6, -99, -89, 55, 63, 36, -39, 10, 85, 40, 93, -57, 9, -17, 90, 49,
+        88, 116, -69, -125, 35, -112, 32, 119, 32, -103, -111, 12, 36, -45, -99, -119,
+        81, -20, -78, -72, 36, -97, -42, 97, 66, 73, 25, -123, -73, 48, -78, 73,
+        -65, 106, -56, -125, -84, 52, -78, -88, -100, -96, 59, -81, -66, 4, 30, 122,
+        -27, 102, -63, 67, 26, 50, -122, 11, -107, -4, -119, 92, -99, 80, 11, -32,
+        45, -5, 65, 57, 26, -118, 49, 94, 117, 112, 79, -33, 45, -102, -99, 22,
+        -65, -69, -45, 61, 15, -115, 84, -76, -107, 64, 5, -111, -31, -32, -7, -37,
+        74, 127, 8, 63, 110, 60, -33, -25, 11, -34, 27, 115, -118, -75, -44, -103,
+        72, -75, 58, -77, 104, 73, -79, -73, -127, 119, 64, -16, -63, -37, -31, 100,
+        -113, 40, -82, 126, 48, -113, 40, -69, 74, -55, 125, -71, -25, 118, 63, -59,
+        126, -3, -64, -116, -27, 49, -100, 113, -110, 16, -51, -39, -113, 41, 127, 17,
+        -50, -51, -13, 57, -29, -25, 19, 43, 114, -14, 38, 94, -123, -30, -51, -42,
+        103, 109, -98, -91, 10, 106, 26, 60, -5, -114, -29, -85, -107, 19, -76, -38,
+        -115, -48, -98, -27, 67, 60, 39, -21, 58, -57, 107, 58, -40, 44, 118, -91,
+        123, 41, 24, 78, -47, -114, -73, -93, -12, 117, 118, 31, 111, 42, -78, -12,
+        60, 108, 61, 92, -70, 33, -65, -123, -88, 70, 19, 118, 67, -31, 8, -21,
+        108, 109, 88, -67, -41, -122, -19, -84, -60, -59, -121, -90, 23, 122, -57, 36,
+        -125, -34, -63, -120, -36, -52, -126, -61, -79, -65, -99, -52, 34, 4, -28, 64,
+        -127, -42, 2, -40, 126, 84, 16, -78, -83, -115, 60, 9, 0, -19, -5, -17,
+        35, 103, 16, 8, -58, 65, 64, 86, 11, 96, -15, -36, 23, 29, -40, 94,
+        -102, 114, -73, 69, -111, -94, -12, -15, -51, -64, 10, 126, -64, -33, -43, 38,
+        8, -117, -71, 24, -20, 50, 17, 43, -118, 42, -2, 36, 42, 60, 49, 97,
+        99, 25, 87, 100, 82, -52, -62, -109, -5, 6, -97, -82, -115, 108, -62, -115,
+        -83, -11, 43, 108, 107, 122, 20, -28, -124, 109, 109, -53, 109, -74, 60, -58,
+        109, 64, 108, 1, 79, 101, -124, -54, -62, -15, 117, -60, 70, 39, -23, 104,
+        75, -82, -79, -19, -60, -86, -6, 90, 98, 85, -7, -36, 124, -4, -90, 73,
+        48, 114, 27, 37, -58, 24, 127, 44, 19, 108, -68, 0, -52, -91, 93, -79,
+        -128, -118, 104, 22, -56, 87, 59, 19, -8, 108, -55, -63, -114, -65, 8, -105,
+        38, 48, 100, 18, -97, 45, 5, 60, -117, 87, -31, 82, -29, 69, 58, 96,
+        47, -19, -126, -67, -44, -4, 92, -38, 10, 123, -65, 118, 72, -67, 13, 121,
+        109, 20, 80, -14, 15, 35, 67, -56, -114, -72, 57, -82, -27, -74, -112, 80,
+        123, 28, -103, 61, 98, -43, 76, -48, -127, -127, -51, 53, -115, 98, -89, -92,
+        -102, -56, 85, 112, 77, -33, -63, 39, -18, 62, 126, 106, 62, 22, 87, -38,
+        30, 13, 79, 114, -55, -102, 33, -110, -85, -121, -114, -45, 65, -93, 34, 39,
+        -33, 40, -19, -26, -101, -76, -125, -21, -63, 26, 86, 5, 44, 89, -62, 92,
+        78, 62, 23, -73, 7, -53, -8, 46, 57, 0, 94, -77, 74, -81, -78, -51,
+        65, 117, 11, -62, 72, -102, -52, 15, -46, 28, -66, 0, 13, -111, 55, 57,
+        96, 108, -118, 116, 67, -95, 74, -101, -125, -8, -128, 85, -7, -81, -8, 46,
+        -2, 56, 43, -45, 85, 77, -75, 123, -56, -110, -123, -19, -36, -102, 56, 70,
+        -29, -31, -24, -12, 25, 96, -99, -35, 80, 17, -17, -55, 75, -76, -109, 124,
+        105, 122, -70, -101, 30, 83, -22, 0, -47, 14, -51, -36, 50, -112, -49, 0,
+        127, 40, -110, -22, 107, -73, 38, 24, -24, 4, 87, 60, -50, 120, -52, 19,
+        94, -19, 41, -42, -96, -62, -67, 69, 93, 117, 82, 88, 117, -107, -38, 4,
+        81, 28, 103, -20, 99, 119, 52, 61, -76, 90, -117, 91, 34, -12, 65, -103,
+        -116, -90, 99, 91, 27, 43, -1, -16, -42, 8, 25, -128, 15, 53, -80, -54,
+        -3, -121, -86, 17, 13, -92, 9, -96, -52, 23, 25, -107, -126, -80, 122, -107,
+        -26, -79, 10, 96, -81, 60, 83, 106, 127, -21, -27, 64, 59, -12, -10, 36,
+        55, -70, -50, 2, -6, 79, 58, -49, -120, 110, 49, -101, 71, -18, 74, -104,
+        -10, 42, 107, 43, -21, -20, 119, 48, -66, -108, -110, 88, -65, 0, -82, -30,
+        -101, -45, 65, 98, 51, -123, 127, 37, -75, 11, -46, 3, 81, 117, -64, -86,
+        -10, 27, 85, -33, -93, 43, -58, 44, 114, -60, 4, 111, -120, -122, -119, 67,
+        93, 50, -102, 58, -34, -122, -93, 73, -10, 42, 86, 124, 109, -84, 71, -2,
+        -96, -76, 109, 109, 80, 3, -80, -68, 60, 27, 96, 90, 25, 10, -16, 122,
+        88, 107, 81, 86, -56, 50, -16, -48, 78, -77, 108, -25, 86, -81, 90, 50,
+        -76, 55, -117, -76, 84, -21, 122, 9, 70, 63, 98, -117, -27, -53, -111, -70,
+        -128, 120, -60, 12, 81, -115, 76, 74, -91, 88, 13, -125, -25, 62, 43, 40,
+        -62, -121, -63, -60, 117, 47, 66, -88, 122, 101, 106, 83, 119, -73, -57, 39,
+        45, 91, -17, -6, -34, 97, -22, 68, 50, 40, -98, -111, -39, 101, 82, -33,
+        39, 9, -13, 25, -75, 73, -37, -20, -53, -121, 44, -98, 81, 80, -108, -57,
+        -57, -42, -125, -55, -110, -100, -48, 112, 48, -32, 18, 13, 36, -126, 49, -10,
+        -127, -121, -58, -93, 53, -87, 90, 51, -12, -94, 1, -16, 67, 62, -11, -110,
+        -90, 32, -125, -117, -89, 119, -117, -16, -54, 123, 13, 90, -66, 22, 102, -44,
+        -95, 17, 32, -94, -6, -61, -43, 83, -101, 125, -43, 83, 13, -89, -1, -117,
+        -53, -128, -82, 117, 68, -78, 12, -109, -44, 76, 108, -34, -34, -27, 109, 87,
+        6, -123, 64, 48, -122, 111, 126, 97, -101, 7, 14, -58, 36, -56, 27, -15,
+        116, 53, 85, 71, 113, -119, -122, 107, -60, -79, -37, 121, 41, 10, 74, 38,
+        -81, -79, 117, -102, -115, -119, 124, 127, -109, -26, 66, 71, -70, 108, -66, 5,
+        -7, 105, -113, 94, 51, 51, 114, 48, -101, -105, 30, -70, -73, -111, 112, 2,
+        70, 61, -113, 50, -111, -95, -42, -99, -84, 88, 22, 7, -117, 40, -21, -42,
+        -25, 112, -55, -125, 47, -68, -108, 63, 82, -95, -60, -104, 17, -99, -15, 117,
+        -103, 35, 21, 50, -121, -96, -19, -2, 43, -39, 46, 86, -19, 18, -69, 93,
+        44, -38, -59, -46, -14, -106, -79, 33, 115, 63, -72, -115, 22, -47, -52, 67,
+        -93, 119, -125, -117, 93, 48, 22, 97, -95, -62, 88, 44, -60, -36, 49, -1,
+        100, -121, 16, -114, 9, -40, -19, -128, -64, -106, 86, 116, -47, 33, -54, -84,
+        48, -122, 46, 14, 104, 47, 8, -61, -15, -41, 79, 19, 122, 22, -63, -118,
+        25, 44, 94, 11, -98, 75, -109, 122, -82, -94, -122, -56, 94, -74, 73, -23,
+        119, -47, -75, -55, -96, 1, -61, -46, 34, -15, -107, -83, 26, -126, 43, 20,
+        -10, -125, 77, 116, 55, 89, -64, 114, -33, -110, 123, -96, -43, -19, -19, -41,
+        118, -117, -26, -76, 100, 33, -60, -71, 126, 111, -7, 106, -61, 72, -27, -29,
+        -29, -14, -43, 29, 23, -57, -106, 33, 127, 41, -33, -16, -25, -112, 63, -5,
+        -3, 88, -120, 11, 27, 33, -93, -35, 9, 17, 77, -68, 9, -17, -92, -54,
+        -119, -87, 17, -52, 79, -21, 2, 25, -39, -7, -22, 98, -57, -26, 41, 82,
+        -105, -119, -46, -10, 66, 91, 9, -38, 99, -77, 76, 102, 38, 66, 73, 26,
+        -46, 89, -27, -128, -119, 50, 114, -88, 113, -84, -64, -128, 28, 36, 120, -12,
+        40, -75, 119, -6, 23, -126, -60, 29, -38, 51, 105, 11, -31, 89, -30, 38,
+        78, -52, -123, 44, 76, 41, -74, -8, -6, 85, -1, 21, -58, -98, 125, -106,
+        20, 124, 79, 81, -105, -33, -15, -42, 14, -76, 46, 89, 97, -118, -28, 24,
+        -108, 78, 58, -93, 123, 80, 21, -127, 10, 30, 105, -14, -28, -7, -91, -70,
+        15, 70, 74, 81, 8, -66, 15, 24, -118, 108, 10, 72, -65, 16, -127, 7,
+        3, 71, -88, -127, 122, -97, -56, 122, -108, -7, 13, 25, 111, 34, 34, -53,
+        65, 33, -62, 13, -6, 126, -72, -116, -78, -57, -57, -46, -94, 33, -71, 15,
+        -8, -3, 52, 104, -114, 84, -58, -76, -118, -5, -47, 50, 76, -31, -97, 32,
+        -127, 127, -74, -109, -58, 112, 54, 58, -31, 118, 93, -102, 21, -12, -57, 116,
+        -32, -36, 104, 39, 99, -33, 54, -115, 107, -121, -61, -90, -117, -91, -70, 107,
+        -11, -12, 107, 103, 99, -116, 88, -113, 45, -76, 123, 60, -86, 124, 108, 92,
+        64, -102, -116, -66, 72, -97, -26, -30, 25, 35, -112, 106, 21, -65, 84, -2,
+        -63, -4, 18, -29, -24, -128, -122, -97, 23, -39, -19, 77, 14, 64, -96, 121,
+        -98, -18, 50, 105, 96, -105, 119, 98, -38, 121, -127, 33, -124, 80, -61, 39,
+        77, 3, -78, -20, -93, 112, 118, 96, -14, -99, 72, -87, 53, -30, 26, -115,
+        -90, 68, 40, -4, -116, 106, -53, -85, -88, -90, -108, -98, 74, -92, -32, -81,
+        -124, -80, 64, 97, 51, -12, -56, -39, 74, 112, -32, -95, 42, 83, 47, -10,
+        -107, -75, -123, 97, 84, 26, -114, -51, -103, -52, -118, -101, -85, 2, -66, 123,
+        -114, 57, 122, 41, -2, -121, 126, 35, 101, -108, -22, -124, -34, -110, 98, -35,
+        -74, -7, -87, -89, 2, 3, -107, -125, 104, 76, 112, 105, -115, -70, 98, -7,
+        40, -23, -69, 64, -5, 60, 28, -70, -66, -82, -42, -8, -4, -74, 48, -33,
+        -121, 29, -41, 108, -91, -72, 4, 37, -121, 122, 118, -55, 28, 95, 85, -38,
+        42, 104, -119, 77, 7, -51, -73, -108, 123, 54, 59, -117, -98, -61, 40, 117,
+        38, 86, 101, -27, 68, 76, -106, 29, -41, -38, 2, -119, 28, -100, -6, 120,
+        -59, -69, -29, -126, 22, 58, -113, 92, 69, 126, -112, -65, -86, -113, 79, -80,
+        -4, 56, 58, -127, 21, 1, 42, 116, 92, 62, -109, -26, 82, 73, -101, 15,
+        -37, -116, -96, -102, 5, 37, 31, -113, -4, -29, -15, 104, -28, -97, -115, -55,
+        46, 121, -116, 119, -21, -43, -79, 87, 34, 58, 14, -47, 62, -96, 127, -86,
+        -115, -43, -27, -119, 29, 85, -30, 8, 85, -118, 78, -56, 19, 84, 119, -102,
+        -84, -75, 81, 104, -7, 69, 97, 1, 78, 56, 0, 8, 6, 76, -18, 11,
+        10, -97, -113, -113, -121, 78, 99, -101, 81, 56, 30, 77, 46, -72, 41, 81,
+        -96, -20, -24, 46, -35, 33, -100, 26, 81, -53, 49, -75, 36, 18, 93, 68,
+        -54, -6, 59, 102, 99, 22, -62, -37, -6, 9, 99, 57, 69, 48, 62, 76,
+        28, 54, 41, 116, 72, -123, 113, -51, -45, -17, -82, 13, 124, 34, -65, 8,
+        -36, 54, 12, 112, 60, -14, -11, 92, -109, 14, 38, -41, 97, -89, -91, 76,
+        18, -53, -89, 53, 83, -106, -118, 24, 35, 80, -58, -123, -120, -12, -121, -127,
+        -52, 7, 81, -118, 31, 49, -16, -104, 42, 118, 106, -92, 63, -12, 69, -19,
+        -66, -88, -35, -113, 117, 71, 71, 12, 109, -113, 113, 121, 1, -72, -34, -34,
+        114, 86, 100, -17, 0, -33, 13, -7, -75, 51, -20, 110, -123, 41, 69, 73,
+        27, -73, 87, -44, -35, -46, -57, 40, -100, 106, -113, 98, -117, 21, -64, 114,
+        -81, -46, -77, 27, -71, -94, -51, -70, 67, -48, 122, 9, -58, -12, -29, 68,
+        85, -2, -12, 7, -102, 113, -92, 65, -87, -53, -53, 22, -26, -97, 14, -4,
+        -16, 100, 48, 62, 113, -58, -79, -3, 116, 118, -46, 54, -82, 19, -33, -44,
+        82, 20, -11, -17, -116, 99, 41, 44, -88, -74, -20, 81, -111, 120, 32, 77,
+        -42, 27, -30, 7, 26, 111, 25, 43, 48, -46, 50, 43, 112, -24, 27, 9,
+        -73, 94, 121, 72, -99, -95, -86, 42, 81, 42, -29, -67, 48, -24, -112, 96,
+        79, 48, -109, -78, 84, 0, -66, 44, -92, 61, -91, -94, -54, 46, -6, 36,
+        -117, 98, -69, 8, -31, -106, 74, 74, -93, -60, 109, -5, -62, 39, -64, -15,
+        -88, 53, 120, 22, 86, -120, 105, -52, 3, 25, 63, -35, 92, 12, -95, 124,
+        26, 57, -8, 27, -92, 7, 79, 20, -103, 18, -107, -120, 91, -37, 57, 107,
+        -75, -122, -90, -43, -94, -16, 46, -46, 118, 1, 64, 75, -111, 37, -31, 91,
+        52, 79, 49, 46, 65, 45, 5, -127, -111, -122, -9, 68, -99, 10, 64, -105,
+        104, -70, -107, 51, 88, 95, 37, 103, 56, 99, -107, 62, 56, 9, 78, -24,
+        -66, 7, -75, -39, 21, -4, 25, 95, 78, 106, -47, -12, 34, -66, 84, 57,
+        -125, 43, -54, 12, 109, 123, 64, 101, 92, 51, 0, 3, 33, -69, 57, 25,
+        -72, 79, -24, -1, -22, 98, -91, -25, 29, 22, 44, -107, 22, 46, -28, -8,
+        -92, -47, -62, -22, -125, -47, -124, 39, 118, -61, 26, -111, -40, -82, 81, 31,
+        -23, 50, -98, -34, -96, 103, 40, -48, 126, 0, -79, -41, -78, -36, -13, 67,
+        103, -115, -97, -117, 92, -81, 100, 64, -17, -80, -123, -84, 123, -124, 73, 90,
+        112, -65, 61, -29, -127, 99, -20, -68, 57, 59, -5, -38, 111, -77, -82, -78,
+        20, 49, 52, -53, 3, -13, 4, 12, 12, -8, -97, 104, 22, 109, -51, 89,
+        -72, -40, 123, 79, -5, -66, -96, 105, -51, -127, -99, 60, 51, 40, -40, 39,
+        -99, -126, 125, -22, 55, -122, -35, 55, 6, -43, -9, 98, -52, -88, -35, 127,
+        17, 82, 44, -15, 54, 58, 104, -81, -100, -31, -19, -17, -34, -43, -33, -63,
+        96, 113, -76, 54, 116, 41, -117, 81, 37, -35, 82, 77, -109, -22, 60, -35,
+        -126, -51, -112, 7, 81, -119, -100, 56, 37, 65, 86, -46, 65, -126, 73, -39,
+        -34, -46, -83, -95, -76, -96, -84, -32, -4, -6, -102, 84, 125, -23, -42, 111,
+        -7, -88, -47, -82, 114, -76, -109, 103, 91, 35, 73, -115, -23, 91, -118, 16,
+        25, -11, -59, 32, 5, 67, -105, 105, -88, -89, -52, 46, -20, 106, 13, 3,
+        22, 15, 45, 45, -36, 117, -51, -91, -25, 78, 46, -71, -72, 81, 61, -57,
+        48, 59, 18, 58, 88, -83, 18, -92, -102, -62, 0, 57, -106, 59, 47, 106,
+        49, -34, -103, -38, -124, -11, -8, -37, 112, -16, -94, -47, -2, 83, 91, -5,
+        54, 17, -84, -21, 6, -7, 44, 26, -68, 56, -99, 14, -44, -105, -103, -87,
+        50, -100, -107, -96, -53, 62, 50, 109, -104, 29, 57, -90, -39, 20, -115, -70,
+        -20, 109, 24, -89, 116, -6, 12, 35, -114, 55, -5, 106, -68, -23, 78, -78,
+        -26, 88, -76, -58, -101, -18, -52, 118, 19, 45, 95, -118, -126, 75, -111, -38,
+        79, -37, 36, 64, 90, 26, -56, 9, -101, 124, -85, -46, 32, 23, -10, -18,
+        -68, -74, 6, 121, 18, -115, 55, -70, -111, 12, 124, 96, 20, 106, 39, 68,
+        109, -103, -88, -46, 50, 0, -98, 3, 28, -60, 53, -113, -57, -108, 116, 103,
+        -21, -110, 126, -69, -110, -119, -16, 73, -72, 30, 5, -124, -111, -117, 12, 56,
+        107, 110, 61, -32, -28, 55, 12, 78, -77, 97, -93, -113, 22, -108, 86, 27,
+        -12, -116, 80, 113, 106, 28, 35, 82, -33, -89, 32, 10, -51, -81, -14, 33,
+        -53, 3, -37, 102, -26, 32, -110, 7, -52, 117, 62, -38, -96, 42, -103, 77,
+        88, -91, 67, 5, -70, -10, -78, 75, 108, 46, 81, 45, -15, 34, -6, 41,
+        -45, 0, -7, -76, -19, -40, -113, 65, -116, 62, -11, 45, -86, 44, 47, -56,
+        -77, -19, -124, 123, -76, -18, 72, 26, 8, -21, 52, -117, 12, 40, 24, -20,
+        74, 24, 120, -86, -87, 125, 44, 105, -104, -5, -56, 114, -79, 57, 52, -24,
+        -26, 44, -104, 3, 10, -44, -100, 8, 113, 96, 102, 21, 13, 14, -124, 88,
+        -39, 104, 69, 6, -25, 118, -49, -58, -122, -24, -67, 48, 97, -84, 99, -117,
+        -106, 32, 100, -75, 45, 98, -93, -93, 65, -90, -113, -124, 25, 56, 116, 14,
+        -27, -113, -5, -16, -32, -108, 127, 90, 121, 29, 91, -47, 117, 25, 87, 127,
+        32, -74, -30, 32, 47, 106, -78, 99, 42, -48, -72, -70, -25, 111, 13, -2,
+        -86, 69, 70, 7, -66, 58, 6, 98, 102, -60, -105, -11, -121, -115, 76, 59,
+        94, 28, 84, 126, 43, -85, 99, -80, -89, 79, 112, -117, -46, -62, 13, -30,
+        85, -60, -60, -27, 39, -44, -23, 88, -28, -59, -47, -119, 84, -84, -12, 86,
+        105, -62, -83, 79, -12, 120, 79, -85, 2, -124, -124, -41, -80, -110, -114, -78,
+        121, -111, -33, -42, -10, -5, 41, 117, 20, 34, -2, 75, -29, 12, 117, -70,
+        20, -99, 70, -45, -41, 93, 84, -105, -110, -126, 20, 109, 69, -97, 88, 80,
+        100, 83, -65, -108, -38, 115, -16, -27, -99, -105, 6, 53, -119, 6, 53, -87,
+        33, 88, 50, -66, -43, 122, 71, 96, 25, 36, 26, 100, -3, -65, -28, -67,
+        9, 115, -37, 72, -110, 40, -4, 87, 40, 110, -84, 6, 48, 65, -118, -92,
+        -19, 62, 64, 65, 12, -113, -20, 30, 59, -98, -35, -19, 104, 123, 123, -92,
+        -47, 40, 38, 32, 18, 18, -47, -122, 0, 62, -128, -108, 72, -53, -4, -17,
+        95, 102, -42, 13, 20, 64, -56, -10, -68, -35, -115, 111, 122, -41, 34, -22,
+        62, -78, -78, 50, -77, -14, -48, 91, -61, 39, 41, 5, -82, 57, -39, 99,
+        58, -111, 14, -77, 89, -49, -119, 20, 40, 106, -19, -72, 71, 99, 87, 96,
+        -107, 120, -49, -55, -81, -99, 64, -11, -120, 99, 23, -6, 13, 81, 26, -70,
+        24, 73, 105, -32, 104, -114, -38, 122, -40, 21, -84, -13, -17, 30, -98, 5,
+        -111, -27, -67, -81, 29, 49, -61, 120, -10, 110, 45, -88, 34, -12, -116, -39,
+        117, -61, -11, 42, -29, 74, 56, 4, -44, -4, 117, 87, -101, -75, -34, 118,
+        25, 62, 74, 35, -82, -30, -42, -48, -126, 18, -37, -113, -75, -1, -4, -33,
+        57, 90, 32, 92, -66, 17, 105, 74, 36, -41, 76, -75, -37, 67, -65, 25,
+        -74, 90, -9, -98, -18, 81, -60, -44, 97, -97, -114, -3, 17, 97, 21, 14,
+        43, 18, 104, 34, 65, -54, 101, 90, 93, -35, 78, 111, 58, 26, -116, 125,
+        -107, -11, -10, -51, -81, -81, -2, -11, -6, -43, -101, -65, -67, -2, -8, -81,
+        -33, 95, 124, 124, -13, 27, 57, 87, -74, 19, 16, 99, -24, 116, 72, 14,
+        -105, 107, -8, 2, 113, -104, 117, 127, 43, -91, 83, 79, -49, -63, -109, -118,
+        104, 47, 127, -110, -11, -118, 39, 41, -36, -69, 37, 122, 83, 104, 121, 86,
+        -92, -127, 125, 49, -45, -109, -48, 74, 95, 75, -61, 85, 25, 91, 91, -21,
+        110, 79, 21, -41, -85, 41, 16, -89, -94, -51, 114, -109, -57, 123, 107, -76,
+        30, -123, -88, 82, 25, -123, 118, 111, 85, 101, -93, -62, -92, -119, -71, 0,
+        11, 77, -18, -37, -6, 60, -73, -64, 103, -113, -110, -70, -108, 55, -45, 19,
+        -61, 13, 37, 90, 24, -25, 99, 105, -110, -86, 49, -45, -117, 74, -79, -109,
+        -103, -91, -40, 76, -109, 54, -89, 95, -11, -58, -101, -36, 52, 40, -59, -79,
+        3, -6, 1, -71, -66, 122, 90, -62, 30, 102, -39, -23, 18, -77, -40, 5,
+        -66, -69, 28, 26, 10, -18, 117, -116, 10, 21, 109, 86, 71, -77, 66, 4,
+        16, -120, -54, -19, -96, -82, -57, -81, -39, 28, 42, -4, 115, -11, -49, -76,
+        3, -1, 19, 127, 59, 70, -8, 49, 118, 40, 58, 15, 42, -73, -45, -103,
+        -57, -59, 50, 9, -73, 126, -25, 58, -119, 54, 19, 61, 7, 53, -82, 97,
+        -17, -17, -3, 14, -30, 58, 35, -117, 95, -31, 126, 103, -40, 25, 13, -105,
+        122, -75, 93, 83, -49, -112, -78, -31, 63, -5, 82, 61, -105, 75, -19, -38,
+        22, -121, 107, -47, -100, 0, -114, -69, 127, -97, -121, 75, -65, -125, -1, 126,
+        -53, 80, 24, 69, -46, -74, 52, 94, 119, -106, -95, -52, 99, 12, 1, 1,
+        5, -4, 14, 123, 27, 53, 86, -114, -51, 22, 22, -18, 59, -84, -103, 94,
+        -104, 60, 98, -48, -112, 30, -77, -110, -33, -40, -62, -73, -82, -41, -97, -21,
+        98, 21, 95, 111, -5, 51, 22, 69, -100, -63, 96, -97, 28, 126, -4, 91,
+        -106, -121, -123, -92, -5, -74, 5, 98, 109, -20, -103, 7, 43, 52, -47, -49,
+        -31, -9, -101, -59, -29, 86, -35, 58, 9, 106, -94, -51, 94, 64, 83, 109,
+        119, -94, -49, 20, 62, -52, 86, 103, -21, -68, -56, 114, -65, 67, -2, -106,
+        97, 69, -12, 60, 20, 44, -12, -71, 16, 5, -24, -103, -4, 54, 76, -66,
+        -61, -82, -41, -113, -20, 81, 40, -90, -74, -107, -106, -56, -109, -83, 115, -68,
+        -118, 110, 11, 9, 14, 109, 23, -110, 34, 87, 27, -3, -120, -95, -7, -99,
+        60, 2, -102, 49, -66, -117, -116, -50, 80, -54, -40, -57, 87, 45, -65, 51,
+        122, -42, 30, 29, -77, -114, -98, -40, -42, -91, -49, 94, -86, 58, 79, -54,
+        -29, -96, 109, -20, -77, -80, 88, -72, 107, 105, -44, -70, 55, -34, -28, 99,
+        38, 38, -41, 55, 78, 9, 90, -82, -110, 108, -10, 105, -46, 22, -64, -104,
+        -98, 5, 3, 118, -65, -13, 116, -71, 41, 97, 98, -116, 104, -33, -89, -85,
+        -41, -17, 20, 89, 18, 3, -88, 87, 39, -78, 7, 12, -83, 7, -21, -79,
+        32, 104, -63, -63, -113, 5, -64, -102, 5, 106, 115, 98, -11, -116, 52, -21,
+        83, 60, 47, -5, 41, 46, -47, 1, -115, -115, 27, 73, 44, 78, 64, -1,
+        115, -108, 103, 13, 43, 97, -85, -126, -86, -27, 86, -52, 34, 103, -114, 48,
+        -40, 57, -120, 111, -111, 21, 10, -45, 22, 23, 71, -100, -122, 51, -124, 52,
+        43, 57, 36, -36, 38, 117, -122, -125, 103, -49, -11, -74, -70, -82, -46, -91,
+        12, -105, 75, -88, 120, -118, -31, 118, 48, -128, -49, -86, -22, 105, -25, -81,
+        127, -51, 54, 123, 36, 74, -113, 116, 48, -60, 6, -37, 117, -21, 124, 7,
+        -111, -128, -118, 89, -90, 113, 51, -53, 89, 114, -65, -112, -26, -51, 30, 124,
+        -95, -78, -70, 50, -105, -93, 57, 124, -52, -128, 61, -124, 2, 41, 123, 10,
+        -81, -13, 58, 118, 111, -11, 8, -60, -85, 26, -53, 33, -36, 125, -24, -28,
+        -80, -93, 69, 44, 94, 101, 55, 55, 73, -124, 106, -116, 76, -123, 111, -97,
+        -78, -115, -12, -38, 73, -15, -126, -83, 122, 74, -102, -60, -53, -18, 113, 19,
+        3, 64, 74, -42, 49, 66, 60, 57, 23, -26, -8, 69, 64, -82, 65, 115,
+        -6, 99, 118, -111, -57, 5, 44, 49, 27, 37, 25, -82, -40, -44, -78, 12,
+        -17, -101, -19, 54, -110, -5, -24, 68, 45, -66, 127, -2, -45, 7, -6, 61,
+        33, -43, 31, 45, 110, -16, 10, -29, 6, -77, 72, -60, -14, -111, -119, 22,
+        85, -29, 12, -80, -70, -86, -36, 117, -15, -127, -119, 98, 92, 127, -27, 112,
+        -52, -56, -59, -85, -34, -88, -59, 24, 114, -116, 98, -116, 29, -29, -93, 86,
+        -28, 94, 60, -52, 10, -115, -59, 47, -23, 106, 122, -77, 34, -82, -49, -27,
+        -10, -120, 0, 37, 70, 27, 97, 58, -117, -95, 92, -66, 61, 109, 108, -84,
+        -82, -104, 104, -75, -58, -119, 115, -116, 123, 28, -107, -22, -96, -31, 51, 42,
+        109, 64, 15, 94, -114, -113, -73, 19, 82, 106, 39, 32, 4, -100, 20, -15,
+        82, -36, 50, -28, 85, -30, 23, -98, -36, 6, 63, -25, 58, -16, -36, -47,
+        87, 104, 113, -99, 86, -48, 46, 56, -35, 78, -37, 77, 0, 102, 107, -75,
+        -64, -99, 72, 109, -80, 77, -66, -13, -72, 4, 57, 45, -117, -115, 83, 93,
+        86, 44, -11, -36, -83, -18, 103, -95, -119, 1, 21, -27, 92, -8, 68, -77,
+        5, 38, -66, -105, 73, -40, 113, 44, -17, 48, 70, -25, -53, -20, 62, 117,
+        -78, -63, 109, -124, -26, 71, 100, -44, 73, 113, -94, 60, -77, 2, 53, -69,
+        -52, -31, 106, 126, 41, 61, 58, -65, -63, 16, 34, 70, 85, -14, 78, -25,
+        37, -18, 46, -93, 64, -101, 34, -92, -92, 38, -44, 82, 11, -33, -96, 48,
+        61, 16, 91, 66, -14, 121, -71, 41, -70, -33, 95, 24, 84, 2, -41, -123,
+        19, -102, 74, -54, 110, 29, 114, 97, 109, -25, 104, -73, 75, 37, 74, 49,
+        -52, 53, 87, -66, 34, -119, 11, -1, -19, -23, -52, -123, 8, 41, 29, 31,
+        12, -67, -42, -16, 43, 117, 2, 99, -9, 120, 72, -26, -109, -5, 42, 114,
+        -91, 4, -82, -125, 64, 118, 75, 76, 55, 1, 127, 41, 119, -51, 0, 63,
+        62, -70, -115, -59, -96, -112, 40, 63, 80, -111, 61, 9, 113, -4, 17, 38,
+        20, -82, 24, -96, -75, -33, -59, -104, 114, 59, -9, 17, -125, -90, 33, -60,
+        -24, -104, -1, 32, -41, 49, -16, -20, -1, -3, 80, 103, -115, 35, -100, -108,
+        15, -85, -114, -7, -75, -75, -97, -44, -108, -32, 17, -99, 51, -118, -24, 76,
+        -56, -30, -47, -109, 125, -52, 104, -123, 75, 102, -44, -29, -90, -120, 127, -72,
+        28, -123, -57, 2, -34, -92, 122, -64, -101, 20, -93, -40, -20, -119, -91, -54,
+        14, 0, -89, -51, 11, -110, -93, 96, 84, 85, -89, 77, 93, 60, -107, 93,
+        119, 90, 42, 106, 9, -76, -54, 10, -6, -91, -126, -27, 32, 32, -84, -108,
+        -66, -52, 85, -21, -122, -96, 126, 105, -39, -60, 117, 10, -64, -80, 64, 16,
+        74, 71, -1, -126, 59, -116, -43, -8, 43, -64, -51, -4, -73, 84, -127, 47,
+        -39, 87, 21, 21, 28, -58, -68, 89, 11, -75, -60, 127, -79, 79, 126, 13,
+        20, 94, 9, 39, -121, 105, 124, 27, 50, -108, 58, -33, -90, -31, 109, 60,
+        123, 33, 82, 100, -8, 8, 21, -87, -68, 122, -3, -76, 20, -48, 55, 33,
+        -78, -107, -26, -125, 77, -7, -17, -58, -128, -34, 34, -121, -30, 122, -109, -30,
+        47, 65, 34, -9, 117, 94, 67, -32, -120, -77, 24, 80, 5, -13, 84, 10,
+        -40, -49, 61, -78, 73, -42, -65, 106, 14, -117, -64, 10, 62, 53, -84, -38,
+        -4, -106, -74, -36, -55, -1, -92, -67, 21, -101, -69, 103, 48, 123, 45, 127,
+        -44, 11, 107, 117, 87, -84, 65, -92, -47, -62, 48, -38, -121, 69, 4, 58,
+        11, -47, -12, 12, -91, -28, 23, 33, -33, -34, -117, 75, -92, 118, -4, -17,
+        -37, 116, 48, 100, -6, 111, 74, -12, -98, 124, -85, -94, 119, -106, 50, -34,
+        -30, 20, -119, -124, -96, -102, 52, -72, -126, -127, -24, 74, -47, 34, -9, 53,
+        10, -76, -93, 121, 96, 75, -84, 84, 34, -91, -80, -62, 8, 56, 37, -52,
+        -90, 44, -70, -33, -52, -81, -126, -103, -45, 24, -20, 105, 84, 105, -56, 68,
+        86, 12, 76, -39, 8, 53, -19, -15, -108, 107, 123, -73, 15, -10, -44, 66,
+        -121, 1, 113, -122, 99, 60, -8, -109, -2, 120, 10, 124, 26, -37, 96, 54,
+        -36, -56, 28, -94, 84, -91, 42, -83, 19, -22, 91, 27, 5, 79, 70, 100,
+        -45, -94, 17, 85, -24, -30, 68, -21, -115, 97, -87, 73, 84, -15, 54, -117,
+        -44, 96, -79, 34, -66, 114, -30, 90, -78, -39, 77, -61, -39, -16, -90, -38,
+        92, -95, -111, -94, 33, 50, -107, 114, 0, 68, 52, -69, 121, -13, 106, 52,
+        114, -36, -87, 124, 78, -127, 35, -53, -33, 100, -118, -65, 110, 63, -122, 55,
+        72, 95, 56, 24, -49, 1, 24, 111, 36, 84, 43, -100, -82, -79, 69, 22,
+        -66, -41, -73, -108, -78, 114, -34, 14, 6, -3, -107, -49, -104, 113, -43, 122,
+        71, -88, 71, 85, -78, -90, 90, 23, 47, 80, 126, -92, 84, 25, 29, -23,
+        53, -5, -64, 82, -15, -16, 80, 58, -59, -76, -12, 87, 110, -11, 15, 30,
+        31, -42, 41, -59, -19, -28, 11, -6, 8, 101, -31, -110, 86, -116, -78, 53,
+        54, -68, 121, 19, 8, -31, -6, 23, -122, -81, -78, 82, 84, 31, -28, 126,
+        -76, 112, 27, 54, 5, -69, 7, 17, 12, -77, 93, -48, 13, -78, -120, 44,
+        38, 97, -112, 55, -72, 124, -62, -64, -34, 83, -10, 7, 17, 102, -98, -35,
+        -10, -70, -99, 126, -89, -37, -61, -32, 15, -52, -89, 108, 83, 117, -22, 110,
+        39, -30, -7, -39, -49, 81, -55, -69, -71, -23, -67, 0, -107, -93, -51, 101,
+        -100, -83, 11, -128, 29, -74, 25, 111, 80, -22, -84, -4, -72, -122, -63, -34,
+        -62, 122, 12, 41, -83, 79, 33, -27, -31, -82, 74, -45, 74, 67, 60, 66,
+        -55, 111, 40, 73, 69, 111, 109, -45, 80, -6, -22, -15, -121, -109, 116, -102,
+        -100, 4, 67, 63, 57, 14, 84, 50, 38, -10, -5, 126, 34, -30, 68, 45,
+        -68, 89, -112, 57, 33, 80, -122, -90, -77, -123, -124, -69, 86, -104, -93, -14,
+        -19, 13, 103, -64, -94, 61, -60, 31, 80, 60, 98, 30, 107, 32, 120, -42,
+        -57, -5, 42, 76, -42, 48, -114, -38, 66, 23, 107, 69, 32, 37, -28, -2,
+        -16, 96, -24, -102, -29, -40, -57, 4, 85, -58, -75, -124, 113, 45, -113, 31,
+        -37, -64, 100, 105, -116, 115, 79, -91, -117, -27, 37, 31, -15, 13, -115, -104,
+        57, -102, -88, 125, 123, 94, -122, 105, 23, 0, -96, -127, 50, 55, 4, -8,
+        -4, 17, -6, -86, 2, 12, -62, -72, 69, -72, -37, -65, -37, 83, -30, -36,
+        -69, -81, 45, -63, -123, -106, -97, 106, 11, 48, -19, -116, 23, -75, -7, -52,
+        -58, -123, 41, 23, 124, -40, 83, -118, -36, -25, 123, -89, -75, -91, 80, -66,
+        -72, 46, -68, -73, -63, 53, -45, -22, -98, -68, 29, 96, 124, 118, 116, -101,
+        -104, -50, 3, -116, 21, -22, -67, 101, 103, 90, 124, -64, -20, 48, -62, 39,
+        -96, -52, -83, -45, 85, 101, -69, 20, 88, -44, -21, 74, 97, 117, -73, -86,
+        -95, 42, 58, -59, -128, 78, 44, 30, -110, -90, -30, 94, 91, 6, -102, -123,
+        -19, 54, -58, -43, -86, -110, -21, 105, 86, -85, -74, -16, 121, -42, -122, 107,
+        10, -54, 85, -88, 45, -31, 66, 17, -18, 58, -44, 116, -54, 125, -17, 78,
+        73, -52, -8, 11, -22, -102, 56, -9, 88, -108, 124, -68, -5, 122, 42, 75,
+        -126, 38, -104, 43, 81, -77, -123, 79, 70, 11, -97, -84, 45, 124, -110, 45,
+        -32, -59, 23, 56, 102, 11, 87, 70, 11, 87, -40, -126, 94, -7, -54, -107,
+        -75, -47, 58, -85, 84, -7, -50, -88, 124, 87, -82, 124, -89, 42, -77, 119,
+        -89, -65, 91, -90, -16, -62, -99, -66, -128, -118, -2, 11, 89, -118, 69, 11,
+        50, 75, 125, 112, -89, 31, -80, -44, 7, 89, -22, 119, -126, -49, 82, -79,
+        83, 99, 64, -89, -42, -11, 56, -27, -125, -86, 3, 21, 118, 79, -68, -2,
+        -8, -18, 45, 70, 80, 55, -102, -33, 95, 69, 115, 5, 80, 91, -122, 65,
+        -41, 53, 11, 43, -116, 9, 65, -85, 58, 72, 88, 61, -82, 18, -44, -16,
+        110, -123, 114, 77, -31, 92, 123, 112, 25, 39, 112, 11, -115, 60, 38, 73,
+        -105, -104, -65, -21, 3, 5, 123, -125, -86, -4, -8, 23, 72, -43, 38, -68,
+        88, 122, 73, -30, -104, -15, 125, 45, -86, -99, -57, 119, 112, -30, -33, -20,
+        67, -59, 111, -10, -93, 98, 22, 97, -62, 123, -93, 45, -126, -71, 63, 51,
+        119, 58, 27, -4, -103, -59, -87, -45, -19, 116, 93, 127, 70, 35, -5, 88,
+        89, 41, 78, 86, -84, -117, -24, -125, 118, 82, -89, 101, 122, -117, -96, -78,
+        113, -1, 121, 67, 60, -76, -37, 84, 120, -124, 90, 4, -51, 5, 53, 7,
+        81, 11, -31, 32, 106, -127, -67, 53, 86, -101, 124, -4, -14, -59, -7, 88,
+        -90, -10, 100, 36, 20, 92, 23, 45, 20, 74, -16, 81, 126, 11, 115, -100,
+        64, 59, 4, 54, -126, -108, -100, 88, -78, -77, -15, -90, 18, 114, -59, 74,
+        -62, -14, 104, 44, 111, 42, 30, 116, -126, 88, -77, 64, 21, 3, -107, 36,
+        -81, 6, -109, 111, 20, 76, -58, 64, -2, 48, -72, -28, -6, -96, 108, -65,
+        -3, 40, -99, 101, -13, -24, -65, 126, 127, 115, -102, -63, 13, -110, 34, -52,
+        -52, -36, 90, 8, 126, 111, -80, 43, -41, -27, -124, 55, 12, 90, -33, 17,
+        99, -71, 85, 90, -12, -36, -119, 113, 85, -91, 29, 8, -63, 127, 68, 121,
+        -58, 0, -59, -59, 45, 123, 55, -112, 50, 14, 50, 96, -5, 43, -117, 48,
+        -25, -96, 67, -68, 119, 28, -9, -65, 14, -17, -94, 15, 64, 39, -1, -127,
+        -20, 65, 65, 89, 7, -17, -48, -74, -124, 17, -8, 0, 39, -108, -42, 103,
+        44, 102, 75, 17, -125, -91, 70, 91, 25, 58, 86, 125, -33, 44, -123, 44,
+        61, 85, 119, -85, -44, 54, 95, 14, 28, 61, -21, -27, -53, -105, -1, 5,
+        115, -46, -34, -46, -69, -27, -72, 62, 6, -25, -84, -125, -55, -5, -58, -110,
+        -11, 125, 50, 85, -122, -86, -45, 113, 17, 56, 70, 50, -87, -60, 93, -70,
+        -113, -21, -91, -86, -77, -45, -19, -43, -102, -6, 120, -17, -9, -29, 83, -71,
+        42, -17, 101, 0, 26, -44, 29, 9, -70, -75, 19, 64, -43, -98, 119, 84,
+        104, 112, -57, 89, 99, 15, 16, 6, 32, -37, 22, 53, -44, -20, 61, -118,
+        100, -45, 52, 121, 54, -98, 123, -82, -93, 110, 54, -55, 124, -91, 89, 83,
+        -39, 101, -33, -19, -18, 111, 122, 97, -57, 106, 82, -95, -35, -106, 44, 91,
+        -41, 16, -40, 123, -123, -64, 20, -9, -18, 111, 6, -24, -54, 117, 25, 113,
+        -49, -128, 33, 81, -127, -5, 46, -35, -9, -113, -71, 116, 43, -28, 75, -106,
+        34, 83, -53, -124, -127, 101, 125, -125, 47, 95, -102, -38, 22, -22, 47, 93,
+        96, -51, 109, 17, -52, -95, -4, 43, 84, 125, -62, -54, 17, 62, 99, -14,
+        -89, 74, 111, 101, -54, 32, 61, 116, -25, 106, 31, 22, 9, 28, 7, 11,
+        88, 68, 10, 95, -87, 70, -58, -30, -81, 60, -126, -81, 111, 57, -62, 91,
+        124, -82, 69, 65, -103, 62, 74, 46, -10, -28, -29, 108, -33, 78, -74, 94,
+        -43, 52, 99, -104, 89, 41, 24, 59, 59, 111, -27, 78, 37, -82, 5, 82,
+        102, -115, 80, -93, -13, -110, 7, 67, -118, 70, -118, 98, 32, 93, 122, 86,
+        -125, 9, -78, -98, 30, 95, 91, -38, -46, 8, 118, -13, 104, -52, -34, -6,
+        -79, 53, 41, 109, -85, -77, 31, 84, 113, 78, -78, -107, -70, 60, -55, 101,
+        125, 123, 7, 57, -126, -49, 93, -76, -85, -91, -4, -29, -16, -118, -109, 12,
+        -115, 115, -110, -109, -31, 52, -23, -93, -123, -125, -37, 115, -48, 49, -15, -126,
+        125, -20, 66, 126, -62, -59, -88, -125, 110, 120, 85, 100, -55, 26, 95, 31,
+        -14, 32, -17, -95, 73, 86, 9, 70, 57, -17, -114, -19, 70, 53, -71, -25,
+        -98, 104, -105, -72, -88, -100, -47, 73, 34, 13, 121, -93, -116, 37, -75, -40,
+        -110, -87, -93, -41, 99, 70, 53, -78, 41, -18, -64, -30, 121, -65, 102, 28,
+        44, 10, -104, -33, -58, -127, -77, 99, 12, -71, -44, 15, -43, 15, -58, -49,
+        -21, 86, -125, 71, 27, -69, -24, -34, 51, 39, -123, 93, -74, -8, 117, -79,
+        -63, 121, -77, 23, -85, 75, -43, 47, 124, 4, 85, -17, 58, -84, 27, -56,
+        -93, -32, -125, -44, -53, 78, 59, 72, 86, -103, -18, 30, 25, -1, 100, -75,
+        15, -35, -77, -39, 14, 39, -38, 99, 83, -115, 20, 27, -107, -40, -48, 29,
+        71, 21, -54, -15, -64, 62, -62, 13, 84, -47, -82, -72, 2, 111, 60, -40,
+        19, 13, 124, -22, -30, -103, 77, -13, 0, -83, -128, -109, 123, 12, 63, -10,
+        -109, 47, 78, 109, 125, -120, 52, 39, -105, -47, 8, -108, 107, -88, -107, 25,
+        32, -112, 93, -3, 42, 85, -122, 7, -28, -6, -92, 35, 97, -91, 93, 66,
+        116, -50, 120, -120, 26, 67, -106, -35, 19, -78, -13, 22, -17, 51, 109, -74,
+        3, -106, 70, 68, -53, 108, -104, 105, -116, 54, -90, -98, 58, 28, -115, 69,
+        -85, -15, -36, -40, -70, -34, -41, -49, 54, -58, 56, -29, 114, -74, -91, 27,
+        -95, 69, -88, -58, -43, 96, -123, 94, 112, 86, -5, -76, 12, 74, 20, -38,
+        -105, 47, -113, -84, -56, 88, -27, 71, 87, -109, -62, -50, -3, 79, 12, 117,
+        79, 97, -28, -16, 85, -66, -35, -53, -29, 47, 7, 82, -85, 77, 55, 17,
+        39, 109, -64, 20, -83, 73, 45, -118, -82, 99, -121, -125, 21, 45, 115, -41,
+        -69, 16, 5, -67, -112, -65, -109, 94, 50, -85, -24, 95, 53, -85, 104, 73,
+        107, -4, -114, 79, 27, 111, 82, -95, -25, -26, -119, -127, 112, -75, -107, -125,
+        -74, 43, 84, -95, -64, 14, 15, -29, -61, -61, 114, -73, -116, -14, 98, -99,
+        -3, -106, -46, -128, -51, 62, 75, -112, 115, -54, 40, -87, -3, -2, 48, 15,
+        30, 65, 35, -3, 47, 1, 50, 87, 16, 68, -113, 0, 18, 64, -62, -35,
+        85, -66, 102, 65, 78, -19, -91, 75, 84, -74, 116, -68, 83, 122, -67, -26,
+        64, -106, -88, 109, -104, 116, -59, 6, 64, -21, 8, -30, -39, 117, 7, 8,
+        -44, 66, 110, -81, -57, -35, -87, -34, -85, -89, -6, 90, 88, -27, 27, 123,
+        81, -87, 123, 105, 120, -71, -71, -81, 123, 44, 72, 107, -121, -108, 99, -116,
+        -50, -81, 90, 112, -68, 9, -66, 106, 50, -17, -88, -127, -122, 41, 1, -54,
+        21, -82, 50, 14, -84, -40, -30, -16, 80, -94, -109, -70, 2, 7, 117, 79,
+        -126, -113, -31, 116, -72, 62, -126, 121, -103, -108, 11, -111, 106, -121, 22, -57,
+        119, -15, -11, -38, 25, 122, 4, 29, 30, -118, 39, -70, 107, -128, 55, 113,
+        -85, -96, 58, 108, 4, 64, 2, -37, 23, -104, -102, 105, 44, -89, -53, -107,
+        33, 50, 124, -98, 101, 82, -92, -78, 6, 61, -53, -125, -55, 101, -55, 85,
+        -104, -77, -14, -24, -38, 84, -93, -10, -15, -109, 103, -124, 27, 35, 3, 62,
+        45, -22, 20, -36, -80, -110, -75, -40, -6, 113, 91, 43, -64, -101, 108, 20,
+        5, -93, 59, -35, -40, -31, -38, -89, 123, -93, 51, -13, -23, 97, 84, 107,
+        -115, 102, 46, 3, 16, 43, 100, -112, -56, 37, 66, -9, 105, -65, -79, -50,
+        -103, 120, 19, -80, 113, -123, -102, 96, 40, -28, 112, 16, 37, -1, -56, -128,
+        74, -113, 29, -29, -5, 77, 90, 78, -7, 109, -67, -46, -109, -34, -121, 70,
+        9, -90, -100, -114, 60, 74, -87, -38, -17, 17, -116, 73, 79, 124, 23, -91,
+        -21, 55, 51, -77, 32, -90, -23, -33, -89, 116, 35, 96, 41, 82, -35, -89,
+        -44, 85, -35, 82, -31, -33, -62, 43, 5, -119, -91, 26, -4, 102, -95, 118,
+        92, -7, -124, 91, 0, 1, 86, 28, 87, 75, -120, -73, -38, 2, -107, -21,
+        42, -29, -32, -38, 106, -114, 43, -112, 30, -116, 75, -13, 67, 14, -25, -48,
+        -109, 1, -94, 99, 24, -45, -37, -20, 30, -16, 76, 88, -96, -106, 3, -116,
+        -11, 34, -69, -44, -114, 63, -101, -64, -25, 12, 119, -122, 41, -98, 97, 108,
+        9, -90, 92, 26, 37, 126, -24, -59, 80, 16, 56, 113, -110, -71, 40, 124,
+        -55, -38, -103, -78, 63, 24, -86, -100, -94, -73, -81, -116, -77, 117, 17, 95,
+        122, 4, 124, -66, 53, 50, 120, -26, 117, -5, -40, 56, 114, 42, -69, 73,
+        -26, 116, 63, -45, 102, 119, -51, -67, -9, -2, 114, 12, 116, 100, 103, 115,
+        -101, -64, 6, 116, 23, -85, -43, -46, 63, 58, -70, -65, -65, 31, -36, 63,
+        29, 100, -7, -51, -47, 120, 56, 28, 30, 65, -119, 110, -121, -55, -75, -70,
+        -29, 103, -35, 14, -105, 67, -47, -17, -69, 56, -70, 7, 114, 55, -24, 14,
+        59, -61, -50, -8, 25, -4, 95, -9, -124, -103, -30, 28, -93, 10, 122, 103,
+        30, 116, -33, 65, -42, 98, -4, -20, 110, -4, -20, -11, -16, 115, -73, -125,
+        -49, -102, 65, 23, -115, -127, -70, 71, -107, -94, -93, -89, -99, 31, 23, -3,
+        -15, -35, -77, -41, 63, -34, -115, 23, -49, -18, -98, 45, -58, 119, -3, 103,
+        -16, -93, 63, 94, -12, -97, -3, -15, -29, -25, -37, -2, -88, -1, -4, -12,
+        -121, -63, -77, -97, 58, 99, -8, -113, -1, 24, -115, -117, 103, -8, 107, 52,
+        -108, -1, -41, -25, 9, 64, 23, 127, 24, -3, 56, 120, 62, -90, 98, -99,
+        -15, -25, 91, -56, -3, 105, -122, -39, -93, -50, -80, -1, 83, -1, -23, -32,
+        -7, -49, -16, -25, -89, -126, -3, -24, -4, -124, -1, -33, -63, -113, 14, 126,
+        -80, 31, -104, -10, -103, -58, 123, -116, -53, 1, 127, -1, -30, 122, 124, 81,
+        127, 35, 81, -117, 113, 126, -2, -89, 45, -21, -113, -99, -47, 8, -42, 115,
+        52, -124, 117, 124, 13, -117, -8, -68, -1, -13, -1, -116, 53, -28, 81, -74,
+        116, -17, -52, 8, -12, 113, -27, 12, -95, 114, -85, -19, 4, -47, 14, -112,
+        72, 1, 78, 11, 91, 127, 127, -91, -93, -87, -122, 19, 22, -77, 19, 22,
+        95, -22, -83, -76, -34, 57, -74, -32, -1, 49, -92, -1, -19, -35, 61, 109,
+        -93, -85, 64, -1, 124, -16, -68, 51, 122, -74, -24, 15, 126, -4, 57, -23,
+        15, -58, 63, -63, -1, -1, 120, 10, -87, -80, -70, -93, 49, -82, -35, -24,
+        7, -40, -64, -63, 104, -124, 63, 126, -58, -62, 63, 116, -98, 15, 126, -122,
+        -49, -89, -125, -31, -49, -99, -89, -108, -10, -12, -61, 83, -106, -56, 62, 89,
+        -66, 40, 62, 27, 13, 126, -128, -83, -22, 96, -7, 62, -74, -8, 108, 48,
+        126, -38, 31, 13, -98, -1, -104, 64, 95, -48, -27, 29, -10, -3, 28, -110,
+        127, -2, -7, -19, 120, 56, 120, 6, 125, -62, 88, -16, -77, -1, 28, 14,
+        -35, 15, -99, -31, -23, -113, -125, 33, -76, -8, -84, -13, 28, -57, -14, -13,
+        -49, -16, 23, -38, -2, 64, -87, -49, 89, -105, -104, 43, 74, 81, -65, 84,
+        78, 124, 60, -5, 108, -127, 76, 13, -120, -1, -40, -113, 29, 0, -4, -122,
+        -120, 30, -58, -81, 127, 38, 72, -2, -29, -25, -59, -8, -113, 31, 23, 8,
+        -37, -29, -69, -111, 14, 92, 127, -15, -39, 70, -14, 93, -6, -31, -43, 79,
+        -93, -97, -57, -113, -39, -91, 22, 32, -16, 45, 39, 18, -10, 10, -122, -2,
+        116, 6, 123, -128, 71, 104, -36, 25, -4, -36, -25, 39, -21, 39, -60, 121,
+        -29, -41, 79, -17, -32, -21, -103, -8, 2, 116, -8, 25, 42, -47, 124, 89,
+        22, 28, -53, 31, 104, 45, -80, -99, -49, -73, -80, 67, -8, 115, 54, -60,
+        22, -5, -40, 26, -2, -9, -7, -35, -13, -50, 120, 68, -51, -51, -32, -52,
+        14, 96, 67, -24, -52, 67, 125, -56, 126, -90, 122, 122, 7, 96, 68, 56,
+        -105, 26, -125, 117, 102, -3, 82, 7, -97, 111, -31, -20, -22, -97, 48, -58,
+        25, -115, -69, 51, -18, 99, -125, 42, -93, 63, 26, -45, -114, -56, 114, 122,
+        -75, -2, -77, -50, 51, -93, -103, -2, -24, 7, -20, -113, 125, -22, -101, 103,
+        -65, -16, -76, 83, -38, 45, -60, -7, -58, 19, -33, -11, -43, 119, 87, -36,
+        -118, -70, -33, -56, -113, -39, 122, -74, 120, 25, -35, -59, -77, 104, -86, -33,
+        -106, 17, -93, -14, -8, -69, 91, -41, 126, -109, -58, -58, 77, -102, 50, -92,
+        15, -60, 29, -4, 82, -67, 114, -118, 102, 53, 88, -122, 105, -5, -5, 95,
+        -111, 88, 117, 104, 74, 54, 58, 85, 63, -3, -42, 56, -118, -118, -8, -101,
+        36, 78, 63, -39, 10, -114, 126, -2, -7, -25, 35, -54, -3, 14, -24, 108,
+        30, 93, 23, 39, -54, 62, -73, -18, 84, -60, -112, 20, -86, 3, 113, -92,
+        85, 59, -98, 37, -15, -14, 61, 86, -61, 66, 87, 93, -67, -75, 117, 17,
+        73, 63, 39, 65, -9, 46, -58, -48, -101, 17, 76, 16, 7, -17, 47, -14,
+        -24, 26, -58, -82, 55, 43, -102, 50, 14, 30, 38, -10, -15, 87, -48, 93,
+        -25, -119, -13, 31, 87, 110, -105, 70, 56, 70, -52, -7, -4, -113, -15, 16,
+        -50, -56, 24, -67, -92, 15, 126, -22, 60, 35, 104, -19, -1, 56, -96, 51,
+        58, -4, 9, 15, 41, 30, -84, 103, 79, -31, -17, 79, -49, -15, -108, -3,
+        -4, 22, 49, -35, -32, -89, -89, -59, 104, 48, -2, 1, 82, -96, -99, -47,
+        0, -47, -22, -8, -7, 108, 48, -122, -77, 49, -6, 25, 48, 41, 96, -13,
+        -97, 1, -69, -46, -97, -15, 24, -106, 112, -16, 108, 60, 24, -2, 48, -8,
+        97, 48, -6, 97, 48, 124, -122, -8, -14, -39, -32, -23, 8, 122, 126, -10,
+        -125, -6, -11, -57, 51, 56, -54, -48, -10, -32, -121, 31, 17, 79, 67, -61,
+        -40, -25, -13, 15, 112, 9, 60, 29, -116, -16, 66, -17, 60, -69, 3, -44,
+        -9, 7, 36, -42, -108, 124, -34, -127, -92, -50, -120, 82, -2, 24, -115, -96,
+        -20, -72, -90, 44, 76, -32, 57, -107, 29, 104, -123, -97, -73, 43, 108, 61,
+        -72, 101, 70, 16, -63, -10, 59, -99, 75, 104, -119, 29, -57, 29, 81, 96,
+        57, -78, 29, -35, 10, 35, -30, 25, -24, -1, -15, 80, -3, 53, -24, 31,
+        104, -90, 49, 80, 88, 63, 0, -71, -6, -61, -30, -7, 29, -32, -52, -89,
+        111, -31, -54, 122, 74, 84, -45, -30, -23, -35, 79, 123, 46, -64, -22, -99,
+        -63, 87, 85, 34, -105, 121, 118, -97, 38, 89, 104, 69, 34, -126, -35, 106,
+        -58, 36, -94, -123, 105, -23, -37, -1, 119, 80, -84, 108, -106, -38, -100, 108,
+        87, -2, -47, -119, 126, 43, -62, -67, 51, -6, 73, 94, 127, -61, -2, 115,
+        -13, 19, 111, -88, -47, 79, 127, -4, -16, -6, 41, 85, -36, 3, 116, 0,
+        67, 107, 11, -113, -124, -55, 2, -124, -92, 62, 53, 51, -53, -77, -80, -125,
+        -102, -99, 94, 117, -47, -75, -126, -88, 87, 73, 75, 95, 101, 56, -47, -100,
+        14, -77, -12, -127, 86, 10, 80, 30, -9, 70, 93, -45, 4, 89, -55, 86,
+        -25, -61, -7, -29, 62, 43, 78, 51, 67, 13, 119, 107, 27, 84, 27, -90,
+        -99, 91, 67, 92, 70, 72, 126, 83, 55, -121, -121, -101, 1, -66, 69, -109,
+        -98, -48, -101, -108, 49, -37, -71, 23, 121, 60, -97, 12, -82, -59, -38, 97,
+        -44, -83, -59, 113, 46, -106, 106, 1, 75, -91, -87, 27, -28, 23, 11, -96,
+        -35, 19, -17, -127, -115, -100, 62, -23, 39, 95, 14, 74, -32, -111, -53, 61,
+        94, 88, 83, -105, -93, 20, 90, -67, -48, 16, 107, -16, -110, -36, 100, -28,
+        95, 76, 108, -13, 58, -68, -67, 90, -25, 55, 81, -114, -89, 1, 37, 31,
+        10, -37, -32, 37, -4, -118, -35, -63, 83, 13, 91, -108, -108, 12, -86, -78,
+        46, 87, -61, 88, -128, 123, 74, 77, -64, -43, -3, -88, 22, 36, -59, -16,
+        74, -112, 3, 101, -71, -54, -2, -26, 24, 54, -128, 76, 46, -11, 50, -34,
+        -1, 11, 71, 73, -20, 109, -117, 98, 19, -36, -21, 24, 4, -59, -14, 36,
+        -118, -87, -38, -48, -80, 18, -122, 126, -90, -106, 46, -10, -73, 124, -46, -16,
+        -112, -79, -105, -127, -117, 7, -78, -61, -24, 70, 27, -44, -86, -2, -16, -57,
+        -33, -70, -75, 39, -105, 21, -7, -104, 65, 33, -104, -116, 94, -19, -3, -81,
+        45, -86, 65, -95, 82, -75, -45, 15, 127, -20, -81, 6, -123, 118, -105, -109,
+        -110, -52, 82, -38, -74, -66, 14, -117, 87, -1, 119, 29, 38, 103, 100, 57,
+        -59, -84, 30, -57, -34, 72, 29, 3, 10, -18, 126, 44, 34, 90, 76, 98,
+        37, 94, -110, 43, -53, 16, 72, -93, -84, -47, -108, -97, 97, 37, -28, 125,
+        53, 29, 90, -118, 86, 68, -56, -62, -66, 17, -94, 78, -35, -122, -112, -77,
+        -93, -114, -46, -105, -62, -10, 112, -87, 92, -66, 62, -86, -125, -99, 49, -106,
+        58, -128, 16, -3, -71, 122, -124, 111, 43, 104, 54, -118, 103, 39, -27, 43,
+        -68, 65, -119, -121, 124, 60, 80, 4, 52, 85, 90, 25, 6, 86, 101, -107,
+        123, -102, 98, -62, 118, 108, 74, -43, -112, -51, 121, 58, -107, 111, 72, 60,
+        -65, -83, 85, -58, 69, -108, 100, -79, -83, -25, -4, 38, -75, 77, -104, -117,
+        -97, 90, -73, -126, 101, 45, -51, 32, 82, 107, 51, 55, 40, -105, -94, -125,
+        96, 75, 19, -126, 26, 105, -43, 14, 65, 87, 93, 35, 116, 108, -84, 49,
+        94, 34, -21, 91, -110, -62, 46, -88, -40, -34, -96, 8, -58, -106, -31, 37,
+        39, -128, 120, -1, -80, -37, 64, -28, -72, -120, -78, -21, 27, 71, 28, -12,
+        117, -115, 47, -45, -67, -115, 35, -90, -94, 48, 118, -113, 111, 125, 86, 32,
+        -2, -48, 111, -26, 8, 80, 82, -44, 32, 2, -113, -84, 34, -16, -117, -24,
+        114, -33, -66, 25, 116, 69, -124, 23, -70, 97, -47, 43, 95, -98, -44, 67,
+        -35, 125, -59, -71, -112, 113, 52, 106, -17, 37, -84, -117, -38, -53, -37, 116,
+        6, 23, 32, -113, 80, 83, 11, 16, 24, -108, 94, 62, 23, 96, 39, -65,
+        -83, 22, 104, -98, -111, -82, -14, 44, 41, 120, -72, -114, 56, -48, -50, 52,
+        -66, -54, 78, -51, -102, 26, -26, -16, -53, 57, 56, 104, 124, -47, 45, 53,
+        -48, 45, 95, -20, 93, 38, 84, 20, 95, -109, 72, 93, 41, 104, 110, 125,
+        96, 126, 123, -79, 13, 34, -52, -66, 77, 34, 96, 26, 87, 93, 57, 52,
+        -107, -9, -29, 18, 97, -47, 84, 88, 87, 110, -94, -96, 39, 84, -120, 54,
+        -5, -9, -24, 58, -54, 35, -40, -117, -67, -6, 77, 10, 37, 125, -7, -30,
+        -24, 47, 80, -85, 71, 122, 62, -62, 117, -28, 18, 24, 29, 69, -87, 86,
+        -15, -119, -22, -79, -115, 74, 54, -46, 114, 93, -88, -106, -43, 107, -41, -22,
+        -47, -18, -102, 120, 77, -47, -117, 92, 80, 38, 8, -62, -107, -128, 113, 99,
+        -76, -23, -70, -57, 75, 113, 2, -84, -128, 12, -72, 36, -28, -80, 87, 34,
+        88, 20, -111, 26, 28, 12, -3, 82, -90, 6, -109, -62, -75, 86, 20, -108,
+        -102, -94, 5, -11, -75, 29, -13, -30, 106, 17, 38, 105, -105, -59, 39, 17,
+        73, -67, -10, -110, -82, 49, -38, -108, 87, 0, -41, 82, -78, -124, 43, -8,
+        85, 83, -25, -9, -84, 45, -110, -64, 37, -35, -113, 36, -116, 80, 96, -6,
+        114, -38, -45, -67, 85, 9, 71, -104, 76, -127, 60, -50, -85, -90, -29, -36,
+        -36, -122, 88, -89, -90, 3, -34, -36, 2, 109, 72, -53, 35, 111, 89, -108,
+        118, 47, -21, -109, -56, -70, 108, 35, 59, 27, 102, 102, -108, 17, 40, -26,
+        10, 39, 117, 86, 4, 4, -5, 116, -95, 9, 80, -53, 39, 86, -89, -119,
+        46, 107, -18, 11, 19, 102, -27, 34, -41, -81, -116, 78, -128, -75, 87, -16,
+        -116, -117, -33, 121, -8, 94, -31, -18, -102, -108, 30, 86, -70, -46, -61, -71,
+        -90, -12, -80, -46, -107, 30, -50, 5, -5, -92, 106, -10, 100, 81, -9, 104,
+        12, -121, 83, -53, -119, 48, 37, 20, 41, 80, -126, -91, 104, 126, 87, 126,
+        -115, -18, 49, 98, 45, -58, -78, 37, -91, 18, 93, 17, 53, 46, 4, 106,
+        122, 35, 60, 11, -32, 126, -3, 23, 121, 91, -31, -74, -8, 14, -41, -47,
+        -32, 3, -80, 44, 13, 61, -120, 54, -81, 13, 121, -65, -7, 78, -53, -29,
+        29, -112, 2, 85, -76, -118, 111, 35, 67, 127, -110, 121, 69, 103, -102, 58,
+        -88, -12, -10, 18, 93, -53, -56, -10, -55, 65, -29, 127, 125, 60, -3, 101,
+        -99, 36, -25, 81, -104, 59, -18, -15, 40, 122, -22, 10, 53, -74, -6, -43,
+        -106, 25, 125, 39, -22, -85, -26, -124, -5, 50, 44, -88, 114, -80, -42, -29,
+        87, 31, 86, -80, -11, -14, -21, 110, 108, -76, -42, -9, 107, -13, -101, -53,
+        4, 31, 104, 30, 3, 64, 31, -62, 113, -29, 65, -69, -124, -121, 74, -20,
+        -47, -113, -89, 20, -95, -16, 58, -55, -32, -82, 91, 1, -66, -15, 112, 4,
+        102, 114, -28, -22, -82, 43, 43, -125, -33, 63, 40, -124, 12, 105, -23, -68,
+        18, 86, -121, -88, 127, 69, 74, -102, 7, 74, 39, -69, 97, -40, 8, 70,
+        20, -38, 120, 21, 0, -122, -47, 109, 22, -76, -120, -52, -80, 67, -57, 99,
+        -95, -48, 23, 6, 56, 71, 54, 37, -104, -127, -40, 49, 52, 103, -120, -48,
+        92, -111, -40, 76, 4, 82, 7, -74, -84, 32, 95, 13, 5, 27, -127, -48,
+        18, 121, -96, 47, 63, -36, 121, -103, 116, -6, 20, -105, 67, 69, -97, 106,
+        -66, -26, 72, -101, 40, -74, 60, 20, -95, -50, 59, -71, -72, 56, -89, 98,
+        25, 105, 117, -1, 75, 83, -40, 84, 5, -108, 102, 92, -26, -55, 1, 104,
+        -31, 109, 89, -85, 104, 14, -66, 4, -102, 38, 103, 29, 7, -103, -16, -104,
+        111, 32, 101, 34, 8, 20, -71, 110, 117, -72, 36, 96, 48, -9, 4, 114,
+        -66, 127, -68, -25, 37, 79, 2, -10, 105, -104, 36, 104, -81, -18, -124, 94,
+        38, 92, -78, -39, 120, 123, 77, -92, -91, 87, -77, 67, -109, 69, -3, -112,
+        -21, -72, -15, 105, 10, -111, -101, -8, 86, -117, -56, -105, 112, -27, -47, 58,
+        -95, 91, 11, -99, 10, 46, 65, 66, 19, 44, -109, -109, 82, 30, -60, -67,
+        126, 56, 87, -78, 65, -90, -38, 93, 73, 102, -84, 84, 117, 84, 64, 70,
+        -107, -18, 106, -85, 100, -49, -112, -82, -36, 3, 107, -106, -35, -93, -64, -24,
+        35, -32, -55, 108, -67, -46, -82, 66, 36, -118, -72, -116, 103, -113, 118, 38,
+        -55, -113, -78, 101, 4, 4, -19, -44, 82, -57, -30, 82, 78, -85, -31, 91,
+        106, -108, 13, -69, -76, -30, 59, -41, 27, -106, -81, 23, -63, -14, -74, 80,
+        91, -57, 83, -13, 55, -51, 90, -106, -57, 25, 90, -15, -72, 66, -56, -26,
+        3, 79, -92, 9, 26, -75, -78, 90, 0, 26, -28, -40, -75, 114, -17, -45,
+        27, 123, 57, -28, -67, -75, 114, -64, -59, 11, -41, -93, -54, 68, -102, 123,
+        84, 102, -47, 6, 94, 70, 73, 124, 27, -81, -94, -36, -81, 81, 119, 99,
+        77, 13, -96, -31, 65, -87, -58, 78, -9, -72, 105, 30, -107, 111, 102, -93,
+        53, 55, -99, -9, -90, 11, 21, -40, -77, 21, 11, 109, 7, -88, 82, 51,
+        126, 53, 113, 27, 67, -53, 80, -62, -77, -42, 12, 55, -5, 106, -122, 27,
+        -96, -89, 77, -20, -109, 71, -120, -29, 95, 50, 19, 107, 108, 7, 46, 57,
+        -72, -29, -112, 9, -86, -98, -82, -56, -86, 51, -51, 14, 21, 45, 17, -82,
+        -107, 56, -88, -83, 10, -45, -55, -98, -60, -88, -61, -36, 110, 92, -79, -69,
+        107, 61, 48, -119, -109, 12, -38, -36, -64, -114, 116, 53, -107, 98, -24, -31,
+        2, -45, 93, 85, 74, 14, 55, -69, -14, -93, 7, -111, -46, 34, 36, 46,
+        -11, -62, -35, 126, 69, -73, -53, 85, -39, 98, -39, 17, 119, 87, 101, -105,
+        -72, 57, 57, 82, 44, 77, -50, -8, 66, 47, -6, 10, 103, 124, 26, -119,
+        61, -113, -48, -39, -53, -74, -114, -45, -29, 50, 4, -14, 6, 109, -86, -79,
+        -106, -109, 80, -113, 85, 79, 67, 41, -127, -2, -83, 120, -5, 114, 77, -90,
+        -54, -86, -89, 74, 93, 86, 76, 84, 90, -40, 51, 77, 11, 27, 14, 14,
+        106, -121, -82, 100, -24, 23, -14, 1, 42, 20, -77, 99, 113, -80, 10, -31,
+        47, -112, 107, 105, -57, -82, -25, -96, -33, 44, -72, -49, 19, -95, -73, -19,
+        -110, -50, -10, -54, 67, -123, -19, 21, -70, -111, 68, -113, 104, 55, 55, -116,
+        39, -62, -24, -64, -31, 114, 17, -49, -104, -89, -71, 91, -121, -101, 122, 21,
+        12, -94, 16, -85, 6, 23, -52, 8, 20, 31, 119, -69, 30, -5, -99, 68,
+        33, 90, -106, -22, 86, -90, 112, 119, -84, 103, 11, -118, -30, 33, 62, 120,
+        6, 21, 90, 47, 69, 42, -38, -114, 92, 66, 7, 51, 50, -23, 60, 11,
+        -122, -14, -9, 57, -3, -90, 38, 88, 50, 20, 101, 63, 112, -60, 103, 42,
+        -9, 92, -28, -98, -53, 92, -10, 11, 123, 124, 41, 34, -79, -16, 103, 98,
+        -81, 80, -118, -34, 113, -93, -33, 60, 3, -19, -109, -83, -46, 102, -5, 59,
+        -62, 86, -95, 123, 19, 86, -49, 11, 34, 55, -120, 21, 21, -94, -126, -102,
+        -117, -123, 37, 7, 116, 100, -71, 58, -12, -24, 63, 87, -41, -127, -121, 126,
+        -37, 87, -63, -64, 98, 84, -6, -79, -18, -66, -79, 98, -41, 53, 71, 73,
+        -2, -105, 27, 46, 79, 18, -108, -31, 82, 118, 109, 3, -34, 87, 91, 73,
+        -84, 120, 19, 97, 73, -77, -4, 111, 108, -82, 97, -94, -92, 59, 98, 100,
+        -83, 10, 27, -93, 1, -36, -67, -79, -72, -127, -105, 101, 88, -88, 68, 86,
+        47, 121, -119, -32, -113, -88, 66, 45, -68, 57, -75, -71, 40, -32, 48, 94,
+        101, -24, 33, -49, -120, 127, -112, 69, 81, 99, 83, 113, -34, -112, 117, 44,
+        101, 48, 43, -29, -99, 59, 0, -64, 66, -105, 121, 55, -36, 24, -37, -24,
+        -114, -122, 98, 60, 122, 120, 84, 22, -45, 80, -76, -33, -35, -2, 91, 103,
+        85, 51, -99, 111, 28, -12, -29, 7, -12, 77, -3, -79, -46, 75, 84, -35,
+        97, -126, 22, -119, -118, -123, 101, -64, 2, 117, -67, -48, 59, 122, -85, 115,
+        35, -33, 50, 53, -89, -61, -72, -18, 36, -65, -15, 74, 30, -36, -17, -44,
+        8, 100, 47, 123, -50, 20, -50, 88, 28, 41, -119, 100, -19, -76, 83, -92,
+        53, 90, 121, 66, 65, -116, 14, -3, -109, 95, -10, 87, -100, -44, -64, 5,
+        -94, 91, 0, -56, -46, 37, -32, -68, -56, 7, 28, -65, -124, -47, -60, 119,
+        -16, 115, -72, 123, -52, -35, 88, -38, 65, 33, 77, 41, 37, 107, -69, 120,
+        48, 18, -120, -94, 84, 36, -69, -66, 118, -84, 56, -124, 50, -84, -24, 80,
+        93, -105, 18, -87, -86, 36, -119, 6, -39, -3, 41, 28, 16, 24, 107, -47,
+        -54, -1, 0, -63, 18, -25, -50, 53, -126, -119, 98, 29, -38, 52, 61, 108,
+        12, 54, -7, 40, -113, -101, 78, 40, 69, 93, -75, 18, -27, -60, 123, 115,
+        -88, 101, -28, 113, -79, -120, -81, 87, -1, 39, -38, 78, -7, 98, -29, -25,
+        -33, -61, -30, 61, 64, 119, -63, 120, -22, 98, 80, 39, -14, 119, -124, 88,
+        61, -101, -78, -9, 96, -97, 18, -28, -119, 52, -37, -126, -3, 108, 104, 74,
+        112, -11, -107, 1, -112, -105, 102, 110, -52, -55, -68, 33, 120, 73, 16, 85,
+        -52, -15, -40, 108, 120, -86, -14, -33, 126, 120, -120, 91, 70, 6, 112, -106,
+        60, 39, -75, -91, -85, 70, 81, 56, -105, -44, 57, 52, 55, -81, -101, 47,
+        95, -110, 86, 22, -127, -5, -54, 9, 11, -49, 20, 70, 110, 47, 40, -19,
+        -77, 92, -110, 41, -123, -110, -82, -47, 104, 32, 50, 32, -26, 81, 124, 53,
+        50, 73, 38, 79, -47, -88, 11, 73, 35, -118, -117, -64, 27, -16, 21, -71,
+        -92, 23, -124, 110, 83, 32, -34, 62, 86, -53, 71, -30, -105, 23, 74, -126,
+        -22, 27, 7, 113, -2, -56, 65, -100, -53, 65, -100, 123, 26, -43, 40, -85,
+        10, -97, -62, -9, 112, -103, 47, -72, 43, 80, 68, -54, -4, 64, -41, 121,
+        -4, -104, -124, -126, 42, -108, -53, -37, 95, -112, 83, 7, 47, 20, 20, -95,
+        -100, 51, -28, -84, -78, 37, 100, 104, 100, 110, -88, -119, -89, -28, -80, -32,
+        52, -19, -48, 9, -78, 70, -59, -38, 7, 42, 22, -52, 44, -30, -110, -97,
+        7, -39, -55, -48, -117, 109, -102, 93, -102, -40, -82, 48, 89, 4, -21, -104,
+        48, -122, 4, -44, 22, 87, -98, -13, 64, -127, -39, 54, 43, 63, -12, -16,
+        72, 19, -78, -55, 61, 65, 120, -6, 43, -12, -35, -19, -44, -76, 100, -59,
+        97, 95, -66, -20, 45, 93, 126, 59, 97, 19, 85, -93, 15, -115, -85, -7,
+        -66, 118, -104, 59, -116, 2, 33, -87, -1, 10, -8, 25, 48, 5, -119, 26,
+        99, -95, -42, -104, 64, 100, -42, 14, 68, -84, -45, -126, -111, 19, 23, -95,
+        0, 103, 38, 0, -121, -8, 7, 5, 54, 51, 13, 108, -50, 2, 18, 67,
+        -121, 87, 5, -81, -33, 23, 16, -24, -14, 18, -25, -91, 18, -25, -94, -60,
+        57, -80, 96, 53, 43, -33, -72, -60, -91, 85, 77, -21, -42, -44, 10, 102,
+        -12, 14, -38, 66, -110, 13, 99, -113, -110, 112, 27, -51, 1, -35, 127, -104,
+        -27, -64, -83, 71, 115, -68, -127, -83, 3, -58, -30, 44, 4, -117, 118, 51,
+        91, -119, -17, 54, 103, 109, -76, -29, 111, 24, -97, -52, 6, 95, 42, 42,
+        112, -89, 4, 81, -11, -59, -38, 60, 6, 85, -121, -88, -53, -13, 44, 124,
+        76, 29, 80, 113, 15, 92, 39, 67, 124, -37, -29, 17, -128, -121, 92, -28,
+        91, -90, 114, 120, -77, -97, -127, -66, -90, -80, 116, -123, -33, 77, -68, 78,
+        -34, -11, -24, 11, 125, 11, -6, 63, -79, -33, 31, 113, 43, -69, 116, 81,
+        1, -87, -51, 98, 83, -47, 118, 3, 61, 6, -9, -53, -54, -73, -79, 29,
+        -85, 58, -74, 99, 101, 99, 59, 56, 9, 79, 109, -45, 75, -9, 126, -110,
+        90, -106, 117, 53, -127, -96, -115, -84, 110, -23, -49, 68, 32, 41, 114, -34,
+        -80, -78, 1, -104, 107, 60, -49, 84, 15, -121, -92, 22, 44, 121, -82, -12,
+        -19, 94, 2, 79, 75, 81, -23, -33, 73, -21, -84, -122, 94, -109, -14, -80,
+        -61, -61, -42, -123, -61, -115, 32, 44, -99, -3, -19, -10, -115, -121, -56, 51,
+        -9, 40, 26, 108, 104, -99, -128, 28, 125, -64, -24, 48, 91, -40, 112, 2,
+        58, -37, -114, -9, 29, -29, -71, -14, -84, -33, 98, 108, -78, -121, 126, -20,
+        -15, -72, -101, 54, -112, -15, 84, 104, 114, 24, -127, 10, 91, 14, 31, 101,
+        108, -123, -100, -60, -92, 102, -3, -123, 125, 120, -45, 57, -73, 9, 90, 87,
+        86, 121, -90, 6, 10, 123, 10, 84, -34, 93, -40, 19, -36, -34, -3, 32,
+        -71, -25, -2, 85, -36, -15, -9, -110, -121, -35, -82, -28, 9, -33, -104, 100,
+        83, -100, -86, 13, 73, -108, -48, -33, -67, -120, 50, 14, -100, -121, 112, 5,
+        -106, -93, 51, 15, -71, 1, -64, 49, 72, 7, -87, -7, 116, -24, -93, 19,
+        118, 45, -1, 28, 72, 110, -103, -97, 66, 126, -22, 45, -60, -31, -101, 5,
+        6, -41, -28, -51, 45, 56, 79, -30, 72, -114, -75, -127, -68, 101, -25, 108,
+        97, 57, 60, 52, -2, -101, -32, -127, 122, 7, 46, -11, 22, 72, 66, 49,
+        16, -89, -37, -53, 122, 93, -81, -45, -19, 37, -67, -82, -37, -35, 77, 22,
+        -10, 123, 68, -17, 12, -81, 100, 22, -49, 42, 0, 94, 98, 54, 8, 87,
+        -85, -36, 1, -56, -113, 0, -14, 99, 14, -7, -95, 0, -44, -62, 67, 123,
+        15, 127, 97, -31, -69, -104, 48, -102, 88, 99, 44, -61, -100, -66, 2, 100,
+        -63, -17, 62, 15, -25, -40, 109, 85, -111, 23, -10, -104, 87, -16, 125, 85,
+        88, 41, -47, 27, -5, -22, 51, 15, 97, 45, -85, -78, -67, 23, 85, -37,
+        14, -107, 87, -26, -59, 119, -122, -34, -4, -116, -123, 82, -69, -127, -117, 124,
+        -47, 96, 27, -32, -52, -19, -117, 125, 50, -100, -122, 112, -54, -59, -110, -61,
+        103, 1, -97, -74, -123, 87, 7, -93, -11, -110, -105, -86, 52, 47, -74, 42,
+        -4, -120, 101, -82, 84, 50, 23, 120, 30, 22, 80, 44, 15, -73, -5, 43,
+        98, 81, -78, 77, -39, -69, 59, -107, -86, -42, 125, -103, -53, 125, 41, -57,
+        -76, -37, -125, 50, 86, -120, -18, -60, 94, 13, -75, 43, 65, -18, -46, 112,
+        -89, 123, 94, 52, -87, -15, 38, 36, -60, 105, 74, 66, 69, -126, -86, -44,
+        -123, -37, -111, -105, 7, -122, -116, -91, -42, 9, 99, 22, 8, 81, 125, 127,
+        4, -24, 73, 72, -26, 1, 53, 1, 13, -72, -64, 127, 102, -127, 20, -14,
+        -9, 115, 34, -70, -5, 25, -32, 35, 41, -19, -17, -93, -62, -36, -78, -97,
+        122, -128, 93, 118, -30, 33, 67, 82, -43, -77, 94, -26, -98, 88, -124, -109,
+        -45, 89, 96, 73, -19, 103, 126, -71, 51, 66, 50, 51, -44, 79, -56, 78,
+        -54, 121, -112, -109, 32, -53, 54, 83, 84, -4, 12, 99, 45, -98, -108, 6,
+        7, -27, 22, 88, 110, -82, -54, -51, -95, -36, 77, -64, -60, -51, -15, 20,
+        -10, 39, -103, 102, -3, -103, -97, 105, -69, 52, 19, -69, 100, -107, 8, 115,
+        -95, 46, -43, -59, -67, 93, 76, -45, -2, 28, 80, 56, 63, -115, 22, 50,
+        -113, -73, 54, -33, -7, 70, 119, 102, -59, -103, 42, -26, -39, 46, -26, 27,
+        124, -44, -87, 16, -128, 26, -119, 8, -45, -78, -126, 20, -109, -77, -74, 13,
+        -40, 42, -60, 105, -14, -27, 36, -73, 92, 64, -28, -67, 83, -11, -116, 106,
+        86, -80, -46, 89, -16, 116, 88, -15, -31, -96, 2, -88, 104, -50, -69, 115,
+        73, -75, 43, -33, 57, 43, 56, 101, 0, 124, -80, 66, 64, -9, -94, 115,
+        -35, 45, -2, -40, -62, 15, -74, 62, -16, -63, -16, -121, 43, 22, 42, 117,
+        -124, 75, 71, 119, -89, -123, -97, 83, -116, 110, 98, 35, 84, -62, 125, -124,
+        74, -40, -124, -126, 103, -64, -32, -26, 66, 103, -94, -92, 55, -93, 45, 17,
+        114, 4, 88, 42, -81, 40, -41, -40, 10, 5, -51, -22, 24, -116, 56, -113,
+        -9, 31, -23, 40, -56, 27, -39, 33, -40, 54, -99, -72, 82, 19, -35, -32,
+        115, 53, 11, -92, -109, -58, -77, -24, 93, -100, -10, 28, -26, 116, -77, -65,
+        -94, 63, -18, -109, 66, -112, -71, 72, 111, -19, -85, 73, 30, -117, 42, 85,
+        37, 13, 102, 118, -66, -107, 77, 80, 80, 81, -47, -54, -118, 59, 18, -19,
+        11, -113, -94, -40, 16, 3, 74, -116, 91, 106, 14, -61, -46, 70, -72, -23,
+        59, -28, 107, -87, -113, -14, -38, -91, 81, 123, -121, -16, -46, 76, -114, -58,
+        76, -111, -54, 45, 71, -109, -69, -54, -41, -59, 66, -103, -17, 75, 38, -61,
+        -34, 30, -107, 22, -116, -70, 22, 95, -76, -66, -112, -20, 24, 13, -102, -35,
+        -102, 75, 34, -3, 46, 87, -124, 60, -30, 89, 69, -126, -114, 20, -90, -72,
+        30, 78, -40, 59, -82, -16, -99, 43, -110, 39, -14, -91, -105, -27, -117, -25,
+        -34, 116, -89, -22, -98, -77, -70, -25, 34, -122, -83, 72, -98, -56, 119, 96,
+        -106, 47, 30, -125, -109, 29, -109, 40, -78, 85, 5, -20, -50, 126, 104, -121,
+        91, 105, -121, 78, -99, 69, -80, 15, -120, -60, 16, -97, -28, 44, -26, 17,
+        112, -63, -25, 12, -118, 103, 45, -22, -30, 116, 42, 53, 93, -33, -24, -41,
+        2, -1, 90, -89, -101, 106, 103, -42, 10, -68, 39, 86, -100, -95, -48, 57,
+        -102, 93, -34, -64, 63, -43, 16, -74, 117, -58, -70, 115, 102, 79, 104, -99,
+        88, -92, 78, 69, 46, -50, 65, 116, -7, -92, -112, 50, -81, -101, -81, -87,
+        76, 123, 75, -127, -77, 52, -18, -128, -65, -10, -97, -116, -122, 95, -66, -16,
+        -73, 125, -8, -19, 30, 30, 46, -32, -104, -52, 92, 35, 102, -81, 46, 76,
+        120, 96, 1, -96, 84, -116, -52, 38, 117, 73, 111, -71, -73, -32, 70, -22,
+        85, -122, 22, -43, -58, -80, -99, -26, -24, 34, -48, -12, 89, 23, -82, 32,
+        56, -40, -9, 12, -82, 34, -46, 44, 93, 4, 35, 99, -109, 117, -51, -46,
+        89, 127, 113, 60, 38, 74, 102, -47, 27, -95, 64, 117, -77, -91, -40, 109,
+        -121, -121, 112, -53, -31, -113, 47, 95, -100, 37, 83, 56, 37, -127, -112, 63,
+        -37, 25, -123, -74, -68, -48, -70, 110, -37, -41, -72, 63, -88, -124, 117, 3,
+        63, 60, -10, 21, 110, -126, 57, -4, -64, -83, 9, -9, 43, -107, 62, -80,
+        80, 83, 76, -77, -108, 43, -77, -83, -125, 107, 93, -75, -108, -79, -26, 107,
+        -63, -100, 47, -127, 124, -123, -123, -51, 88, -43, -85, 32, -77, 41, -57, 46,
+        -67, -75, 59, -71, -126, -87, 47, -125, 43, -74, -52, 83, -2, -41, -121, 44,
+        72, -37, -14, 52, 118, 45, -84, 93, 58, -3, 119, -127, -20, -93, -116, -92,
+        -123, -22, -22, 29, 87, 93, 93, 35, -32, -19, 85, 79, -67, -13, 72, 79,
+        -26, 107, 116, 83, 91, -109, 15, 66, 111, 43, 51, 117, -75, 112, 5, 118,
+        66, 120, 85, 79, 87, -80, 85, -68, -11, -74, 76, 85, -12, -42, -124, 6,
+        27, 48, 56, -37, 106, 44, 89, 118, 48, -36, 58, 48, -39, 26, 96, -78,
+        -83, -126, 73, -107, 126, -46, 126, 127, 37, 37, -43, 124, -57, 26, -14, -98,
+        91, 78, 29, 108, 117, 1, -115, -10, -108, -46, -14, -54, 19, 79, -61, -111,
+        -95, 59, 30, 27, -38, -121, -116, 38, 122, -49, 61, 41, 15, -72, -8, -81,
+        -40, 83, -86, 47, -97, 32, -116, -9, 101, 75, -47, -83, 44, 122, 62, -111,
+        124, 71, -31, -98, -56, -33, 57, 96, 67, -28, -45, -103, -92, -51, -44, 121,
+        34, 31, -47, 126, 125, -75, 99, 123, 53, -26, 48, -38, -41, -54, -98, 104,
+        109, 28, 30, -26, 53, -35, -83, -105, 77, -107, -120, 7, -77, 85, -93, 103,
+        65, -64, 1, 13, -53, -128, -92, -68, 90, -78, -83, -4, 125, -66, -101, 8,
+        127, -119, -106, 91, -35, -16, -3, 121, -18, -105, 92, -127, -90, 123, 43, -95,
+        68, -35, 116, 19, 58, 105, -13, -76, -126, -49, 106, 75, -19, 77, 37, -13,
+        82, 93, -47, -94, -4, -26, -14, -120, -112, -83, 108, -32, -79, 105, -89, 114,
+        70, 86, 57, 101, 81, -80, 41, 88, 30, 107, -2, -62, 43, 59, 48, 117,
+        -54, 93, -12, -62, 74, 39, -67, 80, 119, -77, 95, 109, 4, -93, 81, -108,
+        90, -23, 87, 91, -23, -93, -29, -116, -64, 48, -21, -128, 50, -38, 119, -52,
+        -103, 28, -82, -7, -55, -105, -120, -76, -118, 29, -99, -33, -120, 8, -95, -95,
+        -78, 58, -58, -58, -42, -49, 120, -19, -78, -42, 41, 125, 40, -38, -75, 104,
+        105, 95, -31, -95, 11, 121, 78, -113, 101, 65, 3, 88, 113, -112, -79, -102,
+        35, 97, 27, 37, 66, -78, -44, -42, 121, -71, 45, 32, -83, 26, -73, 113,
+        21, 100, -67, -72, 42, 51, 56, 26, 61, 127, -110, -61, -78, -89, -75, -103,
+        123, -73, 22, 90, -18, 55, -75, 92, -101, -87, 63, 39, -86, -23, -93, 25,
+        -20, 113, 101, -115, -47, -64, -24, -53, -105, -24, -92, -102, -127, -10, 72, 108,
+        20, -40, 25, 35, 106, 19, -45, -80, 102, -78, -33, -32, 5, -23, -55, 86,
+        38, 47, -46, 50, 34, -39, 113, 95, -83, 11, -125, -39, 21, 125, -18, -22,
+        -20, 97, 22, -100, -88, 40, 26, -96, 121, -31, 33, 64, 74, -56, -75, 20,
+        105, 19, 8, 126, -46, -50, -84, 102, -123, 116, 11, -22, -21, -76, -65, 122,
+        -9, 48, -102, 34, -33, -2, -42, 34, -113, -89, 75, 42, -51, -15, -50, 89,
+        -84, 92, 111, -34, -34, -75, -76, 22, -19, 123, -75, 58, 85, 126, -90, -55,
+        -27, 52, -2, 107, 113, -40, 76, 102, 106, 97, 30, 21, 43, -26, 125, -91,
+        -23, -106, -105, -70, 116, -124, -94, 80, -87, 52, -98, -45, 107, -116, -72, 99,
+        10, -7, -5, 92, -16, -72, -9, -20, -128, -42, -56, 67, 82, 32, 92, -103,
+        -76, 57, -127, 95, 42, -86, -53, -111, -109, 91, 104, -7, 62, -66, 119, 4,
+        -55, -111, 45, 79, -68, -45, 44, 66, 114, -1, -19, -72, -109, -125, 92, 11,
+        33, 118, 123, -107, 49, 43, -117, -61, -61, -125, -7, -105, 47, 121, -85, 27,
+        -55, -63, -111, -40, 58, 99, -16, 125, 19, -124, -3, -116, 9, 105, 84, 33,
+        -32, -35, -33, -121, 115, 10, 114, 70, -83, 32, 19, 7, -76, 118, 1, 37,
+        87, -39, 114, 114, 115, 12, 76, -39, 26, -1, -71, 57, 73, -31, -41, 73,
+        50, 117, 44, 70, -81, 93, 90, 106, 88, -83, 62, -9, 110, -40, 88, -122,
+        43, -87, -27, 86, -107, 59, 103, 127, 85, -81, -94, -121, 92, -22, 94, 111,
+        91, -41, -103, 120, -12, -48, -51, -58, -39, -72, 39, 44, -66, 47, -35, 103,
+        20, 41, -43, -71, 57, 2, 70, -17, 90, -65, -31, -42, 71, 51, 119, 2,
+        29, 30, -28, -19, -72, 70, -34, -36, 44, -118, 19, -42, -38, -78, 31, -116,
+        68, 0, 94, 82, 30, -70, 99, 127, 110, -125, -68, 20, 116, -11, -20, -114,
+        123, 43, -85, 13, 67, 125, 29, 39, -85, 40, -73, 102, 98, 112, 116, 24,
+        -59, 21, 106, -105, -110, -86, 40, 16, -10, -37, 74, 23, -25, -33, -71, 11,
+        -92, -76, 115, -19, -58, 56, -29, 11, -63, 78, -18, 125, -96, 48, 2, -117,
+        -44, -114, -25, -42, 113, 107, 15, -27, -89, -32, -26, -119, 115, -49, -50, -27,
+        81, -22, 122, 47, -126, 53, 126, -13, 96, 79, 9, -80, -108, -127, -61, 61,
+        -44, -61, -59, 95, 0, -22, 120, -109, -66, 91, 39, -85, -104, 71, -108, -11,
+        94, 120, -64, 75, 0, 35, -60, 60, -92, 45, -125, -69, -63, -97, 30, 127,
+        32, 69, 110, -76, 118, -51, 47, -82, 46, -95, 116, -91, 109, -47, -20, -83,
+        104, -46, -107, 120, 76, -99, 112, -90, -83, -85, 2, -3, 69, -101, -128, 7,
+        -45, -68, -102, -10, 71, -2, -107, -25, 28, -64, 37, -77, 60, 30, -71, 4,
+        30, 67, -96, 71, -76, 21, 3, -108, -95, 66, 5, 77, -85, -51, -66, 20,
+        71, -97, -75, 124, -19, -17, 45, -78, -108, 26, -60, 124, 76, 48, -124, 63,
+        -3, -6, 62, -81, -127, 37, -89, -125, 113, -26, -33, -80, 31, -25, -2, 90,
+        -15, 97, -106, -123, -74, -33, 116, 94, 40, -104, 41, -114, 126, 89, -84, 47,
+        2, -10, 52, -24, -113, 38, 69, 105, -19, 69, -84, -19, -47, 52, -105, 86,
+        -74, -65, -60, 121, -79, 122, 65, -63, 74, -50, -40, -22, -57, -82, -97, -15,
+        -32, 71, 73, 16, 95, -28, -105, 40, 2, 94, -88, 71, -99, 85, 63, -31,
+        22, -76, 53, -82, 96, 44, -55, -22, 90, -42, -102, -119, -36, 73, 120, 28,
+        44, 72, -90, 19, 34, 45, 39, -114, 81, 127, 4, -32, -109, 74, 125, 54,
+        28, 66, 122, -87, -65, 43, 69, 125, -64, 17, 89, -112, 3, 39, 109, -29,
+        -64, -85, -99, 69, -3, 21, 52, 65, -3, -47, -29, 46, -12, -105, -15, -2,
+        -72, -95, 53, 115, -1, -105, -63, -58, -91, 59, -35, -10, -76, -78, 62, -74,
+        91, 83, 57, -3, -111, 70, -112, 67, -70, 45, 75, -57, 30, 41, 108, 121,
+        -16, 69, -32, -13, 105, -28, -9, 71, 36, -40, 35, -81, -7, -95, -18, 36,
+        31, -106, -103, 22, 35, -68, 40, 46, 31, 27, 45, -77, -8, -6, 104, -103,
+        5, -22, -25, 82, -89, -52, -48, 82, 28, -62, -72, 10, -92, -75, -16, -87,
+        86, 37, 14, 80, -40, 11, -21, 65, -112, 89, -24, 32, 16, -77, 56, 86,
+        -71, -14, -35, -106, -117, -80, -9, -103, 1, 42, 0, 3, -80, -29, -57, -116,
+        70, 69, -3, -97, -68, -76, 115, -95, -38, 53, -64, -118, 120, -88, 96, -126,
+        -11, 20, -50, -59, -91, 20, 96, -108, 17, 84, 19, 70, 86, 122, 78, -8,
+        -78, -31, -14, 115, 80, 9, 97, 31, -62, -100, -62, 99, -111, 1, 39, 49,
+        -124, 89, 41, 1, -55, 69, 120, 73, -95, -49, -12, -108, -34, -120, -91, -15,
+        76, 51, 49, 98, 2, -29, -18, 58, 37, 63, 120, 93, 87, -68, 0, -77,
+        120, -120, -84, 27, 109, -2, 111, 116, -61, 65, 12, 45, -5, 54, -78, 105,
+        -94, -119, -31, -82, 80, 72, 27, -107, -105, -61, -80, 62, -12, 76, 23, 123,
+        48, -91, -104, -127, 39, -7, -84, 67, 114, -119, -25, -96, -66, -6, 69, 12,
+        3, -41, 19, -35, -121, 21, 90, 66, 26, -80, -76, 50, 44, -68, -127, -114,
+        99, 79, -66, -74, 45, -29, 53, -42, -16, 27, 72, -113, -7, 122, 22, -43,
+        29, -86, 30, 123, -113, -93, 48, 96, -4, 22, 51, -115, -103, -23, 82, 100,
+        17, 106, -118, -6, -82, -70, 41, -35, -70, -102, -58, 85, -39, -43, 79, -99,
+        73, -52, -117, 36, 41, 123, 35, -62, -27, -69, -64, -59, -8, -25, 63, 125,
+        88, -128, -124, 93, 26, 127, -111, -90, 51, 43, -81, -5, -105, -53, 78, -75,
+        14, -41, -69, 47, -6, -9, 121, -72, -20, -100, 116, -98, 72, -21, -124, -81,
+        30, -122, -91, 73, 125, 101, -96, 86, -35, -46, -104, 50, -105, -17, -46, 63,
+        64, 49, 112, -84, -72, -87, -18, -96, -56, -14, 85, 121, 79, 25, -22, 16,
+        -12, -113, 45, 110, -109, 92, 77, -76, 43, 10, 69, -47, 104, 95, 81, 105,
+        7, 122, 28, 79, 71, 126, 120, 18, 35, -43, 48, 20, -84, 44, -30, -122,
+        -119, -94, -50, -20, -90, 70, 116, 28, 87, 77, 86, -124, 50, 110, 21, 98,
+        -10, 72, 51, 26, 47, -10, 66, 95, 71, -36, -51, 18, 82, 17, -16, 5,
+        -110, 49, 65, 25, 15, -114, 101, -77, -12, -122, -66, 98, -73, -48, -89, 45,
+        55, -103, -17, 24, -112, 57, 35, -101, -9, 98, 21, -49, 62, -55, 2, 70,
+        -59, 108, -13, 62, -55, 86, -42, -68, 28, -123, 27, -86, -27, -82, -18, 97,
+        -96, 104, 49, 15, 57, 95, -57, -66, 24, 20, 63, -115, 45, 24, 42, 16,
+        -73, 112, 84, 32, -19, -91, 69, 32, 45, 34, -58, 6, -88, 43, 48, 49,
+        16, 126, 64, 47, 2, 78, -84, 93, -91, -94, 10, 22, 6, 28, -35, 107,
+        104, -21, 55, 10, 26, 84, 117, 29, 1, -53, -114, 38, 68, -85, 120, -55,
+        112, -20, -33, 80, 58, 82, -76, -119, 11, 40, -119, -4, 9, 13, 13, 61,
+        -91, 90, 90, 82, 49, -34, -22, 74, 4, -47, -29, 97, 99, -59, -102, 17,
+        39, -102, 68, 58, 93, -51, -15, 97, 88, 59, 30, 27, -127, -61, 125, -78,
+        49, 7, 103, 14, 82, 28, 77, 1, -77, -119, 12, 67, -5, 88, 44, -57,
+        2, 54, -51, -29, 98, -103, -124, 91, -75, -105, 124, 124, 20, 75, -70, 16,
+        -39, 104, -8, 97, -74, 109, 113, -104, -47, -44, 60, 51, -113, 118, -107, 1,
+        -6, -51, 87, -55, 106, -92, 120, -58, 34, -70, -31, 3, -1, -81, 85, -100,
+        -112, 20, 110, -114, 109, 89, -60, 56, 76, 93, -119, 34, -54, 71, -101, 85,
+        -93, 20, 7, -75, -7, -94, 57, 64, -116, 4, -29, -24, -53, 23, 82, 80,
+        -128, -82, -55, -65, 39, -55, 113, 98, 32, -62, 100, -119, 98, 58, -12, 73,
+        77, 1, 57, 57, -107, -100, 77, -111, 122, 3, 2, 57, 65, -59, 92, -44,
+        90, -125, 63, 99, 84, -95, 29, 68, 66, 32, 115, 63, -111, 20, -51, -68,
+        -68, 29, -52, 107, -27, 84, 115, 50, -61, -36, 94, 114, 56, 113, 30, 98,
+        63, 71, -30, -37, -37, -114, -4, -60, -37, -114, -3, -123, 119, -17, -49, 119,
+        -4, -58, -29, 7, -122, 54, -24, 13, -113, -83, 40, -62, -77, 9, 9, -115,
+        64, 18, 76, -72, -11, 49, 123, -97, 3, -121, 38, -37, -35, 113, 119, -43,
+        75, 76, 125, 27, 94, 69, 73, -95, -6, 100, 60, 41, 112, 99, 124, 85,
+        -4, -48, 99, 75, -25, -57, 94, -124, -113, -60, 19, -10, 94, 94, -26, -82,
+        -59, -32, 121, -37, 44, -121, -49, -104, -76, -121, 86, 43, 18, -11, 6, -21,
+        58, 14, -100, -117, -60, 106, -85, 51, -94, -88, -95, 62, 39, 114, -108, 13,
+        -126, -100, 94, 29, 96, -60, -102, 49, 39, 109, 61, -18, 52, -18, 55, 91,
+        5, -90, 62, -51, -95, 35, 81, 64, -76, -96, -99, -98, 9, 44, -60, 117,
+        38, 44, -73, -41, -84, 68, 80, -1, 45, 67, 79, -101, 72, -58, -42, -27,
+        0, 113, 127, 120, 104, 70, 23, 107, 40, -22, -18, -68, 117, -112, 13, 54,
+        -80, -49, -34, 18, 126, 124, -58, 31, -41, -104, -126, 2, -72, -113, 31, -15,
+        115, 19, 116, -69, -34, 85, 48, -45, 121, -91, 44, 47, -112, -95, -31, -46,
+        -119, 28, -121, -61, 97, 116, 9, 87, 22, -105, 4, -93, 80, 15, 15, -67,
+        10, 40, -24, 88, -102, 65, 102, 68, -32, -69, 59, 109, 13, 60, -2, 72,
+        127, -57, 2, 114, -1, -110, -27, -73, -31, 106, -123, 23, 120, -31, 78, 54,
+        44, -15, -125, 12, -4, -18, 60, 92, -89, -2, -35, 96, -5, -10, -118, 98,
+        -3, -54, -46, -36, 21, 125, -63, 99, -60, -65, -31, 95, 127, -110, 69, -109,
+        12, -99, 8, 103, 114, 102, -117, -116, -24, 108, 2, 75, -101, 14, 15, 46,
+        63, 51, 61, -30, 32, -94, 67, -6, 8, 102, 52, -40, -72, -98, -16, -101,
+        83, 94, -3, -46, 72, -26, -122, -4, 3, -50, -48, 61, -98, 17, 118, 72,
+        110, -43, -88, 36, 38, 70, -63, 93, 17, -3, -106, -49, -93, 124, -102, -7,
+        -92, 82, -81, 122, 64, -31, 30, -109, -41, -78, -75, -37, 6, 21, 76, -26,
+        81, -24, -73, 73, 5, -66, -8, -125, 9, -118, 99, -90, 52, 103, 53, 93,
+        46, 16, 114, -94, -96, 60, 23, -86, -14, 1, 53, 113, 92, -31, -28, -116,
+        -31, 69, 81, 5, -39, -43, -43, -91, -98, 25, 79, -39, 79, 31, -91, 33,
+        -75, -117, -92, 26, 54, -106, 107, 85, -77, 92, -67, 110, -89, -33, -23, -10,
+        106, -58, 29, -38, -57, -3, 42, -99, -21, 3, 11, -43, -88, 11, 96, -41,
+        -51, 81, 23, 98, -44, -59, -34, 81, 67, -77, -83, -58, -20, -105, 70, 91,
+        110, -116, 29, -48, 118, 96, 84, -41, -57, 14, -63, 35, 113, -85, 71, -24,
+        -42, -11, 30, 123, -124, 110, -83, 71, -56, 114, -96, 111, 81, 28, -80, -59,
+        46, 110, -32, 31, -110, 16, -39, 49, -48, 45, 78, -80, 78, -102, -5, -128,
+        106, -24, -24, 47, 12, 48, 105, 121, -87, 56, 122, 21, 107, -13, -122, -113,
+        -81, 102, 13, -48, 28, -108, 44, -79, -104, 88, -41, -5, -60, 37, -100, 11,
+        -75, -31, -9, -63, 66, -40, -106, 107, -101, 126, 47, 54, -3, -66, -60, 5,
+        -95, 69, 1, 112, 92, -97, 8, -95, -111, 76, -23, -109, 20, -9, 96, 76,
+        -98, -82, 59, -107, -50, -15, 77, -74, -26, 19, -122, -9, 6, -124, -24, 60,
+        3, 62, -115, 124, -17, 15, -67, -2, 8, 93, -27, -96, 63, 122, -76, 58,
+        39, -93, 102, -77, 59, -90, -22, -33, 117, -3, 79, 46, -83, 108, -127, 43,
+        -117, 18, -87, 54, 104, -66, 32, 52, -33, -80, 11, -59, 119, -35, -123, -94,
+        105, 23, 118, 59, -66, -32, 57, 49, 0, -5, 14, 64, 113, -23, 69, 14,
+        -128, -27, -50, -101, 1, 58, -35, -19, -23, -88, 32, -77, -33, 112, -16, -14,
+        -73, 119, -81, -111, 38, 34, -13, -32, 24, -61, 78, 2, 104, 0, -80, 74,
+        122, 68, -110, 40, 15, 56, -87, -40, -69, -127, 101, -128, 123, -82, -16, -25,
+        30, -34, -125, -2, -38, 83, -105, -97, 127, -19, -31, -107, -24, 47, 119, 28,
+        -6, -15, -96, -8, 27, 65, -47, -64, -91, 121, -118, 64, -17, 95, -63, 12,
+        -67, -37, 96, -24, 109, 43, -85, -84, -92, 60, -73, -57, 53, 121, -109, -37,
+        94, -49, -37, -10, -5, -18, -99, -125, 47, 0, -122, -56, 84, -98, -39, 90,
+        -38, 84, -41, 30, 82, -49, -39, 91, 34, 92, 84, 117, 64, 39, -109, -78,
+        -32, 77, -107, 94, 33, -91, 55, 53, -31, -87, -108, -21, 2, 75, 81, -82,
+        -63, -92, 108, -107, 52, -28, -12, 57, -18, -120, -38, 86, -95, 80, 13, -11,
+        57, -86, 73, 100, 63, -54, -115, 106, 29, 90, 30, -99, -53, -123, 75, 13,
+        -110, 54, -55, -98, 50, -24, -19, 94, 57, -45, 16, -105, -15, -74, 92, 76,
+        -21, -3, 64, 62, 121, -109, -55, 89, -61, -58, 12, 47, -89, -115, -71, 86,
+        -87, -58, -50, -75, -11, 21, -47, 92, 106, -54, 63, -24, -89, 13, -88, -14,
+        10, -94, -41, -99, -98, 26, 55, 67, 19, 91, 116, -99, -46, -85, 54, 123,
+        -77, 66, 102, 72, 59, -92, 68, 21, -1, 41, -97, -76, 5, -4, 69, -126,
+        -128, 42, -65, 103, 97, 95, 20, -125, 67, -34, 122, 121, -45, -83, 23, 86,
+        80, 0, -32, -102, 92, 51, 80, -46, 80, -127, -43, -38, 105, 16, 79, -60,
+        52, -104, -38, -7, -97, 21, 118, -114, -45, -15, -71, -100, 24, -114, -111, 40,
+        124, 78, -54, 35, -123, -49, -112, 0, 18, -8, -20, 28, 46, 52, -26, -122,
+        -84, -111, -96, 21, 50, 64, 18, -88, 6, -120, -3, -126, 17, -35, -21, -96,
+        -48, 105, -19, 37, 124, 114, 26, -100, 84, 42, -81, -127, 18, -63, -72, 4,
+        120, 59, -28, 81, -22, 37, 101, 16, -60, -85, -120, 109, 20, -115, 1, 97,
+        13, 43, 48, -122, 27, 117, 57, 111, -24, 109, -104, 50, -125, -44, -69, -58,
+        -37, -59, -54, -115, 123, 11, -104, 81, 118, -49, -71, -80, -113, -20, 52, 10,
+        18, 106, 33, -6, 19, -23, 102, 66, -112, 60, -46, 45, -104, -112, 123, -48,
+        -15, -23, -110, -7, -96, -34, -98, 22, 39, -26, 6, -13, -30, -126, -4, 46,
+        -14, -79, -87, 103, -12, 5, 123, -50, 22, 99, 6, 14, 94, -85, -39, 69,
+        -107, -45, -11, 116, -19, -33, 48, 98, 122, -61, -106, -78, -51, -88, -96, -95,
+        -2, -74, -97, -32, 73, -124, 107, 126, -125, 124, -128, 30, -54, -23, -53, -105,
+        110, 87, 60, -118, 63, -78, 77, 2, -89, 46, -45, 46, -66, -46, -38, -108,
+        40, 121, 54, -99, -7, -48, 58, 109, -44, -31, -31, 53, -13, 112, -46, -24,
+        -52, 84, -12, -96, -59, -102, -81, 64, 9, -53, 35, 96, 33, 72, 40, -54,
+        -76, -61, -2, 26, 46, -71, -55, -39, 95, 14, -42, -61, -43, -63, -84, 2,
+        -125, -82, 87, -41, 8, -62, -33, -105, 47, 78, 61, -116, 78, 56, 63, -8,
+        -104, 53, -57, 35, 87, -120, -67, -124, 43, -6, 43, 42, -117, 77, 3, 90,
+        122, 46, -27, -128, -119, -107, -104, -126, -55, -105, 25, 47, 33, -19, -17, 30,
+        -49, -29, -69, -50, 73, 23, -82, 68, -6, 121, -46, -99, -52, 45, 34, 113,
+        122, -119, 94, -11, -126, -65, 116, -88, 60, -83, 67, -48, -27, 11, -31, 119,
+        -82, -109, 104, -45, 61, 57, 46, -106, 33, 48, 111, -107, 32, -10, 37, 88,
+        16, -75, -43, 30, -12, -119, 70, -9, 59, 127, -111, 97, 65, -55, -36, -77,
+        -32, -26, -92, 12, -113, -3, 101, -62, 99, -30, -7, -99, -89, -53, -51, -92,
+        115, -107, 33, -73, -39, -49, -61, 121, -68, 46, -4, -50, 112, -46, 89, 101,
+        75, -65, -13, 28, -14, -70, 24, -67, 14, -58, 114, -46, -7, -117, 91, 110,
+        18, -93, 49, 121, -35, -29, 35, -102, -85, -21, 69, 61, 49, 111, 85, 16,
+        -15, -94, 44, -127, -62, -3, 59, -19, 76, -84, 122, 34, -53, -69, -43, 35,
+        71, -55, -28, -35, 36, -101, -42, 109, 3, 5, 95, 46, -61, 120, 109, 81,
+        119, -70, 117, -128, -82, -72, 51, -48, -121, -47, 43, -100, 73, 31, -54, 48,
+        -91, -8, -58, 114, 66, 40, -78, 20, -72, -72, 45, -80, 125, 22, 80, -86,
+        53, 87, 57, 42, -97, 121, -48, -84, 71, -74, -52, 65, -40, -122, 113, -106,
+        -45, 37, 98, -100, 73, -58, -48, -115, 68, -6, 51, 116, 81, -11, -40, -57,
+        -18, -56, 61, -23, -113, -12, -118, -77, 22, -27, -89, 116, -30, 53, -57, 91,
+        -74, -61, -17, 55, 23, 74, -102, 69, -42, -27, -41, 2, -117, -16, 115, -33,
+        91, 1, 57, 47, 112, -53, -46, -27, 65, -45, -13, -125, 35, 36, -14, -100,
+        -1, 124, 100, 101, -18, 74, -65, 43, -62, -3, 68, 95, 121, -53, -102, -81,
+        11, 19, 122, 125, 105, -13, 50, 16, 63, -18, 89, -64, 32, 30, 13, -63,
+        113, 19, -3, 24, 43, -62, -53, -80, -29, -43, 60, -4, 50, 29, 2, 1,
+        66, 103, 14, -22, 57, -64, -79, -53, -16, 31, -18, -45, 42, 97, 127, 22,
+        -127, 32, 28, -61, 38, -62, 49, 42, 19, -114, 49, 16, -114, -31, -50, 48,
+        -123, 90, -83, -2, 33, 9, -29, 9, 39, -125, -30, 105, 18, -108, 27, -122,
+        115, -24, -121, 22, 37, -78, -61, 67, 41, 93, -84, 90, 89, -110, 55, 51,
+        39, 15, 56, -6, -15, 72, -60, -124, 39, 90, -66, 50, 97, 94, 5, 92,
+        -84, 42, 70, -123, 75, 24, -52, -11, -13, 64, 51, -22, 84, -26, 13, 40,
+        -66, -58, 32, -15, -106, 52, 56, -9, -36, 102, 47, -97, -44, -52, 65, 15,
+        73, 17, 86, 67, 82, 76, 115, 122, 94, -7, -88, 41, 57, 111, 52, 14,
+        -58, -47, -41, -13, -1, 68, 91, 37, 83, -102, -61, 127, -64, -99, 115, -125,
+        73, -20, 69, -79, 33, -40, -30, 27, -83, 69, -58, 94, 97, -36, 11, -40,
+        38, 6, 37, 59, -100, 110, 88, -85, 21, 22, 54, -15, 83, -50, -36, 91,
+        -72, -70, 41, -80, 89, -124, -78, 43, -84, 114, 88, -122, -3, -115, -63, 64,
+        -26, 65, -35, 76, -87, 57, -45, 76, 9, -63, -26, 31, -14, -39, -43, 52,
+        -36, -90, 60, 5, 9, -104, 13, 100, -41, -52, -79, -107, 65, -56, 9, 93,
+        -76, -114, 110, -46, -76, -26, -101, 37, -8, 5, 49, 46, 109, -115, 116, 34,
+        -38, 28, -73, -97, 123, 36, 36, 41, 93, -92, 46, 92, -69, 127, -62, -23,
+        113, -70, 29, -72, 22, 19, 38, 54, 49, -53, -28, -18, 52, -41, -54, -28,
+        -70, 76, -59, 44, -103, -71, -45, 76, 43, -103, 49, -127, 75, 90, -10, 13,
+        111, -68, 112, -75, 68, 40, -8, -74, 86, -80, -73, -75, -100, 92, 80, 103,
+        -11, -81, 78, -128, 73, 114, -5, 59, -37, -60, 28, 111, 10, -108, 112, 10,
+        -85, 79, 27, -109, 18, -71, -101, 105, -9, 42, -6, 79, 91, -15, -40, -73,
+        -92, -33, -33, -126, -111, -75, -32, -93, -19, 8, 57, -12, -79, 98, 105, -59,
+        91, -23, -70, -3, 91, -87, 93, -103, 93, 123, 71, -75, 60, -120, -30, 67,
+        -18, -39, 105, -98, 21, -64, -34, -58, 13, 66, -89, 32, -52, 111, 72, -64,
+        -87, 20, 33, 117, -93, 114, -111, 121, 49, 2, -60, -93, 125, -8, -124, -90,
+        -11, 87, 119, 29, -15, -57, 108, 79, -76, -2, 9, -41, -81, -6, -15, 96,
+        51, -109, 105, -52, -32, 99, 12, -101, 89, 70, 105, 92, -92, -22, -54, -40,
+        -91, -41, -114, 112, -5, 89, 58, -93, -54, 112, 36, 123, 18, -71, 30, -57,
+        -17, 5, 90, 83, -43, -32, 20, 96, 76, 10, -31, 97, -123, -53, 101, 55,
+        93, 47, 103, -50, 45, -116, -44, -111, 61, 121, 108, 77, -34, 66, -78, -51,
+        91, 7, 89, -120, -18, -67, -94, 97, 117, -56, -46, 45, 39, -59, 92, -101,
+        -41, -110, -70, 121, -29, -19, 110, 101, -85, -123, -71, 124, 62, -23, -94, 102,
+        10, 21, 54, 110, 48, -82, 65, 46, -73, -125, -67, -70, -62, 85, 113, 21,
+        -26, 109, 75, -61, 98, 66, 15, 61, -37, -74, 10, 55, 94, 8, -121, -38,
+        -24, -100, 84, -93, 47, 48, -13, -68, 13, -112, 106, -54, 29, -46, -1, -21,
+        86, 117, 121, 120, -88, 57, -51, 49, 114, -68, 7, 56, -128, 43, 60, -128,
+        40, 57, -77, -43, 125, 77, 65, -35, -21, 91, 96, -7, 70, 59, -58, -8,
+        -11, -55, 61, 78, 77, 69, 65, 117, 108, -96, -18, -61, 67, 38, -45, 45,
+        -81, -87, -5, 96, -106, 107, 1, 87, 19, -95, 124, 66, -11, 126, -69, -66,
+        62, -17, 69, -10, -5, 36, 35, 125, 28, -52, -106, -41, -97, -12, 22, -42,
+        27, -107, 107, -15, -46, 68, 74, -9, 75, -61, 111, 126, -43, -121, -13, 126,
+        16, 23, -65, -122, -65, -94, -118, 27, -14, -57, -106, 14, -49, 38, 44, 52,
+        -127, 8, 41, -96, 40, 8, 12, -66, 6, -116, 16, 54, 88, 56, 113, -125,
+        -44, 8, -113, 69, 37, -105, 81, -63, -73, 113, -54, -12, 15, 56, 12, -9,
+        -70, 75, 64, 0, -91, 57, -80, -94, 104, -37, -126, -20, 107, 109, 1, -32,
+        -97, -125, -112, -14, 119, 37, -88, -2, 106, -88, 16, 36, 42, -77, 6, -5,
+        -8, -15, 85, 82, 16, -99, -81, 62, -65, 70, 65, -119, 106, -13, -67, 22,
+        54, 39, 97, 64, 30, 113, -34, -92, -56, -63, 87, 32, -66, -12, 118, -75,
+        29, 1, 35, 49, 26, -94, 66, -74, 21, 68, 66, -78, 73, 86, -125, 68,
+        -127, 127, -77, 122, 6, -32, 125, 91, 75, -72, 112, 103, 80, -69, 63, -98,
+        68, -122, 101, 57, -74, -104, 45, -105, 104, -36, -117, -73, 64, -42, 15, -58,
+        63, -64, 112, -6, 65, 14, 48, 85, -46, -23, -114, 111, -46, 44, 103, 109,
+        -47, 69, -84, 113, -86, 43, 119, -22, -108, 7, -38, -118, -121, 50, -85, -88,
+        -3, 47, 4, 124, -40, 10, 16, 4, 101, -67, -22, 76, -52, 115, 119, 70,
+        109, 96, 84, -44, -70, -127, 53, -88, 102, 25, -128, 87, 11, 115, 74, 123,
+        -76, 114, -29, -113, -83, 55, -2, 88, -65, -15, -57, -4, -58, 47, 115, 119,
+        -20, -22, -49, -125, -94, 76, -123, -95, 119, 47, 77, 107, -121, -13, 119, -120,
+        -41, -90, -102, 31, -90, -40, -11, 71, -64, -13, 105, 41, 43, -73, -105, -10,
+        -98, 3, 3, -88, -91, 69, -112, 118, 52, -90, 39, 112, -37, -43, 120, 52,
+        38, 111, 92, 9, -102, -104, 49, -43, -94, 126, -38, 71, 80, -75, -106, -42,
+        74, -115, -122, 84, -79, -79, 16, -76, 114, -36, 31, -77, -126, -16, 87, 115,
+        103, -95, 40, -15, 36, -55, -18, 79, -41, 121, -111, -27, -62, 60, -93, 104,
+        99, 104, 52, 113, -48, 33, 77, 84, -14, 43, -20, -42, 79, -79, 111, -82,
+        -87, 26, -94, -77, -48, 26, -126, -77, 104, 57, 86, -52, 59, 113, -71, 113,
+        70, -93, 80, -21, -117, 106, -21, -100, -126, 97, -78, -78, 6, -126, 42, -109,
+        101, -113, -58, -67, -123, -75, 11, 102, -49, 98, -55, -24, -85, -54, -42, 113,
+        -69, 19, 118, 91, 36, 46, -48, 26, 73, 47, -80, -108, 57, -13, 114, -3,
+        -76, 37, -20, 60, -26, -38, 17, 101, 56, -34, 60, 40, -75, 26, -57, 117,
+        22, -33, -14, -46, -114, -21, -12, 93, 53, 99, 7, -35, -105, 67, 35, -110,
+        -18, 124, -85, 94, -68, -44, -87, -26, 70, 35, -123, 110, 52, 34, 17, 60,
+        -86, -69, -108, 48, 122, 78, -126, 116, 56, 39, 1, 35, -85, 67, 33, -66,
+        71, -113, -67, 43, 102, -24, -119, 58, -61, 14, -62, 60, -49, -118, -46, 4,
+        -75, 43, 0, -40, 115, 114, -76, -128, -54, -124, -111, 71, -70, 95, -36, 73,
+        110, 67, 43, -54, 72, -100, -7, 59, -95, -52, -33, 82, 82, 81, -122, 86,
+        86, -26, -2, 88, 10, 53, -20, 21, -22, 66, 41, -117, 47, 13, 53, 33,
+        30, -110, -90, -101, 52, 26, -26, -96, 17, -71, -60, -110, 72, -90, -92, 43,
+        -115, 110, 6, -16, -128, -102, -70, 97, -64, -47, 35, 99, 78, 62, -119, 1,
+        -12, -69, 44, 22, 26, -110, -54, 9, -112, -50, -102, 42, -72, 72, -30, -38,
+        -33, -12, -119, 6, 68, -24, -71, 8, 85, -126, -56, -8, 71, 124, 0, 119,
+        -91, 126, -6, 67, 110, 62, 94, 60, 58, -56, -13, 62, -16, -119, -10, -104,
+        85, 116, 102, 113, 62, -93, -105, -68, 9, 112, 2, -31, 113, 97, 61, -54,
+        33, 73, 51, 22, 37, 14, 8, -74, 39, -91, -41, 71, 35, 117, -122, 87,
+        -93, 37, 121, -37, 37, -111, -121, -30, 17, 52, 94, 17, 13, -96, 6, -41,
+        -15, 6, -29, 3, -48, 14, -15, -24, -93, -38, -3, -122, -49, 43, 94, -103,
+        -107, -48, 65, -90, -88, -123, -103, -110, -74, -123, 96, 94, 99, -70, -44, -122,
+        -36, 94, 48, -76, 1, -51, 36, 34, -126, -12, 87, -109, 32, 101, 66, 60,
+        -26, -21, 65, 51, -65, -124, -85, -70, -104, 117, -67, -117, 110, 18, 99, 12,
+        -87, 110, 8, -5, 1, 127, -118, 25, 73, 101, -32, -41, -43, -6, 10, -123,
+        -62, -105, -62, 99, 97, -68, 31, 30, 39, 25, -109, 87, 20, 58, 20, -27,
+        26, 20, 9, 47, 7, -107, -74, -108, 21, -117, -29, 106, -116, 71, 34, 17,
+        -42, 2, -112, -57, -30, 56, -84, -47, 107, 89, 8, 3, -76, 25, 116, -74,
+        -72, 52, 125, 90, 25, -42, -27, 82, -23, 106, -122, 79, 107, -59, -110, 24,
+        -7, -123, 55, 36, -34, -53, -11, 102, -88, 97, 42, -20, -97, -104, -56, 18,
+        27, 100, -93, -9, 110, -124, -65, 53, -68, -22, 33, -39, 2, 75, -123, -21,
+        117, -55, 104, 2, -19, -16, 45, -79, -115, -104, -66, -25, -127, 117, 116, -62,
+        -61, -105, 126, -45, -16, 51, -77, 16, -126, -70, -55, 13, 27, -48, -102, 6,
+        52, -17, 107, 126, 59, -5, 55, -18, -47, 120, -57, 87, 14, -115, -79, -39,
+        -51, -124, -66, -9, -25, -57, -74, -69, -83, 7, 108, -27, -68, -105, -98, 12,
+        -89, 52, 27, 88, -112, -22, -100, -40, -87, -87, -51, -58, 115, 50, 119, 93,
+        -65, -87, 62, 90, 114, 89, -49, 17, 6, 56, -33, 119, -114, 10, 47, -41,
+        -123, 37, -102, 59, -17, -44, -60, -57, 31, 16, -87, 109, 121, -75, -33, 0,
+        50, -83, -42, 41, -51, -73, -89, -89, 95, -117, 12, 115, -78, 19, 51, -75,
+        39, -13, 61, -15, 99, 59, 88, 34, -35, 121, 18, 0, -15, 82, -4, -25,
+        56, 8, -122, 122, -28, -33, -30, 104, -20, -6, -91, -17, -34, -56, 112, -85,
+        98, 16, 49, 36, 94, 121, -52, -31, -98, 71, 112, -70, -95, 73, -73, -30,
+        75, -88, 29, -82, 86, 54, 63, 54, 10, 0, -18, 102, 13, 107, -25, -124,
+        -75, -105, 48, -101, -117, 63, 33, -39, 53, -120, 1, 111, -113, 45, 82, 125,
+        -13, -18, 87, -76, 111, -38, 50, 125, -33, -74, 75, -74, 80, -33, -38, 56,
+        94, 98, 25, -36, -48, -36, 108, 81, -23, 86, 1, 33, -7, -67, -9, 107,
+        -17, -107, 91, -73, 0, -1, 76, 59, -4, 127, -113, -33, 69, 75, -89, -18,
+        -73, -12, -70, 127, 111, -65, 119, -113, 45, 118, -4, -85, -69, -60, 120, 74,
+        -4, 102, -51, 116, -106, 51, 43, -111, -63, 51, -76, 126, -12, -121, -24, -128,
+        -91, -79, -40, -106, 21, 91, 52, 23, -109, -78, 83, 42, 60, 99, -86, -39,
+        123, 61, 78, -64, 37, -120, 18, -115, 125, 26, 66, 58, 88, 16, 57, -31,
+        34, -17, -75, -89, -110, -40, 85, 86, -63, 53, 80, -96, 120, 31, -100, 58,
+        25, -6, -123, -63, -105, 16, -32, 2, -1, 115, 124, 0, -56, 20, 120, 78,
+        31, -40, 93, -56, -104, -21, -38, -100, -58, 101, -113, -59, 81, -44, -21, -6,
+        113, -125, -72, 29, 3, -2, -80, 87, 35, 24, 120, 33, -68, -77, 21, 23,
+        -85, -2, -24, 18, 110, 98, -27, 86, -26, 101, 124, 23, -49, 35, -63, -15,
+        122, -20, 122, 77, -103, -62, 82, 77, 19, -105, -3, -6, 6, 92, -45, -113,
+        -108, -7, -78, 8, -52, 116, 104, 101, 119, -3, -72, -119, -63, -89, -121, -29,
+        -56, 12, -7, -45, -73, 55, 4, -21, -105, -12, -20, 89, -67, -47, -13, -109,
+        -40, -50, 37, 39, 65, 108, 125, 69, 104, 88, 96, -21, -35, -97, 34, -41,
+        -74, -25, -18, 79, -67, 68, -113, 41, -92, 117, -89, -98, -87, -106, -33, -47,
+        -3, -110, 97, -46, 39, -67, -12, -31, -83, -69, 110, 48, -21, 51, -88, -6,
+        -3, 126, -17, 74, 34, 99, 30, 122, -5, -75, -106, 18, 106, -2, -27, 30,
+        105, -85, -35, 117, 39, 97, -80, -90, 24, 37, 37, 127, -2, -85, 112, -10,
+        -119, 57, -66, -78, -103, 109, 87, 61, -112, -17, -75, -35, -18, -21, 2, -80,
+        125, -123, 119, -102, -83, -87, -59, -96, -108, -42, 40, 39, -33, 21, -5, -7,
+        -57, -78, 61, -70, -30, 22, 114, -31, -124, -126, -65, -10, -89, -122, -50, 26,
+        -85, -42, -71, -105, 55, -97, -61, 92, 26, 1, -46, -54, 110, 29, 36, -107,
+        96, -21, -71, -62, -16, -45, 31, 92, 110, 64, -127, 95, -49, 96, -12, -116,
+        77, -86, 6, -53, 97, -12, 60, -29, -98, -20, -71, 0, -40, 54, -20, -124,
+        -55, 21, -101, 43, -44, 28, -128, -119, 35, 82, -22, 5, -35, 78, -102, -11,
+        -119, -67, -117, -14, 62, -13, 80, -42, 85, 12, 20, -84, 56, -29, -104, 24,
+        -15, -25, 60, -52, -118, -126, 34, 120, -6, -87, -15, -26, -53, 13, -20, -13,
+        -3, 91, 52, 113, 80, -30, -115, 32, -51, 26, -90, -40, -68, -119, -21, 50,
+        -105, -23, 38, 89, 63, 103, 81, -68, -7, -94, -10, 11, -78, -35, 30, 10,
+        -65, 114, -46, 40, 101, 6, 61, -84, 0, 120, 35, -4, -6, -11, -125, -26,
+        -47, -15, -61, 31, 127, -5, -11, -125, -41, -67, -127, 25, 45, 26, -93, -20,
+        -22, 91, 78, -38, -61, -31, 114, 25, -91, -13, 83, -44, 84, -122, 43, 9,
+        -57, -122, -20, -72, -98, -70, -48, 3, 109, 89, 68, 66, -1, 62, -31, 115,
+        -91, -10, 83, 107, -19, -89, 122, -19, -89, -68, -74, -112, 15, 77, 4, -25,
+        13, 85, 10, 27, -80, 81, 49, 64, 26, -17, 69, -40, 45, 22, 113, -99,
+        -99, -95, -56, 66, 62, -80, -105, -116, 10, -71, -96, 63, -16, -55, 72, 84,
+        33, 113, 26, 49, -118, 24, 92, 43, 62, -84, 96, -14, -36, -11, 14, -88,
+        -96, -114, -51, 41, 84, 36, 48, -62, -13, 16, 29, 114, -40, -26, 33, -34,
+        127, 31, -25, -4, 106, -94, 11, -49, 52, -39, 116, 74, -78, -43, 93, -19,
+        -128, -59, -107, -110, 123, -103, 87, -44, 91, -3, -69, 21, -72, -87, 65, -21,
+        118, -1, 65, 122, -96, 8, -63, 80, 98, -24, -93, -24, 107, -15, -71, -97,
+        102, 43, -57, -126, 2, -91, -74, -93, 107, -107, -75, -46, -122, -41, 78, 18,
+        -16, -30, 112, -110, 30, -25, 2, 3, -89, 2, 3, 39, 65, 126, -111, -38,
+        -59, -80, 11, 91, 86, -52, 80, -121, 114, 36, -116, 38, -25, 20, -25, -94,
+        -58, -27, -62, -94, -107, -53, -123, 2, -102, -111, -126, -31, 4, 37, -64, -8,
+        -78, 108, 0, 124, -31, -27, -28, 26, -118, -119, 124, 44, 67, 35, -80, -97,
+        91, 115, 8, -14, -9, 66, -11, -84, 74, -97, -60, -115, -112, 53, -13, -26,
+        24, -108, -128, 57, -77, 30, 100, -55, 92, -115, -106, -58, -86, 32, 75, -97,
+        73, 43, 1, 69, -36, -80, -105, 112, -101, -110, 27, -122, 72, 87, 89, -67,
+        70, -27, 61, -62, -123, -66, -111, 78, 62, -120, 49, 25, -73, -84, 59, 100,
+        24, -26, 102, 47, 98, 119, -59, 5, -83, -60, -11, 118, 72, -64, -67, -102,
+        40, 67, -41, -110, 65, -110, 1, 10, -7, 101, 47, -34, 15, 10, 34, -112,
+        -42, -80, -86, -48, -110, -93, -128, 86, 45, -86, -66, -32, -11, 15, -38, 77,
+        4, -114, 117, -30, -109, 85, -75, 91, -51, -63, 105, -23, 17, -95, -47, 93,
+        -45, -73, 121, -31, -7, 90, 76, 16, -63, 89, -113, -114, -123, -29, -78, 73,
+        36, -50, 122, 108, -84, 5, 62, 27, -76, 90, 14, -51, -69, 97, 12, -116,
+        79, 124, 2, -100, 24, -43, -82, -84, 82, -20, -6, -10, 12, 20, 7, 74,
+        -14, -3, -6, -111, -28, -5, 68, 63, 26, -109, 42, 45, 31, 23, 127, 68,
+        57, 48, -96, 97, 66, -54, -51, -47, 92, 120, -25, 13, 14, 26, 100, 107,
+        76, 98, -5, 87, 118, 87, -59, -74, 59, 55, -82, 115, 59, 32, 106, 82,
+        119, -65, 103, -9, -123, -35, -121, 43, 46, -127, -3, -84, -37, 72, 111, 30,
+        34, -38, -40, -111, -56, 117, 75, -102, -118, -81, -127, -74, -6, -104, 71, 81,
+        11, 93, 69, 122, 77, 24, 100, -53, 21, 49, 23, -52, 94, 110, -53, 98,
+        -14, -79, -8, -35, -38, -107, -107, 106, 122, -24, -43, -72, -41, 118, 38, 94,
+        23, 5, -14, 0, -43, -82, -72, 83, -124, -117, 15, -100, 10, -118, 68, 98,
+        -70, 78, -54, -87, 127, 118, 93, -31, -89, 66, 75, -27, 104, -68, -110, -116,
+        81, -113, 110, 42, -55, 34, -4, -47, -70, -110, 35, -62, 32, -31, -100, 50,
+        -127, -58, -103, -57, -115, 65, -55, 53, -117, -13, 32, -20, 119, 99, 105, -96,
+        23, -5, -119, -9, -89, -65, 16, -42, -72, 7, 35, 47, -14, 35, -44, -41,
+        106, -12, 111, -103, 88, -14, 75, 94, 40, 23, -80, 31, -77, 94, 102, 123,
+        53, 63, 26, -9, 110, 96, -97, -26, -107, 92, -63, -67, -9, -41, -88, -101,
+        -72, -1, 34, -21, -35, -96, -78, 91, 120, -110, -42, 60, -37, -61, 8, -6,
+        -75, 35, 64, -99, -45, -5, -3, 26, 5, -53, 32, 53, 16, 91, -108, -4,
+        29, -104, -77, -6, 80, -58, 90, 113, 65, -63, 45, -103, -89, 94, -89, 102,
+        -96, 83, -21, 16, 125, 82, -8, 41, 55, 118, 14, -115, -95, -36, -61, 41,
+        74, 109, -119, -91, -101, -38, -41, -44, 71, -44, -60, -19, -47, -47, -22, 115,
+        -21, 23, 101, -19, 96, -58, 25, -19, 59, 113, 30, -71, 107, 25, 68, 116,
+        -50, -16, -44, -27, 116, -22, 50, 58, 117, -30, 124, 9, 51, 78, -7, 110,
+        31, -74, 60, 108, -14, 69, -99, -121, 23, -41, 110, 101, -108, 53, 22, 54,
+        82, 8, -43, 77, 102, 123, 75, 110, 121, -55, -71, 126, 57, -40, -53, -34,
+        -95, 71, 67, -26, 74, 113, 95, -77, -14, 33, -33, -117, -86, 69, 53, -22,
+        -60, -2, -77, -90, -83, -2, -56, 75, 20, -61, 44, -126, 120, 110, -128, -12,
+        73, -25, 47, -46, 89, 84, -96, -12, -128, 119, -30, 117, 109, -126, -110, 27,
+        -78, 97, -106, 3, -70, -39, -61, 32, 19, 29, -118, 49, 93, -110, -74, -8,
+        -93, -48, -16, 71, 4, -8, 35, -106, -8, 35, 33, 19, -60, -33, -46, 55,
+        98, -4, -64, 126, -107, 15, 25, 55, -5, -115, -4, 112, 103, 6, 25, 15,
+        -7, -107, -108, 112, -70, 9, 78, -42, -20, -109, 19, -110, 27, -11, 61, 24,
+        41, -38, -113, -111, -48, -73, -48, 2, 32, 117, -42, 75, 109, 90, 58, -93,
+        -63, -77, 39, -119, -11, -16, -64, 118, -76, 64, 20, -21, 32, 105, -59, -26,
+        101, 80, 78, 41, 12, 89, -121, -78, -58, 51, -66, -101, 19, -123, 8, -29,
+        69, 115, -49, 6, 45, 16, 88, 124, 14, 12, 57, -110, -23, -14, -108, -25,
+        112, -54, -77, -14, 41, -121, -5, -4, 107, -114, -72, -16, -89, 110, 92, -90,
+        89, 89, -13, 44, 9, 80, 74, -113, -62, -9, -95, 118, -75, -87, 46, -49,
+        -50, -99, 7, -40, 117, 15, 26, 69, 95, 19, -109, 40, -104, 115, -5, -15,
+        27, -8, 5, 52, 7, 95, -17, 53, 124, -3, 57, -55, -9, 108, -8, 94,
+        71, -56, -21, 122, 71, -53, 24, -82, 71, 127, -89, -105, -66, -37, -65, 124,
+        57, -56, -19, -16, -118, 65, -57, -26, 3, 52, 70, -97, 3, -86, -117, -125,
+        -110, -79, -122, 84, 86, -47, 2, -103, -94, 1, -121, 37, 25, -19, -99, -84,
+        25, -80, -128, 11, -35, -31, -71, 33, 83, -85, 25, 22, -22, 102, 29, 5,
+        112, 13, 50, -103, -3, -52, -91, 120, 83, -102, -83, -60, -35, -115, 82, -9,
+        -78, -23, -104, 113, 39, -24, 77, -24, 107, 63, -6, -16, -82, 3, 125, -83,
+        -55, 85, -12, 50, 97, 106, -96, 106, 17, -104, 10, -26, -14, -14, -16, -80,
+        -110, 52, -56, 35, -14, -54, 52, -9, 75, 89, 67, -107, -123, 40, 121, 97,
+        39, 41, 78, 114, -101, -34, -2, -63, -11, 116, -47, 15, -20, -41, -21, -126,
+        78, -41, 2, -7, -81, 86, 116, -64, 70, -128, -5, -98, -29, 61, -125, 114,
+        -22, -107, 98, 67, 39, -103, 43, 22, -53, -127, -48, -117, 19, -1, -83, -83,
+        -37, -93, 76, 18, 73, -19, -84, 22, 36, 74, 48, 4, -80, 125, 10, -125,
+        93, -99, 12, -89, -5, -55, -86, -92, 23, -29, 19, 126, -117, -126, 48, -124,
+        -125, -52, 16, 37, -64, -52, 14, 106, 71, -11, -8, -45, -120, -64, 124, -51,
+        52, 36, -83, -69, -24, -86, 77, 60, -72, -2, -102, 14, 96, -87, 102, 112,
+        33, -36, -12, -57, 79, 42, -82, 52, 80, -75, 103, 125, 121, 60, -100, -34,
+        0, -11, -124, 52, -58, -84, -105, -37, -80, 117, 29, 21, -21, -91, -70, 110,
+        -28, -62, 86, -103, 41, 31, -53, -126, -88, 48, 57, 43, 41, 76, -106, 16,
+        104, -77, 70, 59, -117, -114, 65, -24, 27, 17, -73, -90, -105, 71, 114, -40,
+        18, -2, 30, -106, 16, -10, 16, 24, -113, -72, 66, -87, -31, -87, -69, -87,
+        121, -32, 12, 115, -7, 26, 122, -45, -2, -31, -12, -90, -51, 115, 105, 109,
+        49, -7, 114, -51, -97, 85, -7, -27, 43, 6, -18, 45, -21, -67, 19, 2,
+        -106, 10, 121, -16, -112, -38, 34, -101, 96, -55, -75, -28, 39, 115, -11, -109,
+        121, -86, 88, 114, 52, 125, -89, -80, -27, -70, -114, 36, -67, 109, 40, -61,
+        -119, -47, -55, 76, 39, 70, -41, -11, -17, -39, 19, -26, 15, -95, -69, -54,
+        -42, -77, 5, -98, 66, -58, -52, -109, -11, 40, -118, -18, 32, -107, 57, -67,
+        -30, 28, 7, 62, -92, -78, 95, -109, -68, 126, 24, 127, -14, -111, -90, 122,
+        -111, 54, -28, -23, -124, -59, 118, 88, 91, -18, 5, -74, 59, 125, 50, 89,
+        -8, -44, 88, 98, 12, 116, 106, 81, -9, -74, -35, 106, 68, 86, 50, -106,
+        -58, -10, -62, -26, -65, -89, -80, -67, -66, -33, -11, -81, -114, -58, 126, 84,
+        47, 92, -103, -34, -11, -80, -60, 29, -100, 114, -5, 99, 55, 102, -17, -68,
+        15, 65, -43, 75, -16, -83, -83, 14, 127, -123, -34, 0, -109, 91, -121, 55,
+        118, -109, -42, 124, 124, -88, -47, -31, 41, 121, -24, -38, -114, -4, -5, -87,
+        92, -67, 123, 92, 19, -10, 6, -77, 29, -5, -97, 84, -58, 39, -107, 33,
+        40, -9, -84, 74, -71, 23, -75, -108, 123, -68, 115, -67, -94, -15, -75, -66,
+        -88, 125, -1, 119, -110, 96, -37, -65, 38, -84, -40, 27, -95, -67, -63, 7,
+        64, -12, 62, -92, -66, 112, 80, 124, 18, -53, -53, -13, -102, 88, -35, 90,
+        33, -63, -24, -71, -21, 55, -12, 2, 13, -34, -71, -57, -103, 12, 23, 70,
+        87, -21, -37, 56, -123, -7, -13, 40, 94, -12, -26, 127, 103, -105, 16, -72,
+        -107, 113, -35, 106, -92, 117, -126, 33, -68, 61, 73, -80, -6, 115, 79, -100,
+        86, 127, 38, -74, 66, 19, 5, 110, -66, -27, 37, -65, -26, 109, -2, 44,
+        108, 48, 115, -86, -122, -92, 83, 120, 63, 14, -70, 44, -88, 50, 57, 57,
+        54, -115, -53, -106, -4, -86, -97, 68, -54, 108, 45, -120, -89, 43, -101, -122,
+        -27, -56, -41, -62, -42, -111, -122, 8, -89, 51, 75, 109, -122, 66, 119, -124,
+        -29, -46, -34, 83, 97, 26, 55, -43, -47, -6, 70, 51, -109, -22, -44, -92,
+        -9, -7, -64, -3, 71, 87, 4, 64, -22, 18, 63, 83, 21, -27, 76, -94,
+        90, -25, 72, -100, 110, 91, 61, -110, 66, -37, 24, 22, 95, 20, -85, 72,
+        55, 96, -85, 121, 67, 70, 103, 21, 119, 20, -76, -56, -76, 118, 51, -81,
+        14, -68, -107, -69, 94, -40, -21, -22, 83, 93, 45, -96, -123, 126, -73, 87,
+        121, 118, -89, 12, 60, -87, -6, 27, -78, -39, 65, -71, 67, -60, 48, -113,
+        26, 33, -39, -9, -43, 63, 115, -101, -37, 0, 101, -19, 13, 48, 2, -24,
+        26, -50, -18, 47, -31, 109, -100, 108, -53, -112, -71, 50, -116, -1, 84, 57,
+        77, -41, -128, 9, -75, 85, 86, 115, 55, -8, -88, -79, -65, 19, 44, 85,
+        -34, -111, -6, -75, -60, 46, 92, 77, -104, -115, -25, -12, -68, -7, -100, -106,
+        31, 81, -54, 103, 85, 57, 53, -110, -127, -28, 76, -2, 40, 86, -90, 121,
+        -38, 90, -56, 60, -51, 108, 88, 20, 3, -128, -33, -14, -61, 125, 22, -124,
+        -91, -61, -51, -18, -76, -111, -49, 46, 121, -45, 53, -46, -74, -26, -92, -23,
+        -23, 74, 94, 30, 123, -31, -76, 91, 91, -116, -57, 44, -83, 47, 64, -127,
+        19, -15, -111, -54, 12, 74, 29, -34, 70, 20, -2, 79, 120, -63, 49, -99,
+        110, 70, -24, -7, 41, -78, 37, -122, -36, 103, 126, -47, 43, 47, 96, 120,
+        73, 23, 31, -116, -75, 105, 56, 11, -78, -52, -20, -118, -80, 87, -20, -47,
+        -48, -118, 78, -66, 18, 105, 60, 114, 113, 93, -122, 87, -74, -113, -63, 43,
+        -37, -67, 120, -91, 120, 28, 94, -55, 75, 103, 97, 107, -32, 21, 17, -90,
+        -64, 76, 39, -4, 114, 113, 89, 30, 15, 38, 3, -68, 62, 106, 14, -68,
+        78, 3, -14, -39, 90, -111, -49, -74, -2, 52, 91, -102, -121, 13, -9, 88,
+        0, 29, 19, 112, -60, -69, 35, -58, -46, -119, -99, 80, -99, 122, 52, 42,
+        -107, 92, 50, 35, -31, 31, 119, 63, 71, 22, 31, 14, -20, -55, -86, 108,
+        -105, -82, -24, -28, 85, -77, -73, 0, 34, -12, 87, -11, -106, 25, -31, -93,
+        -31, 85, 113, 96, -102, -78, 77, -88, -5, 48, -88, -110, 23, -27, 81, -119,
+        120, 97, 26, 23, 20, 54, 112, 65, -106, -7, 23, 50, -60, -74, -26, 106,
+        -95, 109, -57, -6, 1, -26, -34, 47, -60, 91, 114, -75, 39, 11, -102, 60,
+        2, 26, -17, 27, -70, -49, -66, -75, -5, 76, -11, -2, -24, 69, 79, -65,
+        -49, -122, -89, -30, 41, 84, -37, -62, -12, 113, 91, -104, -80, 89, 88, 114,
+        70, -69, 85, -125, -47, -120, -91, -62, 80, -6, -103, -120, 49, 72, 85, 57,
+        31, 109, -25, -30, 18, -30, 99, 15, -85, 94, -75, 112, -7, 73, 90, 57,
+        -53, 120, -52, 105, -98, 24, 14, 45, 30, 127, 41, -88, -70, 12, 115, -107,
+        93, 5, 124, 75, -117, -22, 78, -85, -93, 87, 16, 3, -74, -120, 106, 43,
+        -11, -63, -124, -80, -87, 104, 116, -95, 76, -17, -127, 58, -94, -59, 84, 113,
+        36, -38, 105, -19, -89, -127, 19, -79, -80, -90, -18, -109, 120, -64, 24, 60,
+        104, -124, -116, 70, -11, 0, -52, 47, -14, 28, 21, -43, 11, 35, 76, 51,
+        75, -12, 116, 35, 79, -107, -36, 115, -110, 126, -22, 78, 66, -85, -16, 83,
+        115, -104, 34, -5, -9, -62, -22, -91, -79, -70, -44, 125, -99, 58, 11, 44,
+        100, 109, 79, -9, -50, -78, -46, -107, 71, -82, -38, 115, -116, 51, -91, 34,
+        82, -85, 71, -62, 20, 105, 43, -34, -105, 107, 3, -67, 96, -70, -87, 35,
+        -55, 36, 17, -108, 127, 99, -53, 47, -21, -108, 107, 37, -40, -45, 21, 101,
+        44, -115, 12, -7, -58, 73, 121, -41, 70, 94, -72, -119, 36, 93, -125, -71,
+        27, 35, -73, 36, -87, 8, -12, 89, -86, 102, 85, 89, -35, 37, -81, 89,
+        120, 67, -7, 94, 69, -53, -45, 44, 69, 57, 3, -26, -119, 112, -50, 10,
+        27, 28, 29, 9, 82, 40, 89, -13, 21, -94, 18, 9, 121, 125, 32, -39,
+        73, -93, -78, -114, -47, 39, -105, -75, 80, 26, 106, -73, -111, 77, -22, -57,
+        -8, 54, 10, -48, -115, -37, 32, -51, -18, 29, -41, -82, -111, 35, -97, -28,
+        -102, 98, 122, 97, 76, -17, -128, 47, -87, 85, 119, 107, -70, 106, -95, -46,
+        85, -13, 52, 65, -110, 37, 51, 50, 88, -109, 71, -84, -57, 6, 8, 43,
+        -79, -37, 58, -110, 52, 59, 69, 52, -14, -99, 123, -61, -21, -73, -124, 50,
+        91, 58, -101, -103, 24, -47, -21, -125, -107, -128, 13, -117, -20, 33, -88, 113,
+        21, 20, 9, -47, 68, 100, -119, 87, -94, 3, 32, 71, -84, -127, -23, -3,
+        -92, 18, -1, 51, 22, 107, 113, 112, -32, -84, -24, 36, 0, 16, -74, -21,
+        -115, 124, -51, -78, -93, 106, -113, -27, 117, 113, -23, -39, -22, 33, -36, 89,
+        -113, -27, -63, 72, 56, -23, 108, -28, 1, -104, 27, -120, 122, -110, 95, -62,
+        -96, 87, -15, -75, 41, -52, 8, 72, -25, -51, 104, -96, -74, 40, 90, -1,
+        52, -12, -59, -8, 35, 105, -4, -90, 31, 95, -58, 34, -71, 94, 100, -45,
+        30, -46, -103, -114, -40, -75, -82, -109, -5, 80, -58, -125, -125, -78, -40, -49,
+        -87, -30, -54, 65, -7, 10, -73, -107, -87, 50, 40, -74, 82, 101, -78, -57,
+        17, -82, -117, 16, 29, -1, -95, -116, 122, 56, 88, 87, 77, -60, -40, 93,
+        126, 86, -51, 112, 72, -39, -28, 32, -86, 9, -110, 110, 71, -26, -70, 42,
+        35, 57, 18, -77, 89, -93, 84, -15, -89, 14, 110, -6, -115, 113, 0, -76,
+        -30, 80, 111, 71, 87, -31, 101, 110, -64, -86, -102, -34, -92, 123, 81, -112,
+        80, 72, -40, 116, 49, -75, -116, -118, -79, 20, -65, -84, 106, -125, -29, 106,
+        -47, 73, -19, 6, -42, 124, -5, 107, -34, 15, -76, 90, -102, -14, 87, 100,
+        11, 78, 111, 111, -122, -47, -53, -111, -123, -87, -88, 111, -60, -30, -37, 94,
+        -89, 0, -40, 41, 110, -26, -33, 43, -27, -9, 31, 100, -31, -32, -34, 82,
+        -73, 42, 51, 52, -10, -65, 34, 41, -116, 106, 37, -123, 77, 109, 51, 65,
+        -95, -67, 101, 18, 15, -58, -58, 113, -82, 52, -59, -91, 69, 69, -35, 78,
+        79, 28, -107, -79, -39, 10, 36, 105, 61, 28, -82, -107, 68, 32, -81, 20,
+        54, 32, -97, -114, -4, 58, -24, -30, 100, 69, 116, 3, -29, -26, -92, -35,
+        87, 88, 114, -80, -6, 66, -80, -62, 121, 1, 122, -113, -30, 14, -120, 9,
+        6, -112, 26, 34, 40, 32, -73, 8, 12, -49, -52, -25, 31, -2, -8, -37,
+        43, 50, -4, 114, 52, 85, -9, 114, -123, -3, -58, 41, 122, -28, 22, -72,
+        113, -118, 64, -59, -26, 84, 24, 48, 87, -60, -76, 52, -92, 107, -66, 100,
+        -78, 22, -128, 105, -6, -124, -10, 50, 14, 23, -28, -23, -67, 26, -24, -60,
+        -120, 58, -74, -22, -25, 126, -34, 27, 1, 126, 40, 111, -91, 74, -31, -73,
+        -17, 111, -36, 33, 67, -39, 21, 123, 109, 65, -73, -95, 17, -23, -118, 45,
+        39, -51, -119, -57, -50, 82, 114, -116, -36, -70, -69, 110, 13, -47, -99, 61,
+        20, 74, 91, 52, 47, -75, -7, -45, -102, 96, 7, 113, 53, -40, 29, 44,
+        -75, 126, -30, 82, 97, 57, -40, -68, -91, 73, 27, 92, -61, 32, 57, -87,
+        -94, -106, -88, 1, -81, -60, -75, 120, 37, 41, -29, -111, -88, 14, -119, 92,
+        116, -73, 93, -81, 75, -63, 18, -32, -17, -25, -18, -91, 61, -44, 47, 3,
+        -4, -26, -119, -74, 65, -86, -70, 87, 43, 21, 51, -75, -103, -4, -30, -69,
+        26, -73, 92, 71, -77, 15, -18, -105, 31, -81, 68, -109, -8, -31, 68, -59,
+        -98, 78, -61, -81, -22, -108, -69, -20, 47, 119, 26, -30, 14, 27, 114, 95,
+        34, 102, 77, -88, 74, -54, -49, 102, 25, 114, -15, 20, 104, 57, 115, 119,
+        94, 22, 12, 39, -39, -15, 106, -110, -11, 122, 110, 14, 41, 50, -120, -77,
+        -60, 101, 58, -114, 107, 33, 50, -86, -46, 51, 2, -75, -107, -112, 89, 24,
+        28, -112, 76, -83, -53, 124, -14, -106, 29, 95, 69, -90, -29, -85, -88, 76,
+        55, -95, 86, 57, -77, -23, 101, 97, 6, -103, -11, 47, -1, 45, 92, 36,
+        -15, 79, 110, -83, -55, -65, -92, -55, 99, -28, -107, -97, 62, -34, -61, 118,
+        -28, 100, -80, 42, 116, -116, 52, 41, 14, -122, 69, -32, 68, 24, -31, 18,
+        -110, -24, 48, 109, 58, -101, 112, -121, 35, 23, 47, 65, 124, -66, -64, 127,
+        102, -63, 3, -39, 79, -95, -33, 33, 63, -9, -104, 2, -113, -97, 121, 124,
+        -29, 95, 97, 4, 50, -2, -5, -36, 79, -60, -49, 51, 127, 33, -29, -107,
+        -23, 87, 19, 5, -12, 91, 89, 40, 110, -68, 71, -89, -23, -41, 91, -88,
+        11, -121, 25, 73, -106, 18, -107, 72, -119, -63, 95, 86, -7, 58, -86, 113,
+        28, -25, -121, -33, -46, 95, -57, 38, -99, -11, 58, 123, 10, -106, 21, -78,
+        -10, 86, -48, -43, -78, -10, 22, 46, 41, 103, -7, -35, 5, -100, 102, -18,
+        -64, 63, 50, -3, -7, 71, -28, -97, -30, -5, -52, -98, -9, -78, 119, 120,
+        -94, 123, 56, -19, 41, 42, -90, 115, 106, 72, -70, -30, -102, -61, -87, -98,
+        31, -117, -12, -55, 28, 14, 119, -62, -50, 124, 122, 49, -73, -103, 91, -94,
+        -43, 118, 109, -2, -122, -101, 17, -84, 42, -12, -99, -32, 114, 74, 4, 91,
+        -115, 61, 125, 109, -23, 80, -48, -125, 54, -43, 70, 43, -83, -24, 10, -14,
+        -21, 61, -22, -8, 18, 114, 66, -100, 26, -91, -24, -98, 12, -81, -42, 25,
+        119, 38, -120, 66, 90, -20, -41, -82, -117, 92, -16, -58, 75, 35, -110, -83,
+        -93, 34, 54, -103, -9, 51, -12, -89, -70, -48, -102, 63, 88, 89, -91, 3,
+        18, 98, 56, -42, -47, -30, -53, 70, -62, 22, -30, 91, -100, 72, 52, 45,
+        -64, 13, 76, 31, 89, 83, -21, -36, -124, 7, -77, -81, 32, -109, 1, -61,
+        -38, -96, -111, -95, 1, 19, 104, -15, -36, -44, -105, -123, -15, -81, -75, -80,
+        6, 77, 115, 89, 99, -60, -57, 38, -24, 56, -80, -78, 18, 45, 118, 112,
+        103, 8, -65, 126, -47, -124, -90, -120, -64, 91, -66, -114, -108, 46, 53, -2,
+        -24, 105, 21, -10, -109, -125, 64, -90, -106, 48, 36, 55, 102, 92, -113, 104,
+        52, -108, -2, 38, 13, 49, 45, -9, -21, 43, -75, 93, 45, -103, -25, -62,
+        84, -55, -52, 20, -22, 79, -80, 100, 111, -77, -5, 40, 63, -123, -35, 117,
+        -28, -43, -98, -86, 0, -91, 76, 123, 1, 3, -17, -112, 79, -127, -68, -73,
+        -46, -11, -19, -103, 31, -37, -80, 71, -54, -107, -86, 18, 87, 94, -30, -75,
+        -78, 32, 51, 107, 113, -19, -87, -126, -4, -25, 70, -70, -22, 112, -50, -76,
+        -124, 35, 77, 75, 56, 99, 73, -62, -54, -61, 19, 90, -19, -95, 39, 45,
+        -66, 52, 3, -81, -122, -3, -36, 39, -76, -4, -38, -109, 38, -35, 90, -18,
+        3, 120, -5, -59, -43, 124, 75, -43, 95, 73, -91, -5, -89, -15, -76, 27,
+        126, 79, -19, 101, -20, 118, -83, -30, -74, -112, 94, 17, 100, 118, 40, 94,
+        -76, 31, -56, -122, -62, 95, 93, -124, -105, 26, -103, 18, 13, -28, 111, 69,
+        -80, -56, -60, 115, 69, -71, -56, -76, 51, 65, -19, 68, 92, 111, -39, 83,
+        -108, 80, 52, -112, -65, 37, -95, 19, 41, 42, -25, -126, 89, 86, -111, -70,
+        -80, -78, -78, -14, 52, 37, 98, -98, -102, -83, 87, 34, 25, -120, -35, 110,
+        57, -112, -83, 50, -28, -59, -39, -32, 98, 26, 107, -28, -96, 0, 36, -29,
+        -4, 37, -67, 81, 12, -82, 0, -28, -47, 42, -55, -11, 30, -72, 101, 14,
+        -38, -107, 46, -127, 126, -113, -17, -32, -25, 112, 71, 90, 52, 30, -13, -106,
+        -77, -46, -67, -27, -124, 78, -95, -74, -60, 104, 116, -97, 55, 1, -40, 5,
+        -11, 44, -46, -81, 62, -102, 76, -62, -109, 96, 52, 28, 78, 53, 58, -108,
+        121, -65, -59, 118, 124, 103, -106, 68, 33, -107, -53, -8, -37, -107, 94, -122,
+        -89, -117, -73, -89, 74, 70, 0, 24, 69, -44, 117, 52, -68, 23, 87, 58,
+        -38, -95, -110, -14, -80, 31, -70, -70, -74, 72, -21, 57, 78, 26, -33, -126,
+        56, 35, -91, -124, 32, -9, -109, -110, 111, 18, -30, -13, -56, 44, 86, -122,
+        -121, 2, -100, -53, 21, -98, -39, -3, 11, -28, -73, 87, -44, -48, -58, -6,
+        107, -23, 25, 92, -57, -3, -47, -47, 16, 117, -124, -75, 7, 87, 76, -122,
+        -44, 47, 95, 40, 26, -109, 69, -110, -120, 6, 23, -62, 63, -46, 52, -76,
+        -16, -72, -14, 4, -59, -26, 21, 17, -94, 20, 71, -100, 42, 110, -18, -90,
+        14, 86, -95, -114, -45, -54, 114, -100, 86, -107, -29, -76, -86, 30, -89, -107,
+        -27, 56, -123, 26, 2, -108, -70, 79, -30, -128, -23, -103, 124, 73, -30, 82,
+        18, 58, -91, -70, 47, 47, 80, 92, 74, 50, 11, 73, 29, 68, 5, 23,
+        127, -35, -62, 45, -123, -36, -83, -13, 64, 27, 121, -70, -38, 16, -94, -89,
+        -65, -43, -86, 100, 94, -105, 51, 59, 110, 56, 104, 126, 25, 106, 109, -51,
+        -55, 88, 59, 43, -11, 105, 111, 120, -59, 26, -74, 2, -80, 108, -71, -55,
+        96, 95, -12, 73, -74, 42, 50, 126, -115, -80, 87, 25, 68, -28, 84, -26,
+        -34, -32, 35, 37, -99, 64, 70, -18, -28, -128, 39, -42, -107, -74, 3, -72,
+        7, -121, 112, 15, 14, -27, 61, -104, 53, -121, -62, 80, -73, 100, -74, 39,
+        84, -62, 14, -80, 91, 20, 20, 94, 92, 75, 70, -27, 53, 36, 123, -84,
+        63, -5, -70, -126, -86, 20, 4, 71, -106, -30, -115, 92, 112, 87, -61, -125,
+        5, -12, -107, 96, 127, -104, -54, -27, 120, -52, 39, 106, -28, -14, 16, 119,
+        44, 85, 56, -19, 46, -32, -104, 114, 75, 29, 101, 32, -127, -62, 25, -45,
+        26, 43, 30, -40, 104, 52, 20, -119, 90, 14, -7, 52, -42, 62, -60, 19,
+        34, 90, 108, 22, -76, -13, -95, -89, 45, -71, 111, 108, -64, 14, -35, 16,
+        -90, 89, -6, -30, 107, -85, 107, -76, 74, -91, -119, -81, 50, 84, 45, -10,
+        -39, -7, -92, 37, 115, 26, 102, 123, 60, 13, 109, -26, 52, -95, -8, -27,
+        37, -83, 107, -99, -53, 90, 44, 86, 11, 29, 48, -10, 29, 112, -75, 0,
+        -34, 104, -112, 122, -51, -90, -82, -3, -47, 126, 91, 87, 52, 26, 63, 38,
+        -115, -108, 47, 95, -110, 19, -6, -47, -53, 56, 12, 51, -74, -116, 91, -7,
+        -29, -115, -1, 27, 92, 84, 5, 15, -88, 8, 99, 51, 5, -53, 6, -104,
+        86, 101, -53, 117, -26, 125, 45, 77, -10, 117, 119, 58, -27, 51, 81, 39,
+        -84, 70, 51, 63, 87, -113, 38, 103, -97, -49, -114, -71, 76, -78, -79, 23,
+        115, 45, -43, 12, -115, 117, -93, -39, 95, -86, -41, 23, -110, -81, -63, -10,
+        -26, 86, 15, -41, -7, 62, 13, -114, -42, -20, -72, 110, -78, 104, 96, -113,
+        -6, 118, -56, -65, -111, -94, -20, 36, 12, 34, -85, 92, -123, 76, 72, -83,
+        -40, -41, 19, -2, -52, -9, -68, 76, 106, -42, -118, 117, -127, 75, 121, 73,
+        90, 38, -5, 43, 19, -37, -77, -119, -14, -37, 61, 111, 27, 56, -119, -5,
+        57, 49, -108, 25, 120, 16, 75, 83, 32, -50, -43, 23, -56, 83, -44, -50,
+        -43, 85, 19, 89, 3, 122, -92, -86, -75, -116, 13, 89, -50, 107, 19, -122,
+        -26, -90, 70, 12, -93, -97, 46, -61, 83, -73, 19, 122, -87, -105, 120, -123,
+        18, 121, -24, -78, -115, -36, -10, -128, -83, 75, 59, -14, 58, -57, 114, 92,
+        55, 73, -66, -116, 15, -84, 62, 115, 52, 75, 123, 15, -61, -29, 109, 81,
+        72, 10, 109, -8, -106, 118, -55, 20, 127, 57, -64, 43, 121, 57, -40, 122,
+        51, -99, -7, -116, 24, -89, 57, -45, -104, -49, -104, -123, 93, -94, 89, -19,
+        5, -8, -14, 48, -107, 49, -85, -31, 11, -64, 42, -86, -112, 126, -13, 107,
+        -38, 50, 92, -106, 88, 38, -68, 83, 56, -58, -124, 36, 14, -97, -126, -111,
+        -69, 6, 78, -28, -6, 56, -73, -86, 119, 95, 3, 91, -78, 87, -53, 2,
+        -75, -2, -100, 107, -113, -29, 117, -95, -30, -125, 6, -114, -110, 70, 109, 1,
+        98, -76, -94, -118, 39, 59, 80, 14, 49, 20, 119, 118, -96, 78, 118, 13,
+        22, 84, -50, -40, 108, -9, 113, 123, 87, 74, 122, 8, 33, 77, -73, 51,
+        110, 112, -124, 98, -91, -39, -32, -90, 45, 30, -29, 65, -89, -126, -33, 34,
+        43, 126, -117, -8, -119, -56, -38, -100, -35, -86, 38, 99, 59, -33, 72, -14,
+        50, -53, -71, 99, 22, -23, 38, 105, 39, 30, 29, -117, -118, -69, 31, -26,
+        -80, 17, 93, 19, 11, 103, 67, -122, -82, -87, -80, 110, 76, -123, 3, 99,
+        78, -118, -10, 71, 67, -26, -61, -87, 26, 80, 39, -85, 4, -44, 81, -58,
+        -105, -20, 13, 94, 76, -114, -120, 67, -87, 110, 43, 2, 71, -28, 48, -14,
+        121, -32, 12, 91, -42, 114, 42, -54, 1, 23, -77, 75, -101, -15, -83, -16,
+        -92, -58, -97, 77, 31, 116, -25, -84, -77, 114, 64, -50, -103, 119, 79, 78,
+        63, -84, -115, 43, 117, -39, -7, -82, 122, 12, 34, -37, 49, 16, 96, 97,
+        56, -17, 110, -120, -43, -43, 110, -14, 28, -45, -24, -29, 107, 122, -119, 93,
+        -19, 95, -106, -55, 74, -97, 93, 52, 3, 58, -3, -65, 126, 127, 115, -102,
+        -35, 46, -77, 20, -97, 56, -23, -15, -79, -84, 109, 110, 92, 36, 118, 21,
+        108, 79, -78, -54, -91, -32, 59, 102, -8, -111, 95, 35, -128, -40, -126, 7,
+        -109, 6, -114, -113, 49, 104, -60, -31, 105, -52, 111, -88, 49, -65, -100, 69,
+        22, -106, -14, -98, -96, -126, 35, 79, 80, -74, 104, -3, -101, -63, 5, -11,
+        39, -117, -8, 106, -112, -84, -122, 81, 119, 77, -32, -14, 89, -78, -98, 71,
+        -123, -16, 47, 78, -31, 73, -8, 105, -38, 103, -98, 63, 33, -46, -123, -58,
+        122, 118, 60, 68, -14, -119, -3, 62, 73, -72, 113, -125, 13, 41, -122, -22,
+        6, -106, 102, 11, -107, 75, -5, -44, -104, 5, 44, 113, -22, -63, 109, -94,
+        106, 86, -42, 54, 46, -50, -80, 107, -104, 33, -80, -92, 95, -66, -44, 90,
+        34, 11, -62, -72, 40, 19, 73, -24, -49, -119, -123, -76, -80, -70, -84, 62,
+        104, -65, -112, 4, 66, 19, 77, -27, -58, 97, -54, -91, -34, -62, -53, 60,
+        105, 35, -18, -18, -84, 64, 102, 78, -68, 29, -84, 81, 12, 38, -21, -5,
+        -127, 8, 3, 107, -15, -91, 17, 94, -18, 37, -30, 99, -51, -29, -22, 65,
+        109, 43, -11, 15, 23, 53, -5, 19, -70, -42, -4, 55, 105, -68, -118, -61,
+        -124, 77, 28, 45, 11, -33, 70, -87, -29, 78, 45, -21, 24, 1, 44, -56,
+        123, -127, 75, 84, 26, 74, 120, -88, -53, -38, 6, 112, 66, -23, 127, -12,
+        -65, 3, 58, 114, 99, 86, -38, -77, 78, 68, 56, 19, 74, 50, -36, 72,
+        100, 119, 59, -37, -43, -86, 11, 120, -101, -94, 64, 65, 111, 7, 117, -26,
+        69, -36, -38, 46, -42, 13, -20, 34, -94, 58, 8, 78, -34, 70, 33, 96,
+        -8, 24, 1, -95, -20, -63, -114, -125, 81, -37, -88, -97, 118, 43, -69, -107,
+        -107, 102, 107, -70, 88, -104, -118, -91, 109, -47, -128, -6, -47, 92, 94, 71,
+        -75, 46, -81, 107, 3, -73, 41, 115, -90, -72, -27, 96, 106, -71, -97, 6,
+        -98, 103, -17, -28, 106, 12, -28, 43, -122, 16, -113, 105, -45, 74, -111, 63,
+        8, -21, 89, -45, -106, 66, 40, -112, 124, -33, 72, -84, 2, 126, -71, 117,
+        -89, -39, -127, 14, 125, -91, 44, 124, 6, 105, 23, 30, 52, -6, 31, 76,
+        114, -88, 16, 83, -54, -41, 94, 11, 99, -81, -5, 73, 87, -28, 2, 25,
+        -50, 3, -5, -108, 34, -127, 49, -113, -2, -70, 19, 63, -108, 113, -17, 41,
+        -62, -79, 18, 73, -95, 31, -10, -124, 118, -65, 39, -41, -127, -14, 21, -125,
+        55, 118, 29, -25, 17, -67, 77, 57, -26, -100, 46, 30, -39, -78, -122, 88,
+        24, -62, -76, 44, 11, -123, 61, -12, -124, 54, 41, 49, -6, 11, 15, 29,
+        101, -33, 120, 107, 111, -23, 93, 123, 27, -17, -54, -69, -13, -74, -34, -67,
+        -9, -55, 123, 81, -11, -98, -1, -36, -22, 61, -1, -71, -18, 61, -1, 57,
+        -9, -98, -1, 65, -96, -83, -45, 32, -98, -24, -30, 28, 11, 10, 17, 43,
+        25, -30, -21, 27, 63, 75, 47, -32, -12, -68, 8, 108, -54, 32, 68, 116,
+        -67, 13, -102, 88, -17, -48, -11, -34, 91, -23, -54, 87, -119, -110, 71, 125,
+        104, -49, -116, -68, 9, 90, 21, -10, 62, 114, -1, 122, -41, 121, 118, 91,
+        -27, 71, -36, -55, -57, -1, 23, 71, 68, 98, -120, 119, -128, 33, -34, 29,
+        127, 20, 56, -31, -99, 112, 53, -3, 57, -8, 120, -15, -18, -46, 59, 83,
+        82, -49, -49, 101, 121, 39, 119, -78, -12, -54, -42, -55, -25, -3, -29, 116,
+        -67, -13, -32, -115, -13, -54, -124, -37, 23, -45, 51, 63, 44, -61, 110, 1,
+        -80, -5, -127, 73, 60, 94, -72, -97, -75, -39, 125, -40, 79, 41, 48, 57,
+        -21, -103, 123, 60, -100, -98, -5, -81, 36, -23, -94, -73, -126, 47, 87, 33,
+        -26, 122, -24, 74, -31, -52, -67, -126, -109, -15, 105, 71, 50, -41, 95, -126,
+        -56, -119, 20, 3, -99, 3, -29, 28, 122, 127, 2, -77, -25, 73, 16, 23,
+        -82, 84, -100, 76, 27, 14, -101, 18, 121, 90, 2, 2, 90, -7, -39, -1,
+        -14, 69, -108, 78, -125, 12, -17, 121, 45, 51, 85, -103, 73, -112, 94, 20,
+        70, 102, -94, 50, 23, 65, 50, -40, 94, 12, -115, -20, -59, -108, -3, -12,
+        23, -125, -19, 8, 72, 66, 12, 44, 47, -54, -49, -10, -113, 107, -90, 90,
+        -97, 7, -77, -46, -72, -26, 42, -13, 38, -104, -105, -58, 117, -93, 50, -41,
+        -63, 77, 101, 92, 107, 49, -82, 53, -116, 11, -16, 90, 117, -43, -106, -5,
+        71, -73, 84, 125, 92, 7, -53, -46, -24, -82, 85, -26, 38, -72, 46, -115,
+        110, -93, 50, -81, -126, 77, 101, 116, 87, 98, 116, 87, -125, -19, -104, 86,
+        109, 44, 87, -19, 110, -1, -72, -18, 84, -21, -37, -32, -82, 52, -82, -83,
+        -54, -68, 15, -74, -91, 113, -35, -85, -52, 79, -63, 125, 101, 92, -97, -60,
+        -72, 62, -63, -72, 4, -36, -93, 104, -5, 116, -113, -92, -121, -128, 117, -25,
+        -3, -30, 122, -16, -17, -125, -112, -24, -40, 68, -69, 86, -103, 61, -86, 10,
+        -65, 117, 63, 52, 25, 7, -99, 12, -89, -89, 37, -113, -83, -36, 44, 8,
+        -104, -121, 83, -85, 41, -80, 45, -128, -86, 83, 52, 112, 17, -102, -100, -107,
+        101, 2, 1, -51, -11, 37, -104, -119, -112, 13, 105, 99, 13, -106, -19, -68,
+        -25, -9, 103, -87, -38, -55, -112, -77, 36, -65, 87, 104, -7, -41, -38, 102,
+        -73, -93, -27, 41, 54, -100, 80, -56, 46, 68, 100, -64, 70, 114, -71, 54,
+        -52, -119, 53, 8, 38, 52, 26, 42, 44, -3, 18, -80, -12, -53, -29, -41,
+        2, 75, -65, 4, 44, -3, -69, -30, 27, 94, -31, -82, 58, -81, 47, 94,
+        -30, -11, 78, -53, -70, 31, 80, 30, -108, -68, 15, -32, -91, 89, -97, -18,
+        -12, -111, -61, -10, -34, -42, -43, -111, 119, -81, 87, 104, -31, -64, -18, -66,
+        -54, -119, 24, 108, -123, 22, 67, 96, -107, -83, 66, 101, -115, 47, 84, -68,
+        106, -4, -1, -29, -3, -62, 87, -122, -22, -31, -115, -53, 111, 103, 75, 99,
+        -62, -48, -82, -79, 11, -83, 73, -39, -104, -51, -120, 89, 62, 21, -68, -108,
+        21, -102, 4, -41, 76, -105, 96, 75, 98, -21, -19, -120, -123, 0, 24, -109,
+        -110, 122, 76, -98, -55, 81, 78, -123, -124, 58, 119, 21, -120, -18, -55, -103,
+        50, 12, -5, 68, -17, 26, 12, 123, -95, -97, 126, -51, 15, -15, -100, 125,
+        -111, 20, 23, -99, -14, -29, -57, -103, -40, 42, -12, -59, -113, 9, -25, 50,
+        97, 9, 9, 119, 113, 17, 95, -119, -57, 122, -17, -102, -70, -123, 78, 0,
+        -120, 80, -67, -52, -37, 8, 90, -18, 74, 63, 94, 108, -109, -40, 41, -69,
+        11, 44, -49, -79, -68, 0, -13, 21, -52, -36, 83, 76, 107, 50, 46, -46,
+        75, -65, 38, -53, -37, 6, 81, 79, 115, -44, 49, 127, -78, 116, -67, -5,
+        32, -42, -45, 102, -112, 54, -39, 88, 92, 37, 30, 30, 30, 108, 26, -68,
+        113, 84, -102, 118, -106, -67, -111, 107, 105, -98, -91, -9, -17, 24, -15, -119,
+        -76, 49, 39, 114, 35, -92, 111, -67, -73, 1, 32, -27, -9, 112, 13, 85,
+        32, -58, 123, 19, -24, -13, -126, 63, 2, 88, -75, 50, 31, -9, -105, 97,
+        16, 58, -111, -105, -20, -102, 99, 121, 94, 39, 46, -124, -21, 71, -104, -43,
+        125, -80, -122, 81, -83, -75, 43, -7, -90, 92, -70, -58, 111, 36, 45, -55,
+        13, 76, -21, -122, 77, -12, 93, -16, 94, 42, -90, 126, -106, -65, -49, -127,
+        116, 124, -72, 103, -18, -2, -67, 5, -9, -44, 79, 6, 10, -106, 5, 16,
+        -17, -29, 12, -18, 95, 25, 51, 21, 65, 90, 47, 47, -78, -53, -55, 89,
+        112, -123, -56, 30, -111, 24, 74, 77, 11, 103, 83, -17, -113, 99, 120, -23,
+        -68, 114, 61, 109, -121, -34, -105, 44, -109, 92, -10, -82, 126, -114, 58, 54,
+        -20, 21, 49, 6, 10, -17, 79, 63, -13, -28, 121, -14, 83, 79, -99, 38,
+        31, -120, 48, 84, 88, -48, -96, -34, -65, -10, -82, 102, 27, 127, 11, -1,
+        110, -3, 123, -51, 109, -30, 76, -71, 77, -100, 123, 43, 49, 92, -1, -52,
+        -45, -128, -42, -65, -13, -44, 18, -100, -7, 31, -76, -81, 115, -1, 84, -5,
+        98, -105, -76, -1, 30, -37, 124, 89, 78, 125, -125, -87, 31, 113, -29, 43,
+        89, 31, 61, -40, -117, 51, -1, 29, -2, 57, -9, 63, -17, -124, -70, -17,
+        -37, -64, -36, 104, -51, -73, 36, -69, 19, -61, 100, -74, 70, 39, -66, -120,
+        -47, 85, -85, 2, 27, 56, -25, 66, 78, 40, -54, -99, 82, 120, 101, 123,
+        81, -17, 122, 16, 98, 64, -113, 7, 88, -95, -73, 3, 88, 39, 15, 22,
+        12, 127, 108, 104, -87, 1, -11, -7, 11, -74, -69, 53, -53, -73, 67, 127,
+        -85, -20, 102, -123, 91, -20, 84, -12, 57, 87, -67, 57, 15, -40, -94, -74,
+        -106, -34, -42, -8, 62, -89, 94, -20, 71, 97, 122, 1, 119, -47, -91, 28,
+        2, -13, 112, -103, -23, -69, -89, -113, 74, -33, -55, -22, -2, -64, 72, 55,
+        53, 17, 28, 63, 42, -105, 3, -126, 99, 101, -2, 21, -116, 125, 99, 19,
+        89, -103, -119, 108, 54, -91, -60, 115, 3, 70, 113, 88, 47, -46, -39, 34,
+        -53, -85, 37, 89, -70, 90, 1, 56, 62, 31, -40, -88, -52, -50, -99, 7,
+        -67, 69, 88, 3, -104, -115, 29, 4, 107, -128, 13, -87, -57, 7, 85, -61,
+        -1, -28, -107, 70, -30, -65, -40, -23, 62, 44, -84, -93, -88, -69, 11, 99,
+        -29, -106, 11, -23, -26, 43, 63, 15, -55, 107, -127, -38, -27, -28, 14, -74,
+        -114, 98, -83, -119, -18, 25, -61, -68, -55, 73, -47, -35, -110, -18, -28, 30,
+        39, -88, 11, 78, 80, 107, -116, 106, 92, 102, 82, 67, -10, 8, -120, -66,
+        -53, -107, -116, 101, -17, 1, -39, -93, 1, -58, -26, 87, -48, 117, -97, -45,
+        -92, 51, 99, 33, 82, -13, -70, 79, -120, 86, -64, 75, 31, -113, -41, 76,
+        -65, -29, -25, -58, -11, -113, 55, -66, -124, 101, -70, -18, -11, -45, -77, 52,
+        -66, -49, -23, -82, 47, -125, 2, -34, -9, 3, 11, 62, -126, -21, -97, -46,
+        -83, 64, 2, 36, -64, -86, 116, 109, -81, -16, -66, 56, -125, -53, -108, 126,
+        -100, 79, -26, 1, 5, -8, 12, -81, 10, -121, 75, 113, 62, 5, -35, 59,
+        126, 19, 49, 77, -97, -3, 68, 29, -32, -77, 8, -48, 25, -111, 46, 47,
+        -54, -9, -26, -21, 40, 89, 34, 87, 3, 32, -8, -113, 40, -49, -24, -7,
+        -16, 85, 58, 67, 39, -14, 72, -102, 62, -60, 126, 65, 78, 110, -35, -63,
+        103, -56, 86, 57, -109, 69, -80, -24, -33, 29, -115, 123, 78, 127, -124, 15,
+        109, -45, -12, -55, -52, -25, -47, 51, 63, 4, -95, -59, -31, 64, 104, 81,
+        19, -106, 106, 27, -5, -82, -39, -23, -70, 23, -52, -114, -58, 62, -16, -43,
+        -95, -51, -65, -13, -94, 15, -71, -67, -83, -65, -24, 127, -24, -47, 47, -17,
+        5, 26, -50, -44, 46, -49, 34, -98, 71, 56, 95, -60, -23, 127, 95, 68,
+        41, -17, 14, -128, 127, -35, 15, 102, 79, 94, 0, -32, 126, 114, 31, -42,
+        -63, -70, 119, -61, -107, -21, -114, -58, 56, -35, -2, -104, 110, -55, 83, -37,
+        -91, 92, 92, 2, -38, 60, 30, 2, 105, -109, 76, -118, -5, 120, 53, 91,
+        -108, -26, -10, 59, -113, 111, 0, -67, 64, -103, -2, -68, -25, -100, 78, -57,
+        79, -26, 24, 1, 40, -23, 7, 115, -60, -105, -62, 50, -59, 125, -104, -123,
+        69, -44, -99, 69, -72, -40, 93, 127, 9, 92, -16, -23, -12, 109, 127, 14,
+        83, -69, -9, -33, -10, -32, 111, -1, -34, 23, 41, 106, -120, 34, 83, 31,
+        -11, -3, -124, 68, 56, 19, 106, 80, 56, -42, -107, 13, -78, 26, -94, 49,
+        89, -81, 119, -57, 51, -76, -74, -17, -52, -90, -48, -43, -82, 104, 7, 11,
+        -13, 54, -12, -98, -95, 5, -39, -32, -3, -82, -76, -41, -88, -33, -2, -126,
+        4, -24, 127, -27, -84, 41, -45, 112, -92, 0, -116, 87, 38, 17, -12, -66,
+        -122, -118, 54, -55, -97, -42, 24, 61, 99, 32, 13, -105, -79, -92, 126, 38,
+        81, -128, -93, 127, -81, -115, -66, 127, 37, -88, -73, -34, -24, 39, -104, -54,
+        123, 57, -107, -98, -52, -23, -113, 126, 2, -98, 100, 45, 19, -50, 4, -109,
+        19, 90, -81, 62, 96, -98, -106, -57, -61, -23, 50, 24, -10, -18, -4, -91,
+        -38, -91, -89, 39, -95, 61, 86, -11, 50, -80, 101, 0, 85, 13, 56, 24,
+        105, -83, 5, -47, 90, -119, 65, 58, -83, 13, -46, 105, 89, -66, 120, -50,
+        -56, -118, -42, -68, 63, -127, -30, -77, 94, -108, 126, -9, 54, -98, 3, -121,
+        -42, -35, 85, -79, -72, -99, 28, 106, -13, 38, 55, 96, 119, 86, 76, -88,
+        -4, 79, 66, -27, 10, -119, 103, 38, 18, 79, 9, 125, 111, 9, -103, 43,
+        -116, -67, -48, -111, -7, -52, 64, -33, -13, 18, -6, -66, 41, 33, -39, -75,
+        13, 125, 47, 107, -48, -9, 117, 19, -6, -34, 8, 116, 125, -59, -47, 53,
+        32, -12, -42, -2, 90, 0, 127, 74, -44, -66, -32, -114, -1, -15, 13, 33,
+        -64, -80, -55, -124, 82, -77, 105, -10, 36, 1, -36, -48, 119, 106, 104, -75,
+        -95, 127, -25, -10, 18, 56, -104, 51, 117, 70, -81, -6, 79, 1, -57, 119,
+        1, -36, -14, 85, 87, -68, 40, -104, 104, 42, -68, 4, 76, 5, 104, 10,
+        95, 25, -10, -95, 41, 40, -45, 91, -12, -99, 15, -128, -90, 40, 80, 89,
+        108, 115, 37, -45, 95, 0, 99, 81, -121, -71, -26, -63, -121, -23, 105, 111,
+        1, -25, 105, -29, -45, -124, 111, -61, -115, 51, 99, 74, 28, 71, 99, -17,
+        -76, -113, 81, -28, 123, 27, 27, -114, -30, 85, -5, 55, 125, 22, -27, 26,
+        -43, 68, 84, 85, 23, 26, -124, -38, -67, -101, -98, 53, -41, 108, -110, 112,
+        21, -75, -41, -81, 41, 79, -83, -43, -12, -44, -37, -76, -57, 93, 64, 63,
+        93, -101, -72, -21, -19, -9, -59, 93, 57, 73, -36, 93, 111, -83, -31, -82,
+        15, 83, 96, 66, 75, 83, 123, -85, 77, -83, 127, 45, -48, 83, 127, -12,
+        28, -31, 3, 85, -85, 92, -97, -22, -12, -83, 117, 122, -101, -98, -84, -125,
+        -50, -5, -17, -125, 79, 50, -31, 92, -32, -72, -88, 14, -57, -51, 1, -57,
+        -51, -125, 121, -113, 47, 97, -17, -58, -105, -65, -113, -58, 39, -111, 45, -124,
+        -113, 51, -73, -126, 22, -81, -43, -65, 17, 8, 47, 38, -124, -105, 26, 8,
+        111, 110, 32, -68, 79, 85, -124, -73, -83, 34, -68, -5, 26, -124, -9, -62,
+        -76, 122, -75, 49, 88, 77, 84, 57, -61, 108, 91, -62, 108, 80, -86, 34,
+        -101, 82, 120, 106, 15, 66, -85, -96, -88, -71, 64, -96, 55, 65, 55, -121,
+        -95, -81, 34, 103, -24, 118, 39, 6, 53, 56, 127, 28, 53, 8, -85, -82,
+        26, -21, -1, 60, -12, 58, -102, 83, -17, 46, 124, -71, -30, 51, -12, -70,
+        -82, 112, 28, -78, 38, 120, -2, -83, 42, -47, 90, -42, -119, -70, -82, -125,
+        -103, 38, 83, -36, 48, 65, -48, 21, -116, -74, -27, 123, 85, -114, -90, -76,
+        72, 42, -50, 20, -33, 120, 112, -27, 62, 96, 8, 23, -70, 42, -128, -99,
+        -90, -80, -15, -6, -37, 60, -59, 32, 73, -8, -122, 81, 32, 30, 28, -126,
+        127, -61, 21, 58, -17, -126, 110, 87, -55, -122, 80, -15, -32, 46, -72, 118,
+        10, -63, -29, -52, -85, 60, 78, 94, -26, 113, 50, -32, 113, -26, -60, -29,
+        28, 20, -92, -14, -2, 88, 82, 19, -57, 32, 98, -66, -52, -53, 42, 80,
+        -60, -127, 3, -102, -66, 111, -75, -85, 50, -96, 3, 106, -43, 126, 27, 72,
+        16, -78, -60, 103, 25, 12, 48, 54, 80, -52, 116, -80, -99, 18, -34, -16,
+        -7, -19, -30, 122, 2, -55, -37, 10, 11, -62, 1, 21, 99, 100, 20, -118,
+        -67, 77, -70, 94, -99, -120, 110, -65, -72, 15, -41, 25, 5, -17, -41, 73,
+        118, 31, -89, 55, -4, 1, 121, 113, -68, 52, 17, -19, -99, 46, 4, -101,
+        85, -124, 96, 12, -33, -56, -51, -103, -41, 72, 48, -66, 114, 56, -38, 27,
+        78, 69, -40, -108, 114, 4, 57, 26, -4, 112, -94, -111, 6, 98, 40, 126,
+        42, 110, 121, -93, 64, 34, 11, 8, -2, -112, -32, 119, -58, -97, 95, 44,
+        29, 29, 30, 22, 20, 77, -117, -81, 57, 62, 120, 106, 91, 50, -3, 100,
+        -20, 34, -37, 29, -4, -73, 84, 14, 26, 48, 75, -54, 29, 92, 19, -88,
+        41, 116, 73, 58, -13, 15, -120, -71, -73, 104, 27, -122, 74, -87, 119, 82,
+        -74, -56, 108, -38, -4, 77, 85, -72, -14, -55, 11, -109, -5, 112, 91, -68,
+        68, -105, 123, 34, -45, 63, 24, 122, -20, 18, 58, -51, 114, 12, -46, 11,
+        -85, -50, 12, -115, -7, -107, -76, 41, 57, -20, 52, 80, 124, -125, 120, -95,
+        6, 117, -101, 100, -87, -102, 46, 35, 75, -21, 8, -61, -92, 6, 17, 42,
+        7, 3, 18, -115, 73, 12, 20, -21, 122, 34, 38, 124, 53, 18, 27, 78,
+        20, 36, 76, 120, 102, 44, 51, -32, -70, -120, -4, 106, -7, -62, -33, 22,
+        121, -43, 98, -53, 95, -24, 34, -78, -52, 83, 126, -84, 100, 97, -51, -75,
+        -107, 56, 26, 70, 30, -71, -78, -62, 31, 127, 103, -78, 64, 61, -113, 37,
+        -95, -4, 43, 82, -113, 90, -73, -33, -12, -88, 101, 121, 57, -118, -45, 120,
+        -11, 71, -104, -57, -72, -114, 69, 59, -113, -84, 6, 25, 44, -36, -78, -14,
+        68, 34, 6, -104, 71, -69, -95, 87, 45, -3, 54, 74, 75, -23, -4, -3,
+        -25, 13, 26, -28, -39, -46, -87, -87, -47, 68, -71, 16, 24, 78, 98, 101,
+        3, 31, 99, 44, 1, 32, 41, 49, -86, -127, 114, -13, -31, -40, 59, -74,
+        -90, -10, 70, 53, -29, -17, 5, 90, -85, -70, 103, 74, 37, 45, 113, 75,
+        10, 113, -86, 60, -41, -63, 52, -81, -94, 51, -56, 7, -82, 65, -93, -37,
+        -104, -55, 115, 77, -71, -29, -88, 100, -11, 92, -73, 60, -67, -34, 68, -103,
+        22, -39, -106, -49, -54, 55, 13, -123, -42, 96, 121, 69, 106, -41, 111, 100,
+        -34, 42, 40, -57, 98, 116, 70, 84, 114, 94, 107, -72, -66, 97, 50, -3,
+        69, 52, -5, -12, 15, 89, -63, -31, 4, -127, 79, -106, -84, -98, -126, -60,
+        56, 76, -92, -41, -45, 58, -57, 40, 76, -65, -38, -93, -24, -83, -88, 71,
+        38, -24, 57, -44, 96, -79, -52, -77, -10, -83, 74, 47, 111, -124, 19, 96,
+        23, -64, -52, -66, 58, 19, 10, -5, -37, 54, 2, 60, -59, 22, 29, -107,
+        111, 99, 77, -41, -67, 8, -100, 88, 27, -121, -58, -20, 46, -36, -93, -103,
+        -105, 88, 31, 22, -99, -6, 90, 118, 88, 118, -113, -84, 115, 65, -41, 102,
+        -59, 19, 21, 18, -61, 126, 23, 43, -30, 122, 52, 116, -113, 70, -61, -95,
+        -41, 31, 1, -20, 124, 88, -27, 112, 29, -17, -83, -28, 42, 127, 46, -1,
+        73, -79, -99, -118, -32, 81, 29, -70, 94, 90, 18, -75, -106, -126, -110, -11,
+        -44, 58, 44, -61, -71, 90, -38, 94, 13, 55, 62, 77, -86, -20, -111, 77,
+        58, 32, -118, -113, -97, 52, 118, -113, -36, -68, 89, -13, -105, 117, -102, 70,
+        9, 89, 106, 36, -74, -16, -27, 24, -5, -38, -119, -5, -59, 19, -5, -98,
+        28, -115, -91, -99, 113, 104, 109, -96, -18, -104, 123, 73, 41, -114, 69, -58,
+        -57, 120, 26, -82, 62, 102, 10, 120, -20, -83, -38, -50, 14, -70, -112, 8,
+        -113, 102, 123, 33, 100, 70, -17, 16, 127, 23, 113, 83, 8, 70, 108, -112,
+        -53, 14, -16, -36, -40, -49, 13, -103, -2, 77, 90, -114, -35, -84, -53, 49,
+        -58, 25, 53, -31, 106, 93, 34, 94, 125, 25, 95, 95, 31, 30, 14, -98,
+        3, 29, 96, -53, -88, -90, 29, -51, -23, -18, 8, 3, 91, -106, -21, 57,
+        95, -67, 22, -18, 49, -13, 122, 52, 114, 119, 45, 78, -114, -42, 64, -27,
+        -20, -28, -63, 35, -69, 71, -77, 35, 27, -98, -24, -37, 96, -6, -4, 66,
+        79, 37, -11, 109, 34, -112, 46, -5, -19, -114, 18, 127, -49, 28, -70, -67,
+        -57, -99, -91, -38, 126, -23, 108, 5, -75, -25, 59, -20, -25, -75, 103, 72,
+        -123, 30, 92, 1, 29, 23, 121, 91, -12, -29, 92, 32, -107, 27, 123, 27,
+        -7, 59, -44, -98, 97, 11, -11, 58, -101, 123, 120, -73, -67, 6, -110, 14,
+        -1, -2, -35, 79, 119, -27, 75, 10, -56, 54, 46, 96, 122, -97, 71, 119,
+        64, 63, 53, -86, -37, -36, 79, -44, -35, -72, 8, 11, -35, -21, -5, -76,
+        124, -7, -77, 100, -117, -78, 46, 16, 120, -85, -117, -24, 18, -43, -122, -32,
+        79, -16, -128, -6, -36, -16, 99, -80, -124, 1, -100, -29, -3, 43, -65, -50,
+        -116, -81, -13, 95, -52, 76, -13, -13, -4, -113, 48, 49, -13, 89, 2, -6,
+        65, 113, 86, 90, -29, 90, -53, 122, -77, 122, -101, 102, -125, 122, 107, 110,
+        -3, -6, -99, -99, -1, -73, -82, -34, -26, 69, -98, -1, 41, 23, -128, -66,
+        126, 49, 63, -11, 5, -38, 26, -91, -73, 102, -23, -83, 42, -51, 87, 79,
+        53, -82, -73, 108, 54, -85, -75, -87, 55, -88, -73, 102, -60, 104, 64, -3,
+        -112, 95, -30, 36, 33, -90, 100, -113, -15, 89, -107, 66, 66, 126, -22, -9,
+        -86, 96, 105, -58, 68, 73, -13, 90, 101, -96, -72, -32, 58, -41, -13, 105,
+        -20, 71, -109, 122, -28, -109, -27, 5, -93, -126, -118, -78, -37, -67, 125, -59,
+        77, 39, 90, 33, -37, 47, -96, -124, 79, -126, -112, -108, -38, -95, 25, -106,
+        112, -116, 6, -35, 25, 81, 86, 33, 107, -125, 84, -49, 57, 107, 35, 47,
+        18, 105, 1, 71, 23, 26, -44, 67, -100, 95, -105, -121, -82, 18, -40, -110,
+        82, -69, 109, 10, -94, 39, 75, -4, -64, 13, 17, -12, 44, 92, 84, 87,
+        81, -18, -73, 88, -59, 121, 85, 31, 61, -10, 104, 50, -2, -116, 111, 42,
+        -97, -82, -57, 122, 36, 94, 94, -88, -9, 22, 13, 35, -44, 85, 126, 11,
+        -95, -14, 75, -66, 32, 18, 106, -22, 35, -6, 52, -32, 70, 79, 112, -95,
+        52, 52, -92, 113, -46, 57, 51, 84, 60, 32, -123, -12, -100, 26, -45, -77,
+        51, -118, 23, -114, -114, 93, -108, 34, 122, -69, 17, -90, 98, -124, 41, 53,
+        74, -115, -8, -78, -86, 76, -38, -71, -90, -114, -121, 124, -122, 106, 54, -64,
+        25, 42, -41, 94, -70, -94, -122, -7, -114, -77, -70, -124, -79, 77, -51, 27,
+        -21, 87, -104, 6, 61, -31, 7, 7, 35, -65, 54, 75, -77, 15, 103, 47,
+        99, 60, 34, -120, 83, 83, 3, 125, 121, 125, -85, -74, 98, 92, -85, -83,
+        8, -105, -67, 114, -90, 12, 3, 89, 39, -13, 23, -53, 101, -78, -3, 61,
+        -100, -57, -21, -94, -59, 123, -30, -63, 104, 82, 126, -112, 40, 51, 56, 87,
+        -28, -84, -99, -75, 72, -44, 82, 84, 35, -41, -21, -94, -80, -123, -71, 29,
+        104, -47, 20, -118, 115, -7, 125, 48, 109, 39, -79, -63, 55, -35, 24, -125,
+        82, -8, -12, -81, 23, -53, -103, 67, -43, -65, 74, -105, -24, 77, -9, -54,
+        -97, 36, -83, 98, 46, -111, 54, 76, 9, 118, -61, -108, 96, -73, 35, 18,
+        83, 109, -57, 36, -98, -118, -72, -63, 107, 25, -113, -34, 90, -15, 40, -7,
+        -96, -78, 61, 81, -79, 121, -80, -125, -84, 57, 43, 114, -36, -78, -18, 70,
+        21, 67, 42, 23, -17, -80, 12, -89, 44, 77, 97, -41, 25, -70, 72, 115,
+        31, -94, -109, -32, 107, 91, -63, 125, -4, -49, -81, -82, -51, -40, -27, -7,
+        -29, -21, -61, -79, -13, 110, -126, 5, 73, -35, -56, 90, 93, 9, -18, -90,
+        -95, 63, 84, 58, -92, -7, 52, -41, 63, -117, 105, -31, 91, 88, 24, 85,
+        32, -101, 102, -66, -115, 52, -11, 30, 49, 68, 6, -104, -34, -4, 49, 117,
+        126, 91, -122, -77, 120, -75, 69, 71, -2, -24, 89, -29, -58, -11, 110, -56,
+        -57, 119, -125, -57, 13, -93, 126, -41, 53, 84, -39, -104, 122, 23, 121, -39,
+        108, -106, -72, -54, 7, -81, -80, -84, 114, 93, 48, 104, -50, 25, 52, 103,
+        -91, 39, -4, 84, -22, 113, 19, -35, 68, 79, 105, 74, 82, -69, -96, -45,
+        49, -93, -109, -126, -54, 0, -8, 98, 86, 35, -113, -123, 75, -63, 68, 107,
+        -103, 59, -51, 46, -110, 75, 31, 13, -3, 33, 115, 40, 94, -68, 98, 111,
+        25, -124, -62, -65, -111, 19, -87, 87, 21, -114, -117, 19, 126, 73, -52, -116,
+        -37, 39, 66, 25, -103, -58, -39, -4, 70, -110, 107, -90, -43, -47, -81, 111,
+        -94, 90, -27, 104, -20, -63, 24, 122, -113, -87, -62, 70, 126, 29, 44, -67,
+        77, -80, -20, -83, 39, 69, 47, 24, 12, -121, -80, -92, -20, 47, -27, 94,
+        5, 55, 100, -121, -32, 92, -93, 78, -33, -99, -15, -75, -123, 47, -12, 103,
+        -20, 108, -6, 25, -70, 54, -126, -61, -82, -98, -88, -112, 68, -114, -77, 117,
+        65, 123, -84, 11, 48, -17, -116, -45, -124, 100, -97, 86, -46, 73, -68, 25,
+        90, -52, -69, -34, 85, 112, -43, -29, -51, 95, 123, -71, -37, -45, -70, 50,
+        -65, 10, -32, -55, -70, 33, 67, -119, 77, -113, 89, 58, 82, -58, -53, 35,
+        -98, -47, 107, -42, -76, -37, -7, 7, 6, -5, -3, -36, -59, -23, -35, -87,
+        62, -95, -35, -83, -4, 79, 79, -3, 94, -67, 9, 43, 35, -13, 50, 99,
+        -81, 53, -72, -20, -44, 9, 46, -54, 105, -106, -109, -109, -38, 43, -81, 85,
+        119, -80, 120, -10, 39, 41, 118, -82, -18, -11, -11, -97, -52, -21, -8, 15,
+        -96, -118, 72, -23, 93, 43, 124, -111, 94, -70, -34, 61, 35, -33, -103, -89,
+        -13, 92, 126, -1, -62, 18, -28, -101, 83, -47, -49, 93, -103, 9, 20, 2,
+        -53, -74, -112, 40, -117, 75, 60, 17, -126, -89, 69, 11, -99, -113, -103, 127,
+        -27, -31, -113, 95, -128, 52, -10, -17, 12, -68, 1, -104, 100, -39, 10, 105,
+        40, 75, -116, -48, 120, 68, 47, -40, -115, -104, -77, 27, -15, 127, 53, -42,
+        -112, -109, -110, 56, 3, -102, 107, -62, 25, -91, 10, -128, 49, -96, -17, 94,
+        -5, 10, 2, 95, -84, 1, 95, -84, 123, -53, 102, 124, 81, 120, -41, 26,
+        -66, -64, -81, -55, 119, 67, 14, -4, 61, -100, 31, -54, -62, 3, 52, 64,
+        -40, 71, -61, 25, 57, 116, -88, 126, 99, 1, 56, -59, -1, 6, 60, -127,
+        19, -85, -30, 9, 74, -3, -1, 59, -98, -40, -108, -16, -60, -90, 9, 79,
+        108, -66, 35, -98, 40, -67, -56, -20, 9, 28, 37, -52, -67, -76, -32, 81,
+        -8, -30, 21, -23, -49, 93, -78, 60, 62, -3, -27, -112, -97, 31, 71, 23,
+        -79, -2, -122, 5, 67, 7, -94, -105, -50, 58, 19, -16, -119, -22, 57, 84,
+        -121, -125, 18, -95, 78, 93, 126, 73, 79, 83, -123, 41, 54, -48, 31, -101,
+        -40, -12, 67, -109, 88, 58, -5, 37, -53, -119, -55, 106, 114, 10, 125, -32,
+        84, -4, 10, -116, -83, 126, 5, -58, -56, -92, -22, -97, 83, -58, 51, -53,
+        -105, 103, -62, 69, -116, 9, -119, 122, -26, -77, 75, 44, -98, 6, 72, 44,
+        -35, 31, 63, -87, -109, -122, 54, 85, -13, 81, 118, 27, -21, 19, 60, -1,
+        -17, -101, 96, -33, 28, -87, 8, 31, 108, 23, -38, -10, -38, 78, -72, -71,
+        -103, -22, 2, -4, 45, 11, 25, 27, 93, -20, 115, 47, -63, 94, -116, 116,
+        126, -115, -126, -30, 40, 97, -96, -57, -93, -72, -25, 19, 30, -115, -60, -55,
+        -100, 28, 13, -23, 86, 94, 119, 67, -98, 34, -90, 20, -108, 91, 2, 21,
+        58, 109, 71, -84, -22, 83, -14, -71, -106, 28, 50, 74, 12, -22, 123, 93,
+        -76, 72, -126, -63, -31, -69, -119, -21, -18, -40, 75, 97, 73, 62, -119, -15,
+        -86, 46, -118, 75, -3, -3, -63, -52, 1, -8, 47, 71, 46, 107, 40, -22,
+        54, 54, 100, 119, -7, 48, 115, 72, 47, 99, 77, -18, -4, 75, -102, 66,
+        26, -125, 19, 23, 47, -41, -73, 87, 87, 81, -110, 84, -5, -96, 87, 84,
+        -23, -126, -90, -111, -3, -101, -13, 70, 24, -53, 55, 109, 85, 74, 99, -34,
+        24, -101, 5, 52, -60, 3, 35, 65, -72, -80, 94, -20, -46, 80, 43, -86,
+        7, -92, -124, -7, 27, 54, 113, -94, 124, 109, 105, -32, 47, 89, -7, -105,
+        97, -79, -96, 101, -105, 41, -8, 68, 113, 26, 46, -3, 46, -105, 40, -80,
+        84, -90, 20, 98, 110, 20, -71, 49, -104, -30, -65, 23, -61, 75, 31, -1,
+        -18, 38, 51, -57, -70, 120, 31, 80, -53, -121, -19, -110, 7, 124, 98, 77,
+        -87, 87, -23, -100, -105, -31, -22, 116, 55, 92, -99, -82, -51, 16, 70, 124,
+        8, -82, 84, -22, 89, 24, 74, 61, 8, 40, 56, -73, 38, 25, -119, -63,
+        76, 90, -87, 70, -116, -64, 118, 70, 20, 35, -2, 58, 39, -94, 81, -14,
+        -93, -103, 65, 86, -90, 117, 98, -109, 36, 72, 13, -3, -61, 95, -61, -37,
+        -56, -17, -106, -20, -29, 41, -44, 27, 11, -67, 86, 116, 119, 24, -98, 110,
+        15, 107, 29, -79, -112, 104, 50, 6, -97, 1, -24, 90, -100, -114, 40, 9,
+        -73, -47, 92, 68, 80, 100, -8, -32, 33, 74, 124, -42, -63, -114, 98, -97,
+        -95, -87, 97, 119, -106, -60, -53, 62, -34, -91, 93, -81, -69, -50, 19, -25,
+        63, 80, -78, -128, -126, 11, 102, 127, -2, 46, 44, 62, -103, -95, 109, 43,
+        125, -51, -42, -15, 92, -45, 0, 93, 4, 58, -54, -83, 85, 104, 51, 119,
+        24, 125, -77, -123, 77, -50, 92, 36, -74, 95, -47, -72, -117, -127, 126, 114,
+        -90, -74, 68, 63, 3, 50, 55, 4, -58, 56, -22, -63, -81, 9, 12, -117,
+        100, 50, 8, 28, 14, -23, 115, -63, 37, 22, 121, -12, -53, 51, -21, 19,
+        8, 78, 45, 105, 62, 27, 69, -87, -72, 60, 92, -91, 116, -126, -106, -87,
+        37, -51, 31, -105, 74, -14, -61, 72, -101, 2, -5, -67, 32, -121, -3, -26,
+        2, -95, -45, -19, 6, -121, 80, 113, -35, 2, -43, 15, 34, -89, -27, -119,
+        122, 113, 47, 47, 47, 15, 46, 77, -20, -111, 45, 61, -3, -5, 111, 89,
+        -98, -90, -83, 107, -77, 64, 94, 98, 28, 124, -26, 100, 127, -98, -35, 55,
+        -99, 124, -28, 62, -120, -13, -96, 99, 63, 91, -25, 57, -5, 10, 41, -14,
+        30, -86, -64, 105, -122, -110, -47, 0, 21, -5, 34, 100, 26, -45, 32, 50,
+        -111, 68, 18, -60, 3, 100, 11, 99, -52, -99, -63, 31, 35, 119, 30, -92,
+        -67, -40, 48, 33, -84, -63, 17, 76, 91, 122, 3, -36, 24, -25, -106, 50,
+        111, -82, 49, 47, -22, 55, -16, 63, -14, -9, 66, -5, 77, -27, 117, 118,
+        -93, -8, 122, 118, 67, 28, -39, 27, 2, 4, -10, 2, 52, -9, -105, -12,
+        -66, -30, -81, -47, -17, -55, -100, -19, -77, 51, 120, -18, 109, 6, -7, -51,
+        -43, 120, 17, 109, -48, 123, 33, -65, 61, -56, -39, 112, -44, 53, -18, -88,
+        33, 85, -25, 50, 68, 31, -42, 10, 49, 91, 84, 84, 16, 97, 65, 123,
+        -121, 56, 80, -89, -114, 44, 70, -121, 77, -37, 27, -45, -74, -2, -87, 91,
+        -125, 114, -94, 93, -104, 93, -103, -41, -47, -5, 40, 71, 37, 101, -37, -79,
+        -14, -24, -83, 14, -33, -41, -118, 94, -49, 3, -90, -32, -16, -112, 116, -53,
+        40, 9, 40, 123, -78, -32, -123, -23, -30, 8, -71, -59, -86, 95, 120, -90,
+        21, -92, -97, -17, -108, -114, -29, -74, 86, -57, 17, 95, 118, 74, 90, -114,
+        51, -27, -84, -125, 20, 30, 39, -122, -37, 77, 1, 70, 124, 123, 107, -9,
+        92, 120, -19, 83, 88, 55, 40, 85, 29, 44, 100, 22, 103, 54, -43, -42,
+        5, -27, 103, 32, 30, 51, -125, -75, -87, -65, 37, -119, 52, -95, -122, 86,
+        113, 99, -87, 83, 86, -62, -119, -73, 54, 42, 81, -65, -58, -70, 51, 56,
+        40, -22, 93, 78, 52, 119, 85, -76, -42, 105, 19, 99, 96, 122, 78, -107,
+        117, 18, 25, -90, 107, -17, 32, 54, 28, 45, -118, 100, -15, 86, -58, -76,
+        -128, 16, 71, -48, 15, -34, -123, -82, -34, 3, 121, -58, 55, -9, -119, 40,
+        -14, -74, 70, 61, -58, 73, 105, 21, -11, 4, -77, -48, 121, -71, -48, -71,
+        86, 72, 106, -88, 16, -38, -30, -65, -51, 44, -87, 8, -90, 21, -111, 105,
+        -70, -25, 70, -10, 114, 53, -44, 99, 34, 105, -38, -80, 72, 86, 0, -22,
+        7, 70, 101, -62, -4, -101, 106, 15, 73, 42, 104, 124, -35, 123, 88, -34,
+        -12, -64, -44, -99, 71, -59, -84, -21, 93, 80, -116, 6, -81, -53, 36, -36,
+        -35, 75, 70, -126, 100, -84, -82, 104, 78, -104, -116, -112, 23, 114, 28, -62,
+        -74, 60, 4, -117, 29, 124, -112, 106, 6, 87, 122, -122, 99, 58, -77, -31,
+        -114, 90, -51, -121, 126, -51, 69, 43, 41, 71, 101, 82, -25, 41, 114, -127,
+        39, -19, -113, 0, 125, 52, 4, 50, 32, 11, -65, 21, 25, -113, 8, 64,
+        -28, -106, -40, -20, 34, 97, -108, -104, -51, 101, 14, 98, 110, 27, 35, 105,
+        58, 111, -12, -118, -118, 91, -89, -68, -76, 48, -24, 81, 105, -59, -106, -15,
+        109, 118, 35, -36, 33, 27, -63, -81, -124, -110, 52, 7, 87, 81, -106, -127,
+        26, 95, -90, 45, -41, 98, 43, 77, 99, 96, 40, 104, 59, 43, -79, 109,
+        69, -67, -59, 14, 93, 18, 44, 34, -94, -106, -118, -25, 90, 68, 117, -36,
+        81, -128, -32, 58, 127, 41, -46, -9, -81, 80, 31, 61, 41, -97, 113, -83,
+        -50, 109, -72, -95, 50, -121, -121, -48, 94, -111, 37, -128, -4, -62, 60, 117,
+        -70, 127, 127, -15, -5, -81, 111, 126, -3, -101, -33, 81, 90, -3, -99, 48,
+        -113, 58, -68, -113, -50, -43, 122, 5, 20, 111, 4, 41, -104, -70, -54, -78,
+        -50, 109, -104, 110, -31, 71, 103, 30, 23, 75, 32, -55, 7, -99, -113, -48,
+        43, -92, 110, 59, -77, 112, 93, 68, 29, 88, 13, 50, 126, 74, 103, 81,
+        39, 46, -118, 117, -44, -71, 95, 68, -80, -91, -28, 56, 37, 78, 111, 58,
+        -3, -50, 11, -104, 46, -45, 59, -18, 42, 47, 87, 120, -58, 18, -72, -39,
+        82, -91, 54, -98, -62, 69, -107, 8, -97, -124, -46, 13, 37, 39, 12, -127,
+        -60, -32, 63, -82, 81, 110, 112, -123, -1, -36, 105, -26, -61, -102, 118, -13,
+        52, 70, -17, 65, -87, 119, -33, -76, 29, 124, -51, -67, 28, 120, 10, 84,
+        55, -25, -86, 34, -56, -29, 108, 6, 112, 52, -95, 40, -41, 8, 44, 95,
+        -70, 88, -90, -72, -72, -125, 123, -111, 121, 58, -108, 82, -10, -82, 127, 39,
+        28, -61, -49, -92, -12, 15, -23, 61, 25, 113, -28, 20, -121, -15, 81, -88,
+        91, -33, 123, 119, -88, -17, -108, 86, -107, -28, -91, -6, -67, -15, -43, 27,
+        9, 35, -104, -95, -9, 2, -106, 78, 3, 80, -47, -62, -56, 112, 49, -53,
+        -48, -48, -99, -12, 126, 43, 68, 62, -54, -81, 2, 21, -69, 40, -43, -72,
+        -44, 60, 11, -40, 11, 12, 114, -34, 18, 119, -120, 96, 59, 29, -70, -46,
+        -72, -29, 78, -48, -9, -33, -42, -5, 4, -1, 42, -78, 18, -67, 21, 74,
+        21, 64, 32, 50, 63, -112, 64, -15, -17, -80, -25, 31, -128, 56, 125, -63,
+        -54, 50, -98, 117, -127, 73, -78, -24, -100, 23, 125, -51, 102, -90, -120, -128,
+        47, 95, -82, 24, -85, -72, -18, -67, 56, 26, -77, -27, 58, 109, 2, 3,
+        -36, 65, 97, 70, 103, -35, -50, 112, 63, 75, 122, 42, 88, -46, -45, -57,
+        50, -65, -36, 115, -23, 30, -84, -63, 120, 108, 46, 26, 1, 44, -31, -67,
+        -33, -117, 103, 36, 49, -38, 102, -4, -17, -59, -8, -33, 63, 122, -4, -30,
+        52, -65, 1, 112, 124, 115, 108, -11, -127, -15, 70, -100, -24, -113, 21, 48,
+        49, -107, -122, -100, -44, 123, -125, 39, -30, 29, 83, 123, -5, 28, 60, -48,
+        -99, 3, -76, -10, 3, -13, -44, -13, 70, -13, -125, 115, -25, 93, -51, -4,
+        100, -25, 109, -4, -75, -73, 5, 26, 95, 39, -39, 63, 122, 66, 57, -60,
+        -65, -33, 77, 42, -44, -38, -44, 121, -89, -100, -14, -64, 21, 75, 28, -108,
+        112, -89, -8, -103, -119, 114, -108, 2, -22, 39, -82, 109, 122, -93, 41, -85,
+        -50, -112, 120, -26, -66, 70, -72, -116, 63, -67, -68, 120, 115, 121, 100, -95,
+        97, 92, 95, -17, 78, 83, 30, 40, -11, -88, -44, 95, 23, 74, -27, -11,
+        5, 87, 121, 37, 111, -115, -97, -22, 58, -44, 69, -74, -38, 33, 101, -48,
+        117, 102, 91, 117, 67, 93, -111, -126, 4, -32, -54, 75, -107, 23, -91, 45,
+        95, 71, 70, 62, 21, -41, 17, -89, -112, 36, -63, -6, -26, 100, 88, 118,
+        -20, 37, -6, 53, -104, 92, 12, -31, -128, 28, 119, -73, 32, 36, -85, 124,
+        48, -97, 29, 30, 18, -59, -63, -99, -122, -98, 9, 77, -76, 51, -91, 117,
+        -67, -50, -109, -82, -21, 78, -49, 0, 81, 3, -1, -10, 49, -5, -3, -26,
+        42, 116, -62, -110, 112, -110, 94, 114, 36, -69, -20, -21, -125, -67, -80, -116,
+        -68, 63, -70, -12, 36, 59, -19, -65, -125, -125, -13, -22, -16, -16, 61, 29,
+        -128, 87, -18, -50, -88, -64, 94, -127, -40, -22, -98, 91, 103, 41, 100, 120,
+        -50, -125, 46, -87, -13, -33, -103, -126, 59, -99, -29, 102, 121, -118, 1, 39,
+        -7, 29, 36, 50, 57, 30, -55, -16, -8, -41, -71, -89, -61, -90, -126, 20,
+        24, -15, -7, -31, -31, 91, 26, -15, 57, 90, 43, -65, 3, 116, -69, -122,
+        127, 55, -34, 27, -68, 88, 12, -68, -24, 93, -77, -81, 37, -65, 26, -40,
+        109, 45, -84, -128, -12, 83, -74, -28, -112, -30, -97, -47, 1, -60, -125, 40,
+        -33, -83, -34, 13, -60, 79, -113, 63, 106, -79, -108, -113, 89, -19, 113, 84,
+        -25, -107, 91, 26, 105, -77, 121, -89, 110, -122, -87, -10, 91, -97, -27, 59,
+        121, 33, 76, -43, 79, 56, 37, -111, 102, -91, -120, 81, 121, -4, 83, 12,
+        -1, -127, 104, -109, 59, -95, -12, -33, 66, -126, 4, -66, -62, 127, -17, 25,
+        30, 14, 125, -29, -98, 101, 1, -90, -120, 48, 7, 110, -66, 124, -3, -97,
+        17, 113, -118, 4, 64, 112, -27, -107, 51, -49, 85, -26, -75, -105, -47, 102,
+        -36, 75, 50, 55, -109, -110, 1, 125, -67, -101, -28, 1, -22, 1, 31, -27,
+        2, 98, 47, 72, -38, -125, -46, 19, -6, 80, 94, 70, 98, -101, 119, 17,
+        -71, 69, 9, -1, -128, -35, 89, -108, 116, 7, 102, -70, 62, -35, -100, -116,
+        69, 111, -56, 88, 116, -51, 20, -107, -106, 76, 81, -23, 90, -67, 56, 110,
+        12, 17, -14, -107, 46, 93, -34, -106, 5, -44, -9, 101, 1, -11, 39, -22,
+        -50, -36, 49, 68, -89, 3, 115, -49, -48, -65, -57, 64, -33, 53, -17, -76,
+        -30, -103, -14, 45, -9, 30, 46, -68, 123, -33, 123, 111, -54, -100, -63, 36,
+        36, 5, -49, 10, -79, -84, -87, -3, -66, 87, -69, -56, 36, 5, 28, -123,
+        20, -105, 126, 93, 86, 116, -119, -41, -91, -87, 126, -112, 115, -11, 3, 124,
+        72, -86, -49, -45, 5, -114, 100, -40, -46, -82, -88, 91, 17, 92, -48, 43,
+        32, -109, 88, 49, 100, -12, 49, 40, -114, -34, -101, -49, -30, 97, 26, -33,
+        -122, 108, -62, -20, 103, -12, -73, 60, -100, -81, -61, 36, -39, 50, 122, -32,
+        -119, 83, 95, -93, 88, 70, -47, -4, -24, -67, -51, 4, -23, 104, 60, 120,
+        6, 23, -11, 27, -114, 57, -40, -123, -10, -64, -52, -98, 11, -19, -102, -114,
+        20, -74, 72, 5, -110, 72, -124, -76, 45, 52, -48, -60, -94, -12, -80, -13,
+        -66, 36, -67, 73, 88, 58, -109, -26, -59, -98, 28, -25, 75, -100, 6, 32,
+        25, 78, 115, 126, -64, 65, -5, 123, 38, 69, 74, -34, -64, 44, -32, -109,
+        -49, -98, -14, 115, -26, -47, -8, -123, 72, -31, 13, -40, 95, 68, -28, 67,
+        -61, 91, -81, -53, -61, -128, 0, 94, 126, -73, -1, -91, 66, 123, -93, 120,
+        95, -9, 46, -15, 89, 65, 10, -38, 63, -49, -62, 98, -11, 82, -111, 89,
+        -97, 7, 36, -75, 67, 84, 95, -100, 4, -74, 77, -21, -13, 34, 0, 55,
+        -17, 24, -95, 87, 24, 110, -37, -39, 58, 3, 69, -116, -34, -126, -13, 112,
+        -37, -11, 62, 15, -26, 66, -10, 13, 100, 89, 67, -99, 123, -90, -12, -3,
+        -39, 80, 124, -74, -41, -64, -19, -21, 103, 76, -100, -118, 53, 52, -23, -86,
+        -85, 57, 40, 93, 107, -17, -29, 75, 26, 49, 91, 67, -14, 123, 65, -62,
+        -81, -2, 118, -44, -11, -42, -40, 75, 53, 103, -36, -11, -106, 104, -93, 8,
+        -104, -32, 78, 97, 2, 28, 9, -117, -86, 1, -5, -56, 93, 53, -65, -13,
+        -16, -39, -39, -101, 17, -86, 126, 39, 72, 38, -86, -56, -123, 20, 3, -117,
+        23, 95, -76, 68, -97, -61, 61, 6, 68, -31, 8, 47, -76, 49, -36, 104,
+        2, -8, -7, -51, 118, 109, -100, 2, -51, -79, 104, -90, 93, 121, 27, 117,
+        -75, 93, 121, 6, -83, -80, 53, -55, -125, 123, -45, 19, -23, -69, -46, -11,
+        117, -70, 115, 77, 21, -127, -32, 76, -109, 6, 28, 30, 126, -94, -23, -23,
+        105, -82, 119, 86, 118, 30, -87, -118, -107, 50, -60, -14, 124, 2, -94, -9,
+        -16, -112, -3, 126, -31, 122, 31, -60, -17, 15, 80, -96, -4, -108, -47, 66,
+        63, -106, 83, -9, 22, 45, 55, -3, 110, -62, -117, -115, 113, -123, 25, 93,
+        76, 41, 93, 76, -28, -4, 80, -78, -125, 11, -3, -2, -102, -119, -101, 96,
+        -114, -30, 67, -72, -56, -30, -63, -97, -52, -69, -118, -59, -12, 49, 66, -101,
+        8, 45, 75, -104, 122, -49, 47, 47, 110, 46, -5, 51, -61, -28, -48, 61,
+        -78, -56, 49, -5, -95, -37, 11, -97, 24, -28, -125, 116, 118, 62, 123, -92,
+        -49, 20, -74, 56, -21, 0, 101, 29, -61, -55, -20, 17, -78, 126, -78, -93,
+        -70, -127, 107, 103, -35, -21, 121, -47, -15, 92, -56, -6, 49, 105, -55, 100,
+        -3, 107, 110, 70, 105, 10, 58, -97, -124, 71, 107, -76, 124, 77, -53, -109,
+        -16, -94, 126, 16, 62, 89, 50, 15, -29, -106, -4, 73, -119, 81, 112, -14,
+        126, -32, 88, 56, 13, -91, -85, -95, 51, 47, -76, -68, 94, -18, -10, 115,
+        23, -87, -47, 44, 120, 116, 77, -82, -49, 103, -87, 39, -12, 44, -119, -8,
+        86, 39, 40, -46, -114, 93, -24, 109, 70, 112, 90, 55, 99, -33, -92, 84,
+        -27, -31, -43, 122, -44, -114, 113, -84, -45, 99, 112, -2, -1, -124, -13, 127,
+        -113, -52, -96, 56, 123, 54, 16, 3, -30, 35, -19, 5, 73, 85, -126, 104,
+        88, 68, 56, 15, -40, 24, 54, 10, 8, 37, -22, -105, 55, 3, 16, 12,
+        79, -110, 59, -89, -120, -22, 5, 112, -18, 66, -85, -20, 90, -112, 120, -14,
+        -38, -67, 86, 20, 32, -101, 52, -52, 25, 61, 76, 49, 14, -61, -78, 126,
+        74, -95, -57, -23, 110, -70, 94, -18, 49, 35, 52, 84, 114, -88, 95, -48,
+        -110, 91, -87, -74, 42, -14, 58, 10, -40, 48, -75, 120, -90, -33, 42, -113,
+        118, -90, -109, -106, 41, -57, 5, -81, -23, -4, -21, 88, -94, 30, 3, -88,
+        45, -69, 33, 124, -80, 70, 124, 0, 7, 44, 30, 92, -51, 106, -47, -62,
+        -125, 6, 93, 12, -92, 16, 26, 121, 46, -59, -112, -62, 27, 0, -93, -125,
+        -84, 53, -8, -104, 43, 108, -98, -95, -28, 37, -72, -122, 73, 69, -16, -81,
+        -114, -39, 119, -33, -122, 29, 54, 54, -112, -81, 113, 109, 122, -125, -29, -37,
+        -95, 62, -6, 102, 96, -66, -12, 121, 119, -63, -90, -20, -15, -12, -118, 16,
+        68, 86, 70, 16, -39, -47, 21, 34, -120, -80, -105, 85, 17, 68, -10, -28,
+        78, 32, -120, 74, -2, -92, -80, -115, -12, -36, 122, -88, 111, 46, 47, -42,
+        -105, 94, -54, 14, -11, -83, -83, -98, 46, 55, 49, -103, -22, 72, 91, 116,
+        60, 60, 41, 30, -106, -62, 56, -42, -55, 99, -114, 53, 45, 90, -85, 99,
+        29, -10, -126, 124, -17, -79, -66, -102, 1, 105, -128, 45, 98, -53, 27, 60,
+        -37, -55, -47, -72, 95, 94, 75, -60, 68, -91, -13, -115, -82, 15, -19, 103,
+        -4, -74, 114, -58, 111, -75, 51, 14, 80, -71, -123, -7, 51, -111, -63, -98,
+        -29, 13, 4, 24, 29, -18, 20, -27, -20, -82, 87, -69, -82, 101, 61, -10,
+        -14, 97, -40, 31, -44, -64, -80, -123, 81, -53, 45, 121, 87, 17, -17, 62,
+        20, 107, -98, 87, -82, -28, 80, -120, -55, 73, 11, 61, 111, -46, 96, 117,
+        -67, 106, -11, -20, -110, -8, 50, 7, 110, -4, -102, -52, 126, 110, -69, -18,
+        -39, -45, 103, 63, 46, 109, 15, 94, 91, 37, 64, -20, -59, -27, 93, -11,
+        35, 99, -27, 116, -123, 112, -69, -70, -88, -12, -89, 99, 104, 0, 76, 10,
+        77, -78, 106, -45, 63, -97, 20, 66, -58, -102, 7, 53, 37, 97, 126, -109,
+        -100, -59, 60, 62, 60, -28, 63, -76, 103, 7, 21, 33, 88, -37, -99, -47,
+        -48, -59, -120, 60, -46, -73, 1, 38, -24, 106, -85, -75, 61, -79, -26, -127,
+        71, 38, 22, -75, 69, -71, -63, 92, 10, 73, 98, -91, 113, 112, -81, 105,
+        28, 0, 68, -91, 14, -22, 23, 76, -104, -74, -48, 28, -93, -54, 72, 37,
+        -124, -62, 17, 47, -113, 29, -82, -120, 0, 68, 107, 60, 8, 81, -25, -100,
+        125, 75, -91, 90, -19, -47, -79, 120, -52, -93, -93, 103, 106, 47, -36, -28,
+        -31, 114, 17, -49, -86, -17, -112, -30, -56, -79, -25, -56, -107, 122, -113, 44,
+        -59, -44, 86, -17, -55, -38, -101, 101, -47, -16, 102, -7, 61, 94, 41, -67,
+        -1, -113, -69, -73, -31, 110, -37, 72, 18, 69, -1, -118, -51, -67, -93, 11,
+        -120, 32, 69, 42, 113, 118, 2, 10, -26, 81, -108, 120, -94, 123, -20, -40,
+        27, 121, 102, -20, 101, 56, -71, 32, 9, -110, -120, 32, -128, 11, -112, 18,
+        25, -119, -1, -3, 85, 85, 127, 3, 13, -112, 114, -78, -5, -34, 121, 103,
+        38, 22, -47, -24, 110, -12, 71, 117, 117, 125, 87, -85, -33, -21, -3, -59,
+        48, -77, -47, -52, -25, 63, 82, 26, 54, 103, 93, 49, 127, 16, -92, 103,
+        -111, -60, -45, -56, 113, -83, 74, -44, -86, -10, -89, 26, -115, -127, 49, 84,
+        82, 105, 32, -14, 108, -13, -91, -4, 99, -86, 83, -113, 43, 20, -127, 20,
+        -112, 91, -104, 123, 75, -111, 59, -102, -21, 14, 103, -30, -57, 66, -4, -48,
+        -12, -117, -99, 62, 106, 75, 112, 16, 24, -106, 43, -12, -118, 99, -61, 24,
+        48, 2, 92, 10, -88, -117, -86, 64, 39, 13, -17, 34, 12, -13, 72, -34,
+        113, -108, -108, -51, 35, 29, 57, -78, -74, -6, 55, 71, -10, 111, -114, 86,
+        -29, -79, 32, 121, -107, -14, -77, -88, 81, 126, -26, 99, 63, -121, -103, 84,
+        53, -125, 97, 73, 45, 24, -22, 58, -63, -62, 84, -7, -123, -90, 66, -80,
+        -23, -83, -87, 13, -68, -61, 3, 127, 112, 75, -123, -6, -75, 94, -19, 90,
+        -44, -86, 93, 81, 101, -101, -73, -5, 117, -6, -70, -93, 116, -81, 119, -34,
+        -67, -16, -59, 57, 102, -72, -121, -44, -124, -34, -61, 81, -35, 88, -75, 121,
+        92, -99, -21, 97, 92, -7, -118, -30, 20, 51, 50, 114, 69, -72, 59, 72,
+        44, 58, -44, -103, -95, 67, -35, 72, 29, 106, 90, -43, -95, 78, 13, 29,
+        -22, 66, -22, 80, -61, -58, -61, -53, 66, -127, 96, 6, -59, 62, 69, -28,
+        23, -64, -54, -30, -118, 72, -59, 79, -7, -59, -88, 55, -58, -124, -106, -7,
+        -50, 102, 31, -14, 34, -122, -19, -4, -55, 33, 75, 119, -29, 4, -56, -74,
+        -127, -83, -65, -110, -115, -118, -20, 109, -127, -25, -87, -36, -32, -115, -83, -105,
+        55, 77, -35, -12, -48, 96, 69, 98, -89, 43, -72, 120, -81, 46, 10, -101,
+        74, -13, 74, 92, -73, 111, -125, -80, 65, -97, -103, 123, 87, -88, -49, -4,
+        96, 40, 50, 81, 72, 116, 85, 86, 100, 46, -9, 6, -63, -6, -42, -61,
+        -76, 28, 24, -8, 92, 18, -128, 119, -70, 8, 73, -88, 79, 8, 57, -8,
+        -75, 40, 99, -113, -62, 112, 52, 101, 14, 75, -6, -49, 107, 24, 54, 101,
+        9, 99, 59, 92, -42, -127, 126, 96, 26, 73, -90, -9, -36, 24, -6, 38,
+        -91, 3, -99, 49, 29, 104, -88, 5, 116, -67, 26, -97, -123, 85, -19, 103,
+        -23, 99, 22, 13, -24, -121, -78, 6, 116, 90, -43, -128, 46, -104, 6, -76,
+        -14, 57, -82, -5, 12, -85, -118, -49, -113, -26, -34, 52, -24, -27, -82, 27,
+        -12, 114, -41, 54, -67, -36, -75, -95, -105, -69, 62, -92, -105, -5, 120, 114,
+        -14, 64, -126, -78, -113, 104, 84, 127, 13, 71, 56, -123, 127, -73, 66, 9,
+        -105, 2, -27, -51, 126, 37, 34, -55, 82, 120, 64, 95, -53, 32, 107, -128,
+        -88, -10, 8, -43, -35, 59, 2, 57, 4, 61, 3, -122, 36, -5, 112, 93,
+        -47, -29, 93, -37, -12, 120, 111, 117, 104, 20, 0, 106, -47, -29, -23, -77,
+        -81, 106, -26, 118, 101, -51, -36, -125, -90, 110, 43, -119, 53, 49, -14, 105,
+        81, -81, 126, -101, 87, 110, -24, -49, 37, -35, -100, -119, -86, -104, -125, -102,
+        42, 37, 7, 95, 11, -30, -80, 87, 124, 83, -83, 41, -99, -2, -54, 117,
+        -31, 69, -91, -10, -89, 74, -43, -83, -11, -5, -97, -34, -40, 43, 86, -65,
+        -1, -55, -10, -3, -83, -4, 62, 83, 63, -34, -71, 123, 64, -4, 72, -7,
+        -12, 6, 83, 101, 107, 53, 109, -73, -67, 25, -96, -79, -91, 3, -73, -117,
+        -28, 116, -77, -29, -61, 62, 106, 1, 31, 75, -39, -125, 109, -79, 93, 76,
+        -4, -109, 96, -42, -45, 48, -104, -38, 66, 37, 78, 109, -22, 38, 21, -33,
+        -83, 86, 106, -46, 28, 15, -15, 112, -77, 74, 84, -73, 36, 120, -26, 71,
+        93, -107, -101, -88, 28, 12, 113, -38, 24, 12, 81, -13, -59, -101, 54, 69,
+        65, -76, -123, 108, -77, -60, 61, 4, 14, 55, -20, 36, 40, 88, -11, -99,
+        101, 16, 7, -106, 62, -83, -85, 12, -108, -13, -44, 26, -40, -46, 86, -7,
+        117, 127, -24, -24, 93, -53, -104, 124, 26, -45, -20, 86, -61, -14, 53, -60,
+        -29, -13, -105, 71, -20, -78, 45, -90, -31, 81, -5, -36, 20, -65, 111, 25,
+        60, -5, -61, 24, -93, 115, -38, 16, -63, -49, 8, -95, 87, -115, -39, 87,
+        -69, -29, -27, 96, 125, -11, 91, 94, -19, -101, -59, -27, -85, 5, -75, -72,
+        -77, 36, 97, -69, 37, -8, 94, -88, 5, -33, -117, 53, 76, -82, -126, 75,
+        77, -83, 52, 70, 37, -40, 20, 67, 46, -61, -28, -52, 94, -97, -65, -121,
+        107, 67, -34, 16, -30, 19, -23, 17, -97, 72, 79, 78, 82, -15, -119, -27,
+        -127, 79, 44, 57, -35, 80, 112, -13, -83, -36, -108, 80, -105, 40, -97, 70,
+        63, -21, 63, 69, 89, 101, -51, -45, -55, 34, 53, 76, 13, 93, -42, 76,
+        -105, 100, 47, -124, 20, 104, 19, -92, 60, 21, 85, 50, 76, 78, 67, -36,
+        -22, 21, -119, -77, -25, 36, -50, 70, 11, -10, 9, 32, -8, -55, 5, -25,
+        -88, -51, -5, -124, -29, -4, 9, -32, -5, 109, 59, -80, 85, 25, 77, -58,
+        -93, -7, -104, -89, 14, 88, -95, 92, -100, 5, -119, 95, -54, -77, -78, 40,
+        49, -75, 43, -50, -44, -70, -34, -67, 48, -7, -70, 11, -14, -127, -91, 115,
+        -72, -116, 70, -9, -99, 62, 126, -32, -94, 55, -68, 51, -84, -40, 86, 88,
+        -6, 58, -24, 13, 45, -19, 68, -93, -10, 86, 122, 107, 107, -57, 97, 11,
+        107, -32, 55, -76, -14, -101, 71, 2, -33, -124, 9, 62, 127, 48, 77, -97,
+        -20, 108, -37, 53, 3, 69, -92, 124, 39, 68, -27, -7, 32, 11, 120, 64,
+        -74, -54, -41, -121, -111, 31, -75, 43, -91, 54, -69, 66, -37, -102, 28, -43,
+        80, -92, 49, -37, 61, 67, 121, -74, 41, 43, -49, -94, 63, -92, 60, -45,
+        -71, -105, 37, 16, -90, 40, 33, -97, 123, 15, -108, -67, -94, -28, 118, 89,
+        -85, 45, -101, 83, 59, -95, 126, 15, 21, 109, -118, 57, 36, -45, 118, 48,
+        -107, -14, -14, 93, 69, 94, -66, 83, 4, -17, 51, -43, 96, 43, 12, 13,
+        82, 90, 26, -82, 81, -77, 34, -104, 99, 52, 97, 26, 118, 41, 7, -22,
+        87, -36, 122, -59, -127, -105, -79, -18, -106, -100, -128, 58, 106, -87, 83, -117,
+        69, -92, 24, -113, 0, 115, 108, -48, 49, -16, -128, 34, 108, 21, -44, 40,
+        -56, 7, 43, -52, -8, 21, 80, -26, 36, 103, 101, 87, -105, 115, -7, 57,
+        58, 107, 54, 98, 108, 18, 21, 31, -18, -28, -76, -79, 19, 119, 47, -80,
+        -10, 28, 112, 98, -84, 101, -17, -53, 17, 101, 2, -118, -12, -18, 1, 77,
+        -34, 91, -48, -28, 103, -119, 38, -17, 1, 77, 78, -38, 1, 23, 81, 88,
+        42, 2, 123, 1, -109, 119, -121, 61, -65, -2, 45, 23, -123, -51, 40, -36,
+        0, 97, -102, 68, -94, -46, 105, 9, -107, -50, 36, 42, -67, 67, 89, -4,
+        75, -69, -66, -119, -34, 29, 34, -48, -28, -10, 32, 70, 90, -116, 41, -85,
+        -123, 117, -21, -40, -50, 82, 78, 46, -32, -30, 89, -22, -86, 56, 117, -86,
+        46, 5, -19, 62, -16, 9, 125, -78, 13, 86, 30, -70, -43, 105, -113, -18,
+        -32, -117, -36, 38, -40, -14, 70, -20, -113, -40, -98, -101, -96, 63, -72, -71,
+        -72, 28, -36, 8, 73, -54, 21, 126, -32, 37, 91, 115, 17, -83, -14, -86,
+        -26, 67, 55, 70, -84, -54, 43, 97, 33, 124, -123, -45, 114, 31, 111, 107,
+        91, -31, -74, 80, -42, -84, -67, 4, -109, -73, 48, -114, -73, 48, -114, -73,
+        98, 28, 31, -68, 107, 28, -119, 28, -61, 7, 91, 111, 120, -113, -36, 117,
+        -34, 26, -61, -8, 32, -122, -15, 1, -121, 113, 1, 87, -30, 67, 80, 49,
+        92, -64, -53, -27, -74, 51, -79, 93, 19, 19, -68, -49, 110, -7, -8, -12,
+        17, 92, 31, 59, -126, 107, 49, -126, 107, 28, 1, 124, -86, 126, 8, -2,
+        109, 123, -46, -87, 25, -124, 88, 34, -39, -17, 3, 5, -55, -79, -47, -87,
+        -104, -5, 72, 16, 112, -69, -64, 122, 24, 122, 70, -16, -89, -35, -55, -55,
+        -82, 65, 42, 72, 70, 43, 36, 18, -76, -98, 79, -90, 126, -24, 123, 119,
+        110, 67, 31, -21, -29, -92, -114, -16, -1, 97, -26, 63, -80, 59, 121, 30,
+        100, -125, -80, -70, 84, -61, 121, -89, 82, -42, 104, 113, -33, 62, 112, 39,
+        31, -18, 1, -127, 96, 62, -88, -11, -106, -88, 87, -125, 111, -11, 56, -39,
+        112, 43, -50, -39, -83, -56, 62, -29, 55, 125, -46, -72, -60, -53, 62, -76,
+        -74, 59, 93, -65, -67, 19, -35, -54, -19, -112, 121, -52, 97, 85, -7, -58,
+        19, 102, 48, 64, 99, 108, -111, -58, -56, 77, 29, 120, -36, 14, 10, 121,
+        -79, 127, -84, 92, -20, 31, -51, -117, -3, 104, 5, 120, 38, -19, 91, -12,
+        21, -35, -6, 54, 116, 59, -116, 59, 5, 75, 67, -61, -100, -93, -117, -67,
+        -77, -125, -109, 112, -5, -1, -74, -78, 82, -58, -105, 102, -22, 74, 77, -87,
+        94, 86, 81, -90, -102, -10, -36, -48, 28, -7, -71, -87, 21, 36, -53, -22,
+        68, 15, 79, -83, 60, 78, -89, 100, 21, 89, -84, -29, -23, -83, 112, -29,
+        54, -3, 74, 117, 14, 90, -85, -52, -75, -123, -39, -10, 112, 43, -88, -12,
+        1, 30, 45, 94, -32, 121, -83, -19, -116, -84, 35, 66, 121, -104, 10, -42,
+        28, 21, -84, -53, 103, 56, -123, 46, -1, -112, 83, -88, -72, 102, -90, 65,
+        86, -81, 20, -110, -106, -65, -87, -41, 58, -96, -26, 116, 49, 79, -73, -126,
+        -77, -40, 125, 36, -113, 114, -74, 78, 65, -117, 47, 24, -22, 119, 45, 59,
+        -7, -12, 100, -83, -64, 113, 83, 60, -90, 74, -76, 108, -87, -73, 60, -62,
+        -9, -46, 14, 68, 24, 74, 26, -114, -57, 93, -45, -116, 15, 43, -1, -14,
+        70, -27, 95, 92, -89, -4, 43, -114, 87, -2, 121, -27, -20, 68, -102, -41,
+        101, -43, -27, 18, 8, -91, -127, -51, -41, -78, -28, 104, -55, -35, 51, 15,
+        -5, 66, -34, 2, -127, -65, -125, 127, -11, 20, -119, -73, -122, 47, -28, -83,
+        -12, -123, -68, 5, -106, -32, -127, -43, 21, 102, 112, -73, -122, 47, -28, 45,
+        103, 6, -92, -117, -49, 3, -70, 62, 10, -40, -69, 108, -38, -119, -125, 122,
+        -51, -101, 64, 15, -2, 46, -100, -100, -21, 117, 94, 40, 18, -66, -105, -95,
+        -21, -73, -122, -22, 43, 6, -20, 30, -22, -86, 47, -69, -5, 94, -90, -23,
+        25, -10, -125, 105, 80, -110, 30, 51, 85, -114, 42, 64, -24, -41, -75, 73,
+        91, -90, 77, -38, -103, -2, 116, -100, 121, -35, 9, 111, 62, 12, 80, -61,
+        122, 18, 65, 27, 106, -6, 81, -110, -79, 84, 93, -79, 15, -70, 95, 30,
+        -78, 71, -24, 42, 51, 69, -42, -51, 112, -75, 122, 48, 93, -83, -90, -4,
+        -66, -78, 37, 66, -16, 82, -18, -10, -116, -63, 34, -28, -111, 38, -67, 123,
+        5, -47, 118, 31, -32, 119, 119, 83, 68, 82, 37, 52, -100, 50, -65, 20,
+        -12, 123, -50, 107, 60, 86, -30, 49, -128, 74, 82, 23, 28, -1, -66, -102,
+        -30, -98, -57, -67, -105, 61, -53, 0, -8, -108, 7, -117, 78, -37, 17, -54,
+        -89, -103, 39, 60, -107, 96, 35, 112, -1, 17, 14, -28, -123, 61, -83, -88,
+        -98, -94, 90, 88, 104, -14, 29, -37, -23, 123, 83, -47, 57, 93, -106, -12,
+        74, 101, 87, 47, 11, -78, -36, 19, -111, -24, 49, 37, 112, 94, -89, 4,
+        -66, 113, -82, -128, -70, 105, 114, 16, -53, -101, 28, -60, -90, 82, 67, -77,
+        -128, -17, 44, -108, 118, 102, 1, 125, 99, -92, 106, 105, -127, 104, -56, 22,
+        -54, 16, 123, -76, 100, 97, -80, -18, -18, 6, -36, -92, 73, -61, 32, -123,
+        46, 91, -56, -91, 108, -63, 18, 97, -106, 81, 20, 73, -123, -94, 88, -110,
+        68, 97, 74, 18, -123, 25, 70, -32, 95, 4, -23, 1, 58, 64, -124, -22,
+        -34, -84, 30, -62, 124, -122, 2, -50, 35, 27, -52, -78, -121, -108, -102, -84,
+        48, -57, 41, -89, 13, -28, 121, 113, 86, -63, -88, 68, 97, -120, -122, 73,
+        -10, 16, -27, 94, -51, -53, -51, 10, -80, -39, -40, 48, 43, -81, -93, -105,
+        -73, -127, 78, -23, 78, -92, -107, -16, -5, 31, -33, 94, 49, -37, -42, -83,
+        55, -59, 72, -85, 64, -120, 7, -7, 96, -46, -51, 94, 79, -70, 44, 77,
+        -46, 75, 126, -99, 60, 40, -114, 27, 94, 3, -30, -98, -94, 114, 91, 38,
+        -112, -106, 101, -105, -63, -92, 123, 55, 72, -19, -23, -58, -30, -64, 73, 43,
+        -52, -3, 22, 99, -115, 118, -46, 6, 33, 74, 33, -4, -30, 111, -126, -72,
+        93, -108, -116, 118, 37, -45, -89, -77, 45, 20, -65, -12, -23, -55, 34, -77,
+        -92, 55, 67, -32, 14, 115, 24, 126, -18, -6, -8, -85, -13, 112, 54, -57,
+        -89, -50, 45, -4, -123, 69, -24, 76, -70, 75, -8, -75, -93, 95, 9, -4,
+        -70, -92, 95, 119, 103, 115, -31, -98, -97, -80, -48, 81, 55, 64, -99, 121,
+        111, -27, 83, 27, 6, -22, 61, 104, 89, 37, 15, 70, -32, 125, 43, -73,
+        -62, 8, -67, -69, -59, -48, -69, 40, -125, -27, -14, 4, 9, 45, -61, -111,
+        -4, -14, -125, -37, 78, 88, 64, 42, -15, 93, -13, -7, -34, 120, -2, -38,
+        124, -18, 84, 74, 42, 45, 74, 61, -106, -98, 46, -43, -109, -15, -5, 1,
+        3, -65, 97, -52, 48, 62, -54, -53, -70, 86, -16, 116, 91, -6, 94, -7,
+        121, 87, 25, -15, -82, 52, -89, 93, 83, 11, -77, 71, -29, 55, -116, -93,
+        -11, 123, 107, -20, -85, -43, 60, 52, -106, -5, -90, -9, -91, -89, 67, 59,
+        -77, -85, 127, 111, -4, -66, -19, -32, 90, -114, -67, -73, -19, 64, -37, 117,
+        47, -75, -37, 118, 3, -97, 25, 42, -117, -21, 43, 117, 97, -95, 105, 14,
+        50, 127, -73, 38, -77, 120, -61, 111, -53, 18, -128, -83, -4, -39, 16, 88,
+        126, 127, -76, 25, -101, -30, -31, 42, -7, 114, 4, 18, 31, 32, 10, 23,
+        -87, -72, 119, 76, 76, 92, 70, -30, -100, -102, 52, 21, 81, 95, -124, -59,
+        -101, -80, 104, 21, -19, -50, -2, 56, -38, -27, -54, -82, 82, -60, -89, -115,
+        -127, 109, 87, 22, 108, -69, 65, 108, 59, 15, 48, -11, 118, 14, -24, 88,
+        98, -42, 21, 96, -47, 85, -105, 48, -79, -60, -84, -78, 108, 23, -84, -98,
+        -119, 89, 55, -11, -104, -75, -28, 18, 38, 49, -20, -61, -97, -122, 97, 39,
+        48, -75, 123, -62, -80, -16, -85, 61, 57, 91, -32, 83, -5, 30, -2, -62,
+        -60, -37, 43, -64, -80, 11, -100, 62, -4, 74, -32, -41, -114, 126, -35, -99,
+        45, 4, 67, -62, 33, 62, 71, -120, -65, 20, 79, 19, -64, 47, 52, -44,
+        -29, 49, -20, -91, 29, -61, 110, 4, -122, -67, 13, 70, -86, 115, 121, -8,
+        -60, -121, -60, -13, -36, -2, -116, 72, -87, 92, -42, -74, -108, -43, -10, 75,
+        -49, -14, 105, 87, 126, 82, -11, 16, -83, -30, 82, -16, -79, -22, -17, -52,
+        86, -9, -43, 39, -19, 123, 91, -37, -77, 49, 11, 86, -29, -21, -38, 22,
+        -9, -43, 103, 115, -60, -120, 88, -67, -53, -74, -74, 101, 71, -94, -84, 91,
+        -123, -78, 46, 61, 36, -56, 119, 76, -77, -81, -69, -108, 50, -108, 53, 51,
+        124, 20, -28, -79, 106, -118, 103, 109, 24, -8, 60, 102, 101, -84, 23, -105,
+        -50, -50, 21, 17, 113, 63, -78, -108, 78, -66, -3, -19, 123, -10, -42, 91,
+        30, -41, -39, -5, -58, -50, -8, -89, -68, -69, -102, -9, -17, -8, -5, -28,
+        -72, -113, 93, 53, 126, -20, 45, -17, 108, 122, 92, 103, 111, 27, 59, -29,
+        -97, 50, 36, -117, -105, -57, 39, -105, 46, -121, 93, -76, 4, 88, -93, 8,
+        -13, -60, 52, 82, -92, -63, -70, 116, -66, -30, -106, -96, -16, -120, 20, 107,
+        -76, 66, -100, -113, -42, 85, -74, 105, 44, -112, 73, -52, 48, -4, 13, -80,
+        41, 81, 53, -11, -100, -19, 109, 57, 0, 93, -116, 38, -11, -104, 98, -18,
+        -126, 84, -11, -104, -40, -53, -27, 105, -73, -75, -100, 99, 50, -90, -25, -127,
+        -92, 123, 42, 42, 42, 102, -111, 42, -84, -45, 25, -77, 16, -95, -41, -23,
+        58, 74, -31, -112, -20, -60, 93, 57, -117, -42, 81, 126, -121, -31, 7, -72,
+        -7, 37, 70, -68, 28, 20, 122, 90, -127, -97, -94, 69, -15, -12, 20, 14,
+        -13, -38, -82, -71, -115, 60, 84, 12, 49, 32, 32, 13, 124, -104, 118, 87,
+        -52, -75, -30, -94, -89, 126, -93, 81, -45, -87, -45, -17, -98, -65, 58, 69,
+        -5, -39, 126, -57, 120, -29, -86, 87, -86, 117, -48, 27, -10, 59, 78, -65,
+        93, -86, -103, 89, 90, 67, 25, -84, -127, 89, -22, -75, -42, 121, 20, -63,
+        6, -76, 120, 14, -81, 60, -88, -1, 44, -113, 70, -112, 16, -61, -122, 17,
+        103, -103, -112, 117, 43, 118, -66, 110, 1, 88, -120, 57, -102, 119, 65, -26,
+        117, -83, 89, -104, -33, -74, -60, 125, 39, 37, -64, -21, 101, 116, 23, 1,
+        -70, -125, -27, -47, -29, -5, 44, -11, -8, -83, -99, -2, 105, -18, -15, -17,
+        -69, 42, -35, 27, 37, -90, -29, -79, 5, 92, -65, -74, -11, -63, -90, -128,
+        70, 25, 110, 76, 24, -114, -4, -112, 103, -85, -62, -48, -16, 27, 16, -47,
+        -100, -19, 78, -6, 113, -107, 99, -59, -16, 68, -126, -71, -118, -58, 102, -82,
+        -104, -105, -111, -112, 86, -98, 19, -94, 50, -118, -120, 82, 61, -26, 122, -4,
+        -110, -109, 19, 125, -1, -62, -22, -87, 36, -65, -50, -104, -19, 91, 26, 84,
+        34, 37, 101, 99, 36, 6, 81, 94, -73, -108, -44, 19, 87, 71, -32, -93,
+        -73, 113, 44, 67, 119, 81, -56, 39, -24, -86, 35, 106, -101, 67, 126, 122,
+        106, 45, -93, 112, -115, 67, 70, 125, 50, 92, 95, 75, 109, 92, -16, -3,
+        -49, -34, 84, 47, 8, -73, -97, -75, -32, 16, -58, -78, 64, 101, -78, -31,
+        43, 23, 94, -104, -3, 13, -53, -17, -3, -54, -9, -52, 26, -31, -10, -75,
+        57, -128, 97, -7, -67, 95, 26, 32, -49, -72, 38, 19, -124, 76, -35, -74,
+        -4, -67, 116, -67, 69, -128, 7, -69, 56, 115, -112, -6, -101, 13, 103, -99,
+        126, -44, -7, -58, 71, -29, -37, 70, 92, -103, 31, -127, 43, -31, 38, -120,
+        -25, 78, -15, 58, 88, -13, -92, -100, -59, 5, 6, -58, -55, -36, -57, 84,
+        6, -122, 70, -37, 16, -116, 27, 34, -94, 95, -53, -33, 62, -33, 122, -42,
+        -106, -52, -47, -42, 25, -25, 51, 106, -26, 50, 48, -26, 18, 15, 99, 54,
+        -105, -40, -35, -85, -100, -97, -4, 8, -91, -98, -6, 80, -30, 113, -116, -30,
+        47, -76, -108, 39, 97, 50, -35, 36, -31, 58, 82, 66, -69, 38, 94, 104,
+        29, 109, -41, 21, 59, -103, -104, 24, -98, -33, -120, -39, 81, 39, -106, -84,
+        99, -26, -64, 101, -35, -60, -65, 71, 50, -17, 68, 53, -62, -90, -103, 57,
+        80, 75, 25, -8, 94, 43, -103, 49, 87, 10, -54, 30, -63, -93, 101, -70,
+        -113, 51, -44, 15, 53, -55, -42, 59, 92, -72, -66, 23, 44, 14, 32, 25,
+        74, 72, -12, 9, 24, 27, -15, -5, 51, -38, -14, -75, -111, -108, 15, -37,
+        100, -119, -6, 38, -55, -62, 53, 124, -89, 88, -17, 96, -49, -59, 12, -36,
+        -77, -81, -38, -101, -63, -108, -80, -124, 90, -85, -113, -80, 30, -24, -116, -66,
+        2, 10, 111, -18, -31, -22, -8, -128, 124, -4, -62, -5, -51, -49, 57, -123,
+        -105, -87, -67, 6, -86, 48, -57, -11, -97, 121, -94, 87, -40, 32, -75, 18,
+        60, -95, 105, -78, -105, -118, -57, -103, -36, -89, 112, 54, -61, -104, -128, 81,
+        -38, 24, -61, -70, 28, 124, 105, -51, 98, -64, 64, -29, 31, -18, -31, -61,
+        -94, 7, -89, 117, 7, -52, 67, 20, -95, -21, 121, -53, -117, 72, 10, -4,
+        14, 75, 126, -64, -110, -18, 4, 56, 94, 65, -39, 0, 105, -45, -40, 71,
+        18, -123, -9, -111, -47, -57, 91, 44, 121, 86, 31, 40, 83, 52, -70, -8,
+        30, 10, -52, 30, -108, 91, -22, -51, 31, 9, -124, -19, -43, 7, 86, -74,
+        70, 77, -42, -62, 15, -107, -32, -9, 96, -92, 34, 30, 27, 83, -117, -69,
+        123, -119, 52, -93, -120, -8, 54, 93, -77, 88, -22, 13, 10, 88, -114, -94,
+        1, -21, 80, -42, -59, 74, -128, -19, 82, 32, 97, -107, 108, 117, 104, 125,
+        -13, -64, -52, -39, -113, -114, -6, 91, 73, -123, 90, 62, -91, 33, 44, 86,
+        -19, -15, 19, -9, 11, -7, 4, 62, 39, 0, 83, 84, 23, -128, -87, 8,
+        34, -117, 41, 125, 100, 51, -91, -49, 75, 85, -71, 115, 67, 57, 49, 54,
+        71, -13, -128, -73, 122, -128, -84, 94, -10, -103, 92, 37, -115, 22, 68, -101,
+        7, -6, 6, 118, 75, -124, -69, 35, -56, 48, -23, -106, 59, -120, 76, 31,
+        -51, -98, 114, -52, -124, 11, 50, 69, -79, 124, 34, 74, 28, -51, -47, 13,
+        -80, 31, 101, 108, 17, -127, 16, 7, -23, 112, 121, -111, 72, 67, -22, -41,
+        24, -92, 119, -72, 108, -73, -3, 101, -89, 35, -36, 105, -29, 67, -54, -35,
+        23, -43, -99, 56, 66, -19, 27, 89, -43, -66, 75, -82, -10, 93, -38, -44,
+        -66, -53, -67, -118, 91, 121, -108, -14, 119, -22, -63, 93, 92, 74, -112, 59,
+        -125, -21, -126, 5, -103, 83, -72, -99, 93, -26, -75, 21, 7, -27, -32, 82,
+        -22, 21, -70, -44, 120, -102, 45, -30, 34, -24, -111, 24, -85, -31, -124, -107,
+        24, 15, -116, -1, -77, -70, 72, 96, -26, 66, 35, -76, 18, 6, 106, 115,
+        19, 42, 12, 30, -88, -100, -9, -105, -20, 55, -106, -34, -54, 51, -64, 10,
+        -19, 32, -25, -100, 40, -40, -119, 95, 116, 97, -30, 66, -74, 0, 123, 0,
+        91, -88, -25, 8, -106, -7, -98, -35, 73, -39, 22, -92, 78, -99, -72, 44,
+        -85, 19, 87, 30, 39, -82, -3, -88, -52, 55, 13, 119, 26, 23, 68, 108,
+        -52, -50, -32, 60, -4, -115, 89, -32, 27, 79, 40, -25, -128, 43, 35, -67,
+        -2, 30, -128, 9, -56, -93, 89, 118, 119, 61, -61, -32, 1, -124, 108, -52,
+        57, -48, -44, 24, 26, 26, -42, -66, -127, -85, 115, -55, -108, -118, -74, 42,
+        -20, -43, -80, -2, -107, -97, -17, -123, -16, -81, -124, 104, -67, 91, 56, 54,
+        50, -85, -18, -62, -53, -48, 119, 10, 53, 28, -80, -22, -73, 12, 67, 61,
+        78, -73, -2, -62, -101, -18, 48, 126, -116, 119, 123, 40, 26, -81, 56, 87,
+        -8, -119, -106, 22, -92, 75, 116, 70, -111, -14, 38, 64, 12, 44, 61, -110,
+        32, -109, 2, 118, -123, 104, -42, 71, -48, 26, -83, -58, -98, 25, -64, -51,
+        98, -2, -59, 34, -11, 53, -62, -82, -82, -120, -66, 44, -104, 49, -64, 112,
+        -94, -19, -77, -87, -121, -18, -115, 57, 89, 50, -39, -69, -58, 21, -43, -43,
+        41, 12, -100, 71, 84, 123, -43, -55, -112, -24, 47, 77, -20, -53, 66, -6,
+        -15, -61, 123, 25, -12, 7, -22, 117, 30, 97, 78, 41, 96, 60, -100, -53,
+        32, 106, -114, 14, -56, -121, -59, 3, 38, -2, 8, -45, 124, 7, -12, -10,
+        -83, 39, -74, -20, -46, 69, 3, -51, -122, 47, -93, 117, -85, -64, 73, -38,
+        -83, -84, -122, -83, -83, 13, 75, -114, -56, 62, -27, 62, -14, 80, -38, 122,
+        35, 26, 18, -41, -108, 69, 53, -95, 52, -106, 99, -67, -49, -14, 59, -40,
+        -24, 3, -81, -39, -34, 12, -82, 96, 117, -82, -126, 86, -114, 28, -13, -7,
+        -85, 87, -34, 11, -11, 79, -49, 109, 85, -105, -123, 33, -99, 91, 15, 51,
+        35, -47, -17, 31, -93, -83, 115, -27, 14, -81, 124, -107, 93, -27, -54, 53,
+        95, 79, 92, -128, 13, -11, 122, 2, -12, 20, -48, 86, -52, 22, -41, -23,
+        -87, 61, -41, -126, -39, 83, 124, 121, 60, -28, 110, -27, -126, -32, 96, -4,
+        -56, 72, -121, -102, -73, -123, 74, -69, 96, 67, 76, 15, 62, -59, -66, 46,
+        -35, -74, 85, -82, -60, 121, 36, -22, 26, 53, 64, 11, -90, 122, -14, 51,
+        76, 61, 68, 7, 12, 15, -106, 38, 43, -40, 9, 35, 5, 32, -91, 69,
+        -118, -44, 15, 34, 94, -34, 7, -32, 5, -37, 65, -79, -49, -38, 65, -18,
+        -123, 84, 52, 117, -9, 44, -116, -74, -102, -62, 14, 35, -21, 16, -41, -57,
+        110, -14, 98, -109, -88, -85, -66, -100, 17, -66, 114, -29, 15, -81, -69, -101,
+        -76, 88, -58, -13, -75, -45, 106, -71, -24, -48, -117, 70, 40, -16, -45, 107,
+        -2, 66, 112, -83, -91, -85, 55, 79, -64, 17, 46, -96, 116, 61, 76, 52,
+        -14, 63, 19, -32, 66, 56, 111, -115, -50, 103, 81, 59, -92, -75, -117, -103,
+        -70, -114, 39, -39, -31, -56, -77, -73, -89, 42, 36, -83, 102, -81, 66, -15,
+        -86, -40, -61, -47, 115, 52, -54, 59, 83, 7, -9, 42, -69, 91, 37, -47,
+        58, -102, 113, -29, 94, -53, 4, 14, 8, 9, -41, 58, -50, 4, 120, 16,
+        -29, 118, 66, 87, 127, 19, -17, 53, 70, -32, -22, 79, 21, -52, -30, -51,
+        -16, 25, 119, 4, 57, -70, -30, 104, 113, 102, 81, 6, 1, 18, 111, -54,
+        45, 38, -48, 125, 35, 14, 16, -66, -105, -22, 30, -109, -104, -90, -101, 73,
+        48, -109, -21, 118, -34, 101, -100, -85, 100, 87, -31, -30, 46, 23, 126, 102,
+        -20, 102, -26, -124, -64, -8, -48, -17, -53, 116, -70, -60, -96, -34, 119, -15,
+        108, -106, 0, 83, 38, -103, 76, -39, -46, 100, 105, -87, -62, 27, 64, 117,
+        -55, -50, 86, -123, -67, -47, 4, 8, 102, 74, -79, 82, 11, 118, -65, -72,
+        67, 107, 49, 90, 37, 90, 95, -24, 27, -6, -10, -53, 55, 116, 96, 104,
+        70, 88, 21, -68, 92, 48, -90, -114, -107, 113, 35, -38, 76, 79, -88, 115,
+        12, -117, -57, 47, -112, 26, -42, 80, -21, -120, 91, -48, 31, -49, 44, -102,
+        93, 99, -59, -17, -94, 69, -100, 82, -14, 27, -128, 41, 89, -6, -3, 38,
+        23, -55, 113, 102, 89, -70, -47, 4, 17, 13, 124, -28, 42, -114, 88, 109,
+        -66, 1, -84, 125, 34, -28, -89, -8, 17, 41, -37, -117, -19, 100, -61, -80,
+        -90, 92, -45, -93, -16, -92, -108, 92, 100, 63, 15, 1, -101, 33, -116, 41,
+        -123, 112, 92, -27, -34, -68, -40, -22, -42, -64, -10, -113, -92, 19, -97, -125,
+        114, -121, -128, -75, -76, -9, -97, 2, 75, -73, 80, -91, -123, 76, 115, -120,
+        -47, -85, -111, -106, -114, -85, -101, -49, 120, -28, 57, -36, 13, -105, -23, 34,
+        -119, -126, -81, -66, -31, -2, 68, -86, 72, 74, -36, -30, -70, 85, -115, -46,
+        25, 85, -19, -44, -42, 40, 48, -91, 37, -43, 113, 75, -32, -122, 95, 56,
+        -94, -39, 95, -52, 65, 105, 43, -58, 102, 72, 107, 92, 93, -93, 110, -17,
+        -107, 26, -108, 46, 0, -24, 56, -91, -59, 40, 86, 97, 126, -117, -64, 32,
+        96, 16, -72, -47, -72, -106, 63, -101, 36, 27, 17, 117, -113, 64, -118, 62,
+        111, 27, -109, -14, 38, -113, -101, 97, 18, -23, 66, -23, 76, 78, 29, -93,
+        52, 87, -26, -124, -62, 27, -105, 67, -8, 104, -84, -107, -31, 55, 84, 17,
+        18, 85, 55, 112, -57, 1, 52, -29, 42, -79, -92, 81, 95, 36, -23, -48,
+        -77, 57, -105, -91, 105, -126, -88, -124, 126, 69, 104, 27, 27, 11, 14, 115,
+        -61, -64, 66, 106, 85, -46, 12, -49, -87, -85, -5, 97, -64, -17, 65, 53,
+        53, -12, -70, -108, -5, 121, -117, 92, -29, -57, 12, 67, 71, 58, -21, 81,
+        46, -45, 83, -63, -76, 83, 57, 2, 87, -92, -122, 118, -118, -96, 31, 117,
+        94, -95, -76, -51, -102, -24, 49, 98, 43, 43, -83, 49, -40, 51, 79, 120,
+        27, 87, 104, 25, 120, 41, -46, -39, 80, 59, 107, 13, -41, 107, 77, -62,
+        -23, -83, 113, -56, -16, 28, 118, 87, 92, -47, 125, 114, -46, 90, 101, 73,
+        8, 88, 38, 10, -91, -74, 73, -30, 102, -114, 40, 41, 97, 32, -42, 18,
+        -39, 81, -28, 58, 43, 57, 9, 102, 43, 74, -44, 10, -87, 76, 69, -127,
+        121, 66, 78, -51, 69, 75, -58, -18, 89, 1, -124, 16, 17, 96, 75, 24,
+        110, -61, 104, -122, 78, 6, -11, 75, -3, -99, -119, 79, -106, -127, -113, 117,
+        105, -123, 125, -4, -20, -103, 92, 57, -105, 123, 74, 31, -45, -108, 120, -101,
+        -40, -50, -37, 72, 119, 6, -116, 38, -62, 109, 86, -29, -26, -56, -124, 100,
+        -55, 106, -62, 81, 77, 11, 116, 90, -109, 107, -67, -127, -66, 55, -121, -6,
+        -34, 64, -33, -45, -90, -59, -81, -5, -46, 6, -74, 100, 86, 119, 110, -39,
+        -46, 76, 121, -46, 15, -119, 99, 46, 100, 114, 38, -123, 118, -72, 39, -11,
+        -86, 30, -115, 78, 55, -59, 58, -69, 35, 26, -101, 92, -11, 109, 55, -59,
+        36, -80, 93, 66, 104, 38, 23, -52, 59, -42, 38, -89, 43, 111, 23, 76,
+        58, -10, 102, -89, -28, -66, -33, -94, 81, 86, 33, -116, -127, -20, 3, -113,
+        -55, 116, 21, -25, -45, 36, 42, 77, -53, 29, 60, 40, 105, -124, 126, -45,
+        -95, 96, 66, -65, 25, 121, 40, -2, 102, -20, 58, -111, 30, 94, -61, -93,
+        107, -6, -83, 117, 30, -90, 5, -45, 85, 80, 108, 63, -111, 73, -125, -103,
+        51, -55, 35, 123, -103, 79, 11, 39, 67, 71, 43, -127, 25, 53, 116, 109,
+        -57, 65, 44, -58, 57, 67, 57, 41, -97, 39, 125, 13, -71, 76, -2, 97,
+        -28, -5, 28, 41, 15, -66, -9, 90, -34, -117, -106, 43, 30, 119, 94, -53,
+        125, 81, -32, -114, 58, -86, 112, 69, 98, 98, 57, -46, 91, 41, 101, 103,
+        82, -101, -44, -75, -110, 76, 36, 43, 23, -62, 10, 45, 17, -53, 117, -102,
+        70, 122, -76, 121, 91, 91, -17, 113, -103, 37, 73, -10, 64, -28, -75, -71,
+        -127, 30, -33, -81, -46, -26, -79, 77, 51, 119, 80, 8, -27, 106, 71, -25,
+        -55, 5, -7, -28, -33, -85, -121, -49, -2, 78, -92, 58, 19, 115, -68, 20,
+        58, -93, -42, 60, 7, -38, -3, -65, 15, 33, -53, -91, 53, 44, 42, 17,
+        20, 14, -37, 44, -15, 59, 85, -109, -37, -42, -90, 18, -44, -92, -100, 94,
+        99, 98, 63, 2, 57, 30, -126, -78, 66, 97, 9, -75, -93, 81, -74, -76,
+        -108, 77, -85, 101, -125, -118, -62, 37, -74, -23, 90, 98, -69, -102, 69, -30,
+        82, -116, -4, 52, 83, -9, -42, 76, -36, 91, -117, -61, -23, -15, 94, -104,
+        68, -59, 17, 18, -4, -40, 42, -63, -97, 113, 9, -2, -52, 38, -63, -97,
+        -19, 73, 78, 48, 67, -121, 7, 88, -82, 41, 44, -113, -109, 6, 75, -73,
+        -67, -122, 118, -80, 46, 73, -69, 6, 83, -61, -21, 1, -69, 44, -106, 23,
+        105, -119, -100, 110, 47, 59, -87, 15, -1, 121, -85, 32, -81, 19, 82, -49,
+        -68, 66, 30, 30, 117, 53, -30, 71, -71, 56, 9, 126, -18, -47, -76, 84,
+        24, 61, -14, -117, -112, -70, -62, -124, -58, -128, -70, 11, 35, -41, -16, 92,
+        8, 76, 77, 70, -75, -62, -18, -72, -61, 74, 17, 124, -53, -81, 20, 90,
+        50, 17, -13, 124, -58, 34, 33, 113, 108, 51, 96, -79, 38, 41, -58, -3,
+        -61, -108, 36, 47, 108, -82, -121, -26, 25, -20, -82, -77, -73, 104, -75, 123,
+        21, -94, -90, 8, -67, 18, 113, 117, 58, 10, -35, -51, 92, -90, 117, -103,
+        112, 4, -54, -60, -53, 61, -17, 55, -118, -66, 17, -38, 18, 109, 76, -68,
+        -98, 55, -45, -88, -68, 102, -59, -53, 46, -88, -83, 56, 8, 117, 85, -53,
+        -60, -37, 65, -73, -20, -82, 54, -28, -57, 19, 43, -58, 117, -67, 59, -111,
+        -113, 4, -86, -112, -128, -35, 123, 100, 16, 25, 34, -40, -76, -4, 13, 7,
+        80, -59, 0, -75, -4, 84, -106, -55, -35, -80, -56, -54, 89, 29, 2, -99,
+        22, -121, 29, -82, 8, 120, -60, -75, -39, -7, -67, -3, -96, -123, -92, 121,
+        5, -25, 61, 61, 53, 18, -123, 15, 64, 62, -47, -5, -113, -39, 21, -108,
+        69, 69, 28, -14, 72, 13, 2, -73, 27, 56, -35, 70, -43, -99, -95, -15,
+        86, -69, -2, 2, 86, 72, -97, -119, 118, 60, 39, 109, 111, -50, -50, -35,
+        18, -13, -25, -6, 117, 116, 5, -59, 8, 120, -42, 48, -83, -44, 103, -69,
+        68, -118, -100, -99, -1, 9, -125, 118, -67, 5, -95, -105, -119, 76, -97, 73,
+        -63, 38, -54, 50, -109, -89, -89, -72, -86, 45, -80, 82, -62, -61, -118, -112,
+        -124, 17, -115, 61, -41, 39, -125, 24, -25, 54, -40, -100, -107, -24, -46, -8,
+        -128, -50, 1, 22, -16, 54, -24, -69, -90, -92, -27, -74, -83, 63, 122, 53,
+        -97, -43, -21, -120, -32, -52, -102, 124, 7, -51, 45, 27, 39, 1, -9, 57,
+        -13, 124, -100, 120, -113, 117, 24, 81, 8, 26, 40, 77, -109, 56, 25, -104,
+        -45, 9, -79, -78, 42, 72, -88, -32, 7, 81, 121, -54, -45, 52, 69, 84,
+        5, -18, -121, 15, 89, -31, -65, -20, -111, -121, -65, 62, 15, -65, 50, 51,
+        -113, 41, 70, 110, -104, -91, 57, -53, -54, 7, 13, 103, -101, -36, -113, -97,
+        -103, -85, 105, -17, -6, 127, -54, 84, 113, -48, 42, -5, -82, -65, -106, 10,
+        -13, 67, 83, -63, 65, -33, -18, 53, -36, 87, -111, -30, 108, 87, 97, 58,
+        123, -97, 94, -63, 56, 110, 13, -14, -24, 101, -11, -100, 77, -70, 83, -84,
+        -58, 118, 29, 90, 83, -93, 104, -90, 89, -85, -52, -12, 68, 74, -6, -123,
+        -116, 24, 57, -102, -87, -92, 81, -64, 66, -21, -64, 97, -83, 32, -93, -42,
+        -52, 88, -4, -22, -46, 103, 29, 29, -89, 87, -109, 22, 11, -30, -10, -95,
+        -69, -11, 110, -32, -33, -99, 119, 69, -106, 99, -27, -29, -47, 110, -3, -91,
+        -123, -121, -110, -89, 126, 58, -26, -52, -33, -63, -30, 98, -45, -113, -39, 13,
+        80, 65, 84, 120, -127, 20, -125, -120, -52, 27, 55, 105, -110, 6, 114, 125,
+        -34, -62, -63, -69, 10, -34, 86, 8, 23, 30, -13, 28, 99, 118, -12, -58,
+        -34, -93, -82, 67, -102, 121, 15, -88, 8, 96, -40, -28, 67, 96, -98, -82,
+        -73, 22, -39, 51, 0, -43, -11, -111, 73, 104, 1, 76, 62, 114, -94, 66,
+        8, -29, 47, -31, -22, -72, 97, -94, -10, -85, 102, 41, -69, 109, -54, -11,
+        2, -9, -26, -38, 82, -10, -98, -82, -1, -55, 20, 48, -51, -11, 89, 37,
+        77, 86, -1, -127, -111, 8, -41, 34, -14, -83, -83, 121, -35, -11, -1, 46,
+        104, -82, 109, -46, 0, 31, -67, 119, -18, -2, -29, 33, 109, 57, -46, 63,
+        -76, -56, -83, 10, 21, 82, -51, -110, 119, 114, -14, -78, 31, -24, -121, -121,
+        95, 8, 0, 44, -57, 127, -88, 67, 25, -10, -32, 115, -68, 9, 91, 44,
+        51, 113, 93, 112, -32, 94, 56, -5, -10, -21, 94, -69, 85, 8, -27, -85,
+        -50, -34, 18, -18, -65, 118, -9, -5, 106, 126, -55, 102, 91, 61, -59, 20,
+        125, -111, -75, 94, -4, 39, 88, -21, -59, 127, -60, 90, -113, -9, -63, -39,
+        64, 116, -67, 82, 4, 30, -79, -50, 122, 111, -116, -58, -117, -114, 52, 1,
+        -116, -101, 76, 0, -19, 60, 60, 93, 9, -60, -119, 93, 38, 15, -31, -82,
+        120, 122, 114, -114, 90, 70, -50, -44, 0, -102, -3, -45, 70, -1, -68, 46,
+        43, 106, -46, 26, 63, 68, 11, 15, -83, 20, 15, 23, -70, -86, -96, -52,
+        -125, 105, -6, 9, -67, -102, 95, 83, -114, 54, -14, 100, 57, -89, 21, 101,
+        -58, -93, 66, -37, 81, -41, -92, 60, -76, 32, 83, -20, -107, -96, 65, -56,
+        -101, -63, 44, -14, -118, 82, -63, 69, -71, -73, -22, 68, -12, -22, -99, 114,
+        117, -1, -64, 123, 84, -70, -57, -70, 60, -60, -80, -2, -93, -84, 16, 97,
+        59, 123, 109, 126, 116, -88, 86, 73, 91, -17, 14, -42, 116, 125, -8, -25,
+        -62, -84, -114, 46, 50, -74, 6, 60, -112, -84, -84, -57, 58, 112, 49, 96,
+        -66, 32, -30, -11, 62, -62, 82, 81, -89, -37, -21, -101, -122, 31, -105, -7,
+        -108, 34, -112, 103, -92, -7, -113, 42, 80, 4, -17, -113, 10, 22, -51, -108,
+        29, -62, 42, -101, -37, 96, 79, 12, 27, -20, -100, 116, 51, 3, -121, -59,
+        -19, -118, 92, 32, -57, -23, 87, 65, 89, 3, -94, 32, 102, 16, -45, -99,
+        -95, 82, 82, -104, -33, -121, -104, -24, 11, -19, -19, 46, -30, -54, 54, 118,
+        98, 31, -2, 27, 36, 54, 122, 24, 45, -19, -85, 68, 39, 37, -53, 49,
+        -63, 41, 11, 82, -14, -128, -116, 35, -58, -10, -33, 33, 113, -88, 65, 119,
+        94, -38, 125, 47, -44, -118, 37, -56, -27, 7, 64, -50, -84, -34, 41, 87,
+        -9, 15, -68, 103, -94, -115, 41, -102, 88, 113, 30, 125, -122, 70, 101, -82,
+        -57, -4, 39, 96, -59, -122, 107, 105, -29, 64, -49, -98, 90, -107, 40, 44,
+        -128, 86, -121, -123, -43, -55, -40, 81, -34, -115, -57, 110, 55, -100, 3, -10,
+        -70, 76, 18, 71, 55, -59, 32, -74, 22, 35, 45, -22, -124, 42, 103, 21,
+        43, -59, 6, 117, -101, -22, 92, -80, 14, 102, 78, -14, 76, 50, 95, -40,
+        105, -108, 76, -38, 82, -99, 71, -33, 99, 102, 40, 60, -119, 73, -19, 73,
+        92, -42, 90, -107, -32, 34, -95, -120, 75, 77, 60, 65, 15, -128, 77, -37,
+        9, 59, 27, -9, 52, -31, -21, 101, 114, 59, -28, 26, 93, 96, -107, 2,
+        -85, 44, -126, -88, 83, 96, 44, 102, 7, -2, -70, 80, -126, -78, -59, 102,
+        112, 90, 112, -8, -103, -23, 91, 106, 73, -84, 74, -46, 7, -68, -67, -34,
+        -25, -15, -94, -27, 101, -91, -99, -57, -128, 55, -50, -79, -33, 10, -43, -73,
+        96, -67, -118, -113, 121, 56, -67, -123, 123, 77, 65, -120, 92, 35, 0, -64,
+        8, 35, 126, 124, -55, -96, -68, -26, -83, 82, -104, 69, -79, 27, -115, -23,
+        4, -59, -19, -60, -45, 53, -123, 58, 95, -73, 30, -73, -99, -29, -8, -81,
+        -31, -41, 24, 42, 52, -41, -55, -6, -20, -82, -5, 1, 8, -68, -100, 115,
+        72, 78, -85, 107, -109, -95, -123, -49, 16, -96, 1, 53, -47, -67, -117, 80,
+        10, 73, 38, 57, -88, -80, 89, -25, 27, 58, 67, -71, -106, -49, -42, -41,
+        102, -18, 10, 27, 43, 115, 96, 24, 15, -4, -121, 4, 119, 85, 72, -54,
+        -65, -37, 93, -119, -28, -60, -114, 77, 0, -40, 114, 7, 76, 60, -71, -54,
+        51, 32, 94, 112, -72, 92, 83, -126, 86, 111, -119, -109, 121, -122, -62, 100,
+        109, -35, 82, 109, 71, 90, 115, 24, -117, -56, 65, -115, 46, 58, -117, 6,
+        16, 112, 7, 40, -31, 47, 119, -39, -14, 88, 78, -92, -70, -71, 123, 108,
+        117, -124, 7, -101, -106, -83, 76, -85, -81, 73, -20, 92, -44, -25, 123, 73,
+        77, -59, 80, -43, 25, 68, -88, -59, 54, 79, 68, 104, -78, -3, 33, 23,
+        108, -48, -119, 40, -32, 68, 124, -11, 13, -30, -48, -124, 110, 6, 0, 36,
+        -72, -105, 40, -118, -28, 99, 46, 16, 80, 121, -12, 62, 95, -95, -67, -37,
+        64, -77, -62, 16, -119, 48, -77, 74, 45, 121, 48, 59, 115, 121, -44, -110,
+        -26, -14, 76, 45, -47, -100, 73, -13, -113, -43, 36, -42, 77, -124, 93, -85,
+        101, -60, 104, 52, -124, 71, -36, -84, -57, 122, 99, 58, -79, 10, 8, -96,
+        -83, 32, 59, -128, 106, 17, -41, 124, 17, -93, -50, 90, 23, -71, -61, 47,
+        82, -4, 27, 57, -14, 88, 55, 77, 30, 96, 119, 44, 34, -69, 70, 36,
+        -94, 35, 88, -56, 41, 59, 110, -49, 1, -25, 23, 48, 43, 89, 26, 124,
+        -72, 62, 117, -14, -50, -73, 104, -32, -15, 87, 116, -77, 8, -37, -15, -128,
+        94, 76, -93, 56, 113, 82, -9, 117, -119, -28, 105, 55, 27, 50, -43, 90,
+        -58, -112, -109, -59, -97, -45, 21, -93, -70, -116, 65, 86, -65, -43, 41, 125,
+        76, 56, -124, -56, 73, -89, 114, -46, 24, -39, -125, 11, 97, -37, -59, 41,
+        -21, 55, 43, -100, -52, -91, 104, 31, 92, 34, 43, -34, -64, -35, -113, 111,
+        102, -10, 54, -119, 75, -111, -93, 45, 109, -32, -51, -58, 38, 2, -106, -35,
+        120, -78, -103, 23, 105, -38, -54, 20, 67, -88, 125, 65, -69, 28, 85, 51,
+        -31, 107, -104, -33, -80, -17, 99, -4, -5, 81, -21, 93, 11, 19, -112, 120,
+        -83, -53, 22, -112, -102, -123, -41, -13, -26, 94, 31, 35, 25, 10, -93, 71,
+        37, -67, -114, 52, -7, -6, 104, 44, -48, -14, -60, 27, -75, -34, -74, -68,
+        77, 119, 11, -1, -19, -88, 31, -3, -117, -6, 111, -20, -69, -25, -83, -96,
+        -26, 10, 107, -66, -27, 95, -2, -67, 5, 52, -46, 111, 25, 44, 71, -21,
+        69, -53, -11, -123, -68, 63, -86, 23, -10, 55, -114, -60, -74, 6, -4, 91,
+        -58, 119, -76, -122, 90, -79, -95, 32, 53, -76, -87, 71, 58, 91, -3, 106,
+        56, 91, -107, -11, -92, 76, 115, 122, -75, 54, 84, -89, -46, 40, 8, -77,
+        121, -54, -33, 41, -36, 90, 41, 94, -58, -92, 55, -17, 105, -96, -83, -116,
+        84, -68, -86, 53, 51, -58, -3, -70, -68, -61, 12, -75, -80, -42, 47, 9,
+        -91, -89, -62, 20, 90, 122, 50, 33, -21, 32, 10, -71, -114, 83, -39, 12,
+        -91, -12, -39, 119, -31, 86, -117, -59, 25, 89, 20, 15, 0, -18, -45, 51,
+        7, 40, 64, -105, -37, -75, -96, 35, -44, 66, -88, 74, 55, -90, -67, -60,
+        -108, 36, 91, -101, -25, 88, 73, -76, -46, 44, -115, 90, 101, -118, -57, -22,
+        87, 33, -95, -93, -117, -28, -26, -15, -2, 24, -10, 118, 36, -116, -37, -37,
+        22, 87, 25, 31, -84, -72, -60, 81, -103, 31, -41, -21, 109, 58, -45, -74,
+        -68, 85, -85, 125, -38, -83, 124, -47, -72, -18, -36, 91, 120, 9, -39, -8,
+        48, 93, -17, -54, -35, -25, -12, 99, 3, 72, -88, 19, -52, -10, 82, -19,
+        127, -77, -126, 97, -77, -80, -84, 84, 33, 23, 63, 50, 5, -48, 86, 59,
+        -119, -93, -43, -1, 38, 16, -121, -57, 8, 102, 59, 84, -89, -27, 53, -101,
+        -118, 0, -31, 39, -51, 37, -122, -6, 3, -32, 39, -61, -120, 68, 123, -9,
+        89, -81, -8, 25, 43, 86, -51, 75, -114, -78, 47, -30, 22, 40, 57, -7,
+        111, 11, -103, -44, -96, -48, 101, -113, 92, 63, 28, -56, 95, 3, -103, -71,
+        73, 97, 123, -19, -74, -8, 60, -56, 2, 21, -80, -120, -94, -44, 51, -103,
+        -10, -80, 108, 118, 11, -101, -17, -21, 21, 6, -20, -88, -15, 34, 9, 9,
+        51, -67, -124, -117, -104, 23, 122, 25, 19, 35, 15, 82, -3, -77, -76, -85,
+        -14, -69, 6, 87, -88, -60, -51, 70, 53, 110, 22, 32, -54, -92, -40, -97,
+        98, 6, -62, -83, -47, 34, 101, 67, 62, -60, 116, -41, 124, -79, -104, 63,
+        -36, 84, 62, 27, 67, 86, 69, -38, -104, 85, -95, -112, 125, -53, 66, -126,
+        25, 12, 86, 37, 43, -15, 1, 56, 49, -80, 97, -90, 100, -39, -32, 64,
+        41, -128, -31, -90, -94, -116, 64, 21, 68, -20, 26, 22, 100, -70, 121, 69,
+        111, 12, -17, -96, -23, 92, -83, -92, -8, -34, -36, -45, -95, 1, 58, 33,
+        70, 13, -21, -88, -29, -65, -27, -40, 77, 40, 28, 18, 111, -25, 47, 117,
+        79, 116, -34, -126, 91, -3, 51, 83, 127, -18, 108, 94, -43, 69, -120, 13,
+        -55, -108, 94, 98, -86, -85, 17, 22, -70, 14, 2, 109, 63, -74, -121, 4,
+        -22, -14, 20, 74, -7, 61, -23, -6, -99, 45, -39, 42, -118, 77, 86, -13,
+        -103, 4, -38, 20, -121, -58, 60, 88, 85, 49, -111, 118, -1, 27, -65, 84,
+        -26, -35, 91, 23, 99, -62, -26, -68, 58, 48, -25, 84, -97, -88, -126, 62,
+        77, 59, -62, 87, 68, 127, 87, -42, -53, -24, -17, 88, 17, 26, 18, 28,
+        -65, 72, -52, 2, 65, 44, -46, -67, 116, -27, 47, 20, 63, -99, -109, -5,
+        19, 32, -49, 122, -60, -87, 57, -101, -56, 88, -30, -125, 112, 88, -44, -32,
+        -125, -68, -116, 15, -28, 37, 17, 118, -103, 29, -33, 79, 56, 126, -109, 53,
+        -52, 105, 51, -31, 118, -24, -12, 77, -20, -31, -25, -10, -29, -127, 49, -105,
+        117, 120, 38, -109, 99, -29, 4, 11, 3, -27, -36, -58, 36, -1, -41, 38,
+        -54, 119, -52, 48, 5, -120, 1, -125, -117, -81, -62, 88, -6, 7, -6, -32,
+        91, 48, -120, -47, -91, -83, -126, -123, 92, 39, 70, -30, 53, 4, 74, 80,
+        -84, 56, 48, -2, -56, -120, 103, -13, 23, 21, -108, -127, -95, -67, 44, -120,
+        36, -105, 113, 120, 34, -38, 11, 13, -15, 12, -94, 42, 30, -120, -68, 4,
+        -65, -55, 93, -47, 50, 20, 99, 82, 40, -115, -85, 12, -99, -114, -41, 65,
+        36, -33, 97, 52, -107, -44, 120, 23, -105, -38, -15, -37, 29, -56, -102, -96,
+        112, 77, -96, 42, 49, -75, 71, -35, -56, 86, -127, -127, 4, -30, 26, -108,
+        -89, 50, -53, 29, 7, 94, -125, -72, 1, -94, -92, -38, 68, 59, 19, -80,
+        98, -123, 23, -118, 24, -2, -71, 93, -22, 114, 12, 48, 8, -46, 65, -6,
+        1, -26, -88, -110, 40, 93, -56, 125, -109, 86, 103, 36, -48, 23, -5, 9,
+        -48, -86, 53, 82, -120, 5, 125, 64, 104, -36, 13, 26, 83, -103, 121, -93,
+        11, 3, 80, -15, 95, 125, -45, 59, -85, 89, 61, 76, -70, 61, 72, 47,
+        106, -34, 14, 82, -96, -97, -71, -115, -54, 31, -74, 96, -14, -114, 112, 85,
+        105, 103, -89, 41, 69, 26, -86, 90, -2, -58, -54, 71, -111, -31, 119, -54,
+        3, 27, 3, -5, 22, 3, -5, 102, 99, -77, 76, 19, 62, 114, -77, 75,
+        105, -97, -81, -72, -97, 89, -91, 8, 19, 111, 87, -21, 13, 36, -15, -22,
+        106, -78, 25, -85, 12, -24, 112, 32, 41, -49, -16, -4, -5, -93, 16, 9,
+        -101, -5, -78, 15, 123, 88, -4, 97, -119, 34, -48, -113, 101, 40, 69, -92,
+        117, 23, -34, 70, 55, 40, -6, 124, -65, 97, -55, -14, -24, -108, -47, -116,
+        -101, 101, -112, -87, 41, -125, 100, -30, 63, -62, 115, -117, 70, 97, 36, -22,
+        -123, 98, -46, -47, 32, -73, 88, 96, 90, 106, 27, 94, 34, 60, 68, 27,
+        66, 1, 125, -100, 71, 125, -96, 104, 103, -92, -58, -23, -65, -20, 19, -9,
+        -92, 95, 58, 69, 29, 46, 113, 51, 114, 73, 47, -85, -124, -121, -107, 47,
+        -12, -115, 47, -12, -124, -119, -110, 5, 9, 69, 6, 73, 25, 85, -18, -127,
+        2, 0, -98, -110, -40, -40, 38, 82, -7, -116, -9, 50, 115, 49, 82, 84,
+        -125, -51, -113, -92, 68, -21, 103, 121, -96, 7, 98, 4, 121, -4, 42, -31,
+        34, 115, -96, -66, 55, 125, 54, 56, 127, -87, -19, -22, -46, -27, -122, -21,
+        86, -64, -104, 122, 92, -100, -5, 34, 55, 87, -96, 118, -103, -56, -9, -23,
+        -88, -43, -80, -32, -3, 30, -33, -68, -68, 97, -71, -83, -51, -108, -45, -22,
+        -121, 47, 119, 90, -11, -2, -1, -32, -89, 74, 30, -87, 22, -9, -37, 69,
+        30, -82, -106, -15, -76, 106, -34, -1, 63, -22, 124, -86, -75, -68, 95, 48,
+        23, -99, 11, -93, -116, -18, -36, -95, -51, -107, -89, -35, -17, -66, 58, -43,
+        94, 100, -55, 44, 74, 63, -64, 93, 18, -89, 11, -33, -26, -53, -54, -29,
+        -113, -66, -51, 22, 22, 87, -71, 36, 91, -124, 121, -68, 94, -62, 98, -14,
+        109, 7, -82, -27, -17, -21, 56, 41, 74, 57, 114, 92, -23, 3, 73, 113,
+        96, 3, -43, -21, -48, 108, -57, 51, -29, 64, 45, -115, 95, 37, -121, -66,
+        -98, -21, -105, 74, 88, -105, 113, 122, 124, -105, 37, -75, 3, -123, -24, 51,
+        -5, -59, 18, 118, -112, -77, 100, -73, -64, 84, 66, 86, 18, 1, 72, -120,
+        48, -105, 117, -68, 63, -28, 83, -31, 73, -59, -123, -51, -29, -75, -33, 41,
+        119, -34, 105, -10, 99, 85, 52, -51, 22, -73, 73, 74, -49, 24, 103, 83,
+        -6, 22, -2, -46, 92, -66, -74, 40, -85, -29, 57, 46, -56, 43, -84, -33,
+        -3, -9, 87, -122, -35, 103, -19, 90, 96, 79, 70, -1, 7, -22, 10, -61,
+        39, 64, 105, 44, -110, -51, -5, 57, -73, -114, -108, -18, -81, -22, -99, 44,
+        10, -107, 31, -84, -89, 114, 40, -88, -96, 117, -59, -121, -84, 120, -66, -113,
+        44, 59, -29, -98, 22, 86, -77, -20, -85, -61, -87, -42, 82, -4, -66, -63,
+        90, 33, 97, 57, 98, -122, -96, -33, 70, 105, -80, 30, 25, -79, 28, 1,
+        0, -31, 62, 32, 10, -123, 37, 125, 16, -7, 11, -7, 108, -127, 42, 36,
+        51, -101, -13, 83, -82, 108, 57, -85, -10, 89, -119, -74, -87, -5, -4, 37,
+        -91, 114, -23, -13, -73, 12, -46, 118, 88, -65, 29, 34, 26, 3, 122, -59,
+        28, -84, -10, 89, 68, 113, 23, -88, -80, 94, -48, 73, -51, 14, 36, -97,
+        58, 32, -5, 92, 62, 61, -107, -124, -100, 83, 42, 97, 82, -55, 5, -18,
+        -54, -122, 69, 25, 93, -55, 80, -118, 101, -72, 56, 118, -72, -44, -124, -12,
+        -87, 54, 39, 63, -111, 75, 7, 99, -93, -79, 125, -93, -80, -88, -42, -116,
+        -25, 113, -7, 107, -62, -116, -92, 62, 107, 21, 35, 58, -109, 12, 35, 113,
+        -82, 89, 80, -79, 22, -22, -121, 107, 125, -94, 66, 43, 7, -101, 114, -97,
+        -88, -44, -26, 19, -107, -94, -15, -84, -19, -60, 65, 51, 92, 73, -3, -99,
+        44, 18, 39, -114, 23, -40, -41, 38, 18, -20, -124, 22, 92, 64, -32, 122,
+        64, 47, 2, 71, -61, -127, 105, 27, 85, 68, 57, 124, -121, 48, 55, -98,
+        35, 66, 28, 22, -44, -19, -11, -56, -97, -37, 62, -4, 81, 52, 14, -42,
+        103, 97, 121, 10, 88, -36, -48, 4, 46, -62, -126, 113, -127, -38, 44, -79,
+        13, 122, 86, -120, -13, -120, -38, 100, -68, -5, 96, 40, -118, -2, 2, 52,
+        -29, -108, -66, 101, -10, -30, 14, 68, 76, -69, 41, -20, -128, 112, 16, 88,
+        120, -46, 107, -57, 29, 108, -86, 112, 82, 11, 32, -99, -69, 48, -65, -115,
+        -14, -94, -13, 0, 13, -12, -77, 20, 49, 110, -86, -77, -116, 103, 112, -111,
+        35, -12, -82, -114, -22, -74, 49, 71, 87, 74, -2, 86, 18, -76, -47, -92,
+        56, -102, 9, -66, -115, -79, -34, -113, 0, 100, 27, 102, 92, -64, -4, -76,
+        -46, -67, -80, -107, 123, -116, -3, 84, 75, -56, -107, 122, -90, 113, 50, 58,
+        61, 48, 90, -19, 6, 45, -84, -4, -80, -39, 86, -39, 83, -74, 1, -121,
+        -22, -37, 77, -72, -104, -33, 26, 29, -95, 10, 114, 106, 113, -113, 16, -32,
+        -12, 86, 31, -77, -65, 1, -50, 68, -10, 6, -19, 90, -55, 30, -74, 120,
+        -97, 114, 39, -111, -66, 80, -110, -123, 53, 1, -56, 82, -111, -14, 18, 69,
+        0, 87, -31, 74, 13, -109, -41, 75, 88, -7, -98, 103, 55, 29, -124, -121,
+        19, 35, -52, 25, -44, 25, 89, 17, 82, 45, -58, 34, 75, -50, 62, -91,
+        -82, -87, -15, -57, 76, -49, -54, -50, -45, -89, 107, -48, -64, 20, 92, 70,
+        66, -78, 25, 75, 72, 38, -29, -6, -13, 108, 17, -13, -95, -42, 45, -66,
+        24, 77, -58, -2, 92, -92, -45, 50, 62, 9, 111, 12, -113, 66, 83, -60,
+        17, 27, 82, -96, -95, -15, -120, -119, -59, -116, 2, 67, -85, 73, 34, 43,
+        34, 107, -120, 91, 118, 7, 75, -98, -40, -118, 39, 26, 47, -22, 60, 48,
+        17, 122, 31, -66, 124, -38, 40, 123, -88, -101, -74, 124, 87, -99, 54, 119,
+        -92, -36, 85, -57, 13, 87, 82, 120, -100, -125, -30, 45, -9, 35, -114, 25,
+        -47, 113, 25, -44, -74, 27, -36, -22, -66, 10, 15, -34, -5, -55, 111, -64,
+        33, 118, 1, -48, -29, 69, -118, 19, -68, -12, 30, -45, -20, -17, -80, 46,
+        55, -64, -35, 69, -17, 83, -8, -55, 120, -11, -44, -35, 47, -123, -29, -69,
+        29, -103, 23, 108, 48, -52, 97, -7, 71, 62, 24, 4, -60, 119, -124, -125,
+        88, 56, 95, -64, 41, 69, 113, 85, 65, 43, 12, 77, -75, -116, -24, 104,
+        105, 57, 58, 26, -38, 59, 37, -6, 6, -31, -110, -79, -50, -99, -59, -88,
+        24, 119, -73, 30, -3, -39, 97, 102, -51, -124, -101, 39, -95, -36, 21, 115,
+        -102, -118, -25, -33, -116, 39, -62, 65, 45, -76, -6, 72, -84, 22, -125, -116,
+        -92, -26, -61, -21, 32, -46, 111, 121, 64, -65, -77, -56, 4, 42, -6, -24,
+        -13, -112, 49, 70, -127, -99, -118, -8, 107, 104, -88, -62, -93, -82, 121, 75,
+        -82, -125, 22, -58, -61, 85, -73, 19, 4, -118, -103, -71, -7, -13, 96, -90,
+        73, 96, 42, -31, -50, -31, 98, 42, 74, 46, 67, -43, -123, -11, 30, -4,
+        -112, 28, -97, -19, -31, -100, -7, -30, -18, 124, -66, -68, 13, 42, 55, -60,
+        -31, -65, -95, 43, 30, 11, -19, -68, -14, 24, -11, 119, -107, -27, 57, -13,
+        -64, 69, -100, 88, -119, -15, -52, -49, -42, 94, -64, -40, -118, 27, -32, -15,
+        48, 37, 123, -23, -18, -64, 76, 71, -120, 121, 114, 30, 69, -8, 104, -70,
+        117, -22, 120, 23, 35, 80, 41, -74, -1, -92, -20, 10, -36, -63, -116, 62,
+        55, 87, -87, 109, -19, 113, 26, 102, 90, -100, 6, -2, -69, 68, 44, 66,
+        121, -39, -64, -123, 70, 105, 99, 29, 4, 30, -82, -118, -50, -123, -2, -64,
+        110, -51, 18, 55, -121, -29, 83, 54, 40, -88, 113, -110, 50, -15, -47, 88,
+        -40, -75, 35, -8, -98, 57, 25, -102, -107, 44, -31, 10, 88, 94, 100, -125,
+        37, -32, -5, 116, -76, 28, 7, -55, -23, 114, -112, -86, 46, 56, 108, -113,
+        48, 77, -29, 104, 12, 111, 108, 7, 94, 10, -125, -73, 116, -35, -80, 25,
+        35, -123, -77, -10, 34, -109, -3, 64, 37, 64, -85, 5, 119, -105, -83, -101,
+        -112, -30, -59, 83, -20, 118, -127, 65, 34, -13, -116, -109, 120, 28, -125, -84,
+        99, -120, -11, 30, -4, -49, -68, 43, 34, -55, 80, 87, -27, -30, -11, -17,
+        70, -31, -40, 111, 104, 9, -96, 65, -48, -105, -69, 123, 28, 90, -120, 65,
+        43, 45, 76, 35, -89, 106, -74, -2, -102, 14, 8, 12, 16, -96, -79, 104,
+        99, 72, -8, 54, 80, 72, 109, 40, 104, -73, 94, -76, 16, 112, -90, -84,
+        110, -31, -78, -121, 70, 20, -86, 13, 76, -77, -100, 41, -56, 3, -91, -12,
+        70, 100, -46, 42, -83, 25, -33, 14, -24, -76, 20, -89, -50, 29, -26, 112,
+        -118, -3, -68, 84, -98, -71, -61, 12, -53, 51, 83, -31, 17, -26, 2, -110,
+        -103, 83, 63, 39, 91, -118, 49, 5, -78, -90, 104, 34, -20, 80, 88, -49,
+        77, -88, -99, -101, -40, 106, -13, -61, 101, 110, -74, -107, 109, 4, -71, -86,
+        -115, 16, 7, -113, -40, -53, 71, -15, 24, -29, 79, 107, 125, -46, 48, 66,
+        35, 26, -93, -119, 10, 26, 51, -49, -24, 39, -44, 42, 36, -15, -114, -26,
+        21, -73, -126, 87, -52, -85, -121, 70, 28, 81, -81, -54, -66, -69, 42, -109,
+        -115, -40, -101, -92, 46, -84, 76, -90, 56, 78, -69, 68, 71, 25, -96, 44,
+        -123, 96, 66, 6, -12, 34, 22, -28, 81, -104, -53, -64, 0, 113, 117, 112,
+        116, -108, 115, 117, -51, 37, 48, -77, 0, 13, -77, -115, 59, -91, -45, 47,
+        95, 42, 41, 115, 76, 5, -14, -53, 126, -87, 76, -69, -16, 113, 12, -27,
+        72, 63, 120, -8, -58, -103, 126, -87, 76, -69, -22, -95, 124, -79, 20, 60,
+        110, -81, 9, -60, -95, 25, 125, 17, 53, 46, -122, -17, 107, 58, 30, 86,
+        74, -4, -42, -65, -123, 127, -59, -1, -75, -84, -9, 82, -35, 120, 20, 25,
+        -27, 63, -14, -5, 24, -23, -74, 61, -96, 51, -37, -99, -73, -89, 108, 20,
+        -98, 50, 123, -48, -40, -69, 67, -118, 105, 0, 59, 64, -60, 36, -52, -30,
+        -14, -92, 17, 89, -23, 11, -127, -126, -5, 88, -16, -124, 119, 18, 0, 41,
+        65, 87, 4, 71, 2, -114, -127, 75, 45, -102, -34, 115, -23, -112, -91, -54,
+        26, -49, 41, 28, 44, -4, -77, 115, -59, 69, -46, 84, 103, -80, -74, 102,
+        20, 6, 36, -97, -74, 117, 90, -119, -46, -118, -119, 17, 120, 73, -61, 59,
+        114, 13, -45, -35, -45, -96, -93, -42, 127, -74, -80, 13, -4, 33, -36, 18,
+        50, -44, -102, 74, -102, 33, 17, 55, -6, -93, -63, -115, 0, -40, 104, 28,
+        -120, 31, 122, 6, -47, 14, -72, 79, 35, -44, -3, -36, 48, 94, -25, 7,
+        -95, -47, 112, 93, 16, 65, -108, -47, -106, 84, -116, 59, 113, 112, -91, -12,
+        2, -34, -72, -81, -125, 126, 111, 8, 63, 94, -9, -122, 14, 52, 35, -99,
+        49, -76, 106, 67, -79, -117, 23, 9, -123, -9, -126, 23, -64, 127, 64, 113,
+        -121, -118, -75, -18, -75, -66, 118, -48, 87, -44, -23, 83, 56, -80, -18, -18,
+        -94, 55, 44, -80, 54, 94, 67, 44, -115, 56, 117, 9, 60, -117, 6, -59,
+        -79, -121, -25, 14, -26, -114, -89, 14, 104, 106, -61, -32, 93, 99, 25, 15,
+        83, 46, -52, 50, 23, -123, 104, 33, -112, 19, -31, 69, -44, 28, 33, 45,
+        20, -68, 101, 81, 27, 58, 58, 28, 15, 10, 114, 122, -43, -7, 89, 105,
+        93, 81, 104, -71, 23, 97, 90, 0, 22, -54, -16, 2, 11, 12, -73, -53,
+        -70, 15, -80, -18, 41, -40, 0, 44, -15, 17, -11, -70, 51, 73, 29, 26,
+        -50, 1, -122, 80, -89, 9, 44, -62, 124, -79, 97, 18, 16, 62, -89, 115,
+        109, -96, -14, -27, -24, 28, 112, -109, -10, -32, 91, -124, -72, 107, 76, 78,
+        4, 8, 32, 10, 34, -4, 43, 25, 122, -114, 31, 122, -125, -30, 34, 30,
+        20, 98, -103, -13, -32, 113, 63, -56, -69, -37, 96, 13, -41, -75, -78, -116,
+        -113, -16, -14, -122, 115, -78, 11, 58, -22, 5, 26, -45, -77, 23, -95, 36,
+        123, -8, -92, 67, -91, -35, -69, 94, 27, -118, 117, 52, 100, 88, 11, 79,
+        -101, -103, 19, -69, 3, -87, -16, -117, -123, -120, -68, 24, 112, -75, 95, -20,
+        122, 14, 110, 60, 105, -44, -123, 19, 51, 41, 1, -127, -20, -23, 62, -64,
+        89, 121, -16, 44, -79, 94, -53, 106, 53, -76, 52, 120, 80, -39, -67, -108,
+        -71, 69, -112, -41, 72, -96, 89, -36, 83, -61, -77, 87, -71, -90, 30, 104,
+        20, 73, 39, 93, -90, -22, 46, 69, 66, 61, -78, 117, -25, -24, -95, -95,
+        -99, -36, 26, -3, -37, 110, -114, -98, 23, 85, 55, 103, 71, 69, 63, 28,
+        57, 69, -42, 94, -101, 104, 57, -110, 110, -115, -53, -120, -22, 65, -53, 93,
+        36, -118, -115, -26, -27, 88, 113, -107, 41, 62, 61, 57, -43, 105, 23, -74,
+        101, 17, -109, 82, 45, -28, 52, -43, -90, -110, 83, 20, -23, -63, 35, -27,
+        39, -85, -19, -7, 87, -81, -66, -19, 126, -5, 45, -10, 9, -4, 56, -128,
+        -102, -18, -104, 117, -60, 82, -79, 70, -28, -45, 85, 40, 125, 81, -4, -33,
+        -103, 61, -122, 13, 97, 18, -26, 45, 22, -58, 34, -86, -119, -91, 26, -14,
+        -52, 48, -79, 116, 117, -56, 109, 1, -125, 51, 107, -22, -104, 115, -107, 97,
+        -48, -116, -100, 59, -120, 14, -124, -56, -123, -35, 72, -125, -76, 19, 89, 3,
+        -20, 70, -51, -63, 115, -123, -39, -96, 28, -112, -58, 101, -80, -87, 30, 3,
+        -3, -110, -49, 95, 42, 62, -97, -4, 68, 11, -121, 69, -42, 73, 101, 24,
+        -62, 76, -58, 30, -28, 25, -87, 48, 76, -114, 80, -104, -8, -21, 61, -26,
+        82, 68, 110, 97, -55, -30, 59, 78, 75, -15, 29, -97, -35, 29, 16, -53,
+        0, -114, -125, -24, 88, 20, 64, 119, 63, 87, -107, 41, -100, 35, 50, 118,
+        57, -48, 87, 103, -26, -98, 97, -105, 6, 32, 104, -31, -113, -45, 78, 122,
+        -70, -32, -50, 125, -91, -45, 88, -79, 78, -34, -88, -8, -73, 77, 13, 100,
+        -120, 117, 107, 29, -61, 30, 123, 96, 27, 83, 59, -40, -100, 46, -92, -23,
+        47, 19, 119, 117, 23, -82, -89, -94, 51, 30, 88, 31, 22, 94, 82, -117,
+        -38, -120, -19, 121, 63, 81, -14, 35, -67, 69, -90, 90, -31, 34, -108, -81,
+        -119, 26, -86, -108, 104, 69, 44, 44, 92, 45, -75, -128, 2, -105, 63, -5,
+        -28, -82, 89, -81, 123, -31, -97, 116, 127, 32, -78, -93, 112, 96, -68, 81,
+        -84, 61, 12, 97, -80, -26, -86, 119, -90, 119, -49, -50, -50, -27, -43, -49,
+        108, 30, -41, 22, 91, 71, -55, 3, 30, 70, 43, 108, -104, 47, -54, -29,
+        -26, -39, -86, -104, -112, -110, 75, 76, 31, -71, -106, -112, -44, -99, -58, -96,
+        58, -36, 82, 3, -79, 35, 119, 17, 61, -26, -16, 82, 100, -123, 26, -119,
+        124, -113, 59, 104, 50, -74, 120, 46, -14, -70, 20, 37, -82, 111, -87, 69,
+        107, 117, -121, -6, 19, -78, 119, -6, -77, 87, 100, 9, -22, 106, 122, 116,
+        46, -39, 25, 51, -17, 29, 111, -95, 21, -117, -53, 101, 32, 111, -4, -123,
+        -106, 121, 112, 6, -76, 55, -100, 67, -128, -59, 5, -2, -19, 40, -78, -100,
+        25, 94, -56, -37, -85, -45, -19, -69, -36, 9, 36, 54, 34, 52, -74, 90,
+        66, 61, 52, 53, 116, 2, -103, 10, 23, -66, 52, -92, 60, 34, 48, -72,
+        -82, -17, 96, -17, 69, 8, -58, 101, 99, -40, 69, -75, -29, 100, 41, -55,
+        110, -109, 101, -83, 94, 97, 21, -24, -17, 6, 122, -48, 35, 103, -29, -83,
+        -36, 125, 34, -100, -90, 54, 66, -98, -114, -18, -47, -74, 15, -46, -15, -22,
+        -76, -38, -87, 25, -65, -125, 41, 87, 54, -34, -93, -116, 18, 91, 13, 17,
+        -85, -4, 45, 69, 44, -76, -123, -18, -49, 59, 51, -128, 4, -59, 4, 90,
+        92, -76, 115, 51, 28, 26, -117, -39, -42, -13, 120, 20, 1, 52, -82, 100,
+        -31, 37, -76, 108, 45, -84, 96, -81, -45, -65, 7, 35, -69, 30, -127, 36,
+        -54, 103, -35, -122, 15, 98, -51, 93, -15, 104, 76, -64, -80, -64, 113, -8,
+        83, 59, 9, -119, -20, -29, -76, -124, 61, -12, -125, 92, 121, -89, -127, -26,
+        113, 87, 115, 21, 122, -55, -80, 36, -23, 28, 55, 98, -127, 79, 20, 99,
+        119, 76, 43, -54, -127, -91, 92, -96, 113, -29, -40, 29, 113, -115, 47, 40,
+        98, 76, -30, -91, -82, 16, 115, -105, 42, -15, 75, 126, -23, 29, 3, -108,
+        116, 20, -45, -89, -89, 82, -108, -24, 35, 104, 23, 62, -42, 35, -46, -67,
+        29, -39, -34, 60, -96, 83, 84, -88, 48, -86, -95, 63, 120, 105, -65, -71,
+        117, 59, -30, -88, -63, -28, 115, 33, 34, -38, 48, -93, -103, -127, -67, 55,
+        110, 42, -74, 57, 24, 61, -70, -36, -46, 8, 31, -99, 28, -75, -20, 34,
+        86, -12, 2, -59, 63, 50, -24, -2, -77, -87, -120, 92, -88, -34, 54, 24,
+        65, -127, 33, 51, 17, 71, -3, 101, -1, 16, -43, -58, -109, 32, -65, -49,
+        97, -94, -28, 44, -9, -78, -89, -76, -20, -13, 96, 53, 44, -97, -98, -66,
+        -33, 27, -84, -122, -13, -41, 65, -49, -97, 87, 46, 109, 120, -47, -23, -8,
+        115, 113, 117, 79, -98, -105, -41, -112, -115, -22, -117, -45, 26, -50, -57, 24,
+        69, 55, -25, -95, 73, -67, -119, 118, -37, -49, 109, 54, 65, -13, -67, 50,
+        -29, 61, -100, -26, 112, -30, -51, 15, -45, 11, -69, 32, -84, 35, 4, -26,
+        6, -114, 103, -40, 87, 44, 31, 12, -99, 20, -9, -91, 91, -41, -69, -27,
+        -106, -76, -34, -91, -103, 56, 66, 53, 123, 13, -56, 104, -120, 57, -4, -76,
+        50, 118, -65, -34, 48, -78, -104, 48, -91, 83, 34, -59, 79, 47, -35, 118,
+        -7, 91, 87, -4, 91, -125, -88, 38, 52, -59, 109, 80, 109, -46, -16, 9,
+        125, -64, 117, 34, 42, 62, 86, -73, 125, -21, 42, -119, -32, -115, 70, -97,
+        60, 72, -6, -28, -90, 19, -88, 24, 14, -8, -22, 74, -85, 118, 43, -85,
+        93, -79, 106, 3, 22, -78, -14, -90, -13, -32, 125, 8, -54, -102, 54, -109,
+        -59, -101, -123, -59, -110, -34, -72, -61, -38, 87, 48, 80, -65, -10, -91, 119,
+        93, 75, 18, -19, 76, -110, -56, -96, 121, -12, -96, -45, -47, -47, 65, -89,
+        77, -22, -25, -123, -11, 13, 55, -48, 111, -117, -32, -39, -33, -117, -111, -118,
+        16, -110, 90, -56, -26, 107, 91, -56, -26, -73, 102, -24, 101, 19, 74, -113,
+        -52, -12, -7, -79, 33, -45, -89, -127, -29, -81, -67, -113, 112, -78, -10, -123,
+        45, -58, -11, 53, 70, -123, 16, -44, -106, 30, -116, -6, -38, -50, -58, -47,
+        -95, -121, -45, 127, -19, 122, -41, -107, 72, -38, 115, 110, -91, -11, 14, -40,
+        13, 75, -84, 98, 75, 102, 67, -21, 73, 120, 122, 114, -34, 29, 78, 120,
+        88, 119, -120, -102, -102, -42, -124, -31, 50, 45, -13, -33, -99, 57, -3, -18,
+        121, -103, -90, 113, -97, 31, -41, -40, 66, -61, 94, 63, -109, -122, -67, -47,
+        105, -40, 7, 51, 82, -15, 85, 57, -110, -15, 109, -119, -58, -99, 55, -48,
+        -72, -10, -112, -65, -17, 106, 98, 24, 31, 34, 127, 31, 23, 126, -18, 9,
+        14, 27, -40, 20, -59, 74, -5, -101, -67, 65, 25, -77, 42, 71, 39, -29,
+        -42, 67, 88, -48, -106, -112, 73, -115, 76, 37, 88, 103, -9, -86, 78, -22,
+        -110, 127, 15, 35, 94, 24, -31, 46, -28, 90, -25, 58, -25, 8, -65, -15,
+        15, 30, 66, -53, -80, -119, 46, 60, 58, -51, 93, -107, 111, 55, -78, -67,
+        -90, 42, 15, -34, 97, 42, 117, 64, -2, 75, 71, 87, 71, -117, -61, 21,
+        0, 118, -114, -127, -105, -15, -41, -11, -35, 2, -99, 40, -99, 71, -26, 21,
+        16, -117, 12, -123, -79, 71, -11, 73, 99, 42, 114, -46, -74, -8, 79, 105,
+        38, 93, 24, -39, -91, -91, -83, 52, -70, 7, 2, -53, -62, -46, 82, 31,
+        -37, -122, -116, -85, -55, -127, -120, 75, 30, -98, 49, 43, -58, 31, 44, -97,
+        -45, -124, 25, -87, -29, -22, 73, 31, -16, 68, -24, 85, -32, -9, 82, 104,
+        -79, 11, 75, -28, 52, -22, -64, 73, -35, 110, -110, -123, -77, 104, -90, 43,
+        42, -35, 71, 70, -106, -112, 98, 83, -128, 85, -121, 11, 51, -49, -50, -37,
+        -49, 24, -31, 123, 110, 30, 47, 1, -78, 35, -46, -14, 126, 73, 63, -97,
+        81, -47, 57, -120, 68, -126, 78, -71, -50, -77, 63, 103, -122, -55, 31, -99,
+        -37, -14, -53, 38, -91, -100, 88, -100, -60, 91, 106, 115, 4, -26, -91, -54,
+        -127, -101, -4, -16, 33, 62, 92, -122, 17, -93, -2, 79, 29, -96, -106, 58,
+        -57, 114, -81, 124, -84, 34, 29, 27, 99, 92, -99, -46, -51, -47, -18, -69,
+        58, 21, 75, -118, -78, 120, -17, -68, 93, -69, -34, -57, -78, -86, -84, 16,
+        -86, -78, 56, 64, -23, -93, 82, -107, 21, -114, -5, 40, 38, -54, 20, 99,
+        5, 26, -53, -124, -85, 85, -62, -4, -96, 60, -87, 22, 84, 102, 106, -48,
+        93, -93, -66, -63, 116, -44, -107, -82, 41, 70, 120, 101, 70, 4, -64, -35,
+        10, -13, -27, 11, -48, -112, 54, 81, -44, -28, 27, 70, -53, 16, -84, -11,
+        39, -54, -25, 77, -105, 86, 80, -74, 66, 84, -81, 42, 13, -32, -46, -77,
+        87, -121, 23, -84, 50, 32, -5, 31, 121, 34, 92, 36, 58, -2, 17, -26,
+        49, -46, 74, 24, -108, 103, -96, -68, -61, 27, -3, 73, -96, -69, -55, 65,
+        -105, 18, -54, -103, -61, -92, -87, 21, 49, 42, -59, -45, -102, 121, 11, -63,
+        83, 108, -60, -113, -107, 54, -8, 105, 118, 55, -55, -82, -88, -29, 97, -116,
+        -94, -57, -44, -101, 31, 78, 107, -45, 122, -74, -77, -58, -86, -55, 89, 99,
+        37, 82, 33, 29, -59, -104, -51, -67, 21, 28, 65, 24, -85, 110, 63, 78,
+        -51, -17, -29, 34, -122, 85, -66, 14, -116, -89, 54, 103, 15, 38, 65, -49,
+        -69, -121, -59, 98, -58, 91, 63, 35, -55, -91, -53, 11, -108, 77, 23, -115,
+        42, 88, 9, -29, 107, -37, -122, -62, -119, -5, -64, 57, 114, 52, -55, -36,
+        4, -69, -18, -50, -101, -63, -65, -65, 3, -5, -13, 79, 88, -13, 93, 119,
+        11, 31, -37, 97, 59, 118, 81, 76, -40, 3, -69, 2, -68, 4, 43, 124,
+        31, -29, 16, -77, 20, 46, 17, 104, 46, -97, -90, -68, -101, 31, 37, -92,
+        60, 4, 95, -22, -35, -80, -62, 52, -24, 71, -63, -39, 34, -125, 45, -45,
+        -84, 125, -127, 5, -19, 13, 46, 47, 108, 94, 63, -125, 75, 1, 99, 55,
+        -64, 18, -106, -105, -89, 36, -1, 75, -67, 75, -36, -81, -73, -127, -11, -44,
+        -95, -87, -17, -27, 88, -28, -114, 54, 79, 18, 127, 119, -51, -52, 53, 62,
+        -78, 63, -17, -40, -97, -33, 49, 37, -52, -62, -37, -7, 27, -125, -29, -70,
+        2, -78, -113, 65, 9, 80, -1, -34, 39, -67, 87, -76, 69, -48, -83, -45,
+        117, 60, 1, -93, -105, -72, -30, 111, -72, 82, 63, 103, 15, 24, 120, -10,
+        19, -26, 19, -111, -41, 115, 104, -122, -68, 69, 0, -60, 53, -127, 49, -70,
+        19, 88, -14, 91, -23, -113, 21, 23, 63, 102, 121, -4, 123, -106, -62, -58,
+        -72, -113, -17, -126, 77, 123, 114, 106, 64, 36, 1, -42, 15, -127, -77, -20,
+        76, 78, 63, -71, 103, -25, -58, -64, 42, -67, 119, -73, 108, -79, 101, 34,
+        -43, 53, -16, 76, -17, -17, -93, 28, 14, -57, 10, 78, 28, 12, -70, 112,
+        30, -103, -83, -39, -91, 7, 115, -7, 44, 64, 19, 41, -24, 28, -40, -51,
+        31, 60, 9, 121, -2, -60, -109, -112, 70, 105, -19, -29, -75, 4, 100, 74,
+        73, 54, 9, 62, 107, 112, -6, -114, 61, -55, 30, -9, -9, -127, 115, -83,
+        100, -113, 63, -13, 69, 19, -2, 6, -116, -5, -126, -43, -105, -61, 81, -66,
+        49, -85, -67, 49, -118, -46, 56, -23, -36, -8, 51, 99, 112, -69, 62, 112,
+        -90, -69, 115, -32, 98, -67, -33, 93, -41, -107, 103, -119, 17, 18, 10, 50,
+        -29, -30, -45, 79, 112, -39, -28, -15, -108, -60, 126, 21, 12, -12, -119, 65,
+        82, 39, -44, 93, 95, 97, -35, 105, 26, 91, 66, 4, -99, -5, -77, 115,
+        76, 28, -79, 104, -33, 91, -74, -22, 77, -32, 36, -99, -5, 103, 108, -43,
+        -49, -57, 110, -43, 39, -71, 4, 31, 113, -85, -74, -2, 27, 79, -52, -46,
+        -65, -9, 36, -122, -16, 19, -53, 78, -35, 7, 63, 43, -12, -14, -111, 61,
+        -56, -2, -10, -109, -22, 70, 1, 62, -35, -36, -91, -57, -17, -107, 24, 70,
+        105, -100, -124, -101, -128, -83, -46, 70, -89, 54, -120, -19, 47, -55, 112, 127,
+        -84, -96, 6, 28, -55, -33, 0, -49, -112, 109, -12, -93, -47, -19, -75, 49,
+        -6, 50, 116, 32, 114, -6, 4, 117, -24, 47, 61, 125, -26, 79, -97, -53,
+        64, -59, 7, 13, -21, -13, -29, -55, 9, -53, 85, -8, 35, -58, -43, -68,
+        -18, 98, -48, -79, -21, -18, -106, 118, -12, 123, 27, -38, -62, -107, 121, 35,
+        20, 118, -24, 5, -55, 80, -41, -5, -96, -50, 17, 106, 53, 30, 104, 98,
+        99, 126, 61, 57, -103, 115, 19, 60, 106, 107, 73, 46, 53, -40, -81, -1,
+        61, 89, -14, -47, -49, -9, -76, -30, -72, -14, 2, -113, 73, 104, -9, -92,
+        -89, -50, 117, 87, -4, 20, 110, 57, -84, -28, 99, 86, -117, -11, -92, 22,
+        -65, 102, 93, -54, -101, 105, 46, -12, 30, -59, -46, -71, 32, 84, -127, 73,
+        116, 110, -68, 86, -92, 9, 92, -2, -103, 99, 26, -5, 7, -7, 6, 119,
+        -77, 120, -57, 47, 13, -17, -106, -105, -13, -61, 115, 35, -36, 94, -11, 3,
+        -59, -85, 96, 84, -124, 22, -26, 120, 102, -41, 79, -53, -11, 110, 92, 17,
+        -48, 80, 115, 109, 80, 108, -81, -19, 40, 53, 5, -71, -115, 41, -58, -19,
+        111, 100, -41, -88, 79, -110, 76, 28, 13, 88, -61, 120, 127, -120, 38, 81,
+        -127, -123, 63, -74, 104, 84, 98, -36, -43, 107, 117, -50, -106, 104, 32, -87,
+        93, -43, 107, -19, 26, -57, 64, 119, -58, 49, 21, -118, -39, 7, -128, -65,
+        -47, 24, -24, -82, 69, 9, 115, 68, 28, 115, -60, 99, 118, -1, 32, -83,
+        4, -12, 87, 67, -75, -83, -73, 45, -55, 55, -25, -18, 112, -82, 5, 50,
+        -99, 3, -91, -79, 40, 91, 92, -33, -123, 43, -45, -56, -99, -81, 111, 41,
+        -53, -98, 59, 92, 107, 61, -83, 49, 100, -69, 72, 94, -76, -123, -117, 80,
+        -21, 87, -69, -87, 113, 116, 115, -88, 70, -48, 110, -3, 10, -84, 17, 92,
+        -97, 91, -116, 60, -106, -79, 13, 84, -90, -110, -56, 60, -23, -111, -109, -11,
+        -69, 115, -24, -124, 106, 41, 14, -34, -41, -61, -68, -67, 60, -99, -8, 121,
+        59, 53, 49, 56, -106, 122, -9, -108, 122, -23, -27, -63, -34, 56, -128, -111,
+        70, -88, 110, -74, -93, -5, -79, -100, -121, 90, -96, 21, -53, -18, 4, 67,
+        118, -46, 96, -90, -64, -25, 108, 35, 68, 118, -107, 97, -103, -52, -99, 64,
+        72, -38, -80, 56, 0, 74, 94, -18, 28, -26, 102, 82, -70, -19, -115, 54,
+        0, 23, -89, -118, 81, -22, 39, 108, 40, -59, 115, 86, 47, 107, 79, 97,
+        -11, -78, 118, 82, 26, 38, -108, -70, -1, -125, -53, 87, -64, 85, -53, -106,
+        -113, 89, 120, -43, -83, -34, -12, -16, -22, 73, 5, -82, 88, -68, -92, 121,
+        -15, 112, -90, -82, -9, 104, 96, -60, -48, -60, -105, -123, -122, 85, 83, -123,
+        85, 19, 83, -86, 88, -66, 108, 27, -47, 20, -69, -124, 9, 89, 109, -103,
+        17, -74, -60, 39, -123, -114, 120, -14, 50, -38, 66, 108, 69, 87, -79, -80,
+        -127, 123, -96, 24, -92, 49, 69, 31, -3, 77, -92, 67, 101, 124, -50, -88,
+        -60, -36, -116, 41, 56, -75, -78, 76, 94, 72, -43, 61, -115, -99, 28, -43,
+        -99, -103, -73, -60, -117, -109, 25, 91, 1, 82, 88, 48, 85, -112, -73, 64,
+        -77, 68, -12, -67, -106, 102, 88, -26, -101, -127, 10, 112, -88, -56, -17, 81,
+        50, 30, 45, -57, 79, 79, -36, -7, -76, -14, 102, -72, 9, 50, 31, -96,
+        38, -21, 108, -50, -90, -48, 119, -42, 89, -99, 77, 25, 7, 54, 87, -58,
+        -85, -85, -50, -58, 5, 4, 104, -71, -69, 117, -38, -58, -92, 44, 114, -75,
+        79, 5, 94, -78, 27, -68, 100, 87, -58, 5, 90, -55, 68, 41, 46, -47,
+        42, 83, -94, 17, 73, -6, 2, 98, 106, -69, -33, -128, 100, 125, 96, -127,
+        7, -26, 78, 106, -95, 78, 101, 112, 77, -66, -42, 112, 96, 62, -67, -55,
+        114, -2, -106, 28, 123, -48, -55, 36, -90, -98, -44, 119, 102, -38, 4, -80,
+        -13, 96, 2, -112, -110, -61, -65, 6, -67, -57, 66, 88, -75, -125, -112, -93,
+        -45, 71, 78, 49, 108, 5, -59, 32, -87, -118, -83, -94, 42, 20, 52, -49,
+        61, -4, -16, 14, 22, -122, 81, 87, -106, 37, -58, -69, -98, 32, -93, 112,
+        90, -69, 22, 69, 52, -12, 50, 15, 37, 96, -26, 33, -55, 45, -89, 65,
+        -16, 8, -57, 30, -123, 29, 29, -123, 93, -97, 57, 36, -100, 19, -12, -85,
+        107, 55, 51, -18, -25, -76, 124, -61, 39, -4, 100, -4, 83, -28, 9, 126,
+        96, -31, 62, -50, -72, 18, 8, 3, -57, 69, -77, -49, 116, 50, -48, 47,
+        -88, 93, 88, -33, 44, 20, -36, -51, 58, -88, 110, -73, -63, 29, 76, 108,
+        37, -127, 78, -31, -115, 84, 91, -38, -52, -37, -10, -111, 92, 62, 71, -77,
+        -97, 47, -124, -70, -40, -128, 54, 59, 12, -2, -26, -29, -71, 127, -64, 20,
+        6, -30, 74, 93, 90, -96, 16, -61, 97, -74, -125, -36, -11, 4, -124, 108,
+        42, 16, -78, 49, 32, -124, -115, 118, -31, 33, 36, 50, 66, -4, 0, 112,
+        108, 91, 104, -87, -126, -32, -95, 15, 15, 6, -25, 2, -128, -59, -122, -13,
+        -122, 66, 55, -121, 35, 93, 10, -64, 38, 92, -29, -57, -75, -30, -70, -47,
+        26, -29, 90, -96, -42, -54, 94, 9, 69, 11, 84, 101, 79, -62, -49, 98,
+        -17, -20, -42, -82, -9, -18, -8, 40, 96, 90, -24, 47, -118, 116, -128, 65,
+        -63, 44, 81, 120, 10, 32, -26, 104, 106, -116, 14, 126, 19, 111, -113, -104,
+        35, -96, 14, -89, -75, 64, -103, 110, 84, 74, 1, 78, -86, -30, 53, -117,
+        127, -33, 92, 1, 102, -25, -98, -100, 104, 65, -87, -8, 40, 81, -68, -26,
+        -59, 46, 95, -117, 31, -61, -5, -24, 70, 12, 17, 5, -109, 66, -6, -118,
+        -19, 89, -26, 23, -57, 29, -124, -93, 80, 26, -126, -116, 3, -29, -87, -35,
+        -113, 58, -33, 120, 88, 59, 8, -59, -12, -107, -98, 106, 26, 38, -45, 13,
+        6, -72, 97, 50, -93, -90, -125, -49, -58, 67, -25, 94, -127, -117, -26, -113,
+        68, -89, 63, -90, 83, -1, 27, -99, 118, -44, 52, 126, -42, 51, 95, -115,
+        48, -2, 29, 115, 48, -61, 123, 39, 19, -42, 72, -26, -20, 97, 48, -117,
+        44, 39, 63, 100, -27, -25, -42, -106, -103, -116, -72, -20, 75, -124, 8, -46,
+        -110, 92, 25, 2, -122, 89, -96, -91, -15, 17, 2, -122, 24, -109, 92, 118,
+        18, -101, -128, 65, 124, -98, 9, 26, 106, 63, -121, -98, -12, -92, -76, -99,
+        73, -81, -37, 45, 124, -104, 25, -109, 56, -47, 40, -57, 47, -72, -61, -38,
+        -15, 126, -90, -72, 14, -78, -105, -80, -31, 67, 53, -35, 103, -19, 62, 124,
+        -96, 56, -16, 1, 118, -47, -4, 119, 127, 69, -100, -11, 45, -118, -127, -4,
+        -87, -62, 25, -45, 101, 52, -67, -43, 93, -66, 14, 121, -85, 75, 84, -122,
+        66, 7, -126, 49, 81, -128, 42, 72, 2, 51, 5, 116, -102, -66, -76, 55,
+        -56, 47, -118, 102, -25, -80, 92, -120, 65, -77, -96, -90, 38, 76, 120, -32,
+        -76, 16, 2, -16, -92, 102, -30, -8, -122, 60, 115, 5, 43, -128, -77, -102,
+        -43, 59, -112, 101, -11, 14, 100, 33, 115, 32, 43, 127, 96, 104, 30, 122,
+        96, -105, 1, 21, 126, -32, -109, -58, 120, -91, 81, -61, 112, 117, 23, 50,
+        -65, 52, 80, 33, 36, -81, -17, 57, 62, -82, 103, -81, -80, -124, -116, -45,
+        3, 56, -42, -76, -19, -113, 41, 107, -35, 17, -11, 96, -12, -82, 52, 7,
+        -48, 33, -64, -113, 60, 125, -1, -11, -21, 8, 69, 12, -7, 29, 9, 104,
+        -14, -126, 44, 14, 62, 55, 102, -53, 2, -108, 20, 42, -20, 85, 72, -68,
+        -124, -40, 10, -105, -24, -77, 78, -86, 75, -20, 46, -83, 66, 29, 78, 10,
+        -61, -124, -112, -77, 119, -97, -98, 36, -35, 28, 13, -39, 79, 31, 67, 37,
+        -72, 46, -16, 68, 57, 108, -127, -23, -48, -78, 14, 49, 94, -21, -55, 73,
+        -4, -70, 55, 52, 118, -123, -52, 48, 104, 76, -97, 71, 49, -96, 105, 74,
+        44, -96, 87, 64, -46, -24, -77, -37, 9, 25, -46, 50, -111, -108, -50, 46,
+        -56, 50, -59, 54, -76, -49, 79, 77, 16, -120, -117, -97, 89, -8, -123, -39,
+        -16, 75, -6, -13, 123, 42, -10, 106, -61, 4, 53, 29, 57, -1, -118, -85,
+        124, 9, 96, -114, -125, -12, 53, 42, -63, 58, 29, 12, -84, -54, -125, 68,
+        -121, 40, -12, 69, -113, 73, -27, -74, -56, 74, -48, -13, 56, 15, 106, -105,
+        -116, -22, 12, 72, -96, 47, -31, 7, -73, -107, -69, -31, 126, 54, -56, 92,
+        -31, 100, -8, -69, -87, 57, -107, -24, 71, -28, 108, -76, -65, -91, -96, 99,
+        1, -6, 32, 35, 32, 1, -44, 98, 94, 77, 120, 10, 62, -81, 29, 52,
+        -31, -128, 118, 125, -70, -11, -60, -107, 11, 40, 41, 35, -84, 19, 7, -124,
+        -71, 70, 57, 32, 83, 15, -47, 106, -48, 125, 117, -22, 20, 109, 96, -97,
+        121, 91, 37, 86, -95, -41, -123, 23, -19, 49, 33, -120, -34, -101, -120, -77,
+        -47, 27, 36, -48, 109, 2, -35, -122, -40, 122, 13, 12, -103, 7, -1, 32,
+        -98, 86, -42, 119, -95, 123, -127, -41, -3, 48, -121, -73, 65, 78, 111, -125,
+        -98, -113, -20, 122, -124, -113, -29, -77, -48, 61, -115, -38, 78, -52, -33, -31,
+        99, -20, -66, -2, -106, 56, -6, -81, 78, -61, 51, -26, -54, -7, 95, -7,
+        26, -67, 88, -88, -109, -30, 52, -14, 120, 71, -59, 105, -84, -44, -94, 44,
+        -52, 71, -64, -30, 124, 64, -1, -21, -111, -28, 64, 51, 15, -43, -41, 116,
+        -43, -118, 82, -32, 62, 123, 30, 102, -99, -95, -83, 61, 115, -66, 57, 117,
+        -6, -19, 28, 24, -54, 83, -4, 7, -8, -7, -108, 93, 67, -93, 2, 99,
+        -23, -47, 11, -4, 53, -106, -53, -109, -18, -67, 79, 53, -69, -121, -87, 46,
+        98, -52, 117, -81, -76, -85, -79, 64, -7, -72, -6, 49, 110, -40, -102, 14,
+        25, -27, -19, -31, -31, 75, -78, -128, -99, -20, 66, -100, 98, 121, 97, -60,
+        -88, 104, 84, 75, 58, -54, 59, -25, -29, 78, 49, -54, -32, -113, 123, -15,
+        85, 111, -24, 68, -19, -96, -11, 31, 42, 31, 30, 66, -122, 17, 16, 48,
+        28, -31, -90, 96, 45, 40, 85, -123, -25, -107, 106, 95, -63, -44, -3, -4,
+        -11, -41, -84, -53, -85, 63, -87, -53, 106, -75, -81, 43, -43, 94, -79, 47,
+        -97, 35, -90, -122, -38, 55, 127, -42, 108, 20, -123, -23, -3, -80, 14, -86,
+        100, -28, -17, -104, 19, -112, -114, 83, -97, 29, -89, -98, 12, 63, 16, 97,
+        81, 70, 71, 107, -64, -125, -97, -124, -34, 8, -57, -45, -50, -24, -16, -63,
+        123, -8, 5, -107, 98, 4, -83, -100, -110, -123, -64, 35, -4, -30, 101, -12,
+        56, 118, 53, 15, -90, 115, 18, -74, 8, -99, -5, 69, -94, -12, -18, -64,
+        115, 98, -36, -119, 41, 124, 47, -107, -33, 27, 45, -79, -25, 41, 118, -75,
+        -60, -98, -89, -40, -13, 82, 60, -114, -75, 20, 19, -54, -56, 2, -49, 34,
+        -14, 7, -20, -107, -125, -77, -24, -32, -20, 0, -54, 35, 118, 4, 0, -116,
+        73, -45, -14, -90, -106, 119, 1, 4, 84, 28, 25, -59, 120, -53, 112, 117,
+        17, -60, 34, 40, 44, -46, -19, 100, 26, 16, -68, 116, 90, -109, -51, 100,
+        -110, 80, 126, -59, -70, 32, -57, 39, 39, -83, 98, 74, -122, 87, 77, -75,
+        -32, -98, 19, 49, 100, 89, 101, 50, -14, -8, -66, 28, 61, 55, -51, 126,
+        -118, 22, 48, -98, -5, 72, 26, 120, -24, -76, 53, -36, 4, -116, -88, -20,
+        -66, -69, -4, -12, -21, 63, 46, -33, -2, -3, 7, -59, -112, 113, -74, -108,
+        58, 126, -57, 68, -125, 50, 38, 47, -47, -102, 60, -38, 87, -23, -109, -38,
+        45, 32, 67, -82, -38, 121, -122, -96, -25, -107, -83, 5, 122, 71, -121, 97,
+        101, 119, 2, 119, 119, -105, -92, 1, 32, -29, -78, -1, 77, 2, 119, -66,
+        -43, 76, -61, -49, 44, 17, -90, 49, -121, 87, -83, -106, 95, -98, -82, 4,
+        -29, 121, 55, 90, -108, -96, 25, -35, -76, 20, -47, -40, -53, 92, -35, 106,
+        34, 48, -32, -123, 23, -78, 21, -7, -35, 86, -31, 119, -83, -62, -42, 86,
+        97, -85, 85, -64, -72, -27, 72, -88, 125, 46, -43, -111, -27, -34, 58, -104,
+        -14, 88, -103, 92, -29, 38, -32, -102, -113, 78, -68, 101, 98, 28, -18, -66,
+        -63, -34, -87, 19, -116, 33, -94, 120, -94, 50, -119, -36, 41, 91, -39, 58,
+        40, -61, 81, -73, -54, -56, 59, 11, 97, 25, -75, -87, -39, -92, 112, -76,
+        24, -5, 11, -74, 106, -65, -94, 82, -120, -38, 106, 118, 64, -34, -62, -37,
+        8, -81, 13, 24, -54, 28, -1, -39, -30, 63, 19, -83, -57, 85, 56, 83,
+        -22, -112, 118, 3, 68, 62, -61, 124, -122, 106, 10, -123, 33, -116, -63, -53,
+        -84, 124, 110, 86, -26, 113, 117, 107, -101, 73, -32, 84, -34, -113, 54, 116,
+        49, 103, -11, 74, 118, -41, -37, 50, 108, 56, 97, 19, -65, 15, 38, -62,
+        7, -126, 104, 82, -17, 86, 123, 24, 60, 84, 55, -62, 66, -95, -93, 54,
+        125, -95, -108, -98, -116, 84, 123, 40, -111, 106, -67, -67, -53, 105, -13, 86,
+        113, -105, 101, -21, 37, -29, 105, 76, 30, 100, -70, -55, -17, 1, -121, 9,
+        1, 53, -20, 31, 76, 103, -72, -30, 81, 90, -112, 41, -11, -7, -61, -125,
+        59, 96, -118, 75, -111, -127, 48, 81, -34, 18, -49, 25, 110, -63, -121, 123,
+        91, 59, -36, 57, -5, -32, 45, -9, -17, -71, 12, 30, -15, -84, 107, -66,
+        -38, -102, 40, 112, -29, -59, 36, -92, -101, 0, -61, -36, 39, 38, -121, 5,
+        -120, 97, 32, -88, -60, 49, -30, -123, 83, -23, 11, -37, -21, -3, -31, 24,
+        62, -7, -9, 114, 81, -23, -17, -71, 127, -117, 33, 13, 69, 68, 26, 31,
+        32, 86, 6, -96, -63, 7, 61, -64, 82, 88, -98, -104, -73, -67, -52, -13,
+        -33, -4, -83, -73, -93, -65, 43, 111, 119, 78, 63, -124, -38, 90, -56, -25,
+        -4, 98, -17, -35, 4, -4, -16, -64, 34, -62, -72, 81, -75, -92, -62, -105,
+        -120, -40, -106, -105, 44, -74, 37, -85, 67, -106, 17, -91, -99, 25, -30, 70,
+        42, 87, 38, 110, 1, 23, 107, -30, 66, -14, -84, 37, -103, 125, -87, 41,
+        67, -47, -36, -64, -55, -70, -128, 114, 31, -101, 87, 14, 23, -20, -19, 51,
+        102, -93, -64, 67, 110, -30, -107, -89, 77, -79, -48, -89, 84, -102, 11, 69,
+        -31, -68, 81, 49, 75, -111, -99, 120, 43, 31, -37, -22, -115, 119, 99, 72,
+        70, -96, -110, -2, -40, 54, -33, -78, -36, -126, -65, 46, -61, 116, -106, 112,
+        -33, 1, 1, 61, 101, 0, -92, 49, -5, 55, -62, -43, 74, 32, 26, 21,
+        -128, 48, 74, -40, -92, -33, -123, 113, -38, 80, -55, -76, 57, -64, 104, 109,
+        -54, -91, 65, -44, -89, -12, 101, 85, -122, 90, 99, -106, 101, -10, 55, -99,
+        -67, -50, 5, 97, -98, 119, 127, -89, -95, -69, 39, 39, -77, 110, -111, 1,
+        115, 82, 10, -12, -52, -17, 116, 46, -65, -30, 9, -70, -51, 4, 42, -84,
+        -121, -106, -21, 118, -124, -108, -85, -79, 22, -70, -2, -39, 57, 93, -55, -46,
+        126, 8, 102, -30, 70, -6, -16, -70, 55, -8, 0, 108, 45, -117, 48, 57,
+        27, 125, 0, 86, -125, 115, -52, -94, -10, 53, -36, 97, -41, 23, -78, -59,
+        53, -36, 97, -94, -10, -75, -30, 114, -106, 82, -54, 97, -71, -116, 14, 103,
+        -51, -87, 55, -58, -107, -38, 74, 107, -100, 118, -57, 102, 62, -40, 113, 90,
+        89, -38, -46, 13, -22, 88, -88, 55, -52, 85, -6, 33, 9, -89, 20, 122,
+        25, 51, -46, -118, 8, -102, 122, -78, -127, 114, -20, 52, 75, -8, 14, 119,
+        104, 45, 6, 118, -51, -73, -66, -16, -114, 52, 8, -115, 93, -111, 32, 66,
+        -56, 60, -44, 12, 88, 124, -64, -78, -106, 21, 99, -71, 53, 86, 16, -63,
+        43, -71, -43, 48, 93, 124, -42, -64, -10, 29, -109, 54, -86, 116, -44, 113,
+        74, 67, 27, -38, 122, -127, 37, 109, 87, 42, -98, -97, 30, -24, 27, -77,
+        -71, 51, 7, 29, 56, -21, -33, 101, -21, 117, 118, -9, 89, -65, -75, 29,
+        -11, -5, -75, -19, -85, 79, 79, 20, 20, 76, -33, 112, -35, 126, 0, 123,
+        37, -35, -59, -57, -52, 21, -85, -82, 127, -55, -42, -91, -37, 72, -99, -101,
+        -128, 121, 118, 110, 34, -103, 99, -84, -101, -39, 113, -11, -107, -24, -88, -124,
+        79, -30, 49, -57, 28, -61, -38, 55, 126, -4, 108, 27, -23, 24, -3, 89,
+        -67, 10, -110, 12, -98, 23, 49, -35, 98, 5, 28, -85, 110, 77, -76, -6,
+        -59, 118, -59, -15, 94, -92, 117, 91, -93, -3, 79, 99, -110, -128, 65, 9,
+        -57, 107, 57, -34, 75, 57, 0, 114, 50, 17, -113, 108, 38, -30, 114, 10,
+        101, -95, 115, 79, 97, -74, -22, 21, -35, 32, -65, -27, -126, 57, -50, 61,
+        101, 74, -112, -101, -110, 100, 55, 49, -12, 2, 75, 46, -36, -3, 68, 22,
+        95, -116, 54, -101, -119, 95, -25, -70, -103, 87, 25, 73, 114, -127, 36, -46,
+        -101, 66, -4, 40, 48, -9, 10, 48, -9, -22, 34, 83, -122, -20, -125, 21,
+        -118, -10, -92, 4, -109, 26, -84, -96, -63, -78, 4, -47, -89, 43, 97, -35,
+        65, -121, -82, -61, 43, -98, 53, 26, 124, 68, -63, -122, -7, -49, 44, -67,
+        41, -54, 73, -28, 83, -7, -64, -71, 92, -8, -55, 20, 61, 102, 51, -109,
+        66, -54, 73, 26, 47, -33, -49, -36, -10, -122, -123, 65, -60, -70, -51, -33,
+        -48, 107, -110, 73, -83, -88, 11, 4, -115, -102, -103, -84, 102, -106, -62, 93,
+        -12, -100, -38, -117, 3, -47, -25, -115, 104, -53, 58, -3, 94, -43, 53, 57,
+        -90, 46, 33, 52, 117, 9, -123, 70, 12, 37, 24, -121, 38, -104, -101, -38,
+        -89, 66, 43, -64, 22, -70, -128, -7, -109, -65, -28, -28, -30, 84, 82, -41,
+        126, 36, 105, 107, 64, 39, -115, -97, 86, 106, 12, -99, 74, 107, 72, 2,
+        -61, -32, -66, -94, -2, 2, -48, -49, -71, -114, -84, 104, 22, 78, -108, 28,
+        10, 7, 101, 25, 10, -113, -55, -41, 37, 82, 95, -25, 50, 57, -65, 72,
+        35, -61, -88, -123, 65, -34, 37, -74, -96, 82, -27, -77, 94, -123, -70, -31,
+        49, 122, 36, 1, -123, -119, 99, -89, 97, -95, -59, 53, 100, -63, 97, -90,
+        -104, -15, 28, 57, 85, 13, 96, 95, -54, 88, -51, -45, -96, 126, 48, -93,
+        -6, 87, -126, -28, -26, -35, -93, -44, 119, 22, -92, -52, -68, 26, 110, 30,
+        103, -22, -11, -76, 41, -88, -84, 82, -103, -27, 2, -13, 122, 24, -71, 92,
+        -9, -127, -117, -110, 55, 124, 50, -17, -62, -30, -106, -93, -71, -85, 101, -100,
+        0, 37, 71, 20, -91, 8, -89, -91, 125, 17, -61, 74, 79, -113, -18, -1,
+        -89, 44, -83, -3, -60, -126, 125, 98, 95, -106, -4, 61, 61, 101, -121, 115,
+        99, 84, 110, 44, 61, 87, 70, -72, 23, -126, 18, 96, 125, -11, 19, 18,
+        -106, 115, 101, 20, 102, -82, -116, -20, -103, -71, 50, -78, 63, 39, 87, -122,
+        20, -107, -59, 44, -73, -95, -44, -127, -58, -82, 66, -36, 73, 93, -48, 7,
+        -104, -83, 55, 7, -68, 62, -65, -56, 85, 2, 5, -127, -34, 101, -104, -116,
+        109, -112, -38, 18, 53, 108, 74, -119, 26, 114, 83, 85, -51, -51, 117, -76,
+        -114, 71, 115, -111, -105, -63, 12, -84, 36, -78, 52, -104, 89, 58, -56, 34,
+        -121, -36, -118, 87, 123, -111, -62, -49, -32, -68, 88, 58, -24, -52, -86, -101,
+        125, 89, -122, 12, 97, -52, 38, 50, 17, 73, 37, 116, -20, 78, 26, -42,
+        7, 120, 68, 52, 98, 19, 74, -65, 22, 5, -73, -78, -119, 99, -92, 53,
+        -117, -85, 11, -60, 76, -5, -5, 112, -84, 124, 119, -17, 53, -84, 0, 77,
+        7, -58, -109, -75, 119, -17, -16, 56, 61, -77, -105, -5, -67, 0, -127, 29,
+        -20, -15, 14, -10, 88, -14, -39, 98, -113, 119, 98, -113, 31, -126, 73, 73,
+        74, -124, 105, 53, 31, 26, 65, -121, -99, -108, -37, -32, 32, 60, -48, 109,
+        34, -31, 65, 49, -5, 59, 9, 15, -109, 3, -90, 102, 6, 100, 100, -10,
+        -4, 45, 60, 124, -123, 57, -119, -31, 3, -121, 53, 114, 17, 51, -31, -8,
+        -42, -107, 62, 80, 6, 96, 93, 66, 85, 30, 108, 11, -69, -20, -28, 27,
+        12, 9, -36, 2, 14, 4, 16, -59, -84, -123, 70, 43, -51, 24, -5, -90,
+        -6, -95, 27, 91, -18, 11, 54, -2, 14, -122, -22, 8, -111, 65, 108, 65,
+        -49, 42, -34, -121, 103, 4, 38, 59, 57, 105, -22, -30, -127, -7, 64, 24,
+        45, 108, -46, -118, 27, -41, -69, -31, 83, 67, -25, -10, -50, -118, -94, 16,
+        51, 47, -12, -71, -122, 109, 37, 90, -55, 12, 87, 116, 114, 64, 87, -85,
+        83, -23, 34, 53, 113, 118, 99, 47, -5, -67, 70, 4, 88, -27, 76, -121,
+        -13, 33, 43, -86, 64, 51, 107, 80, -94, 39, -94, 13, 20, -67, -112, 17,
+        -67, -112, -110, -91, 86, 66, -106, 90, 75, 65, 59, -112, -15, -32, -108, 91,
+        66, -48, -90, 17, -63, 44, 81, 23, -46, -52, 93, 77, 86, -120, -42, -107,
+        37, -85, -119, 21, -10, 75, -124, -63, 28, -5, -90, 95, 19, 50, 7, -91,
+        -97, -9, -8, 113, -35, 75, 119, 39, 123, -108, 102, -109, 15, -126, -128, -71,
+        -83, 16, 48, -105, -70, 125, -76, 119, 19, 44, 57, 89, 127, 5, -65, -92,
+        -116, -20, 45, 60, -120, 33, 123, 31, -80, -114, 126, 0, -81, -75, 2, -62,
+        -48, 31, 3, -51, -38, -55, 76, -67, -120, -103, -78, -14, -79, 59, -76, -107,
+        -6, 102, -31, -96, -64, 80, -79, -63, -125, -123, -107, 122, -35, 31, -38, -118,
+        59, 125, -33, 86, -84, -76, 29, -17, 2, -45, -51, 90, -60, -122, -18, -84,
+        -49, 46, 71, 81, -39, -62, 35, -46, -59, 3, -107, 26, 126, -49, -35, 123,
+        -65, 7, -119, -9, 9, 112, -32, -89, -117, 98, -16, 73, -96, -68, 31, 2,
+        -51, 76, 35, 27, -113, 62, -75, -5, -54, -30, 91, -106, 32, -118, 120, -88,
+        -75, -114, -2, -84, -51, 91, 40, 22, 114, -34, 80, -10, 94, 91, 5, 48,
+        108, 77, 7, 5, 74, -50, 0, 84, -99, -49, -99, -121, 122, 13, 5, -29,
+        121, -46, 118, -119, -31, 98, 67, -74, 10, -19, -16, -62, 68, -76, -11, -96,
+        39, 50, 101, 106, -105, 27, -35, -19, -2, -30, -63, 20, 20, 72, -7, -83,
+        -5, -56, -19, -118, 117, 35, -108, 26, 91, 54, 110, -115, -16, 80, -109, 45,
+        60, 102, -20, 99, -19, 80, 96, -1, -30, 105, 84, 72, -89, -121, 53, -6,
+        92, -72, -113, 81, -89, 99, -40, -69, -68, -120, 94, 7, -67, 97, -28, -9,
+        -10, -108, 119, -123, -83, 44, 91, -103, -115, -82, -96, -87, -106, -4, 48, 76,
+        -126, 119, -50, 71, -72, -72, 124, 7, 127, -55, 61, -57, -85, -84, 122, 25,
+        -2, 14, 85, 118, 90, 21, 64, -124, 43, 25, 20, -1, 7, 84, 39, 75,
+        101, -51, -125, 77, 89, 51, -100, -21, -54, -103, -71, -120, -94, -17, 77, -40,
+        -81, -33, 93, -18, -68, 89, 101, -20, 76, -37, 84, 41, -56, 15, 61, 76,
+        1, -79, 51, -92, -38, -104, -59, 33, -13, 126, -13, 63, 113, -18, 12, 37,
+        -37, 63, 11, -99, -128, -106, -18, -114, -55, -61, -123, -48, -121, 8, -120, -52,
+        -24, 6, -69, 16, -35, -17, -50, -3, -33, -71, 46, 100, -59, 117, 33, 115,
+        -95, 11, -103, 40, -10, -17, 74, -79, 127, 111, 53, -107, -53, 84, -45, -72,
+        -52, 12, -123, -53, -62, -44, 6, -96, 23, -28, 44, -8, 89, -61, -70, 83,
+        120, 82, 24, -7, -83, -10, 14, 16, -97, 122, -27, -67, -76, -56, 90, -98,
+        -98, 14, 109, -120, 113, 123, -29, 38, 3, 34, -5, -48, 14, 110, 25, 91,
+        -98, 26, 92, -7, -75, -67, -100, -33, -79, -116, -121, -3, 9, 54, 86, -45,
+        -110, -124, -34, 27, 47, -13, 62, 121, 34, -106, 17, -25, 116, -71, -5, -31,
+        101, 58, -29, -15, -6, -60, 86, -84, 68, -92, 123, -1, -115, -36, 68, 99,
+        99, 75, 107, 37, -40, 113, -79, 33, 98, -125, 12, 78, -5, -38, 88, 124,
+        -125, 39, -1, 96, -20, -111, 117, 23, 43, 108, 122, 121, -16, 77, 118, -46,
+        116, 55, -109, 5, -85, -104, 24, -35, -44, -58, 37, -88, 88, -8, -33, -24,
+        122, 86, -105, -75, -26, 37, 84, 78, -19, 42, -120, 54, -99, -68, -41, 77,
+        52, -120, -29, 44, 41, -114, 115, 79, -13, 113, -51, -76, -75, -114, 61, -90,
+        -17, -9, 53, -125, 0, 15, -72, 67, -106, 3, -91, -62, 43, 114, 102, -32,
+        49, 45, 39, 1, 43, -58, -102, 48, -34, -50, 98, 118, -119, -123, -61, 40,
+        97, 68, -117, -75, -22, 115, 69, -70, 3, 45, -46, -74, -80, 56, 70, 41,
+        52, 77, -106, 111, -126, 19, 3, 120, -27, 24, 46, -126, 75, -32, -106, -74,
+        15, 27, -127, -74, 19, 90, 26, 41, 84, -27, -96, 23, -103, -96, 5, -84,
+        27, -83, 11, -125, -63, 28, 3, 17, -117, 47, 76, -27, 23, 76, -63, -84,
+        8, -103, -93, 100, -101, 77, -87, 87, 44, 32, -62, -55, 55, -126, 15, 2,
+        10, -51, 123, 68, 2, 7, -13, 116, -35, 17, -19, -58, 40, -83, -91, -92,
+        -76, -90, -52, -15, 102, -90, 8, -82, -123, 70, -51, 17, -71, 38, 81, -57,
+        -54, -96, -13, -26, 6, -99, -73, 45, -47, 121, -109, 50, -60, -34, 11, -72,
+        -36, 85, 104, -76, -121, -32, -34, -122, 102, -124, -99, -128, 38, 80, 68, 16,
+        54, 85, 67, -42, -106, 46, -79, 96, 102, -59, -83, 59, -76, -42, 29, 109,
+        -127, -65, 28, -5, -10, 119, -31, -72, 124, -95, -95, 117, -12, -67, -124, -31,
+        101, 88, 32, -14, 98, -66, 21, 79, 79, -9, -11, 2, 43, -63, -7, -72,
+        -26, 125, 71, 3, 69, 102, 36, 68, 113, 14, -80, 72, -6, 75, -74, -33,
+        -105, 65, 105, 4, -61, 68, 9, -30, -17, 45, -12, -96, -97, 35, 78, -42,
+        36, 89, -25, 64, -9, 38, 101, -25, 96, -91, -9, 28, 37, -24, 71, -77,
+        -124, 127, -58, -24, 10, 60, 103, 49, -6, 108, 30, -66, 28, -102, -47, 58,
+        -115, -21, -46, 47, -111, -67, 18, -25, 87, 104, -46, 127, 88, 3, -65, -124,
+        111, 23, -19, -32, -45, -38, -71, 114, 61, 78, 28, -30, -96, -48, -38, 98,
+        19, 44, -4, -115, 120, 87, 89, -33, -119, -5, 8, 13, 119, -20, -42, 72,
+        70, -119, 114, 69, -15, 102, -93, -103, 122, 18, -47, 32, 19, -31, -59, -94,
+        -91, -103, 67, -27, 106, -75, -12, 58, 120, -37, -80, 12, 111, 113, 25, 62,
+        -16, 101, 0, 34, 31, -90, 113, -115, 49, 95, -40, 44, 62, 114, -105, -120,
+        -115, 28, -38, -51, -24, 70, 13, 6, 109, -4, 110, -35, -74, 124, -43, 83,
+        37, 36, -62, 22, 37, -12, 23, -58, -34, 110, -3, -34, 26, 112, 50, 104,
+        -31, 10, 11, -112, -115, -53, -28, -15, -113, 74, -97, 64, 107, -122, 6, -64,
+        124, 85, -88, 55, 76, -92, -59, -125, 30, -34, 91, 104, -20, -95, 6, -94,
+        -126, 56, 46, -96, -105, 113, -25, -66, -98, 40, -10, 121, -40, 83, 69, 14,
+        111, -126, -115, -104, -48, 59, 109, 42, -8, 113, 28, -2, -34, 24, 33, 18,
+        -27, -26, 0, -67, -115, -10, 120, -117, -79, 112, -117, 117, -76, 18, -14, -93,
+        -121, -95, -77, -128, -91, -27, -3, 103, -52, -111, -84, -11, 99, 75, -82, 33,
+        21, -92, 94, -21, 31, 45, -12, -55, -37, 28, 87, -45, -11, -43, 97, -30,
+        -25, 75, -63, -110, 26, -108, 124, 68, -29, -21, -46, 97, 33, -81, 102, -19,
+        115, -43, -119, 91, 64, 118, 104, -52, 101, -86, 53, -103, 82, 19, -33, -79,
+        -20, -75, 91, -51, 4, 5, 100, -120, -94, 59, -26, -118, -72, 88, 40, -30,
+        66, -117, 109, 104, 35, -97, -22, 34, 5, -86, 4, 126, -54, 73, 65, 26,
+        65, -59, 99, 88, 1, 12, 51, 92, 114, -42, 65, -95, -96, -39, -3, -45,
+        83, -97, -73, -112, 25, -66, -104, 107, 76, -13, -107, 27, 121, 112, 73, -75,
+        -5, 21, 69, 127, -89, -6, 73, -11, -14, -20, -36, -61, -88, -59, 66, 79,
+        86, 119, 75, 103, -82, 50, -47, 31, 60, 0, -41, -109, 61, 116, 63, -26,
+        81, 4, 39, -3, -26, -65, 54, -80, 110, -77, -32, 113, -17, 89, 95, 116,
+        23, 24, 119, 20, 110, -36, 6, -61, 90, 90, 57, 118, 50, -104, -17, -110,
+        48, -86, -35, -15, 71, 110, 72, -53, -30, -25, 5, -36, -22, -107, 4, 75,
+        65, -56, 39, -68, -52, -14, 117, 84, -84, 127, -104, 45, -116, 47, -23, 9,
+        -72, -48, -16, 93, -21, 71, -21, 5, -8, 112, -31, 74, 124, -107, 101, -7,
+        44, 78, 97, -64, 69, 96, 115, 86, 25, -111, 77, -76, 54, 86, -31, -22,
+        -60, -57, -118, -23, 55, -95, -2, -103, -2, -95, 84, 43, -94, -17, 73, 58,
+        -111, -98, 94, 7, 90, 101, -110, -115, 71, -64, -99, 70, -54, -100, 50, 66,
+        118, -108, -101, 63, -121, -76, -51, -103, 87, -76, 81, 95, 124, -106, -115, 89,
+        -62, 73, -6, -83, -20, 89, 14, 118, 64, 13, 82, 104, -118, -71, -33, 67,
+        -34, 65, 42, 19, 13, -14, -11, -104, 110, -42, 120, 4, 3, 61, 126, 32,
+        105, -67, -102, 38, 32, -100, 31, -115, 37, 16, -74, -57, 4, -111, -31, -128,
+        -59, -56, -25, -63, 6, -8, 66, -74, 67, 99, -45, -67, 66, -33, 116, 45,
+        -26, 97, 46, -70, 102, 54, 39, -103, -2, -15, 78, 110, -19, -38, -24, -72,
+        -99, 123, 122, 115, 61, -65, -105, -124, -53, 8, -109, -42, -63, 8, 40, -99,
+        98, -90, -92, 49, -39, -80, 7, -92, 103, -86, 10, 82, 40, 72, 121, 26,
+        -101, -40, -110, -36, 62, 22, -23, -5, -94, -77, 92, -124, -84, -77, 120, 66,
+        -96, 51, 14, 29, -7, -45, 98, 32, -29, 30, -30, 24, 78, 11, -41, -125,
+        -10, 108, 74, -16, 101, 58, 43, 80, 34, -19, -111, -84, 10, -7, -128, -89,
+        7, -77, -128, -127, 54, 0, 101, 111, -64, -58, -64, -19, -62, 48, -78, 68,
+        -84, 62, 0, -29, 72, -36, -67, -98, -37, -53, 67, 84, -61, 61, 67, 83,
+        116, 91, 39, 111, -47, -105, 42, 79, -97, -56, 72, -124, 6, 23, -6, -63,
+        4, -6, -64, 102, 25, 85, 8, 111, -45, 82, -5, -105, -67, -127, -125, 4,
+        55, -89, 50, 92, 54, -66, 72, -40, 75, -124, 36, -127, -125, -3, 15, 29,
+        76, 48, 38, -58, -101, -65, 14, 50, 92, -70, -124, 121, 46, -92, -18, 16,
+        83, -60, 114, -127, 70, -20, -120, -18, -6, 46, -97, -122, -21, 59, 20, 122,
+        -108, -127, -70, 3, -117, 6, 125, -94, -66, -126, -27, 107, 45, -31, 4, 120,
+        75, -67, -32, -90, 32, -16, 64, -59, 65, 67, 85, -75, 110, -95, -18, -94,
+        44, -48, 17, -113, -13, -120, -113, -24, 83, 16, -54, 64, 16, -91, 23, 5,
+        33, 16, 35, -101, 32, -6, -21, -48, -113, 85, -10, 0, -77, 61, 119, -123,
+        107, 16, 62, 23, -16, -20, 25, 79, 103, -91, -54, -79, 62, -74, 66, 15,
+        49, -125, -63, 101, -32, -62, -128, 75, 98, -125, 9, 113, 97, 91, -120, -70,
+        87, -75, 115, 29, 29, -10, -22, -32, 44, 102, 56, 69, 97, 20, -39, 62,
+        51, -37, 99, 4, 92, -54, 34, -23, -70, -11, 93, 101, 4, -106, 66, -37,
+        101, -84, 70, -68, 47, -99, -124, 23, -28, -73, 5, 108, 53, -64, -90, -5,
+        88, 62, -85, 0, 23, 42, 100, 44, 20, 36, -116, -97, -59, 0, -113, -52,
+        -112, -99, 57, 63, 3, 11, 75, 67, 34, -95, -31, 20, -58, 52, -67, -120,
+        -59, -104, -90, 48, -90, -39, 104, 58, -122, 81, -59, -16, -121, 29, -22, 101,
+        -128, 113, 62, -60, 103, 61, 75, -109, 5, 63, 95, -44, 8, -104, -127, -23,
+        120, 116, 62, -18, -48, -33, 30, 127, -2, -118, 63, -9, -7, -77, 40, -17,
+        -93, -37, 14, -51, 125, 1, -97, 81, -77, 19, 107, -80, -40, -17, 121, -42,
+        -26, -97, -41, -34, -113, 107, -17, -5, 6, 55, -106, 35, -99, 88, 116, 83,
+        65, -45, 3, -91, 106, -15, -73, -44, -36, 68, 46, -47, -49, -97, 39, -79,
+        85, -38, 98, -85, 19, 75, -125, 98, -103, -69, -96, -80, 36, 114, -93, -15,
+        -47, 46, 33, 101, 45, -116, 72, -36, 91, -26, -121, -117, 74, 20, 103, 116,
+        59, 107, 72, -28, 68, 36, 13, -49, -20, 17, -41, 36, 96, -53, 7, -116,
+        78, 27, -115, 85, -20, 89, 107, 98, 100, 33, 99, -88, 11, 38, -91, 114,
+        9, 81, 72, -36, 76, 32, 62, -103, 9, 61, -115, 22, -60, -9, 7, -6,
+        -14, 51, 43, 27, 10, -71, 70, 47, 29, 45, -21, 50, 23, 111, -41, 36,
+        85, 94, 19, 107, 107, 31, 107, 57, 5, 0, -37, 19, -26, 102, -85, 63,
+        -62, -84, 49, 118, -69, 124, -26, -64, -34, -35, 82, -34, 101, 24, 120, 51,
+        117, -24, -24, -103, -89, -107, -59, 71, 108, 51, 89, 108, 78, 123, 28, 62,
+        39, 111, 6, -33, -40, 35, -126, -79, -58, 86, 67, -61, -76, 41, 24, 107,
+        42, -64, -27, -88, -80, -1, -53, -96, -74, -30, -128, 37, 11, -118, 68, -24,
+        116, -103, 1, 32, -121, 59, 40, 21, 18, -76, -80, -39, 2, -79, -61, 77,
+        16, -9, 8, 80, -43, 21, -52, -59, -115, -66, 12, -56, 109, 111, 26, -112,
+        -49, -34, 12, -2, -100, 35, 90, -52, 1, 57, 1, -109, 24, 42, -101, 25,
+        -62, -103, -99, -91, -73, -24, -96, -67, 78, -21, -33, -26, -13, 121, -53, -21,
+        3, 12, -24, -22, -15, -40, 102, -88, -54, 87, -67, -69, 41, 34, 25, 37,
+        -16, -78, 96, -79, 78, -121, 115, 61, -42, -120, 97, -92, 0, -117, 61, -40,
+        -120, -40, -16, 24, -49, 96, -70, -13, -89, -36, 56, 38, -27, 41, -94, 51,
+        -113, 69, 66, -57, -127, -15, 88, -24, 48, -66, -67, -16, 15, -118, -28, 97,
+        -63, -32, -86, -80, -120, 44, -75, 122, 121, -113, 72, -8, -105, 2, -11, 23,
+        -55, -93, -122, -42, 40, 43, 54, 18, -107, -113, 40, -82, -119, 95, -103, 1,
+        -89, 87, -1, -82, 43, 115, -103, 1, 35, 60, 15, -114, -87, -56, -58, -65,
+        13, 10, -51, -26, -127, -91, -64, 22, 14, 31, -36, -10, 33, 45, 39, -30,
+        -50, -10, -72, 104, 7, 100, -68, -30, 24, -96, -35, 111, 75, -26, -13, 122,
+        36, -85, -123, 45, 101, -82, 16, -53, 102, -28, -110, -40, -120, 112, -64, 24,
+        93, -94, -19, -64, -102, -69, -64, 80, -62, -90, -76, 29, 88, 116, -4, -3,
+        -64, -19, 103, -8, 86, -12, -10, -34, 125, 32, 66, 81, -40, 119, -54, 114,
+        98, -76, 123, -126, -97, -104, -109, -109, -105, -79, 45, 77, 4, -125, -32, -69,
+        -96, 63, -120, -85, 57, 41, -100, -69, 32, 62, -100, 124, -126, -89, 117, -32,
+        104, -54, -39, 120, 19, -17, -34, -69, 35, 123, -98, -122, 79, -18, 2, 76,
+        23, -92, -35, 98, 106, -92, 26, 52, 83, 14, 6, 118, -57, -95, -112, 115,
+        23, -104, 77, -104, 49, 85, 92, 19, -109, 33, 29, -21, 125, -107, -33, 113,
+        -112, 107, 120, -35, -59, -51, 37, -113, -77, -61, -43, 106, 23, 98, -25, 50,
+        108, -125, -124, 2, -100, -96, 55, 89, 74, -103, 66, -99, 28, -125, 35, -53,
+        -43, 85, 105, 34, 84, -70, 121, 117, 87, -48, 103, -68, 71, 118, 117, -105,
+        -47, 42, 127, -85, -85, -30, -86, 32, -51, 115, -53, -73, -128, 68, 69, 27,
+        -114, -56, 8, -34, 99, 67, 52, -107, 1, -111, 80, 88, -122, -1, -80, 13,
+        -100, -27, -119, -97, -13, 9, 82, -62, -41, 91, -104, -76, -8, 36, 87, -112,
+        -35, 122, 15, 34, 56, -72, -12, 44, 83, -121, 69, 106, 71, -75, 20, 88,
+        -108, -116, -37, -65, -11, -74, -64, 118, -76, 103, -20, -68, 56, -45, -10, 2,
+        126, -75, 35, 83, 52, -45, 126, 56, -5, 74, -94, 53, 58, -19, 31, 0,
+        -11, -93, 0, 75, 12, -53, 127, -48, 83, -105, -38, -90, 33, -63, -16, 18,
+        115, 124, -27, -39, 26, -73, 52, 123, 19, -81, -103, -106, -27, 18, -58, 127,
+        43, 103, -32, -55, -116, 126, 92, 32, 4, -115, 18, 110, 119, -124, 87, 120,
+        34, -14, 101, -27, 60, 47, 36, 22, -26, 122, 20, 42, 1, 16, 7, -125,
+        -13, 115, -34, 24, 45, -57, -127, -125, 51, -125, 68, 9, -66, -71, 87, -43,
+        69, 68, -110, 79, 96, 60, 108, 100, 48, -80, -64, 114, 64, -115, 88, 119,
+        -20, -79, 87, -117, -108, 112, 77, 99, 115, 53, -102, -45, 61, -5, -97, 30,
+        82, -65, 102, 32, -110, -51, 1, 118, -22, -100, -71, -86, -109, 83, -2, 87,
+        -52, -123, 29, 40, -39, -8, 20, -40, -127, 64, -29, -10, -70, -81, 56, -13,
+        -121, 2, -81, -4, 12, -61, -111, -107, -45, 30, 52, 2, -70, 82, -106, -107,
+        -31, -91, 94, -14, -23, 73, -6, -63, 106, -31, -116, -56, -30, 35, 0, 62,
+        18, 14, -88, 29, -116, -120, 50, 74, 24, 19, -47, -82, -25, 47, -38, -81,
+        94, -25, -99, 16, -95, -112, 30, 47, -126, -84, 83, 8, 50, 37, -27, -32,
+        124, 73, 89, -76, -82, 40, 19, 5, -9, 44, -61, 76, -119, 22, -117, 52,
+        74, -46, -121, 8, 0, -27, -53, -44, -42, -23, 124, -37, 83, 17, 19, -106,
+        -35, -83, -41, -46, -30, 37, 44, -69, 59, -81, -27, -66, -96, 102, 120, -116,
+        29, -11, 42, 17, -55, 60, -66, -110, 38, 99, 124, -51, 76, 12, -47, -76,
+        98, 66, -82, 91, 94, -81, 20, -51, 52, -11, -11, 66, -55, -63, 49, 75,
+        85, 116, -30, -109, 19, 88, 47, -4, 49, -124, -65, 62, -4, 101, -50, -17,
+        -84, -73, -17, -62, 34, -102, -67, 79, -33, -123, 91, 22, 81, -98, -31, -94,
+        -75, 119, -57, 11, 48, 101, -127, -64, 44, -111, -118, 125, 39, -104, 113, 64,
+        8, 66, 83, 116, 114, -110, -98, 69, 23, -81, -122, -83, 22, -122, -20, -28,
+        51, 55, 111, -116, 67, -7, 116, 112, -42, 19, 77, 117, 46, 51, 42, 17,
+        113, -71, -10, 30, 49, 38, -33, -42, -61, 20, 95, 59, 78, 42, 8, -90,
+        -109, -109, 11, 34, -95, -54, 30, -21, -58, 84, 55, -106, 117, 99, -77, 110,
+        44, -21, -122, -98, -93, -15, -58, -123, 34, 2, -82, -78, -69, 85, 18, -83,
+        -93, 25, 99, -69, 84, 76, -102, -9, -21, -32, -81, -33, 124, -35, -21, 121,
+        63, 29, 31, -39, -50, -50, 84, -81, -29, -69, -24, 6, 110, -123, -120, 80,
+        -121, -116, -115, -80, 89, 79, 75, 12, 50, -13, -29, -29, 49, -121, -31, -80,
+        70, -40, -14, -17, 31, -81, 44, -116, -80, -68, 100, 62, -118, -50, 63, -58,
+        -42, 92, -58, -90, 35, -94, -108, -56, -78, 20, 68, -30, 22, 14, 19, 110,
+        -106, 32, 125, -34, 93, -103, -72, -39, 12, -123, 76, 98, 77, 89, -122, -29,
+        43, -16, -29, 111, -27, 75, 96, -125, -103, -96, 14, 119, -6, -38, 72, -104,
+        -28, -60, -99, -75, 123, 6, -117, 26, -67, 26, -56, -8, -18, -28, -32, 125,
+        -115, -89, 24, 70, -18, 100, -82, -42, -5, 44, 46, -16, 26, -5, -49, 44,
+        -69, -69, 78, 49, 60, -106, -11, -43, -5, -51, 26, -33, 101, 23, -35, 94,
+        -81, -41, -17, -65, -6, -9, -81, 123, -22, -1, -81, -122, -75, -35, -11, -4,
+        -20, -11, -85, -24, 107, -54, 19, 95, -41, 45, -49, -128, -103, 6, 57, 29,
+        38, -36, -115, 52, 94, 23, -13, 60, -69, -61, -121, 98, 29, -34, -83, 40,
+        34, -123, -40, 80, 68, 123, -123, -59, -111, 51, -61, -12, -89, 103, -25, 95,
+        3, -125, -75, 60, -5, -90, 7, 12, -42, 20, -1, -16, 16, -103, -13, 36,
+        -125, 27, -30, -4, -21, -45, 76, 6, -116, 101, 69, -3, -81, -65, -18, 97,
+        -31, 74, 47, -52, 78, -33, -81, -111, 47, -47, -117, 48, -86, -85, -2, 124,
+        -10, 21, 80, 46, -109, 82, -47, 55, -81, 48, 8, -11, 35, 44, -8, 59,
+        32, -15, -29, 34, 2, -80, -101, -7, 105, -41, 44, -16, -32, -15, 70, 123,
+        117, 35, 75, -33, -59, 41, 32, 84, -47, 0, 127, 99, -23, -113, -39, 38,
+        103, 101, -8, 11, 75, -128, -18, -31, -75, -16, 23, -75, 4, -4, -78, -28,
+        13, -15, 39, -106, 125, -114, 66, -34, 14, 127, -19, -67, -69, 0, 56, -113,
+        -68, 88, -1, 35, 76, -4, 123, 111, -70, -55, -47, -34, 69, 31, -24, 125,
+        121, -96, -68, -50, -115, -10, -6, -58, 120, -61, 7, 124, -81, 13, -104, -65,
+        -95, 65, -33, -53, 65, -117, -6, 56, 54, 26, -3, -67, 28, 61, 127, 101,
+        47, 101, -13, -70, 87, -13, -30, -27, 52, -73, 123, 49, 55, -96, 100, 119,
+        5, -63, -63, -5, -108, -94, -44, -6, -119, 7, 76, 65, 110, -106, -47, -94,
+        -64, 16, -51, -46, -87, -57, 38, 107, -106, -50, -128, 84, 67, -58, -17, -3,
+        -100, 77, 24, -87, 67, 81, -62, 38, 90, -8, 27, 89, -126, 83, 44, -4,
+        -123, 124, -2, 30, -122, 3, 28, -92, 108, -128, 35, 47, -4, -83, 44, -64,
+        49, 23, -2, 100, 63, 40, 30, -30, -11, -108, -5, -116, -93, 119, -79, 56,
+        -90, -18, -29, 20, -18, -108, -42, 14, -21, -75, 124, -82, 67, 99, 18, 29,
+        108, 75, -24, -56, -71, -29, -114, 112, 3, -86, 123, 71, 31, 105, -7, -12,
+        -80, 12, -109, -7, -81, -40, -70, -44, -104, 70, 82, -33, -6, 87, 92, 71,
+        -34, 5, 47, -127, 107, 125, -99, -110, 82, -102, 21, 107, 53, 30, -94, -24,
+        -106, -73, 48, 62, 2, -77, -73, 125, -126, 54, -92, 84, 21, 23, -50, 58,
+        28, -74, -60, -65, -50, 49, -68, -114, 24, 16, 43, 43, -49, -120, 74, 109,
+        125, -16, 109, -3, 21, -104, 106, -47, -123, 40, -46, -69, -27, 101, -91, 110,
+        -39, -82, -117, 110, -9, 90, -98, 29, -13, -82, -87, -54, 26, -103, 38, -30,
+        81, -92, -61, -11, -41, 50, 51, -82, -73, 1, -44, 6, -49, -8, -57, -61,
+        -51, -127, -33, 59, 14, -67, 62, -54, 10, 119, 67, -6, -41, -17, 19, -16,
+        66, 17, -2, 25, -78, 63, -64, -20, -45, -114, 64, 41, -3, 109, -9, -9,
+        -100, -114, 96, 59, -43, 34, 61, 15, 118, 61, -28, -50, 25, 49, 115, -50,
+        96, 29, -118, -20, -82, -12, 23, -19, -69, 124, -36, 73, -43, -24, -23, -119,
+        -10, -89, -74, 23, -93, 61, -74, 102, -69, 113, 92, 125, 126, -18, -12, -26,
+        108, -43, -97, -37, -100, -3, -32, 7, -106, -78, -128, -30, -113, 61, -53, 4,
+        32, -56, -86, -99, -43, 14, -120, 113, 73, 24, 0, -110, 80, -10, 52, -118,
+        19, -57, 118, -113, -12, -49, 123, 46, 25, -96, -47, -89, -107, 72, -86, -88,
+        -122, 2, -72, -68, 67, -61, 40, -72, -34, -30, -6, -73, -82, -73, 19, 70,
+        70, 49, 57, -93, 106, 23, -122, 120, 115, 22, 115, 30, 55, -61, 107, 22,
+        -17, 97, -127, 23, -62, 6, -92, 64, 127, -43, 2, 66, -25, 25, 93, -89,
+        -6, -119, 83, 88, 32, 10, -2, -35, 59, -94, -123, 64, 34, -72, 82, 71,
+        87, -41, 113, 4, 52, 124, -59, 91, -66, 84, 45, 57, -120, -66, 84, -48,
+        -58, -6, -14, -66, -22, 113, 47, -35, -76, -90, 107, -122, 94, -96, -41, -98,
+        87, -122, 115, 49, -96, -122, 78, 52, 12, 21, 5, 127, -83, -19, 65, 111,
+        34, 63, 120, 84, 109, -114, -45, -52, -77, 100, 93, 41, 11, 66, 43, 97,
+        -93, -4, 47, -81, 94, 6, 61, -37, 52, 76, 76, -106, -1, -91, -33, -45,
+        42, -94, 4, -115, -113, -125, -36, -37, 117, -120, -127, 83, 109, 126, -40, 86,
+        -61, -24, -67, -87, 66, 77, 23, 46, -102, 124, -67, 76, -91, 114, 121, 47,
+        92, -25, -100, -4, 47, 81, 16, -12, -98, -98, 48, 108, -126, 94, 65, -25,
+        -124, 35, -92, -77, -65, 7, -100, -102, -94, -31, 86, -63, 89, -87, 55, 36,
+        77, 58, 28, -115, 90, -40, -116, 48, -23, -45, -9, -92, 30, 38, -67, 46,
+        -49, 122, -125, -106, 76, 90, 74, -106, -113, 55, 78, -24, 106, 50, -52, 50,
+        117, 93, 8, -99, 56, 25, 6, 100, 107, 45, -79, 42, -39, 5, -95, 18,
+        -70, 112, -36, 106, 64, 86, -79, 22, -11, -14, 25, -96, 61, -47, 59, -30,
+        -101, -34, 105, 36, 78, 55, 108, 30, -99, -24, 23, 107, -92, 28, 95, -65,
+        -14, 43, 100, 64, -64, 15, -69, 6, 12, 47, -42, -81, -1, -118, -55, -75,
+        -85, 85, -43, 105, 55, -85, -9, -1, 106, -83, -50, -113, -70, 89, -9, -37,
+        -122, -86, -38, 49, 55, 27, 125, -45, -44, -120, -50, -109, 89, -1, 43, 107,
+        125, 117, 86, -51, -38, -25, -74, -54, -107, 122, -47, -21, -13, -18, -41, -42,
+        85, -95, -109, -95, 87, -115, 95, -9, -83, 75, 109, -98, 20, -77, 69, 83,
+        -125, 114, -25, -74, -86, -58, 25, -45, -21, 3, 60, -60, -81, -49, 123, 77,
+        109, -116, -15, -52, -94, 121, -72, 73, -42, 13, -11, 91, 122, -8, -6, 18,
+        -55, -40, 100, -104, 45, 88, 3, 50, -50, -42, -87, 111, 50, -47, -42, -56,
+        110, 50, -42, 46, 19, -36, 116, 101, 26, -28, 45, -58, -77, -108, -12, 57,
+        6, 36, 76, 42, 12, -21, -110, -63, 119, 11, 89, -27, 72, 80, -2, -81,
+        -5, -104, -26, 90, -48, -5, 34, -8, 1, 25, -78, -117, -45, -10, 115, 116,
+        23, -58, 41, -100, 103, -92, -77, -39, -25, 28, -11, 45, -43, -40, -109, -99,
+        -70, -125, 20, -125, -94, -53, 30, 108, 13, -35, -50, -76, -35, 119, 79, -115,
+        -127, 11, -69, -65, 18, -47, -57, 28, -53, 87, 42, -105, 2, 91, -42, -116,
+        81, 120, 75, 70, -36, 101, -100, 96, -37, 50, -126, -19, 93, 54, 115, 98,
+        -8, -64, -98, 91, 28, -96, 49, -94, 28, -33, -55, 73, 79, 60, -46, -56,
+        -71, -63, -32, -105, 124, 54, -84, -5, -84, 22, 89, 16, 83, 71, 0, 57,
+        26, -12, 6, -101, -117, 124, -80, 65, -69, -117, 118, 27, -54, -20, 43, 52,
+        -21, -32, -78, -76, 23, -57, 44, -59, -126, -113, 105, 102, -116, 105, -58, -57,
+        4, 116, 103, 5, 56, 21, 75, -14, 69, -48, 73, -52, 98, 88, 6, -39,
+        -94, 4, -78, -71, 13, 100, 51, 13, 100, 25, -117, 6, 112, 26, 98, -68,
+        97, -116, 85, 89, -126, -43, 41, -57, 104, 45, 111, -58, -92, -43, 26, -64,
+        -70, -113, 73, -32, 44, -53, 107, -57, -70, 116, -48, 118, 84, -125, 49, -36,
+        -117, 83, 60, 16, -38, -2, -124, 34, 1, -24, 34, 40, -38, -80, 114, -6,
+        -69, 20, 101, 19, -23, -128, -20, 108, -32, -54, -97, -14, 35, -125, -87, -70,
+        -96, 98, -33, 91, -76, -125, 89, 27, -77, 64, 30, -79, 57, 9, 95, -32,
+        21, -37, -100, 41, -37, -100, 5, -33, -100, -115, -128, -52, 103, -12, -108, 26,
+        61, 21, 85, -48, 11, 117, -64, -101, 7, -88, -49, -97, 4, 9, 102, 57,
+        -11, 80, -99, 120, 127, -111, 13, -18, 1, -12, -18, -48, 67, 19, -25, -24,
+        -52, -11, -55, -49, 93, 119, -88, -90, 76, -13, -12, -27, 70, -24, -55, 79,
+        127, 93, 68, -76, -47, 78, -31, -51, -67, 25, -26, -120, -84, -37, -114, -71,
+        -73, -125, -11, 111, 79, 6, 76, -35, -122, -33, -100, 15, 119, -2, 124, 112,
+        -60, -84, 39, 124, -42, 15, -58, -84, 119, 124, -42, -84, -85, -66, 63, -57,
+        8, 11, -19, 118, 21, 13, 11, -66, -8, -49, -61, -62, 21, 25, -121, -127,
+        -122, 113, -34, 94, 86, -127, -28, -108, -82, -49, 22, -123, 7, -26, 32, 12,
+        -69, -78, -124, 93, -103, 6, 101, 51, 66, 33, -87, 126, -99, -43, 44, 39,
+        54, -115, 97, -109, -106, 1, 114, 46, -30, -120, 44, -126, 8, -10, 10, -120,
+        53, 63, -38, -61, 121, 113, -50, -65, -18, 68, 66, 20, -124, 24, 22, 48,
+        13, 0, -17, -44, 89, -110, -32, 122, 32, 113, 31, -66, 63, 57, 49, 48,
+        -29, -48, -127, -13, 6, 13, 52, -88, 80, 104, -46, -43, -66, -71, 84, 109,
+        92, -65, -1, -46, -114, 92, -39, 7, 20, -82, -91, 27, -100, 82, 102, -12,
+        -12, -11, 80, 3, -124, -65, 20, -84, -4, -104, -29, 53, -29, -5, -70, 96,
+        -32, -111, 114, 30, -33, -128, -49, -48, -37, 120, -64, -78, 84, -50, -55, -58,
+        37, 41, -64, 82, 59, 45, -85, 96, 38, 34, 117, -80, -64, 28, 98, -29,
+        104, 96, -72, -66, 27, -49, -42, -71, 48, 30, -80, -67, 27, -84, -112, 16,
+        45, -38, 43, 30, -34, 20, -105, 122, 57, 52, -58, -31, 47, -113, 57, 10,
+        43, 62, -41, 123, 99, -82, -109, -38, -119, -95, -13, 98, -27, 64, 72, -23,
+        -49, 115, 79, -60, -15, 72, -33, 34, -15, 51, -16, 62, 73, -18, 120, -12,
+        -96, 107, 67, -73, -58, -28, 33, 0, 86, -42, -128, -117, -21, -41, 105, -61,
+        -119, 40, 92, -78, 64, -23, 99, -24, 112, 64, -51, -113, 108, 85, 34, 84,
+        -72, -61, 36, 97, 29, -90, 95, -42, -21, 16, -5, 99, 103, -22, -101, 94,
+        -57, -47, 96, -72, 29, 41, -31, -20, -39, 55, 0, 97, -117, 96, 6, -41,
+        -52, 70, -127, 61, 116, -80, 10, 54, -125, 111, 16, -8, 103, -108, -122, 22,
+        -13, 108, 59, 90, 13, 87, 92, 67, -13, 32, 30, -84, 94, 3, -92, 64,
+        -75, 21, 84, -101, 35, -80, 49, -86, -69, 37, -96, 107, 9, -104, 52, 116,
+        -39, 62, 3, -70, -99, -62, -29, -60, 125, 14, -123, -80, 97, -112, -109, 16,
+        120, -52, -103, -60, 107, 85, 123, -113, 76, 48, -16, -36, -86, -35, -106, -89,
+        -29, 30, -18, -65, 59, 56, 29, 119, 112, -125, -48, -19, -127, 122, 79, -79,
+        105, 52, 120, 119, 69, -121, -102, -99, 25, 26, 48, 78, 99, -62, -57, -20,
+        -119, 49, -41, 92, 35, 19, 60, 45, -9, -56, -81, -27, -19, 123, -19, -78,
+        88, 13, -25, -2, -22, -104, 19, 114, 111, 94, 22, -119, -104, 33, -101, -82,
+        113, 115, 88, -26, 89, 61, 44, -102, -96, -13, 80, 66, -103, -86, 104, 95,
+        63, 60, 92, -126, -81, 31, 31, 46, 86, 83, 37, 36, -77, -49, 75, 7,
+        46, 43, 31, -72, -76, 116, -32, -110, -102, 3, -73, 12, -124, -88, -50, 44,
+        -97, -22, 4, 24, 107, 7, -112, -115, 4, -45, 34, 64, -40, -51, -112, -12,
+        -63, 108, -17, -80, 89, 14, 0, 124, -36, -119, -50, -6, -47, 87, -18, -23,
+        -110, -46, -92, -33, 95, 76, -111, 120, 112, 103, -81, 97, -101, 56, 18, 63,
+        -1, -102, -120, 8, 60, 118, 116, 4, 123, -57, -95, -18, -119, 73, -74, 10,
+        -23, 38, -37, -77, -71, 16, 64, -50, 104, -13, 22, 54, -68, -66, -86, -59,
+        -21, -80, -97, -109, 54, 92, 35, 51, -36, -44, -46, -98, 106, 82, -26, -1,
+        47, -17, -87, 109, -17, -106, -38, -34, 113, 21, 9, -20, 39, 80, -73, -72,
+        -125, -74, -3, -125, -115, -21, 68, 46, -18, -33, 105, -62, -73, 111, 73, -37,
+        55, -27, -37, 55, -123, -19, 107, -73, 43, -101, -39, 110, -49, -59, 78, 62,
+        107, 43, -89, 124, 43, -71, -92, -71, -78, -107, 92, -120, 60, -3, 35, 123,
+        58, -43, -10, -108, -7, 63, -1, 76, -66, -42, -36, -72, -75, 81, 126, 69,
+        -94, 127, 33, -77, 102, 94, 26, 119, -116, -11, 115, -8, 47, -68, 58, -30,
+        118, -48, -22, -76, -38, 78, -85, -41, 106, -13, -30, -18, 58, -29, -74, -77,
+        -82, -53, -27, 85, -99, 115, -41, 51, 101, -112, 67, 108, 104, -106, -56, 126,
+        34, -83, -103, -33, -22, -12, -6, 45, 95, -1, -116, -93, -85, 34, 90, -3,
+        -106, -7, -107, -110, -106, 0, 27, -106, -118, 90, 31, -83, -33, -7, -40, -21,
+        -79, -17, 124, 84, -33, -47, -11, 27, 80, 100, 126, -87, -94, 97, -64, -58,
+        -66, -83, 111, -15, 66, 96, -97, -95, 88, 46, 122, 50, 70, 1, -125, 64,
+        111, -50, -78, -10, -95, -71, 107, 104, 36, -11, -49, 40, -18, -121, 50, 84,
+        -123, -1, 39, 116, 21, -53, -3, -41, 68, -112, 71, -38, -49, 43, 59, 16,
+        -85, 18, 41, 20, 74, 8, 109, -61, -71, -127, -3, 53, -73, 89, -58, -44,
+        33, 93, 11, -32, 1, -96, -123, 104, 15, 64, -26, -72, 88, -20, 96, -92,
+        -2, -68, -120, -24, 119, -50, 28, -96, 35, -100, 14, 73, -30, -83, -43, -2,
+        25, -81, -105, -88, -126, -1, 61, 75, -87, -119, -21, 73, -1, -114, -40, 106,
+        78, -63, 22, 64, 24, 43, -75, 102, -77, 23, -17, -34, -67, 67, 54, 35,
+        110, -76, -66, 120, 35, 44, 25, 7, 85, -123, 67, 26, 36, 116, 76, 92,
+        -101, 48, 30, 95, -34, 49, 46, -96, 34, 127, -57, 119, 51, 12, -88, 85,
+        2, 78, -2, 10, 11, 45, 16, 38, 58, 101, 96, 83, 5, 19, -2, -98,
+        21, -93, 91, -111, 46, 120, 38, 91, 121, -58, 64, 87, 94, 52, 46, -104,
+        -56, 36, 55, -109, -37, -25, -25, -98, 77, 125, -56, -128, 42, -84, 85, 35,
+        26, -6, -63, -67, 41, 101, -81, 8, -62, 27, 19, -121, 33, -108, -38, -100,
+        59, 94, -10, 7, 107, 45, -53, 2, 26, -51, 49, 16, 69, -25, 38, -12,
+        85, -33, 105, 96, -84, -56, -38, -120, -61, -79, -12, -3, 87, 13, 121, 25,
+        12, -106, 18, 49, -67, -20, 121, 17, 26, -36, 27, 86, 90, -78, 50, 55,
+        -42, 18, -114, 106, 61, -70, -67, -52, -77, 67, 14, 11, -24, 31, -116, -29,
+        -117, 107, 12, 127, -106, -15, 76, 95, 12, 38, -4, 23, 126, 14, -59, 16,
+        -42, -72, 60, -126, -36, 28, 1, -34, 126, -108, -52, -115, 111, -115, 56, -55,
+        -103, 44, 121, -67, 108, 39, -19, 126, 111, -24, -28, 112, 3, 102, 46, -123,
+        54, 20, 70, 70, -103, -90, -84, -52, -126, -20, -104, -80, 5, -6, 102, -118,
+        -5, -87, 46, 40, -70, -64, 42, 109, 77, -43, 8, 116, -45, -71, -37, -114,
+        -107, -19, -43, 63, -97, -21, -55, 20, 11, -93, -85, 88, 24, 93, 69, -119,
+        61, -87, 40, -108, -84, 68, 8, -50, -54, 24, -39, 42, -81, 75, 25, 115,
+        -68, -56, -76, -45, 2, 24, -116, 52, -105, 1, 0, 58, -36, 62, -106, -72,
+        36, 24, -79, 64, -114, 30, -117, 123, -23, -75, 38, -72, 20, 45, -111, -32,
+        -37, 112, 113, -9, 90, 83, -14, 51, 47, 80, 82, -114, 85, -77, -19, -121,
+        36, 91, -61, 47, -111, 7, -56, 19, 105, -125, -80, -39, -116, -102, 47, 1,
+        -99, -110, -99, 93, 75, -72, 39, -115, 101, 64, -86, 24, 3, 82, 121, -21,
+        -18, 118, -9, -33, 58, -104, -22, 7, -29, 2, -70, 83, -103, 86, 2, -121,
+        -66, 68, 114, 12, -75, 78, 79, 79, -22, -53, -43, 87, -30, 123, -91, 55,
+        46, 26, 48, -105, -45, -91, 47, -27, -105, -32, -37, 84, -105, 82, -76, -64,
+        -67, -89, -68, 27, -16, -122, -91, 95, -41, -33, 67, 37, -116, -32, -118, 17,
+        -38, 127, -32, 73, 79, -93, -124, 23, 70, 9, -59, -15, -98, 101, -45, 13,
+        -126, 4, -65, -82, 56, -128, 56, -83, 89, 124, 15, -41, -24, -99, -80, 40,
+        45, 28, -67, -107, -9, 24, -93, -102, 95, 13, -96, 91, 108, 38, 5, -69,
+        -30, -128, 56, -86, 58, -28, -64, 10, -33, -121, -59, 11, 57, -76, 106, 35,
+        21, 104, -36, 8, 47, -85, 127, -43, -27, 35, -1, 0, 29, 51, 43, 59,
+        -18, 99, 117, -13, -113, -65, 117, -65, -49, -90, -11, -107, -123, 19, 77, -43,
+        67, -22, 30, -120, -63, -42, -10, 46, 73, 11, 31, 109, -124, -127, -40, -72,
+        -124, -73, 12, -120, 126, 2, 100, 44, 77, 104, -3, -106, 102, 22, 43, -84,
+        98, -59, 126, -15, -44, -91, 102, -10, 49, -13, -27, 103, -78, -101, -35, -101,
+        -61, 98, 54, -69, 100, -112, 60, 9, -89, -73, 11, -78, -20, 69, -6, 48,
+        -65, 109, -111, -92, 108, -67, -124, -19, -128, -117, 99, 22, -95, -14, -123, -11,
+        -89, 106, 14, -85, 69, 112, -89, 44, 38, -95, -45, -13, 94, -16, -1, 119,
+        -1, -22, 114, 34, 9, 6, 1, 11, -91, 84, -70, -114, 43, 33, -31, 109,
+        4, -100, -49, 12, -29, 69, -58, -117, -76, 6, 36, 126, -70, -127, -11, -123,
+        14, 126, -70, -15, -112, -90, -62, -102, -17, 39, -65, 49, 7, 26, 11, -104,
+        24, 93, -94, -63, 106, -49, -37, -63, 127, -52, 88, 21, 88, -105, -5, -59,
+        63, 117, 123, 85, 42, 97, -2, 110, -5, -14, -72, -114, -128, -45, 106, -125,
+        6, -17, -97, -124, 42, -39, 91, -103, 6, -44, 4, 24, -120, 122, -42, -21,
+        -107, 127, 118, -10, -16, -16, -48, 125, -8, -86, -101, -27, -117, -77, -2, -73,
+        -33, 126, 123, -74, 93, -82, -17, -110, 86, -51, 50, 90, -63, 88, 125, -55,
+        2, 8, -11, 13, 120, -105, -22, 75, 127, -125, 30, -106, 49, -16, 90, -127,
+        -34, 11, -13, -121, 115, 107, -95, 61, 78, -127, -67, -43, -35, 1, 23, -94,
+        -101, -106, -74, -24, -33, 71, -13, -62, -24, 118, 6, 5, 78, -23, 60, -51,
+        -44, 16, -27, 88, 44, -61, 51, 42, 98, -57, -22, -70, -108, 1, 61, 62,
+        2, -78, 59, -54, -94, 64, 80, 107, -24, 3, 32, 111, -88, 60, 16, 49,
+        -8, 48, 39, 38, -4, -77, 7, -22, -93, 82, -108, 86, -117, -110, 106, -47,
+        -78, 90, 52, -83, 22, -51, -86, 69, -117, 106, -47, 70, 47, 42, -27, 40,
+        18, -107, 6, 50, 14, -93, 73, 44, 69, -34, 74, -124, -106, -17, 41, 75,
+        -89, -11, 104, 53, -26, 105, 122, 91, -45, 44, -39, -36, 81, 42, 20, 89,
+        -118, 55, 9, 39, -45, 85, -59, 82, -96, 71, 12, -120, 22, 54, 92, 42,
+        39, 39, -24, 9, -97, 1, 58, 122, 8, -13, -44, 105, -87, -117, -19, 5,
+        84, 44, 94, -64, 101, -6, 34, -51, -42, 47, -118, -51, 106, -123, 97, 14,
+        102, 47, -30, -12, 69, -8, -30, 46, -34, 70, -77, 51, 74, 98, -10, -126,
+        33, -92, 23, 31, -110, -120, -52, 4, -120, -106, -102, -49, 95, -4, -33, -6,
+        -113, -2, 95, 10, -29, -53, -57, -55, 61, 127, -95, -128, -57, -17, 88, -111,
+        -46, 70, -13, 18, 99, 83, -25, 25, 57, 68, 59, 45, -29, -80, 54, -5,
+        -84, -36, 107, 102, -10, 10, -83, 68, -20, 32, -83, 85, 94, 110, -107, 87,
+        90, 9, -62, -64, 108, -104, -106, 27, -90, -86, 33, 52, -30, 52, -124, -39,
+        38, 41, -73, 73, 42, 31, -45, -87, 19, -77, -15, -76, -36, 120, 90, 105,
+        -84, 17, 23, 90, -61, 89, -71, -31, -84, -46, 80, 39, 88, -76, -106, -117,
+        114, -53, -123, -67, -27, 101, 117, 55, 54, 70, -45, 66, -113, -72, 75, -15,
+        -36, 48, 99, -123, -73, 41, 5, -30, -75, 84, -122, 82, 94, -75, -12, 101,
+        19, 118, 63, 103, -101, 23, -53, -16, 62, 122, 81, -84, -94, 105, 60, -113,
+        1, 88, -61, -12, -59, 38, -51, -127, 75, 92, -92, -24, 34, -55, 96, -11,
+        5, -114, -82, -5, -30, -14, 62, -116, 19, 52, -127, -89, -25, 2, 61, -105,
+        72, -31, -6, 98, -107, 103, -128, -15, -42, 59, 2, 126, 4, -105, 51, -124,
+        -76, 51, 6, -122, 103, 0, -54, 103, 28, 26, -50, -40, 6, -97, 105, -5,
+        117, -58, -105, -1, 76, -84, -26, -103, 90, 28, 24, 52, 37, 11, 50, -78,
+        -1, -95, -31, -104, -21, 55, -126, -96, 43, -94, 125, -81, -120, 4, 122, -93,
+        -116, -95, 60, 114, -38, -59, -62, 91, -93, 80, -91, -8, 91, -59, 17, -67,
+        127, -85, 89, 80, 113, 79, 91, 18, 95, -84, -53, 89, 25, -80, -111, 24,
+        59, 85, -7, 104, -10, -52, 35, -71, -61, -117, 15, 90, 91, -17, 94, 68,
+        -107, -48, -25, 70, -4, 95, 86, 66, 72, -104, -95, -103, -49, -116, -59, -118,
+        20, 21, 4, -27, 14, 71, -42, -43, -16, -125, 76, -67, 81, 117, -101, 21,
+        -127, 117, -71, 79, 44, -47, -121, -91, -47, -78, 47, -35, -79, 47, -119, 62,
+        17, -41, -72, -70, -118, 29, 39, 61, -31, -13, -35, -103, -53, 123, -81, -27,
+        18, -29, -43, 108, -99, -31, -36, 55, -121, 102, -70, -111, 51, -43, 120, 17,
+        0, -22, -54, 25, 64, -89, -61, 67, -99, -27, -78, 51, -58, -9, -28, -76,
+        108, -45, -38, 102, 115, -42, 108, 42, -101, 25, 60, -48, -108, 90, -49, 14,
+        -75, -98, -55, -42, -110, 103, -102, 81, -53, 69, 109, -53, 10, 84, -79, -98,
+        68, 3, 68, 39, -108, 122, -71, -68, -35, -36, -21, -72, 2, -15, 20, -50,
+        -117, -9, -67, 99, 125, -91, 114, 84, -110, 127, 75, 105, -121, -55, 3, -49,
+        -38, -15, 67, 115, -57, 15, -84, -29, 68, 77, -105, -13, -90, 9, -11, -53,
+        64, 71, -102, 6, 107, 44, 28, 51, 12, -90, 29, -15, -17, 3, -66, 85,
+        -123, -71, 85, -122, 69, 41, -63, -68, -83, 42, -67, 48, -86, -30, 101, -17,
+        99, 2, -100, 18, -8, -33, 91, 32, -33, -20, -115, -5, 102, 30, -124, -11,
+        -96, 10, -26, -86, 11, 109, 36, 58, -24, -8, -9, 22, 4, 84, -98, -116,
+        -34, -64, -100, 19, 7, -93, 99, 122, 49, 22, 90, -17, 68, -34, 92, -66,
+        54, 3, 19, -36, -84, -45, 80, -89, -80, -70, 1, 90, -44, 81, -3, -76,
+        -14, -92, -112, -27, -21, -55, 52, 69, -26, 98, 11, 62, -89, -101, -58, -115,
+        -47, -38, 9, 33, 7, 111, -9, -3, -79, -19, 0, -57, 11, -105, -112, 44,
+        -35, 8, -9, -112, 85, -106, -124, -71, -104, -100, 126, 31, 52, 46, -56, 44,
+        14, 19, -66, -110, -37, -26, -118, -84, -46, -60, 94, 73, 24, 71, 86, -106,
+        85, -58, 34, -69, -105, 108, 65, -103, 75, -3, 66, 73, -43, 64, -79, -104,
+        82, -86, -62, 35, -8, 40, 78, 83, -66, 97, 76, 40, 115, -46, -122, -103,
+        -94, -44, 93, -79, -55, 92, 44, -127, 114, 101, -93, 39, 77, -4, -33, 45,
+        86, 73, -68, 118, -50, 70, -67, -50, -73, -29, -10, -39, -62, -19, -82, 50,
+        96, -60, 6, -83, -65, -112, 89, -10, 80, 11, -18, 79, 97, -106, -32, -38,
+        39, 121, 61, 74, 80, 31, 88, 74, 9, -89, -10, -61, 40, -6, 71, -2,
+        27, -3, 124, 93, 79, -101, 23, 54, 63, -43, 125, -99, -75, 89, -10, 123,
+        -18, 89, -65, -41, 3, 114, 108, -75, 69, 81, 66, 120, 114, -46, -94, -65,
+        79, 79, -114, -42, 69, 125, 107, 118, -73, 23, -91, 37, 58, 98, -50, -108,
+        -7, 102, -77, -50, -104, 87, -127, 92, 107, -2, 125, -83, 4, -81, 112, -74,
+        64, 50, -114, -28, 17, 43, 48, -48, -9, 15, 67, -74, 84, 87, -128, -121,
+        -32, -29, 75, -64, 47, 118, -83, 85, 67, 3, -114, 25, 53, -79, -26, 80,
+        111, -87, 86, -18, -84, -33, -3, -90, -17, -41, -66, 59, -89, -128, -127, -78,
+        -28, -94, 71, -38, 67, -71, -20, 61, 87, 7, 67, -11, -106, 119, -43, -77,
+        72, 84, -108, -100, -64, 123, 60, 78, -120, 2, 107, -5, 82, -82, 109, 38,
+        55, -78, -128, -23, -33, -30, -51, 35, 98, 37, 12, 123, -66, 49, 97, 81,
+        -111, 45, 58, -21, -18, 61, -55, -80, -4, -34, -96, 34, -76, 80, 91, -93,
+        -1, 100, 50, 45, -76, 95, -47, 22, -121, -3, 110, 103, 109, -124, -55, -67,
+        46, -84, -29, -11, 89, -124, 75, 53, 47, -86, -24, 89, 42, 46, -85, -67,
+        82, -97, 18, -119, 44, -29, -7, -102, -124, 16, 34, 39, -56, 51, -48, 72,
+        87, 10, -6, 62, 123, 113, -16, 104, -105, 0, -74, -75, 106, -97, -38, 40,
+        -9, 107, 71, -19, -106, -37, -38, 15, 44, -78, 48, 37, 14, 97, -23, -83,
+        116, 5, 16, 6, 107, -7, 41, 75, 47, -27, -6, 31, 24, 41, -115, 80,
+        -116, 54, 14, 122, -52, -74, -64, -96, -125, 43, 27, -36, -9, -5, -81, 6,
+        24, -102, 65, 84, 68, -73, 42, 76, 17, 62, -125, -109, -36, -99, 80, 32,
+        108, -81, -75, -50, 86, -20, -124, -14, 74, 76, 76, 38, 53, 39, 112, -128,
+        89, -51, -90, 74, 79, 79, 47, -53, -81, 48, -32, -21, -45, 83, -71, 116,
+        -98, 100, -31, 26, -66, 14, -24, -120, 5, -80, 76, 116, -89, 14, 86, -23,
+        71, 21, -70, -120, -119, -63, -66, -5, 46, -37, 2, -30, -103, 38, 15, -53,
+        118, -65, 39, 48, -44, -38, -56, 86, -58, 100, -35, -35, -1, -38, 68, -7,
+        -18, 38, 74, 34, -116, -23, -25, -24, -30, -15, 14, -69, -42, -128, -92, -15,
+        94, -24, -59, 120, 111, -94, -30, -10, -68, -37, 123, 117, -86, -6, 100, -75,
+        49, 68, 0, 49, 52, -104, -49, -22, -64, 114, -97, -100, -12, -12, 21, -46,
+        5, 31, -14, 70, 69, 106, 45, 95, 95, -90, -117, 36, 18, -25, -109, 112,
+        -33, 119, 40, -61, -123, 101, -71, 74, 98, 56, 74, 20, 25, 0, 67, 98,
+        4, 25, -33, 37, -18, -108, 45, 30, 59, 25, 32, -28, -43, 32, -105, 113,
+        20, -99, -38, -47, -117, -72, 89, 73, -112, -73, 35, 13, -60, -37, 113, 59,
+        -60, 80, 62, 85, 105, 35, -22, 31, 108, 114, 77, 83, 68, -54, -114, 98,
+        -53, 35, -23, -97, -79, 48, 75, -114, -9, -123, -22, -37, -10, -42, -107, 10,
+        21, -64, 86, -18, -21, 30, -59, 88, -85, 59, -18, 9, -61, 7, -38, 1,
+        -117, 42, -88, -111, 99, -62, -124, -126, 56, 125, 17, -86, 98, 95, 81, 71,
+        116, 10, -45, -66, -30, 49, 7, 106, 8, 18, -124, -33, -65, 107, -32, -117,
+        -39, -24, 28, -29, -112, 71, -21, -65, -79, 29, 105, 60, -35, -98, 45, -108,
+        -17, -70, 91, 78, 0, 83, 19, 70, 111, -124, 65, -58, -9, 30, 59, 78,
+        -97, -123, 7, -106, 68, 109, -125, -104, -58, -59, -58, -15, 15, -72, 2, -99,
+        16, 72, 26, 51, 87, 97, -128, 46, 86, -95, -103, 68, 17, -53, -28, 84,
+        -30, -30, 29, 16, 114, -15, 42, -119, 62, 91, 102, 34, -125, -28, 26, -71,
+        -117, 109, -47, 53, -71, 31, 69, -87, -94, -116, -6, 46, -90, 110, 76, -96,
+        -85, 125, 28, -47, 37, 42, -91, -75, 36, -82, 91, 56, -18, 107, 68, 41,
+        -11, 107, 76, 81, -67, 35, 45, 14, 68, -92, -30, 64, 72, -4, 75, -45,
+        104, -95, 70, -123, 107, -28, 116, 69, -11, 52, -49, -118, 98, 25, -58, 24,
+        -112, -102, -93, 60, 23, -105, -5, 63, -76, -35, 71, 10, -9, -45, -107, -84,
+        -56, 73, -94, 74, -121, 44, -81, 51, 16, -128, -57, -10, -7, -71, -46, -89,
+        48, -43, -80, 12, 20, -71, 34, 96, -70, -123, 101, 72, -44, 96, -24, 0,
+        28, 50, -113, 70, -115, 44, -127, 52, -30, 34, 48, -6, -87, 44, 40, -118,
+        73, -78, 83, -68, 65, 80, -118, -76, -11, -93, -40, -17, 39, 39, -74, 55,
+        -31, 22, -33, -68, -116, -76, 125, 52, 116, -90, -61, 56, -88, 126, -67, 91,
+        19, -26, -93, -12, 73, -81, -12, 29, -65, -10, 43, 68, 97, 127, -23, 119,
+        62, -101, -33, -111, -55, 102, -52, -82, 26, 125, 38, 49, 43, -28, -102, -79,
+        -39, -38, -66, 98, 4, 93, 49, -128, 25, -59, -52, 71, 55, 70, 1, -2,
+        18, -74, 55, 43, 50, 66, -55, 54, -7, 52, 34, 40, -75, 89, -119, -56,
+        17, -23, 89, -98, 18, -98, -39, -102, 115, -86, -78, 14, -21, 81, -36, -80,
+        -65, -78, 71, 126, 77, 57, -113, -124, -94, -3, 71, -39, -36, 127, 36, -72,
+        -15, 49, -126, -122, -65, -18, -102, 121, -80, 48, -100, -114, 89, 8, 59, 65,
+        25, -27, 94, -10, -31, -1, -82, -50, -38, 109, 86, -33, -27, -101, 98, -7,
+        35, 9, 0, -14, 102, 100, 24, 107, 7, -75, 36, -22, -101, 96, 39, -22,
+        -66, 109, -119, 14, -128, 52, 65, -64, -49, -26, 47, 74, 13, 48, 97, -32,
+        90, 91, 15, 97, -55, 101, -122, -74, -78, 126, 5, 46, 106, -40, -91, -62,
+        125, 122, 26, 53, -68, 31, 15, 108, -15, 68, -91, 14, 75, 41, -107, 105,
+        -53, -15, -41, 119, -69, -21, -17, 49, -72, 115, -84, -83, 28, -11, -56, -74,
+        25, 9, 8, 96, -11, -83, 83, 123, -80, 78, -18, -9, 44, -69, -61, -43,
+        112, -102, 43, -24, 87, -52, -70, 91, -127, 44, -124, 83, -9, 57, -97, 45,
+        0, 127, 37, 73, -29, -121, 69, -107, 99, 62, -115, 33, -42, 14, 108, -98,
+        110, -93, 15, -24, 58, -84, 15, 58, 27, -42, 46, -4, 26, 73, -67, 45,
+        -112, -110, 104, 69, 23, 27, 56, -39, -83, 5, 56, 100, 107, -23, -88, 127,
+        -58, 122, -52, 33, 38, -20, -42, 36, 85, -45, -93, 93, -3, -118, -18, -51,
+        72, -59, -87, 30, 28, -116, 105, 92, 48, -102, 44, -91, 94, -116, -85, 48,
+        -113, 102, -101, 105, 100, 6, -82, -59, -55, -118, -85, 94, 24, 25, 108, 112,
+        38, 35, 30, -92, -95, -36, -53, -88, 24, -77, -80, 13, 120, 108, 49, -54,
+        41, -98, 87, 58, -82, -20, 33, -36, -18, 93, -54, 28, -113, -15, -43, -61,
+        35, -16, -126, -122, 5, 10, 126, -107, -120, 30, -27, 51, 116, -22, -47, -41,
+        -3, -108, 99, 0, -127, 7, 88, -94, 73, 97, -23, -12, -35, -105, 7, -105,
+        -78, 88, 55, -103, 35, 61, 96, -24, 25, 6, 112, 102, 55, 44, 23, -79,
+        82, -116, 74, 69, -85, 124, 57, -62, -68, -128, -6, 19, -102, -38, 57, -107,
+        -74, -25, -42, -74, -25, 24, 49, 88, 127, 4, -128, -77, 52, -2, -54, -38,
+        -8, 43, -77, -15, 87, 99, 12, -5, 94, 110, -6, -75, -75, -23, -41, -58,
+        -104, -65, -106, -79, -103, 73, 73, -109, 103, 119, 113, -95, -125, -107, 12, 35,
+        60, 34, -53, 85, -88, 13, -25, 24, 61, -82, 16, 24, 48, 102, -20, 46,
+        -99, 70, 51, 118, -126, 28, 23, -119, 106, -13, -122, -119, -117, 31, -74, -47,
+        20, -18, 48, -122, 1, 100, 63, -115, 21, 3, -128, 6, 47, -79, 6, -27,
+        93, 10, -73, -30, -100, 33, -2, -87, 61, -102, 104, 0, -101, 8, -68, -62,
+        -76, 28, -11, 20, 105, -62, -87, 45, 108, 41, -66, 40, 48, 29, 9, 63,
+        -93, 48, 53, 51, 63, 59, 94, -23, 112, -109, 100, -52, -92, 5, -123, 115,
+        0, 52, 48, 35, -111, 77, -124, -50, -15, 15, 120, -38, -42, -63, -82, 27,
+        109, -41, -64, 17, -47, -83, 65, 49, 42, 101, 53, 111, -19, 81, -68, 72,
+        45, -107, 34, 51, -59, 34, 115, 30, 115, 73, -8, -101, -109, -109, 89, -124,
+        113, -40, 94, -56, -36, 91, 83, -15, -51, 45, -1, -112, 51, -107, -35, -69,
+        94, -122, 54, -7, 90, 112, -78, 98, 77, -106, -1, -104, -119, 11, -113, -35,
+        80, 96, 53, -2, -20, -94, -71, -127, 89, -1, 51, -81, -65, 43, -43, -33,
+        89, -22, -13, -52, -38, 87, -91, 1, 1, 86, 17, 99, 114, -85, -75, -71,
+        118, 94, -12, 60, 53, 25, 24, 18, 126, -79, 95, -82, 114, -90, 64, -9,
+        -35, -39, -59, -12, 80, 10, 74, 30, 69, 114, 38, 82, -121, 46, -126, 82,
+        -17, -93, 67, 93, -116, 102, -29, -15, -96, -74, 18, -68, 37, -72, 9, -90,
+        22, -34, 96, -56, 34, 73, -118, 104, 20, -2, 66, -90, 117, 102, 62, -37,
+        90, -101, 116, 26, 67, -65, -7, -18, -86, 113, 26, 27, 49, -115, 85, -61,
+        52, 14, -12, 53, -38, 24, -13, -87, -85, 13, -43, 26, 38, -74, 50, 39,
+        -74, -38, -53, -109, 18, -35, -83, -42, -27, -66, 42, 59, 42, 49, 50, -65,
+        64, -32, -100, -96, -19, 90, -22, -24, -79, 7, -47, -62, 88, -91, -34, 58,
+        57, -127, -13, -50, -125, -91, 27, 102, -76, -100, 46, -32, 17, -54, -101, -19,
+        -126, 108, -88, -68, 14, 29, -21, 104, -15, -4, 0, 90, 20, 18, 105, 64,
+        -69, -79, 114, 8, -56, 106, -112, 81, -28, 101, 117, 56, 39, -94, -64, -40,
+        112, -20, 107, -15, -114, -42, 86, -37, 15, -46, 15, 56, 121, 53, 104, -66,
+        -26, -107, 24, 119, 127, 101, -89, -111, 111, 10, -66, -125, -107, 116, 101, -52,
+        74, 104, 63, 122, -92, 40, -19, -93, 49, -34, -69, -103, -71, 107, 65, -18,
+        -6, -27, 34, -103, 125, -60, 11, 49, 92, -114, 29, 13, -120, -54, -30, 124,
+        103, -27, -13, -99, 29, 64, 8, -27, 6, 68, -14, 73, -22, -61, -79, -64,
+        78, -31, 80, -115, 10, -80, -24, 11, 112, 40, 4, 100, -9, 1, -18, -17,
+        -80, 116, -52, 98, 9, 9, -110, -120, 42, 87, 96, 52, 84, -118, 65, -14,
+        -41, 93, -4, 51, 100, 127, 124, -106, -20, -86, 24, 50, 112, 3, 18, 8,
+        75, 89, -28, 98, -76, -114, -59, -65, 67, -2, -73, 90, -105, -118, 61, -54,
+        -6, -56, -108, -104, 67, -10, -89, 90, -109, -94, -77, -109, 109, 31, -44, -92,
+        -65, 67, -2, -73, 90, -105, -118, 41, -128, -76, -49, -78, 28, 12, -39, -97,
+        106, 77, 44, -11, 126, 103, 17, -90, -107, -115, 89, -105, -107, 12, -59, 15,
+        12, 60, -83, 66, -67, 102, -117, 69, 18, -55, -52, 93, 55, -126, 32, 63,
+        -54, 122, -113, -124, 47, -90, -91, 50, 79, 67, 48, -62, -95, -4, -14, -117,
+        74, 37, 16, -4, 111, 105, 97, -69, -10, 90, -1, 123, -36, 82, 81, -127,
+        109, 103, 37, -44, 34, 124, 43, -111, 31, 99, 23, -100, -106, -20, -86, -16,
+        90, 47, 48, -21, -22, -24, 55, -24, 95, 89, -23, -30, 7, 116, -77, 93,
+        -84, 54, -115, -13, 105, 18, 29, 81, 17, -125, -121, 91, -86, -95, -57, -44,
+        93, -124, -6, 62, -108, -16, -8, 74, 12, 3, 103, -22, 15, -115, 118, 93,
+        -19, -35, 35, -115, -81, 30, -100, 95, -23, -59, -127, -96, 81, -118, -33, -38,
+        42, 76, 79, 108, 127, -3, -12, 100, 40, -117, -31, -65, 43, -64, 15, -73,
+        20, 52, 22, 112, -60, -48, 41, 57, -93, 80, 90, -13, 119, -128, -35, -94,
+        -17, -77, -121, 20, -104, 28, 74, -79, 12, -121, 10, 37, -80, 67, -10, -57,
+        103, 105, -105, 29, -45, 94, -85, 14, -72, -4, 23, -36, -42, -105, 44, 15,
+        -25, 40, 32, 111, -79, -128, -35, -82, -18, -29, 53, -115, -120, 10, -6, 59,
+        97, -112, -125, -31, -72, -127, -78, 28, -95, -101, 81, -53, 107, 1, -61, -46,
+        26, 91, 104, 81, 68, 29, -22, 88, 16, 41, 5, -72, 0, 99, -59, 25,
+        -78, 52, 74, 100, 37, 127, 106, 114, 34, 73, -104, -103, 53, 88, 82, 19,
+        33, 78, -124, -79, 46, 50, 60, 3, -24, -88, 83, 46, 83, 120, -68, 44,
+        -123, -108, 85, -126, 106, 43, -94, -47, -115, -38, 89, 122, 31, -95, -79, -26,
+        85, -72, -2, -104, 25, 57, -45, -103, -84, -8, 19, 102, 23, 90, -77, -35,
+        -57, -102, 122, -67, 79, -40, -123, -77, -106, 124, -104, 69, 56, 69, -117, -1,
+        -71, 121, -15, -91, 44, -101, 32, -117, 82, 46, -23, 70, 43, 0, -124, -3,
+        94, -17, 47, -52, -93, 75, 123, -13, -111, 0, -76, 20, -128, 92, -48, -87,
+        67, -2, -61, 38, 119, 97, 89, 94, 118, 124, -51, -111, 73, 13, 122, -98,
+        94, 16, 110, 3, -44, 13, -93, -79, -99, -24, -58, -88, 36, 106, -32, 102,
+        105, -126, 124, 92, -98, -17, -103, 53, 3, 78, -8, 93, -116, -63, -91, -113,
+        79, -53, 19, 87, -95, 67, 55, 102, 86, -60, -7, 96, 45, 1, -126, 80,
+        -122, -96, -27, 61, 42, -33, -15, 114, 73, -61, -69, 101, 79, 54, -100, 75,
+        72, -68, 121, -7, 5, 76, 43, -60, 127, -71, -81, -106, 49, 102, 25, 83,
+        113, -76, 30, -109, 56, -57, 16, 38, -84, -39, 58, -118, 31, -98, -27, 53,
+        116, 46, 126, -72, -5, -127, 89, -95, 66, -56, -124, -18, -93, -102, 57, -109,
+        77, 61, 61, 105, 99, 8, -57, -61, -36, 9, 93, 117, 57, 49, -2, 41,
+        91, 1, -87, -57, 62, -119, 9, 38, -103, 115, -87, -19, 29, 13, 114, 77,
+        -125, -78, -66, 13, -73, 70, -40, -21, -63, -49, -21, -96, 5, -56, 37, -102,
+        -57, 105, 52, 83, 114, 47, -26, 99, 50, 100, 127, -8, 96, -68, 31, -41,
+        65, -11, -78, 11, 3, 71, 97, 12, -40, -14, 33, -2, -29, 3, 37, 124,
+        -13, -113, -65, 25, 11, 77, 86, 91, -46, -122, 90, 106, 59, -24, 48, -122,
+        -52, -109, 5, 81, 38, -39, 41, 48, -117, -91, -89, -89, 16, -109, 87, -96,
+        -38, 10, 45, -15, 41, 107, 8, 32, 83, -72, 78, -85, -82, 9, -25, -67,
+        94, -17, -116, 28, 91, -62, 46, 57, 48, -44, 86, -94, -73, 103, 84, 47,
+        -119, -45, -37, -96, -42, -49, 1, -33, 98, 53, -24, -11, 55, -43, 29, 61,
+        117, 103, -47, 61, -67, 18, -45, 33, -75, 76, 117, 122, 47, -5, -125, -80,
+        59, -117, 103, 65, 63, -6, 10, -86, 71, -15, 44, -88, 34, -120, -42, 13,
+        118, -39, 106, -29, -19, -46, -90, -22, -19, 54, 81, 100, -28, -13, 17, 84,
+        -61, -71, 70, 85, 31, 21, -54, 23, -123, -78, 35, 69, 51, -104, 26, -53,
+        120, -58, 29, 98, 96, 12, 116, -117, -59, -8, 9, 70, 72, 6, 101, 81,
+        -76, 23, 13, -94, -64, 89, 7, -93, 49, 35, -116, 81, 95, -112, 40, 41,
+        -114, 43, -84, 94, 4, 31, 24, -53, -92, 126, -99, -2, 32, 126, -115, 33,
+        -87, 58, 29, -76, 116, -63, 100, -121, -82, -88, 85, -96, -35, 124, -28, 82,
+        -50, -45, 85, -98, -83, 51, -124, -75, 81, 49, 14, -16, 31, 88, -89, -101,
+        104, -115, -122, -6, -16, 7, 8, -24, 37, -32, -31, -14, -93, -29, -30, -104,
+        -29, 20, 37, -93, -43, -76, -99, -127, 18, -33, 6, 2, -116, -123, -29, -52,
+        80, -4, -48, -91, -18, 12, -69, 43, 53, 29, -101, 37, 99, -80, 120, 117,
+        71, -76, -125, 35, -93, 28, -92, -27, -24, 48, -25, -96, -104, 8, 75, 72,
+        41, -34, -31, 109, -57, 22, 23, -25, -64, -59, 7, -111, 44, -28, 106, 99,
+        -10, 101, -83, -122, -80, 63, 65, -56, -65, 66, 13, 14, -100, -54, 92, -81,
+        11, -9, 28, -82, 65, 56, -125, 99, 29, -40, -100, 91, -121, 17, 12, 1,
+        -82, -111, 116, -86, -1, -12, 29, 39, 14, 90, 120, 60, 16, -95, 32, 57,
+        -126, -103, -83, -122, -70, 74, -8, -123, -88, 75, -53, 6, -121, -105, 67, -41,
+        -112, -99, -49, -97, -94, 2, -64, -38, -105, -121, -107, 57, 17, -124, -7, -33,
+        80, -39, 14, -43, -52, -114, 89, 53, -15, -50, -31, 117, 91, 100, 39, -113,
+        -70, -7, -29, 90, -79, -70, -48, 42, 28, 97, -100, 37, 81, -49, 29, 99,
+        77, -89, 92, -24, -14, -63, 9, 39, 41, -40, 51, 34, -26, -76, 47, 0,
+        -10, -58, -97, -64, -70, -86, -91, 9, 98, 47, -42, -25, 78, -77, 67, -2,
+        21, -39, -102, 98, 21, 82, -22, 107, -18, 12, 68, -121, 10, -119, 53, -25,
+        -1, -36, -68, -1, -119, -95, 42, -121, 114, -28, 104, 39, -115, 16, 4, -13,
+        -85, 115, -35, -89, -89, -57, 61, -76, 99, 46, -73, 76, -105, -120, -5, -57,
+        -79, 90, -27, -32, -79, -124, 59, -62, 95, -11, -69, -35, -57, 112, -127, -29,
+        118, 90, -109, 108, -74, 107, -71, 72, -8, -58, 112, 48, -121, 58, -50, -12,
+        57, 56, -112, 93, 0, 115, 23, -29, 29, -72, -35, -108, 118, -115, 66, 51,
+        96, 2, -97, 115, 12, 35, 35, 80, 108, -16, -120, -99, -6, 107, -12, -79,
+        43, 53, -12, 16, -5, -6, 49, -77, 18, 112, 90, 25, -84, 66, -68, -34,
+        -7, -67, -127, 116, 4, 15, 39, 64, -60, -62, 116, 7, 73, 52, 95, -5,
+        29, -92, 99, 6, -21, 108, -59, 127, 101, 64, 49, -52, 19, -72, 56, -106,
+        -15, 108, 22, -91, 64, -55, -109, -99, 2, 80, -27, -104, -68, 1, -1, 80,
+        -126, 103, 81, 28, 82, 38, 7, -4, 35, -118, -46, 112, 29, -33, -93, -25,
+        51, 63, -122, 4, -70, 72, -7, -86, -63, -41, 84, -63, -100, 70, -77, -39,
+        15, -120, 34, 68, 10, 43, -89, -11, -3, -5, 119, 120, -102, -80, 44, 11,
+        103, 112, -49, 25, -39, 33, -22, -17, 28, -40, 58, 20, -38, -122, -35, 60,
+        90, 0, -125, -10, -56, 66, -116, 92, -90, 51, 76, 11, -32, -97, -3, -53,
+        25, -75, 59, -29, -95, -13, -53, -84, -19, -4, -46, -3, 101, 118, -22, 14,
+        -97, -16, 111, -37, 117, 34, 122, -125, 63, -121, -82, 51, 10, 59, -65, -1,
+        101, 124, -22, -2, -81, -77, -40, 91, 2, 119, 121, -10, -81, 127, 27, 98,
+        -31, -4, -105, -39, -8, -15, 124, -17, -42, -3, -58, -6, -7, 98, -30, -97,
+        -63, 63, -65, 56, -8, 25, -41, -45, -2, -3, -59, 61, -13, -14, 104, 30,
+        -63, 9, -122, 19, 126, -10, 111, -12, -99, 94, -25, -37, 95, 58, -65, -114,
+        -37, 46, -76, -107, 70, 92, -123, 127, -10, -117, -5, 75, 113, -22, 13, -31,
+        -97, 51, -17, 97, 25, -81, 25, 104, 67, 121, 113, -74, -16, -30, -30, 71,
+        54, 44, -4, 56, 90, 54, 62, 126, -27, 125, -77, -57, -49, -57, -59, -49,
+        56, -128, 127, -47, 8, -50, -32, -15, -86, -128, -50, 70, -1, -14, -57, 109,
+        127, -12, -81, -63, -72, 61, 24, 98, -23, 119, 73, -104, -34, -30, -126, -4,
+        82, -64, -116, -1, 23, 22, -15, 84, 101, 103, -1, 58, 102, -115, -40, -89,
+        62, 68, 64, 83, -89, -72, -80, -99, -31, -24, -105, -39, 47, -35, 113, -5,
+        47, -44, -41, -11, 93, -72, -64, -79, 118, -99, -33, 86, -117, -89, -33, 86,
+        -47, -30, 105, -107, 46, -98, 22, -15, -4, 9, 118, -35, 117, 126, 25, -114,
+        -2, 21, -116, -37, 93, -24, 28, 58, -102, 69, 73, 124, 7, 51, -124, -113,
+        -113, 126, 41, -68, 113, -5, -52, 91, -18, 86, -53, 40, -11, -49, -100, -47,
+        -65, -94, -79, -5, 75, -25, 108, 17, 19, -40, -67, -115, -48, 16, 0, 103,
+        -12, -18, -19, -113, -1, -72, -70, -7, -113, -113, -105, -1, 57, -58, -105, 49,
+        9, -86, -40, -21, -46, -37, -104, 7, -50, 47, 48, 38, -59, -9, -39, 26,
+        90, -29, -34, 12, 105, 86, -50, -48, 55, -74, 30, -98, 109, -27, 109, -41,
+        109, -29, 103, 102, -44, -4, -105, -18, -39, 2, 65, 123, -77, -114, -109, 34,
+        120, 4, -110, -79, 36, 84, -88, -34, -77, 34, -31, 112, 111, 80, 92, -60,
+        -125, 66, 37, -10, -123, 43, 11, 21, 96, 90, 98, 95, -113, 121, -12, 127,
+        65, -105, -68, 47, -14, -98, 99, 73, -125, -117, 113, -75, 99, 117, 85, 20,
+        -66, -27, 70, 98, 17, -111, 89, 80, -127, -1, -89, -67, 119, 109, 111, -37,
+        74, 18, -124, -65, -49, -81, -112, -48, -35, 106, -64, 4, 41, 82, -66, 37,
+        -92, 97, -83, -29, -40, -119, 119, -19, 36, 109, 43, -35, 113, 51, -100, 60,
+        16, 9, 73, 104, 83, -124, 26, 0, 109, 49, 50, -9, -73, -65, 117, 57,
+        119, 28, -112, -108, -19, -20, -20, -50, -13, 78, 79, 44, -30, 92, -22, -36,
+        -21, 84, -43, -87, 75, 22, 123, 29, 50, -76, 93, 61, 44, -13, 74, 123,
+        66, -109, 26, -90, 6, 109, 60, -85, -31, 77, -128, 49, -21, -70, 2, 45,
+        5, -61, 65, 28, 112, -116, 28, 95, 18, -87, 87, 6, -61, -66, 74, 64,
+        -44, -13, 47, 96, -74, 3, 116, -84, -60, -122, -18, 70, -50, 20, -107, -49,
+        3, -64, -28, 117, 16, 83, 100, -68, -32, 79, 125, -6, -65, 32, -26, 82,
+        70, -126, -60, -117, -125, 88, 26, -6, 78, -15, -57, 84, -101, -4, -22, -104,
+        120, 49, -6, -52, 47, 49, -69, -60, -20, 66, -88, -106, 98, -37, -59, -107,
+        -45, 111, 72, 32, 57, 89, 96, -76, 21, 96, -52, -98, 46, 98, 113, 40,
+        -12, 64, 124, -98, -91, -105, -7, 28, 106, 5, -33, 103, -13, -9, 89, -99,
+        79, -45, 120, -17, 73, 9, 119, 102, -68, 87, -63, -47, 39, 73, -45, 25,
+        -70, 14, 0, -14, -94, 11, 19, 124, 65, 48, 73, 11, 47, -96, -103, -91,
+        -80, -125, -98, 8, -24, 21, 27, 66, -95, 87, 11, 14, 68, 32, 127, -100,
+        -30, 15, 32, 124, 2, 54, 97, 55, 40, -83, 99, -127, 37, 123, -124, 50,
+        122, 24, 13, 26, -32, 29, -121, -24, 65, -125, 51, 0, -121, 0, -99, -109,
+        -95, -59, 58, 32, -40, 57, -34, -84, 50, 75, 99, -92, 56, 8, -92, -98,
+        73, 105, -24, 44, 99, 112, 92, -39, 21, 35, -11, 72, -90, -98, -102, -87,
+        119, 97, -1, 15, 117, 119, 0, -73, -55, -18, -112, -45, 123, -103, 3, -88,
+        -104, -5, 115, 47, 73, -112, -85, -108, 34, -28, -29, 113, -16, -89, 32, -74,
+        12, -11, 49, -46, -14, -58, -124, -93, -8, -18, -106, -124, -69, -15, -67, 102,
+        -62, -92, -121, 59, 49, -124, 49, 15, 43, -1, -88, -29, -63, 3, -1, -64,
+        117, -122, 51, 118, -52, 0, 66, -85, -15, -90, 39, -96, -61, -28, 75, 120,
+        117, -17, 92, 66, -88, 123, -89, 81, -92, 57, -126, 80, 108, -115, -8, 70,
+        -86, -66, 15, 61, 58, 122, -28, -2, -86, -128, -23, 69, -62, -100, 126, 52,
+        75, -63, 84, 118, -50, 69, -37, -111, -4, 117, -82, 126, -99, 82, 77, -68,
+        99, -102, 53, 97, -65, -124, 65, 103, -52, 117, 69, -97, 69, 127, -59, -68,
+        69, -92, 124, 28, -97, -106, 120, -58, -128, -42, -87, -38, 122, 89, 30, 30,
+        -35, -65, 127, -89, 119, -105, 35, 107, -99, -13, -41, -3, -81, -7, -13, -108,
+        63, 7, -125, 117, 124, 89, -108, 87, 23, 94, 25, 14, -57, 47, -86, 106,
+        -116, -6, -115, -38, 24, 76, -127, 113, 92, 81, -15, 98, 15, -45, 87, -17,
+        82, -9, 24, 56, -85, -6, 81, 31, 53, -48, 31, 15, -114, 7, -61, 58,
+        54, -127, -35, -108, -61, -1, -3, -65, -59, -124, 117, 66, -73, 110, -81, -20,
+        -118, -71, -68, 3, -83, -98, -85, -94, -25, -98, -94, -25, 93, 49, -39, 88,
+        -12, 84, 21, 61, -11, 20, 61, -19, -118, -43, -72, 67, 81, -79, -56, -11,
+        -40, 122, 29, 73, 12, 65, -57, 39, -15, 13, -83, -109, 4, 65, -20, 61,
+        106, 72, 72, 121, 16, -126, -62, 58, -100, -20, 5, 122, 112, 16, -16, 21,
+        107, 50, 114, -91, 55, -11, -36, -101, 122, 106, -74, -46, -60, 113, -14, 6,
+        51, 59, 34, 122, -84, -121, 43, -6, -54, 49, -68, -20, -69, -77, -97, 32,
+        115, 28, 2, -27, 60, -98, 68, -20, -118, -25, -57, -77, -48, 120, -126, 66,
+        -15, 29, -46, -14, 58, -117, -9, 45, 125, -77, 96, -116, 121, -121, -38, 62,
+        115, -44, -40, -10, 51, -57, -66, -118, 24, 115, -20, 33, -51, 43, -38, -39,
+        88, 126, -51, 1, 2, -67, 27, 84, -6, -10, -62, -82, -58, -114, -36, 49,
+        58, 22, -2, -35, -39, -14, 5, 122, 76, -5, -126, -60, -43, -66, -55, 17,
+        -93, 48, -104, 105, 72, -122, -103, 26, -9, -29, -2, 100, 66, -29, -43, 117,
+        29, -10, 89, -50, -128, -65, -120, -91, 82, 107, 22, 81, 114, 8, -96, 16,
+        94, -75, 121, 32, -54, 122, -41, 73, 14, -1, 81, 108, -59, -84, -73, -126,
+        -113, 85, 66, -63, 21, -57, -63, -85, 32, -58, 40, 116, -112, 58, 89, -57,
+        47, -121, -34, 119, -57, -52, -84, 43, -22, -67, 12, 98, 74, -62, 79, -88,
+        -7, -3, -106, -102, -29, -32, 123, -82, 0, 101, -1, -34, 86, 118, 37, -53,
+        -2, 93, -107, 125, -70, 9, -18, 61, -39, -93, -5, 88, -23, -87, -47, -93,
+        24, 99, 73, -58, 24, 68, 50, -90, 98, 88, 4, -96, -3, 109, 19, -76,
+        35, 9, -19, 46, 66, -5, -101, 23, 26, -64, 120, -77, 59, -116, 55, 109,
+        48, -2, -71, 101, -91, -28, 34, 1, -116, 127, 6, 19, 32, 87, -54, 36,
+        -72, -100, 95, -68, -1, 119, 61, -83, -46, -33, 3, -79, 31, -31, -22, -116,
+        11, 32, 74, 48, 102, -101, 80, 47, 40, 30, 45, 70, -99, 78, 17, 85,
+        -29, 114, 92, 76, 38, -66, -93, 111, -54, -52, 73, 36, 123, 22, -62, -38,
+        0, 6, -119, 48, -48, 103, -126, -1, 116, -96, 11, 35, 25, 60, 4, 22,
+        -61, -51, 92, -23, -52, 39, 34, -13, 62, 102, -34, -89, -102, 113, 54, 126,
+        -128, 95, 15, -116, -94, 114, -105, -78, -81, 48, 21, 26, -76, 124, 84, 64,
+        119, 75, -88, 95, 98, -115, 114, -46, 9, -53, -65, 28, 29, 67, 53, 12,
+        119, 24, 9, 3, 12, -113, 112, 11, -123, -50, 42, 110, 31, -4, 22, -125,
+        89, -81, 67, 28, 55, -36, -52, 63, 95, 93, 101, -27, -45, 20, -16, 76,
+        -124, 108, 63, 114, 52, -73, 58, -79, 120, 46, -116, 83, 43, -85, -73, 31,
+        -38, 102, 9, -9, -52, -54, 18, 38, -42, -45, -119, -101, 48, -97, -33, 21,
+        105, 63, -74, 24, -104, 32, 24, 101, -64, -68, 100, 34, 40, -21, 56, -101,
+        -32, -42, 99, -65, 101, -12, -123, -70, 109, -95, -52, 26, 88, 89, 71, 34,
+        11, 80, 106, 44, 75, 28, 89, 37, -18, 122, 74, -64, 30, 119, 82, -18,
+        89, 117, -18, 123, -22, -36, 111, -44, 121, 96, -43, 121, -24, -87, -13, 16,
+        104, -38, -56, 96, -21, 58, -112, 41, 98, -56, -78, 47, 56, 36, 94, -34,
+        111, 120, -115, 62, 61, 69, 51, 34, 45, 30, -66, -114, -15, 108, 121, -23,
+        22, -116, -96, -29, -110, 8, -90, 117, -62, -56, 112, 5, -85, 58, 32, 95,
+        124, 76, -78, -126, 51, 40, 78, 100, 41, -10, -118, 94, 108, 62, -75, -103,
+        121, 106, 11, 84, 12, -86, 96, -13, 38, -29, 12, -2, 69, -20, -89, -38,
+        -102, 39, -24, 22, 30, -109, 101, -115, -7, 35, -8, 15, 106, 96, -123, -15,
+        124, 66, 121, -16, -73, 19, -26, -4, -93, 43, 18, -128, -88, 25, -47, 25,
+        77, 42, 6, -118, -113, 72, -8, -21, -34, 36, -23, -124, -3, -3, 68, 124,
+        0, 121, -114, 63, -18, -101, -87, -9, 97, -38, -75, -102, 15, -33, -33, 85,
+        92, -6, 46, 83, 20, 119, -37, -126, 68, 53, 86, 53, 121, -6, -102, 29,
+        73, -9, -122, 112, 99, 29, -63, -99, 115, 4, -73, -57, 0, 110, -123, 1,
+        96, -5, 7, -128, 95, -17, 1, -98, -66, 23, -97, 64, -6, -109, -31, 67,
+        -64, -107, -3, -11, -88, 78, 60, 92, 87, -109, -105, 114, -92, 19, -15, 69,
+        -44, 40, 98, -120, 62, -30, 96, -17, -49, 7, -8, -66, -17, -106, 97, -111,
+        73, 28, -4, 121, -80, -41, -123, 108, 104, -8, 82, -103, -65, -54, 50, 74,
+        -46, 2, 20, -93, 79, 121, 55, 107, -88, -18, 10, 36, 67, 58, 59, -92,
+        -128, -53, 8, 113, 60, 17, -95, 1, -60, -75, 30, 47, -84, 47, 12, -126,
+        49, 85, -25, 124, 52, 43, 110, 52, 109, -87, -27, 52, -126, 108, -61, 21,
+        71, -74, 19, 127, -60, -99, -50, 28, 120, -95, 87, 40, 103, 62, -50, 18,
+        -72, -80, -127, -23, 15, 88, 37, 1, 62, -47, -115, 85, 41, -100, -83, -64,
+        33, -29, -50, -111, -54, -122, -44, 8, -102, -57, -13, 78, -110, -113, 51, 27,
+        -101, 2, -43, -121, -17, 122, -76, 7, -98, -93, 77, 31, -36, 65, -15, 2,
+        118, 10, -16, -79, -13, 44, -100, 62, -98, -85, -125, 6, 91, 5, 79, -98,
+        7, -95, 109, 120, -22, 82, 89, -72, 80, -50, 67, -114, 124, -57, 49, -4,
+        -18, 58, -27, -47, -94, -114, 108, 6, -103, 82, 99, 65, 92, 34, 31, 78,
+        -62, 27, -9, 37, -124, -42, -55, -96, 79, 5, -85, -113, 30, 61, 19, 116,
+        -80, 20, -60, 77, 18, -5, -40, 40, -97, 87, 63, -92, 63, 32, -95, -40,
+        31, 42, 75, 24, 38, 27, -127, -55, -23, -34, -67, -105, -35, 125, 56, -28,
+        127, 61, -5, 23, 23, 10, 38, -109, -99, 72, -104, 27, 88, 72, 89, 35,
+        -59, -70, 114, 99, 122, -50, -123, 80, -128, -116, -87, -15, -38, 53, -70, 116,
+        -120, -113, -40, -48, -102, -56, -79, 32, -36, -63, -73, -72, -56, 28, 34, 30,
+        -14, -95, 115, 116, 121, -46, -20, -90, 77, 34, 89, 87, 103, -41, -89, 40,
+        120, -90, -5, 108, -72, -31, 14, 99, -61, 111, 85, -11, 24, 56, -78, 65,
+        -10, -43, 29, 3, -119, 31, 14, -78, 7, -36, 111, 93, -54, 24, 22, -12,
+        124, 104, -108, -18, -88, 66, -56, 68, -29, -109, 68, 59, -105, 46, 55, -53,
+        -50, -52, -62, 124, 89, -7, 121, 5, -15, 30, -60, -122, -3, 117, 20, -37,
+        -33, 0, -94, 83, -21, -23, 65, 27, 88, 49, 63, -24, -56, -10, 83, 65,
+        118, -3, 32, 41, 98, -38, 39, -126, -68, -29, 7, 57, -53, -33, -25, -77,
+        -20, 19, 97, 30, -74, 116, -77, -16, 104, 73, 52, 42, 75, -108, -47, 60,
+        36, -12, -48, -56, -101, -115, -34, -1, 110, 43, -91, -48, 61, 70, 44, 61,
+        -89, -121, 19, -71, -75, 27, -41, 117, -57, -72, -45, 111, 41, -41, 104, 12,
+        -55, 34, 32, -56, -109, 49, 123, 55, -120, 56, -42, 29, -22, -53, -30, 62,
+        -29, 52, 33, 116, 32, -100, 37, 4, -64, -101, -112, -106, 64, 89, -65, -79,
+        84, 54, -47, 82, 98, 114, 4, 88, -119, -88, -23, 34, 38, 9, 25, -45,
+        -80, 50, 30, -9, -85, -72, 76, 110, -42, -79, 120, 55, -57, 39, 65, 45,
+        34, 35, -62, -74, -42, 111, -122, -86, -116, 126, 50, 100, 34, -39, 108, -66,
+        118, 31, 1, 41, 57, -120, -124, 38, -103, 40, 102, 96, -119, -21, -42, 25,
+        37, 63, -122, 1, -70, 0, -128, -30, -85, 45, -59, 86, 92, 108, -22, 5,
+        -57, -38, -113, 2, -125, -64, 125, 32, -30, -54, 83, 84, -8, -24, 80, -124,
+        -78, -69, 14, -21, -82, -99, -114, -16, 86, 91, -31, -83, 36, 60, -106, 112,
+        107, -128, 43, 9, 80, 103, -8, -119, 83, 115, 52, -41, -72, 23, 86, 33,
+        -50, 16, 62, 1, 53, -98, 43, -52, -78, 83, 42, 60, -27, -46, 44, 103,
+        -33, 60, 73, -4, 4, 64, 19, 37, -60, -15, -101, -53, 75, -21, 110, -84,
+        -128, 18, 119, 47, 81, -67, 84, -84, -110, -70, -21, -115, 105, -76, -114, -126,
+        -120, 82, 31, 69, 114, 74, -100, 92, 97, 21, -114, 99, 71, 69, -31, -26,
+        38, -1, 80, -26, 53, 41, 9, -98, 20, -33, 22, -105, -110, 120, 76, -82,
+        -11, -2, 101, 21, 99, 124, -57, -57, 64, -114, -70, 71, -57, -20, 8, 52,
+        -29, -45, -43, 75, -49, -24, 25, -122, -80, 8, -69, -31, 110, -69, 6, 88,
+        49, 32, -116, -124, -51, -78, -4, 20, 81, 44, -27, 27, 59, 29, 92, -127,
+        36, 4, 1, -39, 62, -73, -44, 118, 45, 65, -112, 70, 79, 12, -99, 59,
+        41, -4, 74, 115, 87, 75, 1, 31, 46, -93, 101, -3, 98, -31, 47, 69,
+        -82, 54, -71, 84, 62, -37, -78, -82, -92, 3, -125, 107, 122, 81, 124, 104,
+        27, -73, 120, -14, -98, -27, 64, -23, 98, -88, -106, 0, -27, 107, 23, -42,
+        -107, -80, -91, -62, -94, 64, -1, 86, 112, -49, -26, 85, 126, 58, -9, -44,
+        -29, 18, -5, -119, -81, 58, -35, 22, -101, -91, 127, 106, 44, -76, 95, -46,
+        -86, -54, -86, 22, -73, 25, 92, -110, -54, 104, 101, 98, 121, -120, -57, 19,
+        -44, -64, -34, 76, -43, -61, -56, -45, -118, -68, 22, 123, 102, -74, 59, 16,
+        67, 16, -99, 8, -75, 91, 3, 18, 107, -50, 102, -51, -102, -118, -77, -108,
+        112, 81, 21, -55, 84, 82, 85, -80, 70, -103, 120, 115, 20, -76, -106, 57,
+        -106, -40, 16, 126, 106, -43, 76, -79, 9, 113, 111, -75, 117, 121, -49, 109,
+        91, -20, 110, 11, -72, 51, -90, -122, 63, 116, 67, -36, -75, 79, -66, -48,
+        -115, -50, -120, -93, -64, 90, -67, 59, -9, -30, -40, -120, 15, 43, -45, -60,
+        121, 21, -109, 72, 51, -86, -33, -6, -67, -62, 108, -72, -128, 66, 61, 26,
+        66, 39, 124, 106, -121, 77, -53, 92, -30, -30, 113, 49, 114, -41, 73, 68,
+        100, 108, 19, 50, 9, 77, -92, 122, 73, -77, 104, -68, -81, -118, -25, -60,
+        -89, -113, 114, 82, -100, -39, -96, 77, 52, 98, 89, -101, 75, -30, 100, -57,
+        57, 51, 1, 48, -27, -128, -85, 44, -123, 28, -93, 13, 111, -113, -127, 67,
+        -7, -109, -44, 95, 9, 80, -99, -37, 117, 123, -95, 84, -124, -84, -95, 109,
+        24, -41, 26, -56, -64, 98, -38, 114, -2, 26, -70, 66, 66, -31, -47, -64,
+        -110, -108, -84, -90, -65, -14, 16, 127, -24, 11, -105, 23, 1, 120, 89, 28,
+        21, -52, 115, 46, -85, -41, -88, 54, 36, -58, 25, -79, 47, 49, 113, 24,
+        114, -55, 97, -54, -78, -22, 84, 35, 85, -56, -13, 55, -36, 36, -18, 52,
+        -18, -46, -80, -106, 51, -114, -108, -86, -8, 41, 125, -57, 80, 82, -11, -54,
+        -109, 88, -4, -18, 73, -3, -112, -99, -66, -53, 107, 79, 70, -31, -92, 69,
+        6, -1, -81, 47, 47, 66, -54, 66, -97, -89, 5, -23, 97, 49, 64, -36,
+        -17, -49, -121, 91, -43, 33, -123, 38, 16, 109, -106, -80, -26, 19, -18, -54,
+        101, 104, -18, -44, -66, -78, 125, 80, -73, -64, 19, 120, -56, -67, -118, -127,
+        -92, -74, 106, -73, 92, -56, 49, -6, 33, 89, 100, -27, -9, 39, -81, 94,
+        42, 81, -53, -31, 127, 62, 2, -48, -113, 15, -15, -110, -47, -119, -113, 126,
+        69, 29, -45, -57, 127, -90, -28, -111, 81, 47, 9, -88, 56, 122, 97, 82,
+        -123, 127, 93, -72, -75, -61, -15, -81, 31, -122, -35, 73, 39, 10, -57, -1,
+        -7, 104, -46, 57, -114, 126, 61, 124, 124, 120, 30, 7, -113, -2, 60, -8,
+        -13, -47, -29, 71, -121, 127, 30, 60, 14, -94, 78, -16, -120, 26, 9, -116,
+        -89, -109, 126, 92, -62, 30, -92, 0, 119, 52, -106, -34, 20, -1, -59, 17,
+        40, -61, -67, -22, 81, 73, -118, 33, 122, -108, -26, -40, -83, -54, -6, -89,
+        69, 30, 1, -63, 102, 77, -96, -121, 73, 102, 45, -43, 116, 122, 33, 104,
+        103, -44, -54, -88, 20, 117, -114, 25, -58, -119, -93, 76, 124, 122, -53, 108,
+        93, -8, 22, -62, 105, 45, -105, -111, 58, -49, 24, -73, 69, 117, 47, 102,
+        63, -17, -67, 119, -39, 74, -72, 100, 3, -90, 65, 63, -15, 105, 40, 85,
+        -101, -10, 95, 76, 74, -126, -116, -22, -14, -77, -107, 6, 34, -81, 9, -95,
+        76, -40, -50, 91, 1, -105, 82, -117, -78, -7, -50, 7, 123, -49, 18, 101,
+        100, 107, 105, 85, 46, 88, -85, 44, -83, -96, 63, -55, 77, -48, 13, -68,
+        13, -81, 97, -85, 60, -10, 101, 117, -55, -35, -46, -76, -128, -39, -72, 67,
+        63, 127, 122, 1, -92, 125, -89, 119, 31, 106, 120, 43, -20, 81, 41, 104,
+        77, 87, 32, 86, 32, 120, -28, 45, 61, -16, 52, -128, -27, -15, -19, -127,
+        56, -34, 109, 15, 57, -102, 79, 33, -14, -6, 21, -42, -127, 69, -92, -84,
+        94, -54, 79, -105, 0, -21, 77, 94, 47, -103, 59, -34, -50, 93, -94, 48,
+        43, -39, 23, 97, -105, -55, 16, -94, 34, 67, 110, 51, 1, 103, 83, -90,
+        -52, -106, -91, -113, -15, 86, -23, -111, 43, 66, 2, 90, 43, 93, 53, 74,
+        99, 98, -93, 40, -87, -19, 36, 29, 114, -117, -119, 81, 82, 117, -3, 88,
+        -24, 88, 45, -14, -22, 34, -47, 101, 59, 86, -105, -124, -10, 119, 90, 33,
+        -77, -118, 127, 56, 97, 94, 20, 87, 82, -30, -121, -65, 43, 53, -106, -108,
+        -20, 60, -47, -79, 0, -78, -54, -118, -78, -48, 95, 68, -70, -22, 79, -83,
+        109, -120, -41, 27, 37, 21, -56, 44, -33, -120, -115, -9, -4, -105, 93, -40,
+        121, 118, 44, 34, -74, 61, 108, 30, -79, 86, 26, 102, 58, -59, 123, 66,
+        -11, 82, -107, 48, -72, -5, -85, 116, 105, 46, 19, -38, -105, -4, 84, 84,
+        114, -108, 87, -6, 103, 122, 90, 25, 25, -65, 85, 87, 25, 84, 27, 104,
+        38, -99, -89, -64, 9, 106, 83, 69, 55, 77, -27, 26, 53, -87, 20, 68,
+        -128, 23, 37, 49, -42, 93, -56, -71, 121, -95, -43, 14, 12, 111, 100, 1,
+        84, -61, 69, 27, 1, -86, 58, -124, 43, -71, 31, 35, -72, -95, 60, -81,
+        99, 36, 115, -70, -63, -28, -29, -57, 108, 109, -13, -101, -1, 94, 102, 75,
+        12, -119, 37, 73, 79, -102, -65, -95, 95, -83, -62, 17, 114, 74, 13, -17,
+        -48, 51, -11, -126, 0, 21, -119, 44, 106, 59, 41, -98, -48, -124, 121, -96,
+        75, -98, 95, 45, 7, 111, -63, -24, 48, 116, -110, -27, -128, 15, -115, 41,
+        71, 110, -127, 0, -97, 20, -24, -113, -88, 21, 31, 110, -122, 114, 71, 108,
+        120, -89, 11, -128, 102, -39, -21, 92, 126, -7, -68, 76, 47, -101, 22, 0,
+        -88, 111, -89, 114, -27, 97, 83, -101, -97, 82, 81, 105, 42, -125, -119, -82,
+        -22, 39, 86, 122, -40, -124, -107, 93, -63, 45, -45, 59, -51, 23, -126, 45,
+        69, 118, -45, 108, -64, 106, 30, -88, 33, 88, -117, -71, 3, -44, -45, -127,
+        72, -116, -94, 121, 93, -18, 27, -121, 66, -36, 74, 106, 2, -28, -99, 41,
+        -113, 76, -33, 64, 36, 79, 57, -86, 98, -88, 47, 35, 35, -75, -107, -41,
+        -75, -89, -42, 69, 70, -58, -6, -32, 54, 54, 23, -57, 57, -84, 54, -78,
+        -78, -95, 118, 118, 88, -21, 88, 97, 103, 53, 119, -56, -85, -119, -23, -113,
+        -23, 76, -8, 118, -87, -49, 68, 4, -56, 12, -5, 88, -88, -29, 25, -71,
+        19, 90, -39, 60, -87, 74, 71, -9, -78, 54, 50, 114, -21, -111, 111, 78,
+        61, -39, -77, -52, -23, -94, 43, 83, 64, -13, -102, 120, 55, -104, -79, 127,
+        -47, 85, 66, -53, -32, -114, -11, 94, 8, -59, 97, -41, 115, -82, 84, 1,
+        84, -113, -19, -71, 30, 54, 45, -122, -100, -18, -79, -93, 57, -84, -27, 125,
+        57, -50, -55, 22, -56, -72, 99, -32, 52, 48, 4, 70, 56, 97, 52, -50,
+        39, 30, 101, 36, -100, -23, 4, -11, 30, -100, 28, 19, 20, -38, 28, -111,
+        75, 69, 43, 9, 125, -76, 88, 9, -109, -56, 32, 126, -43, -37, 98, -43,
+        -19, -114, 34, -89, -28, -72, -102, -76, 60, 14, -95, -11, -110, 125, 121, -109,
+        -14, 117, -36, 4, -112, 96, 14, -45, 49, 97, 51, 55, 90, -69, 19, -125,
+        55, 109, 36, -2, 98, -17, 29, -102, -58, -102, 42, -26, -8, 115, 106, 86,
+        -108, -113, -36, -103, -26, -53, 58, -110, 63, -74, -126, 100, -71, 20, -63, 84,
+        53, 52, -73, 41, 61, 28, -100, -56, 59, -33, -40, -95, 10, 4, 36, -106,
+        -7, 53, 82, -66, 81, -100, 9, 82, -86, 47, -74, -45, 116, -98, -91, -27,
+        -33, 54, -98, -127, -58, -43, 47, 106, -19, -118, -93, 52, 65, -64, 40, -72,
+        93, 53, -126, -15, -93, 117, -85, 106, 42, 67, 98, 85, -35, -29, -112, 13,
+        82, -35, 83, -73, -97, -53, 68, 11, -65, 74, -54, -23, -39, 98, -90, -12,
+        0, -67, 87, -114, 57, 56, -78, 116, 59, -77, -59, -32, -106, -100, 12, 105,
+        -102, -48, 38, 4, -44, -68, 23, -120, -25, 8, -65, 102, -64, -121, 93, 27,
+        -58, 46, 123, 121, -104, -94, -66, -49, 44, -85, -45, 124, 110, 76, 21, 61,
+        -120, -41, -122, 6, -112, 120, -6, -63, 48, 94, 14, -80, 60, -46, 92, -44,
+        111, 88, -31, 13, -93, 16, 64, 106, 75, 91, 108, -23, -21, 113, -100, 39,
+        -90, -83, 121, -18, -17, -118, -39, 19, 85, 4, -24, 54, -55, 9, -124, 102,
+        98, -92, -117, 32, -55, 52, 67, -39, 66, -53, -60, -32, 96, -72, -105, 98,
+        40, 52, 87, 86, 74, 108, -56, -86, 27, -41, 123, 19, 64, -53, 84, 80,
+        -3, 39, -13, -71, 103, 50, -44, 90, -32, -23, -70, 49, 70, 106, -50, 56,
+        -92, 89, -109, -66, 121, 72, -51, -46, 52, -82, 102, -78, -81, -85, -72, 46,
+        -37, -49, -96, 84, -115, 119, -110, -57, -2, 98, -35, -63, -60, -71, 81, 72,
+        30, -36, 26, 28, 82, -17, -113, 113, 14, 116, -82, -58, -114, -63, 4, 112,
+        -67, -12, -126, 102, -9, 27, -17, 122, 95, -68, -48, 56, 29, -43, -14, 62,
+        22, -12, -67, -118, -45, 44, 9, -40, 80, 17, 46, 17, 90, 120, 9, -53,
+        101, -29, -2, 35, 78, 8, 117, 19, -108, -117, 97, 3, 30, -122, 97, -50,
+        19, 51, -98, 37, 0, -95, -104, -55, 30, 32, 31, 63, -26, -113, -4, -64,
+        21, 51, -110, 117, 115, -23, -73, -42, 46, 20, 123, -46, -110, 28, -115, -9,
+        -35, -63, 57, -64, 53, -93, 51, -16, 67, -18, 14, -68, -80, 125, -80, 92,
+        -6, 66, 115, -67, 13, 74, 67, 115, -56, 45, -23, -5, -55, 55, 69, 1,
+        104, 110, 17, -122, -66, 78, -91, -47, 95, -114, -94, -56, 25, 31, -81, 64,
+        -66, -80, 86, 96, 16, -23, 33, 26, -23, 58, -107, -67, -53, 43, 118, -81,
+        101, 16, -28, -67, 77, -49, 85, 87, -2, 84, 78, -74, -19, 74, -120, 94,
+        66, 93, 70, -23, 115, -30, 13, -21, 20, 69, -50, 55, 42, 31, -101, -4,
+        -25, -63, 65, -7, 40, -87, -102, -109, -122, 69, 49, 124, -85, 66, 4, -22,
+        116, -85, -47, 0, -49, 25, 75, 119, 105, -34, -54, -111, -25, -14, 18, -73,
+        -111, 66, 21, 103, 121, -103, 73, -20, 21, -60, 24, -94, 124, -88, -32, 19,
+        -30, 28, 86, -15, -39, 53, -91, -59, -86, 1, -9, 24, -69, 19, 121, -84,
+        -91, 114, 79, -80, -57, 3, 113, 10, -82, 10, 114, 26, -18, -97, 116, 33,
+        -40, -13, -83, 70, 95, -41, 23, -96, -67, 119, -91, 51, 40, -119, -26, 96,
+        88, -73, 30, -127, -60, 89, 18, 103, 56, -96, 13, 36, 26, -20, 92, -107,
+        -80, 50, -30, -36, -56, -111, 89, 68, 86, -62, -79, 16, -31, 48, 11, 47,
+        -120, 112, -101, 12, -120, -122, -5, -122, 72, 67, 62, 87, 89, -36, -98, -59,
+        -35, -54, 9, -110, 50, -113, -54, 96, -26, -41, 49, 47, 83, 27, -15, 46,
+        53, 56, -43, -10, 115, 15, -128, -67, -29, 77, 9, 81, 68, -66, 2, -92,
+        19, 31, -109, -68, 45, -123, -82, -100, -57, 117, -73, 124, 5, -38, 55, 20,
+        93, 106, -96, -108, -16, -51, 26, -95, -48, 113, -53, -8, -118, -25, 63, -61,
+        -102, 28, -91, -30, 105, 73, -81, -82, -26, -85, 48, 71, -113, 7, 110, -81,
+        -120, 116, -122, 14, -107, 102, -113, -120, 46, -2, 35, 58, 67, -96, 55, 116,
+        71, 16, -34, 78, 127, 4, 77, -3, -121, 116, -120, 125, -69, 27, 61, -94,
+        -104, 100, 90, 60, -89, 92, -75, -42, 73, -27, 39, -28, -29, 50, -23, -85,
+        113, 96, 68, -10, 70, 101, -46, 90, 47, -91, 31, -65, -123, 85, 4, 70,
+        53, 114, -72, -50, 87, -60, 10, 28, -41, -55, 66, 41, 32, -63, 56, 46,
+        -39, -79, -7, 42, 20, 10, 17, 92, 42, 18, 52, -34, 34, 50, 6, -86,
+        -80, 46, 26, 39, 109, 46, 48, 12, 117, 35, 31, 63, 46, 122, -53, -59,
+        -84, 8, -55, -15, 66, 9, 7, -121, 104, -16, -60, 104, 123, -31, 111, 37,
+        90, -25, -126, -127, 65, -71, -79, -11, -126, 81, -40, 79, -80, 76, -54, 24,
+        14, -41, 108, -38, 60, 39, -106, 53, 21, 13, -112, -78, 38, 33, 109, 69,
+        -41, -84, 99, 77, -40, 120, 8, -79, 42, -85, 81, 40, 86, 44, 107, -113,
+        -76, -119, 105, 33, 67, -36, 20, -117, -85, 110, -83, 30, 127, -107, -104, 47,
+        86, -86, -8, 45, -126, -51, -36, 126, -126, 57, -69, -106, 120, -19, -20, 90,
+        -16, -118, -49, 127, 17, 66, -127, 72, 28, -15, 76, 84, 92, 11, -63, -91,
+        79, 48, -72, 29, 22, -43, -91, 39, 110, 15, -97, 102, -103, 17, 95, 11,
+        -92, 119, 118, -51, 50, -110, 58, 86, 58, 106, -116, -91, -37, 40, 89, -77,
+        38, -105, 12, -27, 68, -111, 112, 90, 114, -63, -37, -44, 100, 27, -90, 99,
+        108, -76, -105, 69, -57, -74, 65, -96, -28, -12, -75, 29, -86, -46, -86, 80,
+        -90, -79, 30, 109, 108, -107, -25, 40, -53, 91, 16, 13, -93, 11, 111, 75,
+        -106, -2, 44, 67, 84, -3, 83, -86, -128, -70, -102, -91, -30, 74, -63, -67,
+        26, -70, 123, 9, -6, 63, -47, 82, -15, -70, -59, -6, -25, -47, -64, 80,
+        86, 29, -70, 64, 118, -44, 60, 21, -81, 84, -46, 56, -28, -7, 47, 49,
+        89, 125, -37, 91, 85, -104, -20, -40, 98, 120, -37, -47, 76, 29, 105, 101,
+        8, -72, 5, -55, 116, 93, 71, -128, 35, -75, 33, 0, 20, -48, -59, 16,
+        56, 111, -108, 24, -67, -60, 57, 27, -40, -92, 40, 115, 47, 105, -72, -33,
+        -28, 113, 99, -75, 112, 44, -118, 79, -76, 10, 71, 72, 97, 127, 3, -44,
+        23, 117, 8, 5, 90, 4, 54, 17, 32, -115, 13, 26, -5, 55, -59, -11,
+        -26, 109, 24, 87, 113, -55, -70, 52, 106, 10, -10, 121, 10, 26, -78, 76,
+        -23, 9, 36, 82, 27, 23, -96, 27, -36, -75, -80, 58, -23, -95, 27, -113,
+        99, -2, 3, -8, -11, 90, -91, -61, 33, 59, -90, 127, 33, 117, 21, -21,
+        104, 98, 66, 101, -115, -24, -28, 98, -28, -103, 17, 73, -25, 94, -53, -89,
+        -100, -107, 114, 102, 77, -15, -114, 4, -113, 34, -126, -100, -108, -20, -37, 46,
+        73, -62, 34, 97, 5, -47, 107, 114, -60, 121, -115, -90, 82, 80, 21, -1,
+        -27, 122, -8, -21, 66, 5, -116, -126, -44, 68, -28, 96, 122, 34, -13, -32,
+        -29, -6, 8, -66, -82, 59, 58, 119, -123, 9, -85, -114, 81, 100, 122, 109,
+        22, 57, 60, -62, -92, -107, 85, -24, -16, 72, 44, -55, -106, 53, 17, -34,
+        -83, 112, 110, -7, -34, -91, -55, 109, 117, -97, 20, -73, -84, 18, 11, -91,
+        70, 117, -71, -94, -43, 109, -8, 101, 65, -6, 1, 125, 2, 85, -38, 4,
+        -86, 18, -86, -86, -93, -54, -48, 96, 25, 69, 64, -7, -103, -33, 72, 1,
+        -20, -61, 41, -82, 47, -54, -30, 3, -67, -113, 62, 43, 75, 12, 17, 100,
+        122, 25, 36, 46, 38, -37, -101, 21, -105, 1, -36, 126, 2, -82, 97, 77,
+        48, 37, 45, -3, -52, 103, -23, -14, -26, 34, -67, -54, 54, 121, 82, 17,
+        -17, 95, -75, 112, -123, 106, 21, 84, 122, -75, 17, -123, 77, -62, -85, 19,
+        125, 86, 99, -21, 94, -69, -73, -46, -22, 24, -123, -72, 40, -99, -66, 70,
+        113, -39, 82, -107, -33, -4, 17, -66, 84, 67, -28, 80, 105, 121, 114, -125,
+        -15, 28, -124, -22, 6, -6, 31, 122, 9, 103, 33, 94, -39, 105, 39, -64,
+        -108, -53, 56, 100, 70, -78, 19, -113, -52, -56, 17, 113, -55, -42, -18, -71,
+        -93, 104, 88, -62, 87, -44, -112, 50, 55, -34, -41, 45, 38, 36, -116, -45,
+        105, -56, -84, 3, -87, 119, 107, -85, 9, 30, 102, -58, -110, -42, -38, -68,
+        -89, -123, -64, 42, 28, 15, -48, 12, 48, -90, 127, 39, -24, 52, -111, -49,
+        106, 82, 31, 103, -61, -106, 39, -59, -38, -108, -2, -6, -20, 62, 40, 80,
+        92, -117, -38, -95, 107, 92, 19, 13, 31, 120, 80, 46, -12, -85, -19, 124,
+        13, 27, 54, -52, 103, -92, 82, -41, 112, 117, 126, 92, 15, 51, -29, 21,
+        -32, -67, -10, 98, 86, -95, 23, -77, 110, -73, -94, 91, 100, -4, 30, -82,
+        -113, 73, 34, 77, -12, -24, -21, 88, -4, 29, 102, -4, 87, -33, -113, -126,
+        -46, 108, 42, 101, 94, -15, -38, -61, 76, 70, 35, -15, 123, 16, -9, -91,
+        54, -17, -32, -85, -2, -95, 80, 123, 96, -11, -121, 20, -90, -11, 40, 100,
+        -68, 123, 29, 117, -65, -18, -117, 75, -22, -122, 89, -36, 94, -122, -69, -109,
+        104, 26, -19, -23, 39, -101, -3, 34, 46, -12, -20, -114, 82, -89, -56, -108,
+        58, 5, -76, 33, -76, -74, -49, -18, 40, -19, 12, 59, 59, -30, 78, 84,
+        -1, 46, -91, 58, 33, 27, -88, -92, -62, 89, -62, 29, -31, 41, -64, 108,
+        -13, -83, 104, -13, 108, 115, -101, -103, 110, -77, -69, -91, -47, 41, 55, 51,
+        21, 58, 12, -4, 53, -125, 99, 93, -44, -52, -43, 3, 13, 32, -18, -41,
+        -8, -108, 127, -100, -58, 83, -63, 65, -57, 51, 65, 124, -60, -103, -100, -87,
+        51, 57, 83, -68, 45, -121, 38, -61, 33, -49, -114, -85, 125, -19, -22, -109,
+        -104, -123, 111, 109, -125, 33, 107, 75, 114, 85, -14, 31, 94, 61, 123, -73,
+        -67, 30, 43, -57, 33, -63, 32, -39, 22, 95, -53, 62, -98, -117, -72, 15,
+        -89, 11, -28, -6, 17, -67, -125, 9, -88, 20, 64, 107, 65, 34, -104, 93,
+        70, -81, 123, 35, 42, -123, 8, 64, 5, 87, -13, 19, -121, 27, -96, -24,
+        0, -125, 53, -23, 61, -64, 63, -111, 87, 33, 80, 30, 84, 100, -89, -60,
+        -3, -63, -123, -124, -62, -34, -101, -65, 127, 39, 26, 0, -106, -40, 60, -52,
+        25, 30, -26, -84, -37, -115, -16, -52, 102, 112, -110, -59, -95, -122, -97, 35,
+        -83, -9, -44, -82, 120, 29, 8, 78, 48, -24, -100, -118, 51, 17, 117, -126,
+        88, 125, -99, 90, 95, 83, -21, 107, 102, 125, 101, -42, -41, 25, -5, 47,
+        -39, -52, -86, 77, -21, -53, -35, 22, 69, 92, -128, 79, 79, 94, -47, 122,
+        84, 48, 39, -39, 2, -66, 60, -79, -54, 28, 91, 55, 114, 18, 103, 105,
+        -114, -93, -121, -25, 112, -128, 98, -42, -52, -96, 3, -34, 72, -112, -58, -53,
+        -109, -42, -26, -73, -70, -108, 41, -98, -71, -67, -89, 6, 56, 121, 115, -111,
+        -71, -25, 54, 30, -116, 88, -19, -111, 27, -58, 8, -112, 57, 34, 70, -76,
+        -9, 6, -76, 56, 30, 76, -42, -82, 15, 28, -54, 7, -38, 22, -17, -12,
+        -43, 122, 40, -80, 57, -91, 66, 26, 127, 102, 120, -91, -83, -47, 60, -121,
+        28, 58, 9, -43, 38, -68, 39, -81, 37, 25, -101, 66, 101, -123, -21, 55,
+        -93, 12, 26, 78, 27, -58, 112, -103, -37, 38, -50, 16, -43, 21, -113, -21,
+        -80, 70, 114, -77, -36, 92, 97, -71, 77, -57, 78, 3, -46, 98, 26, 33,
+        93, -43, 107, 96, -98, -26, -106, -122, -102, -116, 24, 7, -114, 19, 54, 5,
+        124, 66, 107, -44, 8, -85, -110, 80, -68, -5, -79, -102, -88, 84, -112, -84,
+        34, -25, -118, -83, -24, 84, -94, 7, 80, -91, -89, 61, 73, -76, 117, 47,
+        -13, -85, -126, -119, -107, -123, -2, 78, -74, 105, -57, -106, 41, -88, -107, 53,
+        -76, -65, -11, 25, -33, -64, 52, -106, 46, -45, 88, 2, -45, 88, 74, -90,
+        81, 13, -110, -120, -24, 54, 5, -46, -102, 75, -21, 41, -79, 116, -50, 19,
+        123, 78, 44, -125, 49, -24, -56, -79, 107, -62, 54, -82, 39, -61, -106, -103,
+        -80, 7, 15, -29, 29, -39, -18, -50, -108, -107, 22, 91, 54, 8, 107, -76,
+        -40, -86, -12, -72, 127, 108, -38, -90, 9, -1, -28, -78, 44, 64, -112, 44,
+        -100, -76, 113, -53, 48, 66, 86, 62, -97, -93, 72, 18, 40, 41, 81, 16,
+        62, -32, -114, -47, -3, 36, 95, 125, -78, -101, -84, 25, -57, -70, -84, 83,
+        -27, 71, -77, -105, 99, -103, 48, 67, 122, 18, -107, 37, 108, 116, 68, 0,
+        90, 42, 94, 81, -32, -66, 69, -120, -28, 104, 67, 28, -58, -122, 78, 24,
+        11, 34, 106, 90, 44, -93, -7, -73, 37, 2, 33, -127, 73, 67, -118, -109,
+        89, -114, -99, 50, -105, -110, 20, 35, 50, 37, 48, -8, -124, 24, -52, -77,
+        116, 38, 8, 92, -98, 84, -111, 32, -124, 78, -30, 11, -31, 53, 72, 97,
+        118, -104, -36, 84, 37, -2, -31, 77, 72, -42, 101, -90, -95, -9, -80, 69,
+        -21, -40, 41, 22, -17, 11, 36, 126, -70, -52, -25, -77, -113, 31, 13, -33,
+        113, -68, 116, -41, -68, 106, 102, 41, -42, -55, 55, -91, 32, 45, 56, 64,
+        71, 6, 110, 98, -27, 74, -102, -80, -38, 82, -119, -29, -80, 74, -102, 52,
+        -108, -106, -56, -58, 30, -2, -128, 118, 127, 21, 13, -67, 85, -31, 86, -38,
+        -33, 7, 58, 97, 127, 95, 27, -76, 42, -111, 69, 74, 62, -62, -77, -29,
+        -54, -112, -15, 58, -12, -49, -80, 73, 16, -23, -61, -94, 6, 24, -60, 85,
+        59, 42, 92, 46, 60, 19, -31, 51, -44, 50, -64, -79, -5, -2, 88, 113,
+        70, 109, -54, -17, 110, -59, 8, -115, -16, 93, 43, 45, 45, 111, -113, -124,
+        -81, -126, 126, -36, 29, 120, -98, 19, -124, 14, -122, 109, -21, 21, -124, 74,
+        -26, 53, -50, -56, -85, 17, -36, -104, -101, 25, 50, 31, -55, 105, 32, 20,
+        114, 28, -122, -63, 88, 55, 58, -126, 16, -108, 20, 25, -26, -9, 39, -26,
+        27, -64, 25, -37, -13, -61, 30, -89, 14, -55, 23, -98, -102, 122, -122, -34,
+        34, -84, 55, 2, -92, -42, 126, 114, -84, -101, 106, 69, -33, -32, 93, 100,
+        106, -99, 25, 106, 40, -58, -123, 71, -82, 99, -68, 23, -96, -3, -102, -118,
+        38, -118, 72, 46, 27, 75, 30, -102, 23, 105, -82, 7, -111, 25, 38, 96,
+        -33, -74, -102, 16, -11, 100, -33, 67, -115, -31, -60, 70, 115, 20, -86, -74,
+        80, 66, 40, 116, -14, -60, 116, 11, 78, -7, -107, 93, -65, 29, 101, 86,
+        112, 89, -65, -49, -21, 86, 110, 26, -91, 71, 46, -83, -91, -82, -51, 52,
+        -23, -53, 119, 66, -73, 43, -93, -12, 81, 53, -22, 116, 82, 102, -95, -19,
+        34, -29, 20, -87, 112, -8, 87, 93, -81, 77, -26, -100, -38, -8, 60, -8,
+        -51, -60, -111, -48, 28, -43, -86, -4, -5, 50, 70, -119, -109, -45, 55, -105,
+        4, -39, 19, 99, 53, 20, -63, -50, -37, -47, -112, -28, 56, 15, 105, -19,
+        -66, 54, -52, 69, -40, 69, 102, 104, -56, -33, 101, -30, 112, 28, -104, -116,
+        63, 58, -6, 52, 120, -14, 96, 18, 95, 102, -11, 69, 49, 51, 66, -72,
+        7, 109, -24, -116, -34, 12, -101, -69, -85, -33, -108, -69, 68, -82, 89, -106,
+        120, 111, -100, 86, -43, 9, -64, 69, 84, 53, -14, -20, -53, 71, 71, -47,
+        -114, 18, 123, -42, 60, 52, 69, -10, 36, 12, -43, 20, -58, -45, 74, -67,
+        -109, -76, 116, 102, -116, 126, -79, -39, 117, 16, -66, -11, 49, 90, 59, -4,
+        -75, -70, 51, 66, -1, -57, 30, -101, 78, -123, -47, -32, 70, 65, 20, -42,
+        -122, -17, 76, 88, 67, -126, 5, -91, 71, -120, 93, -39, 33, -66, 57, 2,
+        -123, 86, -123, -124, -47, -37, 71, 41, 74, -53, 76, 119, -119, -28, 77, 89,
+        81, 122, 65, 48, -76, 116, 19, 5, -89, 68, 59, 112, 7, -117, 10, -1,
+        97, -81, 35, 83, -4, 40, -73, -127, -30, 106, -48, 110, 11, -32, 123, -67,
+        -42, -112, -105, 98, -102, 33, -7, -69, -31, 7, -40, 52, -125, 83, 70, 100,
+        81, 28, 122, -19, 86, -39, 10, -109, -82, -113, -90, -106, -104, -29, 123, 32,
+        59, -10, -101, -98, 49, -113, 26, 9, -39, -21, 126, -30, 107, 31, -72, 125,
+        -45, 108, 11, 104, -50, -84, -84, -65, -55, 96, -109, 100, -94, 126, -36, 82,
+        77, -30, -12, -85, 101, -67, -127, 127, 19, 79, 74, 100, -42, 126, -111, -74,
+        27, -2, -110, -111, 52, 36, 2, -9, -125, 107, 48, -53, 124, -66, 27, 108,
+        52, -32, -99, 78, 109, 109, -51, -125, 95, -57, 45, -122, 31, 106, -118, 125,
+        -93, -85, -47, -71, 27, 25, -21, -75, 93, 86, -8, 82, -43, -33, -94, 40,
+        -88, 108, -113, 29, -16, -118, -39, -117, 88, -7, -92, -35, 9, 53, 109, 85,
+        -79, -19, 72, -11, -124, -51, 17, 29, -61, -61, -36, 85, -59, 22, 59, -114,
+        84, 35, 88, -31, 1, 74, -60, -29, 42, -58, 0, 102, 24, -122, -50, -83,
+        -96, -94, 42, 112, 30, -37, 13, -70, 78, 28, -92, 29, -71, -128, -34, -70,
+        -108, 6, 19, 104, -19, 67, 83, 93, -39, 21, 96, -115, 116, 77, 52, 1,
+        87, 83, -91, -80, 71, 19, -88, 74, -59, 37, -80, 109, 42, 77, -83, -80,
+        -33, -112, 73, 82, 6, 6, 103, -83, -50, 112, 77, -114, -54, -107, 41, 48,
+        90, 65, -14, -106, 67, -83, 121, -73, 123, -97, 17, -106, -57, 26, 26, 96,
+        10, -74, -126, -100, -86, 36, -50, -125, 16, 98, 99, -95, 8, -80, -109, 25,
+        -75, 52, -44, 5, 122, 31, -38, 27, 28, -10, 99, -91, 109, 102, 41, -25,
+        -74, -101, 103, 67, -121, 52, 96, -97, 21, -16, -79, 112, -40, 67, -61, -59,
+        81, -62, 94, 29, 58, 68, -102, 99, 54, -86, 77, 91, 21, 11, -59, 34,
+        48, -91, -118, 48, 71, 54, 117, -79, 1, 87, 24, -19, 69, -46, -49, -82,
+        -40, -105, 95, 8, -91, 115, -33, 9, -12, -33, -13, -20, -125, -3, 126, -87,
+        -56, 23, 29, 99, -60, -112, 56, 98, -121, -58, -63, 20, 35, -98, 1, 73,
+        49, 59, -99, -53, -97, -105, 24, -31, 108, 86, 124, 88, -56, -33, -53, 43,
+        -7, 11, 35, 62, -88, -33, -53, 90, -2, -60, 121, 65, -78, -92, 88, 78,
+        47, -40, -19, -72, -8, 48, 51, -32, -108, -24, 15, -40, -122, -14, 39, 27,
+        71, 121, -61, -108, -43, -8, -42, 40, 31, 69, 117, 44, -103, 122, -30, -117,
+        -119, -126, 10, 55, -90, -79, -71, -106, -89, -111, 54, -50, 92, -124, -119, 32,
+        59, -125, 20, 14, 37, 69, 105, 127, -107, 94, -15, -73, -52, 126, 49, 3,
+        -108, -124, -96, 18, 71, 49, -128, 30, -29, 89, 81, 42, 103, 77, 28, -78,
+        -88, -105, 123, 13, 126, 3, -17, -110, -124, 38, 100, -61, 81, 70, 103, -128,
+        55, -65, -111, 37, 44, -116, -94, -18, 32, -58, -120, -60, -126, 93, -21, 113,
+        -16, -113, 11, 59, 101, 48, 1, 114, -21, 78, 48, 50, 6, 49, 94, -96,
+        -8, -52, -4, -60, 16, 36, -79, -99, -124, -34, 18, 27, 41, -2, 114, -29,
+        11, 79, 81, 72, -92, -46, 121, -17, 55, -78, 119, 126, -87, -26, 8, 78,
+        119, 51, 49, 1, 34, -35, -104, -57, -56, -37, -54, -72, 89, 111, -110, 20,
+        113, -35, 12, -25, 49, -113, -117, -72, -124, -10, -81, -46, -86, -62, 23, -126,
+        -3, -2, -102, 28, -108, 22, 103, 103, -119, 79, 45, 11, -61, 95, 122, -25,
+        30, 110, 24, -72, 34, -36, 57, 46, 26, -119, -24, 39, 52, 97, -78, 22,
+        -99, -98, 84, 72, -55, -26, -84, -127, -46, 124, 98, -50, -23, 65, -70, 57,
+        -104, 40, -34, -49, 5, -71, 106, -83, 87, 53, 25, -105, 24, -91, -43, 77,
+        26, 23, -76, -74, 28, -20, 75, 92, 71, -42, 52, -108, 113, 107, 29, -116,
+        -55, -121, -127, 75, -60, -19, -80, -87, -100, 124, -2, 62, 11, -117, -125, -125,
+        82, -24, 49, -20, -46, -69, -119, -66, -66, -25, 72, -67, 123, -117, -48, -94,
+        96, -68, -14, 50, 46, -92, -81, 123, -104, -47, 120, 30, -115, -38, -5, 54,
+        89, -21, 62, 41, 14, -31, -94, -39, -122, -54, 91, 120, -38, -65, -104, 68,
+        5, 92, 83, 11, -20, -69, -24, -61, -123, -43, 7, 45, -40, 109, 25, -75,
+        30, -33, -62, 59, 62, 115, 112, 11, 11, 112, -37, -48, 120, 92, 55, -101,
+        -122, 36, 97, 94, -76, 64, -47, 75, -86, 119, 52, 36, -81, -41, 94, -82,
+        -82, 88, -72, 90, 76, -43, 6, -84, 72, -39, -30, 10, -125, 94, -76, 105,
+        -66, 81, 7, 61, -40, 20, -87, 72, -29, -78, -78, 60, 58, -37, -18, 96,
+        104, 31, 27, -108, 60, 58, 63, 66, -35, 18, 74, 87, -66, -86, 124, 89,
+        82, 58, -69, -84, -22, -30, 82, -92, -59, 55, 108, -3, 51, -52, 99, -66,
+        49, 82, -12, -70, -124, 72, 33, -78, -68, -65, 73, 109, 75, -6, 106, -93,
+        -115, -72, 44, 95, -55, 72, 60, 52, 111, -29, 0, 9, -89, -64, -72, 105,
+        -43, 29, 74, -107, -66, -13, -44, 56, -9, 22, -33, -20, 10, -50, -14, -75,
+        -90, 101, 77, -63, 117, 32, -55, 19, -107, -122, 15, 88, 93, -23, -29, 109,
+        29, -109, -32, -62, -68, -49, 29, 74, -50, -15, -13, -75, -108, -18, -56, -66,
+        -109, -60, 32, 16, 99, 91, -120, 16, 10, 0, 66, -63, -60, 66, -81, 83,
+        90, 51, -118, -43, 55, -85, 23, 51, 82, -66, -120, 116, -96, -81, -115, 84,
+        -116, -48, 37, -40, 18, -104, 77, 57, 101, -15, -69, 95, 81, -86, -6, -65,
+        67, 81, -118, -78, 25, -13, 31, 69, -55, 53, -94, 123, 89, -28, 83, 115,
+        -107, 84, -123, -115, -30, -34, 27, -118, 46, 56, -60, 40, -123, 49, -103, -55,
+        -64, 17, 12, 6, -67, 65, -80, -114, -92, 99, 63, 42, -96, -126, 11, -46,
+        15, 25, -77, -48, 46, 67, 23, -120, 10, 64, -88, -54, 52, -119, 123, 122,
+        -72, -75, 100, -106, -60, 10, -64, 93, 28, -42, -10, -125, -109, 39, -78, 24,
+        109, 103, -68, -8, -124, 27, 42, -86, -102, 104, -74, 124, 104, -92, -118, -80,
+        99, -110, -51, -16, -16, -31, -86, 44, -81, -126, 60, -127, -104, -46, 116, 71,
+        -27, 97, -90, -76, -50, -38, -63, -127, -31, -42, -55, -28, -24, 61, -98, -99,
+        -114, 125, -71, -12, -96, -11, 121, 110, -18, -68, -101, -22, -65, -120, -81, -77,
+        88, -87, -125, -125, 125, 91, -123, -50, -100, 55, -1, -46, 88, -27, -11, 72,
+        110, -29, 111, 80, 99, -3, 60, -71, 14, -37, 125, 14, 10, 54, 24, 41,
+        95, -57, 65, 16, 75, 105, -84, 53, -76, -28, 48, 92, 34, -122, -107, -123,
+        99, -9, 38, 63, -123, -61, 113, -114, -95, 42, -37, -60, -106, -116, 114, 69,
+        -64, -64, 79, -26, -100, 116, -76, -57, 78, -96, 34, 19, -54, -67, -53, -18,
+        64, 55, -29, -122, -76, -34, 104, -38, -88, 113, -20, -101, -70, -72, -118, 100,
+        -64, 119, -87, 58, -49, -97, -83, 66, 6, -38, 109, -8, 72, -26, -15, 93,
+        96, -101, -54, -102, -34, 24, 41, 118, 85, 83, -111, 101, 89, -50, -61, 63,
+        5, -84, 85, -107, -49, 100, 0, -99, 109, 46, 7, 17, 24, -103, -75, 54,
+        -34, -1, -43, 72, -115, -25, 42, -15, 116, -100, 4, -25, 98, 46, 79, -12,
+        75, -106, -55, -23, 26, 42, -118, 100, 67, 99, -59, 31, 96, 13, 73, -21,
+        22, 99, 96, 27, 53, 40, -24, -111, 88, -106, 20, -36, -75, -67, 117, -28,
+        -6, -58, -84, 90, 126, 86, 22, -105, 94, -120, 50, -8, 36, 94, 113, -122,
+        35, 20, -26, -8, 35, 17, -70, 94, -93, -3, 51, -87, 82, -90, 125, -19,
+        -98, -83, -122, -50, -125, -13, 90, -86, -124, -13, 77, 49, 104, 84, 89, 13,
+        -102, 85, 28, -9, -63, -97, -36, -61, 105, -77, -121, -45, 109, 61, 60, 106,
+        -10, -16, -56, -45, 67, 123, -122, -23, 122, -40, 101, -71, 12, -46, 67, -83,
+        88, -92, 78, -121, 20, -116, -32, -111, -15, -48, 84, 104, -2, 17, 108, 16,
+        97, -73, 30, -86, -80, -23, -52, -68, -95, 53, -49, -125, 35, -97, 99, -55,
+        -115, 8, -43, -90, 95, -111, -128, 71, -92, -16, 108, 70, 18, 112, -120, 50,
+        24, -100, 78, 60, -102, -84, 35, -11, 42, 45, -78, 45, -121, -109, 86, -24,
+        -73, 88, -107, -47, -107, -88, -103, 102, 21, 14, 14, 23, -117, 124, -93, 13,
+        -22, -87, 85, -98, -109, 2, -57, 85, -75, 40, 25, 89, 122, 69, 63, -79,
+        110, -123, 103, -82, -123, -42, -59, 102, 42, -10, 86, 8, -25, 15, 65, 121,
+        127, 16, 22, 19, -93, -1, 34, 72, 76, -64, -38, 120, 91, 56, -86, 46,
+        18, -116, -17, -112, -19, 2, 78, -97, 50, -79, -64, -22, -124, -27, -111, 60,
+        -25, 34, 122, -95, -48, 108, -105, -118, -20, 20, -103, 21, 107, -96, 29, 81,
+        53, 12, -106, 112, 81, -65, 65, 10, -8, -57, -59, -49, 85, 22, -56, -125,
+        79, -70, -1, 95, -10, 33, -118, -31, -82, 46, 79, -117, -71, -17, -24, 83,
+        -122, 127, 55, 26, 115, -51, -59, -74, -13, 61, -36, -114, -100, 97, 24, -103,
+        -89, 73, 24, -70, -39, 30, 13, 89, -21, 123, 55, 94, 9, 26, 79, 67,
+        -20, 86, -70, -52, -50, -126, 56, -92, -112, 10, 112, 14, -16, 84, 72, 6,
+        -64, -39, 38, -53, 42, -37, 9, 111, 66, 103, -93, 94, 38, 125, 49, -21,
+        -37, -18, 117, 54, -11, 80, 67, 1, 106, 117, 54, -121, 97, -76, -117, 5,
+        118, 106, 24, 27, 16, 49, -123, -115, 102, -97, -26, 37, -100, 92, 79, -61,
+        83, -54, -40, -40, 52, 23, 105, -59, 8, -70, 105, 110, 4, 40, -12, -21,
+        -48, 53, 105, 99, -33, -3, -31, 17, 62, -32, -94, 64, 30, -43, -53, -36,
+        -125, -61, -43, -59, -19, 95, 110, -13, -62, 94, -78, -61, -24, -78, -35, 13,
+        123, 121, -83, 66, -94, 61, -101, -49, -13, 43, -17, -10, -55, 56, 103, -29,
+        4, -120, 50, 59, 77, -65, 104, -55, 88, -127, -10, 1, -117, -78, 98, 87,
+        -20, 60, -16, -21, -83, 35, 23, 5, -39, 3, 125, -53, 36, -53, -58, 119,
+        -112, 113, 76, -81, -61, -88, 43, -89, 84, -38, -62, -61, -28, 118, 84, 90,
+        -101, 59, 124, 27, -52, 74, -127, 89, 41, 48, 43, 5, 102, 69, 96, 118,
+        112, -105, 47, 92, 66, 43, 113, -117, -6, 102, 127, -5, -85, 93, 1, -84,
+        28, 0, -62, 97, 127, -85, -37, 122, 9, -29, -24, -114, 51, 23, 27, -9,
+        -5, 38, -57, -10, 46, 68, 53, 45, -27, 106, 35, -60, 91, 123, -66, 119,
+        123, 40, -35, -34, -101, -25, -46, 109, 83, 57, -65, 55, -101, -90, -51, -12,
+        18, -16, -71, -25, 40, -95, -61, -41, 118, 84, -100, -94, 122, -46, 102, 117,
+        108, -42, 96, 26, -113, -51, 88, 11, -125, -64, -46, 0, 92, -63, -9, 36,
+        -74, 74, 28, 57, 37, -32, -101, -62, -94, -7, 44, 69, -85, -106, 13, 65,
+        13, -93, 120, 43, 65, 35, -37, -67, -2, 62, -22, 51, 32, 27, 80, 35,
+        -31, -97, -59, 64, 110, -25, 72, 96, 87, -21, 97, -93, -65, 48, 65, 117,
+        -15, -110, -126, -90, -57, -114, -109, -17, 45, -111, 21, -72, -96, -47, 1, 70,
+        21, -84, 12, 46, 64, 126, -54, 106, 55, -31, 18, 50, 18, -117, 30, -21,
+        -123, -43, -115, 88, 119, 28, 46, -28, 38, -23, 52, 86, 50, -120, 43, -100,
+        104, 67, 79, -54, 64, -122, 88, 80, -47, -64, -57, -62, -4, -74, -102, 12,
+        49, -32, 36, 91, -84, 41, -29, 2, -114, 59, -17, -93, 112, 69, -42, 70,
+        12, 45, 11, -19, 112, 73, -55, -90, 34, -74, 9, 6, 14, -61, 93, 81,
+        -77, 83, -25, -59, -94, -91, 79, -112, -77, -75, 75, -25, -59, 98, -57, 30,
+        -99, -93, 3, -38, 109, 29, -46, -86, 0, 98, 12, -70, -109, 113, -21, -7,
+        98, 6, -108, 114, -91, -95, 63, 127, 37, -51, -99, -84, 79, 17, -39, 45,
+        84, 1, -39, 31, 57, 7, 105, -13, 17, 50, -103, 4, 27, -106, 79, -107,
+        88, -60, 47, 109, -19, 16, 7, -34, 112, 68, 122, 62, 57, 28, 1, -112,
+        -10, 91, 59, -100, 58, -43, 41, -1, -15, -5, -28, 83, -25, -121, -21, 63,
+        126, -18, -43, -4, 82, -81, -88, -69, -72, -38, 24, 125, 104, 78, 80, -68,
+        -3, -78, -28, -40, -126, 61, 97, -105, 40, 6, 104, -26, -84, 118, -70, -69,
+        101, 97, 19, -116, 9, -66, -27, -26, 52, -124, -109, 118, -112, 67, 9, 60,
+        -21, 9, -50, 70, 61, 9, -96, -62, -68, -104, 32, -17, -43, -71, 3, 72,
+        105, -19, -85, 96, 102, -46, 56, 62, 82, -4, -12, -123, -97, -103, -66, 104,
+        -65, -64, -20, 53, -48, -47, 50, 63, -11, -36, 105, 7, 18, 122, -9, -52,
+        -66, -52, -119, -101, -19, 126, -40, 12, 55, 22, -97, 112, -42, 92, 14, -6,
+        98, 23, 116, -105, 34, -31, -31, -32, 58, 21, -114, 81, -96, 58, -78, 52,
+        -15, 44, 17, -103, -89, -76, -81, -47, -68, 72, 103, 86, 76, 13, -78, -43,
+        111, 40, -100, -77, 82, 91, -52, -81, 38, 53, 55, 54, 50, 31, 95, -85,
+        56, 64, 80, -127, 101, -55, -62, -17, -85, -62, 3, 89, -83, -125, 66, 104,
+        -10, 125, -60, 87, 29, -119, 39, -6, 24, -17, 66, 4, 110, 34, -25, 89,
+        -71, -118, -70, -124, -111, 56, 104, 95, 10, -113, 11, -79, 116, -74, 64, -34,
+        43, -47, -49, -106, 85, -79, 54, 42, -42, 22, 46, 65, 69, 121, -107, -23,
+        -107, -55, -28, -67, -33, 112, 32, -24, -97, 74, -3, 100, 22, 63, -113, 111,
+        -8, -24, -55, 78, -120, 83, 35, -5, 18, -109, 107, 95, -103, 123, -88, -110,
+        -105, -27, 124, -104, -83, -39, -45, -92, -100, -85, 12, 61, 22, 4, -79, -93,
+        4, -60, -77, -43, -46, 43, -86, 66, -99, -94, 95, -78, 79, -122, 66, -105,
+        -55, -103, -61, 57, 46, -89, -62, 74, 0, 126, 100, -102, 57, -113, 121, 76,
+        -83, -5, 78, -116, 89, 57, -21, -89, -42, -38, 75, 83, -74, 44, 108, -19,
+        110, -38, 121, 59, -118, 115, 104, 67, 69, 61, 108, 58, -108, -52, 56, -38,
+        -50, -58, -7, -57, -113, 100, 67, 43, 118, 57, 106, 101, 111, 16, -49, -20,
+        -10, 50, 18, -44, 0, 69, -67, -119, -52, -118, 75, 105, -45, 100, 27, 85,
+        13, 122, 50, -76, -30, 111, -62, -82, 72, 121, -99, -2, 77, 124, 14, -52,
+        -119, 39, -61, -92, -77, -12, 50, -97, -81, -16, -95, -45, -79, 127, -77, -78,
+        39, -106, -96, -56, 62, -111, -69, -78, 115, 14, 55, 39, -104, 57, 28, -102,
+        107, 69, -62, 20, 122, 66, 70, -115, 53, -22, -2, 56, 33, 111, 29, 61,
+        -41, 56, 39, 51, 5, 21, -52, 54, 39, -53, -124, 60, 2, 26, 63, 63,
+        56, -72, -69, -97, 100, -29, -100, 13, 18, 79, 96, 115, 30, 28, 12, 18,
+        -11, -62, -118, 57, 17, -51, 40, -52, 36, -34, -50, -28, -109, -80, -109, 4,
+        -65, 46, -112, -25, -24, 112, 85, -20, 35, 74, -71, 48, -124, -114, 105, -51,
+        104, -31, 101, 54, -28, -38, -17, -5, 5, -89, 81, 67, 110, 42, -108, -21,
+        13, 95, 95, 101, 98, 40, -52, 83, 15, 34, 61, -92, 114, -108, -53, -40,
+        31, 117, 117, -107, -62, 84, 81, -41, 69, -73, 67, -53, 122, 76, -10, 101,
+        16, 41, 3, -77, 38, -71, -29, 35, -103, -76, -87, 90, 92, 91, 117, -59,
+        126, -37, -70, -46, -58, -34, 28, -122, -101, 119, -85, -12, -29, -83, 90, -63,
+        102, 48, -96, 72, -45, 117, -125, -16, -37, 3, -85, -128, -73, -120, 116, -83,
+        40, 62, -61, 72, 62, -70, -16, -21, 101, -78, -93, -110, -4, -19, -108, -29,
+        71, 22, 47, -5, 38, -85, 41, -2, -99, -24, -69, -69, 127, -107, 9, -112,
+        21, 69, -46, 62, -103, -75, 115, 84, 77, -78, 71, 108, 104, 119, -2, -18,
+        52, 67, 60, -70, -53, 6, 29, 53, 35, -77, -76, 4, 102, 113, -10, 123,
+        -42, -104, 75, 125, 68, 51, 125, 120, 97, 99, -1, -70, -112, -63, 81, -79,
+        70, 24, 29, -25, -99, -92, 26, 90, -28, 13, -96, -110, 10, -50, 30, 14,
+        -63, -16, 85, -52, -18, 28, -59, 80, 3, -57, -91, 91, 115, 14, 45, -124,
+        45, 80, -41, 126, 125, -21, -64, 45, 27, 54, -97, 76, -2, -8, 81, 97,
+        77, -5, 50, 104, -32, 37, -1, 61, -128, -8, 61, -30, -39, -88, -119, -84,
+        75, -13, -59, -50, -43, -88, 116, -88, -126, -61, -100, -32, -71, -10, 80, 68,
+        116, -34, -37, 41, -94, -74, -98, 90, 7, -109, 80, -90, -127, -57, 58, 97,
+        99, 39, 28, -29, -14, 14, 3, -64, -46, 94, 79, -3, -57, 13, 12, 38,
+        -12, -59, -59, 32, 98, 97, 105, 63, -37, 38, -35, -100, 9, -52, 63, -37,
+        38, -35, -100, 9, 113, -99, -24, 96, 75, -100, 61, 69, -94, -47, -100, -114,
+        -100, -99, -96, 70, -89, -82, -62, -39, 10, -125, -68, 24, -89, -86, -10, -100,
+        34, -29, -114, -22, 93, 107, 15, 9, -118, -111, -61, -74, -28, -118, -59, 55,
+        109, -85, -66, 63, -112, 126, -119, 121, 19, -101, -50, -52, -61, -88, 69, -117,
+        71, -6, -45, -64, 38, 72, -67, -93, -42, 102, -115, -40, -100, -121, 85, -70,
+        13, 126, -52, -59, 65, -96, -82, -113, 118, -22, 103, -26, -45, 35, 1, -78,
+        84, -19, 122, -81, 74, -50, -83, 81, -9, -88, -10, -24, -18, 56, 6, 30,
+        77, 93, 29, -98, 25, -66, 38, 55, 42, 55, -95, 119, -114, -30, 18, -114,
+        96, 54, -61, -87, 125, 73, 53, 100, -104, -18, 19, -47, 35, -33, -23, 19,
+        89, 65, 67, -65, 95, 123, 14, -95, -19, 96, 32, -113, 93, 25, 73, 99,
+        27, -93, 53, -10, -69, -48, -114, 29, 42, -40, 63, 86, -91, 106, 112, -116,
+        6, 65, 36, 42, -29, -30, 98, 120, 61, -87, -8, 73, -54, -48, -103, 96,
+        -60, 34, -23, -27, -83, 62, -50, -123, 71, 90, -86, -42, -42, 31, -75, 70,
+        -88, 121, -83, 45, 122, 123, 42, 16, -94, -96, -36, 5, 13, -9, 83, 106,
+        -49, 127, 110, -24, -87, 26, 70, 27, 7, 7, 122, 66, -109, -60, 87, -94,
+        17, 49, -80, 105, 65, 101, -124, 55, 19, 7, -109, -67, -88, 124, 62, -95,
+        109, 6, -101, 19, -63, 65, -47, -72, -30, 108, 94, 124, 0, -122, 91, 4,
+        21, 13, 90, -108, 21, -115, 13, -80, -96, -2, 108, 127, -2, 20, -34, 95,
+        112, 20, -60, 115, -50, -109, 27, -31, 16, 98, 28, 8, 69, 3, 25, 64,
+        55, 80, -70, 10, 36, -122, -97, -90, 87, -30, 23, -22, 62, -93, -55, 7,
+        26, -117, -109, -51, 56, -38, -115, -92, -43, 5, 109, 31, -15, 91, 104, 34,
+        76, 88, 51, 73, -61, -42, 48, -53, 37, 12, 108, 18, 95, -63, -110, -26,
+        -41, 126, -107, 23, -82, 68, 118, -128, -61, -70, 19, 116, -125, 78, -74, 94,
+        -113, -108, 75, -3, -117, -122, 28, 57, -17, 84, 42, 54, -98, -78, 107, 47,
+        106, 96, 39, -9, 122, 48, -119, -86, -26, -44, 50, -14, -84, -117, -105, -59,
+        -121, -84, 124, -118, 46, 91, -115, -40, 122, -35, -80, 23, 29, -98, -57, -95,
+        -33, -5, 37, -44, -6, 25, -112, -108, -88, -123, -52, -85, -126, 62, -77, -96,
+        79, 97, 94, -98, -96, 77, -99, 93, -93, 83, 11, 59, -2, -127, 81, -13,
+        -36, -78, -32, -105, 46, 30, 6, 15, -44, 41, 5, -68, 41, -71, -114, -29,
+        -96, 15, -13, 1, 124, -77, -86, -67, -108, 28, -92, 118, 72, -14, -15, 35,
+        -1, -48, 46, 107, -91, -124, 75, 90, 88, 34, -7, -54, -20, 120, 42, -40,
+        -15, 59, -7, 80, 84, -94, -29, 44, -109, 15, 69, -71, 59, -54, 113, -124,
+        96, -10, 51, -55, -26, -25, 107, -35, -105, 43, -101, -101, 5, -98, 45, -61,
+        123, -81, -109, -61, -65, -45, 14, 42, 32, -32, -9, 41, 125, -49, 58, 125,
+        -93, -26, -103, -98, -67, -101, -108, 61, -4, -100, -110, -121, 31, 116, -8, 53,
+        62, -102, -96, -69, -81, -15, -35, 9, 58, -5, 26, -33, -101, -96, -85, -81,
+        -15, -3, -119, 81, 31, -67, 17, 25, -90, -122, 94, -5, -60, 81, -114, -50,
+        104, -14, 110, 55, -78, -84, 35, -13, 73, 75, 28, -45, -125, 3, 82, -128,
+        52, 75, 70, 35, 7, 91, 0, 115, -98, -29, 77, -99, -27, 120, -91, 42,
+        -100, 98, -84, -18, -87, 27, 44, 47, 61, -59, 80, -81, -113, 7, 89, -9,
+        -18, 67, -40, -30, -3, -11, -104, 61, -82, -60, -46, -37, 74, -117, 49, 20,
+        -17, -112, -101, -11, -88, 97, 3, 101, -14, -78, -74, -116, -54, 27, -121, 21,
+        -115, -111, -92, 83, -108, -41, -25, -89, 0, -31, -29, 71, -65, 23, -58, -116,
+        -12, 105, 12, 127, 57, 36, -85, 38, -101, 10, 61, -41, 115, -24, -114, 103,
+        -114, -123, -81, -91, 49, 102, 99, 36, 30, 83, 101, 105, -34, 99, 4, 0,
+        -16, 68, 54, 92, -1, -86, -92, 115, -23, 122, 116, 66, -23, -127, 59, 19,
+        -110, 35, 127, -18, -51, 22, 95, 101, 30, -3, 122, -36, -98, 107, -27, -69,
+        99, 11, -43, 104, -70, -4, 48, 29, -115, -8, -68, 24, -74, -39, -5, 15,
+        73, 84, 42, -107, -54, 54, -73, -89, 85, -56, 54, 19, -65, -51, 23, -28,
+        -85, -7, -78, -14, -104, 99, 62, -1, -27, -72, 47, -93, -61, -93, 59, -103,
+        -2, 102, 90, 121, 117, 123, -72, 43, 9, -41, 53, 63, -83, 47, -30, -101,
+        -35, 72, -87, -109, -94, 78, -25, -118, -122, -118, -23, 77, -28, -55, 22, 91,
+        93, -88, -58, 15, 27, -110, -8, -110, -62, 122, 96, -89, 55, -85, 48, 53,
+        -100, -115, -15, 27, 69, -122, 35, 6, 62, -39, 18, -112, 27, -82, 26, 102,
+        51, 63, 81, -38, -74, -20, 113, 6, 124, 119, -82, -61, 81, 101, -113, -14,
+        81, 38, -91, 46, -94, 53, 97, 34, -120, -122, -23, 62, -93, -27, 54, 10,
+        77, -38, -99, 43, -38, -20, 113, 119, 32, 14, -98, 4, -116, 114, -97, 41,
+        58, 102, 26, 72, 122, -33, 49, -38, -42, 67, 16, -3, 52, 107, -69, 93,
+        54, -97, 107, 69, 25, -24, 115, 60, 22, 118, -10, 34, -55, 29, 68, -37,
+        -21, -128, 53, -33, 42, 34, -44, -26, -83, 98, -9, -20, 11, -104, -27, -37,
+        96, -51, 112, -25, 109, 65, 23, -51, -63, -41, -109, 47, 105, 106, 111, 15,
+        -114, 76, -20, -73, 56, -40, 22, 53, 108, 41, 67, -27, -17, -72, -106, 50,
+        41, -31, -64, -13, 95, -74, 31, 19, 38, 91, 49, -118, -92, 58, 87, 61,
+        65, -88, 38, 13, 42, 127, 60, -47, 98, 85, -74, -123, 35, -79, -126, 126,
+        -11, -113, 60, -9, 78, -93, 16, -7, 117, -48, 5, -9, -115, -126, 89, -19,
+        20, -85, -7, -20, 100, -111, -35, 112, -35, 102, 98, 108, 67, 48, -81, -42,
+        91, -99, 4, -5, 4, 120, -81, 83, -89, 12, -76, 101, -97, 77, 78, 107,
+        57, 82, 26, 127, 72, 7, 92, -62, 61, -65, 118, 72, -26, -11, -64, -49,
+        -21, 75, 94, -8, -121, -54, 34, -70, 102, -69, 103, -56, -35, -78, 14, 102,
+        -119, -10, 69, -32, 86, 90, -41, -95, 117, -22, 27, -11, -74, -50, 62, 108,
+        -69, -115, 43, 96, -28, 67, 39, 96, 30, -100, 9, 109, -28, 55, -25, 85,
+        58, 96, -119, -42, -19, -26, 40, -51, 100, -64, -53, 4, -74, -23, 95, -57,
+        -14, -121, 99, 106, -104, 27, 14, -106, 12, -41, 56, 18, 80, -104, -58, -24,
+        59, 73, 123, -57, 25, 108, -15, -45, 3, -43, 10, 84, -4, -126, 17, -113,
+        -36, -124, 36, -77, 101, -95, -48, -80, -123, -52, 90, 29, 1, -79, -72, -122,
+        33, 17, -19, 105, -46, 126, 117, -93, 60, 16, -128, 53, 18, -128, 53, 16,
+        -128, -26, 83, -81, -22, -118, 30, 127, 109, -8, 101, 101, 109, 11, 42, -45,
+        -6, 0, -50, -39, -22, 5, 92, 117, 73, 92, -18, 24, -43, -42, 23, 54,
+        -34, 49, 82, -12, 73, -75, -40, -13, -102, -10, -83, -121, 110, -83, 97, -81,
+        74, 86, 82, 73, 34, 72, 68, -95, -24, 107, -12, -6, -77, 102, 119, -4,
+        13, -82, 32, -89, -67, 83, -63, 4, 76, -51, 94, 53, -62, 87, -29, -47,
+        52, -33, 17, 66, 124, -42, -117, 48, -36, 111, -71, 122, 67, -75, 11, -116,
+        48, -121, 98, -49, -83, 79, 7, -10, 118, -107, 62, 62, -72, 15, 126, -113,
+        49, -100, 39, -75, 56, -40, -65, -116, 16, 16, -68, 79, -126, -12, 116, 58,
+        -53, -50, 2, -7, 78, 20, -48, -24, 61, -89, -65, 54, 45, 117, 121, 82,
+        47, -99, 49, -25, 9, -116, -21, -26, 116, 121, 122, 58, -49, -86, -31, -2,
+        -64, -78, -31, 29, -60, -62, -76, -105, 89, -104, -11, -120, 89, 86, 41, -97,
+        100, 3, -32, -64, 104, 35, 48, -90, 27, 35, -37, -104, -122, -62, -48, 92,
+        79, -76, 3, -65, 116, 51, 42, 124, 32, 108, -107, -11, -24, 82, 99, -100,
+        68, 88, 42, -21, -108, -40, 50, 61, 78, 46, -39, 78, -35, 78, -76, -58,
+        -84, 122, -77, -10, 61, -55, -63, 28, -26, 11, -32, -82, -8, 111, 47, -67,
+        -100, 29, -13, 79, -97, 115, -109, -17, -21, -16, 117, 29, -65, -82, 85, 76,
+        0, 92, 88, -45, -59, 109, 24, 44, 23, 92, 125, 102, 112, 105, -41, 87,
+        69, 89, 87, -57, 70, -34, 48, 15, 69, 106, 20, 1, -50, -42, 25, 106,
+        -39, 46, -117, -39, 114, -98, 29, -13, -97, -98, 40, -100, 24, 77, 31, 55,
+        59, -29, -37, 70, -33, -45, 6, 50, 58, 60, 124, 77, 60, 116, -46, -84,
+        30, -1, -57, -31, -99, -3, -67, -22, -3, -71, 120, 39, -21, -3, -85, -38,
+        -21, -18, -67, 63, -22, -11, 123, 71, -16, -29, -88, 63, 120, -48, -19, 31,
+        117, -113, -18, -3, -57, -34, -34, -99, -67, -117, -70, -66, -86, -122, -121, -121,
+        -25, 121, 125, -79, 60, -19, 77, -117, -53, -61, 15, -59, -78, 62, -76, -22,
+        83, -55, -89, -59, -43, -86, 68, 89, -60, 94, 56, -115, 8, -52, -34, 63,
+        -96, -28, -34, -13, 28, -49, 109, 53, -38, 123, 9, 4, -17, -94, -54, 102,
+        123, -81, 94, -100, -20, -35, 57, -4, 15, 99, -30, -95, -89, -67, -25, 4,
+        45, -63, -97, -82, 84, -106, 27, -46, 50, 89, 44, 35, -114, -106, 36, -1,
+        -85, 98, 89, 78, -95, -24, 27, -6, -5, 93, -103, 94, 93, -28, -45, 32,
+        -26, -28, 39, -13, -85, -117, 84, -26, -47, 71, 16, -97, -90, -45, 119, 104,
+        -82, 13, -107, -125, 111, -44, -17, 23, -84, -113, -94, 51, 69, -43, 111, -20,
+        -124, -128, 69, 107, 1, -12, 121, -2, 83, 10, 92, 14, -76, -60, -110, -68,
+        -32, 13, -3, 21, -119, -23, 18, -16, 89, 86, -65, 88, 12, -9, -5, -69,
+        -6, -76, -38, -105, 79, 20, -7, 34, -112, -58, -78, 10, 14, 7, -90, 18,
+        -71, 66, 114, 73, -93, 34, -13, 108, 86, 19, -49, -86, -27, -68, 70, 79,
+        -106, 78, 74, 92, -109, -61, 44, 56, -121, -117, -39, 78, -118, 15, 56, -51,
+        -33, 96, -23, 103, 103, 103, -116, -94, 50, -118, 73, -54, 54, 89, -81, 92,
+        -2, -68, 77, -119, 30, -63, 60, -43, 53, 52, 48, 6, -75, 120, 95, -52,
+        -33, 103, -81, 54, 115, -5, 54, 44, -77, -118, 4, -57, -64, 46, -81, -118,
+        -123, 50, -125, -52, -54, 29, -31, 57, -75, 26, 32, -85, -68, -50, 118, -98,
+        -79, -89, -78, -122, 59, 107, 24, -63, 114, -74, -29, 124, 61, -57, -78, -10,
+        76, 9, -29, -72, -35, -22, -1, 72, -123, 109, 0, -82, -58, 75, 123, 109,
+        58, 5, -26, 44, 92, 102, -27, -71, -25, 73, 110, -52, -105, -123, -53, 91,
+        40, 82, 78, -48, -98, -102, -38, 112, -8, 104, -39, 104, -120, -115, -66, -62,
+        54, -72, 81, -14, -19, 35, -24, 69, 39, 11, 54, 49, 118, -24, 60, 93,
+        86, 85, -98, 46, -66, -103, 47, -53, 29, -89, -28, 59, -93, -118, 61, 49,
+        -12, -128, 3, 27, -12, 124, -75, 35, -88, 87, -86, -126, 13, 104, -106, -97,
+        -99, 45, -85, -20, 37, 98, 65, 91, -127, 98, -13, -106, -7, -42, -82, -25,
+        110, 28, -12, -52, -127, 98, 113, -100, -61, 87, -23, 85, 35, 92, -110, 33,
+        -124, -9, -128, -74, -22, -102, -96, -87, 34, -86, -118, 92, 101, -45, -27, 60,
+        45, 91, -70, 109, -124, 99, 106, 64, 127, -29, 84, -75, -63, 83, -84, -126,
+        124, -98, 109, 123, 25, 65, 72, 39, 80, -114, 107, 99, -91, 101, 121, 10,
+        -9, 97, 51, -8, -37, -26, -79, -98, -88, 106, -66, 97, 110, -120, 57, 96,
+        90, 78, 10, -20, 58, 11, 68, -60, 0, 32, 107, 17, -74, 32, -23, 104,
+        74, -55, 32, -112, -17, -92, 54, 9, -112, 117, -106, -87, -92, -30, 23, 55,
+        25, 90, 102, 120, 1, 100, -98, 54, -11, -69, -109, -81, 97, -113, 77, -93,
+        -16, -69, -55, 66, 55, 7, -104, -28, -106, -24, 84, -48, -65, -4, 50, -75,
+        21, 54, 103, -61, 37, 109, 25, -15, 26, 32, -91, 78, 42, -5, -67, 83,
+        125, -120, 117, -94, -116, 13, 39, 32, 113, -94, -116, 10, 108, -106, -80, -100,
+        -111, -45, -27, 104, -42, -77, 116, 10, 37, 121, -32, 43, 33, 63, -41, -15,
+        114, -79, -29, -24, 14, 14, 56, -60, -80, -37, 85, 21, 126, -63, 100, -87,
+        100, -82, -81, 63, -20, -124, 90, -52, 63, 111, 73, 31, 121, -77, -45, -77,
+        -91, -15, 10, 105, 46, -95, 36, 127, -4, 122, 40, -106, 82, 72, -101, -1,
+        13, -63, 127, -4, 117, -52, 100, 66, 18, -4, -43, 58, 8, 64, -124, 116,
+        -2, 26, 76, -2, 26, 9, -111, -103, -91, 51, -124, -71, 67, -5, -101, 109,
+        -39, 8, -44, -114, -86, -126, -110, 96, 25, 54, -45, 88, 105, 112, -117, -79,
+        49, -105, 21, 14, 22, 53, 105, -8, 101, 39, -36, 33, 55, -1, -1, -7,
+        14, -11, 59, 118, -99, -36, 52, -119, -54, -35, -100, -65, 80, 61, 109, -128,
+        -79, 51, 105, -39, 2, -50, -88, -51, 102, 87, 34, -104, -11, 45, 8, -51,
+        86, -56, 102, 117, 124, 120, 49, 65, -17, 76, 118, -74, 66, 119, 32, 120,
+        26, 104, 16, -95, -73, 0, -115, 117, -51, 89, -34, 74, -118, -74, 0, -93,
+        122, 108, -121, -68, 3, 61, -38, 2, -124, 43, -70, -21, -77, -123, 58, 109,
+        -127, -59, -31, 45, 106, 31, -119, -70, 75, 117, -86, 100, -39, -70, -119, 28,
+        54, 73, 84, 81, -124, 45, -25, -32, -69, -46, -98, 45, 109, -102, -43, -35,
+        73, -40, -115, 18, 109, 27, -116, -86, -20, -126, -67, 21, 93, -38, 2, -35,
+        -127, 33, -86, 90, -115, 108, -90, 82, 119, 109, -58, -126, 98, -8, 119, 0,
+        8, -73, -89, 85, -37, 112, -80, 3, 70, -43, 54, -58, -77, -111, 114, 109,
+        -127, -117, 117, 66, 11, -56, 45, 40, -39, 54, -104, 10, -124, 81, 83, 55,
+        -79, 30, -71, -44, -99, -28, -109, 92, -78, -49, -68, 22, 101, 54, -23, 85,
+        -3, 31, 37, 77, -102, -73, -105, -68, 70, 50, -33, 53, -126, -37, -45, -16,
+        -109, 3, -64, 106, 104, -19, 104, -104, -63, 89, -103, 101, -61, -4, -29, -57,
+        96, -127, 33, 0, -26, -24, 36, 99, -61, -19, -95, -93, 97, -44, 20, 87,
+        -90, 82, 1, 36, 4, 100, -92, -59, 1, 54, -67, -21, 85, 67, -83, -56,
+        113, -116, 55, 40, 107, 36, 108, -72, 66, -22, -92, 82, 116, 46, -61, 43,
+        -54, 25, 92, 4, 70, -84, 61, 41, -62, -35, 11, -92, -94, 127, 20, -65,
+        -53, -54, 69, 54, 23, -16, -22, -11, 70, 121, -125, 127, 22, -118, -85, -84,
+        76, 97, 57, -122, -7, -70, 5, -81, -101, -124, 41, 102, 43, -97, 54, -46,
+        -110, 55, -77, -36, -40, 112, 25, -91, -25, -48, -118, -23, -115, -18, -52, 80,
+        107, 99, 38, -44, 54, -102, 120, -68, 97, -3, -61, -100, -121, 52, -8, -39,
+        -123, -69, -11, -113, -67, -126, 45, 8, 91, 32, -66, 126, 122, -111, 46, 96,
+        30, -91, -84, 126, -104, -58, 43, 55, -87, 90, 111, -58, -36, -62, -88, -103,
+        117, -74, -10, -109, -52, -114, -23, 52, -5, 54, 123, -97, 83, -104, -119, 32,
+        118, -44, -1, -9, 27, -15, 58, -28, -95, 30, 57, 15, 103, 98, -43, -29,
+        20, 95, 99, -27, 115, 89, -22, 81, 49, 72, -123, -121, 83, -40, 41, 107,
+        17, 14, 68, 91, 103, -5, 67, 86, 88, -60, -100, -35, -33, -96, -65, -41,
+        15, 54, -35, 45, -26, -90, -107, -69, 9, -51, -59, 102, -7, -78, -30, 53,
+        117, 81, -31, 86, -68, 102, -128, 92, 44, 47, 127, -100, -42, -23, 123, 56,
+        84, -80, 98, 89, 54, -125, 5, -85, -22, -68, -98, 94, 32, -53, 95, -63,
+        90, -99, -90, 85, -10, -68, -52, -2, -67, 4, 112, 43, 104, -103, 78, 34,
+        -82, 23, 108, -90, -28, -58, 47, 122, -78, -30, 94, -116, -5, 19, -121, 29,
+        125, -109, 89, -20, -8, -56, 44, -22, -102, 73, -120, 29, -22, 114, -76, 36,
+        115, 66, -123, -77, -29, -116, -72, 121, 86, -126, 15, 125, 69, 25, 127, 54,
+        -67, -76, -69, 72, 55, 66, 103, -57, -106, 28, 73, -74, 33, 94, -122, -15,
+        -75, -109, -34, 25, 107, 39, -30, -98, -11, 94, 121, 108, 126, 105, 39, 88,
+        35, -83, 11, -42, 31, -27, -113, -108, 94, 11, 89, 18, -39, -22, 117, -10,
+        -8, -108, -64, -126, -116, -116, -122, 77, 105, -105, -18, 37, 22, 96, -25, 2,
+        -101, 40, 94, -87, 13, 92, -98, -97, 38, 74, 82, -108, -43, -15, 24, -99,
+        -68, -96, -117, -42, -32, 20, -2, 75, 13, 13, 59, 119, 49, -16, -83, 84,
+        -56, 5, -57, -63, 115, -56, 12, 58, -75, -83, -62, 57, -119, 80, 72, 3,
+        61, 64, 44, 37, -115, -117, -50, 79, -107, -92, 0, -93, 45, 108, -16, -100,
+        -119, -17, -47, -4, -44, -58, 126, -60, 121, -2, 1, 39, 58, -54, 10, 0,
+        18, -82, 11, -77, -29, -98, 78, -117, 51, -124, 47, -39, -84, -98, -121, -43,
+        28, -56, 82, 102, 64, 89, 49, 63, 50, -21, 10, 120, -6, -73, -109, 105,
+        -58, -87, -86, -106, -27, 25, -32, -52, 55, -124, 1, 107, 89, -13, 105, 65,
+        107, -116, -2, -92, -8, 102, 65, 119, 82, -84, 126, -59, -9, -61, 14, -28,
+        -45, 109, 26, -111, -32, -98, 93, -13, 110, -128, -93, -35, 104, 55, -91, -125,
+        -100, 38, 55, -128, -25, -79, -38, 75, -57, 2, -36, -63, 64, -23, -17, -7,
+        -27, -110, 92, 99, -63, -124, -67, 23, 1, 104, -41, 82, -23, -84, 89, -39,
+        -103, 23, -95, 63, 24, -1, 46, -57, 91, 120, -21, 32, -106, 66, 95, -14,
+        -2, -102, -36, 86, -11, -92, -2, 5, -80, -109, -4, -3, 118, 88, -87, -33,
+        -1, 28, -106, 107, -55, 114, -112, -1, -45, 45, 4, -114, 86, -101, -82, 12,
+        -58, -58, -67, 56, -56, 7, -102, 60, 47, -22, 54, -119, 107, -13, 77, 92,
+        41, 72, -1, -25, -81, 85, -25, 48, -58, 23, 115, -107, 4, 41, 127, 110,
+        38, 29, -98, -57, 116, -111, -88, 46, -108, 74, 124, 111, 98, 116, 75, -124,
+        -17, -45, 65, -47, -111, -99, 26, -54, 6, -28, 56, 61, -39, 88, 34, 110,
+        92, 99, 87, -98, 123, 44, 110, -42, -116, 7, -88, 93, -86, 46, 58, -123,
+        -29, -84, -121, 6, 60, 62, -75, -11, -52, -128, 110, -39, -13, -40, 42, -80,
+        110, 71, 63, -74, 62, 76, 27, -58, -79, 20, 27, -86, 15, 120, -123, 89,
+        65, -28, 96, 88, -4, -58, 22, -35, 76, -95, 70, 80, -29, -109, 119, 96,
+        94, -52, -108, 66, 113, 50, -47, -39, -80, -31, -46, 48, 26, -99, 2, -63,
+        -3, 110, 68, -11, 80, -51, 63, 45, -83, -118, -43, -68, 64, -32, 86, -107,
+        -40, -38, 104, 117, 86, 78, -77, -85, -38, 44, 115, 100, -125, 61, 79, 47,
+        47, 83, 11, 106, 122, -119, 20, -23, 114, -74, 9, 114, 38, -114, -74, 3,
+        56, -10, 56, 62, -76, 10, -84, 73, -63, -87, 12, 51, 87, -121, 95, 107,
+        -122, -5, 85, -13, 51, -91, -102, -113, -116, -51, 56, -17, 4, 124, 121, 6,
+        -109, 79, 102, 80, -120, -36, -108, 70, 31, 103, 89, -48, -55, -91, 55, 107,
+        25, 10, -52, -48, 10, 53, 69, 92, -115, 7, -127, 31, -105, 117, -32, -78,
+        59, -52, 79, 73, 110, 7, -122, -51, 3, -49, -1, -69, 15, -36, 98, 39,
+        27, -61, 79, 63, 119, -8, -1, 103, 70, 109, 15, -55, -32, -122, -35, 17,
+        57, -68, -76, -7, 34, -39, 34, 12, -82, -9, 54, 83, 92, -4, -32, -33,
+        -105, -108, 59, 124, 121, 8, -82, 8, 10, -56, 8, 42, -51, 55, 33, -21,
+        -95, 57, 118, -98, -21, -29, -42, -25, 63, -20, -15, -47, 31, 38, -65, 62,
+        -38, 44, -64, 62, 114, 37, -40, 71, -46, -85, 29, -10, -105, -97, 78, -110,
+        -101, 42, -69, 2, -2, 5, 61, 102, -113, 123, 119, -17, -35, -115, 123, 15,
+        30, 124, 29, -9, 6, -125, -81, -55, -47, 84, -17, -24, 30, 124, 61, 56,
+        122, 0, 73, 119, 57, 101, -16, -16, 40, -18, -35, -67, 123, 15, 11, 13,
+        -30, -66, -6, 31, -4, -98, -84, -41, -68, 57, -104, -87, -113, 98, 83, -73,
+        81, -34, -118, 40, -113, 4, -110, 32, 46, -30, 69, 60, -113, 47, -76, -42,
+        -29, 52, -111, -58, 66, 21, -122, 66, 1, -90, 125, -106, 20, 34, 5, -118,
+        82, -54, 57, 48, 120, -53, -28, 6, 86, -125, 92, 97, 77, 98, 10, -64,
+        -61, -65, -127, 114, 105, -53, 25, -115, -120, 86, -98, -114, -49, 39, -119, -72,
+        10, -105, 49, 126, 65, 27, 70, -38, 21, 125, 69, -108, 3, 20, -1, 126,
+        50, -29, 31, 31, 63, 6, -81, -32, -126, -98, -86, -81, 39, -6, 11, 110,
+        100, -6, 117, 79, 22, -65, 7, 5, 40, -27, -66, 76, -71, 15, -100, 68,
+        -40, 114, 45, -13, 89, -103, -58, -29, -13, 120, -96, -123, -96, 86, 23, -31,
+        76, 108, -84, 60, -13, 86, 22, 99, 65, -122, -107, -57, -99, 123, -58, -99,
+        -37, 101, -29, 78, -25, 28, 6, 38, 72, -126, -125, 3, -8, -104, 73, 9,
+        10, -33, 111, 86, -10, -108, 57, -22, 113, -16, 52, -120, -105, 61, -104, 121,
+        -76, 98, -30, 31, -125, -55, 46, 41, 19, 92, 80, -43, -60, -63, -63, -52,
+        0, 120, 37, 11, 95, -55, -22, 59, -92, 76, -108, -47, 22, -81, -2, 52,
+        -58, 0, -28, -61, -103, 97, 56, -107, -103, 52, 5, 50, 121, 76, 66, -4,
+        30, 12, -23, -17, 63, 3, 50, -58, 74, -126, -105, 112, 88, 0, -94, -48,
+        -62, 69, 104, -40, 16, -102, 102, -103, 73, -125, -119, 121, -15, 127, 111, 85,
+        -106, 37, -71, 107, 102, -71, -65, 55, -54, -31, 104, 116, 115, 60, 42, -77,
+        -58, -119, -84, -15, 55, -84, 113, 87, -43, -72, -121, -65, -114, -52, -70, 101,
+        118, -122, 88, 3, -122, -54, 37, -114, -102, -23, 54, -24, 55, 18, -12, 83,
+        4, -3, 0, 1, -34, -61, -118, -9, -15, -41, 93, -69, 17, -35, -16, 81,
+        75, 115, 3, 95, 115, 74, 23, 87, 47, 67, 110, -38, 0, 10, -2, -39,
+        -110, -47, 22, 85, 50, 6, 110, -83, 75, -19, 102, 64, -40, 78, 98, -116,
+        83, 20, -68, 121, -6, -73, -109, 64, 91, 41, -32, 10, 74, 39, 16, -70,
+        -51, 100, 44, 28, 67, -14, 76, 118, 17, 2, 12, -54, 72, 28, 112, -30,
+        93, -36, -125, 70, -73, 82, -35, 45, 84, 43, 110, -18, -109, 87, -63, -48,
+        -19, -90, -34, 14, -40, 99, 49, 59, -109, 56, -29, -23, 125, 25, 12, -43,
+        92, -54, -55, 19, -109, -20, 46, -99, -40, -52, -101, 118, -50, -33, 16, 90,
+        -53, 26, 13, -18, -32, -97, -61, -69, 29, 24, 38, -128, 56, -68, -53, 11,
+        -122, -55, 119, 101, -14, -128, -109, -113, 40, 89, 55, 97, 87, 26, 88, -71,
+        125, -77, -82, -39, -105, 39, -63, 48, 75, 60, -92, 7, -77, 124, 18, -65,
+        -57, 112, 6, -29, -13, 120, 25, 95, -59, 103, -15, 117, 124, 26, -65, -113,
+        47, -29, 85, -4, 33, 126, 23, 63, -119, -33, -60, 79, -29, -105, -15, 79,
+        -15, -117, 68, 89, 10, 82, 112, -47, -8, -60, 76, 64, 42, -8, 85, -110,
+        -63, 40, -2, 114, -9, 65, 63, -2, 29, 126, -62, -24, 127, -127, 63, -9,
+        39, -15, 51, -8, -13, 96, 18, -65, -123, 63, 15, 39, -15, 115, -59, -42,
+        -111, 73, 20, 94, -21, -81, -99, -92, 103, -15, -37, 40, -2, 30, 37, -125,
+        -84, 2, -98, -68, -8, -8, 17, -1, -100, 124, -4, -8, -68, 119, 13, 63,
+        94, -9, -82, 15, 14, -98, -9, 86, -12, 115, 37, -124, -116, 99, 66, 74,
+        80, 0, -2, 91, -59, 80, 4, -2, 83, 127, 39, 0, -53, 105, 37, -124,
+        -94, 93, -56, -114, 14, -113, 98, -8, -67, -22, 34, -88, -61, 35, 51, -60,
+        -78, -90, 66, 56, -4, 115, 15, -48, 59, 82, 82, -81, 0, 17, -121, 41,
+        -32, -26, -21, 59, -16, -33, 97, -8, -30, -50, -117, -88, -109, -9, 86, -16,
+        -75, 58, 12, 79, -18, -100, 68, 17, 6, 68, -122, -12, 36, 77, -76, -40,
+        59, -123, 89, -125, -108, 104, 84, 37, -19, -112, 123, 36, -55, 13, 7, -121,
+        47, -30, -63, -31, -119, -54, -24, -66, -118, 96, -22, -98, 27, -99, -85, 112,
+        -30, 94, -37, 9, 101, 50, -122, 17, 117, -97, -13, -96, -31, -17, 10, 99,
+        -120, -107, -80, 67, -18, -32, 63, -99, 18, -106, -18, 78, 73, 126, -29, -115,
+        126, 45, -96, 34, 110, -94, -92, -120, 49, 15, -1, -50, -109, -59, -93, 123,
+        -57, -70, -56, -96, -69, 56, -68, 23, 13, 113, 105, -109, -28, 23, 24, -38,
+        -4, 78, -46, 5, -14, -12, -62, -99, 84, 104, -66, -13, -100, 38, -75, 51,
+        -65, -45, -91, -90, 32, 109, 5, 105, 43, 78, -61, -106, -32, -2, 118, -22,
+        -31, 90, 92, -16, -46, -63, -33, 21, 18, 22, 118, -127, -41, -94, -64, 107,
+        89, -32, 92, -20, -65, 105, 81, -123, 83, 88, 4, -35, 87, -8, -70, 3,
+        -1, 117, -90, -80, 32, -16, 31, -84, 21, -4, -5, -88, 15, -99, 62, -25,
+        78, 47, -115, -86, 51, -85, 42, 124, -35, -127, -1, 58, 51, -88, 58, -93,
+        -86, 51, 81, 117, -55, 85, 97, -24, -25, -113, -105, -8, -35, 73, -114, -18,
+        80, -59, -97, 94, 68, -93, 125, 76, 127, 68, -23, 93, 51, 29, 9, -89,
+        51, 110, 109, -102, -27, -13, 80, 100, -31, -95, 57, -17, 46, -93, 67, 89,
+        48, 62, 69, -21, -105, -9, -55, 57, 16, 72, 0, -30, 60, 58, -124, -109,
+        -104, -36, -29, -46, 64, 55, -121, 87, 48, -5, 112, -14, -33, 37, -3, -47,
+        -69, 71, -55, -39, -24, 93, -89, 19, -83, 4, 96, 24, -59, -5, 40, -66,
+        20, 11, -102, 47, -16, -21, -125, 51, 125, 48, 117, -99, 85, 12, 19, -41,
+        -71, -124, -58, -58, -17, 38, -55, -40, 46, -16, 1, 10, 92, -33, -71, -116,
+        63, -64, -4, 94, -33, -127, -7, -3, 16, 55, 10, 116, 69, -127, 14, 22,
+        -128, -18, 118, -110, 43, 26, -31, 41, 44, 41, -34, 79, -12, 23, -55, 28,
+        12, -48, 18, 98, 59, -89, 90, -22, -127, 24, -51, 78, 48, 74, -18, 112,
+        32, 94, -60, -10, 97, -128, -87, -120, -97, 36, 18, 30, -52, -54, 19, -102,
+        20, 28, 27, -9, -123, -2, -38, -57, -125, 18, 7, 34, 115, -32, -53, 60,
+        18, -103, 71, 118, 38, 13, -13, 93, 50, -16, -75, -8, 38, 9, 63, 96,
+        37, 30, 35, -6, -117, 124, -102, -64, 36, -59, 47, 69, 58, 118, 3, 83,
+        127, -94, -44, 103, 42, 117, 64, -87, 111, 41, -11, 123, -125, -84, -110, 24,
+        23, -80, -96, 126, 6, -7, 126, 29, 74, 116, 79, 98, 21, -118, 99, -81,
+        46, 109, 69, 28, 24, -9, -14, 125, -66, -58, 38, -79, -17, -30, -123, -36,
+        46, 93, 75, -8, -5, 1, -2, -66, -121, -9, -31, -38, -108, -51, 9, 91,
+        33, 114, -111, 34, 77, 76, -10, 7, -122, 100, 61, -117, 83, 77, 25, -28,
+        -113, 82, 114, 61, -122, 22, 25, 72, -119, -93, 120, 28, 7, 46, 29, 34,
+        40, -121, 43, -21, -58, 75, -84, 116, 18, -62, -50, 67, 44, 23, -121, 78,
+        -92, 94, 122, -112, -60, 86, 5, 19, 86, 97, -68, 14, 64, 122, 125, 64,
+        103, 125, 64, 116, -5, 24, -68, 18, -6, -72, 15, 100, 72, 2, 12, 10,
+        -3, 45, 70, 124, -21, 93, -116, 22, 73, 21, -26, 49, 103, 30, 28, -108,
+        -99, 65, 4, -59, 43, 96, -49, -71, -36, -63, 65, -127, 73, 52, 96, -56,
+        15, 1, 110, -110, -124, 6, -122, 83, -2, 36, -89, 76, 76, 68, -62, -121,
+        65, 36, 60, 19, -48, 45, 117, -63, -34, 9, -114, 115, 94, -46, 28, 39,
+        -95, 59, 24, -26, 114, -123, 95, 5, 49, 30, 70, 81, 12, -18, 30, 60,
+        -108, 23, -46, -73, -63, 17, 22, 22, 125, -128, 14, -123, -59, -122, 62, 32,
+        -31, -68, -79, 11, -30, 61, 45, 21, 93, 72, 111, -45, -123, -111, -32, -9,
+        96, -62, 74, 32, 19, 82, 32, 22, -26, -47, 8, 35, 76, 50, -69, -41,
+        -113, -53, 72, -14, 51, 98, 58, -72, -41, -117, -29, -15, 100, 40, 75, 45,
+        80, 96, -103, -92, -86, 78, 97, -44, -63, -18, 115, -107, 57, 86, -111, -123,
+        -26, 40, 50, 73, 104, 69, 22, -72, 72, 2, -72, 124, 48, 44, 56, 107,
+        -114, -117, -59, 48, -92, -103, -83, 73, -12, -47, 70, 73, 114, -95, 107, 9,
+        -123, -14, 5, -119, -49, -101, -13, -40, 40, 34, -22, -90, 82, -46, -80, 14,
+        13, 43, -111, 89, -103, -98, -97, -93, -32, 82, 25, -118, 28, 73, 67, -111,
+        -81, -69, -3, 65, -73, -1, 85, -101, -95, 8, -44, -98, 21, -11, -65, -86,
+        67, 23, -116, -33, 94, -28, -21, -35, -19, 69, 76, -74, 61, -70, -87, -75,
+        -75, 94, -16, -101, 106, 39, 48, 34, -106, -12, -78, 121, 82, -81, 13, -13,
+        34, 50, 89, -14, -111, -119, -4, 94, 104, 8, -105, -48, -112, 67, 122, 24,
+        -29, 105, -54, 36, 72, -12, -106, -87, 35, -11, -46, 8, 29, -89, -103, 57,
+        47, -92, 25, -41, 88, 84, -45, 113, 122, -73, -42, 91, -57, 102, -57, 21,
+        -118, -90, 43, -54, 59, 4, -114, -3, -4, 1, -72, -111, -30, 67, -113, -94,
+        44, 70, 40, 118, 91, -100, 103, -77, 19, 10, -4, 91, -111, -62, -79, -107,
+        66, 18, 4, 59, -78, -35, 21, -48, -99, -64, -118, -49, 49, 92, -48, 47,
+        93, 114, 120, 41, -58, 112, 5, 100, -88, -52, 121, 43, -109, 88, -63, 66,
+        -59, 110, 17, -106, -77, 78, -17, -49, -77, -6, 27, 12, -112, -20, 119, 67,
+        4, 115, 99, -5, 0, 22, -87, -82, 36, -115, -43, -107, -23, -43, 65, -42,
+        43, 25, 37, -60, 97, 75, -107, -17, -124, 24, -86, -103, -13, 115, -107, -75,
+        -26, 9, -113, 61, 20, 24, -10, 90, -75, 117, -115, -18, -68, 96, 10, -28,
+        55, 121, 88, -88, -19, -127, 50, -25, -27, -70, 10, -28, -16, -50, 24, 64,
+        -88, 38, -25, -108, 70, -100, 103, 55, -111, -62, 54, -53, -60, -113, 31, 7,
+        24, 123, -86, -9, -31, 34, -97, 94, -96, 97, -49, -23, -78, -82, 97, 123,
+        70, -42, 43, -73, 124, 119, -123, 46, -79, 11, -66, 83, 10, -11, -58, -5,
+        -21, -122, -125, 113, -42, -79, -120, 102, -54, 86, -56, 104, 110, 36, -86, 80,
+        62, -85, 92, -93, 103, -48, -97, 74, 74, -128, -47, -33, -32, -72, -24, -29,
+        91, -50, -94, -31, 99, 120, -92, -97, -54, -30, 42, 61, 79, 121, 33, 99,
+        67, 76, 104, 58, 107, 83, -109, 43, 69, -120, -58, -60, 122, -13, -66, 45,
+        -90, 18, -104, 9, 71, 56, 2, 37, -71, 46, 20, 99, 10, 77, 20, -68,
+        84, 107, 33, 125, 79, -68, -127, -126, -39, -30, -23, -55, 43, 82, -57, -62,
+        -8, -112, -103, 8, -82, -105, -53, -53, 84, -20, 69, -31, -13, -54, -65, 1,
+        -56, -51, -100, -32, -73, -13, 70, 35, 62, 23, 99, -22, -108, -117, 39, 31,
+        -56, -22, 2, -64, -117, -94, 12, 34, -63, -83, 95, -26, -77, 25, -66, 12,
+        -27, -121, -55, -111, -55, -70, 114, -40, -18, 97, -98, -12, -41, -102, 123, -89,
+        113, 86, 40, 66, -52, 23, -75, 19, -113, 84, 112, -109, 113, 14, -108, 92,
+        113, 61, 76, 99, -107, 51, -108, -67, -48, 20, 29, -100, 68, 28, 17, 44,
+        21, 99, 6, 35, 110, -72, 15, 5, 113, -94, -64, 92, 78, 69, 21, 87,
+        -4, -74, 21, 69, 40, 115, 127, 53, -46, 4, 110, 109, 14, 114, -73, 85,
+        -77, 55, 63, 22, 22, -127, -48, -43, -34, -65, 26, -70, 19, -37, -93, 121,
+        -115, -59, -124, 93, 58, -89, 99, -67, -74, 79, 53, -62, 76, 90, 76, 62,
+        -44, 118, -110, 70, -14, -18, 50, 69, 114, -29, -103, -51, -61, -70, 1, 89,
+        2, 28, 117, -41, -33, 51, 32, -105, 43, 127, -83, 21, 114, -33, 109, -75,
+        86, 64, 79, 56, -105, 88, -116, 65, -45, 55, 52, -77, 72, 54, -63, 107,
+        34, 23, -100, 11, -114, 45, 111, 76, 111, -34, 54, -109, -15, 86, 52, -93,
+        -88, 102, 127, -80, 111, 17, -7, 125, -98, 24, 47, 61, 0, -113, -60, 58,
+        -30, -86, 25, 53, 93, -79, -50, -111, 109, 79, 110, -82, -121, -13, 120, 53,
+        -100, 35, -70, 67, -95, 10, -96, -16, 99, -115, -52, -45, 104, -56, -12, 21,
+        74, 88, 116, 50, -4, -89, -118, -81, -114, 53, -82, -81, 84, -15, -107, 46,
+        -66, -126, -30, 43, 86, -34, -47, 118, -62, -78, -25, -48, 7, -42, 42, 43,
+        123, -105, -7, 2, -40, -26, -12, 17, -1, 58, 46, -110, 48, 21, -87, 81,
+        -41, -65, 55, -122, -86, 106, 122, -115, 85, 31, -13, -81, -82, -16, -127, 79,
+        -12, 50, 3, 49, 82, -37, -128, 73, -107, 63, 106, -14, -19, -63, 65, -59,
+        29, 121, 123, -68, 72, -62, 74, -92, -74, -44, 93, -103, 29, -63, -86, -36,
+        -111, -73, 93, -23, -97, 31, 71, 41, -96, -104, -55, 109, -32, 116, 87, -86,
+        69, 122, 117, 82, 124, 87, -26, 120, -93, -89, -35, 36, -3, -117, -103, 22,
+        87, -35, -92, -78, 83, -118, 110, 82, -40, 41, -117, 110, -78, -80, 82, -44,
+        126, 107, -48, 1, 106, 37, 47, -123, 38, -65, -37, 59, 117, 108, 35, -37,
+        49, 85, 1, 59, 104, 65, 49, -97, 21, 114, 37, 123, 32, 50, 47, -109,
+        4, 75, 110, -29, 11, -64, 77, 109, -24, 66, 32, -55, 81, -13, 80, 65,
+        37, -21, 76, 101, -83, 103, -118, -16, -28, -39, 89, 27, 66, 111, 22, 112,
+        16, 119, 11, 4, -119, -96, 91, -22, 43, 76, 44, 110, 20, -113, 101, -39,
+        -115, -94, -62, -99, 40, -27, 30, -49, 5, 72, -15, -120, 35, -77, 111, 56,
+        71, 67, 103, -106, 113, -106, -64, 116, 11, 87, 4, -74, 91, 14, -109, -48,
+        -113, 56, -20, -128, -48, -47, 19, 75, 17, 102, -119, 86, -30, 69, 127, 14,
+        -57, -20, -89, 0, -99, 59, -36, -84, -127, 88, 22, -98, -116, 113, 120, 46,
+        17, 47, 118, 15, 101, -71, -124, -70, -118, -28, 24, -19, -10, -86, 40, 94,
+        -86, -111, 1, -119, 45, 70, -123, -33, 81, -65, -25, 21, -75, -104, 21, 66,
+        -71, -84, -71, -118, -4, -37, 77, 94, -15, 71, 54, 3, -52, -77, -106, -62,
+        -115, -23, -74, 34, -84, -83, -12, 50, -81, -22, -28, 102, 46, -34, 28, 99,
+        124, 124, -108, 78, 38, -15, -13, 84, 127, 6, 124, 96, -125, 73, 60, 63,
+        -59, -46, -6, -37, -87, -29, -85, -30, -121, 99, -127, 49, -69, -11, -76, 40,
+        -54, 89, -30, 42, 114, -15, 66, 75, 87, 121, -5, 102, -88, 11, 116, 74,
+        -93, 14, -39, 113, 122, 120, 52, 76, 27, -16, -86, 86, -122, -50, -104, 11,
+        13, -25, 70, 4, 81, -47, 0, 72, 114, 1, 93, 9, -56, -53, 3, 122,
+        36, 57, -91, 31, 81, -68, -14, 20, 29, 80, -47, 82, 22, -99, 115, 81,
+        32, 25, 118, -26, 51, 13, -122, -121, 55, -36, 21, -106, -86, -48, -61, -117,
+        -79, -25, -95, 16, -17, -107, -4, -9, 76, -5, -19, -25, 17, 41, -47, 84,
+        69, -6, -118, -83, -59, 35, 19, -2, -72, -102, 108, -128, 12, -71, -79, -114,
+        -102, 5, 95, -14, 33, -53, -88, -115, -55, 124, 46, -53, 100, -84, 3, 2,
+        -15, -113, 103, -41, -45, 57, 42, 21, 77, -20, -50, -119, 11, -68, 72, 44,
+        96, 37, 64, -102, -116, 26, -34, 17, 11, -72, 26, 11, 33, -27, 120, -36,
+        63, 46, -124, -14, -4, -31, -81, -43, -99, 24, -2, 59, -52, -93, -31, 120,
+        50, 108, -34, -9, 5, 32, 19, -47, 29, -108, 104, 113, -17, 1, -44, 113,
+        10, -27, -27, -79, 54, -101, 78, -118, -75, -103, 40, -90, 53, 25, -89, -79,
+        39, 121, 2, -57, 110, -74, -100, -102, 78, 67, 44, -21, 28, 105, -15, -22,
+        -13, 18, -109, 25, 62, -52, 30, 119, 7, 107, -61, 95, -70, -37, -74, 39,
+        -47, 87, 80, -52, -13, -105, -22, -44, -93, -66, -39, 39, -109, -113, -45, -20,
+        -103, 84, -87, 101, 7, -68, -58, 111, -63, -56, 9, 78, 13, 61, 101, 92,
+        -39, -123, -27, 117, 107, -117, -68, 37, 21, 39, -82, -38, 57, -59, 74, 5,
+        90, 52, -89, 119, 8, 107, -52, -77, 44, -69, 98, 28, 119, 112, -128, 79,
+        -82, -80, -17, 56, -116, -104, 17, 81, 76, 5, -14, -102, -24, 113, 73, 62,
+        8, 125, 107, 29, 11, -25, 83, 8, -123, 111, 123, 24, -9, -48, 72, 124,
+        -51, 30, 15, 68, -53, -89, 85, 86, -66, 87, 97, -32, -48, 91, -34, 2,
+        -121, -27, 48, -6, 6, -76, -92, -43, 124, -51, -62, -24, 61, -115, -83, -91,
+        100, -55, 41, 80, 97, 112, -23, -80, 37, -57, 98, -118, -47, -110, 78, -38,
+        87, -105, -23, 7, 49, 42, -19, 68, -36, -106, -67, -24, 80, 83, -73, -108,
+        -64, -88, -48, 87, -62, -17, 29, -71, 103, -70, 10, 45, 29, 104, -15, 36,
+        -103, -47, -45, 54, 44, 98, 70, -49, -39, -67, -43, -92, 33, -61, -46, 61,
+        77, -68, 46, 27, 73, 73, 75, -77, 85, 70, 4, 49, 10, 53, 16, -89,
+        102, -8, 15, -106, -63, -45, 32, -86, -92, -39, -97, 61, -107, 4, -123, 66,
+        -14, -127, 100, 75, -58, 108, -39, 6, -54, -80, 29, 97, -57, 48, -17, 49,
+        40, -46, -36, 68, -127, 123, -34, -108, 126, 8, -124, -115, 65, -124, -50, -77,
+        95, 62, 126, -52, 123, -75, 18, -84, 113, 26, -16, 113, -100, -5, -42, -109,
+        -5, 118, 84, 107, 34, -112, -106, 60, -64, 72, -98, 41, 92, 60, 85, -100,
+        3, 9, -56, -28, 32, 42, 53, -81, 97, 32, -110, -69, 83, 19, 73, -79,
+        77, -24, -14, -62, -65, -8, -52, -110, -50, 102, 79, -25, 105, 85, 89, -72,
+        27, 54, 49, 36, -15, -44, -17, 80, -92, 19, -4, -58, 125, -119, 28, -103,
+        101, -128, 38, 104, -106, -12, 19, 83, 70, 45, 27, -106, -108, -37, -54, 104,
+        -35, -78, 9, -38, -81, 71, 11, -33, 97, 56, 23, -87, -6, -112, 11, 73,
+        -118, -120, 118, 107, 41, 63, 32, 92, -114, -118, -54, 126, 114, -87, 32, -59,
+        -29, 109, 20, 123, 45, 125, 119, -116, -60, -27, 55, -12, -13, -98, -71, 98,
+        78, -19, -96, -45, 56, -30, -78, -8, 64, 110, -60, -98, 97, -92, -95, 48,
+        -8, 121, -15, 110, 1, -45, -79, 23, 116, -14, 78, -80, 71, 29, -33, 67,
+        40, -5, -127, 111, -4, 34, -116, 111, -69, -83, -89, 64, -98, 83, 49, -98,
+        -58, -92, -68, -127, -101, 59, -22, 77, -111, -125, 46, -123, 93, -82, -37, -58,
+        107, -57, -5, -103, -65, -123, -110, -90, -62, 11, 63, -66, 117, -77, 28, -11,
+        -6, 39, -101, -116, -11, 35, 28, -25, 120, -73, 110, 33, -57, 104, 71, 26,
+        13, 96, 40, 91, 36, -69, 80, -27, -69, 47, -3, 56, 98, 96, 90, -103,
+        56, -104, -120, -85, 73, 118, -106, 75, -58, 34, -77, 41, 95, -25, -66, -65,
+        -74, -56, 107, 111, -41, 37, -126, -46, 40, 83, -39, -67, -104, -107, -87, -9,
+        -84, 9, 41, 44, 13, -124, -25, 110, 59, 76, -105, 100, -105, -41, 94, -102,
+        64, -23, -94, -7, -14, 108, 68, 76, 70, 28, -116, 12, 107, -109, 54, -122,
+        12, -14, 1, -23, -17, 92, -38, 25, -88, -11, -84, 80, -26, -124, -46, 12,
+        -9, 10, -90, -105, 104, -8, 69, 11, 102, 29, -44, 38, -48, -71, 16, -121,
+        -114, 54, -52, 72, -34, -43, -115, 102, -22, 97, -18, -88, -17, -98, 20, 125,
+        55, -73, 48, -45, 113, -125, -100, -74, 85, -89, -2, -33, -70, 9, 50, 117,
+        19, -44, -6, 14, 48, -16, -65, 127, -101, 53, 105, -118, -58, -92, -73, -84,
+        -107, 77, -69, 25, 4, 69, -37, 62, 22, 21, -102, -39, -54, 77, -117, -119,
+        84, -102, 97, 106, 55, -36, 59, 20, -19, 124, -121, 35, -48, -66, -31, 30,
+        29, 9, -44, -80, -15, -108, -44, 104, -91, -56, -4, 75, 102, -99, 18, 18,
+        -90, 23, -119, 113, 61, -123, 37, -100, -121, 18, -50, -125, -116, 43, -115, -3,
+        -60, 88, 73, -2, 11, 51, -24, -44, -115, -85, 17, 55, 97, -13, 10, -91,
+        84, 88, 109, -1, 60, 22, -6, -4, 53, 11, -8, 35, 61, -87, 121, -11,
+        -10, -115, 80, -99, -36, 59, -34, 35, -19, 48, 122, 98, -26, 14, 14, -10,
+        55, -20, -122, -81, 97, 55, -20, -33, -70, -42, 32, -118, 26, 20, 27, -100,
+        83, -33, -61, -91, 115, 40, -101, 111, 81, -61, -38, 61, -108, 117, -53, -95,
+        68, 27, 92, 113, 40, -21, -26, -95, 76, 69, -18, 91, 79, -82, 121, 40,
+        3, -104, 51, 34, -50, 114, 56, -104, -87, 56, -104, 100, -69, -35, 32, -54,
+        114, 19, -87, -39, -37, 103, 3, -55, -123, -16, 111, 67, 112, -7, -9, 79,
+        -125, -34, 18, -78, -61, -83, -124, -1, 39, 49, 109, 72, -17, -41, -102, 105,
+        107, 67, 77, -30, -12, 122, -18, -40, -48, 43, -5, 106, -85, 106, -109, 22,
+        46, 75, 38, 24, 55, -1, 72, -15, -106, 126, -75, -28, 93, -1, 35, 23,
+        44, -93, 109, 40, 85, -94, -56, -74, -50, 69, 38, -61, 88, -66, 88, 84,
+        98, 86, -51, 20, 22, 82, -70, 77, -37, -89, 88, 46, 82, 104, 92, -66,
+        6, 8, -59, -110, -102, 15, -111, -15, 13, 110, -84, -4, 116, 89, -93, 87,
+        87, 96, -30, -39, 59, 112, 93, -82, 110, -102, 0, 102, 121, 53, 45, 22,
+        11, -60, -53, -74, 31, 43, -77, -44, 122, 74, -98, 119, -31, 64, -78, -41,
+        85, -91, -73, -128, -14, -48, 111, 127, 124, -11, 4, -38, 123, 85, -52, -14,
+        -77, 28, -74, 8, 95, -50, -127, 124, 121, -1, -28, 25, -44, 111, 41, -72,
+        -51, 91, 90, -119, -37, 103, -53, -34, 2, -126, 89, 55, -73, -64, -2, 46,
+        59, -77, 113, -106, -76, 22, -9, 110, 56, 88, 58, 9, -37, -128, -68, 101,
+        -92, 45, 115, -6, 27, -91, -28, -61, -4, -74, -13, -48, 36, -107, 101, -113,
+        -73, 19, -47, 109, 93, -10, -44, -12, -11, -71, 89, 108, -37, 25, -10, 18,
+        14, 102, -74, 67, 61, 120, -4, -83, 45, 68, 12, -91, -42, -105, 7, 37,
+        -48, 116, 94, 30, -124, -9, 61, -9, 113, 78, -124, -51, -30, -105, 6, -75,
+        -121, 91, -124, -12, -10, 67, 67, -60, -17, 9, -42, 43, 67, 76, -81, 11,
+        -74, -55, -106, -24, 90, -125, -96, 53, -123, -82, -30, 125, -65, 26, -114, 3,
+        116, -61, 21, -108, -12, 15, -38, -87, -50, -15, 31, -6, 18, -122, -85, 115,
+        12, -36, 100, 10, 0, -121, -29, 73, -84, -120, -89, 33, 70, -75, 18, -35,
+        -2, -19, 20, 29, -42, -26, -117, -13, -41, 116, 118, -116, 91, -58, 42, 37,
+        -59, -73, -118, -77, 27, 62, -116, 45, -70, 0, -99, -41, 106, -15, 27, -6,
+        -118, 86, 12, -7, 80, -78, -32, 107, -44, 25, 51, 118, 86, -72, -101, -74,
+        86, -103, 97, 12, 62, -33, 35, 8, 63, -104, 8, -62, 52, -67, -124, 13,
+        80, -94, 96, -100, -109, 48, 106, -61, -49, 116, 19, 60, 5, 126, -100, -30,
+        -96, 41, -115, 17, -31, 57, -48, -85, 45, -78, -34, 81, -109, -86, -31, 20,
+        9, -75, 127, -70, -22, -63, 8, 79, -60, 117, 87, -48, 41, 68, 61, -80,
+        -65, 85, 67, 61, 42, -77, 75, -81, -52, -46, 111, -99, -46, -82, -26, 84,
+        46, -50, -119, -85, 60, -11, 27, -20, -9, 50, 69, 97, 99, -107, -37, 124,
+        105, 109, -60, 122, 18, -98, 76, -92, -30, -42, -79, -6, 53, -76, -56, 26,
+        -111, 24, -81, -100, 10, 111, 85, -123, -73, -66, 10, 111, 29, -86, -62, 121,
+        -33, -16, -22, 35, 33, 53, 6, -69, 35, -64, -65, -63, 62, 5, -6, -75,
+        -20, -72, -99, -73, 15, -91, 42, -64, -101, -93, -27, 13, 35, -41, 111, 24,
+        78, 57, -76, -3, 86, 15, 24, -88, -109, -21, 62, 96, 96, 85, -118, 34,
+        101, -34, 56, -13, 90, -64, 105, 40, -104, 112, 114, -24, 82, -90, -82, 70,
+        95, -7, -39, 0, 78, 63, 19, -64, -4, 115, 1, 124, -10, 8, 62, -77,
+        -2, 103, 79, -64, -25, -10, -65, -8, -36, 25, 96, 109, -103, 79, -124, -63,
+        -76, 109, -40, 16, 127, -64, -79, 73, 90, 28, -111, 73, -86, 76, -17, 94,
+        -93, 63, -104, 81, -74, 102, -100, -74, 100, -52, -37, 50, 90, 33, -75, -92,
+        -73, 54, -48, 6, -89, 104, 107, -63, -102, 85, -33, -45, 6, 103, -75, -31,
+        -95, -37, -88, 8, -58, 6, -42, 70, -67, -95, 38, -110, 7, -116, -39, -60,
+        -27, -21, -111, 33, 13, 115, -15, 52, -122, -96, -91, -80, 7, 98, -63, 21,
+        98, 52, 111, 54, -10, 63, 102, -68, 86, 73, 101, 53, 71, -115, 76, 62,
+        -113, -59, -41, 67, 5, -10, 26, -33, -89, -27, -57, -118, 116, 1, 109, -90,
+        78, -35, -25, 62, -67, 64, 37, 4, 88, -57, 28, 123, 94, -58, -121, 21,
+        29, 81, 4, -91, -22, 109, 15, -93, -25, 34, -91, -112, 88, -54, -114, -47,
+        -40, 8, -85, 59, -119, 12, 36, 44, -5, -90, 67, 33, -74, 61, 43, -115,
+        -36, -90, 114, -93, -74, 75, 15, 88, 111, -1, -29, 116, -84, 75, -110, -116,
+        -41, 78, 24, 76, 38, 107, 105, 57, -55, -49, -127, -4, -122, 0, -12, -106,
+        8, 41, -106, -50, -89, -19, 111, 17, 90, -73, -120, 95, 12, -102, 107, 72,
+        122, 77, -60, -16, 119, 81, -113, -32, 113, 95, 91, -50, -101, 37, 88, 10,
+        -42, 69, -3, -127, -57, 125, 86, 11, -74, 102, -35, 40, 78, -67, 116, -114,
+        59, -47, -60, 62, -72, -41, 29, -46, 94, -16, 101, -83, -60, 90, -40, -86,
+        -87, 102, -4, -9, -106, -11, -91, -127, -96, 9, 4, 79, -48, 69, 54, 125,
+        -9, 4, -99, -2, -44, -81, 113, -61, -32, 67, -44, 103, 117, -85, -109, -45,
+        83, 21, 99, -59, -115, -109, 25, 111, -103, 73, 116, -78, 99, 104, -46, -106,
+        -97, -78, -90, -15, -47, -26, 85, -19, -4, -105, -84, 106, -9, -53, -81, 106,
+        103, -53, -86, -94, -114, -37, 14, 11, -5, 25, 107, -38, -7, -108, 53, 61,
+        -3, -108, 53, -19, 127, -10, -102, 118, -2, 91, -84, -23, -89, 47, -24, -25,
+        -82, 101, -57, -77, -106, -13, 79, 90, -53, -63, 103, 99, -35, -50, 127, 11,
+        -84, -69, -29, -7, -36, -44, -77, -49, -60, -71, -66, 53, -3, -62, 40, -9,
+        -45, 16, -22, -24, 51, -47, 22, -73, 26, -34, 18, 51, -3, 113, -120, -23,
+        -113, 31, 120, -60, -19, 109, -23, -119, 51, -30, 47, -116, -118, 63, -19, 112,
+        126, -58, -112, -73, 46, -77, 23, 105, -3, 113, 56, -21, 75, -114, 121, -29,
+        -79, -33, -78, -42, 93, -49, 90, -29, 115, -44, -74, -127, 119, 26, -124, 57,
+        -52, 125, -102, 100, -98, -12, 85, 92, 9, 87, 4, 117, -70, 56, 10, 61,
+        5, -70, -34, -66, 119, -37, 23, -21, -16, 40, -10, -76, -33, -11, 95, -67,
+        -83, 99, 63, 60, 66, -75, 42, -93, 107, -23, -89, 116, 36, -1, -108, 102,
+        -117, -58, -110, 75, -106, -84, 51, -8, -86, 127, 39, 44, -69, -107, -14, -101,
+        -48, -79, 94, 14, 121, -73, 61, 89, -100, -49, -77, -61, 35, -75, 57, -92,
+        -82, -117, -89, -51, -87, -1, 76, 76, 87, -54, -47, 64, -47, 45, -2, -46,
+        -42, 70, 124, 59, -112, -42, 62, 98, 77, -78, 79, 56, 66, 27, -104, 62,
+        -33, 78, 55, -77, -47, 105, -53, 38, 102, 51, 29, 55, -40, 77, -14, -92,
+        -80, -71, 73, 62, 97, -34, -70, -125, -51, 117, 7, 19, 66, 44, -22, -14,
+        -66, -102, 23, -24, 34, 101, -67, -74, -83, 64, 88, -100, 33, -115, -41, 102,
+        82, 79, 93, -61, -68, 70, 119, -37, 110, -30, 74, -65, 69, -73, 27, -20,
+        -75, -120, -90, -124, -24, -55, 39, -102, 106, 51, -58, 107, 66, 34, -37, 63,
+        114, 110, -47, 102, -6, -9, 101, -70, 32, -115, 84, -74, -12, -64, -89, -41,
+        -27, 90, -28, -38, 54, 57, 77, -63, 77, -101, 49, 95, -122, -6, -83, 72,
+        -31, -91, -38, -88, -50, 65, 127, -107, -74, -89, -77, -15, -37, -56, -9, -124,
+        49, 78, -29, 74, -20, 11, 60, 28, 100, 85, 20, 123, 118, 5, 106, -55,
+        -45, -106, 72, 113, 11, 84, -122, -6, -127, 126, -86, -75, 65, 75, -91, 56,
+        -124, -22, -55, 86, 71, -56, 73, -58, -21, -49, -42, 37, -124, 121, 77, -36,
+        -73, 67, -33, 67, 76, -69, 85, -110, -110, -32, -75, -103, 29, -75, 22, 104,
+        108, -32, 13, -74, 73, 13, 25, -94, 121, -88, 112, 20, -127, -85, -62, -83,
+        -16, 77, -46, -12, -121, 76, 90, 42, 82, 27, 90, 73, -76, -46, -29, 42,
+        25, -121, 121, -89, -114, 124, -72, -110, 108, -46, -62, -76, -109, -75, -26, 78,
+        -122, 97, -98, -80, -69, -59, -4, -8, 46, -70, 68, 7, 112, -2, -21, -68,
+        -18, -124, -125, -125, -4, -72, 63, 108, -67, 66, -94, 13, -99, -16, 19, -69,
+        89, 39, 60, 106, -123, 41, -44, -76, -38, -5, 14, 51, 75, -2, -127, -56,
+        -119, 89, -46, 82, 42, -118, 51, 81, 104, -80, -87, 80, -35, -43, 62, -75,
+        -56, -69, -7, -93, -106, -94, -121, 71, -57, -28, -17, -100, 26, 13, -95, 3,
+        -57, -35, -106, -110, -61, -10, 30, 89, -115, 13, -74, 52, 54, -64, -58, -96,
+        -13, 97, -10, 73, -115, 57, -26, -73, 39, 5, 26, 7, -21, 72, 38, -106,
+        -74, -126, 93, -86, 109, 23, -94, -5, 50, 123, 38, 117, 69, 124, 118, -10,
+        -20, -46, 16, -80, 16, 80, 53, 105, 52, 12, -85, -60, -65, -65, -74, -18,
+        46, -87, -41, -44, -40, 69, 59, -20, 33, 45, 3, 46, -124, -19, 107, -43,
+        -87, 31, -55, -33, 97, 45, -110, -127, -66, -79, 74, -110, -87, 43, -108, 124,
+        44, 127, 115, 73, -76, 112, -83, 92, -104, 111, -47, 99, 74, -10, 72, -2,
+        14, 51, -111, -36, 45, 93, -104, 92, -14, -79, -4, -51, 37, -47, 86, -75,
+        -60, 120, 63, 113, 54, 113, 86, -59, 97, -68, -109, 70, 76, 113, 91, -15,
+        -83, 74, -33, 103, 70, 113, 29, 7, 66, -22, -98, -79, -77, -105, -56, 112,
+        -26, -45, -92, 6, -37, 39, 51, -82, -38, -85, 117, -56, 13, -92, 127, -99,
+        4, -33, 90, -77, 7, -76, -22, -80, -108, -37, -92, 120, 4, -5, 3, -55,
+        17, 72, 76, 55, 80, -75, 49, -23, 72, 96, 57, 102, 126, -93, 97, -15,
+        56, -91, 36, 15, -91, -92, 89, -119, -14, 78, 42, 106, -10, -87, 38, 70,
+        90, -113, -13, 118, -59, 13, -58, -49, -61, -90, 5, 71, 67, 41, -61, 86,
+        26, -16, 42, 101, 100, -69, -88, 97, 56, -17, -58, -55, -115, 65, -23, 14,
+        123, -125, -40, 56, -27, -125, 88, 31, -75, -31, -51, 58, 118, -42, 26, -115,
+        46, -41, -111, 25, 18, 39, -108, -101, 15, -8, 57, 65, -49, 60, -71, -54,
+        -82, 97, 62, -116, 47, -116, -101, 78, -69, -29, 59, -53, 25, -69, -95, 47,
+        1, -109, -112, 10, 115, 3, -119, 81, -22, 107, -23, -127, -26, 67, -110, -11,
+        62, 72, 31, 64, -88, -121, 63, -66, 121, -105, -83, -122, 1, -50, -64, 43,
+        -118, 40, 93, 5, 28, -48, -90, -23, 56, -71, -66, -18, 93, 45, 79, 97,
+        67, -66, -54, -22, -117, 2, -97, 79, 2, -90, -112, 126, -28, -35, 28, -60,
+        -30, -5, 77, 86, -26, 8, 39, -32, 16, 10, -33, 2, 111, -92, 62, 84,
+        30, -22, -16, -32, -49, -17, -13, -39, 44, -61, -104, 35, 117, 113, 14, -109,
+        -88, -14, -85, -117, -30, -125, -6, -72, -56, 103, 70, 78, 86, -65, 44, -48,
+        -39, 25, 106, -72, 100, -16, -91, 114, 126, 47, -118, -53, 95, 20, 40, 108,
+        -41, -42, -6, -125, 44, -24, 95, -6, -13, -21, 23, -16, -117, 35, 103, -97,
+        20, 79, -33, -4, 29, 123, 55, -101, -3, -110, 94, -25, -43, -109, -59, 66,
+        -16, 81, -100, -8, -42, -105, -56, -26, 7, 102, 34, 41, 59, -23, -108, -118,
+        -70, -122, -60, -121, 85, -22, 42, -67, 66, -107, -107, 0, -3, 40, -107, -59,
+        42, -104, -88, -11, 97, -54, -107, 12, 111, -57, -62, -27, 75, 108, 42, 110,
+        26, 14, 94, -60, 111, 104, -112, 62, 76, -123, 79, 77, -13, -56, -33, -78,
+        -108, -96, -106, 2, 77, -13, -104, -115, -89, -117, -4, -110, -5, 77, -98, -97,
+        78, 67, -103, 19, 25, 101, -82, 51, -50, -3, -97, -66, -36, 105, 81, 102,
+        -108, -5, -113, 58, -44, 99, -102, -57, -34, -94, -117, -77, -4, -100, 10, 63,
+        11, -27, -119, -93, 28, 92, 27, 6, -30, 107, -30, 28, -119, 45, -52, -3,
+        -105, 63, -105, -62, 119, 115, 23, 47, -37, -70, -8, 115, -99, -49, -71, -56,
+        -54, 91, -92, 44, -86, -22, 34, -51, 75, 46, -13, 55, 95, 25, 90, 40,
+        -50, -1, -89, 55, 95, 4, 100, -57, 2, -33, -7, 10, -52, 113, -17, -26,
+        -65, 107, 71, 91, 127, -10, -107, -110, -70, 45, 88, -32, -91, 78, -122, -3,
+        126, 5, -55, -7, 123, -98, -19, -1, -27, -85, 90, -47, 113, -96, -4, 31,
+        124, -7, -11, 5, 96, 53, -54, -82, 107, 95, 62, -78, 44, 105, 77, 79,
+        -52, 88, -24, -60, 11, 35, -81, -31, -84, 46, 79, -23, 47, 21, -53, -68,
+        -80, -26, 25, -6, 38, -96, 2, 115, 111, -127, -70, 40, -26, -89, 105, 73,
+        37, 46, 90, 75, -44, -7, 21, -17, 76, 111, -119, 89, 14, 88, -70, 82,
+        -45, 85, 120, 11, 49, 106, -6, 62, -101, 95, -55, -127, 125, -29, 45, -121,
+        56, -28, -89, 116, -95, 45, 121, -80, -24, -44, 91, -12, 67, -17, 124, 94,
+        -100, -90, -13, -86, -75, -113, -21, 53, 121, -27, 5, -52, -2, -9, 47, -118,
+        -82, 9, -35, 52, 16, -75, -31, -120, 56, -81, -120, -59, 2, -42, 111, -44,
+        58, 50, -55, -27, 121, -78, 122, 2, 67, -123, -51, -107, 50, 106, -119, 20,
+        95, 97, 19, -93, 40, 77, 59, -115, 70, -20, 36, -115, 54, -99, 28, -58,
+        42, 86, 18, -29, 8, 43, -119, 17, -125, -107, 36, -113, -128, -107, 104, -98,
+        29, 43, 67, 28, 8, 43, -51, 60, 4, 118, 97, 123, -25, 91, 121, 114,
+        -73, -37, 61, 54, 118, -89, -107, -95, -114, -72, 61, 102, 3, 7, 89, 25,
+        -51, -115, 105, 101, 59, -5, -37, -18, -77, 60, 100, 118, 111, 45, 68, 100,
+        101, 121, 118, -74, -50, -57, -67, -9, 109, 113, 41, -120, -93, 42, -68, -47,
+        -101, -115, -30, -18, -84, 99, -34, -92, -17, -14, -7, 28, -88, 40, -33, 54,
+        109, -24, 21, -21, -104, 62, 124, 109, -78, 81, 74, 112, -57, -12, -85, 33,
+        126, -78, 106, 32, -7, -27, 65, -89, 98, -53, -123, 50, 29, -105, 42, -57,
+        -86, 7, 110, 87, 55, -100, 24, 97, 18, 102, 28, 28, 73, 115, -21, -71,
+        -104, 21, -105, -67, -97, -16, 10, 39, 125, -96, 81, 42, -20, -97, 48, -20,
+        -62, -63, -127, -7, 101, 101, -20, -25, -24, -93, -58, -97, 11, -125, 89, -51,
+        51, -28, 61, -66, 39, -70, 57, 9, -106, 11, 12, -116, -62, 36, 94, -27,
+        -21, 0, -122, 62, 123, 54, 31, 85, -58, 57, 84, -76, -125, 63, 58, -115,
+        -100, -45, 103, -78, 88, -74, 96, 19, 76, -29, 62, 67, 13, 88, -118, 111,
+        -15, 76, 74, -48, -124, -85, -122, 102, 15, -16, 113, -126, -11, 63, 19, -29,
+        -90, -89, 48, 59, 35, 35, 1, 69, 40, 85, 77, -31, 49, 70, -111, -103,
+        46, 22, 88, -59, -43, 106, -106, 23, 26, 61, 98, -1, -124, 37, 79, 58,
+        48, -107, 98, -10, -107, -106, 119, 9, -11, -2, 1, 23, 63, -17, 78, -4,
+        -6, -114, -55, -128, 116, -82, -109, 94, -46, -95, -76, -117, 113, -38, 115, 64,
+        47, -7, -7, 66, 38, -13, -52, -102, -80, -14, 25, 89, 16, 54, 82, 94,
+        -91, -43, 59, 95, 106, -7, 46, 43, -19, 60, 108, 98, -102, 86, 78, -115,
+        31, -118, -123, 63, 3, -29, -60, -45, -105, -66, 56, -2, -59, 1, -98, -2,
+        -111, -91, -17, 94, -91, 87, -76, 42, -65, -75, -34, 37, -88, -124, -20, -36,
+        38, -128, 101, 42, -23, -30, 19, 111, 22, -50, -28, -53, 5, 1, 63, 15,
+        115, -63, 0, 105, 45, 106, 121, -5, -88, 101, -97, 46, 1, -59, 2, 6,
+        5, -2, -87, -72, 124, 49, -109, 69, -115, 2, 23, 64, -128, -66, -8, 86,
+        110, 23, -90, -15, 56, -75, -105, -49, -114, 97, -127, -85, 41, -84, -99, 8,
+        74, -27, 47, 37, -36, 42, -40, -83, -110, 123, -27, -17, 4, -89, -42, 51,
+        -40, 20, 117, -37, -112, -66, 54, 116, 78, -123, 78, 19, 73, -90, 102, 56,
+        51, 80, -81, 77, 38, 80, -120, 111, 61, 57, 70, 16, 54, -45, -79, -123,
+        -81, -74, -103, -125, -46, -52, -45, 116, -6, -50, -88, -18, -71, -71, -95, -4,
+        44, 43, 61, 60, -106, 97, 110, 36, 67, -85, -64, -56, 127, 42, -117, -53,
+        -68, 50, 29, 117, -48, 26, 27, 71, 16, -49, -34, -115, -30, 27, -111, 69,
+        -20, -3, -58, -85, 33, -68, 88, 1, -90, 8, 125, -55, 9, 121, 55, 105,
+        46, -61, -63, -127, -81, 52, 59, -59, -67, 65, -23, 85, 115, -39, 99, 66,
+        -63, -61, 6, 48, 74, -114, -23, 55, 61, 49, -112, -87, 40, -13, 110, 97,
+        -93, -80, -32, -87, 57, 91, 121, 112, 114, 75, 9, 116, -59, 110, 42, 95,
+        21, -53, 69, -35, -30, -4, 45, 5, -108, 28, -94, -1, -92, 15, -40, -82,
+        -88, -122, 98, 93, -62, 112, -46, -47, 37, 65, 8, 80, -108, 3, 5, 97,
+        62, 4, -89, 13, 60, -98, -115, 45, 3, -7, 112, 80, -5, -10, -110, 97,
+        -58, 96, 60, 76, -19, 15, -24, 29, -105, 46, 11, 52, 124, -128, -43, 34,
+        -100, -1, -19, -113, 79, 127, 126, -11, -20, -121, -109, -33, -98, -65, 126, -14,
+        29, -3, -8, -31, -57, 111, -97, 41, 53, 71, -14, 10, 40, -84, 48, -98,
+        -110, 2, 61, -7, 28, -120, 70, -63, 2, 5, -47, -76, -26, 124, 109, 112,
+        24, -44, -43, -63, 1, 9, -18, 88, -122, 66, 94, -80, -32, 102, 92, -13,
+        5, -126, 123, -120, -69, -22, -79, 30, 75, 97, 35, 97, 124, 73, -106, 65,
+        -60, 41, -66, 92, -96, 53, 24, -38, 124, -53, 78, 39, 27, 59, 125, -52,
+        -15, 92, -50, 96, -105, -122, -24, 30, 22, -112, 55, 108, -16, -56, 127, 15,
+        -119, 109, -83, -67, -92, -48, 61, 51, 52, -65, 1, -37, -111, 53, 113, 22,
+        -93, 60, -92, -42, 110, 100, -80, 15, 40, 105, 107, -98, 68, -76, 122, -22,
+        77, -85, 74, 91, -80, 67, 37, -104, -62, -41, 69, 33, 46, 96, 55, 5,
+        47, 14, -64, 23, 57, -48, 23, 111, 46, 82, 92, -53, -94, 32, 107, 73,
+        20, -107, -110, 2, -15, 7, 88, -14, 111, -59, -123, 24, 47, -110, 2, 107,
+        11, 26, -30, -101, 21, -96, -65, 0, 80, -39, 53, -19, -57, -86, 11, 77,
+        -61, 117, -67, 15, 116, -15, 2, -115, -111, -80, 43, -119, -68, 76, 5, 38,
+        18, 85, 49, -54, -22, 106, 78, -81, 12, 88, 10, -114, 90, -30, 2, 18,
+        57, -8, -86, -1, -76, 88, -44, -24, 78, -25, -81, -1, 3, -16, -58, 25,
+        10, -53, -86, -67, -30, 42, -3, -9, 50, -37, -69, -7, 117, -79, -73, -41,
+        -1, 11, -1, -59, -1, 19, -95, 119, -121, 123, 125, 76, 89, -1, -70, -64,
+        63, 117, -31, 41, 48, 16, 5, -88, -116, 1, -103, -73, 55, 82, -19, 18,
+        122, -20, -83, -33, 55, -21, -9, -52, -34, -89, -117, -9, 105, -59, 53, -82,
+        -60, 91, -40, 16, -64, -50, -127, -106, 122, -97, -115, 48, 121, 9, -85, -36,
+        101, 3, -94, -31, 30, -18, -27, 118, 48, -61, 97, -9, 67, 118, -6, 46,
+        -81, -69, 21, -48, -61, -120, 87, 75, 6, 45, -109, 81, -104, -108, -106, -120,
+        -103, 24, 20, 53, -64, 94, 18, -10, 30, 92, 93, -33, 10, 114, -73, -66,
+        88, 94, -98, 50, -4, 83, -118, -63, -36, 21, -111, 108, -9, -18, 93, 93,
+        19, 100, -60, -21, -120, -52, 22, 34, 20, 50, -116, -20, -4, 52, 13, 57,
+        94, 84, -17, 126, -60, -123, -118, -21, 110, 69, 27, 10, -26, 9, -2, 55,
+        -72, -70, -26, 98, 71, -9, -17, -57, -14, 63, 89, 88, -10, 98, -41, 74,
+        -98, 17, -27, 11, -40, -90, 109, 51, -18, 41, -113, -69, 106, -81, -82, -82,
+        -46, 5, 87, 34, -75, -78, -77, -12, 50, -97, -61, -62, -118, -104, 102, -78,
+        26, 115, 50, 93, 18, 27, 1, -83, 85, 66, 99, -23, 20, -31, 114, 85,
+        122, -38, 20, 45, -10, 6, -9, -85, -67, 12, 104, -89, 61, 64, 35, 52,
+        54, -75, 91, 122, 71, -98, 110, 8, -48, -44, 27, -18, 60, 96, 91, -64,
+        117, -112, 113, 6, 27, 99, 112, 95, -52, -7, 101, 90, -98, -25, 11, -111,
+        -38, 21, -55, 13, 104, -52, -23, -31, -86, -52, -45, 43, -12, -4, 125, 99,
+        -11, -96, -17, -101, 7, 102, 105, -68, 11, 46, 27, 55, -105, -27, 8, -106,
+        4, -1, -125, 125, -75, -41, -123, 29, -79, -9, -89, -81, -65, -2, -102, 74,
+        77, -105, 101, -123, -101, 65, 92, 93, 35, 53, -85, 36, -106, -34, 27, -56,
+        -19, -61, 99, 120, 112, 36, 62, 117, -17, 70, -68, 120, 20, -117, -79, -53,
+        119, -108, -79, -97, -11, -86, -90, -89, 85, 49, 95, -42, -100, 12, -4, 15,
+        116, -86, 47, -128, -119, 75, 96, -72, 119, 54, -49, 56, 5, 127, 116, 103,
+        121, -55, 108, -30, 112, 15, -26, 102, 121, -71, -32, -106, 97, 41, -49, -26,
+        56, -88, 11, 18, -69, -14, -79, -71, -56, -21, -84, 11, -5, -126, 15, -45,
+        7, -96, -108, 41, -3, -9, 46, 121, -60, -126, 113, 28, -115, 54, 46, 122,
+        -5, 28, -101, 73, -26, -2, -47, -8, -24, 75, 64, 38, -2, -67, 59, 39,
+        -57, -16, -58, -94, 14, -23, 48, -63, -60, 1, 109, -12, -89, -20, 46, -2,
+        -49, 57, -52, 67, -49, 81, -5, -6, 65, 116, -101, 86, 103, 64, -12, 115,
+        -93, 2, 49, -4, -23, -20, -20, -52, -33, -52, -35, 126, -52, -1, -33, -5,
+        106, 67, 19, 123, 119, -74, -97, -50, 102, -83, 46, -119, 35, -84, -13, 68,
+        -120, -80, -79, 37, -99, -45, 117, 90, -44, 117, 113, 73, -120, -18, -10, 115,
+        -67, -91, 31, -26, 4, -4, 41, -101, 102, 103, 103, -125, -111, 113, -28, 100,
+        -45, -58, 34, -51, 102, -77, 91, -49, -3, 45, 58, 97, -30, -20, -121, -47,
+        -106, -66, -36, -67, 123, 119, -45, 116, -93, -113, -18, -13, 2, 104, -32, 46,
+        71, -37, 104, 45, -76, -38, 86, -32, 119, 46, -64, -35, 85, -89, 57, 95,
+        -96, 127, -70, -18, -23, -68, -104, -66, 107, -94, -61, -5, -26, -54, 126, 96,
+        119, 64, 123, 15, -6, -3, -35, 122, 60, 79, 79, -77, -7, 48, -69, -68,
+        -86, 87, -15, 46, -125, -37, 86, 116, -75, 27, -60, -43, 110, -48, 126, -33,
+        94, 12, -105, -105, -13, -99, 89, 107, -95, 42, -38, -26, 96, -89, -47, 55,
+        15, 21, 92, -45, -9, 55, -99, 23, 81, -101, -71, -97, 47, -36, 15, 11,
+        -35, -33, 102, -71, 23, 69, 29, -14, -100, 69, -69, 45, -70, 81, -127, -101,
+        22, 59, -112, -82, -97, -18, -125, -115, 19, 112, 73, -94, 16, -82, 38, -88,
+        -78, -127, -68, -3, -124, -9, 42, -99, -48, 66, 46, 82, 59, 125, 115, -17,
+        -105, -94, 98, 95, 93, -46, -10, -35, -35, -1, -53, -122, 46, 9, 66, -127,
+        22, -59, 89, -46, -66, 6, 105, -19, 36, -18, 6, 121, -29, 7, -124, 7,
+        -3, -61, -61, 71, -119, -1, 90, 86, 117, 126, -74, 2, -78, -125, -120, 116,
+        35, -121, 74, 118, -31, 66, -67, -124, 30, -79, 82, -27, -114, -99, -14, -36,
+        -107, -37, -90, -42, 36, -21, 63, -79, -115, 120, 91, -107, 33, -22, 107, 117,
+        -119, -75, -77, -55, -75, -99, -82, 14, 11, 84, -105, -119, 14, -105, 68, -77,
+        118, 5, 127, 17, -18, -77, -109, -12, 106, -19, -25, -105, -8, -60, -106, 46,
+        54, -35, -121, 43, -17, 74, 111, 58, -68, 83, 88, -45, -30, 82, 2, -16,
+        -50, 11, 80, -123, 14, 64, 36, 7, -65, -38, 56, 1, 80, -25, -89, 121,
+        81, 123, 78, -17, 6, 98, -83, -117, 14, -117, -54, 42, -37, 12, -9, -15,
+        44, 127, 111, 30, 77, -18, 78, 127, 115, -91, 61, 100, 0, 122, 6, 70,
+        -79, -18, -112, -121, 27, -17, -112, 18, -61, -65, 40, 94, 76, 77, -62, -3,
+        -83, -109, -96, 42, -10, -90, -64, 15, -97, 23, -27, -54, -45, 54, -36, 95,
+        35, -109, -112, 122, -8, -16, -31, 78, 32, -59, 22, 91, 0, 35, -21, 31,
+        -111, 125, -78, 27, 87, -86, -36, -56, -2, 109, 113, -115, 10, 0, -66, 77,
+        -79, 50, 50, -68, 91, -70, -107, -82, -105, 3, -68, -5, -16, -18, -20, -18,
+        89, -125, 68, -69, 43, 112, -111, -119, 121, 24, -109, -8, -80, 94, 19, -117,
+        90, -52, -126, 38, -30, -5, -93, -19, 68, -103, 69, 1, 125, -35, 79, -17,
+        -91, -39, -106, 41, 113, -74, -62, -41, 80, 93, 33, -45, -37, -112, -11, 38,
+        -52, 77, 84, -10, 78, -12, -100, 57, 12, 15, -93, 110, 80, -22, 91, 122,
+        50, 76, -49, 96, -38, -29, -42, 108, 22, 34, 114, -49, 4, 101, -42, -1,
+        -117, -43, 17, -18, 4, -51, 4, 11, -81, 68, 15, -60, -67, 17, -20, 5,
+        30, -12, 39, -82, -52, -2, -90, -123, -11, -19, -82, -99, 70, 99, -15, -67,
+        98, 42, -36, -2, -119, 92, 45, 80, -15, 112, -28, 15, -74, 30, 23, 107,
+        122, 110, -45, -32, 67, 111, -125, 15, -73, 54, 40, -113, -14, -26, 85, -109,
+        -91, -20, -34, 9, 6, -96, -17, 37, 34, -84, -22, 72, -104, 108, 105, 1,
+        -117, -104, -32, -119, -106, -39, 5, -74, 57, 0, 107, -34, 56, 67, 78, -97,
+        56, -71, 59, 66, -13, 44, -125, 3, 110, -89, -93, 46, 42, -7, 79, -25,
+        110, 115, -34, 82, 119, 107, 7, -19, 67, -68, -13, 2, 89, 16, 33, -11,
+        -106, -45, -25, -82, -94, 7, -48, 110, 19, 7, 53, 62, 109, -42, -38, 43,
+        110, -18, -41, -83, -26, -21, 15, 16, -46, -84, -38, 111, -120, 123, -30, -122,
+        -40, 82, -21, -65, -10, 14, 88, 109, -66, 3, 86, 109, 72, -114, -50, -7,
+        -1, 109, 87, -64, -22, -53, 95, 1, -101, 120, -64, -43, 31, 112, 3, 112,
+        123, 15, -73, -74, -57, 87, -59, -26, 5, -29, 50, -51, -101, -69, 5, 61,
+        91, 85, -103, 3, -35, 2, -97, 11, -103, 13, 40, -58, 117, 123, 11, 122,
+        0, -42, -92, 97, -14, 118, -20, -75, 121, -104, 62, 80, -83, -8, -85, 1,
+        106, 103, 4, -74, 107, -51, 45, 93, -37, -118, -62, -38, 22, -58, -106, -21,
+        -109, 34, -5, -19, 38, -82, -71, 126, 94, 96, -69, 77, 29, -43, -7, -76,
+        -71, -37, 84, 117, 91, -17, 110, 53, 123, -37, 47, -128, 109, -93, 52, 25,
+        -5, 109, -62, -72, 107, -83, -31, 102, -113, 93, -89, -53, 71, -83, 22, -2,
+        -55, -31, -77, 110, -59, 102, -24, 70, -74, -56, 66, 86, -101, 74, 126, -2,
+        5, -87, -95, -73, 72, 69, -68, 111, 93, 66, -11, -81, -117, -30, 2, -15,
+        -22, 32, -98, -96, 80, 35, 74, 86, 105, 113, -25, 24, -9, 26, 30, 28,
+        -47, 113, -16, -19, 38, -5, 125, 94, -27, -89, -7, -100, 82, -72, -29, 91,
+        59, -38, 57, -33, 107, -17, -46, -82, -75, -36, -2, 126, -15, 110, -119, 6,
+        -26, -73, -17, -110, -67, 16, -39, -121, 46, 63, -90, -113, 60, 91, -60, -20,
+        38, -3, -98, -5, 22, -115, 1, 11, 89, 70, 62, -97, 35, -26, 58, -61,
+        -1, 17, 12, -44, -75, 125, -105, 13, -23, -123, -126, 18, 74, -32, -18, 125,
+        15, -83, 24, 66, -39, -8, 68, -3, 81, 10, -90, 124, -127, -81, -128, 40,
+        -63, -61, 20, -69, -13, 106, 87, 126, 10, 56, -11, -80, -20, -37, -109, 70,
+        -51, -53, 108, -79, -20, -26, 64, -1, 88, 83, 13, -75, -101, -119, 100, -34,
+        -47, 76, -42, -53, -46, -56, 18, -86, -82, 82, -102, -41, -56, -57, 110, -5,
+        83, -13, -123, 63, -67, 88, 114, 15, -20, -79, -119, -13, 98, -46, 106, -22,
+        73, 86, 82, 114, 42, -63, 18, 103, 30, -55, 87, 97, 121, -111, 60, -56,
+        -66, 26, 124, 125, -44, 34, -14, -39, 52, 127, 24, 107, -69, 101, -70, 26,
+        89, 106, -36, -34, 28, 49, 118, 111, -98, 26, 63, 100, 90, 123, -110, -5,
+        -67, -15, -100, 121, -21, -35, -69, 119, 79, -29, 75, -118, 60, -69, 87, -111,
+        74, 88, -17, -95, -1, -19, -43, -1, -40, -41, 62, 13, 45, 21, -28, 14,
+        -37, -75, -4, -122, -39, 108, -87, -47, 28, 120, -68, -29, -85, -91, -77, 101,
+        119, -83, -38, -66, -86, 27, 42, -28, -117, 91, 87, 105, -35, 3, 103, 119,
+        -49, -18, -99, -35, 111, 87, -73, 105, -50, -89, -22, 114, 115, -30, -78, 89,
+        -93, 79, 30, 48, -10, 36, 127, 42, -108, -83, -35, -80, -122, -39, -17, 127,
+        117, 118, 118, -38, -70, 55, -101, -49, -31, 106, 115, 14, 9, 61, -74, -52,
+        117, -77, -98, -34, 115, -73, -84, 104, -49, 10, 61, -34, -7, 70, 22, -35,
+        18, -84, -102, -90, 47, 10, 81, -20, -64, 79, -88, 41, 55, -94, -82, 106,
+        -83, -109, -1, -47, -34, 127, -31, 56, -121, 117, 119, 61, 42, 3, 47, -36,
+        -8, 94, -26, 119, -18, 65, -53, -19, -90, 15, -11, -115, 31, 77, 126, -27,
+        -91, -24, 119, -65, -61, 60, -120, -73, 13, -96, 93, -47, 126, -121, -67, -21,
+        29, -86, -62, -78, 45, 77, 61, 56, -118, 54, -67, -6, 10, 94, 92, -66,
+        32, -48, 27, -16, -90, 86, 26, 8, -23, -52, -95, -110, -116, -37, -107, -45,
+        -92, -120, -31, 104, 3, -40, -51, 72, 65, -63, 110, 69, 11, 18, -50, 46,
+        -89, -58, -127, -39, -82, 119, -94, 31, -34, -74, 61, -11, 12, -124, -20, -28,
+        90, -114, 117, -16, -16, -127, -25, 81, -119, -42, -47, -9, -90, 36, 95, -96,
+        -116, 23, -14, 7, -84, 4, -41, -94, 114, -42, 120, 15, 39, 109, -78, -18,
+        105, 86, 127, -56, -124, -106, -39, 110, 15, -29, 120, 80, 60, -38, 67, 114,
+        85, 55, 105, -60, -95, 116, -91, -19, 41, 107, 54, -101, -19, 52, 78, -103,
+        -32, 106, 26, 56, -36, 6, -98, 51, 57, -77, -37, 95, -69, 110, 35, -85,
+        -61, -15, 55, 16, 71, 113, -43, 96, 15, 7, 94, -96, -78, -79, -37, 112,
+        -94, -116, -102, 96, 89, 60, 79, -27, 15, 61, 10, 100, 114, 19, 56, -124,
+        -16, -83, -17, 70, 104, 81, -100, 1, -113, -78, 88, -106, -35, -114, 14, -36,
+        73, 46, -36, 20, -7, -2, -113, -53, 108, -106, -89, -128, -103, -48, -85, -13,
+        94, -70, -104, -19, -123, 122, 105, 31, 62, -8, -22, -22, 90, -88, -66, 52,
+        -119, 9, -47, -9, -42, 51, -38, -82, 117, -67, -123, 48, -55, 88, 89, 92,
+        72, 5, 44, 76, -114, -74, -113, -92, -52, -77, 99, 121, -76, -102, -33, -13,
+        40, -53, -102, -4, -27, 70, -127, 3, -61, 84, 77, -96, 73, -2, 98, -85,
+        -24, -93, -33, 59, -78, 55, -1, -38, 6, -86, 70, -31, 31, 91, 119, 83,
+        94, 83, -107, 78, -27, -39, -62, -92, -85, 60, 99, 64, 54, -41, 102, 42,
+        -22, -18, 120, 34, 21, -92, -18, 12, -18, -87, -107, 87, -6, -96, -84, 93,
+        73, 9, 97, 40, -12, -12, -99, -84, -39, -78, 76, -59, -111, -68, 91, 57,
+        121, 120, 121, 117, 47, -117, 25, -44, -123, -53, -14, 67, 90, -50, -36, 18,
+        117, 126, -119, 60, -74, -76, -89, 24, -46, 4, 123, -70, -85, -115, 105, 73,
+        100, 97, 77, 74, 90, 102, -87, -40, 3, 123, 110, -6, 78, 5, -59, -2,
+        97, 21, 36, 59, -117, -45, 122, -117, -94, 107, -49, -85, 5, 23, 45, 117,
+        -111, 23, -74, 18, -67, 9, 127, 68, -21, -108, 101, 78, 80, 115, -89, -63,
+        -59, -112, -106, -78, -19, -85, -76, -66, -40, -112, -53, 113, -125, 125, -62, -121,
+        38, 69, 43, 94, -62, -102, 93, 110, 62, -3, 109, -18, -32, 106, 123, 17,
+        34, 31, -75, -128, 112, -41, -117, -57, 80, 43, -37, 122, 125, -80, -128, -85,
+        91, -61, 53, 121, -98, 73, 113, -83, -38, -85, -128, 20, 46, 77, -117, -110,
+        22, 1, -35, 104, -125, 22, -104, -70, -53, -27, 45, 43, -65, 93, 5, 118,
+        -39, 35, 36, 60, -48, 13, -101, -20, -109, 16, -112, -57, 110, 87, 27, 9,
+        90, -121, -86, -15, 32, -25, -47, 24, -38, 68, 127, -12, 13, -6, -75, -33,
+        50, 83, -70, -75, -83, 35, 117, 47, 68, 103, -8, -23, -78, 46, -74, 12,
+        94, -96, 42, -81, -54, -65, -108, 88, -119, -58, -76, -60, -54, -5, 66, -123,
+        -46, 9, 86, 13, 21, -121, -17, 54, 59, 11, 43, -77, 41, -59, -83, -86,
+        73, -3, -82, -35, 27, -2, 107, 92, 30, 87, 24, -21, 15, -3, -52, -80,
+        37, 86, 52, 44, 122, 23, 89, 58, -21, -79, -13, 25, 97, 116, 76, 57,
+        108, 33, 55, 79, -92, -111, -106, 105, -112, -56, 71, 60, 70, 87, 59, -24,
+        -78, 105, 46, -3, 50, -95, -119, -38, -88, -18, 93, -94, -47, 96, -120, -63,
+        -20, 46, -78, -123, 21, 28, -53, 99, -121, -40, 102, -63, 72, 64, 40, 38,
+        -41, -26, 2, -101, 108, 24, 69, 17, -61, 126, 49, -125, 110, -83, 35, 116,
+        43, 84, -69, -26, 119, 57, -37, -37, -79, -45, -65, 60, 52, 2, 16, 11,
+        -5, 52, -104, -57, 26, -82, 31, -40, 113, 1, 69, 117, -41, 102, -12, 52,
+        65, 77, -29, 121, -57, 7, -25, -121, 81, -69, -83, -18, -56, -120, -31, -96,
+        -52, 71, 71, 97, 10, 40, 27, -35, -12, 96, 8, -58, 84, 59, -115, 120,
+        6, 124, -52, -116, -62, 50, -78, 71, 0, -23, -73, -127, -3, 107, -67, 86,
+        -33, 79, 105, -38, -62, 44, -118, 115, 57, -123, -124, 67, -15, 3, -74, 61,
+        76, -51, -45, -76, 62, 41, 126, 88, 94, -62, -126, 78, -93, -125, 3, -20,
+        -32, 47, -95, 44, 28, -55, 114, 102, 41, -14, 2, -92, -118, 104, 7, 54,
+        -46, -20, 93, 71, -70, -112, -69, -94, -39, -15, 126, -116, 37, -107, 23, 95,
+        116, 99, -127, 102, -115, -53, 43, -27, 51, 33, -118, -125, 26, -120, -50, -53,
+        -12, 10, -67, -9, -26, -10, 6, 16, 17, 52, 84, 42, 94, -101, 61, 36,
+        -66, 56, 124, -84, 72, -91, -85, 0, -93, 44, -119, -100, 40, 70, 3, -32,
+        20, 31, 18, -2, 65, 78, -40, -74, 117, -113, -19, 37, 87, 60, -87, 79,
+        -117, -53, -45, -126, 29, 41, -31, 38, 79, -95, 21, 72, 120, 74, 103, 49,
+        -87, -52, -81, 88, -28, 125, -109, -106, 79, 113, -1, -55, 92, -7, 45, 29,
+        7, -32, 126, 45, 87, 94, 19, -48, -102, -36, 120, 28, 28, 96, -121, -7,
+        -73, -120, -59, -118, -74, -89, 33, -89, 114, -62, -57, -113, -91, 12, -13, -57,
+        -121, 82, 4, -16, -5, -127, -74, -115, 50, 89, -25, -109, -63, 83, -116, -65,
+        -123, 109, -88, 50, 18, -89, 38, -82, -46, -78, 34, -89, 80, -95, -76, -115,
+        39, -114, 66, 26, -65, -29, -34, -8, 94, -20, 93, -128, -12, 29, -19, 81,
+        -74, -23, 71, 15, -21, 18, -108, 118, 12, 66, -58, -52, 120, -3, 62, 87,
+        73, -78, -112, -27, 36, -124, -94, 123, -94, 15, 55, -79, -39, -47, 87, -124,
+        -78, 87, -29, 41, 23, -93, 37, 51, -34, -54, 76, 65, -9, 17, 114, -63,
+        -39, 112, -114, -106, 27, 90, 124, -109, 47, -108, -69, 44, 17, -4, 75, 20,
+        48, -115, -7, -43, -92, 85, 79, -26, 115, 46, -4, -20, -33, -53, 116, -2,
+        11, -11, 7, 119, 16, 47, -86, 12, -40, 66, 91, 21, -1, 121, -102, -50,
+        -89, -53, 57, 123, 101, -63, -35, 42, -11, 118, -47, -2, -40, 57, 108, -68,
+        93, 119, -97, 28, -45, 117, 12, 122, -14, 3, 120, -46, -98, 28, 63, 61,
+        -123, -46, 107, -85, 16, 124, 54, 23, 3, -48, 124, 13, -57, -87, -39, -90,
+        -10, -10, 20, -95, 29, -17, -53, -76, 60, -49, -86, -70, -71, -80, -38, 79,
+        11, -7, -40, 21, -63, 125, 25, 115, 9, 31, -118, 52, 59, -41, -85, 55,
+        89, -115, 14, 66, 42, 25, 122, -122, -50, 39, 35, 73, -12, 5, -127, 46,
+        29, 68, -67, -123, 81, -113, -128, -30, 100, -93, 89, 53, 32, -49, 34, -118,
+        -25, 100, -97, -3, 35, 119, 78, -102, -3, -49, 123, -89, -8, -100, -10, -100,
+        -7, -128, -48, -64, 109, -72, -117, 105, 124, 85, 79, 83, 7, -67, 108, -127,
+        -49, 112, 112, -111, -52, -115, 2, -33, -88, 124, 53, -21, -124, -124, 46, -14,
+        -77, -102, 124, 100, 40, 127, -75, 81, 124, 35, -36, 102, 12, 23, -15, -11,
+        -118, 124, -45, 85, -61, 34, -42, -45, 49, -68, -63, -82, 15, 111, -120, -76,
+        -47, -53, -96, 34, -71, -62, -118, 1, -3, -29, -55, 120, 27, 51, -99, -95,
+        -77, 112, -90, -2, 97, -58, 48, -73, -77, -40, 9, -54, 26, -1, 79, 92,
+        61, -105, 108, -97, -65, -63, 91, 66, -100, 37, -80, -94, 100, 110, 45, 15,
+        13, 6, 116, -48, 14, 45, 101, 38, -96, -54, 99, -13, -125, -126, -40, 9,
+        95, -67, -28, -109, -9, -61, 102, -57, 11, 85, 92, 42, -57, 11, -124, -77,
+        -11, 13, 80, -102, -73, -23, 15, 112, -117, 102, -117, 98, 121, 126, -79, -121,
+        -21, -127, 118, -40, -126, -110, -36, 43, -96, -45, -72, -3, -96, -128, -25, -54,
+        29, 73, -48, -39, -57, -113, -87, -102, -105, 84, -98, -37, -89, 18, 101, 0,
+        66, -52, 91, -80, 97, 110, 122, 73, -53, -59, -34, -115, 23, -80, -47, 56,
+        -121, 80, 17, 121, -55, -122, -42, 114, -37, -13, 18, 14, 26, -125, 126, 88,
+        -55, 84, -31, -59, 101, 122, 78, -114, -20, -86, -48, -105, 125, -110, 93, -41,
+        50, 55, -64, -115, 25, -48, 61, 100, 94, 94, -110, 110, -122, -82, -121, 115,
+        -60, 127, -90, 71, 27, -61, 107, 11, -123, 33, -98, -29, -52, -58, -20, -33,
+        2, 10, 11, 71, 23, 97, -111, -52, -123, -77, -107, 111, 72, -118, 87, 69,
+        -58, 42, 23, 7, 7, 5, -7, 44, -40, 5, -72, 9, -125, -18, 117, -10,
+        98, -112, 87, -12, 55, -52, 100, -91, 40, -110, 49, 7, 47, -110, -2, -24,
+        -30, -111, -54, 16, -5, 108, 116, -47, -23, 68, -101, -101, 83, 85, -58, 23,
+        19, 17, 101, 119, -57, 10, -47, 40, 56, 43, -127, -80, 111, -97, -52, -49,
+        -104, -53, -59, -90, -71, 4, -64, -117, 79, -100, 75, 79, -105, 5, 65, -90,
+        -107, 105, 116, -9, 115, 51, 25, 119, -46, 47, 79, -43, 55, -18, -91, 38,
+        48, 69, -13, -20, 6, -17, -83, 13, 79, 82, 92, -5, 6, 68, -109, -30,
+        -54, -55, 59, 25, -43, 124, -126, 68, -96, -89, 80, 60, -25, 67, 53, -91,
+        -13, -14, 119, -28, 37, -22, 107, 72, -116, -7, -48, -3, 91, 37, 24, 94,
+        -110, 96, -34, -61, 105, -17, 26, 65, 18, 114, 126, 90, -108, -62, -36, -89,
+        -126, 41, -92, -12, -109, 124, -6, -114, -119, -74, 24, 3, 23, -41, 111, 41,
+        17, -49, 21, 74, -51, 37, -55, 104, 79, 67, 35, 60, 61, 80, -29, -35,
+        1, -51, -106, 92, 52, -88, 11, 88, -97, -128, -67, -64, -89, 1, 24, 28,
+        61, 17, -4, 120, 6, 52, -13, -63, -63, -84, -73, -30, -58, -127, 72, 121,
+        -51, -98, -4, -47, -55, 70, 113, 69, 83, -102, 33, 15, -32, 59, -17, 79,
+        0, -114, -31, -22, 18, 58, -74, -81, -101, 100, 18, -121, 16, -91, -22, -82,
+        84, 51, 83, 55, 85, -93, 60, -50, 125, -61, -25, 24, 35, 23, -2, -115,
+        -34, -45, -59, -35, -124, -13, -96, -112, -93, 73, -64, 24, -29, -82, 126, 17,
+        -44, 60, 98, -46, -19, -100, -127, -119, 111, -13, -22, 53, 114, -98, 64, -51,
+        70, -111, -69, 3, 80, -76, 34, 71, 97, 64, -26, -52, 74, -5, -43, 107,
+        -53, 105, -83, 123, -107, 54, 107, -95, -103, -106, 40, 79, 24, -65, -31, -93,
+        -113, -24, -68, 27, 117, 101, -21, 25, 18, -15, -68, -23, -110, 60, 111, 108,
+        117, 65, 84, -31, -33, 106, 52, 38, -97, -87, -62, 117, 106, -66, 16, 63,
+        -118, 101, 77, 126, 86, -75, -37, 84, -24, -116, -12, -74, 26, 76, -4, -18,
+        93, -50, -57, -11, 4, -40, 16, 100, 28, 91, -102, 68, -54, -43, 90, -4,
+        -26, -35, -122, 3, -107, -59, -103, -94, 58, -31, -81, 16, -95, 42, 10, 48,
+        -69, 4, 82, 20, -2, -112, 31, -38, -109, -30, -39, 117, 54, 53, -18, -2,
+        45, 5, -67, -67, -81, 69, -95, -80, 102, -41, -60, 85, -116, -20, 39, -119,
+        86, -32, 24, 82, 72, 1, -33, -74, 51, 119, 14, 111, -27, -113, 31, 115,
+        -90, -75, 88, -12, -13, 67, -79, 120, -94, 74, -61, 81, 1, -42, -46, -30,
+        -83, -91, 43, -40, 22, 18, 39, -50, 70, -62, 37, -111, -49, -121, -101, -10,
+        74, -44, -30, -28, 74, 59, -76, 55, -35, -24, 36, 109, 94, -83, -30, 48,
+        75, -2, 69, 14, -120, 96, 74, -16, -82, -50, -20, -24, -17, -1, 66, 47,
+        77, 24, 88, 27, -77, -51, -16, -107, 13, 39, 82, -93, -68, -59, -115, -108,
+        103, -14, -55, -11, 31, 122, -61, 73, 18, -57, 79, 88, 30, -75, 64, 1,
+        114, 10, -3, 98, 99, -84, 28, 92, 25, -62, -59, -122, -37, 77, -31, 8,
+        -48, 116, 76, -120, 27, 83, 77, -70, -29, -74, 120, -117, 83, -64, 6, 121,
+        57, -16, -110, -105, -125, 9, -20, 60, -29, 11, 104, -54, -3, -80, 81, -9,
+        -56, 91, -9, 104, 18, -63, 78, 50, 62, -29, -54, 87, -7, -82, -73, -14,
+        93, -69, -14, 93, -12, -22, -19, -87, 124, -49, 91, -7, -98, 93, -7, -34,
+        68, -6, -117, 87, -44, 112, -95, 54, -72, 66, 8, 9, 3, 34, 127, 94,
+        120, 124, 37, -9, 40, -120, 82, -61, 41, 115, 8, -89, 104, -65, 31, -93,
+        116, -94, 118, 57, 91, -103, -128, -9, 57, -53, 3, 66, -103, -108, -88, -62,
+        -18, 37, -89, -93, 108, 103, -74, -53, 75, -118, -60, -95, 28, 76, 83, 73,
+        -70, -65, -116, 48, -71, -78, 36, 25, -41, -42, -33, -14, 91, 16, -98, -50,
+        87, -7, -30, 85, 122, 29, 98, 105, -66, 38, -56, 123, -68, -89, 38, -20,
+        -34, 105, -10, 11, 86, -7, 89, -124, 30, -95, 58, -85, -83, 117, -34, 58,
+        117, -12, -92, 58, -110, 0, -72, -89, -13, 105, 102, 114, 50, -26, -52, -46,
+        -66, -2, 9, -6, -97, 23, -53, -22, -89, -76, -66, 32, -90, -102, -27, 24,
+        -70, 125, 22, 107, 112, 47, 78, -16, -73, -40, -23, -36, -37, 102, 15, 127,
+        -77, -50, 3, 78, 93, -100, -58, -56, -18, 56, 7, 70, -6, -39, 110, -31,
+        -58, 62, -111, 13, 27, 79, -128, -123, -13, -20, -41, -74, 83, 102, -19, 87,
+        56, 102, -7, 103, 28, -77, -111, 25, -77, -49, -69, 123, 111, -73, -127, 54,
+        -52, -82, -38, -105, -24, -64, 79, 77, -84, -19, 20, -67, 13, 17, -3, 23,
+        -51, -114, -10, -128, 106, -55, -59, 101, 80, -126, -111, 18, 48, -110, 111, -64,
+        -38, 22, 57, -3, -79, -45, -104, -6, -90, -111, 29, -51, -1, 33, -109, -56,
+        -63, -23, 77, 71, -88, -48, 22, 92, -22, 64, 41, -110, 64, 85, 49, -28,
+        112, 119, 58, -25, 115, 36, -103, 72, -110, 49, -8, -89, 18, -48, 125, 127,
+        84, 61, -110, 98, -48, 81, 5, -116, -91, -31, -29, 113, 92, 77, -116, -98,
+        -30, -89, -30, 76, 75, -88, 88, 62, -62, 36, 83, -114, 58, 42, -111, 51,
+        85, -119, -68, 62, -14, 115, 92, 78, -44, -38, 53, 122, -108, -120, 8, 12,
+        -58, 80, -111, -50, -52, 83, 65, -87, -63, 21, 61, -99, 99, -72, -92, 70,
+        77, 79, 72, 114, 19, 121, 108, -66, 102, 55, -117, 94, 40, -98, -119, -72,
+        -28, -77, -42, 27, -66, -65, -106, 110, 115, 51, -7, -90, -109, 53, -34, 116,
+        56, -108, -10, 126, 37, 69, 55, 57, 112, 66, -93, 76, 60, -23, 84, -69,
+        61, -23, 100, 45, 47, 54, 60, -48, 25, -70, 84, -36, 88, 0, -24, -106,
+        12, -97, 116, 50, -49, -109, -114, 40, 18, -60, 99, 42, -124, 79, 58, -26,
+        82, 84, -33, -26, 101, -67, -94, 29, 23, 102, 109, 47, 61, -87, 120, -23,
+        49, -56, 76, -116, 93, -66, 2, -46, 105, -58, -124, -24, 70, -119, 26, -18,
+        -31, -17, -48, 121, -122, 44, 13, -5, 51, 75, 40, 116, -103, 70, -104, -22,
+        22, 7, -110, 17, 48, 120, -117, -21, -31, 76, -94, 6, -70, -118, 51, -77,
+        59, 86, 11, 59, -7, 67, -11, -45, -109, -7, -68, -74, -100, 90, -118, 32,
+        93, -20, 123, 84, -84, 50, 57, -75, 116, 72, -119, -52, 120, -115, -16, -71,
+        45, 69, 57, 28, -1, 58, -50, 122, -54, -123, -87, -98, 81, 59, 92, 69,
+        115, 111, 123, 110, 22, -77, 10, -50, -119, 4, 117, -111, -97, 95, -112, -102,
+        20, 103, -3, -72, 96, -9, -60, -33, -29, -45, -83, -1, -43, 109, 11, -16,
+        31, 23, 84, -105, -54, -86, 86, -52, -128, 26, 30, -113, -36, 6, 40, 93,
+        -46, -18, -27, 44, -37, -83, -66, 46, 105, -42, 119, 3, 126, 108, -122, 97,
+        -105, 54, -31, 88, 33, 63, 90, -74, -115, 7, -41, -73, 17, 35, 22, -82,
+        -17, 127, 30, 45, 50, 106, -69, 0, -83, -123, 112, -99, -53, -6, -105, -40,
+        124, -40, 106, -72, -93, -75, -32, 121, 56, -61, -19, 32, 91, 92, -126, 91,
+        -67, 108, 4, 68, -7, 67, -82, -42, -99, -87, -109, 99, -13, 99, 40, 88,
+        -112, 84, 92, -51, 40, -1, 73, 114, 122, -44, 50, -60, 85, -51, 65, 60,
+        3, 38, -95, 92, -92, 115, 34, -60, 82, 107, -72, 111, -1, 59, 12, -9,
+        -19, -50, -61, 109, 4, -79, -7, 127, 113, -72, -50, 32, -38, -122, -37, 12,
+        -49, -13, 101, 121, 24, -47, 93, 65, -53, -44, 116, 43, -42, 120, 117, -101,
+        -35, 117, 59, 17, 54, -50, -16, 46, -85, -79, -13, 90, 28, -101, 31, -78,
+        -121, -126, -110, 37, 18, 47, -55, 92, -23, -82, -37, 11, 32, -68, 106, -117,
+        -122, -96, -37, -6, 9, -48, 86, -98, 9, 52, -17, 36, 95, -56, -126, -34,
+        -65, -105, 89, -71, 98, -15, 37, -66, -109, 53, 92, -39, 6, 54, -71, 66,
+        -104, -13, 4, 122, 50, -1, -123, 36, -78, -37, 111, 66, 21, -31, -89, 103,
+        -41, -81, 24, -128, -115, -33, -96, -56, -9, 112, -25, 102, 85, -3, 119, 4,
+        -5, 98, -15, -57, 112, -73, 125, -109, -78, -3, -39, 16, 81, 65, -5, -64,
+        -18, -68, 5, 126, -25, 45, 44, 110, -17, -126, -5, -14, -42, -20, -33, -53,
+        -30, -61, -1, 45, -35, -101, 83, 87, -34, -74, 44, -48, -50, -69, -95, 50,
+        22, -59, -95, -92, 124, -47, -70, -74, 45, -72, -51, 33, -74, -63, -79, -41,
+        93, -60, 8, 107, -67, 31, 77, -59, 3, 44, -5, -77, 35, 27, 49, 41,
+        42, 29, -120, -84, -123, -104, 49, 67, -84, -32, -69, -50, -45, 101, -119, 66,
+        87, -82, 69, 11, 107, -111, 72, 42, 56, 89, 43, 57, -23, 68, -107, -22,
+        -119, 26, 38, 16, 43, -82, -39, -105, -35, 45, 58, 94, -92, -37, 15, -93,
+        81, -77, 47, 34, -32, -39, 45, 112, 5, 69, -8, 80, -11, -67, 1, 22,
+        -38, 2, -44, 105, 64, -74, -62, -109, 16, -95, 57, 68, 126, -103, -31, -13,
+        -46, -113, -117, -97, -116, 22, 68, 73, 43, 40, -124, -63, -56, 90, -23, -101,
+        89, 22, -62, -11, 39, -7, 101, 86, 44, -21, -48, -23, 29, 11, -19, 49,
+        -77, 108, -60, -47, 48, -14, 100, 12, 64, -40, 54, 18, -112, -55, -105, -42,
+        -115, 90, 36, -120, -88, -37, 100, 20, -12, -102, -95, -30, 4, 81, 0, -99,
+        -63, -3, 126, -53, -32, 100, -96, -60, -115, 108, 98, -53, -124, -2, -61, -128,
+        51, -14, 41, 68, -78, -96, -110, -92, -83, 109, 19, 62, -111, -31, 50, -28,
+        -99, -13, -51, -22, -59, -73, -19, 119, -94, 27, 94, -124, 31, -11, 61, -20,
+        -94, -44, 87, -36, -103, -107, 84, 44, 34, 61, 79, 100, -64, 0, -62, 57,
+        80, -62, 19, 122, 114, 70, 32, 90, 97, 5, -123, 37, -64, -64, 21, -23,
+        -52, 51, 121, 82, 104, -109, -23, 8, 1, -42, -91, -8, 100, 62, 15, -125,
+        49, 46, 91, 87, 95, -114, -109, 0, -29, 50, -12, 71, -7, -93, 76, 74,
+        119, -14, 78, -121, -27, 33, 117, -104, -115, -13, 73, -4, 63, -33, -4, -8,
+        3, -85, -73, -47, 55, 34, -17, 39, 53, -52, -59, -23, 18, 86, -102, -80,
+        74, 87, 4, -101, 10, -128, 15, -17, 113, 12, 18, -100, 103, -115, 51, -78,
+        -23, 86, -3, 78, 115, 45, -60, 28, 99, 40, 18, 75, 60, -127, 15, 108,
+        120, 78, 105, 51, 10, -91, 79, -87, 11, -39, 29, -112, -18, -104, 21, 67,
+        -46, 120, -113, -42, -45, 83, 53, -16, 83, -52, 1, -30, 88, 63, -93, 122,
+        124, 116, 92, 117, -113, -122, 125, 12, -40, 112, 52, 42, 30, 85, -93, 2,
+        38, -92, 28, 23, -35, -93, -119, -127, -67, -118, -55, 8, -120, -58, 113, 54,
+        65, -19, -33, -7, 10, -120, -103, 82, 69, 100, 73, 13, 21, -93, -84, -36,
+        66, 92, 92, -53, -32, -93, -116, -3, 69, 100, 30, -71, 11, 126, 67, -79,
+        -64, -24, 63, -2, 63, 5, -96, -87, -66, 35, -28, 7, 0
+    };
+    const size_t apexcharts_min_js_gz_size = sizeof(apexcharts_min_js_gz);
+}
+
@@ -0,0 +1,1953 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*
+*
+*  Auto-generated by tools/generate_resources.py
+*  Source: https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/css/bootstrap.min.css
+*  gzip member of 232,914 bytes, size: 30,916 bytes
+*/
+
+#include "../../include/html_gen_resources.h"
+
+namespace resources {
+    const char bootstrap_min_css_gz[] = {
+        31, -117, 8, 0, 0, 0, 0, 0, 2, 3, -20, -67, -37, -114, 35, 57,
+        -110, 40, -8, -66, 95, -95, -55, 66, -94, 82, 93, -110, -54, 93, -110, 75,
+        113, 65, 21, -26, -126, 57, -69, 3, -12, -52, -61, -52, 28, -32, 28, 52,
+        106, 1, -105, -28, -95, -48, -92, 110, 71, 82, 100, -122, 74, -120, -58, 126,
+        -60, 126, -64, 126, -53, 126, -54, 126, -55, -14, -22, 110, 70, -102, -47, -23,
+        46, 101, 86, 86, 119, 87, 85, 102, 69, 56, -115, 70, -38, -123, 102, 36,
+        -115, 52, -2, -3, -4, 57, 63, 28, -117, 83, -25, -35, 127, -1, -49, -1,
+        -42, -65, 123, -9, -8, -29, 31, -2, -18, 127, -21, -4, -95, -13, -113, -69,
+        -35, -23, 120, 58, -28, -5, 78, -25, 83, 54, 24, 13, -110, -50, -121, -25,
+        -45, 105, 127, 124, -8, -15, -57, 101, 113, -102, -39, -46, -63, 124, -73, -7,
+        -79, 43, 43, -4, -45, 110, 127, 62, -84, -106, -49, -89, -50, 48, 73, -45,
+        -2, 48, 25, -114, 58, -1, -7, 92, 0, 68, -1, -16, 114, 122, -34, 29,
+        -114, 18, -8, -113, -85, 121, -79, 61, 22, -117, -50, -53, 118, 81, 28, 58,
+        -1, -6, 47, -1, 9, -48, -81, 78, -49, 47, 51, -123, -8, -12, 121, 118,
+        -4, -79, 108, -21, -57, -39, 122, 55, -5, 113, -109, -81, -74, 63, -2, -15,
+        95, -2, -23, -97, -1, -19, 63, -2, 89, 54, -4, -29, -61, 65, 0, -12,
+        -2, -76, -56, 79, 121, 127, 118, -20, -97, -98, -117, 77, -15, -45, 90, -10,
+        -28, -105, 75, 95, 126, -103, -83, 95, -118, -121, -17, -110, -59, -92, 120, 90,
+        60, -86, 47, -85, -19, 98, -75, -36, 61, 124, 55, -103, -92, -55, -45, 80,
+        127, -37, -65, 28, -10, 107, 1, 55, 121, 26, 15, -25, -87, -7, -74, -38,
+        126, 124, -8, 110, 49, 25, -115, -18, -58, -6, -53, -95, 88, -120, 15, -13,
+        81, 54, -50, -12, -121, -35, 33, -33, 46, 69, -75, -89, -59, -76, 72, 13,
+        -48, -71, 88, -81, 119, -97, -59, -73, -89, 121, -102, 76, -11, -73, -27, -95,
+        40, -74, 15, -33, -91, -9, 119, -45, -52, -128, -99, -118, 124, -3, -16, -35,
+        48, -103, -33, -33, 27, -96, -7, 57, -33, -54, -98, -50, -13, -89, -28, -47,
+        -12, 61, -97, -117, 46, 36, -119, -7, -3, -13, -13, -22, 36, 91, 123, 122,
+        -78, 104, -13, -77, -24, -13, 124, -102, 77, 23, -43, -105, -2, 34, 63, -120,
+        90, -93, -15, 40, 31, 39, -32, 115, -102, 36, -94, -18, -35, -45, -3, 83,
+        14, -66, 14, -27, -41, -30, -66, -104, 23, 0, 105, 127, 36, -65, 46, -118,
+        98, 88, 76, -64, -41, -79, -4, 58, 47, 22, -29, 5, -60, -112, -55, -81,
+        -7, 98, -106, -51, 96, 39, 38, -14, -85, -41, -75, -87, -4, 58, -66, -49,
+        -110, 108, 10, -66, -34, -55, -81, 94, 127, -17, -27, -41, 97, 58, -52, -122,
+        -9, 70, 32, -121, -43, 38, 63, -100, -79, 52, -113, -59, 124, -73, 93, -88,
+        -49, -80, -75, -29, -53, 124, 94, 28, -113, -104, -25, -85, -19, -45, 14, 115,
+        -8, 115, 126, -40, -82, -74, 75, 44, -83, -123, 20, -22, 1, 75, 90, -87,
+        20, 102, -97, 102, 51, -47, -63, -2, 97, 57, 123, 72, 71, -67, 52, 77,
+        122, -61, 108, -28, -12, 83, -105, 38, 119, -94, 120, -38, 19, -107, 81, 127,
+        85, -31, 48, -21, -91, -93, -84, 119, 7, 122, 109, 81, -118, -127, -43, 27,
+        -114, 113, -25, 77, 29, 81, -23, 126, -44, 67, 36, -24, -110, 97, -46, -53,
+        70, -67, -55, 61, 32, 68, 23, -116, -17, 4, -82, 123, -47, -59, -92, 34,
+        72, -107, -116, 70, -67, -47, -76, 55, 78, 49, 85, -89, -30, -11, -44, 47,
+        54, -5, -25, -4, -72, 18, -116, 77, -78, -31, 124, -110, -71, -60, 57, 64,
+        -61, -39, -16, 105, 52, -60, 36, -70, 120, -14, -47, 100, 56, 4, -92, 122,
+        -19, 100, -23, -60, -95, -40, 1, -103, 76, -58, -117, 100, -124, 40, 119, 32,
+        -78, -69, 52, 75, -25, -112, 3, 14, 0, -44, 73, -59, -121, 64, -71, 101,
+        -56, 108, 41, 104, -102, -99, -92, -35, -104, 63, 21, 67, 59, 42, 43, 102,
+        0, 0, 49, -110, 70, -123, 35, 107, 80, -68, 72, -117, -23, 98, 1, -104,
+        -128, 112, 63, -115, -97, -26, -104, 1, -96, 88, 88, -125, -47, 124, -127, -120,
+        -121, -91, 119, -117, -87, 29, -83, -102, 112, 88, 56, 23, -1, 46, 0, -47,
+        -80, 85, 48, -52, 75, -126, 119, 7, 97, -80, 75, 16, 97, 52, -78, -89,
+        -62, 35, 26, 3, -51, -57, -13, -69, -7, -52, 33, 28, -125, -28, -93, -7,
+        -45, 108, 6, -119, 119, -37, 41, -14, -89, 123, -121, 1, 24, -28, -23, -87,
+        -104, -36, -49, 49, 19, 28, -120, 52, 47, 102, 25, 98, 4, 6, -128, 54,
+        80, 51, -61, -23, 37, -80, 112, -54, 16, -105, -29, -50, -4, 1, 54, 91,
+        21, 37, 61, -15, -81, -2, -8, -76, -37, -98, -6, -57, 124, 43, -7, 116,
+        88, 61, 61, 28, -49, -57, 83, -79, -23, -65, -84, 122, -3, 124, 47, 28,
+        79, 95, 127, -24, -67, -5, -113, 98, -71, 43, 58, -1, -3, 95, -34, -11,
+        -2, 125, 55, -37, -99, 118, -67, 119, -1, 71, -79, -2, 84, -100, 86, -13,
+        -68, -13, 111, -59, 75, -15, -82, -9, -18, -33, -60, -25, -50, 127, 8, 92,
+        -30, -25, 63, -82, 102, -59, 33, 63, -83, 118, 91, -13, -27, 31, 14, -85,
+        124, -35, -85, 90, -22, -67, -5, 7, -119, 95, -8, -25, -11, -18, -48, -7,
+        -25, -51, -18, -65, 86, -17, -86, 86, -4, 15, -1, 113, -34, -52, 118, 107,
+        -37, 10, -84, 5, 8, -39, -20, -74, -69, -29, 62, -97, 23, 15, -1, -15,
+        -33, -2, 85, -4, -36, -1, -9, 98, -7, -78, -50, 15, -67, 127, 45, -74,
+        -21, 93, 79, 124, -54, -25, -69, -34, 63, -19, -74, -57, -35, 58, 63, -94,
+        94, 74, 112, -127, -3, -97, 118, 47, -121, -107, 112, -3, -1, 86, 124, 126,
+        -41, 43, -47, -107, -74, 127, -79, 42, -74, -89, -121, -11, 106, 91, -28, -121,
+        -14, -9, 15, -23, 93, -78, 40, -106, -67, -114, -32, 109, -2, 65, -14, -68,
+        83, -3, -107, 12, -46, -84, -53, 20, 117, -69, 70, 50, -69, -59, 89, 19,
+        -16, -108, 111, 86, -21, -13, -61, -89, -4, -16, -127, 18, -113, 7, 127, 92,
+        -3, 90, 60, -92, -121, 98, -29, 22, 124, 46, -108, 91, 24, 91, 7, -83,
+        74, 100, -65, -5, -49, -70, 36, 29, 100, -96, 100, 46, -7, -119, 93, 70,
+        -11, -99, -80, -68, -86, 112, -74, 4, 30, -33, 124, -95, 85, -49, 90, 43,
+        -37, 78, 57, 111, -64, 5, -82, 114, 86, 67, 87, -41, 83, 76, 20, 29,
+        -23, -120, -98, 116, -58, -87, 100, -18, 52, -21, -110, -80, 68, -97, -95, -11,
+        -61, -125, 10, -39, 69, 69, -128, -88, 57, 28, 77, -60, -97, 123, 59, 39,
+        58, -100, 86, -63, -114, -40, 126, 96, 72, -94, 27, 37, -128, 98, 31, -16,
+        -38, -96, -128, -10, -126, -49, -123, -48, 55, 97, 97, 116, 31, 86, -37, 103,
+        -95, 18, 39, 107, 55, -74, 31, 75, -26, -126, 57, 72, -11, -99, 116, -3,
+        -86, 120, 33, -88, -41, -125, -32, 65, 77, 123, -91, -106, -128, -30, -25, -35,
+        39, 97, 107, 44, -18, 60, -69, -101, -25, 116, -87, -103, 62, -12, -18, -18,
+        -28, 100, -64, -52, 28, 119, -117, -62, -42, -123, -13, -43, 103, -95, -125, -42,
+        -24, 99, 71, 97, 108, -37, -25, -43, -30, -12, -4, -112, -18, 95, -47, -41,
+        -29, -23, 44, 12, -98, 24, -68, 43, 12, 109, 91, 0, -45, 66, 88, -46,
+        23, -45, -12, -19, 113, -3, 50, -105, -125, 87, -55, 46, 17, 34, -45, -1,
+        13, -46, 82, -123, 76, 21, 57, -86, 95, -114, 15, -55, 96, 52, -51, -64,
+        -56, 2, 101, -3, -29, 70, 20, 15, -71, -46, -11, 82, -108, 114, -123, -81,
+        107, 52, 94, 81, -111, 40, 27, 50, 101, 67, 81, 86, 90, 5, -81, 26,
+        69, -128, 88, 37, -84, -41, 15, 89, 2, 16, -66, -10, -113, -49, -7, 66,
+        44, 1, -110, -114, -18, 96, 71, 118, -91, -29, 113, -92, 98, -120, -83, -95,
+        40, -106, 69, -118, -24, -114, 33, -34, -85, -103, 76, -119, -86, -110, 29, -70,
+        -95, 17, -39, 26, 85, 103, 37, 86, 97, -89, 7, -11, 119, 71, 84, -34,
+        -65, 118, -122, -30, 15, -33, -36, -45, 110, 46, 40, 62, -56, -47, -95, 53,
+        7, -119, 7, -108, -18, -124, 57, 95, -99, -50, -86, -36, 43, 4, -125, 91,
+        -116, -108, -114, 28, 42, -62, 82, -113, 122, -118, -34, -78, -91, -61, -90, -1,
+        41, 23, 26, 104, -75, 14, -50, -29, 65, 41, 86, 77, 15, 104, -75, 69,
+        72, -32, -116, 30, -107, 59, 26, -82, -64, -34, -100, 85, -91, -100, 20, -4,
+        114, -47, -86, 126, -100, -53, 79, 15, -14, -109, 111, -33, -31, 76, -63, -79,
+        -17, -23, 84, -40, -122, -69, 84, -4, -71, 119, 76, -68, -25, 20, -116, 125,
+        -62, 102, -51, 53, -15, -91, 99, 32, 76, -68, -25, 31, 72, 67, 47, 123,
+        -44, -111, 93, 18, 127, -35, -41, -38, 122, -81, -1, -40, -36, -61, 53, -100,
+        103, -18, -77, 97, 47, -69, -21, 77, -58, -68, -83, -9, -6, 18, 48, -9,
+        94, 79, -112, -59, 31, -50, 70, -55, 40, -93, 45, -2, 120, -44, 19, 54,
+        -33, 26, 103, 102, 117, 51, 41, -14, 59, 127, 110, -21, 0, -27, -45, 124,
+        62, 75, -125, -85, -101, 105, 54, -101, -34, -33, -15, -85, -101, 73, -79, 120,
+        122, -102, 4, 87, 55, 79, 79, -117, 124, -110, -121, 86, 55, -94, -81, -109,
+        -69, -89, -64, -22, -58, 93, -74, -70, -27, -48, -92, 19, -85, -101, 100, -108,
+        10, -81, 18, 88, -35, -92, -109, 116, -102, -34, -77, -85, -101, 36, 75, 103,
+        105, 74, -81, 110, -110, -47, -16, 110, -108, -80, -85, -101, -47, 104, 56, 77,
+        82, 110, 117, 51, -100, 39, -77, -92, 96, 86, 55, 80, 25, -35, -43, 77,
+        -102, -89, -117, 97, 18, 92, -35, 36, 119, -29, -95, -107, 28, -69, -70, 25,
+        -89, -29, -55, 56, -68, -70, 73, -98, -78, 116, 52, -28, 87, 55, -55, -35,
+        -12, -2, 62, 9, -82, 110, -18, -17, -89, -29, 100, 28, 90, -35, -120, -66,
+        38, -61, -5, -64, -22, -58, 91, -33, 58, -27, -112, 89, -111, 51, 32, 56,
+        68, -4, 57, -52, -35, 108, 118, -113, 74, -63, -48, 21, 22, 63, -99, -120,
+        -7, -117, 53, -43, -12, 28, 103, 116, 47, 6, 119, 86, 65, -63, 89, 78,
+        49, -71, -53, 102, 25, 53, 59, -127, -124, -122, 103, 39, -44, 18, -126, -13,
+        62, 112, 24, -77, -34, -57, 3, 114, -68, 15, 28, -90, 1, -17, -93, -63,
+        -34, -2, -48, 123, 120, -56, -97, -124, -15, 18, -1, -97, 21, 2, -66, -72,
+        40, -41, -67, -6, 85, 110, 88, -103, 42, -30, -53, -37, -33, 111, -118, -59,
+        42, -17, 124, -40, 31, -118, -89, -30, -96, 118, 41, 5, -107, 11, -79, 76,
+        83, -77, 77, -79, 62, -45, 37, -59, 118, 94, 116, 47, 106, -61, -12, 114,
+        -100, 31, 118, -21, 117, 127, 86, 60, -25, -97, 86, -94, -47, -29, 70, 124,
+        125, 126, 123, -109, -98, -25, 34, 70, -61, 114, -75, 125, 72, 30, -55, -59,
+        -110, -69, -116, -22, 62, 86, 107, 36, 2, 72, 126, 55, 32, 102, -75, 68,
+        0, -23, -110, -18, 35, 92, 58, 97, 48, 80, -46, 125, -44, -116, -62, 0,
+        -22, 91, -9, 81, 25, 54, -63, -44, -27, -42, 41, -81, 10, -70, -113, 51,
+        -79, 68, 95, 30, 118, 98, 30, -34, -89, 80, -51, -106, 66, 15, 62, 23,
+        -77, -113, 43, 99, 72, 37, 13, -3, 124, -15, 95, 47, 71, -79, -94, 75,
+        -110, -9, 85, 105, -66, 7, -109, 108, -115, 75, -23, -39, 62, 23, -20, 62,
+        -67, 61, 31, 44, 51, -43, -52, 44, 121, -60, 67, 74, 11, 81, 48, -38,
+        72, -13, -76, -37, 123, -45, 79, 53, -47, -22, 118, -12, 108, -36, -50, -85,
+        -60, 68, -23, 109, -16, -100, -10, 6, -49, 67, -15, 103, 36, -2, -116, -59,
+        -97, 76, -4, -103, -12, -60, 103, -15, 85, 124, 20, -33, -60, -89, -25, -119,
+        -23, -126, -62, -98, 60, -102, 95, 102, -69, -45, 105, -73, 121, -48, 19, 104,
+        40, -99, 76, 44, 26, -15, 10, 118, -24, -14, 27, -39, -121, -82, -22, -56,
+        115, 122, -87, -76, 96, -98, -81, -25, 31, 82, 51, -79, -17, -4, -48, 17,
+        -117, -32, 79, -97, -69, -91, -98, 110, 68, -13, 102, -31, 49, 76, -110, -3,
+        107, -9, -30, 97, 24, -86, 126, -67, -67, 73, -6, -98, -121, 4, -22, -95,
+        65, 61, -72, -81, -61, -20, 32, 24, 26, -68, -126, 61, 35, 2, -81, -63,
+        58, -87, -61, -22, 84, 79, 7, 83, -37, 97, -63, -12, -79, -113, 120, 104,
+        121, 49, 24, -43, -95, 118, 16, -92, 37, 43, -124, 44, 51, 84, -96, -104,
+        -16, -90, 100, 62, -71, -32, -115, -118, -73, 125, 72, -22, 10, 34, -97, -51,
+        14, 127, 58, -83, -124, -11, -1, -27, -126, -76, -99, 90, -87, 118, 22, -94,
+        102, -79, 120, -84, 5, -104, -65, 28, -114, 66, 87, -98, -117, -11, -2, -111,
+        -63, -38, 63, 126, 92, -19, -5, 50, -72, -78, -35, -119, 53, 112, -80, -12,
+        45, 95, 44, 14, -62, -87, 94, 124, 2, -116, -39, 81, 107, -43, -83, -80,
+        -90, -7, 26, -23, -83, 25, 99, 111, -69, 117, -17, 101, 125, -39, 11, 60,
+        82, 101, -41, -59, -45, 73, -21, -64, 98, -35, -45, 69, 117, 124, -38, -83,
+        59, 59, 9, -37, 121, -111, -32, 29, 85, -87, 83, -43, 51, -96, -55, -37,
+        -30, 116, -127, -29, 104, -102, -120, 79, -117, 11, 53, -36, -52, 55, -43, -105,
+        -28, 109, -74, -34, -51, 63, -2, -81, -105, -35, -87, 40, 13, 111, 71, -81,
+        -28, -34, 102, -67, -29, -23, -80, -37, 46, 17, -30, -39, 110, 45, 120, -2,
+        54, 56, 10, -118, -41, 61, -11, 55, 16, -2, 64, 44, -128, -92, 82, 8,
+        84, 31, 123, -14, 47, 75, -6, -61, 32, 85, 69, 1, -29, 7, -73, 11,
+        -70, 111, 98, 102, -48, 59, -66, -20, 47, -5, -35, 113, -91, 100, 125, 40,
+        -42, 66, 66, -97, 10, 96, -17, 7, 10, 35, 100, 123, -14, -8, 73, 78,
+        -73, -123, -38, 27, 43, 60, -53, -113, -123, 4, -112, -8, 46, -122, 13, 125,
+        -95, -70, -94, -109, 18, -69, 100, 123, 127, 32, 127, -53, 47, 96, 37, 80,
+        -10, 9, 79, 29, -70, 61, 92, 96, -20, 97, 47, -19, 118, 121, -43, 124,
+        -53, 31, -44, -36, -30, 66, -51, 69, 48, 62, 103, 14, -46, 21, 85, -73,
+        -69, -45, -121, 63, 61, 11, 7, -6, 75, 87, -1, 60, 95, -25, -57, -29,
+        47, -35, 30, 95, 100, -102, -61, -74, -34, -19, -98, -46, 110, 57, -91, -23,
+        125, -100, 45, 122, -62, 67, -9, -114, -7, 102, 127, -31, -9, 39, -53, 109,
+        82, -24, 112, 83, 57, -44, -59, -52, 96, -79, 58, -18, -41, -7, -7, 65,
+        41, -45, 99, -115, 74, 63, -54, -18, 61, -55, 32, 101, -2, 114, -38, 61,
+        122, -54, 35, 16, 118, 100, -49, -128, 90, 89, 42, 48, 77, -97, -123, -117,
+        -22, -49, 14, 69, -2, -47, -116, -64, 55, -89, -102, 70, -24, -6, -113, 106,
+        34, -41, -43, 40, 62, 31, -14, -3, -125, -62, -45, -105, -65, -65, -27, 63,
+        43, 60, -88, -79, 55, -63, 38, -84, -53, -46, -96, -38, -35, -93, -70, 38,
+        75, -65, 94, -29, -6, 77, -81, -16, 30, -107, 49, -76, -94, 3, 29, -40,
+        -119, -60, -111, -61, -45, 106, -7, 114, -16, 7, -15, 106, -77, -20, 29, 63,
+        45, 47, -50, -72, -40, -84, 22, -117, 117, -15, 118, -54, 103, 107, 65, 105,
+        -66, -41, -74, 111, -75, 40, 30, -76, -92, 30, -85, 73, -31, 58, -33, 31,
+        -123, 39, 49, 63, -68, 25, -32, -46, -90, 73, 49, 107, -61, 98, -65, 32,
+        107, -29, -112, -23, -84, -22, -47, -116, 73, 90, -92, -73, -45, -13, 5, 124,
+        66, -22, -85, 63, 89, -77, -66, -55, 79, -13, -25, -66, -103, -23, -100, 36,
+        -5, 122, -89, 69, -17, -12, 36, 3, -14, -89, 103, -15, -97, -104, 38, -12,
+        78, -121, 11, -102, -35, -30, -87, 15, -38, 106, 68, 123, -110, -55, -37, 58,
+        -97, 21, -21, 82, -79, 87, 91, 101, 101, -108, 126, -65, -51, 94, 4, 125,
+        -37, -117, -77, -109, 104, 62, 63, -88, -83, 38, 53, 32, -11, -113, -3, 79,
+        -85, -29, 74, 112, -71, 123, -39, -67, -100, 36, -106, 18, -76, -73, -38, -18,
+        95, 78, -67, -35, -2, 36, 85, 98, -33, 19, -106, -86, -104, -117, -50, 11,
+        90, 5, 85, 57, 61, 17, -74, 20, -8, -125, -125, 114, 63, -90, 33, -115,
+        89, 51, 86, 77, 16, -27, -4, 95, -37, -128, 63, -119, -103, 120, -15, -109,
+        -122, -5, -27, 98, -4, -25, 126, -73, -38, -118, -87, -1, -101, -87, 87, -115,
+        18, 51, -50, -12, -9, 7, -63, 29, -87, 63, -117, -117, -99, 24, -90, 111,
+        127, 90, -81, -114, -89, 95, -76, 61, 58, -99, -9, 114, -37, -22, 84, 88,
+        3, 85, 126, 56, -83, 54, 69, 95, -16, 50, 95, -93, 34, 97, 99, 78,
+        -49, -24, -53, -25, -94, -8, -120, 62, -56, -102, -30, 67, -87, 5, 2, 69,
+        33, -11, -87, -65, 95, -51, 63, 10, 105, -56, -45, 21, -13, -4, -76, 59,
+        -108, -94, -109, 84, -2, -35, 106, -77, -33, 29, 78, -71, -48, 20, -115, -58,
+        -48, -37, -45, -65, 9, 23, 95, -100, -20, 47, -62, 81, 108, 86, -30, 55,
+        35, 101, -37, 80, -66, -33, 23, -71, 96, -35, 92, -116, 16, 85, -126, 49,
+        105, -127, 91, -122, 116, 17, 98, -70, -52, -76, -29, 22, 26, 45, -62, 95,
+        93, -71, 8, -6, 55, -69, 95, -51, -82, -26, 106, -69, 21, -26, -66, 50,
+        11, 72, -73, -107, -116, 75, -115, 18, -3, 81, -21, 36, 99, 11, -124, -51,
+        40, -42, 11, -47, -59, 75, 53, 19, 76, 30, 43, 76, -91, 2, -38, -107,
+        -62, -37, -70, 88, 10, 118, 95, -124, -11, -50, 79, 106, -68, 62, -102, -7,
+        -93, 92, -106, -72, 21, -119, 89, 62, 63, 41, 37, -43, -105, -97, -88, -38,
+        -114, 120, 19, 85, 93, -16, -61, 31, 46, -13, -75, -112, -105, -74, 41, -107,
+        -70, -108, -54, 39, -16, -54, -33, -60, 2, 80, -78, -96, -57, 65, 104, 6,
+        41, -35, -33, -85, -91, 48, 13, -10, -68, 123, 57, -44, 96, 18, 36, -68,
+        -100, 10, -66, 88, -86, 126, 13, 10, 41, 70, -74, -16, 44, -125, -107, -86,
+        126, -91, 10, -128, 112, -91, 36, -3, -29, 94, 74, 69, 43, -74, 97, -75,
+        -12, -63, 70, -107, -113, 2, -59, -4, -7, 23, 107, -89, -6, -69, -89, 39,
+        -71, 65, -33, 31, -54, 0, -115, 63, 12, 100, 119, 84, -125, -96, 25, -115,
+        2, 76, 52, -88, -15, -93, 116, 18, 12, 97, -67, -91, -3, 89, -39, 115,
+        -61, 105, -110, -122, -89, -43, -70, -24, -65, -20, -123, -18, 45, 44, 17, 82,
+        -2, -43, 22, 17, 59, 84, 31, 30, 84, 93, 109, -74, 68, 99, -51, 106,
+        11, 126, 8, 59, 77, -5, -126, -43, -45, 33, -33, 20, -105, 114, -128, 28,
+        95, 54, 114, 55, -81, 4, -106, -26, -80, -65, 58, 73, 71, -120, -121, -16,
+        -2, -80, 91, -86, -91, 5, 55, 97, -3, -45, -77, 112, -47, -123, -80, -55,
+        -116, 33, 27, 8, -3, 94, -8, 11, 50, -76, -102, 30, -119, 85, -64, -64,
+        -44, -17, 19, 107, -28, -119, 93, -56, -114, -43, 26, -39, -83, -21, -82, -60,
+        67, 11, 71, -86, 21, -77, 116, -76, 69, -60, 74, 58, -77, 54, 96, -92,
+        -106, -46, -73, -24, 0, 108, 101, 60, 112, -70, 64, 44, -70, -77, 97, -39,
+        -123, -47, -115, -70, 0, 91, 25, -29, 14, 16, -117, -13, -79, -27, -63, 112,
+        48, -67, 81, 7, 96, 43, 35, -105, 7, 25, -47, -123, 97, -39, -123, -12,
+        70, 93, -128, -83, -116, 112, 7, 38, -75, -101, 53, -73, -24, -64, -124, -38,
+        -48, 81, -61, -15, 101, -85, 124, -29, 2, 47, -53, 101, 35, -57, 19, 116,
+        -101, 26, 90, 15, -9, 38, -80, 106, -68, -45, -26, -62, 3, -45, -114, 94,
+        44, -36, -124, 29, 124, 94, -83, -123, -85, 55, -66, 83, 29, 103, -43, -82,
+        -13, 109, -80, -38, -118, 53, -80, -80, 15, -57, -115, -65, -70, 113, 38, 117,
+        47, -46, 124, -50, -123, 17, 121, 27, 120, 75, 123, 98, -1, 2, 109, -27,
+        84, 21, 126, 6, 93, -14, -74, 26, 0, 92, 95, 78, -73, -117, 3, -36,
+        -59, -24, -89, 96, -109, -127, 110, 16, 45, -110, -52, -71, 73, 2, 107, -71,
+        -15, 44, -106, 12, 39, -71, 111, -2, -18, -1, -5, -65, -2, -17, -1, -9,
+        -1, 121, 39, -8, -79, 89, -10, -97, -42, 47, 43, -39, -73, -41, 62, -104,
+        -126, 64, -89, -90, -96, 78, -49, 47, -101, -39, 54, 95, -83, -85, -59, -101,
+        54, -109, 17, -101, -80, -58, -88, -121, -74, 68, 59, 110, 33, -71, -126, -93,
+        99, -6, -35, -57, 80, -25, -51, 114, -114, -42, 34, 93, -40, 23, 4, -110,
+        59, 60, 104, -76, -108, -48, 118, -31, 86, -73, 88, 117, -105, 104, 111, 3,
+        -55, -1, 92, -32, 60, -12, -86, 31, 53, -1, -31, -121, -11, 18, -2, -74,
+        65, 101, -57, 13, -4, -19, 117, -115, 126, 123, 93, -21, -67, -111, -91, 112,
+        -73, -14, 119, 51, -105, 123, -124, 31, -49, 98, -52, -7, 83, 77, 51, 74,
+        -108, 17, 41, -5, 111, -47, 116, 59, 127, -24, -56, 16, 46, 26, -71, 97,
+        80, 52, -10, -44, -18, 4, -36, 44, 83, -126, -15, 45, 79, 54, -99, 40,
+        -61, 67, 114, 73, -116, -40, 74, -54, -39, 88, -104, -88, 55, 2, -59, 116,
+        114, -57, -93, 112, 57, 9, 16, 78, -121, 12, -62, -5, -5, 33, -113, 48,
+        44, 40, -128, -2, 126, -62, -96, 47, -115, 109, 11, -4, 88, 17, -32, 0,
+        78, 57, -10, -120, -126, 27, 53, -25, -22, 29, 104, 125, -92, 121, -87, 3,
+        84, 122, -76, -54, 45, 33, 53, 95, -21, -65, -118, 5, -2, -93, -5, -15,
+        -72, -47, -78, -9, 10, 54, 11, 45, 81, -81, 96, -67, -44, -110, -15, 10,
+        -28, -127, 33, -59, 83, -65, 68, 22, 41, -6, -33, 6, -121, -35, -25, -72,
+        -111, 98, -83, -58, -45, -70, 120, 125, -108, 127, -23, -43, -69, -4, 11, -18,
+        -50, -87, -63, -48, 79, -123, -14, -69, 35, -30, -36, 117, 6, -125, 6, 29,
+        100, 4, -20, 107, 5, 91, 13, 49, 22, 84, 81, -15, -13, 31, 46, -86,
+        87, -57, -25, -125, -36, 106, 71, 67, -37, 49, -118, 95, 118, -92, -93, -112,
+        87, 73, -69, -76, 120, 107, -43, -61, -121, -76, -109, 116, -110, -9, -86, -45,
+        -46, 28, 30, -5, -46, 8, -104, -18, -85, 77, 54, 101, 37, 116, 127, -75,
+        -31, 46, 33, 83, 6, 76, -110, 5, -64, -122, 12, 88, -122, -96, 70, 12,
+        -44, 72, -52, 90, -53, 127, 96, -123, 49, 83, 97, -104, 65, -88, -116, -125,
+        66, -115, 79, 56, 74, 38, -125, -119, -3, 103, -6, 94, 113, 77, -15, 39,
+        -64, 29, 9, -110, -110, -27, 119, 3, 64, -122, 4, 27, -42, -76, 105, 91,
+        28, -15, 116, -54, -30, 113, 29, -33, 12, 92, 70, -62, -115, 83, -73, -71,
+        9, 47, 45, 89, 60, -91, -117, 61, -22, -18, 72, -72, -119, 71, -35, 61,
+        9, 55, -75, -44, -91, 9, -51, 76, -113, -68, -108, -26, -6, -67, 71, 95,
+        58, 12, 104, -83, -34, 18, 16, 18, -124, 3, 30, -47, 102, 32, -122, 8,
+        2, 11, -51, -128, -116, 16, -120, -110, -105, 41, 25, -93, 18, 44, 42, 3,
+        -110, 33, 16, 44, 37, 3, 50, 65, 32, 25, -24, -2, 20, -105, 80, -3,
+        -65, 67, 32, 19, -86, -1, -9, 8, 100, 10, -6, 47, -124, -126, -8, 67,
+        17, -112, 98, 30, 98, 57, 44, -5, 73, 111, -80, 124, -19, 39, -114, -71,
+        79, 108, -47, -39, 41, 58, -21, -94, 84, -43, 74, -35, 90, 118, 126, -81,
+        1, -50, 14, -64, 25, 2, 12, 21, -122, -95, -121, 1, -106, -97, -99, -14,
+        51, 40, 31, -87, -6, 35, -41, 77, -127, -46, -77, 83, 122, 46, 75, -57,
+        -86, -18, -104, 116, 113, -74, -4, -20, -108, -97, 65, 121, -90, -22, 103, 78,
+        -3, 17, 40, 61, 59, -91, 103, 93, 26, -102, -45, -83, -27, -108, -120, 118,
+        5, -57, 77, 3, 111, 32, -128, 35, 29, -126, -128, -116, -13, 9, 2, -80,
+        -79, 91, 16, 117, -30, 60, -125, 0, -116, 115, 14, 2, -80, -119, 127, 48,
+        76, -85, 113, 17, -110, 91, 113, 94, 66, 114, 43, -46, 81, 72, 126, -123,
+        125, -123, -28, 78, -92, -69, -112, -4, -119, -12, 24, -110, 67, 97, -89, 33,
+        32, 98, -3, -122, 0, -115, 117, 29, 2, -76, -58, 123, 72, 54, -57, 58,
+        16, 9, 27, -21, 67, 36, 108, -124, 27, 17, 96, -40, 82, 38, -80, -88,
+        -34, -55, 40, -39, -41, -6, 25, 37, 118, -50, -43, 40, -119, -41, 122, 27,
+        37, -20, 90, -121, -93, -28, -52, -7, 28, 37, -30, 90, -73, -93, -92, 91,
+        -21, 121, -108, 96, 57, -25, -93, 101, 90, -21, 127, -76, 56, 67, 46, 72,
+        74, 71, 89, 84, 37, 38, -62, 17, 25, -128, -77, 15, 112, 46, 1, 82,
+        -117, 33, -32, -108, 12, -40, -39, 7, 59, 59, 96, 67, -117, -115, 119, 80,
+        6, -22, -20, 67, -99, 49, -44, -56, -30, -30, -100, -107, -127, 57, -5, 48,
+        103, 8, 51, -74, 120, 120, -57, 101, -96, -50, 62, -44, 25, 67, 101, 22,
+        23, -25, -60, 12, -52, -39, -121, 49, -82, 44, -72, -71, -80, 22, 43, 83,
+        -58, -105, 109, 22, 13, 124, -103, 0, -114, -12, 101, 2, 50, -50, -105, 9,
+        -64, -58, -66, 76, -44, -119, -13, 101, 2, 48, -50, -105, 9, -64, 38, -66,
+        -52, 48, -83, -58, -105, 73, 110, -59, -7, 50, -55, -83, 72, 95, 38, -7,
+        21, -10, 101, -110, 59, -111, -66, 76, -14, 39, -46, -105, 73, 14, -123, 125,
+        -103, -128, -120, -11, 101, 2, 52, -42, -105, 9, -48, 26, 95, 38, -39, 28,
+        -21, -53, 36, 108, -84, 47, -109, -80, 17, -66, 76, -128, 113, -66, 76, 41,
+        64, -99, 47, 83, -78, -81, -11, 101, 74, -20, -100, 47, 83, 18, -81, -11,
+        101, 74, -40, -75, -66, 76, -55, -103, -13, 101, 74, -60, -75, -66, 76, 73,
+        -73, -42, -105, 41, -63, 114, -66, 76, -53, -76, -42, -105, 105, 113, -122, 124,
+        -103, -108, -114, -78, -83, 74, 76, -124, 47, 51, 0, 103, 31, -32, 92, 2,
+        -92, 22, 67, -64, -105, 25, -80, -77, 15, 118, 118, -64, -122, 22, 27, -17,
+        -53, 12, -44, -39, -121, 58, 99, -88, -111, -59, -59, -7, 50, 3, 115, -10,
+        97, -50, 16, 102, 108, -15, -16, -66, -52, 64, -99, 125, -88, 51, -122, -54,
+        44, 46, -50, -105, 25, -104, -77, 15, -61, -5, -78, 106, 95, 123, -35, 95,
+        47, 25, 95, -74, 94, 54, -16, 101, 2, 56, -46, -105, 9, -56, 56, 95,
+        38, 0, 27, -5, 50, 81, 39, -50, -105, 9, -64, 56, 95, 38, 0, -101,
+        -8, 50, -61, -76, 26, 95, 38, -71, 21, -25, -53, 36, -73, 34, 125, -103,
+        -28, 87, -40, -105, 73, -18, 68, -6, 50, -55, -97, 72, 95, 38, 57, 20,
+        -10, 101, 2, 34, -42, -105, 9, -48, 88, 95, 38, 64, 107, 124, -103, 100,
+        115, -84, 47, -109, -80, -79, -66, 76, -62, 70, -8, 50, 1, -58, -7, 50,
+        -91, 0, 117, -66, 76, -55, -66, -42, -105, 41, -79, 115, -66, 76, 73, -68,
+        -42, -105, 41, 97, -41, -6, 50, 37, 103, -50, -105, 41, 17, -41, -6, 50,
+        37, -35, 90, 95, -90, 4, -53, -7, 50, 45, -45, 90, 95, -90, -59, 25,
+        -14, 101, 107, -69, 59, -88, -60, 68, -8, -78, -75, -35, 35, -12, 0, -50,
+        37, 64, 106, 49, 4, 124, -39, -38, -18, 23, 122, 96, 103, 7, 108, 104,
+        -79, -15, -66, 108, 109, -9, 14, 61, -88, 51, -122, 26, 89, 92, -100, 47,
+        91, -37, 125, 68, 15, -26, 12, 97, -58, 22, 15, -17, -53, -42, 118, 79,
+        -47, -125, 58, 99, -88, -52, -30, -30, 124, -39, -38, -18, 47, 122, 48, -68,
+        47, 3, 65, -44, -75, -116, -124, -46, -50, -20, 117, -35, -64, -103, 9, -32,
+        72, 103, 38, 32, -29, -100, -103, 0, 108, -20, -52, 68, -99, 56, 103, 38,
+        0, -29, -100, -103, 0, 108, -30, -52, 94, -93, -30, 80, -81, -47, -95, -88,
+        -41, -8, 104, -44, 107, 109, 64, -22, 53, 62, 38, -11, 26, 31, -106, 122,
+        -83, -115, 76, -67, -58, 7, -89, 94, -29, -29, 83, -81, -75, 33, -86, -41,
+        6, 81, -86, -41, 6, -127, -86, -41, -72, 88, -107, 0, -29, -100, -103, 82,
+        -128, 58, 103, -90, 100, 95, -21, -52, -108, -40, 57, 103, -90, 36, 94, -21,
+        -52, -108, -80, 107, -99, -103, -110, 51, -25, -52, -108, -120, 107, -99, -103, -110,
+        110, -83, 51, 83, -126, -27, -100, -103, -106, 105, -83, 51, -45, -30, 12, 57,
+        51, 41, 29, 101, 92, -107, -104, 8, 103, 102, 0, -50, 62, -64, -71, 4,
+        72, 45, -122, -128, 51, 51, 96, 103, 31, -20, -20, -128, 13, 45, 54, -34,
+        -103, 25, -88, -77, 15, 117, -58, 80, 35, -117, -117, 115, 102, 6, -26, -20,
+        -61, -100, 33, -52, -40, -30, -31, -99, -103, -127, 58, -5, 80, 103, 12, -107,
+        89, 92, -100, 51, 51, 48, 103, 31, 38, -32, -52, -58, -48, -103, -15, -34,
+        -84, -103, 59, 107, -32, -49, -30, 29, 90, 43, -113, 22, -17, -46, -30, 125,
+        90, 83, -89, 22, -23, -43, 26, -72, -75, 38, 126, 45, -62, -79, 53, -15,
+        108, 77, 92, 91, -124, 111, 107, -30, -36, -102, 120, -73, 8, -9, -42, -56,
+        -65, 53, 114, 112, -79, 30, 46, -28, -30, -30, 124, 92, -92, -109, 11, 123,
+        -71, 72, 55, 23, -23, -25, -62, -114, 46, -46, -45, 69, -70, -70, -80, -81,
+        -117, 117, 118, 17, -34, -82, 114, 119, -84, -65, -85, 28, 30, -21, -15, 42,
+        -105, 87, -29, -13, 42, -89, 87, -29, -11, 42, -73, 23, -10, 123, -107, -29,
+        11, 123, -66, -54, -11, -123, 124, 95, -27, -4, 66, -34, -81, 114, 127, 97,
+        -1, 87, 57, -64, -80, 7, -84, 92, 96, -56, 7, 86, 78, -112, -11, -126,
+        3, 125, 123, 86, 103, 121, -110, 63, -38, 84, 47, -25, -67, -68, -107, -87,
+        -114, -20, 63, -126, -46, -39, -110, 45, 50, 119, -96, 78, -7, -119, -85, -55,
+        -106, 5, -18, 17, 35, 12, 84, -106, 17, 80, 14, 111, -55, 50, -121, -38,
+        1, 120, 62, -105, -119, 108, 36, 86, -112, 111, 4, 2, 28, 79, -121, -43,
+        -66, 88, 68, -10, -50, 66, 11, 124, 94, -6, -73, -52, 105, 88, -26, 0,
+        -120, 68, 107, -128, 9, -84, 41, -126, -125, -103, -125, -22, 112, 106, 88, -86,
+        -93, 50, 115, 25, 58, -57, -22, -35, -128, 112, -82, 122, -99, 118, -5, 71,
+        -102, -17, -66, 76, -70, 70, -37, 126, 86, 23, 70, -52, 81, -2, -18, -49,
+        127, 16, -13, -121, -14, 98, -125, -66, -110, 78, -35, -70, -10, -108, -84, 71,
+        22, 73, -19, 36, 75, -70, -35, -48, -43, 117, -85, 97, -27, -75, 7, 77,
+        -77, -103, 25, -46, -41, 39, 30, 65, -94, 66, -101, 1, 80, -2, 123, 47,
+        -2, -39, -65, 118, 60, -36, 116, -73, -51, -120, 114, 63, -105, -38, -39, -19,
+        -106, 124, 83, 55, -60, -35, -53, 118, -10, -98, -87, -123, -111, 119, -58, -67,
+        11, 121, -118, 24, 3, -46, 87, 55, -75, -5, -117, -43, -89, -107, -96, -27,
+        2, 18, -25, -32, -29, -58, -8, -86, -56, 31, 58, 67, 123, 95, 100, -2,
+        114, -112, 67, 69, 113, 80, 120, 121, 115, -15, 94, 32, -64, -105, -16, -59,
+        7, -37, -30, 113, 19, -110, -71, -66, -72, 101, 45, 57, -44, -101, 98, -31,
+        -42, -69, -96, 43, -18, 76, 95, -109, 58, 44, 46, -98, -92, 67, 99, -62,
+        120, -42, -59, -15, -56, 99, 66, 10, -109, 112, 53, 31, -98, 86, -121, -22,
+        -98, 84, -59, 123, -73, -98, -79, 38, 90, -28, 63, -97, 14, 15, -14, 106,
+        -19, -18, 73, -87, -54, -121, -35, 98, 33, 89, 65, 27, 109, 71, -113, -112,
+        17, -21, 82, -90, -100, -87, 32, 19, -104, 12, 60, 28, 47, -101, -83, -53,
+        -125, -45, -31, 103, -43, 59, 69, -45, -121, -31, -74, -5, -11, 58, -90, -115,
+        -29, -123, 113, 66, -34, -120, -86, -52, 110, -105, -12, 76, 116, 5, -48, -98,
+        50, -100, -107, 76, -12, -81, 127, -120, 108, 31, 88, -24, -88, -26, -83, -107,
+        46, 91, 55, 89, -10, -68, -26, 64, -102, -30, -46, 81, -94, 116, -22, -124,
+        123, -4, 78, -104, -62, -103, -51, 87, -24, 57, -80, -17, -26, -39, 98, 106,
+        31, 118, -96, -100, -95, -37, 98, -27, -91, 8, -60, -56, -33, -71, 53, 75,
+        95, -12, -35, -20, 105, -111, 22, 115, -50, -89, -87, 122, -68, 75, -24, 54,
+        -10, 66, -43, 29, -79, 56, -122, -62, -12, -13, 20, 67, -25, -77, -7, -36,
+        38, -32, -10, 25, -70, -104, 46, -18, 108, 46, -8, -122, 12, -11, 17, 71,
+        50, 116, -111, 46, -122, -117, -15, 87, 100, -88, -50, -34, 24, -57, 78, -104,
+        -82, -97, -44, -49, -7, 34, -103, 79, 89, -3, -100, 46, 102, -117, -106, -6,
+        -23, 33, -114, 100, -25, 60, 93, 76, -26, 95, 81, 63, 101, -90, -53, -40,
+        -79, 94, 61, 111, 64, -113, -11, -59, -68, 24, -15, 99, -67, -72, 43, -98,
+        90, -114, 117, 23, 113, -12, 88, 23, -61, -23, -2, -21, -15, -46, 100, 5,
+        -115, 99, 39, -52, -14, 77, -79, -77, -104, 44, 102, -77, 123, -114, -99, 79,
+        -61, 98, 58, 31, -75, 98, -89, -113, 56, -110, -99, -59, -68, 72, 103, -59,
+        -41, 99, -89, -50, -96, 26, -55, 77, -16, 124, 6, -59, -51, -59, -45, 124,
+        56, 31, 115, -36, 44, -124, -19, -101, -73, 83, 78, 31, 113, 44, 55, -77,
+        -7, 116, -98, 127, 61, 110, -86, -124, 113, -79, -52, 4, 105, -8, 73, 102,
+        22, 73, -111, -14, -52, 44, 22, 69, -47, -110, -103, 46, -30, 104, 102, 22,
+        -109, 98, -6, 53, 85, -13, -16, -111, -32, -27, -109, 51, 23, 114, -46, -123,
+        83, -68, 28, 77, 71, -77, 17, -21, -48, -121, -13, 81, 50, 26, 7, 120,
+        -23, -76, 8, 120, -23, 35, -58, -68, 116, 106, 86, -68, 28, 13, 71, -39,
+        -120, -73, -102, -78, -34, 77, 121, 121, 40, -114, -5, -35, -10, 40, -89, -40,
+        54, -33, 93, -1, 85, -33, 41, -73, -103, 102, -54, -17, 58, 29, -82, 92,
+        -49, -99, 118, 47, -13, -25, 42, -68, 82, -35, 28, -97, 102, -125, 123, 125,
+        -116, -37, 69, 47, -17, 39, 53, 110, -127, 104, 98, 58, -103, -78, 77, 108,
+        22, 55, 105, -30, -2, 62, 101, -101, 88, 47, 111, -46, 68, -102, -34, -33,
+        -77, 109, -68, -82, 111, -45, -58, 40, -44, 70, -85, 70, 6, 42, 33, -77,
+        -50, 57, 71, 100, 116, -48, -15, 0, 0, 3, -109, -17, -87, -99, -121, 42,
+        -125, 10, -67, 26, -17, -70, -39, -7, 34, 107, 57, -71, 63, 106, -46, -50,
+        -91, -125, -52, -19, -86, 20, -84, -33, -37, 54, 125, -83, -87, 67, -28, 51,
+        113, 122, 34, 6, -118, -33, -109, 97, -101, -82, 12, -93, -5, 50, -48, -103,
+        34, -115, -128, 101, -82, 22, -104, 43, 5, -90, 108, 106, -108, -111, 67, 97,
+        -109, -87, 12, -124, 30, 57, -39, 55, -119, -124, 108, 86, -52, 3, 55, 91,
+        101, -22, 38, -116, 26, 123, -71, 118, -78, 80, -70, -21, -104, 36, 42, 0,
+        100, -67, -38, 63, 84, -4, 124, -67, 38, -63, 10, -109, 86, -20, 81, -27,
+        -59, 115, 63, -70, -65, -57, 101, 103, 81, 59, -37, 58, -9, 44, 108, -69,
+        51, 72, -77, 99, -89, -56, -113, 114, -107, -47, -33, -67, -100, 122, -43, 86,
+        -90, 87, 86, -105, 29, 93, -1, 42, -20, 8, 18, 40, 104, 89, 37, 23,
+        -62, -14, -42, -55, -38, 100, 66, -77, 95, 74, 75, -13, -96, -109, -123, -79,
+        -128, 78, 62, 65, -99, 80, -15, 80, -120, 62, 111, -41, -25, 95, -68, -4,
+        -126, 8, -115, 78, 99, 121, -71, 82, 13, -48, -12, -32, 110, 50, -101, 62,
+        21, -113, 101, 66, -52, 71, -4, 108, -115, -8, 23, -66, 61, 83, 61, 104,
+        -44, -109, 79, -76, 56, -67, 67, -7, -16, -6, -71, -24, -125, 74, -118, -9,
+        41, 95, -65, 20, 32, -81, -31, 93, -74, 127, 125, -84, -76, -70, 76, 81,
+        36, -73, 13, 121, 124, 101, 126, 61, 103, -112, 85, -23, -23, -36, -54, 82,
+        -1, 4, -32, -68, 120, 86, -119, -110, 47, 117, -7, 79, -85, -44, -103, 14,
+        -90, 91, 32, 41, 19, 116, -14, 18, -126, 15, 106, 4, 122, 19, -56, -63,
+        -57, 88, 25, -61, -34, -66, -3, -36, 55, -33, -85, -4, -83, -54, 12, 22,
+        -37, -59, 3, -86, 97, -77, 99, -127, -126, 86, -86, 7, -34, 93, 17, 86,
+        92, 43, 118, -65, -8, 84, 108, 79, 71, 100, 5, 26, 38, -122, -75, -65,
+        86, -67, -84, -117, 115, -96, 44, -79, 85, 86, -14, 106, -116, 115, 102, -59,
+        33, -115, 50, 60, 45, -51, -46, -29, 111, -38, -70, -85, 91, 100, 110, -58,
+        -65, 105, 85, 19, -83, -6, 109, -27, -39, -58, -55, 5, 77, 10, 49, 72,
+        116, -78, 126, -57, 49, -58, 40, 82, -40, -103, -22, 56, 68, -115, 123, 12,
+        -10, 53, -46, -76, -74, 106, -106, 36, -88, 85, -125, -46, 39, 73, 101, 125,
+        61, -59, 79, 23, 19, 111, -10, 127, -51, -44, 16, 30, 20, 48, 19, 63,
+        61, -61, -13, 11, 106, 35, -108, 52, 101, 102, -94, 82, -91, -39, 102, -32,
+        -16, 103, -103, 62, 44, 6, 14, -84, 30, 14, -26, -83, 1, -100, 19, -14,
+        -51, -125, -105, -77, 15, -61, 45, -101, 108, 84, 39, 60, 54, -53, -121, -70,
+        -104, 113, -9, -47, -115, -13, 18, -53, 5, -107, -52, 48, 98, 66, 43, 58,
+        -44, -11, -70, 24, -25, -40, 97, -29, -91, 1, 30, 26, -5, -53, -102, 95,
+        -50, -6, -126, -11, 16, -20, 72, -40, 11, 124, -15, 46, -120, 101, 42, 39,
+        -82, -76, -79, -76, -54, 103, 23, -3, 85, 105, -100, -84, -42, -34, -8, 93,
+        47, -29, 100, 85, 53, 93, -78, 73, 115, 41, 101, -104, -108, -46, 60, 74,
+        41, 22, -43, 73, -23, -90, -115, -37, -84, -27, 120, 109, -60, -114, -87, 105,
+        -20, -96, -94, 17, -33, 100, -68, 50, -88, 111, -96, 91, -114, 40, -108, 73,
+        -67, -104, -61, -75, -110, -121, -41, -79, -60, 53, -3, 84, 107, -41, 44, 33,
+        13, 6, -67, 58, -126, -7, -66, -53, -60, -39, 85, 98, -21, -72, -43, 57,
+        -125, -97, 72, 41, 126, -45, 38, 60, -107, -71, 78, 93, 106, 91, 16, -102,
+        115, 3, -83, 49, -49, 56, 84, 47, -65, -23, 15, -14, -12, -60, 106, -77,
+        124, 120, 57, -84, 63, -68, -109, -113, -115, 62, -84, 54, -7, -78, -8, -15,
+        -8, 105, -7, -61, -21, 102, -35, 123, 63, -102, -117, 31, 59, -30, -57, -19,
+        -15, -89, -17, -97, 79, -89, -3, -61, -113, 63, 126, -2, -4, 121, -16, 121,
+        52, -40, 29, -106, 63, 14, -109, 36, -111, -64, -33, 119, 62, -83, -118, -49,
+        -1, -72, 123, -3, -23, 123, -11, -20, -56, 68, -4, -9, -3, -5, 81, 33,
+        -22, -17, -13, -45, 115, 71, -40, -116, -11, 79, -33, -53, -55, -41, -9, 29,
+        -7, -94, -48, -57, -30, -89, -17, -33, 15, 71, -6, -51, 63, -5, 73, 61,
+        -79, 54, -49, -9, 63, 125, -81, 38, 13, -24, -13, 127, 9, -99, 114, -65,
+        43, 50, 127, -6, 126, -8, 125, 103, -15, -45, -9, -101, 97, 39, -21, 76,
+        -28, -65, -3, -55, -9, 63, -22, -90, 101, -49, -60, 79, -17, -70, -113, -47,
+        19, -98, -95, 117, 51, -33, -58, 126, -103, -110, 6, 124, -122, -57, -107, 28,
+        120, -113, -56, 45, 20, 10, -44, -109, 28, 71, 8, 15, -59, -66, -56, 79,
+        -14, 73, 62, -3, 19, 44, -85, -34, 89, -110, -124, 88, -37, 33, -49, -47,
+        21, 7, 8, -89, -7, 48, -39, -65, 118, 82, -103, -56, -12, -117, -25, 72,
+        -66, -59, 46, -36, 85, -69, -123, -51, 86, 55, -10, -91, 21, 122, -47, 97,
+        -34, 77, -47, -13, -44, -37, 111, -119, 105, -12, 127, -38, -68, -84, 79, -85,
+        -3, -70, -8, -91, -121, 62, 75, -55, -103, -105, 89, -28, -113, 63, -67, 75,
+        -33, 9, -77, -115, -25, -76, 70, -29, 61, 37, 4, -85, 45, -9, -19, -105,
+        102, -53, 17, 83, -69, 122, -66, 68, -66, -55, 124, -15, 87, 8, -6, -31,
+        67, 72, 62, 53, -96, 16, 82, 119, 127, -33, -52, -73, -36, 87, -119, -16,
+        87, 53, 117, -65, -47, -76, -38, 116, -61, 9, 120, 4, -34, 70, 66, -99,
+        -72, 118, -70, 72, 61, 23, -35, -7, -106, -19, -65, 126, -89, -6, -53, -37,
+        127, -21, 101, -97, -117, -7, 71, -9, -91, -78, 106, 86, -106, 82, 34, 1,
+        -5, -60, -91, -28, -46, 33, -100, 33, 73, -92, 29, -16, 115, 95, -67, -23,
+        4, 31, -56, -127, -9, 65, -6, 10, 35, -84, 43, -84, -55, 39, 97, 84,
+        10, 103, 28, -22, -106, -99, 55, 7, -64, 35, 88, 10, -118, -62, -61, -10,
+        69, -43, -64, 57, -99, -5, -120, 62, -68, -120, 5, -11, 43, -75, -47, 95,
+        -55, -85, 4, -58, -85, 86, 51, -47, -76, -62, 108, 6, 35, 115, 0, -98,
+        53, 31, -88, -55, 90, -57, 104, 1, 117, 97, 115, -73, -57, 120, 58, -109,
+        46, -4, 55, 11, 85, -39, -54, -5, -125, 76, 6, -82, -25, -75, -26, 41,
+        -40, -30, 53, -97, -101, 39, -15, -16, 39, 14, -42, -105, -83, -114, 16, -87,
+        15, -62, -35, -4, 114, -15, 30, -98, 115, -108, 21, 84, -110, 48, 59, -73,
+        -122, -70, -94, -27, -62, 63, -104, -109, -58, -62, 12, -56, 71, 29, 102, 74,
+        -7, -74, -59, -15, -8, -31, 62, 121, -33, 37, -32, -65, -108, 123, -124, 109,
+        -88, -97, 41, -17, -11, 93, -78, -104, 20, 79, 11, 39, 96, -91, 63, -14,
+        120, 92, 70, 114, 122, 121, 107, 91, 59, -108, -1, 69, -40, -38, -89, -89,
+        -89, 43, 13, -19, 72, 27, 90, 97, -37, -109, -50, 72, -4, 91, 103, 105,
+        41, -2, 24, -99, -7, 26, -52, -23, -113, 59, -30, -65, -69, -50, -99, 97,
+        -50, 124, 117, -104, -81, -117, -50, 65, 121, 12, -51, 36, -61, -106, 122, 34,
+        28, -31, 62, -84, -74, -117, 66, 104, -78, 112, 30, -7, -87, 104, -90, 65,
+        -113, 127, -87, -118, -15, -81, 82, 49, -98, -17, 98, 84, -94, -100, 57, 82,
+        -31, 19, 99, 36, -44, -49, -27, 115, -45, 89, 0, -53, -97, 97, -111, 58,
+        -25, -47, -13, 5, 104, -127, 127, -15, -95, -19, -66, -59, -94, 120, -54, -59,
+        -68, -39, 111, -12, -8, 121, 37, 119, 17, -16, 19, -66, -64, -115, -21, -14,
+        78, -56, 111, 106, 16, -23, 56, -65, -118, -122, -113, -84, -122, 75, 91, -8,
+        126, 120, 7, 46, -87, 13, -77, -9, -61, 123, 127, -123, 108, 46, 114, 59,
+        -109, -127, -66, 34, -77, 118, 69, 106, -119, -21, -110, 126, 85, 98, 42, -105,
+        -111, -56, 89, -56, -26, -32, -22, -50, -81, 124, 101, -92, -119, -107, 12, -73,
+        58, 99, -32, -115, 67, -6, -19, -27, 41, -58, -85, -10, -125, -36, 48, 99,
+        41, 32, -36, -99, -77, -32, 55, 34, -6, 38, -120, 12, -104, 101, -35, -85,
+        -6, 9, -12, -112, -104, 64, -41, -95, 32, 52, 5, -49, -105, -121, -75, -13,
+        101, -11, 84, 24, -11, 102, 19, -98, 121, -21, -51, -11, -39, 105, 107, 86,
+        37, -91, 44, -14, -103, -104, 74, -66, -100, -118, 71, 117, 86, -22, 32, 22,
+        105, 31, -110, -98, -6, -105, -116, 54, 3, 28, -91, 65, -4, 65, 126, -21,
+        85, 5, -107, -15, 83, 37, -15, 86, 119, -110, 5, -41, -108, -100, -86, -87,
+        109, 98, -93, 111, 93, -16, 14, 110, -9, -37, 49, -120, -61, 44, -21, 117,
+        -86, -65, 56, -77, 104, 100, 123, -112, 7, -10, 47, -2, 59, 93, 120, -59,
+        40, -89, -92, -95, -112, -25, 85, 91, 80, -96, 35, 76, -112, 19, -108, -127,
+        -41, 56, -41, 43, 117, 69, 82, -66, -127, 118, -15, 38, -52, -23, -2, -75,
+        35, -49, 61, -9, 98, -25, -49, -72, 13, -39, 111, -11, -27, -58, -8, -31,
+        -45, -74, -126, -54, -14, -106, -83, 67, 42, 77, -92, -111, 18, -120, -120, -64,
+        8, -109, 126, -19, -99, 121, -1, 13, 79, -37, -86, 35, 25, -58, 91, -95,
+        8, 22, -19, -74, -66, -28, 41, -99, 47, -39, 12, -89, -102, 87, 109, -124,
+        -122, -92, 20, 123, -68, -93, 94, -32, 118, 109, -23, 75, 115, 54, 89, -116,
+        -97, -118, 32, -122, -61, -53, 118, -85, -114, 111, -117, 118, -123, 17, -10, 71,
+        56, -68, 75, 15, -57, 50, 14, 117, -59, -98, 22, 66, -21, 1, -30, -48,
+        3, 80, 52, 98, 64, -64, -95, -58, 104, 121, 59, -107, -106, -56, -1, -62,
+        -12, -7, -26, -69, -6, -100, 32, 92, -26, -59, 104, -79, -125, -93, -95, 6,
+        -125, -38, -33, -76, -46, -122, 22, 121, 36, 32, -25, -75, 34, -94, 11, 40,
+        22, -32, 97, -11, -4, 84, 83, -116, 106, -1, 84, 70, 41, -86, 25, 115,
+        -79, -50, -91, -48, 28, -128, -97, 81, -20, -74, 23, 42, -84, 14, 25, -47,
+        96, 102, -57, 30, -58, 126, 71, -15, -89, -122, -36, -61, 6, 13, -86, 58,
+        15, -19, 102, 46, -119, -26, -6, -119, 55, 95, -107, -82, 53, 121, 52, 27,
+        -43, -65, -10, -27, 22, -55, -21, -61, -80, 52, 79, 48, -38, -102, -126, -48,
+        -86, 115, 126, 29, 110, 113, 31, 79, -7, -63, -60, -127, 74, -88, 98, 45,
+        -90, -59, -57, -43, -15, -15, -13, -13, -22, 84, -12, -123, 46, -86, -31, -84,
+        -34, 53, -28, 15, 99, -122, 119, 109, 81, -44, -55, 62, -93, -37, -33, -119,
+        -119, -70, 60, 28, -34, 65, 103, 43, -51, -36, 88, -104, 28, 108, -115, -54,
+        122, 110, 73, 51, 51, -29, 112, -103, 49, 36, 87, -87, -37, -123, -112, -62,
+        91, 92, 85, -1, 112, 123, -80, 77, -10, 44, 60, 96, 120, 116, -53, -15,
+        -115, -34, -92, 61, -75, 106, 113, -69, 47, -4, -51, -18, -13, -74, 27, 110,
+        63, 84, 19, -123, 5, -19, -29, -21, 94, 100, 112, 50, 108, 34, 19, 53,
+        79, -18, 53, 33, -85, 41, 69, -11, 45, 112, 120, -65, 4, -67, -27, 92,
+        -11, -27, -76, -109, 107, -70, 112, -57, 92, -24, -21, 123, 100, 12, -13, -83,
+        40, 11, -22, -53, -97, -51, 6, -91, -46, 98, -75, 110, 34, 98, -32, 125,
+        81, 32, 36, 56, -55, -70, -107, -11, 122, 56, 10, 67, 95, 124, 24, -36,
+        101, 93, 109, -34, -124, -69, 42, -2, -25, 7, 125, 24, 15, 124, -6, 31,
+        31, -60, -36, 73, 126, -118, -28, -2, -97, -31, -2, 106, 72, 93, 98, 0,
+        25, -91, 9, 85, -43, -52, -1, 70, -40, 18, 33, -70, -121, -121, -4, 73,
+        46, 96, 125, 119, -87, 82, 94, 105, 27, -100, -104, -45, 70, -91, -41, -20,
+        -89, -8, -98, 82, -7, -6, -7, -69, 6, 23, -83, -94, -114, -74, -59, -55,
+        -37, 80, 17, 45, -10, 40, -8, -96, -12, -125, 24, -96, 18, -4, 62, 25,
+        -20, -103, -91, 111, 116, -96, 95, -102, -100, -58, 47, 81, 86, -111, 25, 72,
+        -43, 119, -109, -7, 52, -101, 46, 106, -128, -83, 60, -93, -49, 20, -87, 45,
+        71, -99, -108, -51, -97, -98, 7, -97, -63, 86, -109, -52, -66, -104, 69, 110,
+        -114, 98, -86, 121, 40, 78, -13, 103, -108, 91, 21, 96, 118, 39, 90, 126,
+        -111, -91, -121, 42, -77, 30, -61, -21, -99, -55, -112, -100, -94, -68, -82, -17,
+        31, -85, 43, -117, 73, -96, 23, -42, 45, -13, 125, -47, 16, 2, -43, -23,
+        121, -75, -27, 59, 102, -10, 19, -19, -40, -56, 80, -101, 29, -77, 99, -20,
+        118, -67, -100, -32, -5, -48, 65, 124, 125, 116, 1, 69, -119, 5, -54, -63,
+        -60, 32, -66, -8, -75, 101, -80, -54, 48, 77, 18, -21, -119, 70, 11, -28,
+        47, 119, 0, 18, -13, 111, 45, -122, -84, -38, -34, 119, 63, -78, 26, 90,
+        -107, 106, 121, -5, -123, -98, 124, 110, 124, -115, 1, -30, 63, 110, -120, -2,
+        -53, -113, 124, -1, -53, 82, -86, -1, -78, -112, -17, -1, -83, 46, -51, 68,
+        -77, -45, -23, -85, 19, -109, -46, -71, 101, 1, -68, -14, -126, -125, -25, -4,
+        40, 111, 43, -81, 22, -71, -50, 9, 56, 88, 28, 118, -5, -123, -16, -122,
+        98, 118, -71, 92, -82, 11, -107, 32, 112, -99, -37, -52, -121, 31, -74, 63,
+        -116, -70, -67, 8, 52, -40, 26, 40, -121, 91, 97, -23, 6, 88, 126, 13,
+        62, -126, 43, 52, 58, 15, -127, 6, 115, 104, 119, -65, 110, -118, -19, -117,
+        -7, -122, -70, -125, -46, 65, 42, 110, 87, 119, 35, 113, -114, 73, 92, -120,
+        -60, -31, -12, 49, 66, 16, 99, 44, 8, 15, -127, -61, 50, 95, -114, 1,
+        41, -76, 70, 70, -120, -64, -59, 69, -43, -2, -19, -7, 79, 100, -7, -28,
+        -101, 87, -44, -120, -26, 118, -14, -84, 51, -6, -10, 84, 20, 11, 105, -68,
+        -51, -57, -43, -106, 2, -75, 95, 75, 96, -108, -73, 59, -68, 79, -42, 79,
+        75, -37, 45, -55, -107, 53, 56, 106, 81, -39, 91, -56, 91, 123, -92, -57,
+        -49, 58, -40, -70, -58, 10, -75, -21, 43, -26, 79, -23, -76, -43, -66, -102,
+        -97, -26, -72, 65, 54, 19, -43, 53, -115, -35, -18, -77, 34, 9, 49, -69,
+        -117, -86, -75, 114, 90, -15, -120, -6, 3, 114, -13, -96, 123, 29, -2, -83,
+        65, -35, -47, -108, -10, 8, 32, 23, 84, 96, 6, -86, 51, 53, -58, -69,
+        111, 51, -14, -2, -20, 112, -76, -25, -107, 24, -6, 123, -125, -49, -43, 104,
+        45, 22, -99, 7, -90, 122, 8, -54, -78, 18, 29, 119, -58, -41, -115, -54,
+        -26, 93, 76, 120, -98, -87, -66, 95, -24, -12, 87, 64, -110, 120, 102, -125,
+        -3, 30, 113, 41, -115, 56, -50, 123, -29, 3, 112, -43, 57, 0, 112, -4,
+        -19, -3, 112, -108, -34, 11, 97, -113, -11, -103, -75, -31, 96, -44, -103, 12,
+        -90, -93, -63, -92, 51, 30, 100, -93, 121, 127, 48, -18, -89, -125, 100, 60,
+        24, 79, -60, -1, -57, -99, 116, -112, -10, 7, 119, 107, -15, -65, -114, -4,
+        117, 36, -118, 71, -125, -69, -7, 96, -46, 31, 76, 70, -30, -109, -8, -1,
+        112, 42, -2, 63, 28, 76, -41, -3, -79, -64, 49, -111, 40, 70, -125, 76,
+        -44, 82, -88, -60, -65, -65, -6, -89, -83, -38, -35, -56, 41, 19, 54, 105,
+        54, -90, 90, 103, -69, -36, 21, 29, 13, 110, -95, 71, 22, -104, -6, -54,
+        -24, -123, 93, 98, -44, 106, 7, 117, 96, -73, 94, 71, -126, 7, 120, -35,
+        -47, 102, 22, -65, -22, -84, 0, -18, 15, 121, -29, 82, -9, -85, 71, -106,
+        -107, -12, 93, -102, 105, 105, 41, 14, 97, 65, 88, 97, 4, 69, -123, -82,
+        -119, -44, 12, 63, -77, 56, 107, 51, -6, -24, 102, -12, -59, -97, -14, 106,
+        80, -73, -70, 8, -12, 75, -73, 23, 85, -93, -70, 53, 84, -33, -27, 112,
+        107, 77, 107, 87, 45, 95, -72, -53, 110, 127, 69, -26, 3, -85, -19, -40,
+        92, 72, -119, -67, -53, -41, -45, -1, 51, -102, 58, -12, 79, -61, -32, 11,
+        126, -67, -26, 118, -60, 85, -93, -128, 25, 65, 66, -1, -70, 86, -124, -72,
+        121, 27, -27, 16, -53, -98, -55, -127, -87, -25, 28, 58, -58, 10, 34, -84,
+        -114, 21, 33, 14, 65, -41, -75, 5, -50, -45, 93, 97, 2, -88, 6, -19,
+        -47, -68, -56, -122, -7, -117, 18, -95, -7, 28, -33, 122, -56, -89, 120, 109,
+        91, -115, -72, 74, -60, 68, 47, -88, 51, -29, 81, 61, -94, -114, -113, 55,
+        99, -122, -36, -91, -14, -79, -69, -109, 59, -76, 24, -47, 103, -51, -7, -99,
+        64, 112, -60, 18, -88, 85, -19, 114, 1, -20, 14, -122, -21, -103, 65, 74,
+        55, -29, -80, 45, -86, -105, 15, -79, 117, 3, 61, -114, -58, -31, -9, -34,
+        -116, 40, -69, -108, 24, -67, 121, -117, -63, 91, 47, 118, 44, 126, -85, 17,
+        -50, -110, -12, 27, 95, -16, -24, -124, -43, 77, -42, 59, -122, -66, 63, 123,
+        -116, -19, -111, -91, -36, -70, 39, -128, -90, 14, 50, 114, -3, 99, -64, -61,
+        115, 92, 3, 20, 50, -63, -74, -39, 111, 110, 21, -108, 14, -59, 127, -33,
+        119, -52, 85, 29, -7, -93, -34, 33, -41, 63, 51, 119, -126, 22, -13, 81,
+        54, -50, -16, 41, -22, -71, 64, 56, -7, -66, 51, 63, -85, -1, 29, 126,
+        -6, 94, -52, 120, -20, -44, 68, -51, -112, -72, -53, 66, 114, -94, -108, 13,
+        -18, -60, -20, 103, -14, 60, 24, -1, 113, 34, 102, 76, 89, 57, -87, -15,
+        -111, -33, 13, -122, 10, -3, 96, 2, -18, 3, -104, 14, -107, 125, 84, 61,
+        -2, 29, 46, -85, -116, -102, -60, 44, -84, 16, 104, 115, -43, -117, -13, -103,
+        122, 100, 55, 93, 91, -39, 65, -61, -82, -82, -20, -128, -7, -51, -41, 87,
+        -63, -31, 109, 28, 67, -37, -47, -51, 53, -42, 104, -99, -59, -44, -119, 92,
+        105, 69, -75, -40, -68, -2, 111, -80, -38, -6, 107, 50, 83, -65, -97, -27,
+        91, -124, -71, 114, 52, -23, 43, 91, 43, 122, 13, 23, -29, -44, -53, -4,
+        -100, 55, 88, -57, -123, -37, 3, 75, -120, 43, 77, 13, -35, 108, -4, 122,
+        -50, -87, 80, -73, -94, 115, 39, -83, -95, 62, 68, -82, -22, 92, 53, -71,
+        70, -22, 100, 71, -38, 44, -20, -40, -86, -105, -58, 92, -31, 22, 119, -34,
+        -6, -30, -118, -27, 93, -87, 109, -115, 23, 120, -127, -102, -12, 18, -113, 83,
+        -20, -72, 69, 94, 124, -19, -48, 50, 47, 30, 11, -79, -48, -77, 3, -50,
+        46, -94, -58, -22, -66, -92, -10, 106, -14, 126, -92, 53, -59, -14, -119, 91,
+        -109, 70, -40, 45, -110, -81, -38, -114, -100, 50, -75, -114, 122, -54, 55, -85,
+        -11, -7, -95, -29, 124, -82, -50, -89, -32, -17, -32, -96, 74, 89, -32, -98,
+        88, 41, 11, -22, 94, 34, -107, 48, -44, -45, -85, -22, 123, -3, -103, 45,
+        15, -104, -72, -83, -24, 64, -44, 36, -23, 42, -63, -51, 123, 43, 17, 104,
+        -67, -41, 63, -27, 117, -63, 68, 15, 126, -17, 126, 102, -102, 117, 123, 26,
+        66, -2, 33, 95, 94, 45, 81, -37, 19, 101, 125, 123, -111, 53, 25, 76,
+        50, 40, 13, -87, 94, -98, -19, 73, 72, -29, 83, 85, -48, -64, -38, 12,
+        -119, -11, 117, -107, 84, 14, 93, -14, -75, -21, 112, -124, -96, 84, -91, 110,
+        -121, -4, -2, 106, -34, -117, 48, 26, -27, 52, 94, 22, -64, 87, 37, 124,
+        24, -7, -71, -117, -50, 68, -7, 48, -70, 0, -33, -15, 64, 80, -96, -96,
+        -21, -99, -97, -78, 122, 73, 29, -97, 82, 95, 22, -59, 124, 119, -56, -85,
+        123, 80, 78, -78, -97, -51, 106, -79, 88, 23, -18, 53, 36, 123, 20, -14,
+        -27, 40, -49, -128, -38, 33, 108, -17, -59, 122, 95, -67, 15, -34, -15, 43,
+        103, 8, -8, 71, -80, 28, -75, -25, -9, 53, 92, -19, 15, -90, -17, 83,
+        35, -78, -5, 59, -55, -61, 45, -115, -96, 127, -71, 68, 30, -34, 83, -29,
+        -9, 66, 16, -121, 30, -32, 12, -13, -95, 124, 123, -109, 121, 52, -119, -74,
+        19, 93, 112, -105, -3, -121, 112, 95, -94, 122, 17, 110, -33, 111, -39, -8,
+        -99, 79, -85, -29, 74, 62, -22, -3, -101, -80, -128, 78, 111, 68, 88, -93,
+        -86, 20, -78, 13, -109, -96, 111, -5, 127, -43, -10, -51, -52, -78, -54, 64,
+        48, -48, -105, 27, -11, -49, -14, -124, 119, 79, -77, -70, 58, -86, 98, -82,
+        63, -10, -12, -87, -100, 18, 85, 87, -85, -128, -71, 27, 73, -12, 30, 63,
+        72, 27, -106, 70, -11, 22, 109, 64, 28, 22, -120, 81, 73, 68, 27, 102,
+        52, -92, -108, 42, -111, 116, 19, -33, 9, 46, 56, 80, 33, -98, 56, -22,
+        -38, 76, 92, 3, -21, 35, 117, 71, -54, -33, -98, 86, -59, 122, 33, -49,
+        -51, -37, 47, -6, -4, 47, -63, -83, -46, -55, -38, -83, 78, -22, -14, 93,
+        80, 40, 37, -122, -80, 88, 42, 48, -84, -88, -58, -73, -45, -80, -90, -44,
+        -56, 15, 61, -3, 91, 77, -81, -86, -89, -30, -52, 116, 10, -91, 104, -14,
+        102, 71, 94, -87, -9, 124, -100, 55, -6, 69, -99, 89, 86, 44, -90, -63,
+        -23, -47, 119, 73, -98, -35, -39, 23, 19, -87, -7, -58, -61, -8, -66, -105,
+        -114, -122, 50, 89, -62, 35, -87, -2, 78, -21, -32, -79, 60, 23, 53, -95,
+        -29, 10, 104, 100, -33, -65, 4, 64, -50, -20, 108, 36, -26, 93, 25, 49,
+        -9, 74, -121, -28, -36, -117, -22, 24, -112, -72, -49, 77, 82, -50, 85, -34,
+        53, 9, -30, -68, 57, 28, -110, -92, -66, 108, -64, 73, -46, 45, -115, -111,
+        100, 54, -97, -116, 38, 121, 88, -110, -39, 36, 43, 38, -29, -128, 36, -45,
+        81, 34, 68, 121, -41, 75, -57, 89, 83, 81, -70, -72, 73, 81, 102, 105,
+        118, -105, 125, 117, 81, -70, -20, 100, 68, 105, 47, -128, 40, 81, -62, -41,
+        -114, 67, -126, -44, -57, 45, 56, 65, -70, -91, 49, -126, 76, -77, -23, 104,
+        92, 51, 36, -45, -15, 100, 62, 30, 5, 4, 57, 17, 114, -52, 84, 14,
+        -109, -90, 114, 116, 81, -109, 114, 76, 71, -109, 108, -12, -12, -75, -27, -24,
+        114, -109, -111, -93, 6, -45, 114, -84, -98, 89, 6, 66, 76, -32, 26, 87,
+        -113, -11, 121, -2, -108, -16, 118, 21, -105, 122, 79, -100, 18, 66, 28, -91,
+        -117, -95, 125, 98, -99, 19, -30, 48, -101, 63, 65, 24, 127, 52, -90, -67,
+        116, 42, -20, 106, 50, -26, -124, -120, 90, -121, -113, -112, 46, 22, -39, 83,
+        -99, 16, -35, -10, 111, 41, 68, -44, 49, -57, -82, 98, 110, -78, 118, 85,
+        -126, 105, 33, -94, -9, -99, 67, 114, 124, 122, -102, -89, -55, -108, -109, -93,
+        91, 26, 35, 71, 81, 39, 31, -50, -61, 114, 20, 48, -45, 97, 18, -112,
+        -29, 48, -99, -10, -46, -55, -72, 55, 105, 42, 70, -127, 121, 97, -97, -124,
+        101, -59, -24, 54, -1, 117, -60, -24, 50, -109, 17, -93, 6, -45, 98, -124,
+        -17, 74, -121, 76, -86, -114, 82, 112, 82, 116, 75, 99, 76, -22, 108, 54,
+        92, -116, 102, 97, 41, -50, -110, 97, 62, -102, -122, -92, 56, -52, 122, 119,
+        -93, -34, -3, -76, -87, 69, 117, 49, -109, 82, -52, -77, -31, -35, 104, -4,
+        -75, 45, -86, -53, 76, 70, -118, 26, 76, 75, 17, -68, 103, 29, 28, -118,
+        -32, 45, 107, 98, 40, 58, -91, 49, 67, 113, 49, 90, -116, 23, 89, 88,
+        -120, 115, -31, -61, -25, 119, -63, -95, -104, -10, -122, -87, -80, -87, -23, -88,
+        -23, 96, 116, 113, -109, 98, -100, -27, -77, -39, 108, -2, -43, 7, -93, -61,
+        78, 110, 48, 42, 48, 59, 24, -19, 75, -38, -95, -95, 8, 95, -47, -10,
+        -91, -24, -106, -58, 12, -59, -15, 112, 60, 25, -33, -121, -91, 8, -97, -48,
+        -90, 103, 55, -109, -34, 52, -23, 77, 27, 47, 55, -124, -2, -92, 89, -35,
+        28, -43, 109, -3, -21, -116, 68, -105, -105, -116, 8, 53, -104, 22, -95, -39,
+        11, 97, -105, -113, 95, 96, -75, 72, -42, 9, -29, 37, -42, 24, 54, -75,
+        94, -29, -43, -94, -125, -102, 94, 45, -46, 64, -73, 25, -127, -20, -102, -112,
+        -119, 117, 4, 23, -115, 26, 108, 41, -9, 110, -27, -27, -2, 42, 93, -90,
+        21, 44, -65, -98, -68, -3, -14, -111, -82, 19, -58, -21, -117, 54, 17, 75,
+        71, 57, -39, 25, 54, 94, 62, -70, -72, 73, -39, 50, 64, 55, -111, 45,
+        -65, 72, 108, 38, 91, -120, 39, 36, 91, 102, -127, -7, 5, -42, -109, 100,
+        -99, 48, 94, -33, 111, 102, -67, 116, 36, -26, 63, -29, -58, -53, 73, 7,
+        51, -67, -100, -92, -127, 110, 34, 87, 126, -47, -40, 76, -82, 16, 79, 64,
+        -82, -12, -126, -13, -26, -21, 75, -70, 78, 24, 47, 101, -119, -121, -119, -104,
+        11, -115, -109, -90, 115, 33, 23, 53, 99, -119, 73, -96, 27, 89, 98, 110,
+        21, -39, -44, 18, 87, 120, 2, 82, -27, 86, -96, 95, 100, -63, 73, -44,
+        9, -29, 37, 70, -85, 24, -82, -9, -93, -34, -76, -59, -126, 19, 97, -26,
+        22, -100, 20, -48, -115, 38, 72, -36, -78, -78, -103, 92, 33, -98, -128, 92,
+        -103, 37, -23, -19, 87, -96, 116, -99, 48, 94, 98, 5, -102, -12, -78, 81,
+        111, 114, -33, -44, 8, -69, -104, 73, -79, 50, 64, 55, 17, 43, -65, -50,
+        108, 38, 86, -120, 39, 32, 86, 122, -115, 122, -5, 37, 41, 93, 39, -116,
+        -41, -105, -22, -8, 78, -104, -32, 123, 49, 33, 110, 108, -122, 93, -36, -12,
+        112, -91, -127, 110, 51, 92, -39, -123, 103, -61, -31, 10, -16, 4, -121, 43,
+        -79, 104, -67, -3, 26, -107, -82, 19, -58, -21, -119, 117, 52, -22, -115, -90,
+        -67, 113, -38, 116, -84, -70, -120, -23, -83, 91, 26, -24, 38, 50, -27, 87,
+        -94, -51, 100, 10, -15, 16, 50, 21, 2, 5, -78, 100, -113, -96, 57, 17,
+        87, 89, -85, -23, 73, -77, -64, 41, 47, -88, 13, -72, 13, 116, -106, -94,
+        -15, -23, 49, 36, -22, 24, -60, -108, -108, -61, -52, -82, 93, -74, 52, 57,
+        -30, -90, -113, -104, 97, 59, 19, 10, -13, -70, -57, -87, 94, -74, -94, 45,
+        57, 68, 43, -39, -42, 31, 87, -127, 71, 24, 84, -115, -88, -77, 61, 26,
+        -34, 73, 54, -91, 80, 44, 47, -28, -31, 72, -6, -40, -28, 43, 117, 6,
+        18, -27, -113, 106, 116, -62, 80, 39, -110, -86, 122, 86, -90, -111, 82, -63,
+        -60, 13, -35, -77, 33, -41, 53, -73, -45, 85, -25, 18, 123, 49, -82, 89,
+        -17, -12, 19, -112, -7, -94, -72, -112, -71, -126, -77, 99, 71, 10, 47, 63,
+        -60, 103, 3, 118, 112, -39, -12, -65, -30, -77, 62, 20, 34, -49, -108, 116,
+        47, -27, 9, -57, -73, -127, -112, -34, 58, -33, 31, 81, 49, -68, 49, 88,
+        66, -56, 121, -74, 57, -5, -105, -8, -23, -105, -85, 38, 53, 76, 103, 48,
+        50, 103, -52, -94, -5, 14, -38, -15, 41, -88, 10, -53, 30, 11, -11, 59,
+        -84, 126, -107, -49, -20, -83, -51, 57, -4, -60, -90, 103, 84, -119, -15, 0,
+        18, 85, 124, 85, -105, -56, 86, -3, 110, -38, -124, 67, -67, 42, -11, -112,
+        -71, 126, -95, 62, 20, -37, -123, -2, 65, -27, -88, -42, 63, -66, -20, -19,
+        -1, 13, 40, -107, 46, -36, -55, -82, 116, -15, -45, -50, 121, 48, 54, 37,
+        98, -24, 81, 25, 125, -114, 92, 44, 75, -4, 39, 22, -51, 87, -104, -30,
+        -78, -52, 6, -12, 48, 24, 21, 27, 125, 62, -78, 60, 4, -87, 83, -56,
+        -105, -33, 59, 68, -54, 119, -109, -34, -74, 76, 31, -92, 91, 39, -85, -8,
+        -44, 20, -101, -67, 80, 88, 67, -109, -13, -110, 14, 74, -13, -92, -57, 116,
+        -7, -23, 87, 125, -126, 59, 45, 109, 104, 5, 92, -26, 75, 76, -109, 114,
+        -24, -106, -91, 96, -44, 51, 37, -40, -120, -107, -59, 74, 40, -121, -121, -60,
+        -34, -49, -63, -91, -44, 89, -17, 74, 85, 106, -114, 111, -105, -128, -28, 75,
+        -102, 14, 8, 125, 50, 10, 124, -43, -17, 15, -84, 95, -92, -42, 49, -75,
+        99, 78, 111, -69, 117, -22, 15, -112, -105, 53, 86, -37, 109, -27, -74, 77,
+        91, 100, 6, 45, -45, 96, -89, -33, -95, -15, -70, -120, 23, -85, 79, -22,
+        41, 0, -52, -89, 56, -46, 109, 93, -93, 99, -116, -108, -79, -109, -82, 18,
+        30, -6, -109, -70, -52, 109, -96, -102, 43, -59, -120, -38, -99, -100, 52, -84,
+        3, 57, -128, -46, 79, 18, 53, -104, -119, 48, 9, -28, -18, -5, 99, 32,
+        103, 54, -28, -9, -128, -20, -74, -52, -27, 73, 78, 4, 104, 8, -57, 85,
+        -105, 64, -49, 69, -50, -20, -5, -70, 32, -63, -74, 28, -104, 82, 15, -4,
+        59, -9, -10, -106, 72, 117, -11, 8, 27, -97, -82, 115, 5, -65, -76, 59,
+        126, -123, -78, -84, -21, 95, 9, -16, 13, 16, -72, 23, -32, -37, -83, -82,
+        49, -14, -62, 126, 17, -25, -1, 125, -125, -28, 29, -36, -57, 102, 9, -99,
+        -34, 87, -17, 19, -81, 87, 71, 81, -13, 116, 94, 23, 117, -57, 54, -127,
+        -35, -62, 71, 110, -27, 91, 101, 85, -14, 115, -1, 81, 120, -46, -74, 120,
+        39, -13, 73, -101, -57, 30, -49, -89, 109, 92, -41, -15, 34, -27, 3, 102,
+        -5, -35, 126, 95, 28, 126, -71, -108, -119, 21, -52, 83, 21, 32, 73, -126,
+        -113, 90, -5, 0, 23, 103, 95, 121, 125, -19, -97, 74, 45, 82, -33, 72,
+        64, -81, 11, -121, 106, 110, 67, 122, -66, -66, -104, 94, 56, -40, -59, 23,
+        2, -120, -63, 108, -98, -31, -112, 13, -108, 51, -92, 74, 89, -77, -23, 100,
+        -1, 42, -26, 68, 78, 79, 55, 13, -88, -38, -76, 37, 76, -44, -116, -94,
+        77, -61, 69, -112, 71, -48, 55, -99, -36, 17, -12, 109, 22, -15, -12, 89,
+        -40, -26, -12, -119, -102, 81, -12, 105, -72, 118, -12, -35, -33, 15, 9, -6,
+        -42, -53, 120, -6, 44, 108, 115, -6, 68, -51, 40, -6, 52, 92, 59, -6,
+        -46, 97, -110, 16, 4, -66, -82, -29, 9, -76, -80, -51, 9, 20, 53, -93,
+        8, -44, 112, 45, 9, 28, -45, 4, 54, -94, -16, 10, 18, -93, 105, -116,
+        39, -46, 44, 124, 58, 17, -74, 87, -11, -52, -84, 32, -36, -108, 58, -91,
+        53, 54, -27, 53, 6, 25, 53, -8, -27, 23, 75, 73, -117, 53, -110, -65,
+        -64, -86, 93, 44, 81, 84, -43, 45, -102, -124, -104, 98, 120, -97, 60, -70,
+        -38, -63, 74, 64, -107, -42, -16, 31, -73, -6, 53, 87, -85, 20, -57, -83,
+        90, 114, 2, -96, -22, 56, -62, 8, -112, -43, 76, 2, -104, 23, 14, -115,
+        -90, -122, 26, -66, 77, -92, 86, -51, 90, -108, -4, 40, -87, 29, -16, -107,
+        78, 90, 108, 110, -61, 95, 70, 112, 77, -38, -46, -5, 83, 33, -8, 89,
+        -15, -76, 59, -60, 60, -84, -5, -123, -44, -54, 31, -57, 65, -3, 10, 18,
+        83, -89, 74, 53, 60, -96, -75, 9, 46, 121, -85, -19, 61, -77, 114, -16,
+        21, -62, 93, 28, 119, 59, -2, 94, 32, 96, -111, -68, 116, -51, 77, -42,
+        -85, 53, 122, 117, 43, 43, 5, -99, -110, 107, 61, -100, -122, -21, -111, 72,
+        92, -26, -29, -59, 107, 68, 106, -119, -124, -41, -103, 98, -35, -77, 46, -14,
+        -61, -125, 16, -52, -77, -9, 54, 4, -73, -112, -127, -15, 14, -80, 46, 90,
+        109, -97, -117, -61, -22, 68, 95, 107, -114, 121, 42, -62, 87, 36, -17, -15,
+        77, -122, 30, 4, -44, 75, -70, 14, 39, 109, -90, 13, -4, -111, -36, -39,
+        103, -73, 30, -70, 49, 75, 60, -76, -9, -32, -10, -94, -68, -42, -119, -69,
+        65, -33, -42, -28, 55, 39, -70, 52, -125, 99, 123, 87, 93, -21, 116, -69,
+        87, 93, 111, -60, 29, 44, 31, -91, 12, -30, 109, 117, -73, -111, -34, -12,
+        -108, 70, 93, 109, -58, -69, -119, -24, -100, -19, 9, 103, -128, -16, -93, -62,
+        -35, -51, -96, -58, -123, -69, 43, -46, 117, -90, 85, 9, -101, 8, -112, -59,
+        101, 56, 17, -36, -82, 86, -22, -117, -34, 119, -87, 35, -90, -59, 16, -81,
+        31, -57, -18, 52, -74, 10, 106, 59, -5, -77, -33, 45, -118, 98, 88, 76,
+        -4, 45, -39, -17, 70, -29, 81, 62, 78, 110, -68, 17, 91, -18, 51, 118,
+        -8, 125, 68, -70, 75, -34, -42, 33, -79, -89, 119, -51, 78, 41, -34, 102,
+        100, 19, 112, 124, -43, -83, -58, -17, -14, -59, 44, -101, 45, -126, 91, -126,
+        26, 4, -124, 5, 123, 32, 66, 104, -35, 100, -32, 85, 40, 51, -117, 80,
+        -81, 16, -111, -71, 42, -34, 8, 124, 32, -18, 104, -110, -49, -48, 47, 36,
+        -95, -57, -99, 88, 68, -36, -67, -7, 0, -84, 114, 0, 97, 72, 120, -21,
+        -98, 42, 127, -88, 43, 55, 78, -122, 43, 86, -70, -30, -14, 32, 76, 74,
+        45, 5, 76, -57, -103, -2, -46, -35, 4, -67, 43, 83, -2, -92, -102, -9,
+        50, 31, -24, 44, 63, 92, 66, 47, -126, -3, -41, -53, -15, -76, 122, 58,
+        -9, -19, 52, 81, 21, -101, -27, 55, -64, -127, 114, 15, -103, -120, -91, 35,
+        -28, 75, 100, -86, 84, -121, 61, -43, 107, 57, -24, 49, 15, 72, -95, -109,
+        18, 0, -63, -23, -124, 15, -115, -98, 49, 9, 117, 1, -67, -19, 67, 9,
+        -53, -103, -95, 10, -65, -80, 94, -99, 96, -113, 60, -47, -60, 61, -7, -45,
+        -6, 41, -103, 56, 118, -110, -60, -88, 7, 113, -32, -13, 74, 44, -53, -69,
+        40, -81, 70, -61, 55, 85, 72, -106, 57, 121, 50, 7, -103, -13, -100, -88,
+        -55, 18, 102, 95, 19, -91, -39, 110, 95, 76, -28, 22, -93, 4, 24, -79,
+        -45, -128, -96, -30, 23, 39, -74, -102, 89, -94, -96, 21, 89, 66, -100, -37,
+        -8, -127, 70, 96, -113, 115, -4, 16, -57, 39, -109, -106, 11, -77, 105, 100,
+        94, 52, -10, 78, -79, 4, -37, 92, 47, 35, -37, -92, -102, -12, 90, 44,
+        125, -113, -78, 32, -117, -43, -95, -104, -37, -116, 64, 47, -101, 45, 122, -15,
+        -82, -78, 49, -98, -7, -47, -89, 8, 98, 124, -112, -29, 39, -96, 97, -46,
+        111, 25, 6, 33, -125, 6, -57, -79, -4, 30, -24, 5, 108, 67, 52, -79,
+        54, 124, 71, 2, 102, -121, -22, 76, -76, 53, 33, 109, 70, 120, -76, 54,
+        100, 91, -72, -69, 127, -114, 50, 27, -66, -51, 123, 27, 108, -13, 79, 122,
+        2, 43, 126, -48, -109, 37, 42, -32, -23, 21, -30, -120, 119, 89, 12, -105,
+        -58, 29, -89, -84, -18, 52, 96, 9, -40, -28, 96, 95, 89, -119, -117, 38,
+        87, 79, 122, -102, 106, 33, 39, -115, -122, 94, -30, -83, 108, -100, 96, -90,
+        98, -98, 62, 11, 89, -77, 40, -15, -39, 7, -42, 35, 62, -29, -55, 100,
+        108, -104, -57, -127, -116, 108, -108, 48, -68, -59, 13, -106, 74, -19, 90, 89,
+        61, 85, 95, -18, 53, 124, -15, 60, 100, -47, 103, -81, 74, 1, -8, -89,
+        -84, 108, -111, -99, -56, -107, -65, -109, -5, 25, -108, -14, 117, 93, 36, -27,
+        -127, 72, 50, -109, -107, -97, 102, -76, -70, 45, 105, -110, -117, 90, 116, 3,
+        110, -81, -128, 81, 103, 122, -101, -64, 36, -69, 91, 20, 79, -7, -53, -6,
+        -92, -79, -97, -14, -39, -79, 26, -49, -14, -73, -8, 35, 55, 110, -115, -64,
+        106, -108, -87, 17, 115, 20, -88, -84, 3, 87, -122, 100, -125, -24, 53, -34,
+        78, -35, -25, 80, -9, -4, -27, 100, 89, -83, -40, -20, -97, -13, -29, -22,
+        88, 95, -111, 63, 79, 69, -125, -41, 51, -79, 83, -1, 25, 63, 11, -19,
+        -122, -82, 72, 25, 123, 71, 31, 72, -71, 118, 43, 125, -23, 84, -61, 8,
+        91, 60, -27, 115, -5, -87, -16, -81, 53, 45, -6, 15, -43, 6, 123, 70,
+        -20, -124, -69, 62, -117, 69, 84, 102, 75, 100, 92, 90, 93, 69, -118, 108,
+        104, 34, -100, 18, 109, 44, 86, -94, -33, -38, 46, -22, -97, 10, 38, -89,
+        88, -99, 110, -109, -83, -125, 13, 69, -94, 3, -115, 45, 69, -60, 118, 49,
+        -75, -85, -120, -101, 86, 27, -99, 114, 107, -79, -22, 9, -43, -69, 1, -67,
+        41, -53, -113, -69, -48, -18, 48, 51, -24, -70, 81, -68, -90, 19, -20, 85,
+        61, -58, -89, 63, -35, 121, 101, 19, 29, 111, 60, -67, -22, -17, 87, -21,
+        53, 48, -54, -22, -41, -90, 22, 83, 87, 10, 109, -117, -47, 80, -43, -66,
+        24, -24, 11, 24, -16, 76, 55, -104, 126, 118, 73, 36, 95, 85, 71, -99,
+        -74, -53, 77, 29, 80, 38, -11, -10, -25, -118, 68, -94, 83, 12, 55, -21,
+        -76, -109, 98, -81, 97, 73, 121, -119, -94, -110, 115, -7, -87, -65, 20, -13,
+        75, 60, -105, -82, -54, -112, 119, -58, -25, -127, 49, 96, 3, 31, 38, -37,
+        67, 29, 71, 93, 113, 123, 12, -76, 1, -81, 71, 19, 119, 62, 28, -16,
+        66, 52, 65, 93, 42, 122, -55, 52, 14, -115, 48, 85, -84, 45, 49, 94,
+        82, 105, 62, -120, 121, -112, -60, -84, 126, 97, -47, 35, 69, 1, -27, -114,
+        -78, -64, 25, -11, -44, -113, -19, -43, -120, -60, 113, -44, 108, -1, -28, -93,
+        14, -107, -95, -19, -107, -33, 96, 71, -32, 22, -81, -97, 20, 89, -29, -47,
+        -85, -6, -107, 76, -91, -119, -111, -107, 5, 14, -58, -2, 76, -22, -119, 12,
+        -46, -56, 95, -124, -90, 127, 126, 72, 57, -28, -72, -109, -82, 35, 32, -102,
+        6, -118, 4, -9, 7, -124, 41, -75, -37, 14, 63, -85, 95, -10, -7, -74,
+        112, -62, -13, 8, -58, 56, 21, 39, -88, 37, 112, -53, 61, 86, 43, 6,
+        -15, -77, 127, -4, -34, -7, -18, 45, 82, 101, -95, -106, 9, -50, -60, -115,
+        7, -112, -55, -61, 45, 51, 123, 119, 81, 85, -72, 48, -115, 66, 112, -121,
+        -21, 59, 107, -44, 40, 20, 35, -116, 2, 25, -128, 8, 4, 41, -82, 62,
+        19, 3, 113, -127, -45, -49, 59, 22, -89, -126, 50, 78, -78, 16, -85, -65,
+        -108, -122, 96, -18, 93, 33, -104, -21, 122, -38, -112, -29, 14, 14, 98, 75,
+        -125, 80, 8, -67, -107, 115, -32, -114, -116, 51, 80, 78, 86, 127, 7, 42,
+        -52, 25, 11, 37, 31, -69, -111, 30, -6, -58, -17, -35, -116, -28, 127, -33,
+        123, -49, -46, -4, -12, -67, -28, -32, -5, -31, -35, 104, -44, -21, -116, -90,
+        -67, -50, 56, -107, 10, 54, -51, -34, 15, -17, -65, -121, 79, -41, -52, -13,
+        125, -7, 114, -115, -7, -68, 17, -29, 91, -40, 60, -15, -65, -97, -66, 79,
+        -109, -14, -77, 121, 82, 103, -88, 95, -72, 25, 119, -90, -49, -61, -95, -8,
+        95, -102, -23, -1, 15, 71, -30, -1, -2, 27, 53, 20, 43, -112, -45, -113,
+        26, 24, 105, 22, -60, 20, 57, -79, -62, 66, -45, 111, 67, 104, 79, -52,
+        -117, 13, -20, 53, -128, 124, -23, -119, -69, -119, -15, -56, 7, 7, -87, -67,
+        39, -72, 113, 107, 18, -33, -69, -101, -74, 42, 54, -34, -97, 21, -89, -49,
+        69, -79, 37, 119, -103, -112, -11, -61, 123, 76, -56, 96, 118, -83, 61, -3,
+        121, 32, -111, -25, 66, -22, -121, -98, -1, -87, -1, -76, 126, 89, 45, -88,
+        -126, -11, -110, -6, -70, 33, 97, -113, 27, -22, -21, -21, -102, -4, -6, -70,
+        -26, -62, 104, -10, -36, 76, 83, 70, 89, 82, -75, 73, 41, -25, 56, -24,
+        80, 62, 109, 30, -85, -25, -108, -120, 41, 15, 9, 79, 31, -107, 99, -52,
+        42, -73, -51, 71, 24, 88, 106, -1, -50, -79, -79, -35, -40, 3, 69, -104,
+        31, 96, -38, 85, 125, -29, -74, -56, 72, -61, 92, -22, 82, 63, -76, -105,
+        -100, 124, -79, -115, 100, -24, -41, -93, -74, -110, 125, 111, 30, -69, -103, 76,
+        -6, 113, 106, 75, -39, 11, -53, -76, -40, 89, 54, 28, -91, -89, -80, 126,
+        -95, 58, 8, 68, -9, 23, 77, 81, 49, 110, -68, 46, -122, -25, -62, 79,
+        -85, 121, 9, -86, 14, -34, -64, -127, 51, 64, -111, 42, 123, 92, -111, 58,
+        -20, -125, -92, -125, 16, 118, -14, 30, -2, -43, 81, 69, -13, 49, -92, -117,
+        52, 97, -10, 22, 46, -100, -15, -86, -13, -128, 112, -46, -21, 91, -111, -86,
+        115, -38, -50, 95, 56, 3, -21, 77, 24, 124, 67, -21, -51, 22, 66, 99,
+        -35, -101, 52, -32, 71, 84, -46, 32, 75, -93, -114, 7, 50, 113, 51, 127,
+        -97, -112, 115, -55, -20, 69, -87, -112, -13, 69, 15, -106, 112, 53, 42, -112,
+        110, -109, 93, 127, 40, 39, 114, -17, 31, 0, 24, 21, -94, -52, -93, 7,
+        -86, 31, 15, 35, 45, 105, 96, -45, -97, -105, 104, 57, -93, -24, -70, 77,
+        -87, -39, 31, 125, -24, -40, -84, -98, -28, -37, 93, -113, -43, 11, 78, -2,
+        -55, 99, -13, -24, -115, -9, -52, 43, -41, 29, 51, -33, 108, -2, -104, 41,
+        -13, 92, -87, 94, -33, -127, -55, -10, 113, 126, 16, 99, -17, 34, -33, 15,
+        118, 95, 0, -46, 69, -26, 115, 111, -102, 125, 122, -18, -106, -121, -126, -123,
+        19, -88, -71, 79, 102, -38, 40, 94, -9, -46, -7, 28, 55, -105, 106, 90,
+        96, 78, -55, -122, -50, -41, -72, -75, 59, -48, 97, 57, -10, 90, 88, -121,
+        112, 5, -42, 102, -38, -85, -98, 117, -43, -103, -35, 22, 87, 104, 84, 88,
+        16, 121, -111, -120, 10, -31, -82, 88, 113, -107, 103, -77, 77, 120, 43, 80,
+        -85, 52, -83, -48, -27, -3, -35, 106, -77, -33, 29, 78, -71, -80, 55, -64,
+        -30, -22, 83, 75, 44, 38, 59, 120, -15, 62, -128, 15, -66, -109, 89, -68,
+        -73, -97, -14, -93, -21, -100, -54, 27, -75, 106, -125, 4, -102, -10, -22, -44,
+        20, -24, 25, 72, -6, 0, -66, 42, -118, 87, 107, -11, -40, -121, 38, 30,
+        20, -122, 44, 43, 4, 51, 97, 81, -16, 73, 1, -54, 119, -29, 20, 89,
+        110, -63, -54, 55, 63, 20, -63, -32, 71, -9, 32, 111, -93, -70, 50, -120,
+        68, -52, -87, 21, -77, -54, 45, 62, -112, -82, -93, 95, -14, 34, 116, 3,
+        18, 55, -66, 89, 92, 51, 34, 55, -117, -122, 35, 18, 87, 104, 60, 34,
+        -35, -22, -65, -31, -120, -60, 93, -119, 29, -111, -96, -42, -107, 35, 18, 96,
+        -118, 25, -111, 18, -4, -81, 106, 68, 34, -126, 27, -114, 72, -74, -18, 109,
+        71, -92, -67, -77, -117, 27, 95, 47, -81, 25, -111, -21, 101, -61, 17, -119,
+        43, 52, 30, -111, 110, -11, -33, 112, 68, -30, -82, -60, -114, 72, 80, -21,
+        -54, 17, 9, 48, -59, -116, 72, 9, -2, 87, 53, 34, 17, -63, 13, 71,
+        36, 91, -9, -74, 35, -78, -68, 101, -114, 91, 127, 93, 95, 51, 36, 95,
+        -41, 13, -121, 36, -82, -48, 120, 72, -70, -43, 127, -61, 33, -119, -69, 18,
+        59, 36, 65, -83, 43, -121, 36, -64, 20, 51, 36, 37, -8, 95, -43, -112,
+        68, 4, 55, 28, -110, 108, -35, 27, 15, -55, 49, 61, 36, -81, 28, -109,
+        -51, 7, -27, -75, -93, -14, 91, 26, -106, 45, -57, -27, 13, 7, 102, -45,
+        -111, -7, -41, 55, 52, -81, 26, -101, 95, 100, 112, -30, 70, -82, 24, 126,
+        -51, -122, -34, 53, -61, -18, 91, 25, 114, 45, -122, -37, -115, -122, 90, -109,
+        97, -10, -41, 53, -60, 90, 15, -81, -37, 15, 45, -117, 95, -34, 74, -74,
+        97, -108, 50, -21, -57, -23, -71, -40, 20, 63, -55, -94, 95, 46, -52, 121,
+        24, -17, 98, 110, 86, 119, 0, -58, -85, 49, -51, -22, -113, -68, 120, -107,
+        -122, 89, -32, -112, 11, 58, -31, -24, -98, 43, 97, 10, -23, -5, -52, -75,
+        71, 14, -4, -117, -55, -35, 111, -23, -36, 6, 33, -98, -81, 124, 116, -29,
+        -115, -46, -90, 14, 25, -40, -8, 27, -33, 32, -33, 6, -13, -4, 96, -78,
+        98, -55, -97, 76, -50, 28, 49, 116, -85, -109, 85, -16, -5, -85, -5, -3,
+        -76, 58, -83, -117, -86, 22, 12, -103, -125, 114, -83, -54, 29, -120, -17, 101,
+        -58, 21, 69, 95, 11, -127, -48, -51, 18, 20, -64, -102, 49, -25, 113, 12,
+        -68, -101, -52, 64, 125, 110, -111, 6, -106, -71, 46, -40, -123, -83, 9, -63,
+        51, 71, 17, -68, 98, 79, 40, -78, -48, -26, 52, 32, 18, -82, -106, 39,
+        -107, -110, -111, -37, -94, 47, -115, 103, 116, -44, 65, 3, -6, 34, 99, 111,
+        -96, 104, 22, 109, -106, 125, 105, -8, -124, -29, -80, -99, 118, -69, -84, -81,
+        14, -38, -100, -97, -10, -62, 105, -60, 57, 37, -17, 64, 67, -75, -76, 42,
+        19, 106, -105, 125, 3, 20, 121, 7, 87, 96, 66, -38, -49, 66, 44, 122,
+        -22, 55, 59, 20, -7, -57, -66, -4, 61, 112, 4, -37, -16, -64, -49, 14,
+        90, 30, -70, -11, -109, -125, 122, -86, -18, 69, -67, 61, -11, 102, 99, -35,
+        -66, 58, -101, -127, -3, -13, -13, -63, -71, -106, -4, -24, -36, 110, 86, 80,
+        3, 117, -54, 3, -35, -31, -105, 103, 41, -20, -71, 38, 124, -70, -38, 124,
+        -11, -85, -62, 91, -95, -16, -58, -89, 21, 70, -35, -123, 26, 110, 52, 69,
+        92, -87, 97, -85, 18, -67, -84, -82, -50, 58, 103, -74, -99, 126, 82, 55,
+        103, -29, -5, 74, 92, -83, -115, -17, -83, 81, 83, 57, 79, -5, 1, 116,
+        -67, -25, 17, -13, -125, 6, 125, -38, -19, 78, -43, 17, 116, -107, 27, 77,
+        -93, -46, 115, 54, 124, 98, -37, 59, 60, -126, -20, 126, -73, 67, 126, -9,
+        -109, -48, 84, -106, -64, 116, 91, -101, -6, 11, -109, -53, -112, 112, 22, 52,
+        74, -32, 21, 44, 98, -21, 43, -4, -37, 49, -125, 12, 94, -113, -95, -38,
+        -16, -77, 0, 81, -115, 98, 111, 84, 18, 84, -68, -98, -96, -70, 56, -104,
+        12, -108, 92, 24, -3, 80, -3, 120, 33, 83, 9, 98, 94, -66, 65, 9,
+        95, 104, -127, 32, -5, -17, 74, 5, 89, -1, 56, 18, 75, -21, -34, -83,
+        51, 100, -38, 123, -80, 87, -5, -38, 24, 46, 68, 48, 101, 39, -94, -121,
+        72, 39, 2, 68, 76, -67, -34, -48, -64, -72, -98, -61, 55, -27, 40, 58,
+        -32, 121, 5, 59, 53, 117, -124, 65, -77, -73, -68, -32, 1, -96, 107, 56,
+        -118, -60, -89, 111, -14, 34, -81, -62, 14, 70, -52, 69, 87, 81, -119, 27,
+        110, -124, 96, -70, -113, 94, 110, -105, -104, -90, -100, 87, 27, 124, 18, -4,
+        -53, -126, 49, 14, -98, -72, 69, -29, 65, -31, -74, -12, 37, -69, -85, -8,
+        -43, -120, 114, -45, 58, -104, 115, -7, -69, 72, -113, 48, -61, 102, -14, 88,
+        -99, -10, -44, -121, 64, -23, -15, 66, -52, -30, -62, 51, -110, -128, 42, 9,
+        92, -67, -86, -97, -70, 125, -16, 65, 116, 15, -35, -44, 33, -22, 72, -112,
+        -33, 110, 70, 65, 18, 112, -7, -83, 103, 14, 54, -77, -113, 90, -45, -123,
+        28, 49, -100, 109, 119, 3, -89, -37, 42, 96, 98, -29, 71, -19, -19, 29,
+        118, -97, 59, -6, -20, -74, -41, 1, 51, -19, 16, 86, -24, -3, 35, -19,
+        58, 1, -12, 15, -88, -45, -8, 90, 31, -100, -85, -62, 58, 94, 42, -108,
+        -42, 41, -108, 106, 49, 119, -32, -112, -18, 69, -61, 19, -118, -38, -74, 105,
+        109, -20, -101, 53, 93, -81, -106, 108, 7, 80, -74, -101, 118, 89, -97, -22,
+        17, 71, 113, -107, -88, 80, 51, -2, -101, -76, 29, 102, 43, -45, 54, -55,
+        87, -36, -125, 55, -31, 84, -26, -94, 124, 101, 119, -100, -54, 95, 107, 31,
+        66, -87, 32, -7, 101, 117, 5, -29, -91, 60, 73, -22, 115, -98, 36, -31,
+        -92, 39, 84, 49, 127, -101, -88, -121, 44, 17, 40, -9, -88, -119, 77, -34,
+        -31, 85, -87, -33, 10, -14, -86, -60, -20, -22, 84, -107, 110, -65, -121, 3,
+        58, -124, -33, -121, -125, -41, -73, 104, 32, -72, -9, -122, 33, 26, 104, -50,
+        9, 107, 15, -44, 41, 18, 88, -18, -128, -34, 122, -5, 51, -99, -120, -1,
+        -66, -17, -56, -21, -70, 63, 125, -1, 126, 56, -46, 111, 55, -62, -3, 80,
+        89, -44, 63, -68, -84, -117, -97, -66, -105, -7, 99, 118, -117, -123, -34, -67,
+        76, 7, -109, -15, -92, 51, -106, 127, -25, -125, 76, -52, 121, 20, -70, -50,
+        96, -102, -36, 117, -110, 63, -34, 117, -46, 100, 48, -68, 31, -83, 51, 9,
+        -48, -105, 127, 79, 93, 48, -7, 103, -35, -97, 116, 96, -3, -66, -82, 47,
+        62, -9, 17, -38, 68, 21, -4, -54, -36, 7, -12, -7, 100, 35, -9, -68,
+        40, 21, 84, 21, -74, 57, -20, 78, -7, -87, 16, 83, -35, -69, 100, 81,
+        -16, -4, -121, 99, -71, -84, 44, -93, 16, -8, -10, 30, 81, -37, -60, 37,
+        -66, -122, 16, -109, 108, 56, -97, 100, -65, 111, 33, -22, -37, 15, -8, 97,
+        -47, -69, -55, 108, -6, 84, -124, -96, -99, -85, 21, -119, -109, 80, -87, 35,
+        51, 42, 117, 100, 74, 37, 24, 56, -126, -122, 105, 113, -114, 48, 4, 16,
+        -118, -74, 4, 116, -86, -123, -3, 65, -120, -5, 112, 86, -101, 22, -27, -51,
+        -44, 46, 83, 23, -102, 6, 91, 113, -74, 84, -37, 32, -21, -94, 11, 124,
+        87, 127, -10, 34, -100, -37, -10, 82, -77, 19, 75, -36, 124, 12, 101, 59,
+        103, -20, 30, 88, -118, 50, -26, 19, 94, 86, 74, -119, 59, 93, -124, -71,
+        -12, 95, 126, -30, -105, 121, -82, -3, -20, 114, 89, -52, 65, -112, 51, -33,
+        -50, -97, 5, 14, 117, 17, -121, -70, 85, 68, 121, -22, -8, 11, 69, -98,
+        32, -4, 43, 69, 46, -120, -50, 7, 104, -125, -22, 98, -10, -58, 18, 25,
+        -101, 97, -124, 80, -97, 46, -68, 106, 100, 95, 6, 38, -42, -13, -76, 43,
+        -17, 118, -31, -50, 4, 61, 67, -24, -42, 83, 102, 19, 118, -14, -41, -116,
+        88, 43, -39, 5, 65, 117, 6, 26, -37, 112, -86, 59, -90, 121, 125, 12,
+        -28, -7, 32, 115, -127, 36, -113, -50, 92, -123, -13, 30, 93, 47, 54, -63,
+        67, -62, 69, -111, -38, -62, -123, 47, 58, 68, -46, -82, -119, -114, -68, 94,
+        -123, 47, 3, -14, 29, 11, -21, 59, -31, -42, -38, 43, -66, 101, 118, -124,
+        -2, -29, 76, -56, 67, 2, 66, -33, -91, -77, 16, 35, 38, -113, 83, -99,
+        -49, -24, -46, 23, -17, 106, -22, 91, 56, -92, 80, 102, 39, -40, 91, 37,
+        -125, 25, -86, 124, 79, -126, -19, 96, -125, 33, 12, -84, 90, -35, 40, 117,
+        55, 34, 35, 6, -86, 126, -84, 65, -83, -102, 118, 79, -3, -45, 121, 95,
+        -44, 110, -46, 48, 83, -9, -120, 61, 26, -82, 102, -72, 67, 29, -33, -88,
+        -58, 119, -79, -35, 102, 82, -72, -66, -41, 93, -80, -12, 52, 125, -18, 58,
+        -79, 29, -89, -126, 90, -3, 59, -4, 14, 110, 66, -43, -15, 60, -76, 7,
+        21, -51, 117, -40, 43, -97, -23, -107, 29, 111, -40, -29, -74, 123, 103, 13,
+        -123, -64, -11, -66, 60, -83, -10, 45, -16, 89, -123, -9, 66, -45, 43, 52,
+        -101, -92, -25, 87, 104, 90, -118, -80, 63, -83, 95, -114, -49, 33, -38, 77,
+        -60, 52, 88, 71, 25, 46, -6, -79, 42, -68, -53, 87, 109, -34, -44, 96,
+        99, -30, -52, 49, 53, -71, -40, 111, 68, 93, 95, -125, 123, -51, -85, -8,
+        74, 95, 82, 77, 31, 96, -30, -36, -32, 111, -76, -126, -97, 20, -7, -35,
+        83, -15, -5, 94, -4, 125, -59, -75, -14, -17, -115, 93, 111, 3, 121, -36,
+        101, 49, 63, -68, 108, 102, 90, -59, -86, -33, -3, -116, 41, 68, -39, -103,
+        40, -61, -109, -102, 106, 65, 11, 64, -60, 114, -76, -29, 127, 68, 3, -60,
+        47, -73, 111, -65, -44, -91, -43, 118, -21, 57, -17, 52, -61, -109, 85, 46,
+        20, -67, -46, 110, -109, -72, 27, 108, -38, 17, 92, -125, -119, 117, 9, -122,
+        119, -71, 7, 34, 57, 46, -109, 57, 61, 0, 48, -54, -25, 17, -5, 12,
+        50, -110, 23, 27, -8, -29, 4, -120, 116, 75, 113, -9, 7, -9, -61, -123,
+        62, -125, -50, -118, 46, 2, 101, -7, 54, -125, 88, -86, -117, -59, -114, 90,
+        -2, 51, 103, -29, -7, 102, 30, 121, 70, 32, 29, -20, -106, -21, -78, 0,
+        104, -81, -13, -18, -57, 119, 126, -49, -103, 124, -75, 33, -123, 20, 72, -10,
+        -71, -112, -71, 74, 4, 98, -34, 53, 45, 127, -25, -78, -63, 17, 16, 42,
+        -41, 30, 13, -30, 108, -74, -72, -59, 117, 121, -13, 1, 40, 31, -55, -128,
+        64, -79, -69, -3, 126, -99, -6, -96, -126, 95, 39, 38, 68, 0, 106, 53,
+        73, -2, -17, 85, 11, 63, 100, -17, -125, -73, -96, 74, 47, 48, 27, -9,
+        -49, -84, 75, -105, 76, 118, 115, 14, -66, -35, 110, 40, -64, -61, 28, -91,
+        -9, 33, -36, 7, -76, 8, 8, -76, -111, -53, -64, 70, 63, -61, -64, 86,
+        -116, -25, 81, 85, 37, 66, -114, -56, 123, 56, -39, -72, -68, -20, 91, -94,
+        -111, -62, 92, -15, 97, 119, 100, -103, -89, 30, -88, -95, 15, 28, 15, 101,
+        59, 72, 63, 66, -39, 7, -49, 70, -70, 86, -94, -15, -101, -121, -56, 118,
+        -8, 59, 22, -116, -43, -16, -74, 44, 24, 75, -47, -3, -14, 47, 69, -64,
+        -104, 105, -21, 87, 36, 42, 113, -5, -5, 94, 101, -103, -69, -31, 21, -112,
+        69, -28, 115, -104, -124, -7, -30, -110, -99, 7, 77, 87, 23, -10, -46, -35,
+        116, -29, 17, 1, 75, 22, -39, 75, 107, -60, -22, -74, -28, 2, 118, 76,
+        -83, 124, -27, 56, -6, -71, -22, 115, -81, -6, -47, 58, -24, -104, -2, -57,
+        -18, -85, 83, -74, 46, -126, -49, 116, 70, 121, 107, 115, -104, -18, 115, -103,
+        -48, 89, 11, 25, -7, 0, 104, 16, 81, 20, 57, -92, -79, -76, -102, -29,
+        -18, -121, -39, -93, 24, -43, -64, 104, -8, -16, 91, -123, 21, 32, -124, -8,
+        -22, -10, 2, -71, 121, 68, -44, -98, 14, 91, 25, 118, -84, -38, -92, 96,
+        -6, 69, -17, 53, -59, 118, -84, 97, 109, 56, -53, -108, -71, 91, -8, -119,
+        102, 58, -88, -99, 103, -42, 78, 51, 97, 80, -76, -31, -116, 77, 116, 14,
+        119, -10, -72, 9, -50, -118, 107, 59, 59, -84, -23, 108, 98, 95, -111, 109,
+        -43, -37, -93, 12, 41, -51, -14, -59, -46, 36, -26, 87, 63, -94, 14, 78,
+        -78, 114, 93, -118, -54, -44, -124, -35, 41, -125, -67, -102, 82, 101, 32, 115,
+        60, 40, 114, 103, 95, -6, 107, -36, -4, -104, 76, 16, -24, 47, 119, 113,
+        -41, -31, 74, 23, 19, 76, -81, 89, 49, 113, -52, -69, 82, 30, -103, 53,
+        105, 42, 1, -19, 93, 63, -57, 60, -11, -46, -75, -109, -34, 112, 38, 92,
+        -71, 108, -127, 93, 4, -5, 108, -76, -62, -42, -17, -96, 59, -73, 111, 103,
+        -89, 109, -57, -24, -126, 63, -83, -109, 91, -101, -3, 116, -1, 42, -4, -45,
+        90, 116, -61, 108, -3, -55, 31, -27, -116, 20, -26, -44, 4, 37, -44, -43,
+        48, 92, 114, -10, 74, -72, -115, 26, 93, -86, 121, 104, -81, 4, -63, 78,
+        48, -81, 98, -8, 48, -111, -39, 62, 125, -76, 93, -94, -67, -88, 3, 94,
+        -86, 2, 72, -51, 107, -69, -17, 115, -39, -33, 68, -57, -36, -22, 118, -104,
+        18, 126, 119, -122, -32, -86, 55, 79, 6, -68, 13, -122, -17, -116, -72, -119,
+        -48, 29, -32, 9, -69, 41, 67, 48, -82, 107, -44, 73, -123, 30, 5, 29,
+        23, -60, 32, 91, 24, -13, -14, -124, -53, -28, 18, -77, -48, -15, -51, -22,
+        -88, -33, 37, -61, -101, 46, 35, -11, 114, -92, 7, -43, -47, -49, -115, -82,
+        119, -57, -94, -10, -56, 122, 53, -37, 45, 47, 20, -102, 21, 104, 10, -112,
+        -101, -77, 45, 23, 79, -113, -29, -114, -51, -40, 65, 22, 56, 43, -61, -114,
+        4, -65, -114, 46, 37, -22, 81, -71, -93, -23, 126, 89, -70, -54, -27, 103,
+        -128, -78, 106, -119, 26, 71, 27, 92, -46, -58, 83, 7, 106, 53, -94, -113,
+        -21, 93, 73, -31, -53, 124, 94, 28, -113, 33, -6, 52, 68, 44, 117, 6,
+        -70, 17, 109, -74, 78, 51, -54, -56, 126, 89, -70, 86, -37, -89, 93, -128,
+        40, 89, 28, 73, -111, 2, 109, 66, -114, -82, -48, -120, 22, -94, 59, -106,
+        -112, -49, -7, 97, 43, -19, 6, 79, -117, -127, -120, 36, -57, 66, 55, -95,
+        -88, -84, -45, -120, 40, -70, 95, -91, 61, -54, -73, -53, 50, -64, 70, -111,
+        -91, 1, 34, -87, 50, -64, 77, -120, -78, 85, 26, -47, 68, 118, -86, -78,
+        -30, -62, 102, 6, 40, 82, -27, -111, 4, 105, -40, 38, -12, -104, 26, -115,
+        -56, -95, 122, 84, 9, -24, -16, 49, 40, -98, -61, -57, 104, -31, 8, -48,
+        102, -94, -111, 21, 26, 10, -58, -21, -50, -37, -33, 127, 44, -50, 79, -121,
+        124, 83, 28, 59, -5, -61, 110, 121, 80, 54, 38, 23, 40, 79, -121, -43,
+        -66, 56, 94, -110, -9, 23, 34, -41, -75, -103, -53, -55, -99, 31, 83, -87,
+        87, -2, 36, -77, 16, -55, -9, -25, -51, -126, -57, 126, -75, 19, -32, 106,
+        -111, 98, 75, -16, 122, -63, 47, -81, -37, -21, 44, -31, 26, 108, -91, 87,
+        117, -4, -115, -103, -22, 91, 95, -99, 38, -12, -22, -28, 126, -42, 20, 84,
+        -24, -19, 18, -61, 66, -80, 121, -90, -90, -100, -14, 5, 37, 115, 71, 1,
+        -19, -66, -70, 71, -14, 28, 70, 86, 121, -63, 31, -98, 87, -117, 69, -79,
+        37, -73, 71, 61, 22, 7, -73, -128, 42, -122, -77, -77, 55, -102, -39, -35,
+        74, 15, 36, -115, -105, -120, -52, 8, -12, 83, -37, 30, 81, 108, 23, -85,
+        -44, -2, 81, -117, -90, 24, -86, 115, -67, -73, 72, 29, 36, 100, 36, 24,
+        127, -124, 16, -79, -121, -40, 63, -11, -121, -34, -62, 63, 74, 42, -105, 121,
+        -94, 124, 41, -103, 46, 40, -3, 48, -50, 22, -59, -78, 87, 38, -27, -79,
+        127, -28, -93, 63, -99, 97, -10, -66, 7, 22, 64, -34, -17, 89, -14, -98,
+        -87, -55, -105, 76, 29, 28, -50, -17, 93, -2, -40, -90, -85, -68, 29, -74,
+        -28, -51, -77, 35, 63, -105, 95, -120, 44, 94, 60, -16, -49, -104, -25, -16,
+        6, 39, -30, 118, -66, 21, -52, 61, 9, 118, -21, 31, -92, 80, -46, 99,
+        71, -77, -70, 35, -26, 28, -85, -83, 80, 38, -46, 54, -74, 18, 62, -43,
+        -98, 81, 2, -112, -8, -62, 56, 30, -5, 123, -19, 101, 27, 0, -54, 71,
+        55, 33, 80, 108, 76, -49, -81, 83, 31, 17, -11, -21, -60, -104, 100, 80,
+        -53, 57, 21, 81, -71, 12, 14, 6, -25, -92, 1, 80, -7, -100, 10, 14,
+        -45, 97, 54, -65, 26, 25, 101, 37, -97, 66, -26, -22, -122, 67, -83, 126,
+        45, -6, -112, 71, 72, -36, -72, 98, -115, -85, 4, -11, -102, -123, 32, -87,
+        -118, 81, -118, -58, 68, 86, 125, 8, -41, 103, 18, 16, 84, 100, -11, -6,
+        71, -123, 24, 21, -27, -108, -72, 11, -57, 105, 127, -5, -78, -103, 21, 98,
+        -100, 95, -86, -32, -88, 58, -92, 105, -98, 30, 23, -106, 80, 6, 45, -60,
+        -40, 47, 78, 15, 71, -35, 45, -78, 62, -52, -93, -126, 15, -117, -108, -2,
+        81, -29, 58, 126, 48, 104, 122, -99, 119, -125, 119, 93, -15, 87, -25, 93,
+        -39, -50, 106, 59, 23, -125, 64, 61, -19, 69, -76, 85, 30, -38, -40, 109,
+        -127, 53, 124, -12, 102, -69, -28, -32, 65, 110, -74, -36, -104, -95, -79, -37,
+        23, -118, -104, 82, 28, 33, 76, -21, 59, -128, 2, -123, 13, 67, -73, -4,
+        -64, -20, -78, -35, -89, -113, -65, -124, 7, 107, -73, 81, 31, -32, -69, -72,
+        78, 39, -102, -57, -46, 89, -93, 8, -68, 44, 107, 92, -69, 1, -10, 95,
+        -51, 113, 106, -113, -112, 113, 40, -34, -58, 43, -29, -84, 124, -122, 113, -103,
+        -98, 96, -52, -53, 73, 30, -27, -59, -83, 56, -123, -26, -13, 51, 81, -43,
+        3, 65, 55, -82, 1, -16, -86, -71, -37, 52, 23, 36, 101, 109, 120, -45,
+        32, 41, 109, -45, 125, 6, -69, -47, -26, 97, -51, -120, 109, 49, 36, -126,
+        -47, -26, -80, 39, -16, -5, -5, -125, 55, -92, -4, -4, 95, -11, -107, 44,
+        -43, -31, 71, -48, 57, 109, 70, -9, 48, -100, 25, 19, 87, 7, -11, -23,
+        121, 119, 88, -3, 42, -33, 123, 92, -109, 57, 123, 73, -56, -97, 67, 67,
+        -125, -51, 79, 17, 10, 17, -77, 78, 48, -12, -104, 123, 100, -33, -86, -82,
+        -124, -109, 60, -48, 33, -30, -38, -98, -47, 105, 32, -30, -6, 70, -56, 62,
+        -70, 110, -124, -10, -43, 106, 2, -68, -109, 64, 106, 108, -109, -10, 29, 98,
+        64, -6, -98, 102, -102, 12, 58, 83, -81, -54, 124, 22, 23, -110, -118, -14,
+        -83, -78, 24, 53, 23, -64, -33, -78, -90, -109, -35, -5, 118, -108, -99, -22,
+        94, 3, 125, -89, -86, 127, 101, -107, -113, -22, -62, 111, -94, -11, -127, -121,
+        -64, 104, 74, -20, -125, 96, 81, 106, -65, 89, 124, -45, 106, 79, 117, -17,
+        27, 82, 123, -94, 123, 77, -44, -98, -88, -2, -75, -43, 62, -90, 11, -33,
+        -118, -38, -37, -41, -74, 104, 74, -20, -85, 91, 81, 106, -65, 94, 126, -45,
+        106, 79, 117, -17, 27, 82, 123, -94, 123, 77, -44, -98, -88, -2, -75, -43,
+        62, -90, 11, -33, -118, -38, -105, 79, 90, -47, -92, -68, 54, -104, -52, 11,
+        -32, 111, 90, -17, 95, -65, -23, 41, 61, -43, -67, 38, 122, -1, -6, -101,
+        79, -20, -93, -70, -16, -51, -24, -3, 56, -84, -9, -51, 20, -1, 91, -41,
+        -4, 111, 93, -11, -81, -43, -3, 111, 65, -7, -65, 93, -19, -121, -67, 80,
+        55, -19, -67, -37, -13, 30, -60, -49, 28, -9, 12, 23, 96, 2, -94, -88,
+        -35, 33, 26, 107, 109, 54, 121, 127, -57, 27, -99, 73, -28, -29, -115, -95,
+        -125, -119, 76, -24, -111, 59, -99, 88, 27, -124, 12, 29, 81, -4, -46, 33,
+        -70, 102, 109, -45, -63, -70, -56, -58, 67, -55, -49, -22, 91, -25, 83, -82,
+        5, -8, 29, 104, -78, 70, -80, 84, 4, -82, -10, 116, -88, -85, 107, -50,
+        57, 81, 94, -37, -62, -121, 69, 25, 125, -29, 79, -116, -42, 106, 92, -8,
+        -40, -24, -105, -42, -71, -90, -83, -33, 90, -21, 26, -75, 31, 74, 64, -48,
+        76, -13, -94, -123, 28, -44, 61, -2, -28, -82, -89, 125, -16, 12, 111, 64,
+        -9, 2, 7, 121, 57, -51, 99, 78, -13, -42, -21, 93, -32, 72, -17, 23,
+        -41, -70, 70, 109, -33, 92, -25, -30, 91, 39, 52, -82, -98, -33, -127, 38,
+        -81, -46, 54, -26, 52, -75, -85, 107, -43, -71, 106, 94, -47, -40, -61, -43,
+        -116, -106, -111, 39, -84, 107, 85, -116, 61, 102, -3, -91, -11, -85, 65, -61,
+        -73, 86, -82, -40, -90, -3, 54, -21, 120, -52, 53, 118, -115, 78, -111, -89,
+        -38, 93, -123, 66, -25, -37, 121, -99, 10, 29, 114, 103, -44, -118, 59, -23,
+        94, -85, 89, -95, -29, -18, 95, 90, -71, -102, -75, 125, 107, -3, 106, -48,
+        -70, -33, 108, 4, -65, 3, 77, 94, -93, 104, -36, 77, 3, 87, -41, -32,
+        -99, 3, 94, -43, 2, 23, 15, 24, 77, 99, 110, 31, -44, 42, 90, -32,
+        10, -62, -105, -42, -77, 70, 77, -33, 90, -51, -30, 27, -9, 91, -83, -25,
+        53, -33, -32, 53, 58, -58, -36, -4, 112, 85, 12, -36, 1, -31, 53, -116,
+        -65, 8, -62, 40, 24, 125, 27, -92, 86, -65, -8, 43, 33, 95, 90, -67,
+        -102, -76, 124, 107, -19, -118, 110, -37, 111, -76, -106, -49, 108, 115, -41, -88,
+        22, 125, 11, -57, 55, 94, -10, 62, 78, -56, 116, 49, -105, 114, 88, -61,
+        69, -36, -52, -119, 48, 91, -52, -11, -100, 47, 111, -76, -94, 27, -66, -67,
+        -55, -118, 107, -102, 50, 88, 97, 30, 115, -115, 93, 103, -84, -4, -37, 80,
+        -32, -46, -81, 62, -41, 108, 127, 45, -113, 29, -105, 57, 11, -54, -110, -37,
+        63, -43, -21, 61, 115, -112, -96, -121, 123, 101, -114, 70, -103, -127, 81, -2,
+        -55, -27, 83, -118, 58, -111, 98, 58, 24, -89, 99, -107, -96, 113, 50, -56,
+        -18, 4, -118, -79, 3, -108, -106, 64, -22, -17, 63, -34, -85, -97, -17, -42,
+        19, 9, -45, -103, 96, 116, 125, 8, 121, -41, 81, -80, -21, 126, 0, 84,
+        -1, -3, 71, -35, -10, 93, 71, 1, -90, -125, 105, 50, 5, 93, 76, 52,
+        16, -105, 27, -77, -30, -23, 110, -97, -49, -27, -53, -27, -55, 32, 115, -117,
+        -76, -58, 87, 0, 83, 15, 66, 103, -45, 105, -111, 17, -52, 69, 97, 27,
+        73, -35, -30, -14, -68, 100, -43, -115, -95, -41, 13, 125, 11, 73, 8, 81,
+        -66, -117, -73, -38, -54, -76, 13, 31, -46, 110, 103, 121, -56, -49, -57, 121,
+        -66, 46, 62, -56, -29, -41, -35, -50, 76, -123, 4, -74, 98, 93, -7, 97,
+        40, 63, -24, 92, 65, -85, 95, -27, 25, 95, 115, -8, 91, -67, -39, 106,
+        34, 45, -59, -58, -34, 12, -109, 63, -38, -61, -64, -94, 121, -103, -30, 85,
+        -2, -19, 37, -104, -64, 42, 12, 79, 101, -62, 12, 9, 29, -94, -62, 108,
+        -39, -19, -24, 43, 85, 63, -118, -58, -44, -117, -99, 29, -112, -93, -99, 126,
+        -114, -64, -26, -17, -77, -84, 33, -16, -102, 34, 56, -36, -52, -87, -16, -70,
+        -66, -109, 103, -111, 3, 45, 33, 101, 65, -19, -23, 12, 80, -31, 12, 77,
+        -76, 74, 117, 67, 13, 34, -59, -127, 13, -126, -109, -66, 85, 39, -54, 51,
+        -66, -44, -55, -35, -2, -25, 98, -10, 113, 117, -22, -65, 28, -91, 57, 45,
+        -42, -59, -4, 100, 10, 54, -69, 95, -3, -81, -34, -121, 64, 47, 93, -3,
+        -123, 29, -43, 122, 123, 49, 122, 75, 84, -122, 122, -51, -67, 117, 94, -103,
+        -47, 88, 60, -125, -45, 46, 63, -102, 73, -95, -6, -79, -1, -85, -71, 32,
+        -112, -36, 27, -109, -85, 63, 51, -55, 36, 113, 33, -66, 16, -92, -53, -28,
+        125, 64, -99, -101, -63, 45, -39, -28, -81, 38, 68, 50, -54, -110, -3, 43,
+        44, -30, 50, -20, -24, 82, -12, -8, -76, -2, 68, 63, 117, 45, 92, -101,
+        125, -25, -6, -50, 90, 27, 3, 31, 123, -85, 10, -127, 55, 123, 97, 28,
+        85, -115, -71, -117, 101, 43, -124, -18, -58, 34, 80, -13, -68, 100, -44, 93,
+        34, 84, -93, 41, -69, 108, -75, -122, 108, 112, -40, -21, -120, 93, 102, 77,
+        -79, 26, -96, -18, -60, 16, 87, 105, 29, 117, -16, -18, 77, 0, -123, -16,
+        14, -30, -85, 119, 50, -8, -61, -16, 86, 113, -4, 39, -69, -83, 58, 83,
+        111, 118, -5, -22, -29, -35, -95, -16, 85, -90, 75, -38, 57, 87, -36, -20,
+        -19, 95, 66, -111, -20, -56, 29, 28, -97, 119, -97, -27, 30, 85, -23, 18,
+        77, -127, 126, 40, 69, -106, 118, -99, 76, 67, -106, 101, -37, 83, 46, 108,
+        -16, -127, 27, -5, 126, -10, 21, 123, 19, -63, -23, -105, -82, 100, -123, 109,
+        -51, -89, 20, -83, -15, -93, -74, 68, -38, 79, -1, 51, -4, -30, -24, 3,
+        97, -98, -67, -18, -1, -20, -97, 75, 96, 114, -15, 32, 115, 100, -7, 103,
+        -97, -35, -88, 123, -54, -56, -69, -2, -29, 24, -66, 110, -121, 41, 121, 101,
+        84, 22, 14, -35, 110, -83, -106, -106, -61, 54, 70, 89, 25, -54, 35, 116,
+        -106, 24, -26, 93, -18, -51, 118, -100, 104, -113, 82, -47, 78, -65, 19, -22,
+        2, 127, 6, -28, 122, -44, 88, -70, -48, 49, -42, 62, -62, -21, -118, 15,
+        -65, -67, -61, -126, -39, 22, -23, -25, 24, 60, -99, -8, 44, -70, -85, 83,
+        -124, -53, -4, -50, 31, -5, -14, -9, -73, -63, 102, -73, -56, -41, 122, 64,
+        -86, 31, -85, 1, -103, -103, 121, -82, -2, 108, -50, -10, 39, -91, -41, -44,
+        -97, -53, 52, 72, -91, -65, -44, -33, 53, 1, -56, 55, -21, 2, -28, 72,
+        -11, 39, -2, 122, -87, 41, 111, -29, 9, 81, -43, 122, -97, -117, -64, 107,
+        19, -2, -31, 58, 48, 39, -15, 32, -43, -53, 15, -76, 12, 17, 11, 16,
+        -13, -33, 32, -103, 102, -88, 118, -61, 39, 32, 101, -29, -11, -81, 64, 106,
+        -44, -10, 33, 104, -30, 118, 53, 9, 112, -82, 1, 80, -59, 29, 6, 38,
+        -6, -102, 57, 85, 43, 86, 60, -89, -43, 105, -83, -14, 82, 86, 73, -10,
+        6, 72, 73, -11, -77, -86, -3, -91, -48, 113, 95, -13, 76, 97, -107, -11,
+        31, 127, 110, 70, 0, -82, 21, 36, -96, -12, 106, 79, -85, -41, 98, 97,
+        18, -118, -103, 43, -54, -98, 127, -125, 99, -80, 74, 118, -88, 102, -7, -64,
+        75, 89, -22, -27, -49, -27, -109, 112, -81, 54, -109, 70, -7, -27, -84, -25,
+        35, -27, -46, -57, -116, 118, -79, 40, -56, -41, -69, 37, 113, -1, 84, 55,
+        -95, 42, -103, 1, -20, 116, -52, -68, -35, 76, -69, 73, 5, 50, 120, 18,
+        -110, -19, -32, -122, -56, 7, 38, 7, 35, -109, -100, 88, 62, 46, 89, 61,
+        -117, -90, 71, -78, 124, -73, 50, -23, -11, -27, 28, 61, 62, -13, 70, 76,
+        -5, 38, 1, -125, 6, -107, 83, 21, 10, 84, 117, 4, -46, -92, 65, -114,
+        39, -63, -91, 57, 91, -63, 44, -11, 7, -55, -80, -117, 25, -35, 63, -50,
+        15, -14, 1, 22, -103, -111, -50, 72, 78, 13, 113, 41, 62, -24, 85, 16,
+        -117, -123, 127, 8, -32, -79, -99, 48, -77, -104, -117, -100, -59, 80, 74, 97,
+        84, -94, 22, -113, 114, 33, -114, -34, 56, -107, -12, -84, 68, -84, 96, -21,
+        -26, 45, -14, -80, 104, 59, 50, 45, 53, 53, -49, 62, -46, -105, -1, -7,
+        -117, -18, -64, -15, 52, -99, -80, 91, 7, -43, 108, -62, -18, -5, 30, 111,
+        -14, -29, 123, 54, 118, 42, 78, -72, -90, -82, 63, -90, 101, -1, 22, -121,
+        -35, -34, -90, 117, -43, -65, 1, 111, 94, 102, 96, 53, 37, 42, 13, 67,
+        -30, 126, -123, -37, 113, -115, 12, -105, -45, 98, -73, -110, -57, -89, -49, -64,
+        94, 125, 122, 14, -67, -11, 81, -11, -83, -21, -46, -91, -58, 53, 92, 114,
+        56, -59, 114, 44, 95, -4, -115, 16, -121, -82, 18, 45, 53, 7, -57, 47,
+        42, 18, -102, -19, 102, 50, 82, 121, -121, -6, -77, -30, -12, -71, 40, -74,
+        -2, 124, -99, 114, -94, 93, 110, -62, -52, -6, 69, 70, 117, -102, -52, -101,
+        -99, -86, -19, 94, -109, -29, -21, 98, -98, -94, 116, -102, -122, 37, 120, 70,
+        67, -49, 62, -92, 41, 24, 100, -35, 78, 4, -20, -85, -127, -75, 78, -118,
+        -102, 83, 51, -115, 24, -4, 49, -64, -81, 77, -128, 37, 102, 104, 52, -43,
+        84, -59, 125, 89, 17, -27, 7, 118, -16, 121, 115, -101, 106, 4, -88, -23,
+        -67, 103, 18, -91, -74, 62, -56, 13, 119, 101, -62, 24, -27, -77, 90, 103,
+        113, -23, 105, 75, 72, -19, -99, -121, -124, 34, 70, -127, -86, 81, 108, 23,
+        -113, 33, 105, -37, -114, -8, -114, -96, -102, -77, 89, -87, -42, -103, -29, 114,
+        34, 7, -75, -106, 3, -86, 31, 73, -60, 4, 48, 46, 121, 121, -3, 104,
+        10, -35, 83, -88, 31, 79, -70, 99, 63, -1, -31, 2, -43, -68, -114, 123,
+        -127, 11, -39, -34, 82, -49, -32, 77, -31, -18, 42, -71, -88, 41, 51, -36,
+        122, -21, -103, 52, 115, 38, 41, -105, 106, 67, -59, -23, 42, 126, 86, 86,
+        -81, -122, -63, 84, -77, 122, 104, -42, 34, -76, -103, -44, -31, 2, 116, 36,
+        23, -96, -95, 123, -120, 26, 120, -67, -20, -103, -97, 94, -41, 62, -110, 59,
+        14, 73, 121, -85, -117, -81, -101, -90, 99, 85, -39, -54, -24, 101, -67, 22,
+        -45, 41, 97, -1, 47, -48, -31, 85, 76, 80, 83, 119, 56, 53, -77, 43,
+        99, 31, -125, 59, -87, -125, -75, -72, 23, -95, 121, 44, 90, 51, 122, 108,
+        -71, -15, -128, -47, -8, -56, 41, 98, -55, -62, -110, -34, 108, -102, 13, -18,
+        -17, 0, 19, 43, 76, 66, -96, 125, -95, 81, 55, -32, -108, -59, 116, 27,
+        -114, -71, -40, 56, -50, -71, 112, -79, 28, 116, -21, -111, -100, 36, 88, 57,
+        -99, 76, 89, 86, 110, 22, -73, 98, -91, -63, 116, 35, 86, 58, -40, 88,
+        86, 58, 112, -47, -84, 116, -22, -59, -78, -14, -2, 62, 101, 89, -71, 94,
+        -34, -118, -107, 6, -45, -115, 88, -23, 96, 99, 89, -23, -64, 69, -77, -46,
+        -87, 23, -53, -54, 52, -67, -65, 103, 121, -7, -70, -66, 21, 47, 13, -90,
+        27, -15, -46, -63, -58, -14, -46, -127, -117, -26, -91, 83, 47, -102, -105, -93,
+        16, 47, 111, -56, -52, 27, 115, 51, -102, -99, -83, -7, 25, -59, -48, -63,
+        105, -73, 91, -97, 86, 123, 27, 79, 82, -65, 84, 75, -34, -69, 50, -102,
+        -84, 11, 42, -34, 13, 19, 16, -4, -43, -123, -12, 27, 45, 110, -87, -13,
+        64, 75, -123, 89, -79, -66, -125, -65, -14, 17, 101, 93, 78, -27, 126, 44,
+        -73, -66, 45, 16, -36, 28, 39, -49, 107, -107, -128, 77, -126, -66, -70, 74,
+        -75, -40, -65, -57, 5, -7, -31, 32, -40, 108, -18, 18, 14, -18, -68, -98,
+        -21, 114, -93, 61, -55, 96, 44, 1, -120, 80, 29, -108, 71, -41, 73, 110,
+        -25, -18, 47, 98, 86, -102, 39, 87, -98, -14, -51, 106, 13, -106, -13, -102,
+        -93, -7, 86, 6, -100, 15, -85, 39, -5, 120, -117, 121, -87, -18, -80, -55,
+        -41, -24, -87, -106, 113, -126, -105, 92, 114, -73, 24, 36, 55, 84, -17, 114,
+        -126, -33, -113, -89, -4, 112, -94, 15, -98, -88, -113, 102, 66, 92, 125, -64,
+        -101, -123, -113, -21, -30, 36, -25, -30, -10, -12, -127, -23, -112, 10, -69, -88,
+        -120, 75, -7, 5, 37, 45, -82, -128, -100, -118, -6, 125, 27, 85, 81, 77,
+        -109, -55, 80, -75, -93, 105, 116, -108, -25, 17, 69, 106, 85, 21, 102, -65,
+        -60, -47, -116, 110, 9, -33, 25, 32, -39, 95, -80, 48, -67, -96, -69, -89,
+        70, 93, 47, -53, 53, -91, 75, 108, 123, 101, -110, 76, 63, 68, 108, -105,
+        -95, -17, -34, 61, -78, 111, -62, -40, -109, -118, 74, 81, -44, 34, -16, 109,
+        0, -69, 32, -40, -85, 79, -73, -20, 119, -5, -67, 92, -43, -81, -123, 108,
+        100, 122, -51, -1, -13, 39, -79, -76, -4, -59, -23, 76, 15, -42, 21, -27,
+        46, 111, -52, 114, -97, -72, -96, 76, -46, -36, -67, -90, 47, -106, 49, 53,
+        125, 42, -7, 103, -97, -11, 121, -92, 35, 23, 100, 7, 59, 110, 112, -44,
+        -105, -82, -39, -69, 73, -32, 54, -110, 23, 85, -74, 6, 45, -98, 96, -75,
+        72, 12, -78, -65, -40, 46, 92, -10, 115, -73, -61, 105, -26, 63, -58, 112,
+        -96, 70, 121, -19, -67, -19, 107, -88, 34, 5, -23, 83, 87, 10, 82, -81,
+        -97, 125, 81, 70, -53, -22, -26, 50, -41, -101, 36, 55, -112, -70, 30, 63,
+        65, -79, 107, 16, 87, -14, 76, -22, -58, 43, 71, 29, -35, 29, 82, 94,
+        100, -73, 74, -111, 25, -69, -32, -53, 44, -23, -36, 72, 106, -50, -66, -45,
+        13, 100, 33, 7, 83, 80, 18, -54, 105, -70, -126, -128, 71, 29, -66, -51,
+        49, 72, -47, 69, -118, -108, -94, -81, -108, -88, 50, 53, 87, -116, -63, -101,
+        11, 94, -19, 52, -122, -60, 110, 127, 81, -5, -114, -44, 94, -99, 55, 89,
+        -18, 82, 7, -111, -100, 89, 49, -47, -67, -48, 97, 36, 48, -3, -91, 30,
+        117, 8, -99, 76, 42, 73, -31, 15, -82, 17, -45, 97, -7, -42, -64, 110,
+        -81, -50, 29, -21, 68, 6, -6, -105, 106, -87, 48, 53, 75, 5, 91, 0,
+        -106, 10, 114, -13, 20, 23, -78, 111, 49, -102, -14, -64, -85, -29, 22, 34,
+        -6, -55, 113, 92, -95, -39, 17, 24, -89, 114, -28, -87, 22, 91, -85, -35,
+        -55, 20, -26, 96, -118, -37, -95, -8, -35, 101, 92, 51, 112, -90, -123, 1,
+        -63, -25, -125, 29, 32, -14, -91, 121, 12, 66, 60, 64, -24, 64, -44, 61,
+        90, 83, 18, 45, 52, 33, -44, 113, 4, 112, -26, 0, -22, 30, 12, -80,
+        -64, 112, 9, -25, -93, 114, 22, 112, 25, 3, -32, -67, 127, 77, -88, 99,
+        -41, 95, -7, -31, -31, -27, -81, -4, 60, -93, -29, 13, -69, -65, -83, -1,
+        -94, -42, 127, -98, 69, 98, -42, 127, -127, 55, 113, 74, -101, -43, -20, -120,
+        3, 101, -55, -4, 103, -48, 73, 117, -31, -34, 27, -94, -84, 85, 101, -72,
+        59, 3, -92, -102, -31, 5, 40, 49, 8, -4, -7, 3, 53, 22, -40, -10,
+        30, 30, -14, 39, -75, -57, -59, 21, -77, -21, 83, -36, -47, 118, -85, 85,
+        103, -70, -88, 102, 57, 101, -5, 53, 11, -58, -97, 113, 79, 123, -80, -82,
+        40, 119, -118, -3, -59, -21, -121, 48, -61, -112, -47, 39, -75, -94, 123, 77,
+        119, 75, -66, 95, -125, 2, 76, -21, 120, -54, -87, -106, 40, -88, 114, 50,
+        79, -71, 112, -110, 69, -50, 36, -113, 82, 78, 59, 31, 124, -5, 26, 116,
+        -30, -27, 72, 104, -51, 78, 121, -125, -101, -117, -109, 21, -59, -59, 61, 35,
+        67, -86, 87, 68, -9, -19, -126, 39, -90, -45, 122, 113, 30, 26, 52, 98,
+        81, -18, 14, 26, 103, -53, -31, -6, 33, -13, 24, -93, 87, 53, 22, 13,
+        -84, -120, 90, 19, -34, 116, -8, 49, 72, 8, -59, -12, -71, 72, -75, 69,
+        65, 81, 3, 48, 122, -124, 125, -3, -111, 122, 29, 75, -32, 66, 51, -68,
+        -45, 114, -35, 88, -115, -106, 62, 43, -73, 11, -66, -84, 16, 28, -85, 65,
+        2, -102, -116, 86, -77, 55, 19, 26, -82, 26, -60, 29, -79, 120, -85, -24,
+        43, -6, 56, -70, -57, 77, -57, 25, -121, -123, -48, 42, -110, 126, -86, 61,
+        6, -112, 26, 110, 73, -25, 70, 3, -18, -19, -21, 17, 12, 54, -64, -109,
+        -16, 62, -39, 117, 35, 41, 94, -64, 33, -55, 92, -48, -111, -74, -32, 96,
+        10, 19, -47, 98, 52, 85, 115, 91, -67, -62, 13, 112, -103, 3, 101, 31,
+        82, 87, 70, 34, 75, -34, 63, 54, -97, -65, -5, -55, 95, -15, -71, 76,
+        -86, 82, -105, -104, 112, 71, -51, 42, -72, -91, 76, 117, 43, 46, -102, -85,
+        106, -85, 49, 100, -95, -44, -70, -45, 53, 80, -18, 22, -22, -17, 114, 78,
+        65, -111, -34, -44, -44, -47, 56, 8, -115, -92, -40, 72, 53, 70, -61, 93,
+        53, -85, -8, -6, -10, -16, 74, -82, -96, 32, 82, 18, -38, 61, -66, -50,
+        24, -58, 42, 64, 64, 118, -90, -109, 113, -74, 48, 68, -127, 26, -77, 120,
+        28, -5, -73, 38, -71, 93, -60, 110, -89, 14, -28, -75, -21, 61, 56, 25,
+        -40, -79, 113, 55, 32, -67, 93, 114, 106, 27, -78, 27, -79, -111, 3, -81,
+        -19, -34, -64, -34, 53, -69, 95, 16, -40, 59, -114, -72, 97, 16, -86, -19,
+        74, -18, -95, -40, -20, 79, 103, -25, -102, 57, -36, 40, -27, 69, -117, -9,
+        89, -69, -99, 48, -64, 43, 43, 25, -80, -11, -6, 54, -104, -25, 66, 42,
+        -57, 98, -19, 31, -44, -81, -54, 6, -24, -18, -111, -16, -16, 47, -13, 103,
+        -5, 18, -27, 62, -33, -10, -49, 21, -88, -119, -49, 112, 55, -12, -24, 59,
+        94, -72, -78, 29, 62, -50, -2, -45, -70, -56, 15, 15, 66, 37, -98, -127,
+        103, -124, 85, -61, 15, 83, -86, 125, 78, -47, 104, 126, -46, -69, -89, -96,
+        59, -24, 92, 119, 95, 125, -78, 23, -13, -91, -42, 62, -55, -85, 50, -22,
+        49, -25, -43, 90, 30, 57, 49, 119, 21, 3, 69, -12, -83, 65, -13, -126,
+        -70, -96, 81, 94, 28, -116, -66, 27, -120, 9, -12, 47, 4, -94, -14, -2,
+        -74, 120, 61, -11, -100, 111, -94, -123, 79, -50, 55, -101, -106, 30, -79, -8,
+        -51, 124, 117, -86, -117, 117, 83, -113, 104, 69, -25, 76, -64, -33, -107, 49,
+        -20, 94, -120, 59, -111, -1, 67, 103, 18, 98, -102, 80, -11, -88, 110, 83,
+        -115, -120, -2, 48, 77, -12, 77, 27, 37, -68, -66, 81, -119, 57, 88, -98,
+        40, 2, 98, -110, 47, 124, 11, -5, 47, -66, -102, -46, 71, -9, 54, 101,
+        8, -91, 98, 71, 13, 69, 84, 53, 73, 96, -112, -41, 68, 37, -9, -95,
+        -53, -76, 60, 33, -107, 122, -99, -116, -112, 102, 0, 80, 81, 80, -74, -109,
+        60, 82, 124, -77, -20, -22, 36, 71, -87, -33, -51, 117, -6, 118, 29, 13,
+        12, 12, 105, 46, 14, -69, -75, 59, 54, -20, 103, 41, 6, 118, -42, 95,
+        122, -60, -118, -31, 117, -73, 72, -35, 91, 70, -26, -77, 49, 56, -39, -5,
+        50, 42, -99, 60, -126, 39, -89, 67, -63, 100, 25, 107, -84, 78, -71, 90,
+        65, -56, -112, -112, 47, -119, 65, -102, 105, 59, -45, 92, 24, 49, 124, -118,
+        100, -77, 125, 94, -103, 46, 84, 25, -81, -104, 22, -40, -102, -86, 16, 102,
+        -32, -86, -40, -26, 37, -37, 42, 51, 102, -107, -68, -70, 127, 99, 8, -46,
+        -5, 83, 12, 25, 118, -102, -55, 20, -9, 87, -30, 55, -90, -85, -86, -84,
+        -76, -81, -85, -83, -114, -119, -127, 37, -29, -16, 80, -91, 73, 83, 63, -125,
+        25, -110, -50, 94, -10, 0, -14, -104, 85, 101, -91, -90, -54, -75, 40, -8,
+        -82, -125, -63, -14, -58, -78, -4, -21, 45, -44, 43, 80, 75, -27, 2, -4,
+        -46, -71, 1, -123, -96, -36, -36, -128, 105, 58, 24, 101, 50, 117, -33, 100,
+        60, -55, 7, -103, 88, 15, -101, -20, 123, -99, -63, 52, -71, -5, 99, 38,
+        -109, -14, 117, -18, -42, -103, 40, -97, 118, 50, 7, -86, 47, 97, -28, -97,
+        117, 127, -46, -57, -43, 85, -47, -38, -7, 42, -65, 117, 18, 63, -93, 95,
+        72, -84, -33, 2, -109, -58, -110, 110, -97, 71, -102, -100, -11, -92, 67, 112,
+        78, 112, -92, -29, -79, 74, -3, -11, -57, 52, 81, -7, 14, -17, 58, 26,
+        -19, 80, 10, -64, -25, 93, -112, 75, -62, 4, -82, -26, -7, 105, 119, 56,
+        18, 6, -77, 90, -110, -39, 59, -93, -8, -62, -11, 16, 91, 78, -58, 76,
+        86, -58, 17, 77, -53, -92, -35, -60, -117, 20, 117, 52, 0, -18, -84, 8,
+        16, -78, -85, -99, 42, -3, -101, -128, 46, 78, -65, 92, -104, -20, -123, -22,
+        94, 106, 98, -17, -91, -38, 91, 123, -5, 87, 59, 74, 71, -30, 71, -90,
+        123, -78, 8, -10, 69, -2, -82, 76, -109, 36, 93, 16, -41, -65, -65, -65,
+        23, -97, -26, 47, -121, -93, -80, 92, 102, 54, -19, -81, -119, -108, 73, -117,
+        8, 102, -61, -56, -105, 24, -13, -5, 87, -77, 8, 34, 98, -79, -106, 91,
+        52, 80, -115, 47, -103, -76, 117, 37, 33, -18, -121, -90, -80, 85, 53, 59,
+        -47, -95, -90, 55, -13, 124, 47, -85, -77, 58, 40, -107, -59, -46, 109, 46,
+        61, 88, 13, -79, 2, -44, -100, 51, -123, 21, -121, 81, -99, -112, 119, 6,
+        -67, -111, -23, 4, 59, 113, 14, -126, 1, -83, 44, 115, 56, 19, 103, -105,
+        111, 53, -88, -18, -98, -102, 9, -117, 20, 32, -64, 112, 23, -64, -46, 9,
+        20, 109, -115, 32, -15, -115, -85, -106, -52, 32, -85, -74, 111, 52, -86, -51,
+        90, 1, 68, -109, 19, 16, 72, 116, -9, -102, 11, 53, -98, -37, 90, -56,
+        -15, -100, -14, -107, 98, 112, -36, -61, -3, -114, 94, -7, -5, 18, -98, 114,
+        33, 102, 62, -43, -103, 51, 83, -127, 57, -26, 98, -117, -19, 6, -81, 20,
+        -119, -32, -57, -38, 12, 68, 15, 14, -105, -69, -57, 117, -28, 116, 41, -33,
+        10, -41, -83, 44, -122, 87, -71, 44, 18, 95, -118, 98, -47, -19, -56, 110,
+        -25, -121, -50, 106, -5, -76, -38, -118, -7, 125, 39, 80, 99, -101, 111, -118,
+        -18, -37, -33, 127, 44, -50, 79, 7, -15, -29, -79, -125, 57, 115, 57, -19,
+        -64, 122, -11, -80, 59, -55, 28, 65, -93, 73, -78, 40, -106, -14, -83, 54,
+        7, -40, -25, -116, -98, 30, 18, 44, 33, 10, 28, 30, -11, 85, 90, 47,
+        23, 8, 71, -60, 6, 62, -128, -61, 12, -107, -59, -12, -8, 24, -96, -2,
+        1, -93, -10, 14, 93, 81, 45, -37, -99, 59, -31, 20, -91, 47, 82, -102,
+        69, -123, 89, -127, -65, 114, -103, 85, 94, -76, -57, -4, 74, 57, 126, -7,
+        5, 46, 43, -118, 13, 37, 71, -91, -47, -55, 123, 47, 101, -110, 48, 8,
+        66, -83, 42, 31, -27, 110, 27, -68, -31, 49, -15, 21, 68, -37, 94, 114,
+        -78, -121, -2, -116, 4, 9, 7, 92, -58, -126, -75, -38, 72, 33, 122, 74,
+        17, 52, 50, 65, -46, -45, 65, 118, 20, 18, -40, 61, 61, -51, -13, -19,
+        -89, 92, -84, 41, -53, 31, 85, -106, -123, -22, -73, -51, 2, -2, 118, -36,
+        -64, -33, 94, -41, -24, 55, -101, 88, -95, -6, 84, -98, -60, 30, -101, -124,
+        110, 85, -111, -26, -61, -72, -70, -78, 89, 21, -39, 41, -91, 76, 43, -28,
+        20, 81, 39, 109, -3, -46, 51, 89, 90, 119, -58, -74, -126, -28, -113, 122,
+        3, -104, -40, -61, -34, 94, -107, 102, -57, -67, 97, -11, 118, 41, 9, 43,
+        12, -28, -34, 107, 82, -90, 108, -45, -101, -81, 94, 37, 42, 61, 95, 56,
+        69, 4, -44, -105, -117, -109, 111, -54, -37, 52, 42, 25, -31, -86, 77, 55,
+        38, 63, -104, -109, -24, -43, -31, -83, 35, 124, -31, 38, -55, -83, 106, 58,
+        -10, 2, -11, 33, 124, -116, -74, -38, 83, 1, 28, 38, -16, 84, -91, -35,
+        -73, 16, 7, 59, -7, 118, 81, 63, -6, 17, -105, -67, -123, 67, -76, -128,
+        -32, 47, 122, -73, 16, 102, 4, 115, -12, -37, 25, -65, -8, -24, 15, -55,
+        -70, 80, 56, -118, 30, 26, -35, -57, -32, 6, 54, -45, -9, 98, -69, 48,
+        61, -73, 107, -19, -56, -82, -29, 3, 78, 95, -94, -25, -31, -114, -117, 78,
+        59, 29, 55, -84, 119, -89, 124, -82, -127, -44, 89, -81, -3, -53, -2, 94,
+        104, -16, -10, 52, -3, -49, 58, 105, -24, 46, 92, 110, 69, 17, 58, 54,
+        -13, 37, -56, -95, -88, -111, 119, -87, 117, -116, 69, -104, 10, -103, -27, -86,
+        -25, -105, -53, -124, -39, 110, 56, 4, 1, -23, -86, 68, 77, 6, 25, 48,
+        80, -22, -57, 117, -15, 22, -56, -3, -124, 76, 0, -19, 69, -43, 126, 77,
+        -56, 119, 37, -66, 9, 4, -77, -54, -65, 91, 109, -10, -69, -61, 41, -105,
+        -13, 75, -40, 90, 103, 0, 91, 66, 89, -9, 124, 46, 116, -112, 102, 44,
+        -50, 68, -90, 50, 57, 101, 17, 93, -87, -74, -112, 64, 90, 8, -61, -120,
+        -40, 126, -122, 115, -18, -64, -103, -51, -33, 124, 83, -76, 111, 42, 57, -40,
+        -44, 55, 9, 46, 71, -8, 38, 70, 64, -65, 95, -33, -124, -6, -2, 123,
+        -14, 77, -88, -29, 127, 41, -66, 9, 17, -11, -69, -9, 77, -126, -102, -96,
+        111, 50, -27, 97, -33, 36, -128, 124, -33, 100, 106, 50, -56, -30, 124, -45,
+        116, 66, 24, -38, -81, -24, -101, 54, -117, 6, -66, 9, 3, -1, 38, -66,
+        9, 36, 49, -125, 107, -16, -65, -7, -90, 104, -33, 84, 114, -80, -87, 111,
+        90, 47, 99, 124, 19, 35, -96, -33, -81, 111, 66, 125, -1, 61, -7, 38,
+        -44, -15, -65, 20, -33, -124, -120, -6, -35, -5, 38, 65, 77, -48, 55, -103,
+        -14, -80, 111, 18, 64, -66, 111, 50, 53, 25, 100, 113, -66, -55, -90, -109,
+        69, 38, -32, 43, -6, -90, -11, -78, -127, 111, -62, -64, -65, -119, 111, -126,
+        89, 33, -31, -74, -17, -33, -100, 83, -76, 115, -86, 88, -40, -44, 59, 9,
+        54, 71, 120, 39, 78, 68, -65, 95, -9, -124, -6, -2, 123, 114, 79, -88,
+        -29, 127, 41, -18, 9, 17, -11, -69, 119, 79, -81, -21, -80, 123, 50, -27,
+        97, -9, 36, -128, 124, -9, 100, 106, 50, -56, -30, -36, 83, -103, -88, 28,
+        25, -127, -81, -24, -97, 94, -41, 13, -4, 19, 6, -2, 109, -4, -45, -120,
+        52, 126, 127, 115, 80, 77, 28, -44, -88, -75, -125, -118, -12, 80, -100, -112,
+        126, -57, 46, -22, -9, -21, -93, -2, 50, -99, -44, 95, -104, -105, -86, 117,
+        83, 113, 126, -118, 118, 84, -108, -89, 106, -18, -86, -58, -66, -85, -6, -54,
+        -66, -86, -103, -77, -6, -22, -34, -86, 106, -19, 111, -50, -120, 118, 70, -79,
+        -57, -100, 42, 70, -6, -57, -93, -53, -78, -33, -83, 51, -7, 125, 58, -110,
+        -65, 60, 39, -14, 23, -28, 64, -126, -50, -93, -34, 113, -8, 78, -61, 117,
+        24, 33, 103, 1, -7, 104, 95, 47, -116, 121, 115, 48, 77, -58, 73, -125,
+        -25, 5, -11, 49, 107, -65, 45, -17, 69, 65, 2, 4, 101, -55, 31, 100,
+        111, -68, 27, -119, -67, -57, 88, -13, 102, 32, 113, 68, -79, -37, 9, -108,
+        -66, 118, -3, 62, -43, -65, -64, 71, -74, 66, 61, -65, 71, 53, -120, -34,
+        -34, -21, 87, -119, -108, 112, 54, 22, -86, 9, -25, -15, -81, -72, 106, -32,
+        57, 108, -108, -101, 48, -94, 57, -56, -102, 6, 15, -14, 5, 78, 52, 34,
+        -108, 106, 106, 80, -51, 6, -46, 91, 72, -13, -47, 123, -124, 85, 101, -45,
+        120, -34, -83, -95, -78, -95, -21, 0, -32, -67, -43, -76, -40, -72, -25, -5,
+        55, -62, 115, -117, -71, -120, -71, 51, -11, 57, 95, -99, 34, -113, 39, 75,
+        109, 7, 109, 75, -99, 42, -13, -122, -112, -3, -128, -7, 4, 64, -59, -2,
+        -21, -15, 2, -70, 56, -104, 20, 27, 92, 126, -36, -96, -14, 59, -73, 124,
+        -67, -124, -27, -87, 58, 93, -114, 0, -106, 107, -7, -116, 47, -28, 83, 117,
+        67, -63, -125, 27, -94, 35, -84, -27, -59, 4, 120, 94, -35, -83, 115, -127,
+        -89, -45, 7, -61, 55, -36, -6, -25, -4, 83, 113, -79, -103, 14, 54, -7,
+        -15, -93, -71, -24, -88, 111, 62, 8, -43, -56, 23, 43, -63, -106, 15, -23,
+        72, 94, 85, -24, 73, 107, -44, -55, -78, -9, 61, 115, 12, 87, -3, 59,
+        -72, -21, 118, -90, -30, -101, 42, -68, -49, -34, 75, -115, -65, 17, 34, -44,
+        51, 117, -69, 117, 104, 111, -73, 62, 82, -33, 104, -42, 73, 34, 37, -21,
+        -100, -21, 28, 28, -41, 20, 79, 36, 58, -52, -104, -46, -72, -9, 85, 123,
+        -74, 7, -34, 103, 121, -103, 77, -26, -87, 16, 62, -96, 81, 22, 11, 117,
+        -65, 108, -74, -20, -17, 15, -126, -122, -61, 25, -36, 112, -82, -90, -37, -66,
+        -10, -1, -5, -1, -2, -113, -1, 32, -104, -38, 75, -45, -92, 55, -52, 70,
+        -67, -22, -68, -11, -46, -66, -125, -46, 75, -69, 93, -72, -74, -80, 13, -107,
+        -23, -98, 27, 53, -107, -36, -119, -74, -90, -67, 116, -104, 53, 106, -21, 101,
+        62, 47, -114, -57, 38, 45, -119, 6, -46, 81, -42, -69, 27, 55, 105, 71,
+        -56, 118, 7, 46, 40, -59, 112, 110, -104, 12, 123, -61, 113, -46, -92, -107,
+        -49, -7, 97, 43, -89, 5, 13, 26, 26, 102, -126, -100, -5, 81, 111, -38,
+        -92, -99, 69, -66, 93, -94, -69, -18, -11, -51, 12, -109, -98, -48, -126, -55,
+        125, -109, 102, -42, -46, 54, 53, 34, 102, 124, 39, 88, 118, 47, 20, 46,
+        105, 70, -50, -31, 99, 19, 98, 70, -93, -34, 104, -38, 27, -89, 49, 109,
+        -120, -79, -3, -47, 25, 58, 10, 71, -107, -8, 70, -105, -11, -123, -63, -23,
+        86, 8, 85, 53, 18, 101, 105, 123, -100, -12, 2, -3, -122, -56, 5, 77,
+        -59, 65, 57, 26, -70, -103, 47, -117, 30, 51, -58, 38, 86, 64, -33, 96,
+        62, 5, 51, -60, 123, 119, 119, 106, 88, -36, -120, 77, 28, -62, 43, 88,
+        -45, 18, -91, 97, -121, 107, -7, 48, -73, -85, 52, -8, 95, 68, 87, -126,
+        -24, 111, -95, 45, -41, 52, -32, 50, 8, 105, 76, -11, -43, -45, -103, -69,
+        73, -17, 126, -36, 19, 78, -13, 86, -20, -30, 16, 94, -63, -96, -106, 40,
+        45, 75, -112, 7, 115, 56, -82, -53, -66, -112, -66, -16, -56, 111, -94, 45,
+        -83, -47, 99, -58, 96, 77, 49, -33, 60, 61, 17, -18, 73, -50, 32, 38,
+        -45, 91, -79, -119, 67, 120, 5, 107, 90, -94, 52, -20, 0, 51, 16, -52,
+        104, 89, -16, 101, 52, -124, -61, 124, 11, -11, 104, -119, 27, 48, 3, 41,
+        -122, -6, -32, 105, -59, 36, -19, 13, -27, 76, 108, 60, -70, 21, 111, 88,
+        -116, 87, -16, -92, 45, 78, -61, 11, 60, 105, -60, 92, 54, 101, 95, 70,
+        61, 2, -56, 111, -95, 33, -19, -47, 99, -58, 32, 61, -79, -33, 124, 3,
+        34, -26, -47, -61, 36, -21, 101, -73, -77, 32, 28, -58, 107, 76, 72, 75,
+        -100, -122, 35, 104, -34, -113, -71, -83, -117, -66, -116, -94, -16, -72, 111, -95,
+        39, -83, -79, 35, -90, 32, 45, 49, -97, -4, 25, -20, 116, -46, 27, 15,
+        123, 89, 118, -77, 25, 44, -125, -16, -102, 25, 108, 59, -108, -122, 25, 112,
+        -55, -122, -39, -68, -42, -39, 73, -65, -124, 126, -80, -88, 111, -95, 30, 109,
+        -111, 67, -122, 32, -27, -48, 95, 124, 3, 98, -42, -83, -61, 44, -67, -103,
+        5, 97, 81, 94, 99, 66, -38, 34, 45, -121, 75, -71, -40, 118, -57, -31,
+        -31, -29, -105, -78, 31, 52, -26, -37, 88, -113, 86, -72, 1, 51, 28, -53,
+        33, 62, -8, -70, 49, -23, -115, -110, -34, -24, 102, -77, 16, 6, -33, 53,
+        90, -47, 10, -93, -31, -126, -54, -15, 96, -97, -31, 38, 117, 3, -65, -47,
+        -3, 101, -76, -92, -66, -115, 91, -24, -53, -43, -83, 80, 60, 67, 42, -124,
+        75, 60, 93, 106, -63, -45, -63, 52, -5, -86, 92, 77, -36, 6, -65, 86,
+        67, 111, 3, -59, -56, -2, -95, -100, -10, 93, -86, -125, 21, 32, -1, 7,
+        120, 58, -49, -126, -9, 95, 123, 9, -120, 66, -127, -126, 51, 87, 48, 91,
+        -65, 28, -72, 50, 19, -107, -90, -118, 108, 114, 108, -103, 19, 76, 17, -26,
+        6, -114, 84, -48, 116, -103, -17, 31, 6, 35, -3, -114, 38, 17, 64, 13,
+        -117, 80, 5, 63, 48, -13, 106, -107, 36, 25, 8, 86, 62, 126, 17, 124,
+        64, 112, 79, 79, -57, -30, 84, -26, -123, -70, 38, 19, 54, 96, -32, -49,
+        -125, -39, 74, -121, 28, -113, -49, -126, -59, 31, -53, -125, 31, 105, -107, 6,
+        85, -2, 40, -13, 97, -30, -80, 30, 56, 16, 51, 112, 98, 96, 101, 120,
+        63, -6, -100, 13, -18, -113, 127, -42, -90, 44, -17, -85, 65, -83, 21, -76,
+        111, -30, -2, -78, 78, -49, 3, 81, 127, 87, -24, -44, 105, -125, 106, 9,
+        93, 2, -105, -123, -67, -14, 84, -61, 104, -15, 65, 49, 89, -58, -65, 100,
+        -52, 87, -55, 51, -104, 58, -35, -64, 120, -31, 76, 29, 92, -126, -71, 13,
+        -53, 30, -28, -57, 125, 49, -105, 41, -21, 69, -67, 46, 10, 58, -87, 79,
+        63, -1, 33, -4, -30, 73, 2, 51, -91, -125, -125, 31, -90, 122, 63, 125,
+        77, 47, 94, 59, 8, 98, -4, 58, 34, 32, -90, 89, -123, 98, -14, 122,
+        79, 64, 100, 19, -63, -100, 18, 104, -104, -110, 64, -29, -31, -32, 46, -101,
+        -90, -29, -95, -4, 91, 0, -85, -61, 23, -22, -72, 14, 121, 30, -61, 57,
+        -18, 82, -99, -53, 24, 37, -74, -82, 57, 24, -29, 84, -81, 75, 110, -86,
+        49, 28, 79, -85, -7, -57, 51, 110, -34, 14, 32, 93, -10, 88, 126, 55,
+        -65, -21, 126, 85, 104, -122, 21, 26, -73, 39, 53, -104, -4, 84, -43, 18,
+        25, -97, 88, -61, -76, 114, -36, -36, -86, -65, 2, -45, 77, -70, 28, -72,
+        112, 109, 90, -38, 44, 110, -43, -25, -51, -30, -117, -11, -39, 94, -60, 51,
+        45, -83, -105, -73, -22, -13, 122, -7, -59, -6, 92, -34, -50, 48, 77, -67,
+        -82, 111, -43, 105, -127, -23, -117, 117, 122, -20, 116, -6, -122, -67, -66, 89,
+        -73, 7, -49, -57, -109, -16, -109, -105, -48, 97, 87, -103, -127, -113, -104, 71,
+        -24, 79, -57, 98, -3, 36, -38, 56, 20, -89, -7, -13, -37, -32, 19, -125,
+        -19, 33, -75, -7, -117, -23, -125, -76, 36, -82, -43, -15, 37, 95, -81, -49,
+        125, -19, -76, 123, -18, 7, 61, 49, -54, 103, -22, -87, -30, -45, 7, -19,
+        19, -69, -32, 103, 33, -121, -45, -13, 106, -37, -67, 24, 121, -20, 95, -63,
+        -68, -46, -6, 12, -12, -79, 60, 125, 12, -66, -23, 19, 78, -22, 81, 122,
+        -16, -43, 121, 43, 4, -108, -88, -13, -71, -110, 60, 123, -124, 4, -50, 102,
+        -15, 75, -59, -14, 85, 97, 24, 113, 54, 89, -108, -31, -92, -76, 45, -51,
+        -22, -109, -55, -114, -38, -11, 88, -121, 74, 125, 71, 11, 59, 96, -60, 33,
+        60, -112, -100, 46, -40, -45, 35, -100, 111, -82, -11, 71, -2, -15, -110, -45,
+        -31, 101, 59, 23, -77, -114, -117, -61, 82, 61, -1, 43, 63, 22, 107, -63,
+        87, 49, -57, 39, 88, 40, -72, -60, -100, -28, -14, -43, -22, -79, -44, 5,
+        -9, -104, 87, -28, 33, -82, 97, -10, 54, -48, 104, 103, 98, -58, 39, -37,
+        -70, 56, 7, -60, -20, 119, -56, 69, 93, 67, -114, 126, 7, 88, 124, -14,
+        -31, -12, 17, -77, 11, 121, -16, -52, -121, 54, -122, -64, -19, -123, -6, 74,
+        -12, 65, 29, 124, 32, -85, -128, 34, -90, 30, 69, -128, -7, -114, 86, 82,
+        -14, 61, 27, 115, 22, -68, 122, -37, -58, -121, -112, -121, -82, 117, -71, -46,
+        27, 31, 64, -50, 126, 13, -124, -4, 17, -35, 70, -104, -3, -105, -100, 110,
+        61, -83, 78, -22, 36, 104, -66, -38, 94, -6, -69, 126, -11, -11, -63, 124,
+        -123, 99, 54, 80, -24, 32, -108, 11, 103, 23, -99, -8, -58, 33, 67, 69,
+        8, -107, 92, 55, 56, -104, -28, 39, 26, 17, 46, 65, 120, 84, 98, 87,
+        7, -111, -6, -42, 23, -117, 82, -122, 72, -86, 28, 33, 85, -20, -59, 56,
+        49, -101, 31, -39, 18, -127, 71, -113, -120, 126, 82, -99, -8, -91, -118, -121,
+        25, 56, -23, -105, 81, 16, 89, 2, 14, 4, 83, 0, 83, -128, 98, 74,
+        66, -120, 121, 125, -107, -19, 22, 1, -40, -61, -97, -46, -9, 84, 22, 70,
+        -2, 70, -126, 105, -45, 115, 97, -83, 59, 0, 53, -117, -81, 10, -42, 124,
+        32, -127, -113, -13, -61, 78, 40, 66, 9, -85, 127, 39, 65, 95, 113, 95,
+        -5, -81, 124, 111, 95, -35, -2, 10, -32, 64, -113, 95, -67, 62, 11, -8,
+        80, -81, 95, -35, 126, 11, -8, 64, -49, -49, 78, -49, -49, 124, -49, -49,
+        94, -49, -49, -95, -98, -97, -3, -98, -97, -125, 61, 63, 123, 61, 63, 19,
+        61, 95, -12, -75, -73, 112, -100, 7, 5, -94, 29, 10, -23, 101, 48, 56,
+        -122, 35, 0, -106, -121, -43, -94, 44, -105, -65, -112, -51, 33, 40, -16, 13,
+        3, -97, -28, 76, -96, 4, 83, -65, 17, 0, 125, -104, -8, -68, -4, 66,
+        1, -50, -123, -105, 117, 32, -27, 39, 12, 42, 103, 112, 104, -122, 71, 18,
+        -128, -96, -64, 55, 12, -84, 44, 16, -68, 56, -122, -90, 30, 106, -57, -19,
+        -126, -110, -17, 14, 84, -58, -35, 20, -92, -35, -107, -1, 14, -46, -84, -21,
+        -41, -108, 7, -95, 113, 101, -109, -72, 23, -25, -19, 85, 8, 100, -50, 94,
+        2, -61, 122, -119, 49, -88, -122, 71, 94, -21, 116, 101, 69, 28, -88, -18,
+        -46, 7, 54, -10, -20, 41, 65, 114, -61, -49, -39, 67, 67, 39, -17, -56,
+        109, 66, 99, 10, -27, -34, 13, -8, 90, -99, 48, -117, 105, -59, 57, -79,
+        -43, -92, 29, 115, 42, 41, -86, 21, 120, -46, -89, 65, 27, -22, 68, 75,
+        76, 3, -43, 89, -111, 6, -40, -19, -79, -120, -104, 6, -48, 81, -125, 6,
+        109, -104, 120, 122, 76, 19, 48, 74, -35, -96, 5, 29, -113, -115, 105, 0,
+        -60, 57, 27, 81, 112, -8, 24, -39, 127, 27, 39, -85, -61, 110, -105, 21,
+        114, -18, 40, 38, -103, 23, -80, -120, -107, -65, -61, -63, 83, -126, -38, -19,
+        72, 127, -125, -110, 4, -73, 11, -106, -16, -86, -89, 4, 87, -37, 108, -50,
+        -82, 27, 9, -88, -105, -39, -36, 114, 28, -82, 49, -15, -62, 28, 29, 74,
+        -34, -19, -59, 116, 74, -83, -92, -36, -49, -103, -2, -98, 37, -17, -35, 18,
+        57, -9, -47, -17, -19, -32, 50, -13, -118, 117, 114, -79, 107, 49, -94, 48,
+        43, 75, 51, -78, -78, -60, 93, -66, -44, -125, 33, -44, -20, 94, 96, -41,
+        11, 60, -65, 36, 51, 69, 25, 85, 77, -30, -43, 79, -33, 56, 88, -59,
+        -118, 64, -32, 52, -85, 72, -73, 32, -77, 37, -103, 95, 73, 98, 60, -108,
+        -69, -64, -120, 71, 118, 91, -37, 46, -85, -120, 123, 124, 31, 4, -18, -9,
+        61, -7, 87, 55, 84, -75, -1, -54, 60, -16, 88, 91, -15, 124, -95, 111,
+        66, -70, 21, -51, 99, 27, -18, 59, 21, -8, -66, -94, -5, -7, 120, 58,
+        -81, 11, -1, -77, 14, 22, -7, -40, -107, 74, -8, 59, 13, -43, -115, -55,
+        11, 117, 121, -14, -74, 93, -48, -102, 14, -38, -95, -70, 34, -105, -121, -12,
+        -19, -32, -37, 118, 70, 43, 29, 106, -119, -22, -114, 89, 52, 51, 23, 101,
+        111, -37, 37, 48, 120, 97, 107, 84, -73, -12, 50, -101, -68, -115, 124, -37,
+        62, -39, 17, 15, -101, -94, 58, -124, -26, 50, -26, 91, -11, 20, 9, 122,
+        -119, 33, 48, -79, 113, -69, 85, 122, 9, -86, 103, 120, 102, -45, -92, 77,
+        -18, 96, 122, 76, -85, 112, -98, -45, -88, 77, -14, 120, 115, 68, -117, -43,
+        -84, -89, 73, 115, -60, 113, -39, -120, -74, -48, 28, -88, 73, 115, -12, -39,
+        -53, -120, 22, -31, -116, -88, 73, -125, -28, 33, -66, -120, -10, -64, -4, -88,
+        73, 115, -44, -95, -80, 40, -22, -20, 108, -87, 25, 109, -34, 17, -93, -120,
+        -74, 102, 107, -71, 9, -33, -72, 49, 85, -83, -123, -90, -56, 13, -39, 22,
+        122, -94, -10, 113, 27, -73, 102, -115, -60, -15, 101, 38, -17, 31, -45, 15,
+        -69, 88, -96, 114, -92, 74, -40, -96, -27, 8, -29, -85, -64, -22, 49, -102,
+        -63, 29, -58, 103, -128, 106, -79, -87, -79, 27, 68, -91, 32, 106, -15, -40,
+        65, 25, 68, 101, -127, 106, -79, -103, 17, 23, 68, 102, 96, 106, 113, -23,
+        -31, 20, 68, -91, 65, 34, 122, 117, -8, 88, -41, -89, -61, -57, 122, 60,
+        -23, 5, 37, -56, 65, 113, -97, 18, 104, -120, -127, -122, 36, -48, 8, 3,
+        -115, 72, -96, 49, 6, 26, -109, 64, 25, 6, -54, 72, -96, 106, 55, -108,
+        28, -115, -55, 32, -11, 64, -121, 25, 3, 42, -61, 28, 14, 108, -58, -95,
+        -11, 65, -89, 28, -38, 105, 70, -12, -106, -58, 43, 58, -5, 89, -10, -49,
+        48, 56, 67, -109, -6, -49, -78, 55, -122, 23, -119, 83, 50, -75, 117, -90,
+        110, 29, -39, 84, 117, 108, 4, -105, -87, -83, 75, 93, -24, -18, 90, 110,
+        116, 77, -100, -20, 7, 5, -23, 28, -44, -97, -48, -26, -102, -116, 51, 25,
+        8, 16, 28, 118, -95, -98, 37, -83, -10, -111, 53, -36, -15, 103, 73, -84,
+        41, 114, -88, 125, -106, -44, -102, -94, -87, 91, 75, -74, 8, -114, -58, -32,
+        66, 69, 47, 72, 18, -123, 122, -4, 92, 18, -52, -44, -1, -28, 98, -1,
+        -12, -20, -111, -4, 92, -110, -52, -127, -87, 88, -80, -118, -112, -96, 24, -79,
+        7, 34, -9, 47, -3, -104, -76, 7, -90, 99, -55, 23, 50, -62, 76, -31,
+        -20, 31, -118, 79, -59, -31, 88, 16, -72, 109, 17, -45, 6, 87, 19, -105,
+        122, -107, -43, -85, 116, 9, -56, 112, -111, -48, 32, 41, 76, -126, -31, -127,
+        -24, -125, 106, 22, -113, 61, -74, -58, -127, -91, 8, -52, -57, 38, 3, -88,
+        -105, -14, -89, 7, 28, -110, 54, 48, 58, -52, 10, -96, -36, -48, 53, -64,
+        -123, 89, 83, -30, -92, 120, -30, 100, 114, 49, 43, 25, 55, -65, -117, -18,
+        -66, 44, 10, -43, -107, 107, 69, -78, -90, 40, 8, -43, -45, 103, 25, 46,
+        -12, -85, -49, -95, -118, 38, -31, -52, 37, -104, -114, 38, -124, 32, 87, -79,
+        102, -90, -66, 46, 12, 18, -4, -87, -40, -82, -49, 76, 117, 93, -24, 7,
+        113, -43, -7, 13, -61, 103, 120, -94, -125, -26, 49, -84, 35, -7, -21, -43,
+        112, 120, 11, -31, 13, 95, -3, 99, 35, 92, -123, 50, -102, 14, -85, -16,
+        -95, 116, 75, -119, 10, -22, -93, 58, -26, -101, 95, 5, -85, 25, -6, 22,
+        100, 0, 84, 49, -94, 22, -55, 4, 71, -67, 112, 53, -114, 17, -82, 106,
+        -31, 90, -84, 98, -31, -54, 70, -83, -88, -70, -66, 82, -71, -116, -127, -36,
+        44, -21, 114, -4, -108, -57, 42, -76, 27, 1, -57, 44, 92, -5, 13, 64,
+        33, -33, 21, 108, -120, -23, -86, 70, -59, -15, 10, -98, 100, -73, -126, 70,
+        -68, 86, 21, 56, 70, 43, 112, 71, -31, 84, 5, 94, -33, 12, 5, -112,
+        65, -16, 88, 9, 10, 66, -86, 105, -52, -45, -22, 112, 60, 93, -12, 62,
+        91, 63, -11, -53, -109, 11, -79, 7, 103, 39, -96, -70, -120, -88, 53, 52,
+        69, 67, -65, 104, 100, -118, 70, 126, -47, -40, 20, -115, -3, -94, -52, 20,
+        101, 126, -47, 58, 47, 9, -104, 32, -25, -34, 79, 76, -38, 39, -36, -7,
+        -115, -24, -72, -7, -82, 3, 108, -72, 112, 88, 22, -6, 101, 35, 91, -106,
+        122, 69, -29, -78, -120, -88, -105, -39, -62, -111, 87, -92, 20, -45, -108, 122,
+        -13, -101, -41, -110, 4, 127, -65, -49, -26, -58, -14, -9, -73, 68, -75, 20,
+        87, 115, -23, 68, 117, 9, 38, -68, -106, 92, -80, 8, 66, -11, -119, -22,
+        35, 92, 61, -27, 107, -89, 126, -27, -79, 83, 57, -44, 120, 74, -75, -98,
+        97, 4, 35, -66, -6, -56, -81, 12, 4, 98, -22, 99, -79, -96, -6, -98,
+        -60, -50, -107, -60, -100, -19, 98, 39, -105, 89, -30, 84, 75, 97, 53, 78,
+        94, -90, 46, 33, -79, 115, 37, 49, -123, 32, 92, -97, -88, 62, -126, -43,
+        -45, 80, -19, -44, -81, 60, 70, -107, -61, -115, -89, 84, -21, 25, 68, 48,
+        10, 85, 31, -7, -107, -95, -60, 100, 125, 90, 94, -90, -66, 39, -79, 19,
+        43, 49, 85, 24, -108, -117, -126, 8, 49, 94, 1, 4, 88, -85, -54, -125,
+        -36, 83, 16, 1, -10, -88, -14, 48, 7, 4, 72, 17, 48, 36, -86, -72,
+        -58, 96, 40, -104, -80, 77, 80, 32, -63, 113, -81, 32, 106, 6, -73, -126,
+        9, -114, 95, 5, 81, 55, 72, 5, -48, -84, 34, -103, 28, 114, -77, -118,
+        102, 126, 88, -51, 42, -94, -39, -79, 51, -85, -88, -26, 70, -56, -84, 34,
+        -101, 31, 5, -77, -118, 110, 78, -41, 103, -120, 112, 78, -93, -113, 21, -27,
+        -124, 115, 56, 86, 116, 115, -26, -1, 88, 81, -51, 88, -8, 99, 69, 51,
+        109, -59, -113, 21, -59, -100, -99, 62, 86, -12, -46, -74, -8, -120, -88, 37,
+        -19, -83, -116, -50, 17, -121, -95, 101, 65, 90, 22, -8, 20, -18, 5, -127,
+        101, -87, 95, 56, 42, 11, 83, -81, 108, 92, -107, 17, 53, -77, -78, -44,
+        -91, 102, -1, 90, 117, -107, 112, -26, -74, -60, 23, -40, -2, -75, 34, -123,
+        115, -25, -88, 54, 65, -18, 107, 69, 47, -29, -48, 49, 6, 2, -63, -56,
+        65, -112, 6, -22, -89, 126, -11, -79, 91, 61, -40, -127, -108, -22, 65, -26,
+        -96, 24, 5, 16, 120, -36, 63, 3, -18, -69, -114, -71, 74, 82, -19, -101,
+        -119, -3, 25, 112, -97, 116, -51, 78, 109, -126, -5, 103, -64, 125, -54, 57,
+        -69, 24, 8, 4, 35, -124, 32, 13, -42, 79, -3, -22, 99, 92, -67, -90,
+        3, 41, -43, -125, 12, -95, 24, 5, 17, 120, -36, 63, -15, -36, 87, -91,
+        97, 22, 43, -112, 32, 11, 21, 68, -120, 71, 10, 32, -52, 5, 5, 18,
+        -94, 82, 0, 20, -95, 49, -84, -54, -21, -122, -86, 2, -86, 25, -116, 10,
+        38, 60, -34, 20, 72, -35, -104, 82, 64, -31, 81, 35, 64, 102, -128, 38,
+        114, 4, -52, 0, 81, -68, -110, -49, 0, 85, -84, 34, -49, 0, 89, -100,
+        -74, -50, 0, 93, -68, 66, -50, 0, 97, -100, -42, 29, 1, 101, -124, 93,
+        61, 2, -70, 56, -61, 121, 4, 84, 49, -90, -15, 8, 104, -94, -83, -33,
+        17, 80, -60, -103, -73, 35, -96, -121, -76, 96, -53, 92, -6, 58, 121, 101,
+        58, 113, 63, -89, -22, -77, -33, 123, 89, 54, -44, 101, 84, -47, 72, 21,
+        -91, 68, -55, 88, -105, -112, -75, 50, 85, -26, -10, 78, -18, 6, -21, 30,
+        -102, -97, 112, 47, 109, 113, 90, 22, -5, -67, -75, 48, -61, 10, -122, 3,
+        25, -107, 32, 41, 3, 49, -82, 32, 88, 44, 89, 9, -29, 82, 99, -74,
+        -57, 53, 65, -3, -51, -18, -41, 126, -11, 5, 121, 14, -6, 51, 66, -112,
+        -6, 8, 60, 23, 2, 10, 125, -66, 0, 92, 67, 2, 87, 0, 85, 0,
+        -45, -56, -61, -108, -78, 120, 82, 30, -51, -40, 71, 19, -24, 80, 26, -22,
+        81, -26, -95, 26, -79, -120, 92, 121, 61, -19, -74, 39, 81, 123, -69, 83,
+        -5, -121, 23, -11, -21, 83, -66, 89, -83, -49, 48, 13, 2, -124, -63, 9,
+        21, -92, 37, 80, -27, 42, 37, -78, -54, 50, -98, -102, -60, 4, -99, 31,
+        58, -94, -37, -97, 62, -69, 21, -122, 68, -123, -95, -87, 48, -72, -9, -31,
+        71, 4, -68, -127, -98, -8, -48, 99, 31, 122, 104, -69, 51, 24, -7, -16,
+        25, -128, 79, 125, 21, 18, 16, 19, 8, -31, 21, -97, -6, -85, 83, -66,
+        94, -51, 13, -112, 60, 112, -11, -96, -65, -72, 112, -37, -35, 97, -109, -81,
+        33, -100, -2, -126, -32, 62, -21, 80, 120, 113, -48, 112, -97, 117, 88, -51,
+        124, -93, 32, 17, -36, 40, 73, 28, 24, -40, -88, 1, 26, 123, 64, -14,
+        94, -21, -53, 6, 1, 101, 30, -48, -79, -40, -84, 102, -69, -11, 2, -127,
+        77, 60, 48, 15, 100, 74, -126, 56, 4, -22, 79, 40, 13, -54, -77, -48,
+        44, -104, 106, 62, 117, 74, -113, 27, 92, -20, 92, 61, 18, 16, 114, -85,
+        -41, -127, 113, 65, -42, 75, 4, 48, -12, -14, 7, -101, -41, 78, -28, -113,
+        -6, 50, -100, 123, -51, 77, 21, -87, -89, 69, 42, 24, -17, -86, -101, 42,
+        51, -101, -41, 0, -50, -33, -68, 118, 19, 108, -88, -5, 5, -50, 71, -17,
+        -110, -127, 91, -87, 76, -88, -31, -43, 44, 75, 66, -43, 21, 67, 78, -49,
+        -121, -35, -53, -14, -39, -61, 0, 11, 61, 36, -21, -35, -25, -30, 48, -105,
+        92, 55, -41, 62, -19, 121, -40, -78, -64, -85, -14, -78, -33, -45, 85, -54,
+        2, -97, -113, -7, 94, 13, -80, 95, -67, 58, 85, -119, 87, 73, 69, 55,
+        -15, -67, 82, 119, -20, 41, 56, 19, 7, 13, 93, -30, -75, -103, -91, 15,
+        69, -2, -15, -14, 121, 119, 88, -24, 16, -88, -6, -67, 47, 127, -121, -105,
+        -127, 101, -79, 42, 33, -53, 13, 42, 116, -100, 82, -33, -119, 45, -113, 87,
+        -59, -97, -94, -124, 21, -119, 76, -40, -50, 9, -54, -120, 102, -72, -125, -109,
+        117, 13, -63, 67, -109, 49, -51, -112, 103, 37, 107, 26, -87, -50, 73, 70,
+        -76, 64, 28, -113, -84, 65, -113, -114, 70, 70, -76, 64, -97, -120, -84, 105,
+        4, -98, -122, -116, 104, -125, 60, 4, 89, -45, 4, 56, 0, 25, -47, 2,
+        117, -18, -79, -106, 6, 123, -26, 49, -118, 2, -17, -88, 99, 13, 122, 112,
+        -52, 49, 2, 63, 117, -70, -79, 78, -48, -43, -55, -58, 24, 49, 19, 7,
+        26, -21, 40, -112, 15, -98, 68, 19, 32, -109, 123, 81, -71, -109, 106, 26,
+        -39, -68, -100, -118, 69, -96, 21, 98, 72, -5, 103, -64, 43, -122, -105, -25,
+        -64, -8, 46, -101, 107, 113, 25, -61, -47, 8, 12, 42, 89, -87, -7, 67,
+        -31, 81, -68, -120, 49, 90, 13, -120, -109, 40, 79, -14, 114, 123, 36, 70,
+        11, 27, 68, 88, -90, -74, -117, 64, -120, -45, -104, -7, 8, 15, -59, -79,
+        8, -115, -41, -43, -10, -71, 56, -84, -4, -71, -123, 123, -40, 15, 85, -42,
+        71, -3, 16, 28, 41, 30, 117, -52, 15, -127, 77, 105, 116, 83, 23, -82,
+        60, -32, -121, 59, -115, -35, -101, -101, 3, -48, 115, 103, 122, 42, 101, -128,
+        2, 14, -116, 69, 84, 65, -44, -95, 50, 46, -121, 69, 100, -54, 107, -48,
+        40, -65, -62, -31, 80, -123, 53, 8, -84, -37, -32, 112, -40, -14, 26, 52,
+        -58, 51, 112, 88, 76, 113, 13, 18, 109, -4, 57, 28, -70, -76, -74, 31,
+        -62, -66, -13, -67, 16, -123, 60, 2, -104, 29, -82, 60, -34, 10, 63, -22,
+        -61, -83, 14, 24, 76, -124, 22, 85, -59, 14, 16, 7, 76, 14, 16, 7,
+        -82, 22, -75, 87, 39, -93, 123, -19, -125, -43, -94, 118, -85, 76, -23, 94,
+        79, 125, -72, 90, -44, 94, -99, 114, -20, 34, 64, -97, -43, 117, -67, 46,
+        107, -88, 36, 126, 98, -15, -58, 37, -9, 75, 101, -30, 57, 95, -12, -90,
+        26, 106, -91, 21, -118, -31, 37, -108, 86, -112, -83, 21, -43, 112, 8, -61,
+        -120, -83, 53, -102, -122, -86, 69, 53, 76, -93, -88, 0, -47, 18, -126, -50,
+        -121, 41, -100, 72, -109, -68, -112, 77, 94, 127, -119, 72, -25, 121, 27, -28,
+        30, -35, -50, 4, -31, 38, -108, 55, 123, -55, -92, 49, -19, -19, -47, -5,
+        -44, -61, -91, -42, 109, 104, 111, -16, 46, 71, 115, -54, 91, 34, -9, -24,
+        -82, 86, 127, 55, 33, 58, -6, -75, -119, -58, 20, -73, -62, -20, -111, -117,
+        86, -93, 55, -95, -72, -55, -21, 9, -115, -119, 110, -117, -36, -93, 27, 46,
+        -112, 111, 66, 118, -125, -57, 0, 26, 83, -35, 18, -73, 71, 52, 88, -78,
+        -33, -124, -26, -8, 12, -9, -115, 73, 110, -121, -102, 16, -77, -35, 67, -72,
+        -111, -112, 35, 115, -74, -73, 16, 113, 11, -52, 46, -71, 55, 21, 109, 40,
+        -43, 114, -69, 124, -26, 55, 108, -63, 19, 116, -107, 79, 44, -60, -125, -124,
+        -81, -57, 76, 65, -101, -32, 72, 107, 26, 47, 87, 12, 84, -43, -8, -10,
+        3, 104, -48, 18, -124, -86, 90, 46, 44, -88, -70, 13, -70, 16, -64, -109,
+        -43, 113, 33, 84, -75, 65, 23, 120, 52, -45, 58, 46, 76, 67, 117, 27,
+        116, 33, -128, 7, 47, 125, -120, -47, 24, -86, 25, -35, 5, 121, 37, -45,
+        73, -1, 84, 61, 40, 41, 47, 80, -69, 89, 41, -93, 82, 38, 44, -103,
+        43, -44, 94, 18, -88, 38, 109, -79, -87, 18, 2, -83, -95, 20, 9, 77,
+        -38, -94, 83, 36, -16, 45, -127, -44, 8, 13, -102, -95, 82, 35, -16, 109,
+        -32, -108, 8, 13, -102, 97, 82, 34, -16, 45, -95, 84, 8, 13, 26, -94,
+        83, 33, -16, -19, -64, 20, 8, 13, -102, 33, 83, 32, -124, -88, 41, 83,
+        31, 52, -94, -59, 79, 125, -64, -73, 1, 83, 30, 52, 104, -124, 76, 121,
+        16, -48, 0, -112, -22, -96, -119, -4, -87, 84, 7, 1, 90, -54, -88, 64,
+        35, 82, -28, 118, -13, -84, -127, -110, -87, -48, -24, 62, -105, 57, 110, 99,
+        90, 3, -32, 68, 127, 111, 99, 88, -102, 116, -97, -40, -81, 111, -46, 104,
+        -71, 123, -33, -92, 77, -17, -122, -3, -46, -71, 93, -65, -12, 111, -42, 47,
+        -35, 91, -11, 75, -1, 70, -3, -46, -71, 77, -65, -12, 111, -46, 47, -35,
+        91, -12, 75, -30, 6, -3, -110, -10, 43, 101, 86, 4, -105, 37, 126, -62,
+        -116, 37, -103, 24, 97, 73, 36, -54, 96, 113, 33, 113, 50, -40, -100, 36,
+        25, 60, 46, -101, 40, -125, -61, -124, 18, 100, -80, 104, 116, -110, 12, 14,
+        -121, -101, 28, -125, 69, 83, 38, -56, -32, 48, 57, -119, 49, 88, 68, 54,
+        57, 6, -121, 7, 39, -59, 96, -47, -104, -60, 24, 124, 111, 64, 66, -116,
+        64, 95, 100, 82, 12, 14, -57, -14, -112, 47, 86, -46, 66, 0, 4, 66,
+        85, -106, 69, -123, -64, -126, -96, -86, 47, 71, -107, 93, 101, 45, -77, 7,
+        -25, 50, 5, -78, 89, -71, -128, -17, 15, 57, -54, -125, -84, -114, -87, -15,
+        -59, 108, -119, -45, -106, -68, -39, 64, 54, -122, 47, 47, -7, -83, -31, 114,
+        -66, 8, -73, -89, 83, 40, 19, -19, 57, -119, -108, -67, -10, -100, 114, -66,
+        72, -99, 54, 86, -51, -20, 119, 43, 121, 36, 72, -35, -18, 62, 29, 41,
+        48, 69, -67, 3, -26, -10, 94, -55, -80, -88, 50, -85, 9, -31, -67, 28,
+        -67, -100, 97, -6, 115, -105, -88, 8, 82, -91, -23, -86, 9, 5, -108, 70,
+        -31, -17, 31, 55, 100, 19, -61, -10, -67, 27, -59, 53, -68, 94, -110, -75,
+        -57, 113, -75, 95, -41, 100, -19, 44, -78, 54, 83, 125, -66, 58, -52, -85,
+        -36, 53, 6, -121, -109, -16, -61, -62, -18, 101, -42, -116, -88, -42, 36, 36,
+        -39, 28, -50, -12, -89, 78, 71, 71, -13, -5, 17, 84, 60, -24, -39, 96,
+        99, 73, -71, 57, 0, 81, 15, -110, -120, -74, 18, 14, 107, -38, -116, 46,
+        -84, -123, 13, 73, -29, 84, 88, 86, 31, -2, -26, -4, 29, 53, -28, 4,
+        26, 22, 77, 57, -63, -116, 41, 89, 125, -36, -80, 31, 104, -124, 52, -19,
+        -57, 43, -85, -17, -43, 8, -115, -19, -57, 117, 29, 9, -12, 4, 15, 118,
+        -73, 59, 104, -44, -77, -51, 50, -74, 65, -62, 65, -5, 16, 73, -85, 99,
+        40, -102, 18, -53, -38, 25, -112, -58, -77, -71, 58, 63, -30, -124, -104, 109,
+        -57, 2, 74, -15, 25, 50, 36, -95, -10, 18, 14, 115, 122, -71, -58, 102,
+        52, 39, -111, -77, 57, -78, 47, -61, 111, -126, -41, -93, -53, 53, -74, -93,
+        5, 71, 24, -37, 35, -5, 50, -66, 92, 99, 63, 90, -12, -27, -107, 29,
+        7, -40, -2, 52, 55, 33, 109, 58, 19, -24, -115, 111, -125, 120, -13, 18,
+        106, -102, -79, 67, -78, 9, -41, 14, -75, -80, 36, 45, -120, 102, 109, 17,
+        -107, -61, -9, -70, 81, -46, -56, -83, -69, 29, 113, 19, -4, -58, -102, 37,
+        102, -90, -28, -95, 79, 47, 87, -38, -106, -58, -60, 114, -90, -55, 32, 24,
+        126, 59, -84, 31, 93, -82, -76, 50, -51, 121, -61, 24, 41, -125, 96, 124,
+        -71, -46, -44, 52, -17, -48, 107, 104, -108, 84, -58, -86, -75, -71, 105, -47,
+        -93, 112, -105, -80, -59, -86, -75, 69, -127, -10, 25, -101, 101, 32, -95, -39,
+        106, 111, 119, -102, -109, -49, 26, 46, -108, -27, -69, -115, -2, 63, -74, 93,
+        -118, 56, 125, -16, 76, 86, -60, -86, -83, -42, 92, -103, 87, 1, 46, -41,
+        89, -101, -57, 43, 86, 125, 110, 95, -122, -33, 4, -81, 71, -105, -21, 108,
+        -52, -29, 21, -85, 63, -73, 47, -29, -53, 117, -26, -27, -15, -118, 21, -96,
+        -37, -105, -20, 114, -91, 97, 121, -68, 102, 25, -24, -10, -122, 52, 74, 81,
+        -85, -71, 8, -125, -92, -101, 32, -20, -47, 117, 43, -70, 54, -74, -56, -66,
+        -63, 5, -34, -45, 38, -34, -32, 90, 109, 9, 56, -1, 109, -81, 95, -5,
+        -37, -12, 98, -97, -123, -60, 9, -14, 126, 21, 54, -58, -106, 36, -72, -96,
+        -86, -30, -44, 24, -106, 5, 67, 92, 48, 42, 11, 96, 98, 60, -2, -7,
+        97, -13, 118, -31, 38, -30, -7, 66, 1, 84, -5, -126, -95, -128, -119, 123,
+        -60, 80, 0, -34, -4, 29, 67, -123, -13, 102, 79, 25, 10, 108, 55, 123,
+        -51, 112, -13, 101, 30, 52, -76, -36, 110, -5, -90, -31, 66, 98, -120, 120,
+        19, -82, -124, -118, 126, 22, 78, 62, 66, 93, -9, 50, -100, -128, -87, 121,
+        28, -82, 106, 55, -18, 125, 56, -7, -120, 118, -35, 19, 113, 22, 38, -26,
+        -107, -72, 18, 54, -22, -95, 56, -87, 48, -31, -73, -30, 42, 122, -30, -98,
+        -117, -77, -14, -27, 94, -116, -45, 25, 69, 55, 49, 57, -91, 5, 84, 100,
+        90, 105, 53, -118, 26, 100, -106, -42, -104, -37, 36, -105, 46, 91, 106, -103,
+        95, 90, 41, 80, 109, -118, 105, 11, 85, -109, 101, 122, 19, -99, 104, 122,
+        19, -101, 107, 90, 64, -58, -92, -101, 86, 82, -114, -53, 56, 109, 48, 94,
+        -109, 116, 122, 115, 85, -34, 105, -29, 3, -38, -92, -98, -106, -46, 110, -101,
+        125, 90, -102, -109, 107, 19, 80, 11, 28, 87, -26, -96, -106, -60, 95, -111,
+        -122, 122, -45, 42, 19, -75, -31, 120, -109, 100, -44, 21, -89, -29, -13, 81,
+        75, 14, -73, 74, 73, -67, 105, -103, -107, 122, -45, 58, 49, 53, -30, 72,
+        124, 110, 106, -105, 43, -79, -23, -87, -127, -18, -75, -54, 80, 93, -23, 93,
+        -85, 36, -43, -101, 86, 121, -86, -113, -101, 70, -87, -86, 55, 45, -78, 85,
+        35, 49, -60, 36, -84, 118, 5, 80, -97, -77, -38, 87, -54, -88, -76, -43,
+        -101, 70, -103, -85, -107, -1, 12, 39, -81, 62, 110, 66, -7, -85, -113, -101,
+        80, 10, -21, -29, 38, -108, -59, -6, -72, 9, 37, -78, 62, 110, 66, -71,
+        -84, -113, -101, 80, 58, 107, 81, -54, 103, -76, 62, -14, 73, -83, -113, 53,
+        121, -83, -113, -31, -44, -42, -57, 96, 118, -21, 99, 77, -126, -21, 99, 48,
+        -57, -11, -79, 54, -51, 53, -96, -85, 97, -90, 107, 64, 118, -21, 100, -41,
+        -128, 53, 45, -13, 93, 3, -18, -75, 74, 121, 13, -8, -37, 58, -21, 53,
+        -112, 65, -85, -60, -41, 88, 74, -83, 114, 95, 67, 49, 54, 75, 127, 13,
+        -59, -40, 54, 3, 54, 20, 99, -69, 36, -40, 80, -116, 109, -14, 96, 67,
+        49, -74, 77, -123, 13, -59, -40, 38, 27, -74, 35, -58, 54, 9, -79, 3,
+        98, -76, -27, -11, 105, -79, 107, -92, 97, 97, -22, -110, 99, -41, -79, -44,
+        2, -43, -91, -56, -82, 101, -117, -54, 43, 29, -76, 67, 22, 34, 38, 87,
+        118, -83, 73, -79, 80, -11, 25, -77, -21, 109, -125, 5, -85, -49, -101, 29,
+        49, -58, 85, -102, 105, -56, 7, 38, 123, 54, 100, 68, 40, -127, 54, -28,
+        68, 32, -121, 54, 100, 5, -97, 70, 27, -14, 34, -108, 73, 27, 50, -125,
+        79, -90, -19, 112, -125, -49, -89, 13, -39, 65, -90, -44, -122, -52, -32, -77,
+        106, 67, 86, -80, -119, -75, 33, 35, -72, -36, -38, -112, 13, 124, 122, 109,
+        -56, 4, 46, -61, -74, -61, 2, 38, -55, -74, -94, -97, -55, -77, -83, 72,
+        15, -91, -38, 86, 84, 7, -78, 109, 43, -126, -7, -124, -37, -118, -42, 80,
+        -50, 109, 69, 102, 32, -19, 54, -20, 124, -45, -52, -37, -112, -72, -10, -55,
+        -73, 33, 7, -38, -26, -33, -122, 92, 106, -105, -126, 27, 50, -78, 125, 22,
+        110, -56, -19, 118, -119, -72, -111, 60, 26, -26, -30, 70, -14, 104, -99, -114,
+        27, -55, -93, 101, 70, 110, 36, -113, 86, 73, -71, -111, 60, 90, -25, -27,
+        70, -14, 104, -107, -102, 59, 36, 15, 11, 16, -111, -96, -69, -114, -87, 22,
+        -88, 54, 77, 119, 45, 95, 44, 84, 109, -78, -18, -16, -56, -73, 32, 81,
+        41, -69, -21, -121, -80, 5, -117, 72, -36, 29, 49, 18, 45, 92, 68, -6,
+        110, 68, 37, -109, -63, 27, -111, 25, 74, -30, -115, -24, 12, -28, -15, 70,
+        -124, -14, -87, -68, 17, -91, -95, 108, -34, -120, 84, 62, -95, 55, -94, -107,
+        -52, -23, -115, 40, -27, -45, 122, 35, 58, -39, -52, -34, -120, 74, 46, -71,
+        55, -94, -111, -49, -17, -115, 40, 100, 83, 124, 43, 2, -55, 44, -33, -118,
+        48, 62, -47, -73, 34, -120, -51, -11, -83, 8, -31, -46, 125, 43, 2, -8,
+        -116, -33, -86, -29, -95, -92, -33, -86, -49, -63, -68, -33, -86, -17, -11, -87,
+        -65, 21, 13, -75, -39, -65, 21, 45, 117, 9, -64, 21, 77, -11, 57, -64,
+        21, 109, 17, 105, -64, 21, -119, 87, 102, 2, 87, 76, -72, 93, 50, 112,
+        -59, -84, 91, -27, 3, 87, 60, -67, 73, 74, 112, -59, -8, -101, 101, 5,
+        87, -14, 105, -97, 24, 92, -25, -55, -37, 68, 38, 64, 54, 27, -93, -75,
+        57, -112, -85, -3, -48, 80, 26, 100, 34, 118, 63, -99, -36, -127, -40, -3,
+        102, 17, 17, -69, -33, 44, -22, 99, -9, 2, 38, 46, 118, -65, 89, -36,
+        62, 118, -81, 112, -34, 44, 118, 47, -80, -35, 42, 118, 47, -39, -5, 37,
+        98, -9, -106, -37, -19, 99, -9, 2, 67, 68, -20, -66, -124, -118, -114, -35,
+        -117, 26, -75, -79, 123, 1, 83, 19, -69, -81, -38, -115, -117, -35, 11, -8,
+        -38, -40, -67, -123, -119, -119, -35, -105, -80, 81, -79, 123, -87, 48, -31, -40,
+        125, 69, 79, 92, -20, -34, -54, 55, 24, -69, -73, 122, 26, -114, -35, 11,
+        -88, -56, -40, -67, 26, 69, 13, 98, -9, 26, 115, -101, -40, 125, -39, 82,
+        -53, -40, -67, 82, -96, -38, -40, -67, -123, 10, -57, -18, -27, 16, -115, -117,
+        -35, 87, -112, 117, -79, -5, -51, 34, 42, 118, -81, -92, 28, 23, -69, 55,
+        24, -81, -120, -35, -105, -106, -66, 93, -20, -34, -8, -128, 54, -79, 123, 41,
+        -19, -74, -79, 123, 105, 78, -82, -115, -35, 11, 28, 87, -58, -18, 37, -15,
+        -19, 99, -9, 37, -25, -101, -59, -18, 13, -57, -101, -60, -18, 43, 78, -57,
+        -57, -18, 37, -121, -37, -60, -18, 21, 85, 45, 98, -9, 14, 55, -102, -60,
+        -18, 17, 71, -30, 99, -9, 46, 87, 98, 99, -9, 64, -9, 90, -59, -18,
+        43, -67, 107, 19, -69, -9, -8, 27, 23, -69, -105, -115, -58, -57, -18, 29,
+        97, -60, -59, -18, -111, 24, 98, 98, -9, -82, 0, -22, 99, -9, -66, 82,
+        -58, -60, -18, 61, -106, -123, 99, -9, -54, 127, -122, 99, -9, -101, 69, 40,
+        118, -65, 89, -124, 98, -9, -101, 69, 40, 118, -65, 89, -124, 98, -9, -101,
+        69, 40, 118, -65, 89, -124, 98, -9, -94, -108, -113, -35, 43, -126, -24, -40,
+        -67, -94, 38, 16, -69, 87, -12, -16, -79, 123, 69, 16, 27, -69, 87, 4,
+        5, 98, -9, -118, 36, 54, 118, 111, -107, -102, -113, -35, 3, -70, 26, -58,
+        -18, 1, -39, -83, 99, -9, -128, 53, 45, 99, -9, -128, 123, -83, 98, -9,
+        -128, -65, -83, 99, -9, 64, 6, -83, 98, -9, 88, 74, -83, 98, -9, 80,
+        -116, -51, 98, -9, 80, -116, 109, 99, -9, 80, -116, -19, 98, -9, 80, -116,
+        109, 98, -9, 80, -116, 109, 99, -9, 80, -116, 109, 98, -9, -114, 24, -37,
+        -60, -18, 3, 98, -76, -27, -11, -79, -5, 26, 105, 88, -104, -70, -40, 125,
+        29, 75, 45, 80, 93, -20, -66, -106, 45, 42, -74, 29, -76, 67, 22, 34,
+        38, 118, 95, 107, 82, 44, 84, 125, -20, -66, -34, 54, 88, -80, -6, -40,
+        125, -60, 24, 87, 81, 109, -56, 7, 38, 118, 15, 25, 17, -118, -35, 67,
+        78, 4, 98, -9, -112, 21, 124, -20, 30, -14, 34, 20, -69, -121, -52, -32,
+        99, -9, 14, 55, -8, -40, 61, 100, 7, 25, -69, -121, -52, -32, 99, -9,
+        -112, 21, 108, -20, 30, 50, -126, -117, -35, 67, 54, -16, -79, 123, -56, 4,
+        46, 118, -17, -80, -128, -119, -35, 43, -6, -103, -40, -67, 34, 61, 20, -69,
+        87, 84, 7, 98, -9, -118, 96, 62, 118, -81, 104, 13, -59, -18, 21, -103,
+        -127, -40, 61, -20, 124, -45, -40, 61, 36, -82, 125, -20, 30, 114, -96, 109,
+        -20, 30, 114, -87, 93, -20, 30, 50, -78, 125, -20, 30, 114, -69, 93, -20,
+        30, -55, -93, 97, -20, 30, -55, -93, 117, -20, 30, -55, -93, 101, -20, 30,
+        -55, -93, 85, -20, 30, -55, -93, 117, -20, 30, -55, -93, 85, -20, 62, 36,
+        15, 11, 16, 17, -69, -81, 99, -86, 5, -86, -115, -35, -41, -14, -59, 66,
+        -43, -58, -18, -61, 35, -33, -126, 68, -59, -18, -21, -121, -80, 5, -117, -120,
+        -35, 71, -116, 68, 11, 23, 17, -69, 71, 84, 50, -79, 123, 68, 102, 40,
+        118, -113, -24, 12, -60, -18, 17, -95, 124, -20, 30, 81, 26, -118, -35, 35,
+        82, -7, -40, 61, -94, -107, -116, -35, 35, 74, -7, -40, 61, -94, -109, -115,
+        -35, 35, 42, -71, -40, 61, -94, -111, -113, -35, 35, 10, -39, -40, -67, 34,
+        -112, -116, -35, 43, -62, -8, -40, -67, 34, -120, -115, -35, 43, 66, -72, -40,
+        -67, 34, -128, -113, -35, -85, -114, -121, 98, -9, -86, -49, -63, -40, -67, -22,
+        123, 125, -20, 94, -47, 80, 27, -69, 87, -76, -44, -59, -18, 21, 77, -11,
+        -79, 123, 69, 91, 68, -20, 94, -111, 120, 101, -20, 94, 49, -31, 118, -79,
+        123, -59, -84, 91, -59, -18, 21, 79, 111, 18, -69, 87, -116, -65, 89, -20,
+        94, -55, -25, -54, -40, 125, -71, 73, 90, 23, -69, 55, 27, -93, -75, -79,
+        -5, 106, 63, -76, 97, -20, -2, -2, 126, 8, 98, -9, -21, 101, 68, -20,
+        94, 0, -43, -58, -18, 5, 76, 92, -20, 94, 0, -34, 60, 118, -81, 112,
+        -34, 44, 118, 47, -80, -35, 42, 118, 47, -39, -5, 37, 98, -9, -106, -37,
+        -19, 99, -9, -21, 101, 76, -20, -66, -124, -118, -114, -35, -81, -105, -11, -79,
+        -5, -11, -78, 46, 118, 95, -75, 27, 23, -69, 23, -16, -75, -79, 123, 11,
+        19, 19, -69, 47, 97, -93, 98, -9, 82, 97, -62, -79, -5, -118, -98, -72,
+        -40, -67, -107, 111, 48, 118, 111, -11, 52, 28, -69, 23, 80, -111, -79, 123,
+        53, -118, 26, -60, -18, 53, -26, 54, -79, -5, -78, -91, -106, -79, 123, -91,
+        64, -75, -79, 123, 11, 21, -114, -35, -53, 33, 26, 23, -69, -81, 32, -21,
+        98, -9, 2, 50, 38, 118, -81, -92, 28, 23, -69, 55, 24, -81, -120, -35,
+        -105, -106, -66, 93, -20, -34, -8, -128, 54, -79, 123, 41, -19, -74, -79, 123,
+        105, 78, -82, -115, -35, 11, 28, 87, -58, -18, 37, -15, -19, 99, -9, 37,
+        -25, -101, -59, -18, 13, -57, -101, -60, -18, 43, 78, -57, -57, -18, 37, -121,
+        -37, -60, -18, 21, 85, 45, 98, -9, 14, 55, -102, -60, -18, 17, 71, -30,
+        99, -9, 46, 87, 98, 99, -9, 64, -9, 90, -59, -18, 43, -67, 107, 19,
+        -69, -9, -8, 27, 23, -69, -105, -115, -58, -57, -18, 29, 97, -60, -59, -18,
+        -111, 24, 98, 98, -9, -82, 0, -22, 99, -9, -66, 82, -58, -60, -18, 61,
+        -106, -123, 99, -9, -54, 127, -122, 99, -9, 2, 36, 16, -69, 23, -91, -127,
+        -40, -67, 40, 13, -60, -18, 69, 105, 32, 118, 47, 74, 3, -79, 123, 81,
+        26, -120, -35, -117, 82, 62, 118, -81, 8, -94, 99, -9, -118, -102, 64, -20,
+        94, -47, -61, -57, -18, 21, 65, 108, -20, 94, 17, 20, -120, -35, 43, -110,
+        -40, -40, -67, 85, 106, 62, 118, 15, -24, 106, 24, -69, 7, 100, -73, -114,
+        -35, 3, -42, -76, -116, -35, 3, -18, -75, -118, -35, 3, -2, -74, -114, -35,
+        3, 25, -76, -118, -35, 99, 41, -75, -118, -35, 67, 49, 54, -117, -35, 67,
+        49, -74, -115, -35, 67, 49, -74, -117, -35, 67, 49, -74, -119, -35, 67, 49,
+        -74, -115, -35, 67, 49, -74, -119, -35, 59, 98, 108, 19, -69, 15, -120, -47,
+        -106, -41, -57, -18, 107, -92, 97, 97, -22, 98, -9, 117, 44, -75, 64, 117,
+        -79, -5, 90, -74, -88, -40, 118, -48, 14, 89, -120, -104, -40, 125, -83, 73,
+        -79, 80, -11, -79, -5, 122, -37, 96, -63, -22, 99, -9, 17, 99, 92, 69,
+        -75, 33, 31, -104, -40, 61, 100, 68, 40, 118, 15, 57, 17, -120, -35, 67,
+        86, -16, -79, 123, -56, -117, 80, -20, 30, 50, -125, -113, -35, 59, -36, -32,
+        99, -9, -112, 29, 100, -20, 30, 50, -125, -113, -35, 67, 86, -80, -79, 123,
+        -56, 8, 46, 118, 15, -39, -64, -57, -18, 33, 19, -72, -40, -67, -61, 2,
+        38, 118, -81, -24, 103, 98, -9, -118, -12, 80, -20, 94, 81, 29, -120, -35,
+        43, -126, -7, -40, -67, -94, 53, 20, -69, 87, 100, 6, 98, -9, -80, -13,
+        77, 99, -9, -112, -72, -10, -79, 123, -56, -127, -74, -79, 123, -56, -91, 118,
+        -79, 123, -56, -56, -10, -79, 123, -56, -19, 118, -79, 123, 36, -113, -122, -79,
+        123, 36, -113, -42, -79, 123, 36, -113, -106, -79, 123, 36, -113, 86, -79, 123,
+        36, -113, -42, -79, 123, 36, -113, 86, -79, -5, -112, 60, 44, 64, 68, -20,
+        -66, -114, -87, 22, -88, 54, 118, 95, -53, 23, 11, 85, 27, -69, 15, -113,
+        124, 11, 18, 21, -69, -81, 31, -62, 22, 44, 34, 118, 31, 49, 18, 45,
+        92, 68, -20, 30, 81, -55, -60, -18, 17, -103, -95, -40, 61, -94, 51, 16,
+        -69, 71, -124, -14, -79, 123, 68, 105, 40, 118, -113, 72, -27, 99, -9, -120,
+        86, 50, 118, -113, 40, -27, 99, -9, -120, 78, 54, 118, -113, -88, -28, 98,
+        -9, -120, 70, 62, 118, -113, 40, 100, 99, -9, -118, 64, 50, 118, -81, 8,
+        -29, 99, -9, -118, 32, 54, 118, -81, 8, -31, 98, -9, -118, 0, 62, 118,
+        -81, 58, 30, -118, -35, -85, 62, 7, 99, -9, -86, -17, -11, -79, 123, 69,
+        67, 109, -20, 94, -47, 82, 23, -69, 87, 52, -43, -57, -18, 21, 109, 17,
+        -79, 123, 69, -30, -107, -79, 123, -59, -124, -37, -59, -18, 21, -77, 110, 21,
+        -69, 87, 60, -67, 73, -20, 94, 49, -2, 102, -79, 123, 37, -97, 43, 99,
+        -9, -27, 38, 105, 93, -20, -34, 108, -116, -42, -58, -18, -85, -3, -48, -122,
+        -79, -5, 116, -104, 36, 32, 120, -1, -70, -114, 8, -34, 11, -96, -38, -32,
+        -67, -128, -119, 11, -34, 11, -64, -101, 7, -17, 21, -50, -101, 5, -17, 5,
+        -74, 91, 5, -17, 37, 123, -65, 68, -16, -34, 114, -69, 125, -16, 94, 96,
+        -120, 8, -34, -105, 80, -47, -63, 123, 81, -93, 54, 120, 47, 96, 106, -126,
+        -9, 85, -69, 113, -63, 123, 1, 95, 27, -68, -73, 48, 49, -63, -5, 18,
+        54, 42, 120, 47, 21, 38, 28, -68, -81, -24, -119, 11, -34, 91, -7, 6,
+        -125, -9, 86, 79, -61, -63, 123, 1, 21, 25, -68, 87, -93, -88, 65, -16,
+        94, 99, 110, 19, -68, 47, 91, 106, 25, -68, 87, 10, 84, 27, -68, -73,
+        80, -31, -32, -67, 28, -94, 113, -63, -5, 10, -78, 46, 120, 47, 32, 99,
+        -126, -9, 74, -54, 113, -63, 123, -125, -15, -118, -32, 125, 105, -23, -37, 5,
+        -17, -115, 15, 104, 19, -68, -105, -46, 110, 27, -68, -105, -26, -28, -38, -32,
+        -67, -64, 113, 101, -16, 94, 18, -33, 62, 120, 95, 114, -66, 89, -16, -34,
+        112, -68, 73, -16, -66, -30, 116, 124, -16, 94, 114, -72, 77, -16, 94, 81,
+        -43, 34, 120, -17, 112, -93, 73, -16, 30, 113, 36, 62, 120, -17, 114, 37,
+        54, 120, 15, 116, -81, 85, -16, -66, -46, -69, 54, -63, 123, -113, -65, 113,
+        -63, 123, -39, 104, 124, -16, -34, 17, 70, 92, -16, 30, -119, 33, 38, 120,
+        -17, 10, -96, 62, 120, -17, 43, 101, 76, -16, -34, 99, 89, 56, 120, -81,
+        -4, 103, 56, 120, 47, 64, 2, -63, 123, 81, 26, 8, -34, -117, -46, 64,
+        -16, 94, -108, 6, -126, -9, -94, 52, 16, -68, 23, -91, -127, -32, -67, 40,
+        -27, -125, -9, -118, 32, 58, 120, -81, -88, 9, 4, -17, 21, 61, 124, -16,
+        94, 17, -60, 6, -17, 21, 65, -127, -32, -67, 34, -119, 13, -34, 91, -91,
+        -26, -125, -9, -128, -82, -122, -63, 123, 64, 118, -21, -32, 61, 96, 77, -53,
+        -32, 61, -32, 94, -85, -32, 61, -32, 111, -21, -32, 61, -112, 65, -85, -32,
+        61, -106, 82, -85, -32, 61, 20, 99, -77, -32, 61, 20, 99, -37, -32, 61,
+        20, 99, -69, -32, 61, 20, 99, -101, -32, 61, 20, 99, -37, -32, 61, 20,
+        99, -101, -32, -67, 35, -58, 54, -63, -5, -128, 24, 109, 121, 125, -16, -66,
+        70, 26, 22, -90, 46, 120, 95, -57, 82, 11, 84, 23, -68, -81, 101, -117,
+        10, 110, 7, -19, -112, -123, -120, 9, -34, -41, -102, 20, 11, 85, 31, -68,
+        -81, -73, 13, 22, -84, 62, 120, 31, 49, -58, 85, 88, 27, -14, -127, 9,
+        -34, 67, 70, -124, -126, -9, -112, 19, -127, -32, 61, 100, 5, 31, -68, -121,
+        -68, 8, 5, -17, 33, 51, -8, -32, -67, -61, 13, 62, 120, 15, -39, 65,
+        6, -17, 33, 51, -8, -32, 61, 100, 5, 27, -68, -121, -116, -32, -126, -9,
+        -112, 13, 124, -16, 30, 50, -127, 11, -34, 59, 44, 96, -126, -9, -118, 126,
+        38, 120, -81, 72, 15, 5, -17, 21, -43, -127, -32, -67, 34, -104, 15, -34,
+        43, 90, 67, -63, 123, 69, 102, 32, 120, 15, 59, -33, 52, 120, 15, -119,
+        107, 31, -68, -121, 28, 104, 27, -68, -121, 92, 106, 23, -68, -1, -1, 107,
+        -71, -97, -107, 56, -126, 32, -114, -29, -9, 60, -123, -112, -101, -32, -120, 127,
+        32, 16, -56, 27, 36, 23, 33, 15, -80, 26, 15, 30, -30, 14, 59, -21,
+        37, -30, -69, 103, -45, -109, 49, 83, 113, -69, 127, -33, -82, 42, 111, -126,
+        -75, 50, -43, -19, 34, -20, -25, -117, -21, -125, -12, -29, -3, -6, -76, 125,
+        120, 111, -18, -93, 19, -17, -51, 125, -72, -15, -34, -36, -121, 19, -17, -51,
+        125, -72, -16, -34, -36, -121, 27, -17, -51, 125, -72, -16, -66, 117, 31, -53,
+        0, -64, 123, 117, -88, -53, -112, -60, 123, 121, 46, -53, -108, -60, -5, -10,
+        59, 127, 25, 65, 120, -81, -33, -62, -53, 24, -64, 123, -16, 78, 92, -26,
+        0, -34, -101, 45, 43, 120, 111, -42, 108, -31, -67, -39, -77, -127, -9, 102,
+        -47, 58, -34, -101, 77, 91, 120, 111, 86, -83, -29, -67, -39, -11, 40, -34,
+        -101, 77, -21, 120, 111, -10, -84, -30, -67, -39, -78, -122, -9, 102, -57, 58,
+        -34, -101, 13, -85, 120, 95, 22, 60, -118, -9, 101, -79, 58, -34, -105, -123,
+        -86, 120, 95, 22, -87, -31, 125, 89, -96, -114, -9, -27, -63, 91, 120, 95,
+        -98, -71, -119, -9, -27, -39, 53, -34, -105, 29, 36, -34, -105, 93, 20, -34,
+        -105, -99, 52, -34, -105, -35, 0, -34, -105, 21, -125, 120, 95, 14, 33, 15,
+        -17, -53, 97, 101, -31, 125, 57, -45, 20, -68, 47, 7, -97, -122, -9, -27,
+        126, -126, 120, -1, -6, 33, -87, -62, -5, -65, 31, -116, 74, -68, -1, -9,
+        121, 104, 47, -34, 95, 91, -68, 103, 122, -113, -8, -98, -5, -3, -69, 0,
+        126, -78, -32, 103, 18, -2, -69, 25, 126, 2, -30, 67, -59, 119, 48, 62,
+        114, 124, 0, -7, -35, -110, -113, 40, -65, -53, -14, 59, 49, 31, 104, 126,
+        55, -25, 51, -49, -121, -96, -33, 33, -6, -35, -92, 31, 48, -3, 48, -22,
+        67, -43, -121, -84, -33, -31, -6, 29, -80, 79, 101, -65, -121, -10, 19, 108,
+        63, -118, -5, 17, -35, 15, -15, 126, -118, -17, 39, 0, 127, 80, -8, -67,
+        -60, -17, 49, 126, 23, -14, -69, -107, -33, -51, -4, 17, -25, -9, 66, -65,
+        91, -6, -61, -44, 31, -76, 126, 47, -10, 119, 106, -65, -113, -5, -5, -67,
+        -33, 1, -2, 78, -15, -17, 37, 127, 98, -2, 2, -3, -123, -6, 11, -10,
+        23, -18, 47, -32, 95, -56, 127, -101, -2, 91, -10, 47, -15, 95, -23, -65,
+        -32, 127, -23, -1, 34, 0, 0, 5, 64, 32, 1, 72, 105, 0, 18, 34,
+        -128, 112, 5, -112, -110, 1, -124, 59, -128, -116, 16, 32, 80, 2, -92, -92,
+        0, 9, 45, 64, 56, 6, 72, -87, 1, -62, 57, 64, 70, 15, 32, -125,
+        0, 86, 4, -96, 36, -128, 52, 1, 44, 10, 32, 85, 0, -52, 2, 64,
+        23, 64, -61, 0, 88, 6, -80, 52, -128, -74, 1, 44, 14, -64, 117, 0,
+        -55, 3, 112, 31, 64, 3, 1, 88, 8, -32, 68, 0, 54, 2, 60, 18,
+        -48, -107, 0, -52, 4, 88, 39, -128, 66, 1, 88, 10, -96, 84, 0, -74,
+        2, -51, 88, 64, -41, 2, 50, 23, 80, -67, -128, 14, 6, 100, 49, 16,
+        74, 6, -110, -102, -127, -108, 104, 32, -95, 26, 72, -54, 6, 18, -70, -127,
+        80, 56, -112, 84, 14, -92, -92, 3, 9, -19, 64, 82, 60, -112, 80, 15,
+        -24, 124, 0, -10, 3, 44, 32, 64, 5, 1, 76, 8, 80, 67, 64, 34,
+        2, 92, 17, -48, -116, 0, 118, 4, 56, 36, -128, 37, 1, 74, 9, 120,
+        75, -128, 99, 2, 90, 19, -16, -100, -128, -10, 4, 32, 40, -96, 69, 1,
+        76, 10, 88, 83, 64, -93, 2, 88, 21, 52, -78, 2, -43, 21, -120, -80,
+        -96, 93, 22, -88, -76, 64, -73, 5, 32, 46, -96, 117, 1, -52, 11, 88,
+        95, 64, 3, 3, 92, 24, -92, 36, 6, -39, -115, 65, 110, 100, -112, 88,
+        25, 36, 103, 6, 41, -99, 1, 15, 13, 112, 105, -32, 79, 13, 94, -1,
+        79, -64, -12, 71, -59, -74, -113, -5, -77, -23, -31, -41, -3, -25, -53, 55,
+        -57, 112, 24, -72, 92, 15, -68, -3, -10, -43, -22, -37, 23, -61, -89, 35,
+        63, -32, -38, 76, -4, 55, -80, 60, -35, -72, 123, 120, -36, 63, 15, 63,
+        -50, -54, 23, 4, -66, -41, -125, -104, -66, -25, 23, 73, -4, -98, -57, 4,
+        127, -101, 7, 96, 0, 62, -65, 68, 18, -8, 106, -116, 32, -8, 122, 28,
+        49, -8, -4, 2, 1, -31, 102, 61, 70, -31, -13, 75, 90, 24, -2, -14,
+        -31, -4, -12, -29, -55, -76, 125, -38, -35, -35, 127, -37, -116, -29, -31, 15,
+        -45, -9, -101, -81, 95, 110, -73, -37, -3, -76, -33, 109, -58, -31, -16, 75,
+        58, -36, 77, -45, -16, 115, 51, -98, -100, -98, -1, 6, 36, -48, -67, -86,
+        -46, -115, 3, 0
+    };
+    const size_t bootstrap_min_css_gz_size = sizeof(bootstrap_min_css_gz);
+}
+
@@ -0,0 +1,1472 @@
+/*  ===================================================================
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
+*  ====================================================================
+*
+*
+*  Auto-generated by tools/generate_resources.py
+*  Source: https://cdn.jsdelivr.net/npm/bootstrap@5.3.0/dist/js/bootstrap.bundle.min.js
+*  gzip member of 80,421 bytes, size: 23,220 bytes
+*/
+
+#include "../../include/html_gen_resources.h"
+
+namespace resources {
+    const char bootstrap_min_js_gz[] = {
+        31, -117, 8, 0, 0, 0, 0, 0, 2, 3, -51, -67, 107, 119, -37, 70,
+        -110, 48, -4, 125, 127, 5, -123, -15, 42, 64, -44, -92, -28, -28, -103, 61,
+        -17, 11, 13, -52, 35, -53, 118, -20, -60, -78, 28, 91, 118, 46, 28, -114,
+        12, -110, 77, 17, 54, 9, -48, 0, -88, -117, 73, -4, -9, -89, -86, -6,
+        -118, 27, 41, 59, -77, -49, -18, 57, -119, 5, 2, 125, -83, -82, -82, 91,
+        87, 87, 29, 126, -65, -9, 31, -99, -50, -9, -99, -57, 73, -110, 103, 121,
+        26, 46, 59, -41, 127, -17, -3, -40, 59, -22, -72, -77, 60, 95, 102, -2,
+        -31, -31, 21, -49, 71, -22, 99, 111, -100, 44, 14, 61, -86, 112, -102, 44,
+        -17, -46, -24, 106, -106, 119, 126, 56, 122, -8, -80, -5, -61, -47, 15, 63,
+        118, 46, 102, -36, 106, -24, 100, -107, -49, -110, 52, -77, 90, -118, -14, -39,
+        106, 68, 109, -28, 55, -93, -20, 80, 55, 123, 120, 5, -1, -52, -78, -61,
+        113, 18, -25, 105, 52, 90, -27, 80, 77, -12, -14, 50, 26, -13, 56, -29,
+        -109, -50, 42, -98, -16, -76, 115, -10, -30, -30, 62, -51, -115, -26, -55, -24,
+        112, 17, 70, -15, -31, -53, 23, -89, 79, 95, -67, 125, 74, -115, 29, -2,
+        -57, -34, 116, 21, -113, -13, 40, -119, -35, -100, 113, 111, -19, 36, -93, -113,
+        124, -100, 59, 65, -112, -33, 45, 121, 50, -19, -16, -37, 101, -110, -26, -39,
+        -2, -66, -125, -35, 77, -93, -104, 79, -100, 61, -11, 113, -111, 76, 86, 115,
+        -34, 23, 127, 122, -78, 104, -64, 93, -49, 119, 84, -77, -90, 37, 81, 123,
+        127, 95, -4, -19, -123, -117, 73, 95, 60, -70, -36, -13, -35, 60, 104, -22,
+        -32, 10, 70, 29, -50, 47, 102, 81, -42, 55, -113, 126, -66, -39, 100, 124,
+        62, -11, 122, 122, 122, -40, 103, -31, -26, -16, -111, -71, 122, 66, 48, -101,
+        85, -58, 59, 80, 32, -126, 25, 29, 3, 36, -77, -68, -109, 7, 49, -65,
+        -23, -100, -123, 75, -58, -125, 117, -58, 115, -105, -77, -120, -59, -34, 58, -17,
+        -51, -62, 12, 70, -78, -39, -28, 61, -15, 90, -106, -13, 100, -59, 44, -56,
+        123, 87, -8, -63, 59, -50, -88, 108, 4, 101, -113, -126, 32, -56, 122, 89,
+        -12, -123, -9, 51, -86, -122, 109, -7, 88, 33, 65, -128, -92, 105, -110, -70,
+        31, -52, -14, 79, 18, -98, -59, -33, -27, -99, 112, 62, 79, 110, 0, 122,
+        41, -17, -28, -77, 48, -18, 36, 49, -17, 68, -48, 73, 24, -113, 121, 103,
+        9, -117, -54, -25, 124, -63, -29, -68, 7, -88, 3, 80, -47, -33, -4, -50,
+        -125, -11, 73, -102, -122, 119, -67, 105, -102, 44, -36, -84, -9, -119, -33, 101,
+        -82, -25, 13, -114, -122, 69, -17, -125, 87, 48, 24, -96, -113, 51, -14, -126,
+        71, 106, 66, -5, -5, 106, -36, -12, 7, 71, 29, -81, -26, 115, -106, -14,
+        69, 114, -51, -87, -16, 58, -102, -70, 123, -86, -68, -105, -14, 124, -107, -58,
+        114, -42, -79, -103, 117, -36, -101, -64, -80, 114, 14, 77, 48, -100, 119, 76,
+        -13, -58, -26, -27, 123, -18, 21, 5, -117, 2, 7, -90, 26, 103, 17, 46,
+        1, -113, 39, 14, -125, 38, -126, 71, 110, -66, -65, 127, 19, -59, -109, -28,
+        -90, 119, -6, -10, -83, -3, -36, -29, -39, 56, 92, 66, 59, -128, 2, 121,
+        47, -27, -53, 121, 56, -26, -18, -31, -33, -36, -63, -65, -2, -103, 57, 127,
+        -5, 110, 120, -32, 29, 94, 49, -105, -48, 51, 120, -12, -31, 111, 15, -42,
+        -90, 18, 118, -7, -63, -13, 60, -106, 123, 44, -61, 110, 96, 25, 39, 81,
+        -74, 12, -13, -15, -20, -23, 53, 0, -48, -59, 69, 20, 79, -111, 7, -16,
+        73, -80, -48, 30, 76, 118, -77, 81, -104, -82, 113, 45, 7, 80, -71, -41,
+        73, 52, -23, 28, -19, 1, -46, -10, 62, 126, 94, -15, -12, 78, -116, 11,
+        0, -20, 49, -21, 91, -100, 76, -8, 5, 84, -13, 88, -118, 45, 38, 110,
+        -18, -11, 85, -115, 62, -106, -10, 115, -33, 65, -60, -117, -81, -52, 6, -56,
+        17, 86, 115, 30, 95, -27, -77, 71, 71, -3, 73, 50, 94, -47, 26, 83,
+        -91, -73, 0, -62, 49, -20, 113, 23, -10, -95, -25, -7, -76, 66, 33, -51,
+        8, -41, 6, -37, 23, -56, 70, -85, 113, 58, -113, -96, -30, 27, -88, 0,
+        -117, 47, 91, -108, -53, -74, -9, 80, 46, 28, 15, -100, -21, 40, -117, 70,
+        115, 14, 3, 8, -80, 82, -78, 88, -82, 114, 62, 121, -101, -33, -51, 57,
+        -76, -121, 13, -67, 78, 19, -64, -74, -4, -18, 125, 56, 95, 113, 87, 84,
+        -120, -26, 81, 126, -25, 120, -80, -112, 121, 111, 60, 79, 50, -98, -27, -82,
+        51, -31, 121, 24, -51, 51, 63, 78, 114, 119, 0, 117, -30, -95, -25, 120,
+        -57, 56, -76, 72, 118, -36, -31, -8, 51, 66, -24, 120, 107, 53, 4, -85,
+        -123, 108, -75, 88, -124, -23, -99, -88, 5, -85, -51, 123, -53, 48, -123, 89,
+        -68, 2, 72, 66, -91, -56, -116, 31, -66, -29, -12, 97, -44, 92, -65, 44,
+        84, 39, 5, -101, -45, 18, -26, -72, 79, -43, 42, 64, 125, 108, -90, -9,
+        -12, -27, -45, -77, -89, -81, 46, 46, 95, -99, 63, 121, -70, -39, -20, -19,
+        97, -9, 97, -106, -67, -116, 50, 120, 2, 58, 10, -44, 47, -125, -71, 68,
+        89, 8, 96, -103, 56, 0, 82, 123, -67, -43, -5, -66, 121, -12, 105, 83,
+        -100, -28, -126, 2, 115, -69, 46, 16, -60, 105, 56, -49, -72, -77, 39, 23,
+        -91, -79, -108, -57, -58, 122, 17, -11, -126, -85, -121, -89, 114, -109, -121, 121,
+        30, -114, 103, 111, 103, 33, -20, 8, 5, 77, -124, 0, 66, -94, -127, -114,
+        82, 111, 111, -128, -90, -32, -100, 109, 88, 91, -81, 93, -17, 88, 65, 76,
+        19, 15, -88, 42, -6, -64, 66, 125, 78, 56, -90, -32, -102, -73, -108, -54,
+        1, 2, 102, -99, -6, 99, -41, -2, 41, -48, -76, 96, -77, -64, -123, -99,
+        -71, 46, -40, 68, 110, -63, 100, 58, 5, 90, -8, -100, 35, 43, 44, -40,
+        -118, 62, -53, 13, -1, -15, 87, -79, -87, 12, 52, 70, -55, -28, -82, 10,
+        -27, 48, 15, -69, -93, -84, 27, 39, 93, -79, -91, 28, -81, 95, -86, 47,
+        -10, -57, 52, 24, 12, -39, -110, 90, 119, -46, 124, -114, 120, -34, 10, -29,
+        73, -108, -78, 5, 13, -17, 58, 4, -14, 122, -52, -59, -104, 21, -16, 86,
+        -82, -64, 75, 5, 78, 68, -2, 87, 39, 103, 79, -127, 120, -15, -34, 52,
+        30, 68, -61, 99, -7, 23, 9, 3, -115, -31, 69, -100, -13, 116, 10, -76,
+        -118, -55, 47, -67, 83, -84, -102, -82, 112, 27, 7, -71, 126, 27, 39, -16,
+        126, 58, 7, 22, 68, 93, -70, -86, -99, -104, -43, 90, 66, -6, -23, -52,
+        -109, 112, 34, -56, -122, -103, 77, -54, -61, -55, -35, -37, 60, -52, 121, -33,
+        -99, -54, 13, -65, -39, -24, -49, -31, 100, 66, 52, 14, 17, -99, -57, 60,
+        117, -99, 39, -25, 103, -48, 107, -114, -17, -96, 57, -64, 68, 32, -96, 56,
+        -33, 41, 80, 24, -55, 7, 59, -80, -46, 83, 47, 7, -66, 9, 88, 58,
+        -19, 45, 87, -39, 12, -87, -65, -113, -100, -108, 93, 5, 72, 111, 17, -66,
+        0, 9, -124, 111, 3, 26, -10, 115, -73, -41, -21, 1, 22, 68, -20, -110,
+        -118, 3, -80, -10, -114, 60, -119, -19, -79, -62, 100, -38, 97, 87, 64, 112,
+        36, 97, 74, -96, -84, 44, -109, -85, 50, 71, -57, -64, 64, -42, -122, 111,
+        60, 89, -91, 33, -2, -11, 57, -77, 94, -14, 121, 120, -25, 71, 69, 32,
+        81, -95, -127, -90, 105, -90, -11, 106, -75, 24, -15, 20, 113, 53, -29, -49,
+        0, -94, -56, -64, -128, 67, -44, 95, 71, 122, -93, -60, 32, 84, -12, 93,
+        14, -21, -99, 45, -127, 4, -70, 14, 115, -112, -81, 2, 0, -94, -54, -101,
+        -121, -4, -57, -17, -35, -90, 30, 14, -102, -38, 7, -112, 30, 21, 30, 126,
+        -3, 59, -50, -78, -109, 6, -102, 70, -121, -127, -69, -50, -61, 20, -103, 118,
+        92, 32, -32, 98, 36, 122, -64, 113, -96, -52, 17, 32, -112, 96, -47, -27,
+        -91, -115, 88, -24, 49, 4, -89, 87, 0, 74, -42, 86, -98, 62, -61, -26,
+        -69, -120, 22, 60, 89, -27, -82, 88, -10, 20, -26, -122, -68, -46, 99, 9,
+        44, -18, 72, -84, 22, -118, 42, 122, 11, -96, 116, 35, -16, -118, 6, 9,
+        124, -78, 7, 80, -26, -73, -25, -72, 41, 36, -120, -70, 15, 97, 120, 73,
+        127, 47, -38, -33, -113, -127, -55, 101, -35, -121, -64, -26, -112, -41, -71, -55,
+        65, 16, -11, 31, -6, -35, -121, 44, -122, -47, -61, 10, 39, 7, -103, -9,
+        -97, 25, -16, -27, -63, 89, -104, -49, 122, -117, -16, -42, 61, 98, -30, 49,
+        -118, -35, -124, 65, 93, -49, 27, -62, 88, -82, -125, -61, -63, -65, 122, -61,
+        -17, -35, 126, -16, -49, 94, -17, 123, -17, -97, -67, 77, -17, -5, 67, 118,
+        23, 28, -30, -49, 67, 118, 19, 28, -6, -2, 63, 39, 7, 15, 14, -39,
+        73, -80, 46, 104, 112, 79, 3, 5, -64, -117, 96, -67, 72, 64, -58, -29,
+        -72, -125, 124, -121, -98, 1, 98, -87, -61, -24, 113, -50, -61, 107, -82, 94,
+        -81, 114, -89, 96, -89, 36, -3, -67, 5, -127, 102, -32, -116, 97, 79, 126,
+        -126, 53, -99, -116, -26, -22, -111, 74, -82, -106, -22, 9, -80, 44, -122, 103,
+        100, 29, -4, 54, -121, -83, -74, 82, 95, 110, 102, -100, -49, -31, 7, -20,
+        -77, 51, -4, -3, 118, -100, 38, -13, -71, -6, 42, -122, 96, -6, -107, -113,
+        -72, -104, -16, -100, 17, -85, 7, 106, -101, -26, -6, 23, 9, 74, 14, 72,
+        115, -78, 75, 120, 90, -90, 60, -53, -60, 35, -115, 40, 73, -111, -23, -45,
+        -74, 24, -125, -52, 120, -123, 77, -27, -55, 106, 60, 83, 45, -47, 15, -39,
+        7, 61, -117, 70, -23, 113, -116, -92, 29, -57, -73, 76, 34, -124, -107, -20,
+        70, -2, -110, -107, -28, 47, -22, 77, 62, 19, 4, -51, 79, -35, -52, 21,
+        -16, -12, 21, 12, 80, 118, 45, 127, -22, 113, -55, -33, 98, 0, 83, 32,
+        83, 56, -111, -47, 124, -123, 80, -47, -123, -96, 58, 55, 16, -64, -121, -43,
+        104, 17, -27, -86, 70, 20, -85, 39, 1, 66, -92, -117, -16, 103, 21, -53,
+        -121, 17, 7, 98, -58, -11, 79, 104, 13, -92, 81, 2, 53, -115, -72, 78,
+        1, 29, -94, -94, 25, 82, 81, 61, 6, -110, -48, -31, 111, 56, 74, -60,
+        106, -120, 117, 28, 122, -57, -118, -32, 117, -50, -123, 98, -92, -40, -23, -2,
+        -2, -121, 7, 107, 94, -8, -2, -125, -11, -45, -125, -125, -30, 3, -54, 33,
+        -85, 72, -20, -62, -51, 6, 95, -23, -102, -73, -82, 37, 10, -99, 35, 121,
+        82, -36, 86, -41, 8, 56, 59, 25, -16, 97, -128, -1, 108, 54, -64, 66,
+        -15, -63, -76, -16, 73, 108, -44, 0, -39, -99, 30, -62, 57, -55, -83, -67,
+        107, -108, -39, 50, 20, -28, 64, 103, -102, -72, 72, 84, 65, -54, 1, -51,
+        2, 69, 15, 65, 71, -124, 100, 126, 69, 56, -93, 4, -52, 0, 101, 45,
+        -49, 116, -15, 82, 116, -95, 6, 26, 7, 53, -79, -107, 3, -31, -116, -5,
+        -111, -49, 55, -101, 72, 18, -121, 87, -42, 100, 78, 73, 111, 72, 80, -104,
+        2, -86, -31, -79, 65, -52, 50, -106, 88, -109, 120, -85, -88, 13, -53, 72,
+        -45, 80, 29, 104, -63, 27, 26, -42, -84, 0, 59, 24, 36, 44, 101, -31,
+        48, 120, 41, 117, 51, -30, -52, 32, -96, 116, 46, -44, 40, 115, -28, -28,
+        90, -49, -29, 66, -127, 65, 122, 57, -121, -59, -99, 92, 16, 73, -35, 108,
+        42, 47, 64, 80, -29, 10, 32, 92, -68, 2, 57, -92, -6, -54, 8, -118,
+        -107, -22, 74, 49, -22, 8, 40, 11, 101, 19, 104, -22, 49, 48, 123, 55,
+        -11, 10, 49, -78, 121, -128, -85, 14, 82, -33, 124, 16, -62, -118, -70, -8,
+        7, -24, -106, 7, 66, -46, 39, 119, 12, -13, 74, 0, -110, -76, -100, 56,
+        -85, -103, -51, 36, -35, 89, 15, 52, -90, -13, -23, 52, 80, 15, -5, -5,
+        -103, 98, 105, 19, 64, -96, -108, 88, -126, -48, -113, -82, -103, -125, -46, -27,
+        10, -24, -79, -83, -64, -29, 66, -54, 38, 53, -4, 99, 55, 83, 112, 67,
+        -78, 94, 82, 55, 78, 96, 34, 64, -33, 81, 44, 32, 14, 44, -104, 81,
+        90, 4, -39, 113, -70, -65, -97, -94, 108, 11, -45, -124, 41, -90, -74, -36,
+        103, -92, -120, 16, -91, -120, -60, -125, -87, -124, -128, 88, -87, -102, -50, -103,
+        -101, -79, 117, 25, -82, -48, -88, -57, 98, 61, -79, -41, 40, 36, -62, -120,
+        -77, 30, 34, 1, 13, -100, 69, -67, 112, -71, -100, -33, -63, 60, 7, 25,
+        -16, 6, -48, -25, 97, -7, 83, -49, 47, 91, 40, -86, -45, -117, -36, 88,
+        -65, 60, 115, -29, 90, -65, 121, -127, 45, 87, -5, -115, 101, -65, 30, -64,
+        84, -12, -102, 3, -26, -54, 94, 83, -17, 120, -43, -76, 117, -44, -38, -79,
+        -107, -39, 104, 41, -4, -112, -53, -106, -63, -93, -34, -40, 19, 54, 30, 76,
+        -122, -63, -118, 53, -120, 103, 33, 91, 33, 35, -42, 83, 120, 98, -17, 16,
+        -75, 82, -97, 92, 14, 98, 34, -67, 59, 78, 80, 11, 109, 17, 7, 18,
+        -10, 56, 73, -128, 78, -29, 50, 123, 76, -88, -30, 29, -84, 58, 72, -12,
+        104, -122, 86, 103, 47, 52, -13, -41, -84, 31, 75, 35, -11, 57, -42, 11,
+        -117, 91, 112, 8, 75, 43, 105, 13, 71, 27, 20, 16, 27, -24, 33, 1,
+        -71, 96, 60, 95, 77, -32, 87, 12, 74, -112, 26, 122, -86, 33, 2, -113,
+        117, -48, 89, -3, 35, -19, 80, -21, 101, 107, -4, 119, -120, -47, -20, 98,
+        -112, -61, 80, 114, -71, -101, 94, 7, 107, -123, -41, 56, 94, 67, 73, -10,
+        30, -94, 50, 31, -13, -58, 111, 71, -8, -115, 86, 89, 126, -37, 73, 116,
+        -60, -100, -127, 108, -63, -84, 53, -39, 1, -3, 27, 55, 0, 103, -42, -98,
+        78, 5, -107, -98, -95, -108, -120, -68, 47, -5, 45, -54, 103, -82, -45, 19,
+        106, -83, 80, 38, 81, 72, -94, 62, 103, -42, 70, -119, 58, 6, -102, 100,
+        -76, -103, 123, 30, -82, -60, 28, -70, -126, -74, 64, -2, -32, 46, -120, 68,
+        -42, 10, -64, 16, 26, 86, 96, -20, -103, 101, -117, 52, -20, 110, 16, 118,
+        -57, 33, -111, 51, -67, 60, 25, -112, -28, 39, -44, 69, 10, -24, -82, -105,
+        39, 110, 92, -98, -126, -125, 46, 75, 100, -44, 30, -28, -72, 98, 93, 56,
+        86, -19, -127, 4, -89, -24, 24, -24, 44, 48, -76, -85, 43, 64, 70, 73,
+        -128, 118, -127, 91, 40, -73, -118, -33, -96, -22, -123, 92, 37, 35, 46, -57,
+        18, 20, 125, 73, -2, 13, 81, 80, 38, -35, -98, -84, 88, 40, 89, 66,
+        -103, -98, -80, -26, 16, -63, 64, 91, 73, 79, 117, 14, -46, 38, -44, -51,
+        122, 81, -122, 86, -115, 80, 78, 48, 79, -106, 75, 62, 113, -47, 78, 67,
+        -33, 94, 44, 22, 124, 18, 1, 117, 104, 44, 20, 6, 88, -26, 9, -97,
+        -122, -85, 121, -2, 58, -27, -40, 21, 126, 80, 84, 120, 30, -100, 89, 22,
+        37, -50, -42, -93, -43, 8, 96, -102, -7, 9, 19, -94, 17, 66, -40, -33,
+        59, 66, -110, -93, 25, 36, 44, -53, -68, -73, 20, -115, -55, -90, 113, 60,
+        -60, -98, 75, -74, -86, -71, -57, -26, -80, 56, -27, -50, -127, 7, -64, 127,
+        -11, -6, -13, -94, 48, 50, -54, 25, 105, 107, -64, 102, -42, -69, -16, 7,
+        52, -68, 60, -67, 91, -25, -92, -127, 22, 99, -20, 28, -7, -89, 44, 37,
+        -20, -81, -54, 42, 68, -12, 23, -79, 109, 26, 93, -127, 66, 38, -90, 38,
+        76, -116, -96, 56, -128, -58, -94, -83, 7, 102, 119, 127, -60, -35, -115, 8,
+        0, -118, 48, 89, -98, -44, -94, -17, 29, 9, 115, 6, -39, 76, -20, -9,
+        100, -16, -55, -31, -115, 80, -98, 104, 73, -109, -73, -124, 62, -82, -26, -71,
+        -6, 27, 53, 66, -11, 55, 27, 7, 17, -58, 110, -53, 88, 77, -86, -24,
+        -89, 75, -28, -57, 56, 125, -7, -29, -25, -73, -25, -81, -124, -78, -26, 78,
+        -8, 24, 56, -37, -69, 55, 47, 80, -91, 68, -61, 101, 78, 42, -106, 6,
+        -112, -98, -87, -103, -22, 51, -101, -112, 25, -61, -27, -32, -92, -5, -25, 16,
+        45, -106, 32, -94, 124, -24, 62, 88, -25, 48, -99, -105, -55, 13, 79, 79,
+        -61, 12, 117, -21, 15, -98, -110, 21, -98, -109, 1, -6, 73, -104, -121, -58,
+        -10, 33, -73, 16, -39, -96, -51, -37, 15, -54, 34, -14, 96, -3, -116, 108,
+        -98, 80, -90, -112, 22, -36, 90, 125, -84, 45, 62, 109, 105, 64, -40, -118,
+        75, 117, 51, -71, 116, 122, -97, 2, 67, 80, -46, -21, 26, 13, -69, 54,
+        101, 0, 92, -127, -70, 48, 72, 20, 63, -25, -96, 26, 72, 1, -44, -90,
+        -118, -93, 12, -51, 100, 123, -43, -105, -89, -124, 80, 32, -67, 88, -44, -82,
+        19, 35, 125, -124, -119, 35, 37, 0, 121, -41, -128, -13, 95, -93, -20, -112,
+        -88, 27, -22, -31, 32, -73, -89, 39, -71, 123, -28, -107, 97, 122, 16, 41,
+        10, 10, -100, 94, 18, 44, -122, 76, 45, -8, 104, 6, 74, -36, -35, -104,
+        17, -85, -77, -9, -91, -127, 25, 107, 92, 109, -123, 61, 106, -34, 100, 87,
+        -20, 60, 88, -93, 54, 17, -115, 59, 80, -95, -93, -73, -26, 90, 65, -81,
+        -88, 127, 69, 107, 101, 75, 9, 52, 55, -63, -89, 124, -106, 38, 55, 29,
+        34, 50, 116, 122, -16, -35, 31, -55, -86, 51, 3, 45, -84, -109, 39, -99,
+        104, -79, 20, -10, -84, 78, 62, -61, -125, 13, -86, -68, -32, -7, 44, -103,
+        116, 28, 108, -64, 97, 29, -128, 105, -121, -121, -29, 89, 103, -84, 48, 121,
+        -17, 59, -81, -72, 36, 107, 9, 2, -66, -52, 126, 65, -70, -21, 93, 46,
+        56, 72, 74, -30, 43, -84, 49, -14, 58, -11, 69, 108, -2, -109, 41, 44,
+        -16, 25, 22, -94, 111, -12, 5, 55, -42, -23, -116, -113, 63, -23, 86, 89,
+        94, 52, -107, 55, 91, -89, -42, 15, -77, -20, 109, 9, -64, -74, -1, -68,
+        87, 93, 22, 32, -78, -50, 88, 34, -116, 15, 8, 41, 33, -41, -21, -11,
+        104, 24, 99, 99, 114, -21, 73, 16, 51, -8, 86, 59, -59, -118, -128, 91,
+        1, 14, -61, -89, -106, 126, -112, 50, -54, 18, -75, -54, 104, 6, -123, -75,
+        42, -22, 115, 6, -94, -37, 54, 12, 58, 29, -80, -56, 49, -56, 113, -51,
+        -28, -40, 24, 112, 1, 67, -127, 77, -47, 0, 29, 121, 0, -28, -8, -62,
+        20, -18, 70, 1, -68, 5, -51, 51, 42, 62, -8, -78, -115, 101, -102, -28,
+        9, 14, 73, -45, 75, -95, -104, 68, 94, 111, 65, 100, -21, -16, -97, -103,
+        59, 8, -69, 95, -16, 4, 37, -14, 6, 15, -121, -27, 93, 67, -26, 123,
+        68, -76, 55, -4, -22, -23, -19, 18, 24, 104, 47, 71, 83, 125, 10, 44,
+        66, 35, 33, 78, 67, 32, 34, 116, 94, -101, 43, -94, 28, 52, -6, 14,
+        -40, -89, 34, 111, 126, -25, 124, 73, -28, -47, 121, -80, -114, 11, -89, 3,
+        -93, -68, -114, 64, -1, -18, -32, 72, -15, 101, 10, 47, 1, -30, 120, -80,
+        -120, -122, 15, -13, 33, 43, 28, 60, -61, 66, -5, 108, 84, 20, 98, -121,
+        -3, 6, -59, -48, 56, -126, 123, -51, -22, 24, 57, -109, -73, -50, 86, -48,
+        45, -80, 66, -96, 60, -56, 26, -16, -8, 70, -32, -90, 4, 94, -112, 51,
+        27, -117, 37, 74, -101, -115, 16, -95, -16, -113, -121, 118, -91, 90, -84, -66,
+        -94, 39, 23, 39, -105, -65, 60, -3, -125, -66, -64, -18, 71, -82, -99, -32,
+        100, -41, -54, 68, 119, -33, 22, 60, 38, -11, -113, -19, -59, -97, -66, -57,
+        83, 12, 44, 127, 92, 49, -40, -54, -91, -121, 57, -100, -33, -60, -118, 79,
+        -65, 10, 23, 72, -68, 105, 112, -8, 47, -120, -48, 36, 75, 21, -105, -96,
+        -21, -83, -8, 41, 32, -59, 40, 28, 43, 91, 2, -120, -57, -21, 75, -55,
+        103, -66, -114, 44, -80, -46, -80, -65, -103, 72, 24, -102, -9, 66, -98, 57,
+        88, 125, 115, 58, 109, 76, 117, 19, 26, 114, 86, -75, -13, -12, 52, -27,
+        32, -62, -103, -22, 82, -8, 81, -29, -57, -118, -27, -26, 55, 27, 68, 102,
+        -4, 0, -123, -21, 103, -36, -14, 52, -60, -18, -92, -13, -2, -23, -101, -73,
+        47, -50, 95, 105, 106, -19, -112, 15, -128, 83, 34, -22, 114, 112, -70, -52,
+        -121, 81, -42, -109, -37, 4, -73, 70, -15, -63, 46, -83, 87, -43, 20, 87,
+        -123, 85, 67, -90, 2, 73, 123, -72, -80, 6, 54, -72, 1, 11, 89, 65,
+        -73, 5, 53, -92, 52, -15, -104, 78, 55, -112, 127, -14, -6, -127, -108, 100,
+        97, 66, -65, -105, 39, 119, 32, -110, 59, 127, 115, -24, -104, 77, -78, -35,
+        106, -75, 89, -54, -89, -22, -104, 15, -28, -9, -56, -24, 22, 80, 17, 89,
+        123, 84, -43, -126, -54, -126, -40, -114, -14, -12, 14, 40, 27, -98, -23, 106,
+        27, 59, -68, 4, 74, 5, 92, 22, -42, 52, -38, -33, -121, -33, 120, 58,
+        -40, -113, 80, -50, 95, -72, 94, -23, -44, 10, 77, 63, 5, -5, 18, -84,
+        -47, 2, 70, 12, -68, -11, 0, 8, 56, -5, 96, -120, -101, 12, 36, 58,
+        60, -74, 80, -25, 66, -122, -120, 86, -19, 34, -126, -104, 114, -106, -29, -15,
+        8, -76, 127, 30, -13, -99, 93, -20, 104, -43, 52, -55, -58, -77, 104, 62,
+        73, 121, -84, -60, -114, -46, -32, -14, -98, -6, 92, -111, -82, -120, -82, 11,
+        -74, -31, 49, 97, -112, -55, -54, 108, 116, 48, 36, 101, 10, -113, -19, -115,
+        -63, 70, -97, -62, 74, 83, -49, 113, 124, -20, 69, -30, -60, 7, -44, -36,
+        24, -60, -83, -26, -78, 18, -52, 81, -63, 80, -3, 16, 29, 41, 76, -63,
+        55, 81, -78, -54, -28, -108, -33, 70, -93, 57, 112, 32, -47, 124, 116, 76,
+        -126, 100, 100, -113, 87, -76, -123, 7, 105, 40, -56, 53, -41, -106, -21, 58,
+        24, 22, 44, 6, -70, 95, -18, 16, -33, 124, 91, 103, -11, -102, 86, 71,
+        100, 97, 70, -35, -26, 84, -126, -36, 54, -38, 14, -100, 16, 45, -51, -85,
+        60, 79, -48, 26, 29, -59, 75, 50, 69, -29, 105, 0, 0, 44, -76, -115,
+        -41, -14, -124, 28, -98, 6, 121, 56, -94, -77, -109, -95, -61, -66, 27, -116,
+        -123, 17, 26, -108, -50, -100, -20, 69, 66, 49, 26, 126, 55, -124, -15, 46,
+        105, 89, 105, 95, -117, -109, 117, 85, -13, 95, -127, -45, 117, -122, 30, -120,
+        -102, -67, -113, 73, 20, -45, -55, -45, -79, 77, -35, -56, -28, -117, -120, 100,
+        -29, -57, -34, -36, 69, 31, -122, 16, 121, -95, -112, -17, 21, -30, 61, 75,
+        -109, -123, -124, -128, 61, -67, -57, -106, 25, -105, -17, -17, 127, -23, 73, 60,
+        71, 9, 68, -98, 15, 99, 43, -78, 38, 54, -94, -35, 20, -38, 90, -23,
+        -37, -115, -104, 38, -50, 64, 34, -118, 64, 118, -107, 77, 101, 95, -45, 22,
+        54, 4, 43, 85, -80, 55, -30, 80, -46, -103, -127, 60, -31, -104, -93, 43,
+        32, 32, 116, 126, -125, -38, -12, 34, -54, 50, 84, -71, 44, -6, -120, -2,
+        39, 68, -115, -113, -127, -9, -58, -82, -38, -76, -96, -38, 126, 24, 40, -70,
+        40, 107, 6, 66, 102, 25, 126, -80, -100, -120, -124, 61, 99, -32, -100, -64,
+        26, -100, -68, 121, 122, -30, 12, 13, 85, -93, -91, -56, -61, 43, -92, -45,
+        0, -8, -88, 65, 75, -105, 108, -71, -28, 83, -109, 5, 95, 122, 109, 96,
+        -59, -46, -101, -115, -112, 8, -28, 70, 68, 46, 17, 3, 65, 60, 22, 124,
+        -65, -54, -4, 50, 111, -64, -121, 116, -118, -85, -44, -110, -49, 90, 104, -6,
+        109, 93, 87, 48, 36, 55, 11, -25, 32, 58, 56, 5, 117, -30, -46, 28,
+        95, 107, 83, 74, 89, 60, 113, -88, 76, 15, 88, -101, -88, -29, -43, 108,
+        20, 106, 122, -91, 122, -106, -17, -123, 20, -110, -100, 108, -106, -36, 56, -98,
+        118, -60, 106, 43, 110, 92, 53, -90, 33, -82, -76, 108, -73, 44, -52, -48,
+        -63, -90, -8, 0, 75, -111, -89, -55, -99, 66, 112, -49, 99, 21, -7, 10,
+        -28, -100, 106, -103, 117, -71, 115, 57, 66, -108, -49, -74, 1, 97, 98, 65,
+        65, 116, -94, 101, 65, -59, -72, 43, 71, -6, -74, 88, -123, -27, 81, 51,
+        115, 109, 23, 53, -123, -7, -97, 27, 23, -105, -16, -63, -74, 104, 24, -91,
+        -124, -42, 76, 91, 28, -71, -80, -101, -106, -8, -21, 37, 122, -72, 56, -106,
+        96, 41, 108, 37, -115, -62, -3, -85, 68, -23, -111, 49, 32, -13, 4, -27,
+        -15, -68, 112, 0, -23, -80, 97, 49, -116, 2, 81, -84, 120, -29, 126, -106,
+        -64, 0, 16, 44, -36, -49, 106, 57, -33, 7, -33, -23, -19, -108, 39, 87,
+        87, 72, -22, 36, -31, 28, 126, 39, 17, -13, -105, -5, 32, -90, -84, 84,
+        -120, 70, 106, 43, 85, -78, -117, 56, 97, 26, -123, 93, 58, 41, -59, 19,
+        -66, 54, -124, -110, 77, 57, 33, 0, -3, 26, -58, -3, -105, 23, -21, -105,
+        45, -117, -27, -120, -34, 8, -42, -5, -5, 4, 62, -38, -100, 69, -103, -4,
+        -120, -29, 103, -60, 39, 49, 97, 50, 83, 116, -61, 101, -28, -80, -9, 100,
+        59, 90, -25, 53, 114, 114, 108, 124, 125, 114, 121, 88, 37, 105, -60, 123,
+        -17, -72, 121, 76, -36, 83, -77, 39, 63, -113, -123, -5, -117, 106, -27, -41,
+        96, 13, 75, -95, -10, -109, 56, -41, -104, -13, 105, 94, 126, 67, -18, -84,
+        -91, 87, 5, -5, -67, 92, -45, -47, 16, 34, -57, 66, -49, 41, 55, 83,
+        -1, 92, 110, -77, -10, 93, -111, -79, 63, 90, 117, 63, 110, 116, -65, -102,
+        -62, -73, -65, -1, 71, 47, -54, -34, -82, -106, -24, -117, -118, -74, 91, -83,
+        21, -74, 104, -127, 92, 53, 50, -31, -13, 60, -4, 61, 56, -110, 63, 51,
+        -47, -60, 107, 113, -14, 77, 22, -38, 44, 80, 71, 45, -46, 5, -59, -2,
+        -88, -102, -119, -30, 40, 23, -91, 93, -49, 43, -74, 24, -120, 58, -65, -18,
+        50, 16, 117, 126, 47, 90, -73, 73, 118, 19, 45, -71, 99, -23, -94, 77,
+        -102, -91, -125, -8, 37, 74, 2, 13, 36, -38, -128, 56, -34, 62, -63, -66,
+        -84, -113, 63, 94, 100, -14, -45, 107, 30, 95, -96, 19, 1, 73, 23, 110,
+        9, 88, -120, -127, -24, -106, -16, -69, -25, 87, -34, 11, 15, -124, 108, 112,
+        52, 84, 69, -118, 75, 88, 76, -45, -3, -41, -9, -47, -75, 95, 43, 112,
+        -49, -62, 120, 50, -25, 111, 113, -114, 46, 57, -58, 88, 107, -35, -77, -48,
+        20, -26, 47, 52, 117, -43, 127, 117, -92, 104, -113, -105, -113, -54, 73, -13,
+        97, -1, -56, 111, -102, 73, 105, 32, 69, 121, 8, -6, -124, -102, -68, 93,
+        -62, 81, 86, -102, 12, -47, -14, -4, 31, -63, -1, 57, 42, -117, 4, -80,
+        -91, 15, -19, 114, -57, 21, -108, 4, -23, 12, 48, -11, -47, 81, -65, 52,
+        -67, -14, 70, 42, 125, -78, -73, 32, 76, -35, 70, -54, 109, -53, -17, 18,
+        -111, -86, 32, -111, -27, 51, 98, -16, -119, 104, -108, 108, 73, -30, -107, 71,
+        -26, -115, -74, -22, -85, 101, 99, 101, -127, 19, 85, -98, 109, 17, -17, 112,
+        50, 113, 85, 27, 93, 66, 26, 32, -32, 126, -29, 64, -115, 59, -52, -73,
+        -116, 83, -5, -49, 52, 86, -106, -56, -77, -83, 46, 76, 101, -21, 20, 97,
+        29, 90, -111, -66, -60, 119, 26, -41, 6, -74, -123, -77, -28, 49, -15, -107,
+        -98, -124, 7, 82, 11, 96, -15, -44, 123, -19, -125, 38, 62, 37, 114, -88,
+        -24, 7, -56, 88, -58, 121, 40, -118, 59, 109, 90, -19, 102, 19, -121, -41,
+        -47, 85, -120, -22, -21, 34, -68, -91, -15, -46, -72, -78, 71, 71, -54, -12,
+        -16, 46, 112, 80, -57, 114, -40, 79, -127, -125, 60, -53, 97, 63, 7, 14,
+        98, -96, -61, -2, 12, 28, -62, 82, 96, -50, 121, -32, 100, -13, -120, 64,
+        52, 14, 83, -14, -49, 114, 24, -121, -73, -26, 87, 4, -65, 36, -109, 102,
+        64, -50, -47, -41, 61, -71, 121, 9, 13, -7, 127, 50, 122, 126, -125, 109,
+        -7, 63, 23, 44, -125, -81, 52, -45, -21, 112, -18, -1, -99, -1, -56, 62,
+        -15, -69, 81, 18, -90, 19, 60, -94, 90, -122, -48, -100, -17, -52, -124, 31,
+        86, 10, -22, -126, -65, -9, -112, -47, 124, -15, -13, 77, 26, 46, -15, -112,
+        -114, 37, 118, 35, -114, 27, -45, 33, -45, 102, 36, 104, 60, 48, 42, -35,
+        -90, 35, -33, 57, -86, 105, 87, -120, 99, 86, 89, -22, -59, 113, -27, -117,
+        -115, -8, 14, -17, 69, -81, -90, 1, -22, 92, -1, 84, -68, 46, -51, 45,
+        -47, -88, -123, -39, -31, -93, -26, 49, 98, -48, -30, -56, 84, -68, 19, 112,
+        -109, -85, 102, 127, -128, -27, 7, -80, -61, 104, 2, 4, 2, -87, 44, 56,
+        38, -23, 33, 104, -105, 36, -52, 125, -50, -25, -48, 91, -87, -127, 120, 18,
+        -115, 17, 1, -108, -70, 30, 24, 37, -49, -47, 107, -39, 53, -59, -100, -102,
+        -91, 80, -116, -80, -30, 7, -111, 105, -2, -83, -23, -39, -124, 60, -105, -48,
+        81, -98, 52, -96, -69, -15, -36, 18, -83, 27, -103, 104, -106, -17, -28, -94,
+        73, -34, -50, 70, 53, -18, 21, 100, 113, -48, -60, 17, 32, -58, -35, 119,
+        30, -67, -3, 13, 118, -10, 123, -31, 75, 15, 5, -116, -25, 50, -24, -95,
+        19, 30, -109, -62, 93, -102, -82, 28, -67, 104, -80, 32, -45, 73, -71, -35,
+        -97, -32, 45, -30, -111, 126, -83, -105, 104, 127, 63, 115, 27, 97, 7, -128,
+        8, -45, 23, 114, -39, -95, 85, 9, -102, 117, -29, 87, 89, 103, -75, -100,
+        -112, 40, 88, 121, -83, -111, 39, 67, 19, -87, -4, 104, -44, -87, -38, -116,
+        43, -117, -92, -86, 35, 67, 13, -17, 70, -4, 105, 76, -42, -109, -14, 120,
+        -52, 122, 106, 110, -82, -25, -40, 71, 2, 90, 51, -103, -25, -52, 12, 65,
+        78, -50, -109, 66, -123, -6, 9, 42, -127, 109, 43, -48, -126, -36, -117, -100,
+        47, 50, 113, -98, -111, 63, -30, -110, 121, 119, 31, -126, 58, -12, 15, -51,
+        102, -93, 105, 117, 24, 37, -1, -28, -99, 67, -94, -82, -75, 31, 64, 84,
+        -18, -4, 5, -38, 108, 92, -3, -22, -124, 118, 34, 122, 13, -96, 93, -54,
+        58, -97, 54, 119, 106, 30, 69, -3, 119, -2, 79, -57, 54, 82, -60, 12,
+        117, 5, -5, 116, -95, -74, 41, 37, 98, -39, -81, -116, 2, -54, -120, 74,
+        88, 10, -23, -42, -61, 56, -91, -61, 43, 4, 32, 127, 95, -15, -120, -25,
+        120, 13, 91, -75, -68, -76, -118, 52, -110, 71, 85, -115, 29, 74, 71, -42,
+        50, -87, 55, 12, 81, 126, 22, -20, 84, -110, -23, 32, 40, -99, 38, -12,
+        104, -125, 0, -14, 52, 53, 111, 124, 126, 43, 61, -24, -27, -110, -37, -85,
+        -123, 91, 27, -25, -32, -74, -6, 13, -88, -19, 85, 55, 2, 81, -47, 6,
+        117, 67, 19, 59, -30, -107, 85, 48, 22, -83, 95, -86, -50, -7, -46, -6,
+        101, 83, 88, -64, -75, 78, -76, -72, -86, -46, 87, 79, 76, -110, 57, -109,
+        52, -68, -46, -14, 79, 5, -14, 53, 109, -46, 51, -106, -104, 117, 73, 99,
+        51, 80, 16, -104, 41, 101, -47, 40, -27, -92, -90, 93, 36, -25, -23, 4,
+        -8, -47, -49, 0, -112, -78, 4, 122, -49, -118, 127, 66, 69, 91, -127, 36,
+        23, -11, 29, 104, 96, -81, 106, -99, -119, -19, -17, 19, 5, 84, 78, -17,
+        -75, -17, 13, 85, -126, -86, -109, 124, -21, -70, -77, -65, 31, 29, 29, 52,
+        -109, 64, -48, -22, -113, 27, 88, 39, -65, -23, -4, -31, -42, 109, 80, 6,
+        -19, -47, 116, 115, 72, -42, -28, -115, -78, 37, 31, 70, -30, -12, 85, -85,
+        -10, -54, -82, 88, 85, 20, -30, 124, 64, 62, 24, -61, 99, -126, 75, -35,
+        -26, 120, -113, 21, -32, 36, -116, -106, -87, 87, 69, 4, 53, 116, 85, 95,
+        4, -64, 57, 100, -118, -68, -67, 80, -36, -34, -78, 43, -109, -13, 72, -77,
+        -56, 80, -99, -123, 45, 65, 40, -119, -81, -83, -22, 49, -81, -37, 18, -93,
+        -36, -45, 23, 36, -86, -10, -96, -15, 42, 77, 73, 77, -48, -44, -38, -12,
+        102, 108, -66, 4, -96, 110, -98, 4, -62, -44, 53, -4, -48, -34, 127, -124,
+        -57, 84, 21, -107, 4, 7, 16, 53, 89, -93, 84, -17, 76, 88, -6, 17,
+        -48, 85, 70, -68, 46, 91, 64, 75, -110, -101, 52, -2, -38, 124, -28, -40,
+        118, -54, -47, 16, -76, -17, -102, -68, 64, -8, -73, -100, -7, 41, 100, 117,
+        60, -10, -16, 72, -39, 82, 43, -120, 28, 112, -43, -83, -4, 80, -31, 14,
+        -123, 66, 39, -58, -91, 47, 122, 43, 63, -83, 115, 72, 53, 13, -70, 8,
+        26, 4, -17, 88, -122, -35, -115, -36, 42, -98, -111, -13, 102, 105, 20, 40,
+        43, -45, -20, -77, -64, -36, 16, -44, -41, -120, 26, 88, 112, -122, 126, 126,
+        60, 120, -44, 102, -59, -27, 108, 93, -14, -23, -10, 51, -90, -9, -122, -44,
+        -97, 19, -36, 32, 23, -55, 19, -11, 26, 79, -94, -15, -78, -83, -33, -48,
+        93, 4, -101, 45, -15, -109, -126, -58, -104, -70, -92, -34, -108, 89, 74, -69,
+        -83, 92, 29, -86, 102, -27, 105, -123, -38, -60, 84, 22, -42, -28, -62, -107,
+        40, -96, 45, -39, 107, -85, 85, -21, -2, 76, -68, 70, 69, 33, -45, -82,
+        -115, 113, -33, 41, 113, -102, -82, -48, 13, -3, -54, 91, -70, -44, 49, -82,
+        -105, 38, 13, -80, 90, -104, -76, -63, -29, -84, -78, 119, -58, 30, -101, -32,
+        90, 85, -9, -44, 28, -124, -104, -6, -85, 86, -21, -1, 58, -85, -45, -123,
+        57, 27, -41, 27, 17, 123, -75, -127, -122, -80, 49, -101, 123, 77, 106, 18,
+        32, 78, -114, -41, -91, 34, -3, -15, 36, -114, 22, -95, 112, 6, 101, 97,
+        69, 63, 41, 125, 46, -109, -47, 109, -89, 27, -124, 46, -114, 32, -60, 106,
+        -109, -88, -38, 117, -6, 88, 22, 3, -86, 34, 64, 97, 109, -92, 114, 27,
+        85, 1, -94, 94, -77, -94, 61, -84, -53, -104, 7, -76, -81, 92, -96, -126,
+        -104, 77, 42, 41, 30, -72, 84, 121, -114, 97, 48, 75, -41, -21, 35, 37,
+        -8, -71, -1, -109, -1, -50, 23, 79, 32, 13, 23, 77, 123, -81, 90, -25,
+        -89, -2, -49, -2, -97, -66, 120, -6, -45, -1, -7, -81, 26, -14, -45, -68,
+        -43, -110, -49, -92, -77, -87, -80, 10, -40, -82, -92, -21, -1, -15, -13, 24,
+        -23, -81, -35, -31, 66, 47, -39, 122, -68, -96, 22, -33, 58, 96, 112, -54,
+        76, 112, -56, 58, 53, -82, 56, 116, -84, 51, 80, 75, -23, -38, 126, 114,
+        -87, -4, 74, -10, 120, 19, -62, -101, 59, 52, -57, -83, 103, 27, 81, -37,
+        -110, 112, -30, 31, -46, -77, -89, -127, -51, -87, -127, -101, -125, -14, -72, 15,
+        76, 27, -32, 19, -53, -101, -5, 81, -93, 116, -25, 11, -45, 21, -84, 68,
+        -125, -13, 33, -31, -127, -38, -89, -40, -100, -48, -23, -73, -74, -25, -118, 99,
+        -32, -19, -91, 10, -91, -103, -120, -125, 4, 113, -69, -83, 101, -75, 92, -21,
+        -90, -78, 50, -67, -72, -26, -80, -115, -116, 38, -58, -114, 49, -4, -50, 118,
+        26, -29, 29, -31, -4, -36, 6, 83, 113, 38, -108, -22, -101, -77, 33, 26,
+        -23, -16, -108, -106, -51, -47, 48, -105, -52, -25, -31, 50, 3, -47, 108, 108,
+        126, 33, -42, -77, 89, -34, 112, -36, -89, -117, 15, -65, 99, 19, 80, 42,
+        -124, 83, -119, 56, 71, 18, 101, -56, -22, -74, 50, -97, 28, -70, -23, -65,
+        81, -92, -56, 81, -59, 106, -10, -79, -23, 87, -38, -57, -78, 11, 125, 109,
+        -40, 54, 124, 93, 74, -79, -128, 98, 104, -96, -81, 76, 89, 64, 116, 103,
+        121, -51, -29, 46, -86, -32, 126, -77, 75, 5, -45, 77, -16, -78, -53, -114,
+        -42, 103, -76, -82, 118, -116, 83, -34, -93, -5, 121, -54, 89, 89, -23, -116,
+        -10, -24, -124, 123, 14, -20, 109, 115, -86, 20, -123, -13, -24, -117, -15, 83,
+        -87, -88, -93, 2, -92, 74, -114, 3, -74, 119, 2, -46, -24, 9, -88, 89,
+        114, 85, 38, -89, 8, 73, -73, -34, -109, -31, 127, 51, -44, 78, -22, 106,
+        46, 46, -119, 28, -94, 62, 75, -36, 102, -110, -101, -20, 54, -55, -83, -74,
+        -103, -28, 20, 26, 85, -113, -128, -11, 8, -59, 41, 8, -70, -127, -72, -46,
+        68, -124, 56, -117, -93, -94, 63, -74, 112, 90, -62, 3, 5, 28, 51, 85,
+        115, -23, 16, -74, 22, -32, -125, -82, 89, 2, -86, -120, 1, -94, -28, -65,
+        103, 81, -102, -27, 47, -127, 122, -51, -11, 82, 0, -117, -107, -125, -90, -111,
+        -80, -114, -7, 109, -19, -102, 50, 102, -20, -43, 48, 67, 123, 4, 77, 91,
+        -72, 18, 91, -85, 109, -12, -80, 16, -10, 8, -125, 64, 120, 60, 85, -99,
+        -81, 37, 107, -74, -6, 53, -32, 120, -119, -16, 40, -88, -73, -117, -84, 53,
+        -78, -62, -27, 26, 28, -41, 76, 114, 79, 64, -77, -122, 113, 32, -81, -35,
+        -27, 21, 50, -49, -73, -97, -3, -116, 107, -33, 51, -68, -19, -113, -73, 102,
+        -113, -40, -41, 35, -5, -34, 81, 43, -111, 56, -46, -28, -32, -125, -72, 7,
+        -4, 96, -51, 17, -84, 37, 7, -25, 3, 115, 91, -85, -8, -48, -18, -103,
+        -78, -34, 65, -120, 90, -63, 49, -34, 1, -114, 121, -50, -62, 118, -120, 56,
+        14, -37, -70, -46, 113, 121, -87, -117, -86, -85, -116, -127, 78, -83, 105, -27,
+        -1, -83, -66, 12, -94, 97, -79, -68, -3, 80, 8, 20, -40, -78, -25, -10,
+        90, 54, -35, 54, -84, -100, 41, 69, 106, 55, 86, -106, 117, -23, -83, -72,
+        39, -26, -110, -41, -25, -126, -37, -115, 34, 45, -63, -128, 77, 112, 29, -41,
+        -125, -78, 56, 71, -48, 86, 26, -115, -14, -9, 69, -40, 6, -100, -57, 69,
+        -84, -78, -102, 58, -74, -34, 71, -18, -14, -48, 14, 84, -127, 49, -73, -51,
+        -112, -51, 91, 3, -90, 70, -73, 40, -37, -10, 2, 107, 1, -99, -29, -80,
+        -1, 9, -92, -33, -30, -103, 37, -114, 97, 118, 35, 118, -95, -63, 83, 113,
+        61, -77, -84, -30, 13, 82, 107, -104, -17, 50, -91, 75, -7, 71, 43, -18,
+        -14, 5, -110, 103, -63, 63, -16, 122, -126, 124, -92, 91, 50, 101, 36, -67,
+        -65, -62, -88, -26, -41, -99, 37, 105, -12, 5, 95, -49, 65, 44, 117, 110,
+        -94, 73, 62, 3, -43, 123, 70, 1, 119, -100, -94, 81, 88, -80, -116, 115,
+        37, -34, -42, -70, -115, 26, -40, 92, 89, 60, -110, 76, -64, -110, 76, 91,
+        80, -108, -61, 62, -36, -115, -113, -96, -122, -108, -111, 24, -17, -33, 21, 45,
+        35, 41, 105, 36, 66, -53, -11, -77, 113, -78, -28, -122, -13, -102, 39, -89,
+        73, 80, -46, 106, -126, -84, -97, 55, 22, 42, -71, -41, 90, 119, 107, -55,
+        -61, 118, 11, -33, 97, 34, 38, -127, -30, -49, -43, -117, -64, -71, 23, 53,
+        -72, -89, -87, -15, 78, 28, -74, -57, 91, -84, -117, -4, 118, 25, -58, 20,
+        -50, -126, 111, -13, 98, 51, -9, -10, -114, -107, -65, 80, 61, 24, -39, 33,
+        114, -124, 13, -110, -38, 67, 105, 123, 70, -33, 27, -82, -16, 25, -88, 3,
+        -37, -90, 61, 71, -63, 116, -117, -10, -52, -17, -27, -74, 24, -31, -111, -41,
+        -41, 41, -64, -111, 84, -128, -73, -22, -68, 74, -6, 50, 90, -44, 44, 47,
+        43, -76, -82, 115, 34, 60, 38, -54, -26, 118, -44, -39, -85, 49, 34, 84,
+        -55, 74, -96, 8, -29, -8, -37, -96, -51, -42, -50, 114, 118, 58, 65, -109,
+        -97, -16, -67, 36, -65, -118, 71, -33, 20, 112, 25, 47, 77, 45, 65, 71,
+        -53, -109, -91, -61, 22, -16, 48, 74, -14, 60, 89, 56, -20, 42, -41, 14,
+        24, -105, -71, 114, -54, 24, -95, -101, -59, 10, 116, 101, 118, 13, 82, -17,
+        50, -121, 26, 80, 16, 10, 12, -39, 29, 42, -128, 34, -86, -53, 13, 60,
+        -110, -79, -17, 4, -107, -65, 121, -76, 92, -62, 74, -66, 22, -105, 14, 28,
+        -10, 52, -57, 0, 115, -4, 102, 73, -127, 83, 46, -32, -41, 18, 111, 81,
+        -89, 14, 59, -59, 46, -7, -108, 67, -63, 49, -20, -67, -13, 60, -72, 70,
+        66, 63, 89, -63, 68, -36, -58, 88, 14, -71, -70, -5, 48, -32, 7, 78,
+        -41, 57, -72, -125, -113, -12, 112, -125, 7, -94, 30, 27, 12, 61, 118, -117,
+        -14, -71, 42, 119, -99, -77, -63, 8, -66, -35, -69, 89, -42, -34, -16, 39,
+        -124, 22, -59, -110, 121, -61, 49, -110, -52, 75, 26, 62, 62, -67, 69, 48,
+        33, -55, 23, 31, -98, -24, -126, 103, 33, 6, -89, 121, 1, -65, 23, -12,
+        -12, 74, 21, 20, 31, 94, -21, -126, -65, -91, 81, 14, 32, 56, -125, 23,
+        55, -30, -15, -93, 42, 42, 63, 61, -125, 105, 125, -54, -95, 83, -24, 13,
+        122, -128, 70, -95, 53, 104, 1, -22, 64, -39, -95, -71, -30, -3, 60, -73,
+        121, 78, -33, 21, -47, -17, 4, -54, 58, 78, -27, 66, -84, 112, -44, -44,
+        117, 31, -88, -45, 25, 113, -103, 80, 95, -122, 22, -58, 7, -38, -89, 3,
+        113, 39, -86, -13, 27, -67, 26, -118, -88, 118, -42, 61, 108, 17, 54, 13,
+        -34, 1, 101, -26, -23, 19, -71, -27, -84, -53, 3, 92, 9, 104, -17, 1,
+        41, 54, 27, -47, 116, -61, 5, -15, -33, 74, -13, -80, -61, -50, -47, 40,
+        123, -26, 24, -60, -2, 38, -33, -102, 102, 30, -17, 104, -26, -7, -59, -39,
+        -53, -26, -90, -84, 47, -90, -71, 47, 86, 115, 77, 113, 72, 77, 72, 60,
+        -44, 5, -21, -35, -103, -17, -107, -34, -52, 7, 117, -21, -5, 77, 30, -84,
+        -111, -92, -7, 14, -59, 29, -95, -48, 101, -80, -97, 120, 44, 34, 14, -94,
+        -5, -46, 44, 68, 31, 35, -119, 49, -45, -40, -73, -23, -106, 90, 7, -118,
+        99, 116, 108, 95, -55, -26, 61, 41, 59, 100, -64, -74, -110, -12, 105, -103,
+        106, -53, -86, 17, 69, -82, -64, 46, -55, 64, -71, 46, 40, -62, 93, -88,
+        -81, -63, -86, -73, 89, 96, -102, -125, 119, -57, 0, -17, 12, 40, -35, 115,
+        -15, -57, -107, -3, 2, 7, -117, -82, 98, 55, 19, 77, 98, 72, 6, 123,
+        64, -15, -106, 113, -16, 32, -58, 102, -9, 48, -92, 24, -58, 78, -83, -98,
+        -28, -27, -98, -97, -107, -7, 31, -54, 112, 84, -40, 113, 124, 50, 92, -111,
+        -39, -109, -15, -23, 20, 58, 108, 7, 17, -117, -126, -75, -96, 76, 62, -4,
+        21, 66, -87, -49, 123, 9, 93, 82, -59, -127, -89, 80, -24, -22, -114, 124,
+        -106, 125, -25, 8, 77, 80, 75, -6, -69, 0, 42, 31, -59, -8, 88, -80,
+        16, 125, -49, -84, -6, 78, 56, -54, -110, 57, -116, -54, -63, 91, -8, -110,
+        -44, -31, 29, -31, -29, 114, -116, 38, 9, 31, 3, -54, -98, 24, -118, -126,
+        -105, -4, 73, -9, 80, 105, 81, 2, -116, 6, -94, 11, 83, -73, -5, -5,
+        -83, -115, -47, 119, -35, 22, -3, -14, -104, -59, -89, -65, 26, 59, -30, -14,
+        -86, 19, 22, -44, 113, 35, 9, -54, 13, -117, -95, 99, 24, 40, -21, 82,
+        42, 70, 68, -75, 80, -51, 39, 78, -65, -125, 94, 75, 13, 22, 35, -10,
+        -84, 11, 15, 113, 46, 22, 56, 23, -41, 113, 46, -106, -13, 78, -54, 56,
+        -41, 54, -69, -72, 1, -61, 20, 14, -31, 26, 126, 94, 69, 41, -49, -4,
+        -127, 51, 22, 33, 5, -27, -74, 28, 90, 65, 54, 62, -105, 72, -114, -70,
+        -81, -40, -91, -104, -128, 116, 107, -7, -67, 116, -6, 93, -124, -73, -20, 23,
+        -11, 28, -59, -20, 87, -7, -100, -94, -122, 105, -38, -5, 29, 77, 102, 88,
+        47, 15, -116, -117, -27, 42, 3, -43, -17, 10, 69, 9, -112, 92, -114, -83,
+        -37, -108, 123, 1, -123, -113, 29, -127, 102, 53, -55, -10, -9, -123, -115, 48,
+        -54, -24, -81, -85, -34, 99, 16, 90, -15, 36, 108, 73, 54, 4, -12, -64,
+        -87, -64, -127, 115, -24, 28, -28, -67, 107, -98, -94, 18, 82, -24, -117, 102,
+        29, 7, -104, 71, 125, 52, -122, 82, -2, 97, 12, 125, 123, -121, -1, 114,
+        -35, -2, -34, 24, -60, 55, -32, 66, -48, 104, 10, 98, -99, -41, -13, -66,
+        -49, -62, 41, 8, -85, -54, -93, 1, -25, 105, -59, -1, 121, -105, -85, 32,
+        23, -26, -80, 4, -59, 78, -110, 55, -115, 96, 72, 55, 67, -31, -43, -79,
+        -64, -53, 86, 21, 29, 112, -12, 33, 96, -28, 67, -44, -126, 31, 75, 17,
+        22, -125, 25, -118, 24, -92, -65, -95, 106, -12, -24, 104, 127, -1, 87, 64,
+        -94, 30, 41, 74, -34, 97, -23, -29, 102, -125, -43, -53, 49, 75, 117, 5,
+        -95, 81, -103, 26, -30, 51, 84, 17, -61, 74, 3, -105, -40, 89, -97, -104,
+        -128, 47, 120, -98, -41, -69, -114, -78, 85, 56, 127, 47, -123, 35, -116, 99,
+        -125, 64, -37, -33, -113, -40, 60, -128, 70, -111, -46, 28, -72, -31, -2, 126,
+        -38, 79, 101, -69, -28, -30, 122, -28, 121, -121, 25, 27, 99, 17, -96, 65,
+        -107, 18, 23, 64, -107, -80, 64, -62, 102, -127, -100, 8, 20, -98, 4, 106,
+        -116, -121, -119, 10, -115, 64, -33, -4, 25, 19, -17, -3, 9, 17, -76, -79,
+        -16, -44, -15, -25, 7, 51, 38, 68, 67, 127, 124, 48, 17, 68, 111, -50,
+        110, -31, -1, 59, 127, 108, -59, 54, -7, 41, 55, -124, -12, -99, 52, 112,
+        -105, -64, 70, -73, -22, 108, -96, 40, 92, -43, 110, -17, 92, -116, -78, 27,
+        121, -1, 8, 30, -46, 106, -54, 55, 30, -77, -54, -120, 81, 118, 99, 89,
+        8, 9, -112, 4, 58, 91, -33, -6, -71, 5, 31, 24, 97, 110, -128, -63,
+        -60, 52, 35, 53, -51, -40, 26, -4, -49, -14, -26, -88, -30, 119, 86, 92,
+        92, -108, 83, -54, 97, 114, 73, 75, 51, 71, 84, 94, 41, 92, 13, 96,
+        -31, 23, -118, -31, -87, -88, -29, -15, 36, 33, 57, 10, -73, 34, -24, -87,
+        -64, -58, -87, -103, -40, -86, 86, -66, 78, -69, -39, -64, 10, 37, 89, 94,
+        -36, -128, -22, -118, 5, 11, 29, -46, 88, -113, -9, 79, -101, -80, 8, 121,
+        -94, 33, -74, -87, 41, -97, 91, -26, -121, -127, 67, -41, 74, -47, -37, -124,
+        -126, 61, -50, -24, 126, -94, -16, -41, 33, -111, -47, 123, 20, 28, -103, -86,
+        -36, -86, -22, 74, -28, -83, -56, 116, -66, 113, 1, -9, -108, 28, 103, -34,
+        84, -35, -61, 77, -45, -111, -43, -76, 51, -53, 23, 20, -103, -25, -71, -24,
+        -63, 87, 100, 27, -90, 51, 39, 25, -87, 4, 34, -9, -117, 28, 8, 66,
+        74, -36, -60, -33, 108, 120, 121, -46, -79, 109, 115, -111, 27, -35, -103, 70,
+        -73, 36, -91, 5, 4, -62, -98, -30, -49, 125, -123, 40, -81, -51, 9, -108,
+        105, 41, -93, -106, 80, 65, 19, -8, -3, 64, -30, 55, -11, -128, -66, 62,
+        20, -30, 28, 90, 23, -22, 53, 78, -29, 79, 68, 2, -35, -4, -79, 71,
+        -123, 77, -124, 39, 36, 86, -10, -108, 49, -58, -70, -125, 113, -115, -11, -17,
+        45, -83, -31, 85, -37, 104, -77, -87, 11, 48, -121, 83, 96, 73, -45, -28,
+        -74, 68, 71, 17, 43, 15, 47, -16, -52, 47, -50, 75, 31, 52, -11, -109,
+        64, 9, -86, 64, 41, 93, -51, 23, 91, -125, -106, -116, 84, -43, 47, 98,
+        -112, 46, 94, -105, -58, 69, 32, -26, -117, 111, 6, 98, 94, 76, 76, -89,
+        -124, 91, -80, 45, -2, 113, 116, -84, -74, 6, 77, 74, 28, -104, 39, 49,
+        69, -59, 6, 50, -122, 102, 64, 104, 126, -127, -79, -102, -12, 91, 16, 15,
+        50, 12, -3, 17, 93, -93, -22, -78, -124, 125, 71, -57, -81, -79, -38, -123,
+        -101, 77, -9, 33, 20, 28, 56, -70, 58, 6, 32, 53, -107, -84, 81, 32,
+        37, -100, -49, 79, 41, -102, 39, -94, 12, -51, 30, 13, 54, -94, 65, -13,
+        -111, -66, -59, -46, -102, 3, -91, -52, 104, -60, 43, 5, -100, 72, -36, 78,
+        -41, -72, 89, 88, 64, 43, 40, -114, 4, 55, -120, -108, -108, -9, 33, -86,
+        -34, 74, -17, 30, 90, 78, 115, -80, 1, -5, -50, -83, -29, 59, 119, -114,
+        -87, -101, -14, 74, -72, -58, -9, 72, -76, 126, 17, -127, -51, 44, -76, 15,
+        109, -76, 47, 75, 64, 32, -119, -83, -111, -74, 31, 73, -38, 126, -92, 40,
+        -5, -111, -96, -21, 71, 5, -77, 55, -48, -100, -105, 3, -103, -42, 101, 49,
+        123, 56, 20, 61, 9, -54, 11, 81, 76, -86, 46, 99, -82, 85, 23, -108,
+        53, -101, -108, 22, -95, 16, 55, -23, 44, -60, 65, -124, 72, -114, -68, 3,
+        -37, 97, -60, -88, -123, 36, 14, 76, 56, -86, 72, -74, 44, -123, 87, -117,
+        100, 18, 77, 35, 88, 125, 20, -120, -92, -68, 124, 78, -101, 59, 3, -50,
+        10, 50, 25, 44, 23, 70, -118, 18, 118, -7, 121, 0, -117, 18, 98, -84,
+        -66, -63, 37, -38, 52, -52, 58, -124, 98, 29, -92, -115, -44, -105, 70, 83,
+        68, -40, 4, -8, -84, 24, -29, 44, 104, -108, 75, 97, 13, -86, 94, 32,
+        -104, -82, -94, 57, 36, 118, 109, -115, 16, -48, 99, 24, -20, 90, 15, 19,
+        -44, 15, -3, 92, -96, -109, 59, 82, 72, 90, -98, 107, -76, 121, -70, -24,
+        -26, 53, 65, 57, 7, 21, -86, 73, -16, 19, -7, 110, -83, 2, -121, -56,
+        -55, -68, -65, -52, 125, -104, -37, 84, -1, 94, -28, -2, 85, -50, -106, 20,
+        14, 16, 58, -22, 105, -123, 100, 48, 30, 30, -44, 95, -50, -121, -35, 20,
+        -1, 81, 95, 4, 72, -95, 44, 91, 4, -91, 15, 118, 21, 118, 21, 0,
+        -39, -124, 97, 92, 6, 87, 125, -43, -15, -107, -68, 15, -89, -92, -94, 35,
+        95, -67, -111, -110, -43, 17, -30, 100, -80, 60, -4, -95, -69, 56, -4, -127,
+        93, 7, -77, -63, 106, -56, -18, -126, -53, -18, 4, -70, -21, -50, 6, -45,
+        33, -69, 9, 46, -31, 51, -2, 62, -4, -31, 96, -60, 78, -126, 20, 99,
+        -101, -34, -80, 59, -113, 61, 13, 48, -124, 72, 105, -3, 7, -15, 48, 112,
+        93, 10, -10, 50, 120, 58, 12, 78, 0, -72, 99, -14, 3, 23, 24, 17,
+        -100, 116, 111, 24, 69, 81, -65, -121, 86, -88, 49, 79, 97, 29, -96, -91,
+        17, 63, -5, -46, 71, 70, 64, -89, 75, -8, 56, 116, -4, 72, -98, -34,
+        99, 48, -62, 90, -112, 57, -96, 92, -82, -83, 65, 41, 101, -81, -110, -32,
+        -63, 67, 98, 13, 50, 74, -83, 32, -117, -123, -3, -75, -68, 11, -126, -40,
+        43, 41, 40, -91, 45, -32, 12, -11, -89, 23, -45, -89, -73, 81, -106, 83,
+        17, 97, -115, 60, 7, -23, 126, 58, -121, 125, 106, 107, 49, 51, -34, -90,
+        -59, 60, 20, 90, -52, 4, -64, 75, 58, -80, -80, 16, 10, -38, 34, 127,
+        72, 2, 35, 127, 9, -107, -103, -98, -83, 14, 86, -68, -68, -27, -43, -36,
+        -12, 35, -54, -19, -76, -13, -11, 38, 32, 1, -4, 26, -19, -37, -40, 2,
+        -90, -44, -112, -4, 27, -73, 120, -82, 57, 24, -90, 126, -24, 93, 45, 87,
+        39, -29, 49, -128, 72, 68, -120, -57, -4, 10, -67, 112, 18, 46, -111, 51,
+        -128, 108, -100, 11, 45, 75, 81, -120, 9, -34, 107, -56, -98, 33, 71, -124,
+        29, -108, -10, 110, 97, -33, -24, 69, 94, -11, -113, -4, 21, 108, -100, -76,
+        119, 7, -72, -81, 95, 47, -31, -11, 18, 16, -66, 97, -125, -49, -6, 51,
+        23, -60, -46, 41, -56, -94, -117, -62, -13, -11, -29, -15, 52, -72, -126, -74,
+        23, -16, -17, 29, -15, -42, 75, 104, -76, -94, 15, 3, 11, -16, 96, 55,
+        -44, -33, 99, -78, -115, -21, 0, -74, -12, 93, -80, -52, 97, 67, 24, -85,
+        -36, 88, -64, -15, 4, -9, 94, -124, 27, -62, -79, 55, -100, -61, 46, -44,
+        -117, -33, 4, 49, 59, -127, -47, 63, 40, -117, 27, 66, 54, 58, 9, 56,
+        -74, 96, -124, 1, 40, -96, 77, 24, 80, 9, 84, 13, 23, 90, 23, -89,
+        -34, 86, -21, -30, -123, 104, -35, 99, -28, -122, -69, -124, -115, 78, 15, -105,
+        -104, -123, 7, 83, -117, -96, -48, -111, -64, -61, 13, -23, 94, 119, -63, 34,
+        103, -117, 110, -32, 78, 64, 73, -59, -73, -5, -5, 55, 21, -115, -88, 95,
+        125, 33, 69, 126, -1, 4, 54, -75, -41, 85, 42, 13, 91, 124, 15, 68,
+        6, -93, -54, -125, -110, -73, -121, 29, -94, 106, -73, -121, 67, -40, -33, -57,
+        -65, 11, 24, 65, -78, 71, 29, 99, 38, 15, 24, 9, -101, 126, 101, -57,
+        66, -117, 56, 25, 92, 80, -65, -12, -117, 77, 117, -73, -76, 31, 78, -39,
+        121, 80, 33, -22, -38, 14, 20, 22, 108, -116, 9, -115, 60, 118, 27, -112,
+        117, 106, -42, 47, 115, 16, 33, 103, -27, -128, 27, -120, -1, 119, 100, 80,
+        -103, -16, -21, 104, -52, 95, 3, 78, -50, -33, 32, 14, -125, 58, -87, 116,
+        -73, 91, 31, -44, -50, -24, -5, 12, 20, 65, -96, -98, -128, 90, -88, -123,
+        -86, -97, 69, 97, 112, -113, -47, 50, -37, 24, -88, -62, 34, 7, -73, -124,
+        -120, -73, -48, -39, -68, 95, 99, 70, -25, -52, 117, 79, -119, 124, -34, 13,
+        -125, 81, -33, 57, 2, 78, -24, -80, -45, -63, -11, 48, -72, -44, -65, -116,
+        -36, 22, -72, 55, 77, -61, 69, 101, -83, 47, -60, 51, 116, -90, 118, -99,
+        -125, -23, -127, -77, -68, 101, 29, -25, 96, -127, 15, 30, -76, -93, -65, -2,
+        56, -87, 125, 103, -99, 35, 15, -6, -127, -15, 55, 14, -112, -101, 1, 82,
+        113, 26, 21, 23, 99, -100, -102, 23, -42, 48, -15, -89, 14, -85, 57, -43,
+        82, 74, -39, -106, -45, 32, -83, -108, -84, -12, -37, 12, -83, 54, -65, -128,
+        -91, -116, 106, 100, 40, 51, -12, 3, -40, 64, 76, -46, -116, 38, 75, -87,
+        -7, 8, -32, 75, -128, -88, 69, 101, 50, 53, 55, 5, -62, -51, 38, 4,
+        -94, 102, 73, 11, -97, -111, 85, 88, 50, -114, 38, -108, 62, -48, -14, -46,
+        23, 105, -25, -84, 51, 22, 67, 120, 125, 94, 98, -5, -84, 50, 15, 63,
+        99, -110, 92, -6, 70, -113, -88, 91, 75, 11, -55, 6, -7, 54, -15, -116,
+        120, -103, -76, 13, -118, 15, 65, -125, 112, 84, 42, -64, -128, 121, -44, -54,
+        -116, -39, 90, 114, 3, 127, 107, 127, 108, -101, 121, 87, -83, -123, -97, 50,
+        27, -14, -2, 92, 56, 82, 53, 79, 71, -38, 95, -51, 52, 4, 67, 110,
+        -97, -123, 16, 91, -65, 114, 18, -94, 82, -125, 109, -39, 12, 26, 61, -46,
+        27, 70, 109, 27, 103, -73, -128, -72, 86, -120, -83, 29, 91, -72, -47, 24,
+        -28, -108, 37, -45, -126, 97, 41, 50, 107, -45, -7, 34, 71, -65, 77, 104,
+        -9, -102, -4, 56, -91, -57, -64, 66, -17, 54, 94, -70, -49, 118, -49, 19,
+        13, 111, 125, 79, 97, 77, -99, -87, 8, -61, -109, -36, -119, 24, 15, 90,
+        -16, 40, -40, 112, 122, 11, 1, -79, -52, 96, -49, -95, -55, 23, 115, 66,
+        -64, 118, -45, -97, -46, -51, 38, -123, -35, -10, -96, 65, -6, 34, -91, 65,
+        -97, 48, 114, -39, -82, 60, -17, 52, -62, 48, -85, 126, -111, -75, 21, 1,
+        6, 109, 98, -36, 108, -126, 110, -54, -45, 35, -13, 77, -80, -88, 39, -18,
+        8, -79, -91, -16, -55, -91, -104, -47, -11, -30, 42, -55, -123, 93, -36, 54,
+        -8, 111, -21, -68, 41, 122, -4, -10, -2, 27, 107, 52, 13, -95, -88, 96,
+        -54, 21, 23, 55, 10, 125, 117, -12, 44, -123, 72, 121, -6, 44, -123, 72,
+        82, -104, 73, -46, -108, 74, -77, 37, 68, 94, -14, -26, -32, -54, -40, -62,
+        -122, 90, -37, -120, 74, 27, 104, 0, -125, 45, 55, 88, -70, -81, -48, 95,
+        9, -19, -5, 56, -92, 17, 102, -5, -61, 115, 109, 95, -100, 105, -61, 63,
+        -66, 60, -24, -74, -70, -67, 110, -23, -106, 10, 110, -96, 78, 75, 87, 35,
+        -43, -107, 110, -23, -50, 72, -63, -62, -64, -92, 88, -68, -128, 56, 25, 124,
+        49, 5, -38, 21, -1, 93, 108, 106, 38, 62, -96, -99, 87, -68, -1, 67,
+        -68, -73, -20, -102, 55, -10, -24, -34, 1, -114, 82, 64, 10, 97, 79, -90,
+        -2, 122, -90, 113, 83, -21, -60, 26, -55, -97, -46, -44, 5, 4, 82, -22,
+        6, 116, -4, -89, 126, -4, 78, -14, -119, -6, -11, -121, 28, -14, 33, 74,
+        -8, 27, -47, -12, 6, 63, -50, -61, -69, -115, 112, -70, -110, 126, 35, -47,
+        65, 118, 16, 91, -109, 127, 90, 50, -116, -40, 6, 36, -26, -4, 77, 25,
+        16, -101, 12, -107, 85, 91, 36, 37, 7, -13, -91, 97, -117, 38, 2, -102,
+        50, -76, 78, -122, 43, -85, -61, 11, 110, -119, 91, -57, -107, 115, -123, -63,
+        80, 29, 34, -48, -72, -112, 104, -64, 55, 87, 7, -42, -83, -12, -23, -11,
+        69, 125, 63, -94, -34, 49, -86, -4, 3, 60, -127, 2, -118, -110, -11, 7,
+        -119, -90, 16, 73, 69, -106, -36, 108, 6, 67, 118, -126, 38, -34, 126, -20,
+        67, -97, 126, 12, -124, -121, -85, -46, -122, 64, 100, -3, -48, 15, -43, -21,
+        11, -102, 75, -22, -39, -109, 57, -35, 106, -14, -55, -103, -40, 90, 40, 83,
+        -30, -26, 65, -87, 82, 108, 47, 120, 115, 32, 37, 90, -75, -57, -32, -29,
+        -127, -110, -82, 11, -85, -117, -13, -86, -11, 9, -61, 46, 60, -51, -5, -48,
+        117, -109, -4, 42, 44, -92, 113, -64, 37, -4, -94, -22, 17, 71, -126, -42,
+        59, -93, -119, 16, -15, -75, 85, 21, -128, -60, 17, -112, 93, -78, -87, 103,
+        64, -90, -126, 76, -114, 19, 96, 42, -121, 71, 75, 52, 14, -16, -92, -28,
+        -40, 29, 111, 54, 123, 99, -37, -108, -119, 94, 54, 46, 70, -25, -73, -50,
+        3, -26, -6, 39, 108, 26, 101, 87, -105, -57, 31, -119, 58, 23, 72, -39,
+        -83, 31, 30, -48, -50, 1, 57, 121, 46, -110, -118, -128, -32, -7, 27, 6,
+        -72, 108, 20, -42, -23, 124, 10, 24, -82, -35, -71, 54, -12, -30, -55, 76,
+        64, -1, 30, -88, -80, 68, 120, 24, 17, -47, 38, 12, -60, 31, -3, -123,
+        70, -119, 88, -124, 107, 81, -87, 37, -31, 18, -119, 24, 62, -43, -102, 2,
+        -118, -111, 0, 82, 80, 125, 43, -90, 22, -44, -102, -70, -107, -51, -64, -29,
+        -99, -24, -114, 69, 5, 89, -11, -4, -46, -62, 26, -19, 92, 44, 104, 28,
+        -36, -87, -115, 33, -10, 4, 111, -35, 19, -100, -10, 4, -84, -9, 123, 52,
+        -68, 89, -22, 33, -35, -81, 51, -125, -52, 48, 29, -86, -7, -22, 31, -47,
+        27, -85, -124, 127, -124, 27, -54, 106, 69, -49, -94, 52, 41, -45, -114, 120,
+        81, 106, 72, -67, -62, -68, 13, -35, -40, 34, 126, 114, -67, -25, -26, 45,
+        44, -110, 114, -124, -109, -103, 2, -127, 20, -126, -100, 16, 121, 61, 125, 81,
+        13, 49, -20, 64, 12, -87, 58, -107, -14, -64, -69, -119, -57, 26, -15, 76,
+        98, -104, -96, -53, -42, 118, -69, -83, -104, 68, -116, 48, -127, -62, -116, 50,
+        63, 85, 77, 34, 89, -1, 51, 122, 91, -56, 56, 108, -16, 115, -58, -11,
+        79, -44, 32, 110, 15, 36, -126, 28, -2, -96, 116, -41, -61, 31, 96, -46,
+        -80, -6, 7, 10, 73, -24, -109, 122, 60, -50, 110, 34, -116, 11, -98, 120,
+        -21, 49, -56, 99, -99, 37, -80, -96, 96, 45, -58, 13, -107, 116, -55, -30,
+        120, -108, -14, -16, -45, 49, 21, 90, -108, 11, -23, -106, 75, -123, -82, 100,
+        33, 107, 80, 4, 11, -69, -52, -91, 41, -93, 85, 109, -85, -116, -12, 30,
+        -46, 101, 68, 119, 69, 33, -56, 66, -46, 79, -48, -4, -24, -85, 4, 15,
+        66, 94, 31, 43, -77, -83, -80, 72, -114, -21, -26, 93, 57, -29, 84, -50,
+        -8, 14, -38, 31, -116, -121, 1, -2, -45, 117, -93, -63, 108, -120, 0, -94,
+        63, -98, 61, -42, 27, -85, -36, 65, -91, 92, 97, -110, 8, -104, 60, 93,
+        -118, -1, -108, 57, 15, 58, 49, -56, 67, 72, 82, 26, -51, -22, -38, -22,
+        98, -33, 90, 118, 95, 104, -114, 90, 109, -79, 53, -57, 126, -82, -33, -5,
+        66, -121, 28, -95, 78, 16, -90, 119, 37, -3, -79, 127, -110, -5, -88, 65,
+        -94, -118, -103, -120, 35, 115, 44, 50, 51, 69, -58, -3, -89, -71, 63, 102,
+        19, 99, 112, 63, 21, 25, -18, -40, -54, 20, -102, -12, 47, -16, -16, 120,
+        -118, 122, -20, -36, 52, -77, 12, 116, -58, -44, -23, -2, -2, -108, 45, -24,
+        -72, 68, 88, -85, -81, 76, -19, 69, -1, -56, 95, -80, -53, -96, -63, 116,
+        -34, -71, -22, 95, -95, -75, -5, -118, -84, -35, 108, 20, -84, -96, -4, 5,
+        -16, -98, -36, -65, -56, -39, 53, 109, 15, 75, 65, -67, 51, 59, 36, 27,
+        44, -5, 35, 127, -123, 70, -29, 114, -50, 43, -52, -15, -125, 112, -50, -22,
+        126, -118, -28, 49, 84, -41, 44, 46, -108, 12, 1, -5, 113, 96, 105, 92,
+        -110, -24, 27, -47, -92, 114, -122, 6, 50, -118, 60, 104, -21, -45, 49, -94,
+        -81, -49, -67, 127, 67, -125, 76, -97, 107, -121, -31, 6, 41, -15, 55, 33,
+        -57, -48, -15, 52, -39, -24, 72, 36, -38, -109, -89, -92, 120, 18, 48, 24,
+        -30, 33, -109, 111, -87, 33, 40, 126, -104, -97, 25, 27, 68, 67, 36, -100,
+        9, -26, -95, 12, -125, -92, -27, 16, 71, 0, -125, -72, 60, 37, 80, -45,
+        103, 62, -56, -66, -128, -62, 101, -60, 28, -24, 39, -123, 81, 32, 126, -14,
+        11, -66, -89, 71, -11, 10, -65, 73, -18, 69, 31, -59, -77, 126, -119, -97,
+        -119, -17, 81, -117, -60, 121, -60, 11, -113, -50, -115, -88, 123, 52, 106, -101,
+        76, 56, -110, -95, -123, -94, -7, 110, 40, 42, -123, -118, -93, -123, -78, 97,
+        -8, -128, -29, 11, -127, -93, -23, 34, 119, -127, 124, 89, -32, -79, -11, -99,
+        -41, -65, -13, -17, 122, 50, 51, -93, 118, -12, 67, -54, 91, -41, -21, -26,
+        12, 4, 13, -113, -99, 16, 107, 55, -97, 53, 21, 70, -53, 42, -112, -24,
+        -75, -15, -28, 58, 97, -78, -108, 127, -51, -12, -98, -77, -48, -60, -20, -41,
+        12, 38, 122, 17, -100, 54, 104, -4, -41, -20, 41, -96, -41, -87, 66, -17,
+        11, 104, -12, 92, 88, -42, 111, 112, 34, -35, 83, -110, 7, 46, 105, 82,
+        82, 92, 59, 85, -13, -65, -111, 15, -16, 89, -62, -100, 100, -66, 27, 2,
+        6, -44, 36, 97, -31, 82, -128, 70, 8, 127, -89, 18, -92, 55, -30, 47,
+        124, 76, 69, -10, -35, 91, -40, 63, 101, 123, -125, -112, -103, -112, -118, -118,
+        -95, -19, -17, -33, 10, -116, -7, 20, -36, 14, -78, 97, -55, -89, -16, 124,
+        -85, 11, -33, -32, 10, 93, -121, -85, 103, -99, -108, 7, 52, -110, 126, -59,
+        -75, -125, -48, 59, 32, -50, -73, -50, -15, 57, 40, 76, 7, -63, 39, 64,
+        -25, -17, 57, 42, 78, 74, -36, -75, 18, 19, 126, 61, 77, -75, 40, 98,
+        82, -91, 127, -87, 69, -88, -112, 118, 78, -127, 80, -68, 87, -106, -76, -116,
+        -40, 38, 101, 101, -25, -109, 19, 80, 119, 94, -85, 86, -47, 33, 71, -113,
+        96, -34, -65, 69, 119, -103, 89, 48, 67, 49, 31, 8, -24, -84, 31, -10,
+        -49, 115, -1, 60, -33, -74, -19, -23, -60, 5, 109, -61, -72, -61, -81, -111,
+        -56, 78, -74, 21, 31, -105, 33, 6, -107, -114, -23, -80, 66, 95, -11, -125,
+        101, -101, 8, 24, 76, -31, -19, -18, 83, 92, 98, 78, -106, 61, 49, 98,
+        10, 74, 126, -58, 108, 24, 1, 87, -111, 16, -62, 100, 125, 3, 60, 91,
+        -11, -122, -22, 8, -72, -30, -39, 72, -40, 49, 5, -115, 19, -60, -1, 22,
+        119, -66, 41, 44, 113, 119, -118, -7, 44, -75, 105, -10, -83, 54, 22, 33,
+        -8, -65, -18, -4, -72, -59, 20, 43, 78, -110, -59, -59, -13, -38, 97, 97,
+        -17, 50, -5, 20, 45, -115, -77, 7, -94, 8, -10, 112, 114, 27, 101, 13,
+        22, 35, 98, 117, -12, -83, 110, 50, 2, -116, -111, 119, -99, 74, -72, 97,
+        -112, 106, 102, -93, -33, -92, -118, 126, -85, 10, 31, -99, -42, 81, 112, 105,
+        -6, -100, 110, 54, -126, -75, 54, -93, -28, -107, 101, -110, 53, -8, 127, -119,
+        -89, -31, 87, -56, 81, -25, -101, -115, 123, 9, 124, -27, 106, 127, 127, 89,
+        98, 126, 0, 37, -14, 98, -124, 46, 70, -54, 11, 124, 48, 60, 22, -16,
+        37, -101, -117, 92, -26, 1, 89, 66, -128, -73, 94, -29, 45, 113, -32, 74,
+        87, -64, -107, -96, -64, -107, 55, -60, -61, -86, -63, -107, 102, 73, -93, 70,
+        -89, -50, -88, -18, -124, 79, -24, 68, 29, -9, 95, 98, 90, -97, 102, -116,
+        -100, -107, 49, 114, -94, 49, 114, -52, -54, -32, -14, -127, 21, 52, 1, -121,
+        14, -26, 34, -27, -36, 127, 23, -16, -22, 105, 54, 72, 15, 21, 27, -8,
+        9, 69, 108, 58, 11, -105, -64, 7, 0, 19, 47, -126, 107, -28, -82, -89,
+        -96, -82, -98, -2, -29, 90, 101, 69, 62, 61, 56, 16, -120, 120, 14, -97,
+        79, -121, 64, 87, 97, 66, -25, 30, -5, -124, -60, -32, 28, 39, 118, -105,
+        -77, -105, 53, -86, 119, -117, 123, -104, -67, 13, 94, -42, -82, 105, -79, 39,
+        -72, 51, 75, 112, 56, -33, 2, 7, 11, 121, -16, -48, 82, 65, 5, -26,
+        -7, 2, 26, -1, -44, -65, 66, -81, 0, -1, 19, 122, 3, 44, -13, -29,
+        -69, -63, -37, -31, -93, 27, -8, 7, -56, -59, 11, 92, -39, 23, -98, 32,
+        25, -81, -60, 15, -10, 90, -34, 118, 78, 48, -128, 27, 93, 53, 127, 50,
+        -72, 29, -2, 35, 56, 34, -37, -97, 126, -11, 2, 95, -79, 39, -125, 87,
+        -30, -45, -21, 30, -65, -26, -23, 93, -77, 99, 41, -38, -92, -41, 23, -63,
+        57, 66, -15, -95, -112, -90, -117, 19, -54, -81, 115, -50, 94, 123, 5, 116,
+        -10, -44, 83, 27, -15, 44, -88, -17, -17, 107, -103, -56, -42, -50, -21, 42,
+        40, -3, 9, 37, -123, 17, 55, -118, 34, -19, -86, 35, -17, -31, 30, 97,
+        22, -124, -19, -61, 42, 60, -103, -35, 93, -66, -69, 0, -34, -31, -48, 0,
+        -99, -126, 125, 12, -106, -3, 31, -3, -121, -57, 31, -47, -21, 83, -66, -123,
+        -67, 115, -26, 126, -12, -114, 63, 118, -69, 24, 125, 74, -81, 16, -68, -65,
+        -96, -13, -128, 102, 66, 35, -78, 118, -21, -46, -63, 5, 57, 127, -96, 99,
+        2, 94, 63, 44, -102, -114, -22, 5, 51, 118, -122, -46, -128, 74, -51, -32,
+        37, 31, -53, 40, -7, -92, 106, -84, -87, 56, -55, -126, -66, -124, 71, -123,
+        -104, 116, 112, 45, 44, 66, 40, 94, 104, -41, -54, -56, 50, 16, 9, 25,
+        65, -6, 97, 30, -96, -106, -91, 13, 69, 82, -14, 80, -43, 14, -80, -102,
+        52, 52, -111, -48, -95, -35, 57, 123, -73, -106, 73, -14, -123, 109, -23, 91,
+        -46, 45, -94, 5, 93, 36, 2, -58, -80, -32, -27, -75, -76, -68, -68, 5,
+        95, -109, 76, -31, -107, 102, 10, -108, -40, -95, -107, 41, -36, -57, -47, 97,
+        55, -25, 32, -65, -93, -72, -127, 44, 100, 85, -78, -112, -44, -113, -73, -54,
+        -35, 1, -57, 16, 59, -72, -84, 69, -7, -42, -19, -89, 2, 109, 19, -94,
+        -112, -67, -127, 41, 67, -28, 60, -128, -107, 69, -7, 24, -40, 8, 60, -123,
+        -104, 54, 25, -13, 4, 3, 76, -25, 40, 92, -64, -33, 49, 98, 95, 25,
+        -41, -128, -95, 27, 65, -11, 84, 106, 59, -6, 92, 72, -98, -12, 61, -51,
+        -58, -31, -110, -85, -73, 99, 22, 101, 111, 84, -107, -25, 100, -72, 69, -1,
+        -32, 48, 123, 109, 21, -98, -8, -109, -30, -33, 117, -96, -92, -57, -41, 21,
+        102, 98, 7, -70, 43, 21, -32, -94, 75, 7, -6, -60, 125, -15, 90, 99,
+        -128, -36, 14, 59, 113, -96, -63, 15, -26, -85, 101, 6, 18, 24, 69, -121,
+        37, 89, -96, 63, 56, 98, 71, 67, -108, -115, -126, -37, 124, 7, 115, -61,
+        -27, -88, -26, 95, 22, -74, 102, -30, -77, -48, 5, -6, -95, 45, 45, -122,
+        64, 58, 100, -65, -5, -48, 71, -73, -13, 6, 23, -109, -88, 31, 53, -8,
+        -112, -39, 92, -126, 124, -58, 34, 75, 9, 28, 60, 28, 42, -23, 44, 69,
+        113, 5, 83, -89, -70, 33, -4, -11, -66, 7, -123, -79, -30, 7, 39, -6,
+        -105, 6, -99, -76, 64, 15, 2, 80, -78, -3, -80, 40, -36, 72, -5, -86,
+        97, -84, 48, 33, -10, 97, 18, -36, -127, 69, -45, -122, -128, -74, -96, -105,
+        1, -54, -126, 74, 118, -17, 83, -32, 45, -33, 123, -73, 7, -63, -100, 109,
+        47, 114, 119, 16, -116, 61, 86, -89, -70, 65, 10, -56, 115, -90, -111, -89,
+        -116, 17, 13, 56, 36, -82, -11, -35, -117, 68, 52, -19, -69, -78, -114, 88,
+        -89, 32, 74, 103, -84, -48, -111, -19, 10, 100, -53, -119, 43, -5, 104, -90,
+        85, 33, 114, -1, 62, -87, -103, 125, -75, 60, 12, 12, 16, -13, -126, -109,
+        60, -84, -123, -35, 6, 91, 83, 89, -40, -99, 88, 98, 50, 10, -62, 57,
+        -49, 103, 0, 24, -37, 21, 107, -77, 89, -111, 11, -93, -8, 36, -113, -60,
+        26, -100, -78, 4, 45, -43, 98, -46, -68, 44, 38, -115, -75, 96, 84, 22,
+        -104, 64, -11, 18, -30, 113, -55, 93, 98, 20, 84, 29, 40, -82, -125, -67,
+        17, -56, -116, 9, 119, 47, 61, -112, 19, 65, 81, 69, -71, 78, 41, -83,
+        32, 40, 110, 119, 64, 120, -38, -64, 86, 46, -86, 108, -27, -76, 105, -41,
+        47, -6, -117, 111, -15, 28, 93, -80, -13, 64, -39, -41, 116, 91, -89, -3,
+        -75, 90, 83, -1, -108, -55, 21, -12, 79, -117, -86, -77, -115, 46, 116, -92,
+        11, 29, 21, -20, 20, 125, -103, 120, -93, -55, -96, -33, -4, -70, 68, 30,
+        -124, 121, -6, -109, 17, 74, 80, -16, 58, 33, -51, 35, 17, 40, -7, 18,
+        -92, 97, 97, -81, -67, -109, -82, -84, 79, -12, 111, -31, -54, -6, 66, -1,
+        -82, -38, 115, -39, -85, -32, 100, 112, 55, 4, -23, -11, -43, -63, 21, 72,
+        -73, -20, 44, 120, -43, -67, 26, 60, 25, -126, 20, 55, -19, 119, 47, 64,
+        94, 61, -4, 1, 58, 126, 22, -116, 72, 32, -17, 63, -123, 55, 62, -66,
+        102, -49, -43, 43, 42, -27, 119, -15, 11, 123, 16, 84, -67, 45, -39, 111,
+        104, -41, 124, -48, -1, 41, 119, 31, 120, -66, -76, -14, 31, 41, 43, 63,
+        -64, -25, 113, 21, 56, 3, -31, 12, -3, 55, -12, 80, -89, 83, 114, -112,
+        -26, -6, -9, 40, -93, 118, -124, -65, -53, -119, -5, 75, -16, 24, -89, -6,
+        6, -2, -64, 68, 63, -93, -121, -20, 17, -93, -31, -1, 6, -1, 120, -20,
+        125, 112, 77, -13, 60, -4, -95, -5, -79, -5, -71, -5, -91, 123, -82, -9,
+        -76, -1, -84, -14, -126, -3, 2, -123, -69, -94, -12, -63, -57, -125, -49, 7,
+        111, 14, -84, -46, -49, 43, 47, -40, -81, 65, -3, 54, 98, -58, 107, 46,
+        -86, 30, -5, 61, -8, -75, -81, 22, -19, 87, 115, 48, -122, 46, -64, -65,
+        90, -89, 97, -62, 37, -8, -113, 64, -16, 13, -9, -91, 60, 112, -70, 85,
+        -57, 75, -73, -80, -72, 94, -1, 37, -108, 121, 7, 43, -4, 75, -9, 15,
+        -10, 19, 78, 119, -38, -1, 37, 119, 95, -77, 87, 7, -17, -69, 127, 116,
+        127, -9, 124, 120, 100, -45, -2, -5, -36, 61, 99, -17, 60, -1, -52, 59,
+        70, -92, 8, 126, 98, -97, -24, 79, -9, 21, -22, 26, -95, -64, -74, -97,
+        49, 3, -63, -83, -115, 109, -104, -121, -32, -42, 70, 55, -12, 27, 30, -36,
+        12, 41, -7, 0, 77, -31, -90, -114, 119, 32, -52, -13, 28, 80, -18, -49,
+        33, 102, 30, -32, 57, 32, 93, 14, -68, 48, -55, 3, 113, 87, 97, 41,
+        -124, 94, -59, 100, -127, 122, -92, -71, -102, -27, -49, -11, 89, -34, -64, 44,
+        127, -58, 125, -105, 7, 73, -34, -57, 125, -99, -61, -94, 68, -7, 16, -112,
+        19, -1, 77, 115, 88, 5, 69, 123, -25, 84, 8, -70, -89, 18, 7, -86,
+        68, 87, -105, -16, -77, 28, 3, -76, 1, -34, 66, -71, 102, 105, 68, 95,
+        55, -48, 87, 10, 31, 97, 74, -36, -72, 112, 67, 4, 0, -12, -31, -7,
+        4, -24, 48, -9, 99, 122, 51, -19, -49, 115, 31, 47, -126, 32, 108, -126,
+        113, 14, -64, -91, -65, 93, -98, 23, 13, -100, -8, -45, 118, -11, -58, 82,
+        103, -98, -15, -38, -3, -65, -54, 101, 63, 20, -124, -125, -57, 100, -4, 78,
+        -59, -33, -3, -3, 38, -58, -42, 118, 35, 48, 10, 126, -51, -43, -11, -77,
+        -122, -37, 126, -79, -8, -36, 122, -73, 79, -127, 8, 23, 54, -126, -33, 120,
+        77, -92, -64, -63, -124, 120, 94, -54, 81, 112, -89, 51, -30, 20, -35, -13,
+        -57, -127, -19, -47, 113, 100, 121, 113, -64, -50, -99, 89, 100, 80, -34, -71,
+        74, 54, -101, -67, 4, 51, 97, -30, -127, -74, 107, -97, 0, -32, 5, -106,
+        19, -68, -68, -128, 95, -16, 22, 96, -64, -67, -67, 64, -8, 30, -48, -103,
+        67, -20, -11, -19, -66, -36, 44, -120, 109, -113, 15, -85, -21, -52, -100, 122,
+        22, -2, 29, 93, 79, 99, 4, -57, -66, -21, -50, 112, -16, 28, -29, -31,
+        120, 40, 122, 113, -5, -84, 122, -122, -110, 22, 55, -37, -41, -13, -47, 49,
+        120, -42, -69, 13, 110, 104, 96, 116, 39, 111, 46, -84, -49, 99, -85, -21,
+        -18, -116, -50, -21, -26, 100, -47, 30, -101, -50, -31, -3, -99, -68, -88, 55,
+        -105, 39, 126, -110, -112, -50, -43, 41, -94, 81, 37, -97, 91, 126, 42, -54,
+        30, 19, -47, -45, 91, -114, -66, -7, 3, 43, 24, -126, 72, 85, 78, -95,
+        -127, -124, 36, -125, -42, 30, 101, 104, 66, -103, 93, 32, 34, -71, 100, -104,
+        -97, 10, 47, -15, 117, -117, 93, -101, -94, -14, -94, -121, 54, -98, 13, -23,
+        43, -47, 104, 125, -128, -99, 16, 99, 118, -122, -104, 66, -113, -80, 88, -57,
+        -25, -45, 118, -82, -58, 6, 101, -126, 97, 33, 110, -47, 33, 15, 107, 41,
+        41, -69, 21, -45, 1, -7, 75, 28, 9, -79, -104, 78, 64, 31, 112, -37,
+        35, 84, 71, -9, -48, -37, -48, 31, 12, -101, -28, 76, 107, -37, -3, -58,
+        93, 99, 7, -51, -125, 48, -67, 90, 9, 10, 46, -20, 91, 76, 0, 93,
+        94, 39, -58, 61, 116, 116, 28, -3, 35, 63, -114, 14, 14, 60, -78, 34,
+        -21, 10, -104, 85, 83, -34, 97, -28, 85, 45, 95, -37, 2, -10, 92, -116,
+        -101, -46, 112, 67, -90, 121, -45, 122, 37, -33, -87, -57, 2, 19, 20, 117,
+        16, -31, -9, -108, -35, 31, 54, 62, 57, 48, -55, -13, -30, 51, 5, -127,
+        -14, -19, -115, -63, 16, 52, -92, -52, 20, 59, -41, -105, -116, 44, 61, -17,
+        1, -9, 51, -19, 55, 93, 37, -101, 101, -38, -108, -120, -50, 65, 40, 6,
+        42, -48, -76, 18, 20, -70, -106, 79, -50, -20, 5, -111, -30, 118, -35, -55,
+        -7, 1, 93, 91, 47, -47, 80, -52, 61, -82, -104, -86, 111, 105, 25, -71,
+        118, -22, 45, -104, 81, -69, -79, -76, 112, 57, 37, 93, 97, 14, -101, 3,
+        40, -47, -34, 67, -92, 56, 36, -18, -125, 118, 7, 120, 39, 103, -19, -37,
+        -55, 44, -27, 57, 105, -77, -30, 25, 42, 21, 1, 20, -52, -29, 9, -112,
+        82, -3, -94, 110, 6, 72, -52, 71, -106, 97, -55, -110, 91, -92, 101, -92,
+        -16, -59, 53, -45, 11, 113, 94, 90, 57, -77, -93, -41, -107, 119, 120, 0,
+        -86, -90, 125, 65, 81, 74, -59, 109, 107, 54, 6, -19, -95, -50, 8, -98,
+        91, 118, -21, -50, -77, -4, -98, -26, -24, -83, 39, -75, 121, -113, 20, 43,
+        92, 126, 17, 36, 0, -115, -55, -123, -21, -90, -42, 89, 108, 108, -26, 111,
+        -40, 33, 50, -124, -76, 37, -54, -127, -68, 11, 0, -30, 50, 110, 113, -83,
+        -78, -21, 23, -128, -74, 53, 32, 71, -88, -6, -73, -30, 81, -92, 23, 64,
+        -97, 7, 120, 66, -125, 108, 40, -118, -17, -103, -120, -120, 4, 19, -14, -71,
+        -42, -16, -19, 19, -99, -79, -41, 26, 56, 96, 44, 92, 28, -19, -45, -36,
+        42, -46, 7, -85, -19, 64, -107, -118, 43, 57, -104, -42, 42, 111, 59, 104,
+        -108, -12, -77, -84, -61, 90, -37, 125, 93, -48, 118, -121, 30, -56, -107, -104,
+        -82, -95, -42, 49, 60, 19, -51, 37, 65, -26, -22, 93, 66, 42, 54, -76,
+        44, -67, -117, -3, -103, -34, -75, 49, 16, -100, -71, -96, -14, -119, 117, 61,
+        -41, -61, -21, -112, 56, -125, -103, 116, -128, 117, 61, 76, 34, -100, -114, -7,
+        59, -6, 105, -69, 54, 35, 55, 25, -85, 24, 15, -95, 22, -102, 25, 47,
+        -7, 0, -103, 75, 82, 56, -18, -33, -72, -72, 2, -70, 14, -123, -10, 103,
+        111, -92, 103, -8, 77, -36, 5, 50, -34, 105, 97, -51, -39, 93, 95, 4,
+        -8, 9, -113, 92, -128, 110, 40, 35, -12, 67, 120, 52, -42, -23, -80, -31,
+        12, -23, -66, -53, -94, 81, -96, 44, 8, -26, 18, -109, -21, 94, -117, 10,
+        -17, -60, 117, 99, -63, 88, -113, -114, -29, 127, 52, 116, 40, 15, 92, 98,
+        -32, 60, 8, 64, -76, 57, -56, 25, 40, -22, 85, -81, 4, 34, 40, 122,
+        76, -11, -90, 49, -71, 20, 42, 36, -79, -4, 98, 82, 68, -110, -108, 77,
+        -32, 43, -39, 119, 26, -16, 35, 33, 31, -61, -60, 32, -121, 66, -123, -71,
+        64, -109, -119, -123, 38, 5, -80, 104, -104, 15, 69, -31, -74, -32, 27, -125,
+        62, 80, 0, 69, 22, -88, -127, 50, -102, -123, 14, 74, -12, 6, 62, -5,
+        58, 77, 22, 81, 86, 97, -99, -77, -98, -123, 71, 24, -34, -41, 13, 69,
+        -116, -101, 122, 27, -23, 102, -29, -118, 68, 35, -115, 45, -55, -105, 56, -82,
+        100, -114, 97, -27, 123, -7, -116, -57, -91, 24, 110, -54, -77, 8, 122, -55,
+        68, 64, 106, -36, -36, 44, 5, -126, 32, 115, -27, -38, -104, -116, -68, 0,
+        24, -52, 81, 65, -6, -4, -34, 111, -30, 108, 94, -99, -89, -52, -116, -104,
+        -127, 1, -16, -25, 91, 113, 38, 23, 113, -53, -112, 103, 41, -39, 105, -42,
+        51, -52, 10, -81, -58, 87, 6, 11, 117, -47, 27, 20, -88, 93, 76, -95,
+        0, 5, -128, 106, 47, -92, -64, 52, 19, 62, 99, 95, 120, -16, 24, -127,
+        -8, -122, -2, -82, -85, -30, -126, 63, 0, 122, 114, -58, -39, -108, -77, 55,
+        72, -41, -40, -25, 123, -108, 99, -81, 57, 123, -53, -39, 71, -50, 96, -37,
+        -66, -62, -125, 109, -107, -4, -106, 43, -108, -97, -90, -100, 127, -47, -34, 32,
+        34, -114, -108, -66, -22, -73, -66, -68, -92, -52, -16, -105, -105, -46, -117, 79,
+        -59, 12, -13, 95, -27, 76, 71, 26, -13, -33, -54, 31, 116, 47, -55, -1,
+        8, -65, 76, -96, 40, 31, 70, 33, -94, 17, -63, 16, -48, 49, -37, 31,
+        -27, 108, 4, -68, -54, 58, 1, -67, -122, 55, 58, 78, -103, -1, 68, -3,
+        -94, -74, 63, -87, 95, -94, -15, -41, -71, -78, 55, 44, 64, -121, 44, -5,
+        78, -7, 39, -16, -54, -66, 65, -27, 3, 16, -58, 20, -104, 78, 28, 28,
+        -8, -97, -53, -65, 31, -93, 45, -14, 75, -7, -35, 75, -20, -27, 13, 7,
+        -100, -54, 1, 32, -54, -122, -23, 127, -30, -28, -127, 127, 3, 88, 84, -70,
+        53, -30, 3, -76, -15, -100, -41, 7, 48, -29, 105, -112, -1, -118, 11, 59,
+        8, 40, -18, 104, -107, -16, 95, -28, 90, 110, 122, -115, 44, 58, -13, -97,
+        -27, 76, 40, 112, 62, -84, -50, -46, 64, -31, 86, -117, 78, 23, -22, -23,
+        39, -20, 3, 3, -37, -8, -113, 57, 43, -103, -18, 124, 88, -30, -118, -99,
+        -43, -121, 101, 70, -125, -79, -1, 50, -73, 98, 60, -99, 42, -121, -101, 43,
+        80, -72, -24, 62, -63, 93, 78, 126, -40, -53, -36, 92, -52, -78, -42, -30,
+        28, 94, 75, 47, 105, -1, 105, -50, -24, 6, -116, 127, -106, 23, -20, -19,
+        -35, 98, -108, -52, 117, -120, -75, -117, -16, -118, 1, 117, -101, -81, -72, -17,
+        0, -14, -83, -26, 120, 118, -28, -79, 95, 120, -32, 76, 0, 125, 48, 111,
+        -112, -61, 126, -123, 95, -108, 6, -15, -35, -46, 97, -65, -85, 31, 79, -24,
+        -37, 31, 60, 48, -15, 15, 85, 21, 43, -2, -31, 59, -8, 110, -91, -27,
+        106, 40, -15, 19, 87, -79, -33, 127, -26, 13, -47, -35, -11, 48, -122, -108,
+        -85, 30, 19, -115, 17, 55, -9, -24, -89, -81, 127, 126, -57, -2, -28, 24,
+        96, -9, 103, 94, 80, 48, -20, 15, 44, -113, 2, 71, 119, -40, 5, -72,
+        -84, 28, -58, -93, 0, 83, 58, 56, 116, 84, 25, 79, 28, -70, 14, 34,
+        51, -114, -80, -56, -6, -88, -110, -112, -88, -126, 44, -106, 31, -43, -127, 37,
+        85, -106, 63, 100, -3, -84, 92, 68, 53, 97, -43, 96, -119, 44, 66, 103,
+        -101, -86, -128, 56, 30, -107, -115, -92, -78, -124, -3, -46, -73, -53, -77, 48,
+        10, -42, -72, 5, 79, 49, 9, 51, 90, -29, -75, 89, -70, 30, 46, 17,
+        -45, -78, -51, 67, -8, 50, -71, 3, 94, 18, -115, 29, -123, -76, -125, 35,
+        -10, -125, -110, 118, 69, 70, 98, -23, -16, -85, 81, 78, 37, -108, 6, 57,
+        -65, -44, 97, 67, -78, 73, 51, 0, -107, -96, -46, -124, -42, -41, 35, -112,
+        -41, -42, -43, 0, 28, 55, 68, -91, 79, 54, -94, 5, 29, -88, 81, 26,
+        -108, 12, -43, 47, -62, 4, -38, -91, -84, -127, 86, 58, -107, -123, 77, 70,
+        -25, 113, -12, 85, 81, -4, -27, 1, -92, -107, -119, 82, -122, -45, 45, 71,
+        -54, 53, -47, 58, 100, 41, -60, -80, -32, -117, -56, -43, 80, -55, -62, 21,
+        97, -80, -82, -51, -26, -117, 72, -47, -48, -10, 81, -91, 94, -55, -93, 82,
+        -65, 38, -43, -55, -85, -16, 122, 20, -90, -127, 74, -46, -117, -92, 77, -68,
+        -38, 17, 25, 63, -116, 118, 70, -58, -97, 71, -83, -111, -15, 59, -65, 112,
+        19, 18, -65, 20, 52, -8, 107, 34, -29, -49, 43, -79, -84, 91, -125, -30,
+        -21, -28, 112, -27, -108, 73, -91, -38, 66, 28, -40, 25, 92, -34, -112, -80,
+        -68, 33, -112, -73, -119, 29, 110, 115, 14, -32, -35, -9, 78, 82, -85, 3,
+        96, -117, -123, -46, 105, -47, 29, -112, -11, 112, 89, -70, -16, -57, -15, -68,
+        114, 80, 86, -93, -54, -11, 122, -70, 65, -70, -33, -48, 27, -53, 56, -61,
+        38, -77, 30, -91, 12, 20, -7, 100, 103, -43, -80, -30, 83, -88, -101, -71,
+        -75, -64, -23, -37, -126, -9, -102, 56, -21, -120, -84, -107, 104, -41, 63, -15,
+        -19, -47, -80, -15, -5, -18, 40, -17, 54, -52, 11, 43, 74, 123, 125, -3,
+        -9, -2, 18, 2, -88, -80, -55, -117, -27, 28, 54, -62, 115, 74, 19, 86,
+        -49, 98, 41, -10, -78, -118, 2, 45, 3, 99, 72, 65, -77, 33, 119, -91,
+        82, -83, -42, -9, -40, 113, 108, 75, 15, 90, 69, -85, 14, 112, -67, 21,
+        111, 85, -8, -7, -35, 120, 123, 111, 20, -3, 70, -28, -61, -108, -18, -51,
+        -40, -73, 3, -94, -115, -40, 37, -61, -83, 111, 67, -80, -42, 34, 91, -15,
+        -39, -103, -122, 115, -116, -69, -50, -98, -53, 6, -22, 121, 116, -60, 96, -104,
+        10, 19, 124, -81, -128, -18, 101, 28, -66, -92, -88, 104, -56, -115, -28, 2,
+        58, -126, -63, 104, 13, -50, -51, 3, -127, 72, -91, -110, -98, -47, -75, -127,
+        78, 36, -82, -91, 123, 123, -74, -111, -46, 100, 120, 50, 5, 90, -52, -107,
+        -115, 17, -85, 31, -84, 127, -31, -27, 92, 17, -123, -33, 17, 90, 77, -57,
+        114, 9, -22, -128, 10, 112, 13, -8, 53, -23, 96, 119, 29, 53, -121, -50,
+        77, -108, -49, -110, 85, -34, 9, 59, -46, 94, 61, -23, 56, -115, -67, 59,
+        50, 48, 118, -17, -125, 54, -59, -28, 69, -123, 116, -106, -126, 108, -65, -25,
+        -115, 3, 118, 30, 39, 73, -114, 54, -125, -27, 119, 89, 71, 65, 58, 83,
+        -67, 119, 68, 83, 29, 119, -106, -25, -53, -52, 63, 60, -108, 24, -10, 17,
+        -76, -21, 20, 100, 13, 79, 38, 77, 41, -83, -35, -79, 35, 8, 112, 45,
+        -115, -89, -98, 126, 95, -43, -112, 25, -128, 18, -73, -71, 28, 102, -5, 74,
+        -37, -66, -7, -43, -123, -17, 52, 23, -76, -14, -74, -44, -38, -88, -25, 44,
+        121, 109, -119, 59, 110, 121, -105, 5, -97, -71, 14, 16, 79, 88, -52, -83,
+        108, 2, 21, 94, 92, -39, 114, 58, -76, -32, 79, 92, 36, 105, -45, -54,
+        65, 45, 15, -92, 0, -119, -116, 72, -40, 16, -2, 31, -41, 8, -123, 87,
+        -83, 119, 39, -47, -10, -62, -126, 40, -23, -30, -23, -114, -30, -85, 101, 87,
+        68, 83, -46, 85, -24, -114, -10, -10, 74, 36, -45, 87, -85, 73, -85, -72,
+        -122, 49, -35, -71, -58, 88, 49, -75, -80, -122, 26, 100, 20, -13, 80, 105,
+        -54, -17, 81, 17, 114, -99, 46, -22, 31, -22, -18, 13, -58, -72, 78, -93,
+        -123, 107, -112, 126, -53, 68, 28, -81, -49, -5, 81, -28, 115, -8, -81, -97,
+        69, 126, 28, 21, 21, -82, -79, 46, -59, 86, 13, -86, -28, -80, 44, 63,
+        -56, 36, 125, 66, 89, 84, -21, 38, 3, 58, -8, 121, 81, -62, -79, -42,
+        -128, -5, 125, 29, 109, -119, 57, 38, -41, 79, 45, -115, 39, 102, -23, -60,
+        -76, 100, 77, -31, -59, 120, -16, 8, 15, -17, -54, 12, -36, 23, 25, 37,
+        -54, -24, -85, 81, -53, 118, 28, -45, -104, 110, 80, -48, 62, 66, 106, -13,
+        55, 82, 102, 48, -29, 118, 83, -38, 83, -22, 109, 81, -80, -118, 23, -97,
+        -82, -88, 32, -91, 6, -96, 0, 89, 20, 67, 125, 50, 90, -26, -12, -101,
+        -115, 21, 48, -79, -100, -102, 84, -24, 49, 120, 74, -6, 28, -103, -46, 78,
+        78, -61, 84, 75, 120, -12, -90, -89, 27, 12, -74, 70, -31, 126, 88, 12,
+        61, -74, 6, -34, -100, 51, -8, -25, -86, -110, 21, -54, 2, 53, -93, -92,
+        -35, -104, 24, 23, -29, 123, -99, 65, -57, -104, -123, -47, 93, -125, -82, -19,
+        3, -55, 16, 34, 19, 47, 76, -46, 4, -99, -107, -79, -92, 17, 119, -52,
+        79, 76, -46, -72, 93, -59, 118, -104, -67, 111, -84, 20, 21, -95, 72, 82,
+        110, -14, -118, -115, -48, -87, -113, 97, 22, -78, -33, 57, -37, -117, 76, 2,
+        11, -18, 121, 74, 110, -3, -85, 57, 20, -57, -47, -50, 28, -118, -9, 72,
+        -106, -8, -115, 105, 16, 61, 61, 124, 74, 82, -119, -16, -49, -92, 116, -16,
+        3, 37, 109, 0, -84, -56, -109, 24, -48, 9, 22, 4, -24, -126, 72, -7,
+        0, 29, 0, -25, -65, 8, 71, 34, -50, 61, 124, 106, -50, 79, -20, -2,
+        -55, -19, 84, 14, -108, -69, -125, 87, 103, -82, 103, 28, -103, -4, -121, 20,
+        -42, 92, -29, -117, -42, -39, 61, -92, 83, 81, -68, -30, 38, 19, 124, 15,
+        5, 83, -8, 52, 121, 29, -26, 51, 10, 103, 28, 91, -85, 36, -41, -104,
+        -82, -68, -106, 94, 27, -23, 29, -124, -50, 12, -3, -90, -101, 123, 4, -119,
+        39, -125, 50, 32, 88, 108, 45, -108, -103, -111, -95, -93, -68, -30, 98, -118,
+        -86, -86, 44, 25, -72, -23, 90, 0, 25, 72, 64, 110, 54, 50, -79, -75,
+        -40, 16, 27, 65, 3, 116, -102, -21, 13, -58, 107, 106, -49, 117, 93, 5,
+        80, 82, 85, 62, -72, -91, 121, 8, 123, -105, 61, 18, 55, -23, -47, 59,
+        -118, 89, 18, -48, -3, -59, -78, -32, -97, 0, -54, 72, 124, 65, -5, -42,
+        -55, 50, -6, 69, -40, -60, -98, -125, 32, 59, 23, 89, 74, -43, -22, -34,
+        55, 65, 55, -117, 2, 71, -8, 80, 107, 32, -96, -69, -62, -81, -100, -3,
+        -50, -121, 86, -54, 24, 66, 51, -62, -112, -104, 28, 64, 76, 26, 44, 110,
+        -1, 110, 77, -115, -103, 9, 58, -72, 8, -13, -15, 12, -38, -5, -103, 11,
+        109, -33, -73, -116, 25, 12, 94, 74, 27, -122, -74, 126, 88, -17, -108, 93,
+        -29, 103, -50, 106, -39, 76, -116, 21, 5, -81, -100, -74, -20, 105, -111, -31,
+        83, -121, -110, 69, -33, -46, 100, -119, 76, 59, -68, 10, 5, 85, 96, -119,
+        -76, 56, -120, 80, -34, 73, -81, 74, 24, -127, 34, 36, -106, -82, 73, 41,
+        -52, -101, 90, 17, 10, 43, -53, 20, -107, -86, 101, 123, 121, -57, 97, 102,
+        108, 44, 14, 54, 107, 11, 41, -45, 107, -38, -91, -13, -24, -34, -91, -1,
+        -96, -122, 13, 69, -87, 126, 23, 123, -96, -59, -114, -70, -75, -26, 31, 52,
+        -22, 74, 104, -98, 90, 10, -9, 45, 36, -75, -102, -3, 101, 28, 41, -4,
+        -104, 69, -54, 126, 59, -127, 39, 82, 25, -107, -75, 23, -81, -83, -31, 72,
+        29, -74, -118, -126, 53, -119, 77, -81, -120, -7, 1, 59, 12, -25, 93, -13,
+        -103, 118, -113, 74, -22, 37, 12, -111, 38, -73, 49, -122, -95, -118, -78, -9,
+        81, 22, -115, 40, -107, 39, -7, -34, 74, -11, -42, 23, -82, 76, 5, -101,
+        -106, 59, 80, -58, -58, 114, -61, -114, 6, -64, -122, -94, 61, 59, 118, 47,
+        58, -7, -89, -43, -103, 121, 87, -22, -45, 85, -106, 70, 101, 1, 85, -106,
+        -58, -91, -79, 52, 62, 40, 91, 26, -107, -99, -79, -100, -27, -46, 104, 1,
+        90, 109, 52, -103, -97, -105, 40, 117, -13, 73, 45, -113, 25, 89, 38, -73,
+        -38, -5, 86, -69, -19, 125, -45, 118, 123, -97, -93, -41, 69, -104, -17, -14,
+        -122, 36, 94, 26, 68, -98, 125, 57, 8, -57, 47, 21, -104, -112, 70, -33,
+        -108, -93, 81, 101, 47, -83, -26, -124, -41, 43, -79, -65, -113, -23, 76, 25,
+        -81, -104, -97, 102, -111, 54, 13, 44, 86, 72, -101, 69, 121, -60, 102, -111,
+        5, -18, 74, -90, 36, -98, 73, 83, 75, -13, -128, -5, 110, 125, 36, 117,
+        59, -60, -50, -50, -24, -93, 54, 28, 49, -39, -73, -25, 95, 53, 89, -95,
+        -52, 98, 2, -35, -111, -42, -107, -110, -19, 97, 18, 85, -51, 30, 114, 28,
+        -115, -24, 32, -76, 2, 61, 122, 107, 117, 116, 102, 57, 37, -122, 107, 19,
+        -113, -48, -45, 85, 29, 103, 18, 93, -125, 42, 45, 85, 25, -36, 50, 101,
+        97, 87, -65, 102, -83, 107, 84, -75, 14, 58, -45, 16, -77, 21, 87, 80,
+        53, 47, -102, -78, -52, -19, 72, 108, 103, -19, 53, 74, 97, 103, -3, -90,
+        60, 118, 10, -73, -20, -28, -113, 10, 60, -83, 121, -27, 90, -48, -50, 106,
+        -69, 39, -37, -51, 37, -15, -60, 101, 97, 26, -75, -54, -32, -79, -88, -118,
+        112, -82, -85, -83, -46, 81, 81, 71, 29, -104, -28, -91, 86, -24, -19, 49,
+        -75, -127, 25, -72, -113, 12, 119, -121, 103, 89, 35, -55, -107, -48, 118, -30,
+        -80, 43, 120, -123, -3, -33, -124, -23, -60, 97, -105, -14, -116, -122, 10, 32,
+        -111, -60, 66, -118, 96, 17, -63, 96, -93, 82, 17, 67, -38, -20, -110, -114,
+        92, 33, 77, -47, -82, -1, -99, 20, -115, -30, -88, 27, 122, 6, 29, -28,
+        32, -61, -127, -26, -91, 83, -81, -17, -90, 109, -105, -69, 105, -37, 104, 11,
+        109, 51, 0, 44, 40, -65, 125, -55, -36, 43, 71, -72, -39, -108, -105, 91,
+        3, 77, 89, 61, 85, -118, 98, 3, 56, 109, -116, 23, -69, 91, -13, -35,
+        69, 84, -29, -31, 84, 50, -118, 43, -85, 73, -71, 121, -87, -15, 25, -55,
+        6, -49, 68, 41, 82, -84, 26, -92, 0, -30, -80, 121, 56, -38, -47, -118,
+        20, 55, 68, 43, -43, 101, 56, 2, 66, -59, 91, -127, -128, 18, 82, 109,
+        -35, -22, -77, 3, 90, 84, 29, -80, 52, 83, -40, 104, -59, 43, -74, 10,
+        50, -19, 8, 121, 22, 99, -66, -56, -10, 48, 63, -125, 126, -119, -79, -13,
+        27, 52, -127, -14, -2, 38, -75, 22, 59, -90, 36, -25, 42, 75, 35, 23,
+        -95, 11, -108, 58, -118, -47, 81, -60, -22, -8, -19, 120, 23, 4, 87, 81,
+        63, 26, -88, 58, -35, -121, 67, 93, 41, -62, 100, -68, 74, 105, -83, 1,
+        118, 93, 82, 67, 52, -44, -102, -6, 0, -119, 115, 22, 77, 115, -88, -37,
+        -65, -118, 124, 64, -124, -108, -10, -82, -34, -28, 119, -72, -55, -55, -63, -86,
+        -117, -47, 57, 58, -14, 89, -122, -30, -24, 0, 93, -24, -46, 27, 120, -52,
+        0, -69, 63, -35, 117, 41, -106, -31, 13, 86, -77, 95, -100, -64, 11, 121,
+        -53, -93, 43, 35, 33, 62, 69, -47, -116, 50, 75, -55, 55, 114, 123, 95,
+        68, -91, 77, -19, -107, -13, -45, 6, -91, 19, -126, -30, 74, 122, -77, -69,
+        13, -4, -91, 114, -20, 96, -121, -82, -86, -91, 104, -111, -55, 61, -94, 56,
+        -26, 41, -107, -24, -26, -98, 58, 41, 42, -47, 109, -45, -95, 36, -38, -46,
+        20, -127, 54, -94, 103, 115, 18, -9, -59, -5, 76, -45, 82, 109, -110, -55,
+        42, 44, -10, 4, 104, 57, 15, 30, -15, -125, -36, -37, 90, -21, 46, -70,
+        119, -47, -101, 8, -32, 42, -118, 118, 115, 10, 38, 34, -52, 116, -94, 10,
+        -3, -38, 53, 42, 71, 69, 61, -44, -100, -13, 94, -43, 78, -94, 29, -59,
+        105, 22, 59, -54, -48, -16, -67, 34, -54, -108, -55, -115, 82, -18, -107, -116,
+        47, 102, 1, 30, 1, 63, -85, 65, 95, -50, 52, 11, -81, 65, 89, -96,
+        -36, -81, 85, -117, 88, -5, 60, 75, 25, 126, 117, -16, -57, 64, -98, -62,
+        56, 69, -53, -102, 10, 55, 105, 109, -58, 104, -60, 18, 50, -83, -99, -123,
+        113, -76, 68, -2, 11, 59, 79, -89, 11, -50, -119, 66, -110, -36, 80, 53,
+        -66, -18, -17, -41, -48, -14, 81, 9, -115, 15, 98, -83, 42, 111, -103, 53,
+        -29, 70, 111, -106, 13, 54, 36, -43, -87, 27, -99, 49, 89, -83, -124, 69,
+        102, -66, -71, -100, 125, 120, -80, -114, 92, -37, 90, 11, -96, -57, -112, 76,
+        -128, 111, -53, -37, 15, 36, -16, -74, 15, 69, 91, -1, 84, -37, 77, -3,
+        70, -5, -5, 77, 22, 77, -126, 116, -47, -118, -113, -40, -6, 61, -63, -83,
+        6, -15, 28, -69, -81, -11, -30, -55, -21, -68, 65, -44, 119, 91, -114, -15,
+        -56, 55, -93, 17, 58, 24, 83, 81, 125, 17, 85, -51, 71, 1, -101, 109,
+        -93, 19, -39, 114, 19, 100, -113, -28, -52, 77, 110, -107, 21, -69, 91, 37,
+        79, -81, -110, -80, 61, -76, -69, 41, -62, 125, 42, -91, 51, 82, 107, 29,
+        118, 30, 5, -42, 97, -94, 124, 121, 43, -43, 100, -21, -43, 39, -46, -105,
+        81, 19, -58, 3, 22, -121, -67, -44, -102, -12, 91, -3, 69, -38, -112, -39,
+        19, 16, -34, -108, 94, -122, -30, -99, -106, -13, -128, -23, -116, 18, 96, 35,
+        120, -71, -97, -67, -80, 75, 53, 56, -22, 84, 69, 63, 93, 89, -65, 82,
+        114, -33, -85, -81, -13, -103, -103, 0, -22, 37, 87, -127, -79, -11, 56, 98,
+        -110, 93, -15, -63, 97, -115, -119, -52, -43, 80, 3, 101, -124, 87, -7, -93,
+        31, -61, -121, 39, -16, 65, 19, 120, 45, -29, -44, -118, -110, -36, 113, 1,
+        95, 44, 93, -119, -116, 60, 70, -50, 108, 77, 12, 46, -82, 14, 60, 14,
+        -123, 75, -21, -123, 114, -69, -87, 6, 64, -50, 118, -72, -41, 60, -39, 45,
+        -110, -66, -40, 34, -110, 10, 108, 80, 46, 54, 121, -77, -113, 77, -117, -121,
+        77, -18, 105, 29, -67, 84, -36, 120, -41, -108, -90, -66, -39, -76, -99, 126,
+        -33, 70, -84, -22, 111, 81, -44, 125, 15, -76, 100, -84, 97, 124, -60, 118,
+        100, 114, -41, 48, 86, -90, -75, -118, -41, 65, 73, -119, -4, -92, 121, 86,
+        56, -7, 8, 11, -2, -124, -80, -57, -83, -30, -117, -104, 59, -87, 102, -78,
+        19, -8, -83, -108, 41, -108, 117, -75, 56, 81, 26, -83, -107, -81, -66, 52,
+        88, 82, -54, 119, -72, 100, -120, 69, -70, 15, 68, 30, -18, -126, -120, -58,
+        -27, -98, 45, 126, -17, -14, -116, 120, -87, 65, -13, 121, -59, 87, 92, 83,
+        49, 11, 10, 56, -42, 51, 28, -89, -21, 85, -13, -48, 107, 81, 94, 42,
+        -106, 46, 1, -55, -40, 41, -124, 96, 47, 24, 22, 59, -115, -108, 30, 99,
+        111, 110, 122, 93, 89, 7, 99, 0, -39, 58, -75, -86, -101, -115, -112, -95,
+        -33, -107, -99, 109, -54, 43, 94, 52, 82, 3, -37, -105, 125, 25, -71, 107,
+        99, -87, 123, 44, -24, 87, 89, 113, 83, -29, -12, 108, 59, 95, 29, 20,
+        69, -87, 55, -117, -96, -40, -35, 93, 67, 119, -74, 74, 83, 54, 104, 32,
+        19, 46, -31, -32, -70, -126, -26, 90, -111, -87, 56, 65, -107, -117, 41, 11,
+        68, 19, -79, 44, 11, 76, -14, 56, 50, 112, 70, -13, 100, -4, -55, 105,
+        -76, 30, 85, -3, 102, -92, 104, 117, 15, 15, 27, -55, -96, -116, -69, 88,
+        115, 89, -40, -39, 24, -68, 82, -46, -8, 90, 89, 117, 31, 51, 56, -86,
+        -100, 111, -39, 12, 66, -60, -25, -74, 17, -51, 59, -26, 34, -7, -127, -87,
+        15, 84, 99, 59, 80, -54, 100, 100, -21, 94, 41, -37, 5, 75, 122, -67,
+        65, -33, -38, -66, 108, -32, 33, -69, 125, -31, 36, 24, -21, -124, -75, 40,
+        -13, -51, -90, -19, 89, 52, -79, -95, -75, 48, 76, -107, -69, 83, -26, 0,
+        64, -119, 69, -108, 101, 86, -57, 36, 125, 85, 15, -119, -76, -118, 42, 33,
+        -96, 100, -128, 58, -121, -71, -108, -13, 123, 44, -73, -111, -127, -128, -72, -71,
+        33, -20, 18, -110, 104, -56, 8, -3, 118, -17, 22, -76, 119, 82, -32, 70,
+        26, -96, -70, -88, 76, -40, -100, 49, -76, 76, 25, 43, -43, 52, 16, -31,
+        -91, -34, 80, -125, -21, 81, 42, -75, -105, 78, -10, 104, -79, -44, -64, -52,
+        23, -82, -65, -72, 86, -78, -93, 70, -78, -45, 111, 124, 43, -101, -4, 26,
+        64, -109, 32, 107, 81, -9, -11, 86, -118, 64, 73, 6, 119, -17, 113, 73,
+        13, 26, 54, 121, 51, -11, -112, 28, 112, 87, 89, -94, 9, -34, 46, -55,
+        75, 115, 16, 2, -125, -64, -108, 54, -63, 64, 50, -64, 79, 101, 125, -10,
+        -124, 80, -123, 110, 59, 24, 51, -128, -106, 53, -92, 42, -34, -70, 71, -49,
+        35, 1, 84, 123, -53, -83, -101, 76, -43, -115, -50, 62, -62, -44, 93, 108,
+        91, 54, 84, 44, -74, 10, 21, 90, -126, -40, 38, 93, 52, 91, -77, -53,
+        4, 86, -26, 14, -34, 97, -119, -111, -127, -51, 121, -80, 77, -5, -2, -29,
+        88, -87, -33, -62, 0, -73, 19, 18, 111, 49, -27, -88, -101, 107, 33, -88,
+        -91, 89, -83, -43, 111, 39, -37, 111, -17, 65, -74, 91, -27, -93, -81, -87,
+        92, 29, 30, -81, -48, -29, 42, 125, -82, 14, 91, -97, 13, 87, 8, -42,
+        -6, -33, -66, 78, 6, -93, -115, -107, 3, -17, -95, 63, 82, 121, -126, -9,
+        -84, -61, 30, -70, 55, 34, 13, 127, 24, 31, -63, -15, -43, -81, 55, -62,
+        -26, -41, 0, -123, 65, 62, -60, 91, 51, 28, -115, 9, 5, -123, 33, 0,
+        -6, -44, -36, -28, 27, 25, -101, -60, -18, 97, 103, -109, 69, -61, 110, 109,
+        92, 13, -85, 85, 74, -58, -34, 94, -124, -58, 1, 101, 90, 29, -120, -20,
+        -36, -18, 91, 92, -120, -94, -32, -43, 95, 118, 33, -118, -66, -34, -123, 8,
+        -85, -96, 113, -94, -88, -5, 22, -104, -101, 84, 68, 16, -84, -61, -3, -6,
+        -67, 40, 65, 50, -122, -33, -107, 15, -11, -115, -100, 101, -114, -105, -98, -91,
+        -55, 66, -89, -127, -92, -77, -4, -29, -127, 115, 2, 114, -37, -55, -101, -89,
+        39, -114, -19, 42, -126, -64, 82, -18, 37, 120, -62, 87, 115, 16, 16, -116,
+        -107, -93, -74, 72, -116, 54, 111, -48, -121, 84, -103, 115, 117, 120, 22, -118,
+        78, 37, -33, 83, -122, 116, 17, 30, -77, -20, -99, 102, -55, -123, -92, -30,
+        57, 100, -100, 122, 85, 117, 119, 82, -102, 100, -53, -14, 113, -19, -85, 64,
+        -3, -94, 20, -15, -58, 125, 21, -95, -41, -62, 43, -19, -75, -16, 90, -37,
+        90, -50, -28, 19, -7, 11, 124, 20, -90, 27, 122, 126, -122, 86, 29, -48,
+        -126, -58, 97, 124, 29, 10, 125, -37, 97, -49, 69, -127, 50, -7, -42, -123,
+        28, -10, -96, 100, -5, -79, 62, -4, 86, 49, -32, 88, 118, 27, 25, 66,
+        5, -67, -1, -40, -29, 29, 22, -100, -70, -59, 70, -43, -82, -103, 112, -66,
+        124, -99, 9, -89, -90, -64, -2, -9, 88, 103, -66, -42, -72, -14, -37, 110,
+        -29, -54, -29, 45, -58, 21, -77, 2, -1, 110, 3, -53, -50, -37, 71, -42,
+        -30, -1, 37, -45, 74, -39, -22, 81, 57, 43, -106, -7, -111, 54, -82, -80,
+        96, -23, -67, -15, -1, 70, -59, 43, -13, -17, -77, -5, -85, 93, 98, -40,
+        90, 29, -88, -120, -56, 74, -14, -40, -94, -113, 53, -113, -32, 117, -76, -45,
+        -114, 114, 22, -35, -25, 22, -45, -42, -75, 43, -86, -42, 21, -116, 106, -44,
+        98, 113, -38, 109, 89, 50, 93, 109, 65, -118, 123, -39, -116, 70, -13, 85,
+        -38, 110, 5, 109, -122, -40, -57, -70, 81, -89, -124, 65, -33, 32, -119, -67,
+        -114, -40, -57, -24, -65, 79, -89, 104, 67, -4, 93, 34, -1, -125, -88, 121,
+        -31, -22, -18, 58, 127, -43, -68, -43, 108, -70, 82, 34, -43, 118, 75, -43,
+        113, -59, -62, 101, -7, -76, 105, 68, -79, 28, -25, -116, 1, 44, 47, 121,
+        -52, -107, -99, -28, 90, 47, -82, -106, -35, -29, -14, 62, 45, -17, -3, -44,
+        90, 73, 41, -37, -96, -3, 28, -96, 45, -4, 78, -2, 45, -58, -75, -65,
+        96, 11, -79, -74, -14, -73, -37, 67, -74, 76, -45, -77, -100, -63, -65, -43,
+        -105, -3, -53, -65, -59, -105, 29, -3, 39, -24, -18, 77, -10, 91, 4, -118,
+        -126, 115, -23, -96, -97, -74, -59, -7, 105, -50, -33, -30, -15, 46, 4, -87,
+        -83, 18, -85, 17, -108, -74, 73, -83, 102, 49, -66, 81, 114, -123, 57, 127,
+        -85, -16, 42, 110, -96, 106, 15, 18, 37, -89, 62, -40, 37, -89, 54, 8,
+        -87, -49, 34, -110, 76, -93, 61, 74, 15, -14, -91, 77, 64, -3, 114, 111,
+        1, -75, 100, 73, -101, 39, -31, -92, 13, -92, 98, -88, -27, 75, -99, -22,
+        -116, 18, 70, -27, -75, 97, -110, -89, 110, 100, -73, -101, -19, -20, -115, -78,
+        -91, 23, 103, 96, 72, -9, 112, 64, -12, -23, -5, 0, 27, -41, 63, 12,
+        -95, 26, 58, -98, 39, 67, 6, -19, 53, 93, -61, -78, 51, -125, -73, -113,
+        92, 64, 83, -56, -15, 95, 72, -114, -1, -94, -27, -8, 55, 32, 47, 59,
+        -33, 59, -2, -64, -95, -50, 73, 84, -63, -69, 55, 17, -34, 14, -99, -121,
+        40, -57, 75, 25, -26, -16, 95, 52, -18, -63, 63, 111, -70, -61, -17, 31,
+        28, 70, 67, 22, 66, 45, 97, -52, -125, 66, -77, -108, 79, -31, 79, 30,
+        -27, 36, -16, 0, -45, 119, -96, 4, -116, 5, -93, -126, -115, -24, -97, 20,
+        -1, 29, 39, 115, -15, 103, -62, -15, -17, 36, -70, -58, 63, 124, -127, -1,
+        -50, -88, -60, -20, 33, -3, -5, 3, -3, -5, 35, -3, -5, 127, -24, -33,
+        -65, -45, -65, -1, -123, -1, 70, -12, -49, -30, 10, 70, -112, -91, 99, -68,
+        43, -108, -114, -23, -18, -110, 19, -50, 115, 107, 24, 50, 14, -88, 10, 12,
+        58, 100, 115, -86, 41, -58, -80, -92, 127, 82, 26, -121, 8, -59, -73, 0,
+        82, 78, 15, -53, 48, -90, -65, -85, -111, -8, -77, -108, -111, -6, -110, -8,
+        10, -97, 86, -12, 15, 22, 45, -40, 103, 29, -19, 16, 118, 22, -46, -8,
+        43, -54, -7, 11, -99, -114, 41, 109, -82, -126, 12, -34, 15, 66, -38, -125,
+        112, -123, 102, 96, -49, -31, -72, 97, -3, 114, 113, -39, -119, -90, 113, 59,
+        -113, -30, 79, 62, -43, -64, 16, -79, 81, 112, -8, 47, -73, -65, -9, 49,
+        4, 100, 24, -89, -47, 50, -9, 61, -73, -17, 15, -62, -18, -105, -93, -18,
+        -1, 127, -48, -21, 14, 15, -4, -51, -32, 95, -5, -2, 97, -1, 111, -61,
+        -17, -15, 11, 62, 108, 30, 120, -34, 97, -60, 126, -119, 2, 82, 79, 44,
+        7, -126, -68, 23, 3, -40, 113, -121, -61, 6, 122, -103, -36, -88, 11, -81,
+        38, -47, -108, 38, 7, -111, -41, -33, -5, 44, 98, 27, -94, -115, 74, 49,
+        -35, -9, -6, 54, 5, -74, 68, 46, 16, -98, -25, 115, -5, 50, 19, 116,
+        36, 113, 15, 112, -2, 13, -65, 122, 122, -69, -12, 60, 25, 113, 16, 63,
+        -53, -36, -93, 40, 56, -80, 95, -47, -91, 18, -45, -127, 32, 95, -14, -33,
+        68, -116, 34, -54, 1, 3, -61, -80, 122, -73, -64, -47, 78, 17, 41, 49,
+        109, 56, 102, 35, 69, 71, -10, 44, 68, 94, -8, -123, -4, -40, -43, -13,
+        -77, 88, -72, -68, 3, -128, -105, 40, 106, -6, -50, 63, 0, -83, 30, -3,
+        -29, 16, -1, 117, 10, -10, 123, -87, 23, 117, 9, 85, -9, -91, 95, -40,
+        61, -70, -11, -72, 26, 52, 4, 75, 109, 84, 35, -87, -65, -126, 1, -55,
+        -72, 27, 86, 117, 51, 58, -55, -118, 10, -10, 7, 12, 12, 70, -48, 16,
+        -8, 99, 83, 117, -76, -49, 36, 25, 111, 8, 17, -94, -12, -43, 119, 127,
+        -35, -43, 116, -85, 38, -7, -21, 110, 77, -14, -9, 45, -102, -28, -123, -100,
+        -1, -77, 16, 7, 117, -25, 20, -94, -29, 92, -8, 96, -105, -45, 20, 81,
+        68, -99, -84, -30, 52, 44, -54, -102, 43, -104, -38, -104, -115, -79, -78, 94,
+        39, 25, -55, 113, -49, 12, 75, -12, -12, 29, 59, -119, -67, 120, 112, -102,
+        -43, -70, 84, 62, 80, -6, -125, 116, 97, 124, 116, 84, -116, 103, 64, 0,
+        -71, -6, 80, 85, 124, -57, 51, 14, -62, -97, -2, -56, -102, 70, 27, -48,
+        93, -60, -122, 15, 120, 61, 49, 47, -88, 14, 40, -42, -49, 1, -75, -36,
+        -5, 123, -99, -109, -117, -43, -13, -117, -77, -105, 114, 9, 23, -31, -35, -120,
+        -65, -107, -56, 87, -122, -102, -62, 58, -21, 62, -36, -128, -77, 104, 8, 123,
+        83, -62, 26, 17, 48, 106, 3, -74, -89, -35, -9, -12, 68, 49, -72, -95,
+        117, 45, 65, -57, 61, -64, -84, 6, 81, -80, 99, 81, -20, 62, -52, 118,
+        51, -119, 90, -9, -9, -85, -41, 22, 0, 78, -111, -70, -128, -37, 113, 48,
+        123, 122, 113, -119, 100, -12, 84, 66, 95, -122, 21, -112, 1, 4, -22, 95,
+        88, -45, 98, -23, -7, 21, -43, 85, 92, -17, 4, -109, -25, -75, -12, -75,
+        -42, 123, 20, -93, 100, -31, -82, -114, 112, -117, 123, 69, 25, 124, 37, 7,
+        60, 35, 18, 69, 76, -124, -86, 117, 93, -66, 3, -120, 64, 113, -5, -119,
+        43, -81, -111, -11, 46, 65, 30, -112, 8, -14, 34, 86, 123, -52, 77, -15,
+        6, 72, -20, -107, 111, -4, 34, 1, -21, -57, 59, -80, -121, 123, 126, -36,
+        -61, -53, 115, 114, -60, 1, -9, 99, 125, -101, 2, -26, 82, -63, -75, -22,
+        -98, -112, -54, -91, -4, 94, 11, 107, 77, 87, 45, -28, 6, -45, -41, -47,
+        -92, 41, -66, 41, -72, -87, -50, 26, -124, -18, 101, 10, 104, -92, -78, 74,
+        -25, -64, 39, -25, 103, -81, -47, -85, 47, -11, -92, 119, 31, -118, -68, 68,
+        32, 49, 0, 7, -50, -29, -112, 18, 89, 83, 78, 15, 59, 120, 71, 44,
+        -114, -55, 62, -93, -62, -95, 100, -28, -109, -7, -36, 5, 97, -56, -77, 47,
+        -113, -110, -24, -106, 121, -69, 121, 40, 78, -51, -114, -55, 9, 82, -86, -59,
+        77, 77, 42, 119, 113, -89, -121, 110, 75, 22, 106, 70, -91, -111, -27, 86,
+        -94, -106, -14, -80, -7, 0, 70, 55, -92, -16, -56, 24, -36, -105, 2, 34,
+        91, 67, -27, 56, -44, -40, -5, 37, -62, 112, -109, 24, 32, -88, 102, 9,
+        -32, 122, -16, 58, 0, -78, -124, -125, 70, -118, 66, -69, -22, 41, -17, 125,
+        -59, 57, 89, -29, 18, 63, -117, -23, 38, 123, 59, 25, -42, 121, -35, -95,
+        -31, 1, 54, 49, 4, 44, 106, 68, 90, -27, 80, 88, 67, 90, -49, -110,
+        79, 20, -18, -126, 76, 64, -54, 27, 55, -41, 78, -114, 121, 9, 113, 115,
+        -5, -105, 114, 53, -4, -55, -106, -42, -44, 28, 72, 108, -108, -77, 68, 81,
+        76, 79, 13, -123, -80, -97, -93, 64, 28, 88, -78, 63, -75, -51, 59, -113,
+        3, 71, -99, 127, -13, 56, -88, 120, 57, -79, 24, 95, -119, -72, 47, 25,
+        60, -110, 42, -28, -80, 36, 14, -42, 39, -17, 46, -50, 125, 7, 47, 68,
+        56, -20, -30, -4, 53, -59, 71, 115, -40, -101, 23, 63, 61, -65, -16, 117,
+        96, 51, 21, -46, -52, 97, -113, -49, 47, 46, -50, -49, 76, -72, -30, -105,
+        79, -97, -55, 114, -87, 60, 76, -94, -14, 5, 75, -29, -118, 32, 21, -86,
+        75, 51, 59, 2, -100, -55, -93, 72, -98, -94, 112, -123, -42, -103, 100, -95,
+        101, -82, 9, -57, -64, 99, 71, -84, -98, 65, 15, 5, 127, 28, -72, 26,
+        -89, 30, -96, 24, -49, 80, -117, 107, 38, 90, -38, 127, 13, -83, -20, 41,
+        -94, 118, 61, 122, -38, 54, -23, 78, 83, 87, -76, -56, 41, 89, -22, 59,
+        -108, -12, 58, -60, 49, 2, 104, 52, -103, -25, -47, -46, -23, -96, -62, 98,
+        126, 62, 106, 40, -45, -91, 96, -116, -114, -108, 17, -101, 10, 16, -90, -23,
+        2, -12, -17, 119, -116, -44, 10, 4, -115, -76, 102, -8, 98, -103, 59, 98,
+        -123, 11, -128, 122, -93, -92, 105, 22, -61, -56, -118, -37, 98, -66, -103, 69,
+        -87, -55, -123, -78, 62, 22, -78, 23, -85, 65, 92, 21, -85, -121, 114, 40,
+        -6, 62, -21, -96, 110, 77, -85, -23, 80, 40, -71, -102, -124, -69, 59, -46,
+        -100, 89, 80, -9, 91, -29, -48, 125, -83, 24, 93, 23, -124, 13, 72, 106,
+        34, -74, 90, -80, 54, -23, -38, -77, 86, 82, 73, -27, 82, -102, -98, -57,
+        -37, 78, 127, -66, 54, 78, -113, -60, -86, -81, 8, -45, -45, 112, -66, -12,
+        84, 68, -71, 48, 39, 27, 121, -76, -32, -55, 42, 15, -116, 19, -23, 115,
+        68, 71, 40, 98, 5, -33, 35, 67, 43, -65, 16, -45, 12, -42, 69, 107,
+        -108, -66, -68, 44, -96, -37, -97, 96, 102, -118, -86, -102, -73, 48, 31, -69,
+        12, -96, -118, 101, 93, -84, 48, 11, -71, 104, -6, 96, 34, -70, -67, -64,
+        -107, -39, 113, 118, -107, -58, 59, 53, -114, 48, 110, -41, 56, 20, 1, 40,
+        68, 120, 16, -21, 112, -63, 64, -78, -112, -105, 50, -102, 62, 62, -108, 71,
+        94, -14, 69, 83, -111, -54, 11, 19, -25, -81, -14, 65, 27, 73, 75, -85,
+        33, 46, 66, -86, 86, 26, 62, -79, -58, 56, -127, -105, -128, -18, -41, -58,
+        -7, -119, -126, -8, -72, 37, 59, 60, 93, 100, -65, 16, -40, -31, -106, 112,
+        -91, -20, -103, 90, 13, -100, -109, -57, 32, 95, -57, -84, -30, 14, -85, 111,
+        -37, -105, 43, 93, -107, 14, -70, -108, -91, 50, -127, -15, 71, 113, 56, -17,
+        10, 19, -116, 87, -15, 0, -85, 28, -113, 73, 59, -51, -73, 52, 108, 92,
+        76, 104, -42, 58, -6, 96, -11, 52, -63, -124, 80, 20, -98, 93, 65, 16,
+        108, 113, -1, -78, -74, -78, -36, -58, -81, 1, -106, 25, -17, -84, -32, 127,
+        108, -86, -109, -60, -99, 107, 113, 102, -48, 81, -111, -63, 29, 33, -3, -87,
+        -59, 66, -21, -79, -42, 38, -83, 56, 125, 18, 23, -86, 78, 73, 109, -74,
+        113, -6, 101, 81, -98, 30, -39, 99, 81, 120, 115, -123, 24, -126, -54, 80,
+        -32, -114, 91, 2, 67, -86, -23, 1, -30, -16, -12, 73, 91, 120, -69, 54,
+        -49, 90, 113, -59, -80, 126, -98, -74, -57, -53, -73, 120, 42, -48, -41, -74,
+        94, 109, 91, -72, -120, -106, -43, -85, -61, 91, 78, 85, -47, 42, 6, 47,
+        -8, 100, 4, -20, 40, -86, 96, 66, -124, 49, -76, 68, 15, 107, -61, 34,
+        -29, -122, -69, -111, -9, 7, 64, 101, -2, 64, 46, -48, 35, 43, 86, 66,
+        -27, -106, -61, -50, 109, -53, 3, -19, -15, 20, -32, -27, -104, 123, -93, -110,
+        -34, 54, 4, -52, -124, 62, -94, -118, -46, -5, 103, -12, 21, 81, 52, -1,
+        -35, -15, 49, -101, -114, 44, -65, 21, 71, 99, 68, 82, 10, -85, 83, -31,
+        80, -118, 44, 72, 82, 86, 99, 96, 64, 124, 61, -51, 102, 26, -3, 123,
+        77, 104, -52, 10, -111, -36, -33, -33, -5, -106, -31, 82, 22, 83, 111, 107,
+        -100, -45, 10, 58, -41, -113, 110, -1, 95, -84, 91, 123, 104, -55, 70, -34,
+        -14, -80, 73, 12, 16, -89, 51, 109, 31, 73, -90, -75, 47, 98, 52, 72,
+        21, -19, -25, -38, -126, -2, -99, -40, 45, -70, -98, -27, -99, 33, 27, 83,
+        100, -86, 74, -66, -17, 115, -20, 109, 83, -119, 111, -37, -96, -54, -97, -46,
+        -13, 118, -95, 89, 53, -90, -23, -114, 120, -91, 21, -22, -81, 93, 108, 74,
+        -121, -42, -124, 71, 36, -2, -120, 80, 20, 54, 82, -107, -20, 41, 48, 40,
+        5, 57, -108, -74, 108, -30, 97, -43, -87, -54, 104, 10, -76, -58, -88, -7,
+        44, 73, -75, -106, -83, 73, 18, -76, 88, 52, 52, 102, -114, 18, -51, 96,
+        -53, -110, 33, -98, 41, 41, -101, -91, 8, -99, -27, 89, 81, -7, -114, 121,
+        125, 95, -4, 28, 49, -36, 26, 85, -37, -34, 7, 96, -21, 15, -42, -75,
+        117, 66, 41, -82, -24, -94, -110, -4, -63, 48, 20, 58, 123, -98, 36, -21,
+        -4, 32, -96, -117, -48, -45, 121, 2, -37, -25, 33, -1, -81, -17, -23, 103,
+        10, 50, 74, -78, 64, -128, -34, -64, 102, -31, -6, -124, -43, 58, 13, 125,
+        124, -9, 2, -83, 4, 86, -12, 77, -49, 109, -20, -37, -45, -31, -35, -19,
+        -93, -111, -84, -54, -117, 88, -28, 53, 96, 76, -35, -126, -7, 51, -50, -68,
+        -80, 109, -128, 10, -105, 44, -79, 58, 103, 53, 42, -26, 110, -39, 32, 66,
+        -88, -111, -40, 83, 91, -99, -78, 77, -82, 34, -41, -9, 27, -33, -10, -86,
+        -74, 110, -65, 69, 41, 0, -63, -24, 93, -28, 86, -51, -38, -6, 48, 37,
+        -73, 79, 81, -66, -62, 24, 108, 105, -77, -58, -51, -92, -46, 121, -47, -122,
+        -47, 114, -66, 107, -89, 87, -42, -34, -3, -22, 118, 43, 10, -21, 71, 25,
+        74, -9, 26, 37, -119, -98, 53, 9, -21, 126, -14, -86, -19, -58, 113, 30,
+        63, -111, 97, -68, -92, 91, 84, 117, -47, 108, -108, 108, 60, -43, -83, -60,
+        1, 51, 49, 81, 84, -61, 42, -94, -28, 86, 39, 125, 101, -30, 83, -10,
+        9, 57, 51, -128, -96, 36, 112, -16, -44, -28, -73, -2, 115, -44, 26, 72,
+        117, 103, -35, 63, -79, 110, 73, 0, -78, 72, 78, 53, 98, -93, -50, 112,
+        51, 16, -66, 28, 101, -10, 48, 68, 95, -18, 36, 30, 84, -30, -9, -22,
+        28, 77, -97, -85, -105, 88, 44, 56, -107, -30, 110, 70, -34, -1, -10, 72,
+        -95, 95, 97, 95, -75, -64, 83, -113, 48, 106, -63, -38, 14, 49, -38, 16,
+        79, 20, -13, 121, 88, -79, 64, 27, -52, 70, -27, -117, 96, -75, -17, -33,
+        20, 88, -108, -3, -37, -94, -103, 10, 11, -97, -87, -89, -46, 60, 127, -24,
+        -75, -77, 28, -84, -14, -95, 52, -120, -73, 86, -40, -43, -90, 20, -50, 38,
+        99, 11, 37, 114, -50, -75, 24, 84, -107, 21, -77, 58, -111, -112, 89, -43,
+        -105, -90, 125, -103, -11, -39, -54, 109, 108, -123, 90, 69, -102, -53, 119, -122,
+        53, -27, 50, -84, 105, -55, -43, -85, 124, -81, 66, -121, -33, 17, -30, -98,
+        57, 92, -85, -98, 37, -28, -104, -55, -55, -124, 107, -28, 94, -125, -53, -40,
+        54, 41, 75, -44, 108, -79, 5, 73, 15, -8, -118, -61, 115, 19, 101, -76,
+        67, -25, -119, 24, 3, 56, -84, 69, 24, -81, -62, 57, -6, -59, 112, 51,
+        65, -52, -3, 22, 75, 95, -28, -106, 65, -111, -28, 44, 3, 31, -5, -37,
+        10, -54, 64, 67, 14, 93, 24, -71, 103, -69, -92, -50, -36, -89, -35, 100,
+        -107, 3, -68, -101, -32, -71, 13, 90, 101, -55, 108, 59, -44, 64, 14, 43,
+        -53, -11, 3, 61, 35, 29, 122, -77, -97, -59, 126, 28, 15, -47, -94, -56,
+        -75, 33, -87, -27, -38, 96, -12, -33, 61, 48, 4, 73, 109, 100, -36, 50,
+        82, -103, 96, 70, 37, -105, 98, 10, 23, 42, -11, 72, 116, -79, 107, -74,
+        94, 5, 117, -41, -37, -46, 77, -62, -94, 97, -50, -9, -76, -117, 21, -106,
+        61, -77, -27, 10, -45, 85, -125, -43, 11, -44, 54, 45, -28, 53, -105, 35,
+        101, 103, 30, -114, -8, -36, -87, 9, 29, -42, -39, -106, 12, -80, 93, 45,
+        -111, -75, -75, -59, -14, -19, 62, -21, 45, 18, 76, -67, 90, 77, 59, 83,
+        -90, -71, 66, -31, -46, -70, 34, -43, -102, -72, 10, 82, 13, -20, -41, 20,
+        -1, 35, -33, -83, -65, 51, 54, 102, 101, -43, 44, -85, -100, 101, -85, -126,
+        114, -43, 43, 99, 44, 29, -120, -48, 55, 28, -96, 68, -104, -81, 83, 90,
+        -83, -48, 23, 59, 70, 34, 39, -86, 92, -17, -102, 70, -126, -33, 60, -31,
+        29, -96, 77, -75, 20, 115, 102, -117, -15, -74, 108, -9, -81, -44, 44, -102,
+        -89, -79, -51, -73, -90, -76, 15, -83, 3, 107, 12, 110, 86, -50, -37, -96,
+        118, 120, 61, 8, 77, -51, 116, 88, 57, 60, 47, 31, -118, 123, 63, -87,
+        68, -67, -5, -5, 40, -61, -26, -68, -125, 46, -78, 90, 41, 11, 52, -101,
+        -85, 103, 11, -128, -27, -19, -25, -108, 58, 85, -19, -81, 5, 6, 63, 20,
+        -125, -124, 110, -56, -35, -93, -60, -28, 74, 17, 18, 21, -12, 26, 124, 68,
+        118, 68, 84, -44, -42, -58, 64, -40, -78, -52, -117, 126, -55, 82, -29, -89,
+        -82, -11, -51, 99, -114, 56, 124, -77, 19, -23, -46, -38, 83, -8, 92, 122,
+        10, -42, -120, -112, -66, -4, 37, -110, -89, -55, 31, 69, 99, 125, -38, 98,
+        84, -97, -98, 2, -7, -41, 82, 89, 27, -85, 73, -3, -116, 42, -114, -11,
+        1, -7, 88, 17, 16, -85, -78, 8, 75, 95, 85, 35, 76, 96, -6, -30,
+        -85, 60, -119, -92, 7, -111, -51, 10, -27, 57, 14, 72, 42, 123, 34, 79,
+        47, 62, 6, -111, -107, 32, 64, -15, 22, -38, 110, 74, 78, 9, 20, -57,
+        -57, 17, 86, -108, -30, -118, 109, -58, -35, -102, 92, -59, 58, -7, 50, -106,
+        16, 85, 9, -107, -106, 114, -20, 80, 117, -52, -11, -105, -99, -44, -25, -15,
+        -1, 108, -64, -11, 98, -31, -50, 99, 101, 80, 25, -57, -76, -47, 96, 76,
+        114, 57, -116, 59, -92, -99, -29, -20, -1, 43, -99, -38, -53, -45, -2, -26,
+        -45, 119, 0, 43, -39, 35, -73, -99, -66, -53, 50, -107, -45, -9, -39, -113,
+        -43, -17, 51, 30, 78, -60, -23, -5, -20, -57, -58, 6, 40, -22, 69, -11,
+        112, 94, -99, -28, 10, -79, -77, 96, -77, -22, 28, 17, 96, 102, -98, -30,
+        104, -71, -11, 100, 88, 29, 4, 79, -52, 65, -16, 60, 94, 111, 59, -82,
+        28, -17, 62, -82, -100, 109, 57, -82, 84, 0, 108, 53, 34, 86, -83, 25,
+        117, 59, -97, -21, -35, -61, 70, 82, 1, 114, -51, 72, -62, 76, 17, 2,
+        -77, -33, -48, 75, 113, -39, -28, -67, -7, 53, -10, 30, -27, -128, -9, 23,
+        55, -43, -28, 127, 126, 83, 77, -12, -90, 90, -59, 86, 50, 71, 113, -63,
+        42, 91, -34, -95, 98, 24, 56, -126, -45, 58, 108, 9, -49, 3, 116, -16,
+        30, 58, 108, 1, 8, 42, -9, -102, 72, 30, -104, 36, -7, 25, 69, -103,
+        -12, -99, -93, -27, 109, 7, -1, -17, -2, -16, -9, -1, 116, 88, -74, -128,
+        79, -77, -73, -22, -98, -85, 74, 80, 33, 13, -14, 0, -15, 89, 50, -97,
+        -8, -125, -34, 67, -42, -5, 59, 123, 56, 44, -40, -107, 105, 90, -69, -128,
+        72, 87, 98, -69, 23, -27, 39, 81, 106, -33, 10, 109, 43, -70, -47, 81,
+        109, -83, -66, -92, -49, -120, -38, 37, -105, -15, 87, 93, -106, 21, 13, -65,
+        -116, -30, 79, 25, -103, 20, -49, 66, 101, 125, 79, 70, 25, 79, -81, 81,
+        -51, 126, 43, -62, 126, 86, 11, -40, -47, -115, 29, 121, 18, -69, 37, 73,
+        -115, -110, 74, 76, -72, -126, 62, -62, -63, 111, -118, -17, 36, -91, 33, 17,
+        66, -43, 58, -20, 16, 99, -86, -28, 52, 76, -7, 117, 4, 42, -97, -128,
+        25, 10, 68, -63, 90, -114, -26, 41, 58, 127, 94, 36, 75, -1, -120, -119,
+        -69, 98, 111, 85, 36, 30, -1, 72, -70, 95, -64, -6, 35, 32, 119, -8,
+        63, 44, 118, 19, -108, -85, 45, 4, -59, 96, 96, -95, -5, -85, 41, -36,
+        98, -74, -39, 73, 60, 57, -41, -112, 55, -2, 27, -28, -19, 41, -50, -83,
+        -33, 90, 40, -94, -65, 43, -56, -12, -53, 63, -15, 52, 29, -112, 32, -122,
+        21, -44, 110, 10, 26, -120, -102, -100, -68, -30, 55, -25, -14, -91, 91, -109,
+        26, -37, -80, 65, -55, -81, -54, 53, 89, 119, 41, 31, -102, -30, -121, 55,
+        14, -85, 126, -19, 112, -85, 8, 40, 3, -21, -90, 38, -108, 110, 37, -8,
+        20, 19, -127, -74, -59, -50, -62, -116, -25, -76, -5, -6, 31, -128, 104, -56,
+        -25, 66, 109, -23, 31, -113, -2, -13, -125, 111, 23, 103, 117, 34, -43, -45,
+        91, 77, 8, 123, -22, 87, 96, 61, -17, 50, 55, -118, 80, -105, 20, -48,
+        13, -123, -90, -42, -59, -84, -36, 45, -74, -66, 85, -30, -83, 43, -53, -111,
+        -80, 57, -81, -30, -110, -95, -96, -6, 17, 72, 93, -109, 113, -96, 97, 73,
+        -55, 46, -96, -14, 115, -128, 114, 48, 35, -62, -51, -101, 114, 44, 84, 28,
+        12, 44, 98, -80, -39, -56, 43, 89, 113, -64, 37, -64, 97, -57, 117, 43,
+        -66, 0, -22, 61, -7, 28, -21, 16, 89, -91, 40, -4, -26, -75, -69, -58,
+        20, -63, 49, 27, -15, 89, 8, -101, 29, -99, -60, 8, 54, 78, -127, -55,
+        122, 76, 124, -83, 24, 89, -127, 96, -67, 37, -100, 54, 66, 51, -114, -45,
+        -81, 13, -39, 34, -89, 101, 16, -86, -41, 54, -83, -82, -123, 93, 23, -17,
+        11, -5, -58, 43, -15, -49, 76, -128, 85, 15, -61, -36, -107, 80, -5, -64,
+        -124, -16, 68, -60, -128, -127, 55, 124, 48, -85, -90, 106, 91, 52, -101, 86,
+        -20, -61, -33, 16, -75, -27, -86, 69, -109, -30, 3, 26, -54, -116, 77, -81,
+        78, 32, 123, 21, -6, -88, -93, 68, -103, 101, -47, -60, 53, 25, -13, 12,
+        -44, 69, 28, 97, 1, 43, -22, 54, 44, 119, -21, -71, -70, 89, 25, 76,
+        -53, -13, 40, 104, 29, 79, -123, 58, 31, -33, -73, 96, 16, 91, -44, 42,
+        -23, 104, -103, 98, 47, -23, 69, -103, 89, -125, -8, 74, -57, -26, 107, 97,
+        44, -92, -22, 11, 117, -99, -114, -66, 92, 76, 117, 83, -13, 15, -49, -125,
+        -92, 6, -88, 45, -77, -86, 64, 25, 49, 61, -93, -96, 52, -120, -14, -48,
+        62, -37, 83, -111, 120, 11, 50, -90, 102, 32, 71, 110, 54, 17, 37, -39,
+        -39, -51, 24, -42, -33, -50, -64, -75, -57, -109, -68, 9, -71, -116, 89, 3,
+        -27, 104, -80, 66, 19, 108, 57, 81, -122, -51, 102, -114, 70, -124, 74, -66,
+        -95, -36, -70, 72, 49, -31, 120, -73, -16, -35, -101, 23, -82, -88, 81, 49,
+        90, 121, -57, 33, -39, 30, -36, 58, 82, -29, 17, 68, -67, 54, -9, 90,
+        39, 70, 53, 68, 57, -122, -120, 90, 104, -60, -51, -101, 86, 30, 47, -124,
+        -101, -37, -46, -43, -91, 111, 2, 69, -109, 92, 2, 84, -93, 114, -64, 60,
+        -115, 75, 5, -15, 96, 77, -72, 119, -117, 84, 12, 45, -15, 19, 84, -39,
+        -118, -84, 90, 15, -41, -128, -41, -57, 107, -19, -82, 119, 103, 23, -60, 11,
+        -113, -114, -25, -39, -95, 105, -12, 55, -103, 27, -101, -39, 57, -5, 116, -42,
+        80, -49, -85, 79, -80, 26, 91, -104, -117, 27, -75, 75, 53, 32, 70, 57,
+        -1, 88, -89, 55, -121, 74, 93, -68, -126, -71, -84, 101, 14, -18, -56, -108,
+        75, 92, 20, -18, -30, 93, 75, -88, -127, -113, 56, -42, -50, -93, -114, -3,
+        -38, 52, -92, 102, -46, 0, -9, -94, 97, 29, -111, 109, -43, 60, 32, -90,
+        -79, 87, 77, 82, 38, -43, -128, -98, -46, 12, -22, -106, 51, -18, 53, -73,
+        -12, 87, -107, -90, -53, -8, 127, -9, 117, 121, -5, -86, 124, -11, 82, -73,
+        70, -43, 123, 94, -22, 54, 119, -24, -95, 78, 32, 101, 98, 103, -8, -99,
+        -25, -75, 65, 65, 102, 104, -70, -44, 43, 54, 2, -107, -19, 4, 45, 22,
+        20, -78, -117, 93, -85, -97, 34, -96, 23, -69, 83, -65, -33, 97, 50, 1,
+        -11, -29, 9, -27, -65, 61, -79, 52, -65, -89, -79, -70, 72, 114, 17, -85,
+        -117, 36, -89, 113, 80, -65, -28, -97, -121, 35, 103, -56, 58, -75, -9, -53,
+        8, 71, -34, -16, 1, 81, 21, 3, 2, -100, -57, -63, 7, -115, -62, 50,
+        23, 97, 121, -57, 121, 117, -60, 110, 43, 55, -112, 118, 28, 28, 76, 91,
+        -103, 7, -21, -45, -72, -8, 32, 85, -64, -37, 86, 21, 80, 43, -128, -34,
+        -74, -124, -16, -118, 18, 124, 103, -115, 80, 108, 79, 123, 48, 114, -82, -27,
+        -106, 52, 85, -51, 48, -114, 64, 57, -112, -69, -94, -84, -94, -92, 113, 0,
+        -48, -23, 46, 90, -94, 100, -86, 80, 24, 35, 12, -117, 48, -78, 115, -125,
+        124, -78, -78, -126, 120, 91, -36, -49, -95, -106, -14, 62, 110, 60, 21, 42,
+        -69, -86, -66, -112, 121, 66, -36, 106, -110, 14, -53, 17, 75, -108, 64, 57,
+        71, -124, -79, -21, 27, -22, -50, 77, 68, 28, 26, 110, -99, -114, -109, -75,
+        -32, -40, -30, 7, 38, -44, 82, 83, 13, -34, 24, 100, 9, -93, 54, -76,
+        -121, -39, -79, -62, -70, 112, -106, 87, -71, 18, 25, 0, 44, 110, 34, -125,
+        -32, 11, -101, 116, -119, -78, -98, -44, 56, -102, -37, 30, -41, -62, -37, 22,
+        107, -121, 86, -127, 76, -10, 87, -11, -72, 76, 94, -33, 109, 58, -60, 10,
+        71, 64, 56, -8, 45, 37, 30, 109, 56, 68, 19, -42, -23, 114, 58, 120,
+        -79, 35, 48, 82, -51, 19, -62, 12, -6, 84, 3, 117, -68, 5, -42, 24,
+        -121, -65, 12, -124, -117, -104, 14, -114, 88, 35, -101, 125, 26, -109, -58, 97,
+        1, -68, 17, -104, -110, 103, 16, 60, -53, -15, -115, -84, -102, -1, 109, -96,
+        -35, 14, -68, -121, 117, -8, 106, -48, 51, -89, -5, -48, 105, 7, -18, -61,
+        10, 112, 77, -60, -72, 123, 65, 87, 66, -27, 62, 0, 54, 123, -99, -124,
+        -48, -63, 40, 6, -6, 15, 36, 31, 8, 125, 45, 73, -92, 73, 5, 89,
+        -49, -116, -40, -86, -55, -14, 96, 112, -35, -40, 26, -20, -17, -111, -37, 64,
+        -83, -20, 88, 11, 123, 115, -103, -102, 72, 105, -35, 28, 17, 15, 67, -85,
+        -128, 114, 43, 34, -80, -84, 101, -65, -54, 118, 120, 4, 83, -66, 109, -26,
+        124, -111, 87, -14, 43, 52, 93, 42, -87, 66, -78, -44, -13, -72, 68, 124,
+        69, 105, -101, 52, -43, 12, -42, -91, -47, 67, 11, -122, -106, 86, 41, 31,
+        -120, 16, 20, -11, -88, -123, -110, -101, -84, 25, 54, -30, -68, -104, -66, 2,
+        -67, -16, 22, -42, -113, 36, 65, 25, 115, 77, 49, -117, 38, -79, -86, -107,
+        89, -100, -57, 52, 86, -108, 2, 118, 124, 95, 91, -55, -47, 94, -96, -69,
+        -95, -15, -96, -83, 16, -18, -54, 28, -103, 117, 59, -30, 28, -38, -76, 43,
+        -18, -40, 51, -104, -75, 84, 104, 17, -37, -127, 16, 105, 32, 44, 49, -84,
+        87, -100, -121, 34, 21, 55, -29, 36, -76, -35, 99, -49, -35, 11, -68, 118,
+        -23, 6, 72, -119, -19, -9, 58, -116, -7, 124, 11, 60, -53, -91, -18, 17,
+        -57, 72, -60, 55, -33, 62, 76, 110, 15, 115, -119, 109, 19, 53, -113, 38,
+        -69, 32, 7, 21, -115, -89, -60, 92, -36, 67, 33, 19, 30, 25, 56, 48,
+        102, 113, -107, 24, -39, 89, 98, -38, -106, -107, 2, -61, 110, -43, -106, -100,
+        10, -45, 71, -109, 7, -117, 77, -16, -106, -52, -46, 112, 115, 22, 121, -57,
+        -96, -46, 103, 86, -117, -46, 69, 42, 70, 55, -128, -29, -72, 73, -43, 66,
+        30, 16, 87, -13, 87, -93, 44, -118, -41, 79, 26, -80, -114, -33, 2, -36,
+        38, 2, -21, -118, 45, -8, 64, -9, -6, -55, 108, 103, -35, 51, -9, 106,
+        120, 38, -78, -31, 84, -74, -62, 122, 91, 78, -8, -109, 88, 80, -106, -54,
+        -26, 50, 117, 84, 74, -35, -13, -40, -21, -25, -66, -127, 15, -46, 39, -23,
+        -49, 89, 94, 7, -69, 59, 43, 83, 60, -119, -63, 77, 26, 31, 76, -30,
+        -81, -86, 90, -73, -19, -86, -42, -1, 50, 69, -85, 33, 38, 25, 49, -45,
+        -45, -72, 28, 104, -20, 47, -122, 15, -37, 108, -74, -127, -92, 45, -54, -106,
+        -46, -2, -124, 36, -66, 77, -35, -109, -22, 116, -101, 82, -43, -10, 89, -23,
+        86, 109, -33, -107, -38, -31, -35, 110, -41, 26, 111, -75, -42, -8, 73, -58,
+        5, 112, -40, 75, -83, -18, -67, -115, -83, 88, -71, 79, -16, -78, 120, -61,
+        -51, 112, -68, -8, 64, 126, 32, -26, -107, -68, -53, 45, -35, 58, 10, -10,
+        -94, 84, 117, -17, -56, -44, -127, 103, 81, -8, -17, -4, 71, -99, -117, -24,
+        43, -49, -26, -92, 119, -111, 101, -89, -124, -51, 125, -122, -18, -115, -124, -1,
+        -95, -56, -58, -89, 93, -95, -32, -29, 47, 50, -26, 95, -29, -9, -78, 47,
+        -22, -42, 3, -81, 23, -69, 15, -68, -98, 108, -67, -16, 27, -62, 42, 41,
+        -99, 107, 103, -128, 89, 81, 124, 75, -44, -48, -110, 39, 86, -59, -121, 75,
+        -125, -65, 122, -63, -11, 30, 105, 93, 27, -126, -13, -57, 95, -101, -94, 35,
+        6, 100, -6, 43, -31, -34, -29, -5, -124, 113, -107, 16, -78, 15, 3, -33,
+        2, -55, -99, -84, -26, 34, 47, 123, 61, 34, 104, 51, -116, 42, -31, 93,
+        -19, 75, 46, 59, -29, -69, -18, 92, -91, -106, 96, -8, -33, 4, 29, 74,
+        -94, 20, -17, 92, -82, -73, 49, 108, -22, 45, 0, -76, -12, 17, 49, -6,
+        123, -61, -87, 126, 120, -39, -124, -124, 22, 0, 119, -91, 61, -118, -21, 7,
+        -99, -51, 23, 55, -74, -27, 41, 120, 25, -21, -56, 63, -91, -27, 95, -41,
+        -14, -68, -30, -86, 105, -23, -84, -127, 108, 40, -97, -107, 102, -94, -95, -41,
+        -76, -63, -61, -47, 90, -72, 45, 94, -107, -92, -76, 37, -79, -43, -90, -92,
+        114, 55, 17, 8, 11, -82, 112, 46, 6, -10, 28, 102, -36, -70, 67, -23,
+        91, -65, 87, -71, -14, 120, 105, -94, 122, -4, 120, 4, -124, -1, -45, 49,
+        85, 80, -2, -44, -66, -7, 85, -82, -34, 68, 23, 121, 65, 103, -101, -10,
+        -119, 99, -45, 66, -101, -125, -50, -78, -73, -13, 113, 53, -95, 74, 84, -53,
+        51, -95, 86, 45, -46, 30, 66, 77, 59, -73, 122, 71, -96, 53, 83, 12,
+        66, -56, -96, -78, 101, 7, -85, -126, -103, -94, 1, -73, 103, -100, -127, 105,
+        -35, -81, -103, -121, 109, -51, 88, -87, 127, -1, -62, 96, -44, 58, -35, 127,
+        48, 69, 101, 109, -66, -62, 69, -41, -50, -57, -4, -83, 50, -28, -85, -1,
+        49, 31, 39, 43, 110, -83, 28, -23, 27, -9, 85, 76, -103, 0, -32, -33,
+        -11, -55, -100, -89, -71, -1, -103, 61, 94, -27, 57, -56, 33, -65, -80, -45,
+        48, -91, 91, 16, 126, -102, -77, -45, 100, 62, 15, -105, 25, -9, -89, 57,
+        123, 34, 117, 14, 127, 28, 49, 114, -99, -9, 95, 69, -20, 92, -123, 57,
+        -11, -65, 68, -20, -75, -16, 56, -13, 39, -64, -41, -56, 82, -15, 118, 121,
+        -25, 95, -58, -20, 34, 28, -7, -73, -16, 7, -41, -55, 127, -123, 15, -28,
+        86, -24, -49, -23, -52, -3, -8, 63, 14, 15, -1, -42, -127, -59, 76, -57,
+        -4, 44, -92, -56, 70, -17, -34, -68, 12, 70, 42, -14, 74, 111, -76, 66,
+        23, -3, -34, 2, -112, -26, 99, -122, 62, 18, -1, 23, -51, -96, -88, 0,
+        37, 58, 1, 0
+    };
+    const size_t bootstrap_min_js_gz_size = sizeof(bootstrap_min_js_gz);
+}
+
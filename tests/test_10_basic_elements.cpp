@@ -262,3 +262,170 @@ TEST_CASE("10140: Variadic constructors", "[elements][basic][variadic]") {
         CHECK(html.find("id=\"main\"") != std::string::npos);
     }
 }
+
+TEST_CASE("10150: Rvalue children are moved, not copied", "[elements][basic][move]") {
+    SECTION("add(element&&) takes over the subtree") {
+        html::div inner;
+        inner.id("inner").cl("box");
+        inner << p("Moved text");
+        html::div outer;
+        element& added = outer.add(std::move(inner));
+        CHECK(inner.empty());
+        CHECK(added.id() == "inner");
+        CHECK(added.parent() == &outer);
+        CHECK(outer.html_string().find("<div id=\"inner\" class=\"box\">") != std::string::npos);
+        CHECK(outer.html_string().find("<p>Moved text</p>") != std::string::npos);
+    }
+    SECTION("dynamic type survives the move") {
+        html::div outer;
+        outer << br();
+        CHECK(outer.html_string().find("<br>") != std::string::npos);
+    }
+    SECTION("stream operator moves temporaries") {
+        html::div outer;
+        outer << ul(li("One"), li("Two"));
+        CHECK(outer.at(0).size() == 2);
+        CHECK(outer.html_string().find("<li>Two</li>") != std::string::npos);
+    }
+    SECTION("rvalue constructors") {
+        CHECK(h1(span("Title")).html_string().find("<h1><span>Title</span></h1>") != std::string::npos);
+        CHECK(nav(anchor("#", "Home")).html_string().find("<a href=\"#\">Home</a>") != std::string::npos);
+    }
+}
+
+TEST_CASE("10160: Id index follows add, id, content and clear", "[elements][basic][find]") {
+    page pg;
+    pg.index_tree();
+    CHECK(pg.indexed());
+
+    html::div grid;
+    grid.id("grid");
+    for (int i = 0; i < 200; i++) {
+        grid << html::div(span("0").id("kpi-" + std::to_string(i))).cl("col");
+    }
+    pg << std::move(grid);
+    CHECK(pg.get("grid").indexed());
+    CHECK(pg["kpi-150"].html_string() == "<span id=\"kpi-150\">0</span>");
+    pg["kpi-150"].content("42");
+    CHECK(pg["kpi-150"].html_string() == "<span id=\"kpi-150\">42</span>");
+
+    // Lookups from a node only see its own subtree
+    element& first = pg.get("grid").at(0);
+    CHECK(first.exists("kpi-0"));
+    CHECK_FALSE(first.exists("kpi-1"));
+    CHECK(first.find_child("kpi-0") != nullptr);
+    CHECK(pg.find_child("kpi-0") == nullptr);
+
+    // Renaming, attribute changes and removal
+    pg["kpi-7"].id("revenue");
+    CHECK_FALSE(pg.exists("kpi-7"));
+    CHECK(pg["revenue"].id() == "revenue");
+    pg["kpi-8"].add_attr("id", "margin");
+    CHECK(pg.exists("margin"));
+    pg["margin"].remove_attr("id");
+    CHECK_FALSE(pg.exists("margin"));
+    pg.get("grid").at(3).clear();
+    CHECK_FALSE(pg.exists("kpi-3"));
+    pg.get("grid").at(4).content(span("new").id("kpi-4b"));
+    CHECK_FALSE(pg.exists("kpi-4"));
+    CHECK(pg.exists("kpi-4b"));
+    CHECK_THROWS_AS(pg.get("kpi-3"), std::runtime_error);
+
+    // Moving a subtree out takes its ids with it
+    html::div taken(std::move(pg.get("grid").at(5)));
+    CHECK_FALSE(pg.exists("kpi-5"));
+    CHECK(taken.exists("kpi-5"));
+    CHECK_FALSE(taken.indexed());
+    CHECK_FALSE(taken.at(0).indexed());
+
+    // Same answers without the index
+    pg.index_tree(false);
+    CHECK_FALSE(pg.get("grid").indexed());
+    CHECK(pg["kpi-150"].html_string() == "<span id=\"kpi-150\">42</span>");
+    CHECK(pg.exists("revenue"));
+    CHECK_FALSE(pg.exists("kpi-3"));
+}
+
+TEST_CASE("10170: Id index reports duplicates and keeps document order", "[elements][basic][find]") {
+    html::div root;
+    root.index_tree();
+    root << html::div(p("a").id("x")).id("first");
+    root << p("b").id("x");
+    root << p("c").id("y");
+    CHECK(root.duplicate_ids() == std::vector<std::string>{ "x" });
+    // Duplicated ids resolve to the first in document order, as without the index
+    CHECK(root["x"].html_string() == "<p id=\"x\">a</p>");
+    CHECK(root.get("first").exists("x"));
+
+    root.get("first").clear();
+    CHECK(root.duplicate_ids().empty());
+    CHECK(root["x"].html_string() == "<p id=\"x\">b</p>");
+    root["x"].id("z");
+    CHECK_FALSE(root.exists("x"));
+
+    // Without an index the subtree is counted
+    html::div plain;
+    plain << p("1").id("d") << p("2").id("d") << p("3").id("e");
+    CHECK(plain.duplicate_ids() == std::vector<std::string>{ "d" });
+}
+
+TEST_CASE("10180: Text is stored in the child slot, not as a node", "[elements][basic][text]") {
+    CHECK(sizeof(detail::child) == 16);
+
+    html::div d;
+    d << "short" << "a longer run of text & more" << span("s");
+    d.add("tail");
+    raw_html r("<b>raw</b>");
+    d << r;
+    REQUIRE(d.size() == 5);
+    CHECK(d.m_elements[0].is_run());
+    CHECK(d.m_elements[1].text() == "a longer run of text & more");
+    CHECK_FALSE(d.m_elements[2].is_run());
+    // Explicit text nodes stay nodes
+    CHECK_FALSE(d.m_elements[4].is_run());
+    // Same markup as with text nodes
+    html::div nodes;
+    nodes << text("short") << text("a longer run of text & more") << (span() << text("s")) << text("tail") << r;
+    const std::string expected = nodes.html_string();
+    CHECK(d.html_string() == expected);
+    CHECK(d.html_content_string() == "shorta longer run of text &amp; more<span>s</span>tail<b>raw</b>");
+
+    SECTION("add(string) returns the element for chaining") {
+        html::div c;
+        c.add("a").add("b");
+        CHECK(c.html_content_string() == "ab");
+        CHECK_THROWS_AS(br().add("x"), std::runtime_error);
+    }
+    SECTION("copies, moves and find leave runs as they are") {
+        html::div copy(d);
+        CHECK(copy.m_elements[1].is_run());
+        CHECK(copy.html_string() == expected);
+        html::div moved(std::move(copy));
+        CHECK(moved.html_string() == expected);
+        CHECK(moved.find("nope") == nullptr);
+        CHECK(moved.m_elements[0].is_run());
+    }
+    SECTION("a run used as an element becomes a text node in place") {
+        element& t = d[1];
+        CHECK(dynamic_cast<html::text*>(&t) != nullptr);
+        CHECK(t.parent() == &d);
+        CHECK_FALSE(d.m_elements[1].is_run());
+        CHECK(d.m_elements[0].is_run());
+        CHECK(d.html_string() == expected);
+    }
+    SECTION("traverse sees runs as text nodes") {
+        struct counter : visitor {
+            int texts = 0;
+            action text(element& _e) override { texts++; CHECK(_e.parent() != nullptr); return descend; }
+        } v;
+        d.traverse(v);
+        CHECK(v.texts == 5);
+        CHECK(d.html_string() == expected);
+    }
+    SECTION("style text keeps its newline") {
+        style s("p{}");
+        s.add("a{}");
+        CHECK(s.m_elements[1].is_newline());
+        CHECK(s.html_string() == "<style>p{}a{}\n</style>\n");
+    }
+}
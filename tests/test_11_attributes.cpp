@@ -35,6 +35,40 @@ TEST_CASE("11050: HTML escape utility", "[utility][escape]") {
     }
 }
 
+TEST_CASE("11055: HTML escape - vectorized scan agrees with scalar", "[utility][escape]") {
+    // Place each special char at every offset across several 16/32 byte blocks
+    const std::string specials = "&<>\"'";
+    for(char sc : specials) {
+        for(size_t len : {1u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 100u}) {
+            for(size_t pos = 0; pos < len; pos++) {
+                std::string in(len, 'x');
+                in[pos] = sc;
+                std::string expected;
+                html::detail::html_escape_scalar(in, expected);
+                REQUIRE(html_escape(in) == expected);
+            }
+        }
+    }
+
+    SECTION("clean input is copied unchanged") {
+        std::string in(1000, 'a');
+        CHECK(html_escape(in) == in);
+    }
+    SECTION("append overload keeps existing content") {
+        std::string out = "<p>";
+        html_escape("a<b", out);
+        out += "</p>";
+        CHECK(out == "<p>a&lt;b</p>");
+    }
+    SECTION("non-ASCII bytes pass through") {
+        CHECK(html_escape("caf\xc3\xa9 & cr\xc3\xa8me") == "caf\xc3\xa9 &amp; cr\xc3\xa8me");
+    }
+    SECTION("dispatch is reported") {
+        std::string impl = html::detail::html_escape_impl();
+        CHECK((impl == "avx2" || impl == "sse2" || impl == "scalar"));
+    }
+}
+
 TEST_CASE("11060: Data attributes", "[attributes][data]") {
     html::div d;
     d.data("id", "123").data("name", "test");
@@ -132,3 +166,240 @@ TEST_CASE("11080: Global attributes", "[attributes][global]") {
         CHECK(result.find("spellcheck=\"false\"") != std::string::npos);
     }
 }
+
+TEST_CASE("11090: Attribute storage", "[attributes][storage]") {
+    SECTION("output order does not depend on set order") {
+        html::div d;
+        d.href("#").style("color: red").cl("box").id("main");
+        CHECK(d.html_string() == "<div id=\"main\" class=\"box\" style=\"color: red\" href=\"#\">\n</div>\n");
+    }
+    SECTION("only set attributes are stored") {
+        html::div d;
+        CHECK(d.m_attributes.empty());
+        d.id("a").id("b");
+        const element& e = d;
+        CHECK(e.m_attributes.size() == 1);
+        CHECK(e.id() == "b");
+        CHECK(e.cl().empty());
+    }
+    SECTION("copies keep every attribute") {
+        html::span s("x");
+        s.id("s1").role("note").data("k", "v");
+        html::div d;
+        d << s;
+        CHECK(d.at(0).id() == "s1");
+        CHECK(d.at(0).role() == "note");
+        CHECK(d.html_string().find("<span id=\"s1\" role=\"note\" data-k=\"v\">x</span>") != std::string::npos);
+    }
+    SECTION("clear_all drops attributes") {
+        html::div d;
+        d.id("x").cl("y");
+        d.clear_all();
+        CHECK(d.m_attributes.empty());
+        CHECK(d.html_string() == "<div>\n</div>\n");
+    }
+}
+
+TEST_CASE("11100: Generic attributes are key/value entries", "[attributes][storage]") {
+    SECTION("setting twice replaces the value") {
+        html::div d;
+        d.data("state", "open").data("state", "closed");
+        std::string result = d.html_string();
+        CHECK(result == "<div data-state=\"closed\">\n</div>\n");
+    }
+    SECTION("lookup and removal") {
+        html::div d;
+        d.aria_label("Menu").title("Tip").tabindex(2);
+        CHECK(d.attr("aria-label") == "Menu");
+        CHECK(d.has_attr("tabindex"));
+        d.remove_attr("title");
+        CHECK_FALSE(d.has_attr("title"));
+        CHECK(d.attr("title").empty());
+        CHECK(d.html_string() == "<div aria-label=\"Menu\" tabindex=\"2\">\n</div>\n");
+    }
+    SECTION("generic attributes keep insertion order after dedicated ones") {
+        html::div d;
+        d.data("b", "2").data("a", "1").id("x");
+        CHECK(d.html_string() == "<div id=\"x\" data-b=\"2\" data-a=\"1\">\n</div>\n");
+        CHECK(static_cast<const element&>(d).attr() == " data-b=\"2\" data-a=\"1\"");
+    }
+    SECTION("dedicated names map to their accessors") {
+        html::div d;
+        d << html::attr("class", "row") << html::attr("class", "col");
+        d.add_attr("id", "main");
+        const element& e = d;
+        CHECK(e.cl() == "col");
+        CHECK(e.id() == "main");
+        CHECK(d.html_string() == "<div id=\"main\" class=\"col\">\n</div>\n");
+    }
+}
+
+TEST_CASE("11110: Text and attribute values are escaped on write", "[attributes][escape]") {
+    SECTION("text content") {
+        html::p para("a < b && c > d");
+        CHECK(para.html() == "<p>a &lt; b &amp;&amp; c &gt; d</p>");
+    }
+    SECTION("quotes in text stay as they are") {
+        html::span s("it's \"fine\"");
+        CHECK(s.html() == "<span>it's \"fine\"</span>");
+    }
+    SECTION("attribute values") {
+        html::div d;
+        d.title("say \"hi\" & 'bye'");
+        d.add_attr("data-x", "<x>");
+        std::string out = d.html();
+        CHECK(out.find("title=\"say &quot;hi&quot; &amp; &#39;bye&#39;\"") != std::string::npos);
+        CHECK(out.find("data-x=\"&lt;x&gt;\"") != std::string::npos);
+        CHECK(d.attr() == " title=\"say &quot;hi&quot; &amp; &#39;bye&#39;\" data-x=\"&lt;x&gt;\"");
+    }
+    SECTION("stored value is not modified") {
+        html::div d;
+        d.add_attr("data-x", "a&b");
+        const html::element& e = d;
+        CHECK(e.attr("data-x") == "a&b");
+    }
+    SECTION("script body is not entity-escaped") {
+        html::script sc("if (a < b && c) { s = \"</SCRIPT><!-- x\"; }");
+        std::string out = sc.html();
+        CHECK(out.find("if (a < b && c)") != std::string::npos);
+        CHECK(out.find("<\\/SCRIPT><\\!-- x") != std::string::npos);
+        CHECK(out.find("</script>") != std::string::npos);
+    }
+    SECTION("style body") {
+        html::style st("a > b { content: '</style>'; }");
+        std::string out = st.html();
+        CHECK(out.find("a > b { content: '<\\/style>'; }") != std::string::npos);
+    }
+    SECTION("raw_html opts out") {
+        html::div d;
+        d << html::raw_html("<b>trusted</b>") << "<b>untrusted</b>";
+        CHECK(d.html() == "<div>\n<b>trusted</b>&lt;b&gt;untrusted&lt;/b&gt;</div>\n");
+        html::div copy = d;
+        CHECK(copy.html() == d.html());
+    }
+    SECTION("nbsp is markup") {
+        html::span s;
+        s << html::nbsp(2);
+        CHECK(s.html() == "<span>&nbsp;&nbsp;</span>");
+        std::string str = html::nbsp();
+        CHECK(str == "&nbsp;");
+    }
+}
+
+TEST_CASE("11120: Setters and text constructors take string_view", "[attributes][string_view]") {
+    // Views into a larger buffer: no terminator, only the viewed bytes are used
+    std::string_view buf = "card-title|Quarterly report|/q3";
+    std::string_view cls = buf.substr(0, 10);
+    std::string_view txt = buf.substr(11, 16);
+    std::string_view url = buf.substr(28);
+
+    html::anchor a(url, txt);
+    a.cl(cls).title(txt).data("k", cls);
+    CHECK(a.html() == "<a class=\"card-title\" href=\"/q3\" title=\"Quarterly report\" data-k=\"card-title\">Quarterly report</a>");
+
+    html::td cell(txt);
+    cell.headers(cls);
+    CHECK(cell.html() == "<td headers=\"card-title\">Quarterly report</td>\n");
+
+    html::input in;
+    in.name(cls.substr(0, 4)).value(std::string("v"));
+    CHECK(in.attr("name") == "card");
+    CHECK(in.attr("value") == "v");
+
+    html::div d;
+    d << txt.substr(0, 9);
+    d.add(buf.substr(21, 6));
+    CHECK(d.html_content_string() == "Quarterlyreport");
+}
+
+TEST_CASE("11130: Numeric attributes are formatted with to_chars", "[attributes][number]") {
+    SECTION("integers") {
+        CHECK(html::number(0).view() == "0");
+        CHECK(html::number(-42).view() == "-42");
+        CHECK(html::number(18446744073709551615ull).view() == "18446744073709551615");
+        html::td c("x");
+        c.colspan(3).tabindex(-1);
+        CHECK(c.attr("colspan") == "3");
+        CHECK(c.attr("tabindex") == "-1");
+    }
+    SECTION("floating point, shortest round-trip") {
+        CHECK(html::number(0.1).view() == "0.1");
+        CHECK(html::number(2.0).view() == "2");
+        CHECK(html::number(0.1f).view() == "0.1");
+        CHECK(html::number(1e300).view() == "1e+300");
+        html::meter m;
+        m.value(0.625).min(0).max(1);
+        CHECK(m.html() == "<meter value=\"0.625\" min=\"0\" max=\"1\"></meter>");
+    }
+    SECTION("floating point, fixed precision") {
+        CHECK(html::number(3.14159, 2).view() == "3.14");
+        CHECK(html::number(2.0, 3).view() == "2.000");
+        // Too wide for fixed notation: falls back to the shortest form
+        CHECK(html::number(1e300, 2).view() == "1e+300");
+        html::progress p;
+        p.value(html::number(2.0 / 3.0, 1)).max(1);
+        CHECK(p.attr("value") == "0.7");
+    }
+    SECTION("content and input values") {
+        html::td cell(html::number(1234.5));
+        CHECK(cell.html() == "<td>1234.5</td>\n");
+        html::input in;
+        in.type("number").min(0).max(2.5).step(0.5).value(1);
+        CHECK(in.attr("max") == "2.5");
+        CHECK(in.attr("step") == "0.5");
+        CHECK(in.attr("value") == "1");
+    }
+}
+
+TEST_CASE("11140: text_ref and attr_ref borrow caller memory", "[attributes][borrow]") {
+    // Stands in for a memory-mapped data file that outlives the tree
+    const std::string source = "Quarterly revenue & margin|https://example.com/q?a=1&b=2|row-7";
+    std::string_view label = std::string_view(source).substr(0, 26);
+    std::string_view url = std::string_view(source).substr(27, 29);
+    std::string_view id = std::string_view(source).substr(57);
+
+    static_assert(!std::is_constructible_v<text_ref, std::string&&>, "temporaries are refused");
+    static_assert(!std::is_constructible_v<attr_ref, std::string_view, std::string&&>, "temporaries are refused");
+
+    html::td cell(text_ref{label});
+    cell << attr_ref("data-href", url) << attr_ref("id", id);
+    REQUIRE(id == "row-7");
+    REQUIRE(cell.size() == 1);
+    CHECK(cell.m_elements[0].is_borrowed());
+    CHECK(cell.m_elements[0].text().data() == label.data());
+    CHECK(cell.attr("data-href").data() == url.data());
+    CHECK(cell.attr("id").data() == id.data());
+    // Rendered exactly like copied values
+    html::td copied(label);
+    copied.add_attr("data-href", url);
+    copied.id(id);
+    CHECK(cell.html() == copied.html());
+
+    SECTION("copies keep pointing at the source") {
+        html::tr row;
+        row << cell << cell;
+        CHECK(row.at(0).attr("data-href").data() == url.data());
+        html::tr copy;
+        copy.copy(row);
+        CHECK(copy.html() == row.html());
+        CHECK(copy.m_elements[1]->m_elements[0].text().data() == label.data());
+    }
+    SECTION("id index and queries see borrowed values") {
+        html::div root;
+        root.index_tree();
+        root << cell;
+        CHECK(root.exists("row-7"));
+        CHECK(root.query_selector("[data-href]") != nullptr);
+    }
+    SECTION("editing or replacing a value makes it owned") {
+        cell.add_cl("a");
+        cell << attr_ref("class", "b");
+        CHECK(cell.attr("class") == "b");
+        cell.id("other");
+        CHECK(cell.attr("id") == "other");
+        CHECK(source.find("other") == std::string::npos);
+        // A borrowed run used as an element becomes a copied text node
+        CHECK(cell[0].html() == "Quarterly revenue &amp; margin");
+        CHECK_FALSE(cell.m_elements[0].is_borrowed());
+    }
+}
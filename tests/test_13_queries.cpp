@@ -0,0 +1,129 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Selector Query Tests
+*  Tests for query_selector / query_selector_all over plain and
+*  indexed element trees.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+
+using namespace html;
+
+namespace {
+    html::div make_report() {
+        html::div root;
+        root.id("report");
+        root << h2("Sales").cl("title");
+        html::table t;
+        t.cl("table report");
+        for (int r = 0; r < 6; r++) {
+            t << tr(td("row " + std::to_string(r)), td(std::to_string(r * 10)).cl("num"), td("x"))
+                     .id("r" + std::to_string(r));
+        }
+        root << std::move(t);
+        root << p("Note ").cl("note muted") << script("track()") << p(span("inner"));
+        return root;
+    }
+
+    std::vector<std::string> ids_of(const std::vector<element*>& _v) {
+        std::vector<std::string> out;
+        for (element* e : _v) {
+            out.push_back(std::string(e->id()));
+        }
+        return out;
+    }
+}
+
+TEST_CASE("13000: Selector - parsing", "[query]") {
+    CHECK(html::selector("div").list().size() == 1);
+    CHECK(html::selector("table.report > tr td:nth-child(2n+1), p.note").list().size() == 2);
+    CHECK(html::selector("td:nth-child(2)").list()[0][0].nth[0].b == 2);
+    CHECK(html::selector("  li:nth-last-child( -n + 3 )  ").list()[0][0].nth[0].a == -1);
+    CHECK(html::selector("[data-kind='a b']").list()[0][0].attrs[0].value == "a b");
+
+    for (const char* bad : { "", "div,", "> p", "div >", "p + p", "a:hover", "td:nth-child(x)", "[x=\"y]", "#", "div!" }) {
+        CHECK_THROWS_AS(html::selector(bad), std::runtime_error);
+    }
+}
+
+TEST_CASE("13010: Query - tag, class, id, attribute, combinators, nth-child", "[query]") {
+    html::div root = make_report();
+
+    CHECK(root.query_selector_all("tr").size() == 6);
+    CHECK(root.query_selector_all("td").size() == 18);
+    CHECK(root.query_selector_all("td.num").size() == 6);
+    CHECK(root.query_selector_all("table.report > tr > td:nth-child(2)").size() == 6);
+    CHECK(root.query_selector_all("table td:first-child").size() == 6);
+    CHECK(root.query_selector_all("td:last-child").size() == 6);
+    CHECK(ids_of(root.query_selector_all("tr:nth-child(odd)")) == std::vector<std::string>{ "r0", "r2", "r4" });
+    CHECK(ids_of(root.query_selector_all("tr:nth-child(-n+2)")) == std::vector<std::string>{ "r0", "r1" });
+    CHECK(ids_of(root.query_selector_all("tr:nth-last-child(1)")) == std::vector<std::string>{ "r5" });
+    CHECK(root.query_selector_all("div > td").empty());
+    CHECK(root.query_selector_all("#r3 td").size() == 3);
+    CHECK(root.query_selector("#r3 .num")->html_string() == "<td class=\"num\">30</td>\n");
+    CHECK(root.query_selector_all("[class=num]").size() == 6);
+    CHECK(root.query_selector_all("[id]").size() == 6);
+    CHECK(root.query_selector_all("p.note.muted").size() == 1);
+    CHECK(root.query_selector_all("p span").size() == 1);
+    CHECK(root.query_selector_all("unknowntag, .missing").empty());
+    // Text nodes are not elements: the span is the first child of its p
+    CHECK(root.query_selector_all("span:first-child").size() == 1);
+    // Scope is the subtree, but combinators may look above it (as in the DOM)
+    CHECK(root.get("r1").query_selector_all("div td").size() == 3);
+    CHECK(root.get("r1").query_selector("tr") == nullptr);
+
+    // Lists come back once each, in document order
+    std::vector<element*> mixed = root.query_selector_all("script, h2, #r1, .title");
+    REQUIRE(mixed.size() == 3);
+    CHECK(mixed[0]->tag() == "h2");
+    CHECK(mixed[1]->id() == "r1");
+    CHECK(mixed[2]->tag() == "script");
+
+    // Typical post-processing
+    for (element* td : root.query_selector_all("td:nth-child(2)")) {
+        td->add_cl("text-end");
+    }
+    CHECK(root.query_selector_all(".num.text-end").size() == 6);
+}
+
+TEST_CASE("13020: Query - indexed trees give the same answers", "[query][find]") {
+    html::div plain = make_report();
+    html::div indexed = make_report();
+    indexed.index_tree();
+
+    for (const char* sel : { "tr", "td.num", "tr:nth-child(even) td:last-child", "#r4 > td", "table .num",
+                             "p, h2.title, td:first-child", "[class=num]", "*", "#nope", ".nope td", "span" }) {
+        html::selector s(sel);
+        std::vector<element*> a = plain.query_selector_all(s);
+        std::vector<element*> b = indexed.query_selector_all(s);
+        REQUIRE(a.size() == b.size());
+        for (size_t i = 0; i < a.size(); i++) {
+            CHECK(a[i]->html_string() == b[i]->html_string());
+        }
+        CHECK((plain.query_selector(s) == nullptr) == (indexed.query_selector(s) == nullptr));
+    }
+
+    // The class and tag index follow changes to the tree
+    indexed.get("r2").at(0).cl("num first");
+    CHECK(indexed.query_selector_all("#r2 .num").size() == 2);
+    indexed.get("r2").at(0).remove_attr("class");
+    CHECK(indexed.query_selector_all("#r2 .num").size() == 1);
+    indexed.get("r2").at(2).add_cl("num");
+    CHECK(indexed.query_selector_all(".num").size() == 7);
+    indexed.get("r3").clear();
+    CHECK(indexed.query_selector_all("td").size() == 15);
+    indexed << html::div(span("added").cl("num"));
+    CHECK(indexed.query_selector_all("div span.num").size() == 1);
+    html::div moved(std::move(indexed.get("r0")));
+    CHECK(indexed.query_selector_all("td").size() == 12);
+    CHECK(moved.query_selector_all("td").size() == 3);
+
+    // Duplicated ids still resolve
+    indexed << p("dup").id("r1");
+    CHECK(indexed.query_selector_all("#r1").size() == 2);
+}
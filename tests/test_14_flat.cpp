@@ -0,0 +1,144 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Flat Document Tests
+*  Tests for flat_document: conversion from and to element trees and
+*  the index-based builder.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+
+using namespace html;
+
+namespace {
+    html::div make_document() {
+        html::div root;
+        root.id("doc").cl("container").add_attr("lang", "en");
+        root << h1("Tom & Jerry <3").cl("title");
+        html::table t;
+        t.cl("table");
+        t.thead << tr(td("Name"), td("Value"));
+        for (int r = 0; r < 3; r++) {
+            t.tbody << tr(td("row " + std::to_string(r)), td(std::to_string(r)).cl("num"));
+        }
+        root << std::move(t);
+        html::table plain;
+        plain << tr(td("a"), td("b"));
+        root << std::move(plain);
+        root << br() << hr() << raw_html("<b>raw</b>");
+        root << (p("one") + p("two"));
+        root << freeze(ul(li("frozen")));
+        root << script("if (a < b) { go(\"</x>\"); }");
+        root << style(".a > .b { color: red; }");
+        root << (p(span("inner").data("k", "v")) << " & more");
+        return root;
+    }
+}
+
+TEST_CASE("14000: Flat document matches element output", "[flat]") {
+    html::div root = make_document();
+    std::string expected = root.html();
+
+    SECTION("element to flat") {
+        flat_document doc(root);
+        CHECK(doc.html() == expected);
+        CHECK(doc.size() > 20);
+    }
+
+    SECTION("flat to element") {
+        flat_document doc(root);
+        element_group g = doc.to_element();
+        CHECK(g.html() == expected);
+        element* h = g.query_selector("h1.title");
+        REQUIRE(h != nullptr);
+        CHECK(h->size() == 1);
+    }
+
+    SECTION("append under a node") {
+        flat_document doc;
+        doc.root().add(section_t).id("s");
+        doc.append(doc[1], root);
+        html::section s;
+        s.id("s");
+        s << make_document();
+        CHECK(doc.html() == s.html());
+    }
+
+    SECTION("page") {
+        html::page pg;
+        pg << html::div(p("content")).cl("x");
+        std::string page_html = pg.html();
+        flat_document doc(pg);
+        CHECK(doc.html() == page_html);
+    }
+}
+
+TEST_CASE("14010: Flat builder mirrors the element API", "[flat]") {
+    html::div d;
+    d.cl("card").id("c1").add_attr("title", "T \"q\"");
+    d << h2("Header") << p("a < b");
+    html::ul list;
+    for (int i = 0; i < 3; i++) {
+        list << li("item " + std::to_string(i)).cl("i");
+    }
+    d << std::move(list);
+    d << script("x = 1 < 2;");
+    d.style("color: red");
+
+    flat_document doc;
+    auto c = doc.root().add(html::div_t).cl("card").id("c1").attr("title", "T \"q\"");
+    c.add(h2_t, "Header");
+    c.add(p_t) << "a < b";
+    auto l = c.add(ul_t);
+    for (int i = 0; i < 3; i++) {
+        l.add(li_t, "item " + std::to_string(i)).cl("i");
+    }
+    c.add(script_t, "x = 1 < 2;");
+    // attributes set after children were added move to the end of the table
+    c.style("color: red");
+
+    CHECK(doc.html() == d.html());
+    CHECK(doc.attr(c.index(), class_attr) == "card");
+    CHECK(doc.attr(c.index(), style_attr) == "color: red");
+
+    SECTION("replacing an attribute keeps its position") {
+        c.cl("card wide");
+        d.cl("card wide");
+        CHECK(doc.html() == d.html());
+    }
+
+    SECTION("text nodes take no children or attributes") {
+        doc.root().text("x");
+        flat_node t = doc[static_cast<std::uint32_t>(doc.size() - 1)];
+        CHECK_THROWS_AS(t.add(html::div_t), std::runtime_error);
+        CHECK_THROWS_AS(t.cl("x"), std::runtime_error);
+        CHECK_THROWS_AS(doc.root().add(text_t), std::runtime_error);
+    }
+}
+
+TEST_CASE("14020: Flat document built out of order", "[flat]") {
+    flat_document doc;
+    auto a = doc.root().add(html::div_t).id("a");
+    auto b = doc.root().add(html::div_t).id("b");
+    b.add(span_t, "in b");
+    // back into the first div: nodes are no longer in document order
+    a.add(span_t, "in a").add(em_t, "deep");
+    a.add(br_t);
+    b.add(p_t, "last");
+
+    html::div ea;
+    ea.id("a");
+    ea << (span("in a") << em("deep")) << br();
+    html::div eb;
+    eb.id("b");
+    eb << span("in b") << p("last");
+    std::string expected = ea.html() + eb.html();
+
+    CHECK(doc.html() == expected);
+    CHECK(doc.to_element().html() == expected);
+    CHECK(flat_document(doc.to_element()).html() == expected);
+}
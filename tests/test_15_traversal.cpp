@@ -0,0 +1,129 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Traversal Tests
+*  Tests for element::traverse and for deep trees, which render, search,
+*  copy and destroy without recursion.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+
+using namespace html;
+
+namespace {
+    // Records the calls a traversal makes
+    struct recorder : visitor {
+        std::vector<std::string> calls;
+        std::string skip_tag;
+        std::string stop_at;
+        action enter(element& _e) override {
+            calls.push_back("<" + std::string(_e.tag()));
+            if(_e.tag() == skip_tag) {
+                return skip;
+            }
+            return descend;
+        }
+        void leave(element& _e) override {
+            calls.push_back("/" + std::string(_e.tag()));
+        }
+        action text(element& _e) override {
+            std::string s = _e.html();
+            calls.push_back("'" + s);
+            return s == stop_at ? stop : descend;
+        }
+    };
+
+    // _depth nested divs with a text leaf; returns the innermost div
+    element* nest(element& _root, size_t _depth) {
+        element* cur = &_root;
+        for(size_t i = 0; i < _depth; i++) {
+            cur->add(html::div());
+            cur = cur->m_elements.back().get();
+        }
+        cur->add(span("bottom").id("deepest"));
+        return cur;
+    }
+}
+
+TEST_CASE("15000: Traverse visits nodes in document order", "[traverse]") {
+    html::div root;
+    root << p("one") << (ul(li("a"), li("b")) << br()) << raw_html("<i>r</i>");
+
+    recorder r;
+    SECTION("full walk") {
+        CHECK(root.traverse(r));
+        std::vector<std::string> expected = {
+            "<div", "<p", "'one", "/p", "<ul", "<li", "'a", "/li", "<li", "'b", "/li",
+            "<br", "/br", "/ul", "'<i>r</i>", "/div"
+        };
+        CHECK(r.calls == expected);
+    }
+
+    SECTION("skip leaves out the subtree and its leave") {
+        r.skip_tag = "ul";
+        CHECK(root.traverse(r));
+        std::vector<std::string> expected = {
+            "<div", "<p", "'one", "/p", "<ul", "'<i>r</i>", "/div"
+        };
+        CHECK(r.calls == expected);
+    }
+
+    SECTION("stop ends the walk") {
+        r.stop_at = "a";
+        CHECK_FALSE(root.traverse(r));
+        CHECK(r.calls.back() == "'a");
+        CHECK(r.calls.size() == 7);
+    }
+}
+
+TEST_CASE("15010: Deep trees render, search, copy and destroy", "[traverse]") {
+    const size_t depth = 100000;
+    std::string expected;
+    for(size_t i = 0; i < depth; i++) {
+        expected += "<div>\n";
+    }
+    expected += "<span id=\"deepest\">bottom</span>";
+    for(size_t i = 0; i < depth; i++) {
+        expected += "</div>\n";
+    }
+
+    html::div root;
+    nest(root, depth - 1);
+    CHECK(root.html() == expected);
+
+    element* found = root.find("deepest");
+    REQUIRE(found != nullptr);
+    CHECK(found->tag() == "span");
+    CHECK(root.query_selector("div > span#deepest") == found);
+
+    html::div copy(root);
+    CHECK(copy.html() == expected);
+    CHECK(copy.find("deepest") != found);
+
+    SECTION("indexed") {
+        copy.index_tree();
+        CHECK(&copy.get("deepest") == copy.find("deepest"));
+        CHECK(copy.duplicate_ids().empty());
+    }
+
+    SECTION("moved") {
+        html::div moved(std::move(copy));
+        CHECK(moved.html() == expected);
+    }
+}
+
+TEST_CASE("15020: Custom writers inside an iterative render", "[traverse]") {
+    html::div root;
+    element* inner = nest(root, 2000);
+    html::table t;
+    t << tr(td("cell"));
+    inner->add(std::move(t));
+    inner->add(script("a < b"));
+    std::string html = root.html();
+    CHECK(html.find("<td>cell</td>") != std::string::npos);
+    CHECK(html.find("<script>\na < b</script>") != std::string::npos);
+}
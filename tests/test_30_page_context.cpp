@@ -11,6 +11,10 @@
 
 #include <catch2/catch_all.hpp>
 #include "../include/html_gen.h"
+#include "../include/html_gen_resources.h"
+#include "../include/html_assets.h"
+#include <cstdlib>
+#include <filesystem>
 
 //=============================================================================
 // PAGE CONTEXT AND DEPENDENCY MANAGEMENT TESTS
@@ -178,3 +182,270 @@ TEST_CASE("30200: Page context - CDN mode is default", "[page][dependency]") {
     CHECK(output.find("cdn.jsdelivr.net") != std::string::npos);
     CHECK(output.find("bootstrap@5.3.0") != std::string::npos);
 }
+
+TEST_CASE("30210: Page context - external mode writes content-hashed files once", "[page][dependency]") {
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / ("htmlgen_assets_" + std::to_string(std::rand()));
+    fs::remove_all(dir);
+
+    std::string first_output;
+    for (int i = 0; i < 3; i++) {
+        html::page pg;
+        pg.set_dependency_mode(html::dependency_mode::external);
+        pg.set_asset_directory(dir.string(), "assets");
+        pg.require(html::dependency::bootstrap_css);
+        pg.require(html::dependency::apexcharts_js);
+        std::string output = pg.html();
+        if (i == 0) {
+            first_output = output;
+        }
+        CHECK(output == first_output);
+    }
+
+    // One file per resource, holding the resource bytes
+    size_t files = 0;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        (void)entry;
+        files++;
+    }
+    CHECK(files == 2);
+
+    const html::asset_info& css = html::publish_asset(dir.string(), "bootstrap", ".css",
+                                                      resources::bootstrap_css_view());
+    CHECK(css.file_name.rfind("bootstrap.", 0) == 0);
+    CHECK(css.file_name.size() == std::string("bootstrap.").size() + 12 + 4);
+    CHECK(fs::file_size(dir / css.file_name) == resources::bootstrap_min_css_size);
+
+    auto digest = html::detail::sha256(resources::bootstrap_css_view());
+    CHECK(css.integrity == "sha256-" + html::detail::base64(digest.data(), digest.size()));
+
+    // Pages link to the files with integrity, nothing is embedded
+    CHECK(first_output.find("<link href=\"assets/" + css.file_name + "\" rel=\"stylesheet\" integrity=\"" +
+                            css.integrity + "\">") != std::string::npos);
+    CHECK(first_output.find("<script src=\"assets/apexcharts.") != std::string::npos);
+    CHECK(first_output.find("cdn.jsdelivr.net") == std::string::npos);
+    CHECK(first_output.size() < 4096);
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("30220: SHA-256 and base64 helpers", "[page][dependency]") {
+    auto hex = [](const std::array<std::uint8_t, 32>& _d) {
+        static const char digits[] = "0123456789abcdef";
+        std::string s;
+        for (auto b : _d) {
+            s += digits[b >> 4];
+            s += digits[b & 15];
+        }
+        return s;
+    };
+    CHECK(hex(html::detail::sha256("")) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    CHECK(hex(html::detail::sha256("abc")) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    CHECK(hex(html::detail::sha256(std::string(1000, 'a'))) ==
+          "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3");
+
+    auto digest = html::detail::sha256("abc");
+    CHECK(html::detail::base64(digest.data(), digest.size()) == "ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=");
+    const std::uint8_t two[] = { 'h', 'i' };
+    CHECK(html::detail::base64(two, 2) == "aGk=");
+}
+
+TEST_CASE("30230: CSS index - keeps only rules the document can match", "[page][css]") {
+    const char* css =
+        "@charset \"UTF-8\";/*! license */:root{--x-color:red}"
+        "*,::before{box-sizing:border-box}"
+        "h1,.h1{margin:0}"
+        ".btn{color:var(--x-color)}.btn.active{color:blue}.btn-lg{padding:1rem}"
+        "#main{display:block}.card .card-title{font-weight:700}"
+        "a:not(.btn){text-decoration:none}[hidden]{display:none!important}"
+        ".w-\\31 00{width:100%}.sm\\:p-0{padding:0}"
+        "@media (min-width:576px){.btn-lg{padding:2rem}.col-sm{flex:1}}"
+        "@supports (display:grid){@media (min-width:768px){.grid{display:grid}}}"
+        "@font-face{font-family:x;src:url(x.woff)}"
+        "@keyframes spin{to{transform:rotate(360deg)}}@keyframes fade{to{opacity:0}}"
+        ".spinner{animation:.75s linear infinite spin}/* dropped */";
+    html::css_index index(css);
+    CHECK(index.rule_count() == 16);
+
+    html::css_usage u;
+    u.add_tag("div");
+    u.add_class(" btn  card\tcard-title ");
+    u.add_id("main");
+    std::string out = index.shake(u);
+    CHECK(out ==
+          "@charset \"UTF-8\";/*! license */:root{--x-color:red}"
+          "*,::before{box-sizing:border-box}"
+          ".btn{color:var(--x-color)}"
+          "#main{display:block}.card .card-title{font-weight:700}"
+          "[hidden]{display:none!important}"
+          "@font-face{font-family:x;src:url(x.woff)}");
+
+    // Compound selectors need every name; wrappers and keyframes follow their rules
+    u.add_tag("a");
+    u.add_class("active btn-lg w-100 sm:p-0 spinner");
+    out = index.shake(u);
+    CHECK(out.find(".btn.active{color:blue}") != std::string::npos);
+    CHECK(out.find("a:not(.btn){text-decoration:none}") != std::string::npos);
+    CHECK(out.find(".w-\\31 00{width:100%}.sm\\:p-0{padding:0}") != std::string::npos);
+    CHECK(out.find("@media (min-width:576px){.btn-lg{padding:2rem}}") != std::string::npos);
+    CHECK(out.find("@supports") == std::string::npos);
+    CHECK(out.find("@keyframes spin{to{transform:rotate(360deg)}}") != std::string::npos);
+    CHECK(out.find("@keyframes fade") == std::string::npos);
+    CHECK(out.find("dropped") == std::string::npos);
+
+    u.add_class("grid");
+    CHECK(index.shake(u).find("@supports (display:grid){@media (min-width:768px){.grid{display:grid}}}") != std::string::npos);
+}
+
+TEST_CASE("30240: CSS usage - collected from elements and raw markup", "[page][css]") {
+    html::div d;
+    d.cl("row g-2").id("top");
+    d << html::p("text").cl("lead");
+    d << html::raw_html("<span class='badge bg-primary' id=\"b1\">1</span><br/>");
+
+    html::css_usage u;
+    u.collect(d);
+    for (const char* key : { "div", "p", "span", "br", ".row", ".g-2", ".lead", ".badge", ".bg-primary", "#top", "#b1" }) {
+        CHECK(u.uses(key));
+    }
+    CHECK_FALSE(u.uses("text"));
+    CHECK_FALSE(u.uses(".text"));
+}
+
+TEST_CASE("30250: Page context - embedded Bootstrap is tree-shaken to the page", "[page][css]") {
+    html::page pg;
+    pg.set_dependency_mode(html::dependency_mode::embedded);
+    pg.set_css_tree_shaking();
+    pg.require(html::dependency::bootstrap_css);
+    pg << html::div().cl("container") << html::anchor("#", "go").cl("btn btn-primary");
+    std::string output = pg.html();
+
+    CHECK(output.size() < resources::bootstrap_min_css_size / 4);
+    CHECK(output.find(":root,[data-bs-theme=light]{--bs-blue:#0d6efd;") != std::string::npos);
+    CHECK(output.find(".btn-primary{") != std::string::npos);
+    CHECK(output.find(".container,.container-fluid,") != std::string::npos);
+    CHECK(output.find("@media (min-width:576px){.container") != std::string::npos);
+    CHECK(output.find(".carousel{") == std::string::npos);
+    CHECK(output.find("@keyframes spinner-border") == std::string::npos);
+    CHECK(output.find("/*!\n * Bootstrap") != std::string::npos);
+
+    // Runtime classes are kept when asked for, and when Bootstrap's JS is used
+    pg.keep_css_classes("spinner-border");
+    std::string kept = pg.html();
+    CHECK(kept.find("@keyframes spinner-border") != std::string::npos);
+    CHECK(kept.find(".modal-backdrop{") == std::string::npos);
+    pg.require(html::dependency::bootstrap_js);
+    CHECK(pg.html().find(".modal-backdrop{") != std::string::npos);
+
+    // Without the option the whole stylesheet is inlined
+    html::page full;
+    full.set_dependency_mode(html::dependency_mode::embedded);
+    full.require(html::dependency::bootstrap_css);
+    CHECK(full.html().size() > resources::bootstrap_min_css_size);
+}
+
+//=============================================================================
+// ARENA ALLOCATION TESTS
+//=============================================================================
+
+namespace {
+    // Upstream resource that counts the blocks the arena asks for
+    class counting_resource : public std::pmr::memory_resource {
+      public:
+        size_t allocations = 0;
+        size_t bytes = 0;
+      private:
+        void* do_allocate(size_t bytes, size_t align) override {
+            ++allocations;
+            this->bytes += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE("30300: Page arena - tree is built in the page-owned arena", "[page][arena]") {
+    html::page pg;
+    {
+        auto scope = pg.use_arena();
+        html::table t;
+        for (int r = 0; r < 100; r++) {
+            t << html::tr(html::td("cell").cl("c"), html::td("value").id("v" + std::to_string(r)));
+        }
+        pg << t;
+    }
+    CHECK(html::detail::resource() == std::pmr::new_delete_resource());
+
+    std::string output = pg.html();
+    CHECK(output.find("<td class=\"c\">cell</td>") != std::string::npos);
+    CHECK(output.find("<td id=\"v99\">value</td>") != std::string::npos);
+    CHECK(pg.get("v42").html_string() == "<td id=\"v42\">value</td>\n");
+}
+
+TEST_CASE("30310: Arena - nodes and strings come from a few large blocks", "[page][arena]") {
+    counting_resource upstream;
+    {
+        html::arena a(4096, &upstream);
+        CHECK(html::detail::resource() == a.resource());
+
+        html::div d;
+        for (int i = 0; i < 500; i++) {
+            d << html::p("a paragraph long enough to need its own allocation").cl("lead text-muted");
+        }
+        CHECK(d.size() == 500);
+        // Geometric block growth: far fewer upstream requests than nodes
+        CHECK(upstream.allocations < 20);
+    }
+    CHECK(html::detail::resource() == std::pmr::new_delete_resource());
+}
+
+TEST_CASE("30315: Arena - arenas may be released out of order", "[page][arena]") {
+    auto first = std::make_unique<html::arena>(4096);
+    auto second = std::make_unique<html::arena>(4096);
+    CHECK(html::detail::resource() == second->resource());
+
+    // The outer arena goes first: the inner one stays current
+    first.reset();
+    CHECK(html::detail::resource() == second->resource());
+    {
+        html::div kept;
+        kept << "in the second arena";
+        CHECK(kept.html_string().find("in the second arena") != std::string::npos);
+    }
+    second.reset();
+    CHECK(html::detail::resource() == std::pmr::new_delete_resource());
+
+    // Built after both: on the heap, not in a freed arena
+    html::div d;
+    d << "heap";
+    d.cl("after");
+    CHECK(d.html_string() == "<div class=\"after\">\nheap</div>\n");
+}
+
+TEST_CASE("30320: Arena - borrowed cells take no string storage", "[page][arena][borrow]") {
+    // Bytes the arena asks for to build a table from borrowed strings of one length
+    auto build = [](size_t length) {
+        const std::string cell(length, 'x');
+        const std::string title(length, 'y');
+        counting_resource upstream;
+        {
+            html::arena a(4096, &upstream);
+            html::table t;
+            for (int r = 0; r < 100; r++) {
+                html::tr row;
+                for (int c = 0; c < 10; c++) {
+                    row << (html::td(html::text_ref{cell}) << html::attr_ref("title", title));
+                }
+                t << std::move(row);
+            }
+            CHECK(t.html().size() > 1000 * 2 * length);
+        }
+        return upstream.bytes;
+    };
+    CHECK(build(16) == build(4000));
+}
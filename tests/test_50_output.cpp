@@ -0,0 +1,421 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Output Sink Tests
+*  Tests for html::writer implementations (string, fixed buffer,
+*  callback, file descriptor), the std::ostream adapter,
+*  pre-rendered static fragments, shared subtrees, chunked
+*  streaming and pass-through of embedded resources.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+#include "../include/html_gen_resources.h"
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//=============================================================================
+// OUTPUT SINK TESTS
+//=============================================================================
+
+static html::div make_sample() {
+    html::div d;
+    d.id("box").cl("card");
+    d << html::h1("Title") << html::p("Some text") << html::br();
+    return d;
+}
+
+TEST_CASE("50100: Output - string_writer matches html()", "[output][writer]") {
+    html::div d = make_sample();
+    std::string expected = d.html();
+
+    std::string out = "prefix:";
+    {
+        html::string_writer w(out);
+        d.write_html(w);
+    }
+    CHECK(out == "prefix:" + expected);
+
+    html::string_writer w2;
+    d.write_html(w2);
+    CHECK(w2.str() == expected);
+}
+
+TEST_CASE("50110: Output - ostream adapter matches html()", "[output][writer]") {
+    html::page pg;
+    pg << html::div(html::p("Hello"));
+
+    std::ostringstream ss;
+    ss << pg;
+    CHECK(ss.str() == pg.html());
+
+    html::div d = make_sample();
+    std::ostringstream es;
+    es << d;
+    CHECK(es.str() == d.html());
+}
+
+TEST_CASE("50120: Output - buffer_writer truncates at capacity", "[output][writer]") {
+    html::div d = make_sample();
+    std::string expected = d.html();
+
+    std::vector<char> big(expected.size() + 16);
+    html::buffer_writer bw(big.data(), big.size());
+    d.write_html(bw);
+    CHECK_FALSE(bw.truncated());
+    CHECK(bw.view() == expected);
+
+    char small[10];
+    html::buffer_writer sw(small, sizeof(small));
+    d.write_html(sw);
+    CHECK(sw.truncated());
+    CHECK(sw.size() == sizeof(small));
+    CHECK(sw.view() == expected.substr(0, sizeof(small)));
+}
+
+TEST_CASE("50130: Output - callback_writer hands over blocks", "[output][writer]") {
+    html::div d;
+    for(int i = 0; i < 200; i++) {
+        d << html::p("paragraph " + std::to_string(i));
+    }
+    std::string expected = d.html();
+
+    std::string collected;
+    size_t blocks = 0;
+    {
+        html::callback_writer cw([&](std::string_view _s) {
+            CHECK(_s.size() <= 64);
+            collected.append(_s);
+            blocks++;
+        }, 64);
+        d.write_html(cw);
+    }
+    CHECK(collected == expected);
+    CHECK(blocks > 1);
+}
+
+TEST_CASE("50140: Output - fd_writer writes to a file descriptor", "[output][writer]") {
+    html::div d = make_sample();
+    std::string expected = d.html();
+
+    std::FILE* f = std::tmpfile();
+    REQUIRE(f != nullptr);
+    {
+        html::fd_writer fw(fileno(f), 32);
+        d.write_html(fw);
+    }
+    std::rewind(f);
+    std::string read_back;
+    char buf[256];
+    size_t n;
+    while((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+        read_back.append(buf, n);
+    }
+    std::fclose(f);
+    CHECK(read_back == expected);
+}
+
+namespace {
+    // Component with its own writer, rendered from inside a plain tree
+    class counter_badge : public html::element {
+      public:
+        counter_badge() {
+            m_type = html::span_t;
+            m_writer = writer_custom;
+        }
+        virtual void write_html(html::writer& _s) override {
+            _s << "<span class=\"badge\">7</span>";
+        }
+        virtual html::element* make_copy()const override {
+            counter_badge* ptr = new counter_badge();
+            ptr->copy(*this);
+            return ptr;
+        }
+        virtual html::element* make_move() override {
+            counter_badge* ptr = new counter_badge();
+            ptr->move(std::move(*this));
+            return ptr;
+        }
+    };
+}
+
+TEST_CASE("50150: Output - table-driven rendering keeps custom writers", "[output][writer]") {
+    html::div d;
+    d << html::p(html::text("a < b")) << counter_badge() << html::raw_html("<i>raw</i>")
+      << html::br() << (html::em("x") + html::strong("y"));
+    d.cl("c").add_attr("data-q", "\"q\"");
+
+    std::string h = d.html();
+    CHECK(h.find("<div class=\"c\" data-q=\"&quot;q&quot;\">") == 0);
+    CHECK(h.find("<p>a &lt; b</p><span class=\"badge\">7</span><i>raw</i><br><em>x</em><strong>y</strong>") != std::string::npos);
+
+    // Copies made with the copy constructor keep rendering through their class
+    html::raw_html r("<b>");
+    html::raw_html r2(r);
+    html::div holder;
+    holder << r2 << html::text("&");
+    CHECK(holder.html_content_string() == "<b>&amp;");
+}
+
+TEST_CASE("50160: Output - tag table is built at compile time", "[output][writer]") {
+    static_assert(html::detail::tag_table[html::div_t].open == "<div");
+    static_assert(html::detail::tag_table[html::blockquote_t].close == "</blockquote>");
+    static_assert(html::detail::tag_table[html::text_t].name.empty());
+
+    CHECK(html::span().tag() == "span");
+    CHECK(html::element::tag_type("figcaption") == html::figcaption_t);
+    CHECK(html::element::tag_type("nosuchtag") == html::undefined_t);
+    CHECK(html::textarea("t").html() == "<textarea>t</textarea>");
+}
+
+//=============================================================================
+// STATIC FRAGMENT TESTS
+//=============================================================================
+
+TEST_CASE("50200: Static fragment - renders like the original subtree", "[output][fragment]") {
+    html::nav n;
+    n.cl("navbar");
+    n << html::anchor("/", "Home") << html::anchor("/about", "About & Contact");
+    std::string expected = n.html();
+
+    html::static_fragment frag = html::freeze(n);
+    CHECK(frag.markup() == expected);
+    CHECK(frag.html() == expected);
+
+    // Later changes to the source do not affect the fragment
+    n << html::anchor("/new", "New");
+    CHECK(frag.html() == expected);
+
+    html::div page_body;
+    page_body << frag << html::p("dynamic") << frag;
+    CHECK(page_body.html() == "<div>\n" + expected + "<p>dynamic</p>" + expected + "</div>\n");
+}
+
+TEST_CASE("50210: Static fragment - copies share one buffer", "[output][fragment]") {
+    html::static_fragment frag = html::freeze(html::div(html::p("footer")));
+    html::div a;
+    html::div b;
+    a << frag;
+    b << frag;
+
+    const auto& buf = frag.buffer();
+    CHECK(buf.use_count() == 3);
+    CHECK(dynamic_cast<html::static_fragment&>(a[0]).buffer().get() == buf.get());
+
+    html::static_fragment empty;
+    CHECK(empty.html().empty());
+    CHECK_THROWS(empty.add(html::p("x")));
+}
+
+TEST_CASE("50220: Static fragment - shared across threads", "[output][fragment]") {
+    html::static_fragment frag = html::freeze(html::ul(html::li("one"), html::li("two")));
+    std::string expected = std::string(frag.markup());
+
+    std::vector<std::string> results(4);
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < results.size(); t++) {
+        threads.emplace_back([&, t]() {
+            for(int i = 0; i < 100; i++) {
+                html::div d;
+                d << frag;
+                results[t] = d.html_content_string();
+            }
+        });
+    }
+    for(auto& th : threads) {
+        th.join();
+    }
+    for(const auto& r : results) {
+        CHECK(r == expected);
+    }
+}
+
+TEST_CASE("50230: Shared subtree - copies share the nodes", "[output][shared]") {
+    html::shared_subtree card = html::share(make_sample());
+    std::string expected = make_sample().html();
+    CHECK(card.html() == expected);
+    CHECK(card.use_count() == 1);
+
+    html::div body;
+    for(int i = 0; i < 50; i++) {
+        body << card;
+    }
+    CHECK(card.use_count() == 51);
+    CHECK(dynamic_cast<html::shared_subtree&>(body[7]).get() == card.get());
+
+    // Copying the tree bumps the counts again
+    html::div copy(body);
+    CHECK(card.use_count() == 101);
+    CHECK(copy.html() == body.html());
+    std::string all;
+    for(int i = 0; i < 50; i++) {
+        all += expected;
+    }
+    CHECK(body.html() == "<div>\n" + all + "</div>\n");
+    CHECK_THROWS(card.add(html::p("x")));
+}
+
+TEST_CASE("50240: Shared subtree - edit clones only a shared tree", "[output][shared]") {
+    html::shared_subtree card = html::share(make_sample());
+    html::div a;
+    a << card << card;
+    const html::element* before = card.get();
+
+    card.edit().cl("card active");
+    CHECK(card.get() != before);
+    CHECK(card.use_count() == 1);
+    CHECK(card.html().find("class=\"card active\"") != std::string::npos);
+    CHECK(a.html().find("active") == std::string::npos);
+
+    const html::element* own = card.get();
+    card.edit() << html::p("more");
+    CHECK(card.get() == own);
+
+    html::css_usage u;
+    u.collect(a);
+    CHECK(u.uses(".card"));
+    CHECK(u.uses("#box"));
+
+    html::shared_subtree empty;
+    CHECK(empty.html().empty());
+    CHECK_THROWS_AS(empty.edit(), std::runtime_error);
+}
+
+//=============================================================================
+// CHUNKED STREAMING TESTS
+//=============================================================================
+
+static void fill_page(html::page& _pg) {
+    for(int i = 0; i < 300; i++) {
+        _pg << html::p("Row " + std::to_string(i) + " with <some> text");
+    }
+}
+
+TEST_CASE("50300: Streaming - write_chunked delivers bounded chunks", "[output][stream]") {
+    html::page pg;
+    fill_page(pg);
+    std::string expected = pg.html();
+
+    std::string collected;
+    size_t max_chunk = 0;
+    size_t chunks = 0;
+    html::write_chunked(pg, 1024, [&](std::string_view _c) {
+        collected.append(_c);
+        max_chunk = std::max(max_chunk, _c.size());
+        chunks++;
+    });
+    CHECK(collected == expected);
+    CHECK(max_chunk == 1024);
+    CHECK(chunks == (expected.size() + 1023) / 1024);
+}
+
+TEST_CASE("50310: Streaming - chunk_stream pulls the page in order", "[output][stream]") {
+    html::page pg;
+    fill_page(pg);
+    std::string expected = pg.html();
+
+    html::chunk_stream cs(pg, 512, 2);
+    std::string chunk;
+    std::string collected;
+    while(cs.next(chunk)) {
+        CHECK(chunk.size() <= 512);
+        collected += chunk;
+    }
+    CHECK(collected == expected);
+    CHECK_FALSE(cs.next(chunk));
+}
+
+TEST_CASE("50320: Streaming - abandoning a stream stops the render", "[output][stream]") {
+    html::page pg;
+    fill_page(pg);
+    {
+        html::chunk_stream cs(pg, 64, 1);
+        std::string chunk;
+        REQUIRE(cs.next(chunk));
+        CHECK(chunk.size() == 64);
+        // destructor cancels the blocked worker
+    }
+    SUCCEED();
+}
+
+namespace {
+    class failing_element : public html::element {
+      public:
+        virtual void write_html(html::writer&) override {
+            throw std::runtime_error("render failed");
+        }
+        virtual html::element* make_copy()const override { return new failing_element(); }
+        virtual html::element* make_move() override { return new failing_element(); }
+    };
+}
+
+TEST_CASE("50330: Streaming - render errors reach the consumer", "[output][stream]") {
+    failing_element bad;
+    html::chunk_stream cs(bad, 64);
+    std::string chunk;
+    CHECK_THROWS_AS(cs.next(chunk), std::runtime_error);
+}
+
+//=============================================================================
+// EMBEDDED RESOURCE OUTPUT TESTS
+//=============================================================================
+
+TEST_CASE("50400: Resources - string_view accessors reference the static arrays", "[output][resources]") {
+    CHECK(resources::bootstrap_css_view().data() == resources::bootstrap_min_css);
+    CHECK(resources::bootstrap_css_view().size() == resources::bootstrap_min_css_size);
+    CHECK(resources::bootstrap_js_view().data() == resources::bootstrap_min_js);
+    CHECK(resources::apexcharts_js_view().size() == resources::apexcharts_min_js_size);
+    CHECK(resources::bootstrap_css_view() == resources::bootstrap_css_string());
+}
+
+TEST_CASE("50410: Resources - embedded page passes resources through without copying", "[output][resources]") {
+    html::page pg;
+    pg.set_dependency_mode(html::dependency_mode::embedded);
+    pg.require(html::dependency::bootstrap_css);
+    pg.require(html::dependency::bootstrap_js);
+    pg << html::p("content");
+    std::string expected = pg.html();
+
+    SECTION("callback sink receives slices of the static array") {
+        const char* css_begin = resources::bootstrap_min_css;
+        const char* css_end = css_begin + resources::bootstrap_min_css_size;
+        std::string collected;
+        size_t referenced = 0;
+        {
+            html::callback_writer cw([&](std::string_view _c) {
+                CHECK(_c.size() <= 4096);
+                if(_c.data() >= css_begin && _c.data() < css_end) {
+                    referenced += _c.size();
+                }
+                collected.append(_c);
+            }, 4096);
+            pg.write_html(cw);
+        }
+        CHECK(collected == expected);
+        CHECK(referenced == resources::bootstrap_min_css_size);
+    }
+
+    SECTION("fd sink") {
+        std::FILE* f = std::tmpfile();
+        REQUIRE(f != nullptr);
+        {
+            html::fd_writer fw(fileno(f), 8192);
+            pg.write_html(fw);
+        }
+        std::rewind(f);
+        std::string read_back;
+        char buf[65536];
+        size_t n;
+        while((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+            read_back.append(buf, n);
+        }
+        std::fclose(f);
+        CHECK(read_back == expected);
+    }
+}
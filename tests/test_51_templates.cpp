@@ -0,0 +1,107 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Compiled Template Tests
+*  Tests for page_template, slot placeholders and slot_values.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+
+//=============================================================================
+// COMPILED TEMPLATE TESTS
+//=============================================================================
+
+TEST_CASE("51100: Template - text and attribute slots", "[template]") {
+    html::div card;
+    card.cl("card");
+    card << html::h2(html::slot("title"));
+    html::anchor link;
+    link.href(html::attr_slot("url"));
+    link << html::slot("title");
+    card << link;
+
+    html::page_template tpl(card);
+    CHECK(tpl.slot_count() == 2);
+    CHECK(tpl.slot_index("title") != html::page_template::npos);
+    CHECK(tpl.slot_index("missing") == html::page_template::npos);
+
+    html::slot_values v(tpl);
+    v.set("title", "Fish & Chips").set("url", "/menu?a=1&b=\"2\"");
+    std::string out = tpl.render(v);
+
+    // Same result as building the tree with the values in place
+    html::div expected_card;
+    expected_card.cl("card");
+    expected_card << html::h2("Fish & Chips");
+    html::anchor expected_link;
+    expected_link.href("/menu?a=1&b=\"2\"");
+    expected_link << "Fish & Chips";
+    expected_card << expected_link;
+    CHECK(out == expected_card.html());
+    CHECK(out.find("Fish &amp; Chips") != std::string::npos);
+    CHECK(out.find("href=\"/menu?a=1&amp;b=&quot;2&quot;\"") != std::string::npos);
+}
+
+TEST_CASE("51110: Template - subtree slot and reuse", "[template]") {
+    html::page pg;
+    pg << html::h1(html::slot("heading"));
+    pg << html::slot("body", html::slot_kind::tree);
+
+    html::page_template tpl(pg);
+    html::slot_values v(tpl);
+
+    html::ul items;
+    items << html::li("one") << html::li("two");
+    v.set("heading", "First").set("body", items);
+    std::string first = tpl.render(v);
+    CHECK(first.find("<h1>First</h1>") != std::string::npos);
+    CHECK(first.find(items.html()) != std::string::npos);
+    CHECK(first.find("<!DOCTYPE html>") != std::string::npos);
+
+    // Refill the same values object
+    v.clear();
+    v.set("heading", "<Second>");
+    std::string second = tpl.render(v);
+    CHECK(second.find("<h1>&lt;Second&gt;</h1>") != std::string::npos);
+    CHECK(second.find("<ul>") == std::string::npos);
+}
+
+TEST_CASE("51120: Template - slot in script uses script escaping", "[template]") {
+    html::div d;
+    html::script sc;
+    sc << html::slot("json");
+    d << sc;
+    html::page_template tpl(d);
+    html::slot_values v(tpl);
+    v.set("json", "{\"a\": \"</script>\", \"b\": 1 < 2}");
+    std::string out = tpl.render(v);
+    CHECK(out.find("{\"a\": \"<\\/script>\", \"b\": 1 < 2}") != std::string::npos);
+}
+
+TEST_CASE("51130: Template - type and name errors", "[template]") {
+    html::div d;
+    d << html::p(html::slot("name")) << html::slot("extra", html::slot_kind::tree);
+    html::page_template tpl(d);
+    html::slot_values v(tpl);
+    html::p para("x");
+
+    CHECK_THROWS(v.set("nope", "x"));
+    CHECK_THROWS(v.set("name", para));
+    CHECK_THROWS(v.set("extra", "text"));
+    CHECK_THROWS(v.set(99, "x"));
+
+    html::page_template other(d);
+    html::slot_values wrong(other);
+    CHECK_THROWS(tpl.render(wrong));
+
+    html::div mixed;
+    mixed << html::slot("x") << html::slot("x", html::slot_kind::tree);
+    CHECK_THROWS(html::page_template(mixed));
+
+    // Unset slots render empty
+    CHECK(tpl.render(v) == "<div>\n<p></p></div>\n");
+}
@@ -0,0 +1,193 @@
+/*  ===================================================================
+*                      HTML Generator Library - Tests
+*               Copyright 1999 - 2024 by Peter Ritter
+*                A L L   R I G H T S   R E S E R V E D
+*  ====================================================================
+*
+*  Gzip Output Tests
+*  Tests for gzip_writer: multi-member streams, spliced precompressed
+*  resources and decoding back to the plain page.
+*/
+
+#include <catch2/catch_all.hpp>
+#include "../include/html_gen.h"
+#include "../include/html_gen_resources.h"
+#include <cstring>
+
+#ifdef HTML_GEN_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace {
+
+    const std::string_view precompressed[] = {
+        resources::bootstrap_css_gz_view(),
+        resources::bootstrap_js_gz_view(),
+        resources::apexcharts_js_gz_view()
+    };
+    const std::string_view plain[] = {
+        resources::bootstrap_css_view(),
+        resources::bootstrap_js_view(),
+        resources::apexcharts_js_view()
+    };
+
+    uint32_t le32(const std::string& _s, size_t _at) {
+        return static_cast<uint32_t>(static_cast<unsigned char>(_s[_at])) |
+               static_cast<uint32_t>(static_cast<unsigned char>(_s[_at + 1])) << 8 |
+               static_cast<uint32_t>(static_cast<unsigned char>(_s[_at + 2])) << 16 |
+               static_cast<uint32_t>(static_cast<unsigned char>(_s[_at + 3])) << 24;
+    }
+
+    // Decodes a multi-member gzip stream; counts members
+    std::string gunzip(const std::string& _gz, size_t& _members) {
+        std::string out;
+        _members = 0;
+#ifdef HTML_GEN_HAVE_ZLIB
+        z_stream zs{};
+        REQUIRE(inflateInit2(&zs, 15 + 16) == Z_OK);
+        zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(_gz.data()));
+        zs.avail_in = static_cast<uInt>(_gz.size());
+        char buf[65536];
+        while(zs.avail_in > 0) {
+            zs.next_out = reinterpret_cast<Bytef*>(buf);
+            zs.avail_out = sizeof(buf);
+            int rc = inflate(&zs, Z_NO_FLUSH);
+            REQUIRE((rc == Z_OK || rc == Z_STREAM_END));
+            out.append(buf, sizeof(buf) - zs.avail_out);
+            if(rc == Z_STREAM_END) {
+                _members++;
+                inflateReset(&zs);
+            }
+        }
+        inflateEnd(&zs);
+#else
+        // Stored-block members, plus the known precompressed members verbatim
+        size_t pos = 0;
+        while(pos < _gz.size()) {
+            bool spliced = false;
+            for(size_t r = 0; r < 3; r++) {
+                if(_gz.compare(pos, precompressed[r].size(), precompressed[r]) == 0) {
+                    out.append(plain[r]);
+                    pos += precompressed[r].size();
+                    spliced = true;
+                    break;
+                }
+            }
+            _members++;
+            if(spliced) {
+                continue;
+            }
+            REQUIRE(static_cast<unsigned char>(_gz[pos]) == 0x1f);
+            REQUIRE(static_cast<unsigned char>(_gz[pos + 1]) == 0x8b);
+            pos += 10;
+            size_t start = out.size();
+            while(true) {
+                unsigned char hdr = static_cast<unsigned char>(_gz[pos]);
+                REQUIRE((hdr & 0x06) == 0);  // stored
+                size_t len = static_cast<unsigned char>(_gz[pos + 1]) | static_cast<unsigned char>(_gz[pos + 2]) << 8;
+                out.append(_gz, pos + 5, len);
+                pos += 5 + len;
+                if(hdr & 1) {
+                    break;
+                }
+            }
+            CHECK(le32(_gz, pos) == html::detail::crc32(0, out.data() + start, out.size() - start));
+            CHECK(le32(_gz, pos + 4) == out.size() - start);
+            pos += 8;
+        }
+#endif
+        return out;
+    }
+
+    std::string gzip_render(html::element& _e) {
+        std::string gz;
+        {
+            html::string_writer sw(gz);
+            html::gzip_writer w(sw);
+            _e.write_html(w);
+            w.finish();
+        }
+        return gz;
+    }
+
+}
+
+TEST_CASE("52100: Gzip - dynamic page round-trips", "[output][gzip]") {
+    html::page pg;
+    for(int i = 0; i < 200; i++) {
+        pg << html::p("Line " + std::to_string(i) + " & more");
+    }
+    std::string expected = pg.html();
+    std::string gz = gzip_render(pg);
+
+    REQUIRE(gz.size() > 18);
+    CHECK(static_cast<unsigned char>(gz[0]) == 0x1f);
+    CHECK(static_cast<unsigned char>(gz[1]) == 0x8b);
+    if(html::gzip_writer::compresses()) {
+        CHECK(gz.size() < expected.size() / 4);
+    }
+
+    size_t members = 0;
+    CHECK(gunzip(gz, members) == expected);
+    CHECK(members == 1);
+}
+
+TEST_CASE("52110: Gzip - embedded resources are spliced in precompressed", "[output][gzip]") {
+    html::page pg;
+    pg.set_dependency_mode(html::dependency_mode::embedded);
+    pg.require(html::dependency::bootstrap_css);
+    pg.require(html::dependency::bootstrap_js);
+    pg << html::div(html::p("dynamic"));
+    std::string expected = pg.html();
+
+    std::string gz;
+    size_t writer_members = 0;
+    {
+        html::string_writer sw(gz);
+        html::gzip_writer w(sw);
+        pg.write_html(w);
+        w.finish();
+        writer_members = w.members();
+    }
+
+    // Both members appear byte for byte in the stream
+    CHECK(gz.find(resources::bootstrap_css_gz_view()) != std::string::npos);
+    CHECK(gz.find(resources::bootstrap_js_gz_view()) != std::string::npos);
+
+    size_t members = 0;
+    CHECK(gunzip(gz, members) == expected);
+    // dynamic, css, dynamic, js, dynamic
+    CHECK(members == 5);
+    CHECK(writer_members == members);
+}
+
+TEST_CASE("52120: Gzip - empty output and misuse", "[output][gzip]") {
+    std::string gz;
+    {
+        html::string_writer sw(gz);
+        html::gzip_writer w(sw);
+        w.finish();
+        CHECK_THROWS(w.write_precompressed("x", resources::bootstrap_js_gz_view()));
+    }
+    size_t members = 0;
+    CHECK(gunzip(gz, members).empty());
+    CHECK(members == 1);
+
+    // Precompressed member goes out unchanged through non-gzip sinks as plain text
+    std::string plain_out;
+    {
+        html::string_writer sw(plain_out);
+        sw.write_precompressed("abc", resources::bootstrap_js_gz_view());
+    }
+    CHECK(plain_out == "abc");
+}
+
+TEST_CASE("52130: Gzip - precompressed resources decode to the originals", "[output][gzip][resources]") {
+    for(size_t r = 0; r < 3; r++) {
+        CHECK(static_cast<unsigned char>(precompressed[r][0]) == 0x1f);
+        // ISIZE trailer matches the plain size
+        std::string member(precompressed[r]);
+        CHECK(le32(member, member.size() - 4) == plain[r].size());
+        CHECK(le32(member, member.size() - 8) == html::detail::crc32(0, plain[r].data(), plain[r].size()));
+    }
+}
@@ -9,12 +9,21 @@ Usage:
     python generate_resources.py [--output-dir <path>]
 
 This will generate:
-    - bootstrap_css.cpp
-    - bootstrap_js.cpp
-    - apexcharts_js.cpp
+    - bootstrap_css.cpp, bootstrap_css_gz.cpp
+    - bootstrap_js.cpp,  bootstrap_js_gz.cpp
+    - apexcharts_js.cpp, apexcharts_js_gz.cpp
+
+The *_gz.cpp files hold each resource as a complete gzip member (mtime 0, so
+the output is reproducible). gzip_writer splices these members into a gzip
+page stream as-is. With --brotli (needs the 'brotli' module) *_br.cpp files
+with brotli-compressed variants are generated as well; build with
+HTML_GEN_BROTLI_RESOURCES to declare them.
+
+Use --input-dir to read previously downloaded files instead of the CDN.
 """
 
 import argparse
+import gzip
 import os
 import urllib.request
 import sys
@@ -52,6 +61,30 @@ def download_file(url: str) -> bytes:
         sys.exit(1)
 
 
+def read_local_file(input_dir: str, url: str) -> bytes:
+    """Read a previously downloaded file (named like the last URL component)."""
+    path = os.path.join(input_dir, url.rsplit('/', 1)[-1])
+    print(f"  Reading: {path}")
+    with open(path, 'rb') as f:
+        data = f.read()
+    print(f"  Read: {len(data):,} bytes")
+    return data
+
+
+def gzip_member(data: bytes) -> bytes:
+    """Compress data into a single, reproducible gzip member."""
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def brotli_compress(data: bytes) -> bytes:
+    try:
+        import brotli
+    except ImportError:
+        print("  ERROR: --brotli needs the 'brotli' Python module (pip install brotli)")
+        sys.exit(1)
+    return brotli.compress(data, quality=11)
+
+
 def bytes_to_c_array(data: bytes, var_name: str) -> str:
     """Convert bytes to a C char array string."""
     # Convert to list of signed char values (handle bytes > 127 properly)
@@ -81,39 +114,66 @@ def bytes_to_c_array(data: bytes, var_name: str) -> str:
 """
 
 
-def generate_cpp_file(resource_key: str, output_dir: str) -> None:
-    """Generate a .cpp file for a resource."""
-    resource = RESOURCES[resource_key]
-
-    print(f"\nProcessing {resource_key}...")
-
-    # Download the file
-    data = download_file(resource['url'])
-
-    # Convert to C array
+def write_cpp_file(output_dir: str, filename: str, source: str, description: str,
+                   data: bytes, var_name: str) -> None:
+    """Write one generated .cpp file holding data as a char array."""
     cpp_content = f"""/*  ===================================================================
-*                      HTML Generator Library - Resources
-*               Copyright 1999 - 2024 by Peter Ritter
-*                A L L   R I G H T S   R E S E R V E D
+*                         HtmlGen++
+*            Copyright (c) 2015-2024 Peter Ritter
+*                  Licensed under MIT License
 *  ====================================================================
 *
+*
 *  Auto-generated by tools/generate_resources.py
-*  Source: {resource['url']}
-*  Size: {len(data):,} bytes
+*  Source: {source}
+*  {description}: {len(data):,} bytes
 */
 
-#include "../../include/html_resources.h"
+#include "../../include/html_gen_resources.h"
 
-{bytes_to_c_array(data, resource['var_name'])}
+{bytes_to_c_array(data, var_name)}
 """
 
-    # Write to file
-    output_path = os.path.join(output_dir, resource['filename'])
+    output_path = os.path.join(output_dir, filename)
     with open(output_path, 'w', encoding='utf-8') as f:
         f.write(cpp_content)
 
-    print(f"  Generated: {output_path}")
-    print(f"  Array size: {len(data):,} bytes")
+    print(f"  Generated: {output_path} ({len(data):,} bytes)")
+
+
+def generate_cpp_file(resource_key: str, output_dir: str, input_dir: str,
+                      with_gzip: bool, with_brotli: bool) -> list:
+    """Generate the .cpp files for a resource; returns the file names."""
+    resource = RESOURCES[resource_key]
+    base = resource['filename'][:-len('.cpp')]
+    files = []
+
+    print(f"\nProcessing {resource_key}...")
+
+    if input_dir:
+        data = read_local_file(input_dir, resource['url'])
+    else:
+        data = download_file(resource['url'])
+
+    write_cpp_file(output_dir, resource['filename'], resource['url'], 'Size',
+                   data, resource['var_name'])
+    files.append(resource['filename'])
+
+    if with_gzip:
+        gz = gzip_member(data)
+        write_cpp_file(output_dir, f"{base}_gz.cpp", resource['url'],
+                       f"gzip member of {len(data):,} bytes, size", gz,
+                       f"{resource['var_name']}_gz")
+        files.append(f"{base}_gz.cpp")
+
+    if with_brotli:
+        br = brotli_compress(data)
+        write_cpp_file(output_dir, f"{base}_br.cpp", resource['url'],
+                       f"brotli stream of {len(data):,} bytes, size", br,
+                       f"{resource['var_name']}_br")
+        files.append(f"{base}_br.cpp")
+
+    return files
 
 
 def main():
@@ -125,6 +185,21 @@ def main():
         default='../src/resources',
         help='Output directory for generated .cpp files'
     )
+    parser.add_argument(
+        '--input-dir',
+        default=None,
+        help='Read the resource files from this directory instead of downloading them'
+    )
+    parser.add_argument(
+        '--no-gzip',
+        action='store_true',
+        help='Do not generate the precompressed gzip variants'
+    )
+    parser.add_argument(
+        '--brotli',
+        action='store_true',
+        help='Also generate brotli-compressed variants'
+    )
 
     args = parser.parse_args()
 
@@ -138,14 +213,20 @@ def main():
     print(f"Output directory: {output_dir}")
     print("=" * 60)
 
+    input_dir = None
+    if args.input_dir:
+        input_dir = os.path.abspath(args.input_dir)
+
     # Generate each resource file
+    generated = []
     for resource_key in RESOURCES:
-        generate_cpp_file(resource_key, output_dir)
+        generated += generate_cpp_file(resource_key, output_dir, input_dir,
+                                       not args.no_gzip, args.brotli)
 
     print("\n" + "=" * 60)
     print("Done! Generated files:")
-    for resource in RESOURCES.values():
-        print(f"  - {resource['filename']}")
+    for filename in generated:
+        print(f"  - {filename}")
     print("\nRemember to update CMakeLists.txt to include these files.")
 
 